@@ -41,10 +41,20 @@
  *   OSMesaGetIntegerv - return OSMesa state parameters
  *
  *
- * The limits on the width and height of an image buffer are MAX_WIDTH and
- * MAX_HEIGHT as defined in Mesa/src/config.h.  Defaults are 1280 and 1024.
- * You can increase them as needed but beware that many temporary arrays in
- * Mesa are dimensioned by MAX_WIDTH or MAX_HEIGHT.
+ * Mesa renders at most MAX_WIDTH x MAX_HEIGHT pixels at once (see
+ * Mesa/src/config.h, defaults 4096 x 4096).  Larger image buffers are
+ * rendered in tiles:  the commands of each frame are recorded and, when the
+ * frame ends with glFinish or glFlush, replayed for every tile but the
+ * first, which is drawn as the commands arrive.  Tiles may be replayed by
+ * several threads, see OSMESA_TILE_THREADS.  When tiling:
+ *   - the image is only complete after glFinish or glFlush,
+ *   - glReadPixels, glCopyPixels, queries, feedback, selection and
+ *     OSMesaGetDepthBuffer only see the first tile (the lower-left corner),
+ *   - only the color buffer is kept from one frame to the next,
+ *   - when the viewport is much larger than MAX_WIDTH x MAX_HEIGHT, points
+ *     and lines wider than one pixel may show seams at tile edges,
+ *   - frames which define textures, programs or color tables are replayed
+ *     by a single thread.
  */
 
 
@@ -85,6 +95,9 @@ extern "C" {
  */
 #define OSMESA_ROW_LENGTH	0x10
 #define OSMESA_Y_UP		0x11
+#define OSMESA_TILE_WIDTH	0x12  /* new in 6.4 */
+#define OSMESA_TILE_HEIGHT	0x13  /* new in 6.4 */
+#define OSMESA_TILE_THREADS	0x14  /* new in 6.4 */
 
 
 /*
@@ -162,14 +175,17 @@ OSMesaDestroyContext( OSMesaContext ctx );
  * If the context's viewport hasn't been initialized yet, it will now be
  * initialized to (0,0,width,height).
  *
+ * Images larger than the tile size (MAX_WIDTH x MAX_HEIGHT unless changed
+ * with OSMesaPixelStore) are rendered in tiles, see above.
+ *
  * Input:  ctx - the rendering context
  *         buffer - the image buffer memory
  *         type - data type for pixel components, only GL_UNSIGNED_BYTE
  *                supported now
  *         width, height - size of image buffer in pixels, at least 1
  * Return:  GL_TRUE if success, GL_FALSE if error because of invalid ctx,
- *          invalid buffer address, type!=GL_UNSIGNED_BYTE, width<1, height<1,
- *          width>internal limit or height>internal limit.
+ *          invalid buffer address, type!=GL_UNSIGNED_BYTE, width<1 or
+ *          height<1.
  */
 GLAPI GLboolean GLAPIENTRY
 OSMesaMakeCurrent( OSMesaContext ctx, void *buffer, GLenum type,
@@ -195,6 +211,12 @@ OSMesaGetCurrentContext( void );
  *                 OSMESA_Y_UP
  *                    zero = Y coordinates increase downward
  *                    non-zero = Y coordinates increase upward (default)
+ *                 OSMESA_TILE_WIDTH, OSMESA_TILE_HEIGHT
+ *                    largest tile rendered at once, from 1 to
+ *                    MAX_WIDTH/MAX_HEIGHT (default)
+ *                 OSMESA_TILE_THREADS
+ *                    number of threads replaying the tiles, 1 = only
+ *                    the calling thread (default)
  *         value - the value for the parameter pname
  *
  * New in version 2.0.
@@ -213,6 +235,8 @@ OSMesaPixelStore( GLint pname, GLint value );
  *                 OSMESA_TYPE  return color component data type
  *                 OSMESA_ROW_LENGTH return row length in pixels
  *                 OSMESA_Y_UP returns 1 or 0 to indicate Y axis direction
+ *                 OSMESA_TILE_WIDTH, OSMESA_TILE_HEIGHT return tile size
+ *                 OSMESA_TILE_THREADS return number of tile threads
  *         value - pointer to integer in which to return result.
  */
 GLAPI void GLAPIENTRY
@@ -276,6 +300,32 @@ GLAPI void GLAPIENTRY
 OSMesaColorClamp(GLboolean enable);
 
 
+
+/*
+ * Free the buffers a context only needs while drawing: the rasterizer's
+ * span buffers, the vertex pipeline's storage and the vertex array
+ * conversion buffers, a few megabytes in all.  They are reallocated
+ * when the context next draws; a new context doesn't allocate them
+ * until then either.  Meant for applications keeping many mostly idle
+ * contexts.  The context must not be in use by another thread.
+ * Input:  ctx - the OSMesa context
+ */
+GLAPI void GLAPIENTRY
+OSMesaTrimContext( OSMesaContext ctx );
+
+
+
+/*
+ * Return the number of bytes of memory held by a context, including
+ * its depth, stencil and accumulation buffers but neither the image
+ * buffer passed to OSMesaMakeCurrent nor state shared with other
+ * contexts (texture objects, display lists, programs).
+ * Input:  ctx - the OSMesa context
+ */
+GLAPI GLuint GLAPIENTRY
+OSMesaGetContextMemory( OSMesaContext ctx );
+
+
 #if defined(__BEOS__) || defined(__QUICKDRAW__)
 #pragma export off
 #endif
@@ -0,0 +1,155 @@
+/*
+ * Measure how long it takes to create, bind, use and destroy an OSMesa
+ * context, the cost a short-lived render job pays every time.
+ *
+ * Usage:  ctxbench [count] [size]
+ *
+ * Each of count iterations creates an RGBA context with a 16-bit depth
+ * buffer, binds it to a size x size buffer, clears it and draws one
+ * triangle, then destroys the context.  The times of the four steps are
+ * reported separately.  The first iteration is reported on its own, since
+ * it also builds the tables which are shared by every context of the
+ * process.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "GL/osmesa.h"
+#include "GL/gl.h"
+
+
+enum { CREATE, BIND, DRAW, DESTROY, NUM_STEPS };
+
+static const char *StepName[NUM_STEPS] = {
+   "create", "bind", "draw", "destroy"
+};
+
+
+static double
+now( void )
+{
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+
+/*
+ * Run one create/bind/draw/destroy cycle, adding the time of each step
+ * to times[].
+ */
+static void
+cycle( GLubyte *buffer, int size, double times[NUM_STEPS] )
+{
+   OSMesaContext ctx;
+   double t0, t1, t2, t3, t4;
+
+   t0 = now();
+   ctx = OSMesaCreateContextExt(OSMESA_RGBA, 16, 0, 0, NULL);
+   if (!ctx) {
+      fprintf(stderr, "ctxbench: OSMesaCreateContextExt failed\n");
+      exit(1);
+   }
+
+   t1 = now();
+   if (!OSMesaMakeCurrent(ctx, buffer, GL_UNSIGNED_BYTE, size, size)) {
+      fprintf(stderr, "ctxbench: OSMesaMakeCurrent failed\n");
+      exit(1);
+   }
+
+   t2 = now();
+   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+   glEnable(GL_DEPTH_TEST);
+   glBegin(GL_TRIANGLES);
+   glColor3f(1.0, 0.0, 0.0);
+   glVertex2f(-0.5, -0.5);
+   glColor3f(0.0, 1.0, 0.0);
+   glVertex2f(0.5, -0.5);
+   glColor3f(0.0, 0.0, 1.0);
+   glVertex2f(0.0, 0.5);
+   glEnd();
+   glFinish();
+
+   t3 = now();
+   OSMesaDestroyContext(ctx);
+   t4 = now();
+
+   times[CREATE] += t1 - t0;
+   times[BIND] += t2 - t1;
+   times[DRAW] += t3 - t2;
+   times[DESTROY] += t4 - t3;
+}
+
+
+static void
+report( const char *what, const double times[NUM_STEPS], int count )
+{
+   double total = 0.0;
+   int i;
+
+   printf("%-7s", what);
+   for (i = 0; i < NUM_STEPS; i++) {
+      printf("  %s %8.1f", StepName[i], times[i] / count * 1e6);
+      total += times[i];
+   }
+   printf("  total %8.1f us/context\n", total / count * 1e6);
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+   int count = argc > 1 ? atoi(argv[1]) : 200;
+   int size = argc > 2 ? atoi(argv[2]) : 64;
+   double first[NUM_STEPS] = { 0 }, rest[NUM_STEPS] = { 0 };
+   GLubyte *buffer;
+   int i;
+
+   if (count < 2 || size < 1) {
+      fprintf(stderr, "usage: ctxbench [count >= 2] [size]\n");
+      return 1;
+   }
+
+   buffer = (GLubyte *) malloc(size * size * 4);
+   if (!buffer) {
+      fprintf(stderr, "ctxbench: out of memory\n");
+      return 1;
+   }
+
+   cycle(buffer, size, first);
+   for (i = 1; i < count; i++)
+      cycle(buffer, size, rest);
+
+   printf("%d contexts, %dx%d\n", count, size, size);
+   report("first:", first, 1);
+   report("rest:", rest, count - 1);
+
+   free(buffer);
+   return 0;
+}
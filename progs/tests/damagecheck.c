@@ -0,0 +1,283 @@
+/*
+ * Check that swapping only the damaged regions (MESA_SWAP_DAMAGE) leaves
+ * the same window contents as swapping the whole back buffer.
+ *
+ * Usage:  damagecheck [width] [height] [frames]
+ *
+ * Two double-buffered windows are opened side by side, the first with
+ * damage tracking off and the second with it on.  Every frame draws the
+ * same small updates into both (scissored clears, triangles, wide lines,
+ * points, a bitmap, zoomed DrawPixels and CopyPixels), swaps, and reads
+ * back both windows.  The program stops at the first pixel that differs
+ * and exits with status 1.
+ *
+ * It needs the Xlib driver's libGL and an X server without a window
+ * manager that could move or overlap the windows, e.g. a local Xvfb:
+ *
+ *    Xvfb :1 &
+ *    DISPLAY=:1 ./damagecheck
+ *
+ * MESA_SWAP_THREAD may be set as well to check the presentation thread.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <GL/gl.h>
+#include <GL/glx.h>
+
+
+#define GAP 10
+
+static int Width = 300, Height = 200;
+
+
+static Bool
+is_map_notify( Display *dpy, XEvent *ev, XPointer arg )
+{
+   (void) dpy;
+   return ev->type == MapNotify && ev->xmap.window == *(Window *) arg;
+}
+
+
+/*
+ * Open a mapped window at x and a context for it.  The Xlib driver reads
+ * MESA_SWAP_DAMAGE when the window's buffer is created, on the first
+ * glXMakeCurrent, so the variable is set or cleared just before that.
+ */
+static Window
+make_window( Display *dpy, XVisualInfo *vis, int x, int damage,
+             GLXContext *ctx )
+{
+   XSetWindowAttributes attr;
+   Window win;
+   XEvent ev;
+
+   attr.colormap = XCreateColormap(dpy, RootWindow(dpy, vis->screen),
+                                   vis->visual, AllocNone);
+   attr.border_pixel = 0;
+   attr.event_mask = StructureNotifyMask;
+   win = XCreateWindow(dpy, RootWindow(dpy, vis->screen), x, 0,
+                       Width, Height, 0, vis->depth, InputOutput,
+                       vis->visual, CWColormap | CWBorderPixel | CWEventMask,
+                       &attr);
+   XMapWindow(dpy, win);
+   XIfEvent(dpy, &ev, is_map_notify, (XPointer) &win);
+
+   if (damage)
+      setenv("MESA_SWAP_DAMAGE", "1", 1);
+   else
+      unsetenv("MESA_SWAP_DAMAGE");
+
+   *ctx = glXCreateContext(dpy, vis, NULL, True);
+   if (!*ctx || !glXMakeCurrent(dpy, win, *ctx)) {
+      fprintf(stderr, "damagecheck: can't create a GLX context\n");
+      exit(1);
+   }
+   return win;
+}
+
+
+/*
+ * Draw frame f: a handful of small updates which move a little from one
+ * frame to the next.  Frame 0 also clears the whole window.
+ */
+static void
+draw( int f )
+{
+   static const GLubyte bitmap[8] = {
+      0xff, 0x81, 0xbd, 0xa5, 0xa5, 0xbd, 0x81, 0xff
+   };
+   GLubyte pixels[4 * 4 * 4];
+   int i;
+
+   glViewport(0, 0, Width, Height);
+   glMatrixMode(GL_PROJECTION);
+   glLoadIdentity();
+   glOrtho(0, Width, 0, Height, -1, 1);
+   glMatrixMode(GL_MODELVIEW);
+   glLoadIdentity();
+
+   if (f == 0) {
+      glDisable(GL_SCISSOR_TEST);
+      glClearColor(0.1, 0.2, 0.3, 1.0);
+      glClear(GL_COLOR_BUFFER_BIT);
+   }
+
+   glEnable(GL_SCISSOR_TEST);
+   glScissor(10 + 5 * (f % 20), 10, 40, 30);
+   glClearColor(0.1 * (f % 10), 0.5, 0.0, 1.0);
+   glClear(GL_COLOR_BUFFER_BIT);
+   glDisable(GL_SCISSOR_TEST);
+
+   glBegin(GL_TRIANGLES);
+   glColor3f(1.0, 0.0, 0.0);
+   glVertex2f(Width - 60 - f % 30, Height - 60);
+   glColor3f(0.0, 1.0, 0.0);
+   glVertex2f(Width - 10, Height - 55 + f % 20);
+   glColor3f(0.0, 0.0, 1.0);
+   glVertex2f(Width - 30, Height - 10);
+   glEnd();
+
+   glLineWidth(3.0);
+   glBegin(GL_LINES);
+   glColor3f(1.0, 1.0, 0.0);
+   glVertex2f(100, 50);
+   glVertex2f(140 + f % 40, 70 + f % 25);
+   glEnd();
+   glLineWidth(1.0);
+
+   glPointSize(3.0);
+   glBegin(GL_POINTS);
+   glColor3f(1.0, 1.0, 1.0);
+   glVertex2f(200 + f % 50, 100);
+   glVertex2f(20, Height - 20 - f % 40);
+   glEnd();
+   glPointSize(1.0);
+
+   glColor3f(0.0, 1.0, 1.0);
+   glRasterPos2i(150 + f % 30, 150 % Height);
+   glBitmap(8, 8, 0, 0, 0, 0, bitmap);
+
+   for (i = 0; i < 4 * 4 * 4; i++)
+      pixels[i] = (GLubyte) (i * 16 + f * 7);
+   glPixelZoom(2.0, 2.0);
+   glRasterPos2i(220, 30 + f % 20);
+   glDrawPixels(4, 4, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+   glPixelZoom(1.0, 1.0);
+
+   glRasterPos2i(60 + f % 40, 120 % Height);
+   glCopyPixels(Width - 60, Height - 60, 20, 20, GL_COLOR);
+}
+
+
+/*
+ * Compare the two windows and report the first pixel that differs.
+ */
+static int
+compare( Display *dpy, Window full, Window damage, int f )
+{
+   XImage *a = XGetImage(dpy, full, 0, 0, Width, Height, ~0UL, ZPixmap);
+   XImage *b = XGetImage(dpy, damage, 0, 0, Width, Height, ~0UL, ZPixmap);
+   int x, y, ok = 1;
+
+   if (!a || !b) {
+      fprintf(stderr, "damagecheck: XGetImage failed\n");
+      exit(1);
+   }
+
+   for (y = 0; y < Height && ok; y++) {
+      for (x = 0; x < Width; x++) {
+         unsigned long pa = XGetPixel(a, x, y), pb = XGetPixel(b, x, y);
+         if (pa != pb) {
+            printf("frame %d: pixel (%d, %d) is 0x%lx with full swaps, "
+                   "0x%lx with damage swaps\n", f, x, y, pa, pb);
+            ok = 0;
+            break;
+         }
+      }
+   }
+
+   XDestroyImage(a);
+   XDestroyImage(b);
+   return ok;
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+   static int attribs[] = {
+      GLX_RGBA, GLX_DOUBLEBUFFER, GLX_RED_SIZE, 1, GLX_GREEN_SIZE, 1,
+      GLX_BLUE_SIZE, 1, None
+   };
+   int frames = 30;
+   Display *dpy;
+   XVisualInfo *vis;
+   Window full, damage;
+   GLXContext fullCtx, damageCtx;
+   int f;
+
+   if (argc > 1)
+      Width = atoi(argv[1]);
+   if (argc > 2)
+      Height = atoi(argv[2]);
+   if (argc > 3)
+      frames = atoi(argv[3]);
+   if (Width < 1 || Height < 1 || frames < 1) {
+      fprintf(stderr, "usage: damagecheck [width] [height] [frames]\n");
+      return 1;
+   }
+
+   dpy = XOpenDisplay(NULL);
+   if (!dpy) {
+      fprintf(stderr, "damagecheck: can't open display\n");
+      return 1;
+   }
+   if (2 * Width + GAP > DisplayWidth(dpy, DefaultScreen(dpy)) ||
+       Height > DisplayHeight(dpy, DefaultScreen(dpy))) {
+      fprintf(stderr, "damagecheck: two %dx%d windows don't fit on the "
+              "screen\n", Width, Height);
+      return 1;
+   }
+   vis = glXChooseVisual(dpy, DefaultScreen(dpy), attribs);
+   if (!vis) {
+      fprintf(stderr, "damagecheck: no double-buffered RGB visual\n");
+      return 1;
+   }
+
+   full = make_window(dpy, vis, 0, 0, &fullCtx);
+   damage = make_window(dpy, vis, Width + GAP, 1, &damageCtx);
+
+   for (f = 0; f < frames; f++) {
+      glXMakeCurrent(dpy, full, fullCtx);
+      draw(f);
+      glXSwapBuffers(dpy, full);
+      glXWaitGL();
+
+      glXMakeCurrent(dpy, damage, damageCtx);
+      draw(f);
+      glXSwapBuffers(dpy, damage);
+      glXWaitGL();
+
+      XSync(dpy, False);
+      if (!compare(dpy, full, damage, f))
+         return 1;
+   }
+
+   printf("%dx%d, %d frames: damage swaps match full swaps\n",
+          Width, Height, frames);
+
+   glXMakeCurrent(dpy, None, NULL);
+   glXDestroyContext(dpy, fullCtx);
+   glXDestroyContext(dpy, damageCtx);
+   XCloseDisplay(dpy);
+   return 0;
+}
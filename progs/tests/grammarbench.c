@@ -0,0 +1,313 @@
+/*
+ * Measure how fast the ARB program grammar is loaded and how fast it
+ * parses vertex and fragment programs.
+ *
+ * Usage:  grammarbench [programs] [instructions] [passes]
+ *
+ * A set of programs is generated from a fixed seed, half !!ARBvp1.0 and
+ * half !!ARBfp1.0, each with the given number of instructions.  Every
+ * pass parses the whole set with grammar_fast_check(), the way
+ * _mesa_parse_arb_program() does, and the fastest pass is reported along
+ * with the time to load the grammar from its text.  A checksum of the
+ * productions is printed so that changes to the matcher can be checked
+ * for identical output.
+ *
+ * The program is linked against libGL for the grammar_*() functions.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "grammar_mesa.h"
+
+
+static const char *ArbSyn =
+#include "arbprogram_syn.h"
+;
+
+/* program_target register values, from arbprogram.syn */
+#define FRAGMENT_PROGRAM 0x10
+#define VERTEX_PROGRAM   0x20
+
+static const char *Extensions[] = {
+   "vertex_blend",
+   "matrix_palette",
+   "point_parameters",
+   "secondary_color",
+   "fog_coord",
+   "texture_rectangle",
+   "fragment_program_shadow",
+   "draw_buffers"
+};
+
+static const char *VertexHeader =
+   "!!ARBvp1.0\n"
+   "ATTRIB pos = vertex.position;\n"
+   "ATTRIB nrm = vertex.normal;\n"
+   "PARAM mvp[4] = { state.matrix.mvp };\n"
+   "PARAM lp = state.light[0].position;\n"
+   "PARAM c[8] = { program.local[0..7] };\n"
+   "ADDRESS a0;\n"
+   "TEMP r0, r1, r2, r3;\n"
+   "ARL a0.x, c[0].x;\n";
+
+static const char *VertexFooter =
+   "DP4 result.position.x, mvp[0], pos;\n"
+   "DP4 result.position.y, mvp[1], pos;\n"
+   "DP4 result.position.z, mvp[2], pos;\n"
+   "DP4 result.position.w, mvp[3], pos;\n"
+   "MOV result.color, r0;\n"
+   "END\n";
+
+static const char *VertexSrc[] = {
+   "pos", "nrm", "lp", "mvp[3]", "c[a0.x+2]", "r0", "r1", "r2", "r3"
+};
+
+static const char *FragmentHeader =
+   "!!ARBfp1.0\n"
+   "# generated\n"
+   "OPTION ARB_precision_hint_fastest;\n"
+   "ATTRIB tc = fragment.texcoord[0];\n"
+   "ATTRIB col = fragment.color.primary;\n"
+   "PARAM c0 = program.local[0];\n"
+   "PARAM c1 = { 0.5, 0.25, -1.0, 2.0 };\n"
+   "PARAM env[4] = { program.env[0..3] };\n"
+   "TEMP r0, r1, r2, r3;\n"
+   "OUTPUT out = result.color;\n";
+
+static const char *FragmentFooter =
+   "MOV out, r0;\n"
+   "END\n";
+
+static const char *FragmentSrc[] = {
+   "tc", "col", "c0", "c1", "env[1]", "r0", "r1", "r2", "r3"
+};
+
+static const char *Temps[] = { "r0", "r1", "r2", "r3" };
+static const char *Masks[] = { "", ".x", ".xy", ".yz", ".w", ".xyz" };
+static const char *Swizzles[] = { "", ".x", ".yzxw", ".xxyy", ".wwww" };
+
+static const char *VectorOps[] = {
+   "ADD", "SUB", "MUL", "MAX", "MIN", "DP3", "DP4", "SGE", "SLT"
+};
+static const char *ScalarOps[] = { "RCP", "RSQ", "EX2", "LG2" };
+
+#define ELEMENTS(a) (sizeof(a) / sizeof(a[0]))
+
+
+static unsigned int Seed = 1;
+
+static unsigned int
+rnd( unsigned int n )
+{
+   Seed = Seed * 1103515245 + 12345;
+   return (Seed >> 16) % n;
+}
+
+
+static char *
+append( char *p, const char *s )
+{
+   size_t len = strlen(s);
+   memcpy(p, s, len + 1);
+   return p + len;
+}
+
+
+static char *
+operand( char *p, const char **src, unsigned int numSrc, int scalar )
+{
+   if (rnd(4) == 0)
+      p = append(p, "-");
+   p = append(p, src[rnd(numSrc)]);
+   return append(p, scalar ? ".x" : Swizzles[rnd(ELEMENTS(Swizzles))]);
+}
+
+
+/**
+ * Generate one program with \p count instructions between a fixed header
+ * and footer.  The caller frees the result.
+ */
+static char *
+generate( int vertex, int count )
+{
+   const char **src = vertex ? VertexSrc : FragmentSrc;
+   unsigned int numSrc = vertex ? ELEMENTS(VertexSrc) : ELEMENTS(FragmentSrc);
+   char *text = (char *) malloc(1024 + count * 64);
+   char *p = text;
+   int i;
+
+   p = append(p, vertex ? VertexHeader : FragmentHeader);
+   for (i = 0; i < count; i++) {
+      const unsigned int kind = rnd(8);
+
+      if (kind == 0) {
+         p = append(p, ScalarOps[rnd(ELEMENTS(ScalarOps))]);
+         p = append(p, " ");
+         p = append(p, Temps[rnd(ELEMENTS(Temps))]);
+         p = append(p, Masks[rnd(ELEMENTS(Masks))]);
+         p = append(p, ", ");
+         p = operand(p, src, numSrc, 1);
+      }
+      else if (kind == 1) {
+         p = append(p, "MAD ");
+         p = append(p, Temps[rnd(ELEMENTS(Temps))]);
+         p = append(p, Masks[rnd(ELEMENTS(Masks))]);
+         p = append(p, ", ");
+         p = operand(p, src, numSrc, 0);
+         p = append(p, ", ");
+         p = operand(p, src, numSrc, 0);
+         p = append(p, ", ");
+         p = operand(p, src, numSrc, 0);
+      }
+      else if (kind == 2 && !vertex) {
+         p = append(p, "TEX ");
+         p = append(p, Temps[rnd(ELEMENTS(Temps))]);
+         p = append(p, ", ");
+         p = append(p, rnd(2) ? "tc" : "r1");
+         p = append(p, rnd(2) ? ", texture[0], 2D" : ", texture[1], CUBE");
+      }
+      else {
+         p = append(p, VectorOps[rnd(ELEMENTS(VectorOps))]);
+         p = append(p, " ");
+         p = append(p, Temps[rnd(ELEMENTS(Temps))]);
+         p = append(p, Masks[rnd(ELEMENTS(Masks))]);
+         p = append(p, ", ");
+         p = operand(p, src, numSrc, 0);
+         p = append(p, ", ");
+         p = operand(p, src, numSrc, 0);
+      }
+      p = append(p, ";\n");
+   }
+   append(p, vertex ? VertexFooter : FragmentFooter);
+   return text;
+}
+
+
+static double
+now( void )
+{
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+
+static unsigned int
+checksum( unsigned int h, const byte *p, unsigned int n )
+{
+   unsigned int i;
+   for (i = 0; i < n; i++)
+      h = (h ^ p[i]) * 16777619u;
+   return h;
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+   int numPrograms = argc > 1 ? atoi(argv[1]) : 200;
+   int numInstructions = argc > 2 ? atoi(argv[2]) : 60;
+   int passes = argc > 3 ? atoi(argv[3]) : 5;
+   char **programs;
+   size_t bytes = 0;
+   double t, load, best = 1e9;
+   unsigned int sum = 0;
+   grammar id;
+   int i, pass;
+
+   if (numPrograms < 1 || numInstructions < 0 || passes < 1) {
+      fprintf(stderr, "usage: grammarbench [programs] [instructions] [passes]\n");
+      return 1;
+   }
+
+   programs = (char **) malloc(numPrograms * sizeof(char *));
+   for (i = 0; i < numPrograms; i++) {
+      programs[i] = generate(i & 1, numInstructions);
+      bytes += strlen(programs[i]);
+   }
+
+   t = now();
+   for (i = 0; i < 10; i++) {
+      id = grammar_load_from_text((const byte *) ArbSyn);
+      if (!id) {
+         fprintf(stderr, "grammarbench: can't load the ARB program grammar\n");
+         return 1;
+      }
+      grammar_destroy(id);
+   }
+   load = (now() - t) / 10;
+
+   id = grammar_load_from_text((const byte *) ArbSyn);
+   for (i = 0; i < (int) ELEMENTS(Extensions); i++)
+      grammar_set_reg8(id, (const byte *) Extensions[i], 1);
+
+   for (pass = 0; pass < passes; pass++) {
+      unsigned int h = 2166136261u;
+
+      t = now();
+      for (i = 0; i < numPrograms; i++) {
+         byte *prod;
+         unsigned int size;
+
+         grammar_set_reg8(id, (const byte *) "program_target",
+                          (i & 1) ? VERTEX_PROGRAM : FRAGMENT_PROGRAM);
+         if (!grammar_fast_check(id, (const byte *) programs[i], &prod,
+                                 &size, 0x1000)) {
+            byte msg[256];
+            int pos;
+            grammar_get_last_error(msg, sizeof(msg), &pos);
+            fprintf(stderr, "grammarbench: program %d: %s at %d\n",
+                    i, (char *) msg, pos);
+            return 1;
+         }
+         h = checksum(h, prod, size);
+         grammar_alloc_free(prod);
+      }
+      t = now() - t;
+      if (t < best)
+         best = t;
+      if (pass == 0)
+         sum = h;
+      else if (h != sum)
+         fprintf(stderr, "grammarbench: productions differ between passes\n");
+   }
+   grammar_destroy(id);
+
+   printf("%d programs, %d instructions, %lu KB\n", numPrograms,
+          numInstructions, (unsigned long) (bytes / 1024));
+   printf("grammar load: %8.3f ms\n", load * 1e3);
+   printf("parse:        %8.3f ms/program, %.2f MB/s, checksum %08x\n",
+          best * 1e3 / numPrograms, bytes / best / 1e6, sum);
+
+   for (i = 0; i < numPrograms; i++)
+      free(programs[i]);
+   free(programs);
+   return 0;
+}
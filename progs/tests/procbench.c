@@ -0,0 +1,224 @@
+/*
+ * Measure how fast _glapi_get_proc_address() looks up GL functions by
+ * name.
+ *
+ * Usage:  procbench [rounds] [threads]
+ *
+ * Each round looks up every name of the static table in glprocs.h, the
+ * same names with a suffix which makes them unknown, and a set of new
+ * extension names added at run time.  The time per lookup is reported for
+ * each kind.  Before that, _glapi_get_proc_offset() is checked against
+ * the static table, and the given number of threads look up the same new
+ * names concurrently and must all get the same functions.
+ *
+ * Platforms on which glapi can't generate entry points return NULL for
+ * new names, so there the dynamic lookups measure misses in the table of
+ * dynamic names.
+ *
+ * The program is linked against libGL for the _glapi_*() functions.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "glapi.h"
+#include "glapioffsets.h"
+#include "glprocs.h"
+
+
+#define NUM_DYNAMIC 100
+#define MAX_THREADS 16
+
+static const char **StaticNames, **UnknownNames;
+static int NumStatic;
+static char DynamicNames[NUM_DYNAMIC][32];
+static _glapi_proc ThreadProcs[MAX_THREADS][NUM_DYNAMIC];
+
+
+static double
+now( void )
+{
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+
+static void
+make_names( void )
+{
+   int i;
+
+   for (NumStatic = 0; static_functions[NumStatic].Name_offset >= 0;
+        NumStatic++)
+      ;
+
+   StaticNames = (const char **) malloc(NumStatic * sizeof(char *));
+   UnknownNames = (const char **) malloc(NumStatic * sizeof(char *));
+   if (!StaticNames || !UnknownNames) {
+      fprintf(stderr, "procbench: out of memory\n");
+      exit(1);
+   }
+   for (i = 0; i < NumStatic; i++) {
+      const char *name = gl_string_table + static_functions[i].Name_offset;
+      char *unknown = (char *) malloc(strlen(name) + 4);
+      if (!unknown) {
+         fprintf(stderr, "procbench: out of memory\n");
+         exit(1);
+      }
+      strcpy(unknown, name);
+      strcat(unknown, "XYZ");
+      StaticNames[i] = name;
+      UnknownNames[i] = unknown;
+   }
+
+   for (i = 0; i < NUM_DYNAMIC; i++)
+      sprintf(DynamicNames[i], "glProcbench%dEXT", i);
+}
+
+
+/*
+ * Every static name must map to its offset in glprocs.h.
+ */
+static void
+check_offsets( void )
+{
+   int i;
+
+   for (i = 0; i < NumStatic; i++) {
+      const GLint offset = _glapi_get_proc_offset(StaticNames[i]);
+      if (offset != (GLint) static_functions[i].Offset) {
+         fprintf(stderr, "procbench: offset of %s is %d, not %u\n",
+                 StaticNames[i], offset, static_functions[i].Offset);
+         exit(1);
+      }
+   }
+}
+
+
+static void *
+lookup_dynamic( void *arg )
+{
+   _glapi_proc *procs = (_glapi_proc *) arg;
+   int i;
+
+   for (i = 0; i < NUM_DYNAMIC; i++)
+      procs[i] = _glapi_get_proc_address(DynamicNames[i]);
+   return NULL;
+}
+
+
+/*
+ * Add the dynamic names from several threads at once; they must all get
+ * the same functions.
+ */
+static void
+check_threads( int threads )
+{
+   pthread_t thread[MAX_THREADS];
+   int i, j;
+
+   for (i = 0; i < threads; i++) {
+      if (pthread_create(&thread[i], NULL, lookup_dynamic, ThreadProcs[i])) {
+         fprintf(stderr, "procbench: can't create a thread\n");
+         exit(1);
+      }
+   }
+   for (i = 0; i < threads; i++)
+      pthread_join(thread[i], NULL);
+
+   for (i = 1; i < threads; i++) {
+      for (j = 0; j < NUM_DYNAMIC; j++) {
+         if (ThreadProcs[i][j] != ThreadProcs[0][j]) {
+            fprintf(stderr, "procbench: threads got different functions "
+                    "for %s\n", DynamicNames[j]);
+            exit(1);
+         }
+      }
+   }
+}
+
+
+/*
+ * Return the time per lookup of count names, repeated rounds times.
+ */
+static double
+time_lookups( const char *const *names, int count, int rounds )
+{
+   unsigned long sum = 0;
+   double t = now();
+   int r, i;
+
+   for (r = 0; r < rounds; r++) {
+      for (i = 0; i < count; i++)
+         sum += (unsigned long) _glapi_get_proc_address(names[i]);
+   }
+   t = now() - t;
+
+   /* keep the lookups from being optimized away */
+   if (sum == 1)
+      printf(" ");
+   return t / ((double) rounds * count);
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+   int rounds = argc > 1 ? atoi(argv[1]) : 200;
+   int threads = argc > 2 ? atoi(argv[2]) : 4;
+   const char *dynamic[NUM_DYNAMIC];
+   double tStatic, tUnknown, tDynamic;
+   int i;
+
+   if (rounds < 1 || threads < 1 || threads > MAX_THREADS) {
+      fprintf(stderr, "usage: procbench [rounds] [threads <= %d]\n",
+              MAX_THREADS);
+      return 1;
+   }
+
+   make_names();
+   check_offsets();
+   check_threads(threads);
+
+   for (i = 0; i < NUM_DYNAMIC; i++)
+      dynamic[i] = DynamicNames[i];
+
+   tStatic = time_lookups(StaticNames, NumStatic, rounds);
+   tUnknown = time_lookups(UnknownNames, NumStatic, rounds);
+   tDynamic = time_lookups(dynamic, NUM_DYNAMIC, rounds);
+
+   printf("%d static names, %d dynamic names, %d rounds\n",
+          NumStatic, NUM_DYNAMIC, rounds);
+   printf("static:  %8.1f ns/lookup\n", tStatic * 1e9);
+   printf("unknown: %8.1f ns/lookup\n", tUnknown * 1e9);
+   printf("dynamic: %8.1f ns/lookup\n", tDynamic * 1e9);
+   return 0;
+}
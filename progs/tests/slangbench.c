@@ -0,0 +1,190 @@
+/*
+ * Measure how long the slang front end takes to parse a shader, with and
+ * without the grammar and built-in library being loaded for each compile.
+ *
+ * Usage:  slangbench [count]
+ *
+ * "per compile" repeats, for every shader, what _slang_compile() used to do
+ * each time: load the shader grammar, parse the core built-in library and
+ * then parse the shader.  "cached" loads the grammar and parses the library
+ * once and then only parses the shaders, which is what _slang_compile() does
+ * now.  The rest of the compiler isn't timed, since the assembler can't yet
+ * translate the built-in library.
+ *
+ * The program is linked against libGL for the grammar_*() functions.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "grammar_mesa.h"
+
+
+static const char *ShaderSyn =
+#include "slang_shader_syn.h"
+;
+
+static const byte CoreLibrary[] = {
+#include "slang_core_gc.h"
+};
+
+static const char *Shaders[] = {
+   "uniform vec4 scale;\n"
+   "void main() {\n"
+   "   gl_FragColor = gl_Color * scale;\n"
+   "}\n",
+
+   "uniform sampler2D tex;\n"
+   "varying vec2 coord;\n"
+   "void main() {\n"
+   "   vec4 c = texture2D(tex, coord);\n"
+   "   gl_FragColor = vec4(c.rgb * c.a, 1.0);\n"
+   "}\n",
+
+   "uniform mat4 mvp;\n"
+   "varying vec2 coord;\n"
+   "void main() {\n"
+   "   coord = gl_MultiTexCoord0.xy;\n"
+   "   gl_Position = mvp * gl_Vertex;\n"
+   "}\n",
+
+   "uniform vec3 lightDir;\n"
+   "varying vec4 color;\n"
+   "void main() {\n"
+   "   vec3 n = normalize(gl_NormalMatrix * gl_Normal);\n"
+   "   float d = max(dot(n, lightDir), 0.0);\n"
+   "   color = vec4(d, d, d, 1.0) * gl_Color;\n"
+   "   gl_Position = ftransform();\n"
+   "}\n"
+};
+
+#define NUM_SHADERS (sizeof(Shaders) / sizeof(Shaders[0]))
+
+/* shader_type register for each of Shaders[]: 1 fragment, 2 vertex */
+static const byte ShaderType[NUM_SHADERS] = { 1, 1, 2, 2 };
+
+
+static double
+now( void )
+{
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+
+static void
+check( int ok, const char *what )
+{
+   if (!ok) {
+      byte msg[256];
+      int pos;
+      grammar_get_last_error(msg, sizeof(msg), &pos);
+      fprintf(stderr, "slangbench: %s: %s at %d\n", what, (char *) msg, pos);
+      exit(1);
+   }
+}
+
+
+static grammar
+load_grammar( void )
+{
+   grammar id = grammar_load_from_text((const byte *) ShaderSyn);
+   check(id != 0, "grammar");
+   return id;
+}
+
+
+static void
+parse( grammar id, const byte *text, const char *what )
+{
+   byte *prod;
+   unsigned int size;
+
+   check(grammar_fast_check(id, text, &prod, &size, 65536), what);
+   grammar_alloc_free(prod);
+}
+
+
+static void
+parse_library( grammar id, byte shaderType )
+{
+   grammar_set_reg8(id, (const byte *) "shader_type", shaderType);
+   grammar_set_reg8(id, (const byte *) "parsing_builtin", 1);
+   parse(id, CoreLibrary, "built-in library");
+   grammar_set_reg8(id, (const byte *) "parsing_builtin", 0);
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+   int count = argc > 1 ? atoi(argv[1]) : 10;
+   double t, perCompile, cached, first;
+   grammar id;
+   int i;
+   unsigned int j;
+
+   if (count < 1) {
+      fprintf(stderr, "usage: slangbench [count]\n");
+      return 1;
+   }
+
+   t = now();
+   for (i = 0; i < count; i++) {
+      for (j = 0; j < NUM_SHADERS; j++) {
+         id = load_grammar();
+         parse_library(id, ShaderType[j]);
+         parse(id, (const byte *) Shaders[j], "shader");
+         grammar_destroy(id);
+      }
+   }
+   perCompile = (now() - t) / (count * NUM_SHADERS);
+
+   t = now();
+   id = load_grammar();
+   parse_library(id, 1);
+   parse_library(id, 2);
+   first = now() - t;
+
+   t = now();
+   for (i = 0; i < count; i++) {
+      for (j = 0; j < NUM_SHADERS; j++) {
+         grammar_set_reg8(id, (const byte *) "shader_type", ShaderType[j]);
+         parse(id, (const byte *) Shaders[j], "shader");
+      }
+   }
+   cached = (now() - t) / (count * NUM_SHADERS);
+   grammar_destroy(id);
+
+   printf("%d shaders, %d times\n", (int) NUM_SHADERS, count);
+   printf("per compile: %8.3f ms/shader\n", perCompile * 1e3);
+   printf("cached:      %8.3f ms/shader, %.3f ms once for grammar and library\n",
+          cached * 1e3, first * 1e3);
+   return 0;
+}
@@ -0,0 +1,289 @@
+/*
+ * Measure the slang assembly interpreter running a batch of invocations at
+ * once against running them one at a time.
+ *
+ * Usage:  slangexecbench [rounds]
+ *
+ * The program is hand-assembled, since the assembler can't yet translate
+ * the built-in library:
+ *
+ *    acc = 0;
+ *    for (i = 0; i < 64; i++)
+ *       if (x * i < 100) acc = acc + x * i; else acc = acc * 0.5;
+ *
+ * x, acc and i live in the first stack slots, where the program addresses
+ * them directly.  In the "uniform" case every invocation has the same x, so
+ * the branches never diverge; in the "divergent" case x is different in
+ * every invocation.  Each round runs SLANG_MACHINE_BATCH_SIZE invocations
+ * as one batch and as single invocations.  Before timing, the results are
+ * checked against the same loop in C.
+ *
+ * The program is linked against libGL for the slang_*() functions.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "imports.h"
+#include "slang_assemble.h"
+#include "slang_execute.h"
+
+
+/* byte addresses of the variables */
+#define ADDR_X   0
+#define ADDR_ACC 4
+#define ADDR_I   8
+
+#define ITERATIONS 64
+
+static slang_assembly_file File;
+static slang_machine *Machine;
+
+
+static double
+now( void )
+{
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+
+static void
+check( int ok )
+{
+   if (!ok) {
+      fprintf(stderr, "slangexecbench: out of memory\n");
+      exit(1);
+   }
+}
+
+
+static void
+emit( slang_assembly_type type )
+{
+   check(slang_assembly_file_push(&File, type));
+}
+
+
+static void
+emit_label( slang_assembly_type type, GLuint label )
+{
+   check(slang_assembly_file_push_label(&File, type, label));
+}
+
+
+static void
+emit_literal( slang_assembly_type type, GLfloat literal )
+{
+   check(slang_assembly_file_push_literal(&File, type, literal));
+}
+
+
+static void
+load( GLuint addr )
+{
+   emit_label(slang_asm_addr_push, addr);
+   emit(slang_asm_float_deref);
+}
+
+
+/*
+ * Store the value on top of the stack to the address below it and pop both.
+ */
+static void
+store( void )
+{
+   check(slang_assembly_file_push_label2(&File, slang_asm_float_copy, 4, 0));
+   emit_label(slang_asm_local_free, 4);
+}
+
+
+static void
+assemble( void )
+{
+   GLuint top, toEnd, toElse, toEndif;
+
+   slang_assembly_file_construct(&File);
+
+   emit_label(slang_asm_addr_push, ADDR_ACC);
+   emit_literal(slang_asm_float_push, 0.0f);
+   store();
+   emit_label(slang_asm_addr_push, ADDR_I);
+   emit_literal(slang_asm_float_push, 0.0f);
+   store();
+
+   /* while (i < 64) */
+   top = File.count;
+   load(ADDR_I);
+   emit_literal(slang_asm_float_push, (GLfloat) ITERATIONS);
+   emit(slang_asm_float_less);
+   toEnd = File.count;
+   emit_label(slang_asm_jump_if_zero, 0);
+
+   /* if (x * i < 100) */
+   load(ADDR_X);
+   load(ADDR_I);
+   emit(slang_asm_float_multiply);
+   emit_literal(slang_asm_float_push, 100.0f);
+   emit(slang_asm_float_less);
+   toElse = File.count;
+   emit_label(slang_asm_jump_if_zero, 0);
+
+   /* acc = acc + x * i */
+   emit_label(slang_asm_addr_push, ADDR_ACC);
+   load(ADDR_ACC);
+   load(ADDR_X);
+   load(ADDR_I);
+   emit(slang_asm_float_multiply);
+   emit(slang_asm_float_add);
+   store();
+   toEndif = File.count;
+   emit_label(slang_asm_jump, 0);
+
+   /* else acc = acc * 0.5 */
+   File.code[toElse].param[0] = File.count;
+   emit_label(slang_asm_addr_push, ADDR_ACC);
+   load(ADDR_ACC);
+   emit_literal(slang_asm_float_push, 0.5f);
+   emit(slang_asm_float_multiply);
+   store();
+   File.code[toEndif].param[0] = File.count;
+
+   /* i = i + 1 */
+   emit_label(slang_asm_addr_push, ADDR_I);
+   load(ADDR_I);
+   emit_literal(slang_asm_float_push, 1.0f);
+   emit(slang_asm_float_add);
+   store();
+   emit_label(slang_asm_jump, top);
+
+   File.code[toEnd].param[0] = File.count;
+   emit(slang_asm_exit);
+}
+
+
+static GLfloat
+reference( GLfloat x )
+{
+   GLfloat acc = 0.0f;
+   int i;
+
+   for (i = 0; i < ITERATIONS; i++) {
+      if (x * i < 100.0f)
+         acc = acc + x * i;
+      else
+         acc = acc * 0.5f;
+   }
+   return acc;
+}
+
+
+/*
+ * Run the invocations with the given inputs, count at a time, and compare
+ * the results with the C loop if verify is set.
+ */
+static void
+run( const GLfloat *x, GLuint count, int verify )
+{
+   GLuint i, l;
+
+   for (i = 0; i < SLANG_MACHINE_BATCH_SIZE; i += count) {
+      for (l = 0; l < count; l++)
+         Machine->stack[ADDR_X / 4]._float[l] = x[i + l];
+      if (!_slang_execute_batch(&File, Machine, count)) {
+         fprintf(stderr, "slangexecbench: execution failed\n");
+         exit(1);
+      }
+      for (l = 0; verify && l < count; l++) {
+         const GLfloat acc = Machine->stack[ADDR_ACC / 4]._float[l];
+         if (acc != reference(x[i + l])) {
+            fprintf(stderr, "slangexecbench: x = %g gives %g, not %g\n",
+                    x[i + l], acc, reference(x[i + l]));
+            exit(1);
+         }
+      }
+   }
+}
+
+
+static double
+time_runs( const GLfloat *x, GLuint count, int rounds )
+{
+   double t;
+   int r;
+
+   run(x, count, 1);
+   t = now();
+   for (r = 0; r < rounds; r++)
+      run(x, count, 0);
+   return (now() - t) / ((double) rounds * SLANG_MACHINE_BATCH_SIZE);
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+   int rounds = argc > 1 ? atoi(argv[1]) : 2000;
+   GLfloat uniform[SLANG_MACHINE_BATCH_SIZE];
+   GLfloat divergent[SLANG_MACHINE_BATCH_SIZE];
+   double tSingle, tBatch;
+   int i;
+
+   if (rounds < 1) {
+      fprintf(stderr, "usage: slangexecbench [rounds]\n");
+      return 1;
+   }
+
+   Machine = (slang_machine *) malloc(sizeof(slang_machine));
+   check(Machine != NULL);
+   Machine->trace = NULL;
+   assemble();
+
+   for (i = 0; i < SLANG_MACHINE_BATCH_SIZE; i++) {
+      uniform[i] = 3.0f;
+      divergent[i] = (GLfloat) (i + 1);
+   }
+
+   printf("%u instructions, %d iterations, batches of %d, %d rounds\n",
+          File.count, ITERATIONS, SLANG_MACHINE_BATCH_SIZE, rounds);
+
+   tSingle = time_runs(uniform, 1, rounds);
+   tBatch = time_runs(uniform, SLANG_MACHINE_BATCH_SIZE, rounds);
+   printf("uniform:   single %8.2f us, batch %8.2f us per invocation\n",
+          tSingle * 1e6, tBatch * 1e6);
+
+   tSingle = time_runs(divergent, 1, rounds);
+   tBatch = time_runs(divergent, SLANG_MACHINE_BATCH_SIZE, rounds);
+   printf("divergent: single %8.2f us, batch %8.2f us per invocation\n",
+          tSingle * 1e6, tBatch * 1e6);
+
+   slang_assembly_file_destruct(&File);
+   free(Machine);
+   return 0;
+}
@@ -0,0 +1,185 @@
+/*
+ * Check that the span interpolation in swrast stores the same colors as
+ * drawing the pixels one at a time, for every span length.
+ *
+ * Usage:  spancheck [width]
+ *
+ * Row y of a width x width OSMesa image gets a rectangle y + 1 pixels
+ * wide, all of whose vertices have the same color, so its spans
+ * interpolate the color with zero steps.  Then every pixel of the
+ * rectangles is drawn once more as a point, which doesn't interpolate,
+ * and the two images must match.  The rows are drawn with distinct red,
+ * green, blue and alpha values, and then once more lit, textured and with
+ * a separate specular color, so the specular color is interpolated too.
+ * The program stops at the first pixel that differs and exits with
+ * status 1.
+ *
+ * This catches compilers which vectorize the interpolation loops in
+ * swrast/s_span.c wrongly.  gcc 12 at -O3 did so with the loop which
+ * accumulated all four color channels, storing the red and green values
+ * in blue and alpha for the last pixels of a span.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GL/osmesa.h"
+#include "GL/gl.h"
+
+
+static int Width = 512;
+
+
+/*
+ * Draw row y with y + 1 pixels, for every row of the image, either as
+ * rectangles or as points.
+ */
+static void
+draw_rows( GLboolean points, GLboolean lit )
+{
+   static const GLubyte white[4] = { 255, 255, 255, 255 };
+   static const GLfloat specular[4] = { 0.2, 0.3, 0.4, 1.0 };
+   static const GLfloat dir[4] = { 0.0, 0.0, 1.0, 0.0 };
+   int x, y;
+
+   glClearColor(0.0, 0.0, 0.0, 0.0);
+   glClear(GL_COLOR_BUFFER_BIT);
+
+   if (lit) {
+      glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA,
+                   GL_UNSIGNED_BYTE, white);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glEnable(GL_TEXTURE_2D);
+      glLightfv(GL_LIGHT0, GL_POSITION, dir);
+      glLightfv(GL_LIGHT0, GL_SPECULAR, specular);
+      glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, specular);
+      glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, 0.0);
+      glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
+      glLightModeli(GL_LIGHT_MODEL_COLOR_CONTROL, GL_SEPARATE_SPECULAR_COLOR);
+      glEnable(GL_COLOR_MATERIAL);
+      glEnable(GL_LIGHT0);
+      glEnable(GL_LIGHTING);
+      glNormal3f(0.0, 0.0, 1.0);
+      glTexCoord2f(0.5, 0.5);
+      glColor4ub(40, 20, 10, 200);
+   }
+   else {
+      glColor4ub(10, 20, 30, 40);
+   }
+
+   if (points) {
+      glBegin(GL_POINTS);
+      for (y = 0; y < Width; y++) {
+         for (x = 0; x <= y; x++)
+            glVertex2f(x + 0.5, y + 0.5);
+      }
+      glEnd();
+   }
+   else {
+      for (y = 0; y < Width; y++)
+         glRecti(0, y, y + 1, y + 1);
+   }
+
+   glDisable(GL_LIGHTING);
+   glDisable(GL_COLOR_MATERIAL);
+   glDisable(GL_TEXTURE_2D);
+   glFinish();
+}
+
+
+static int
+check( GLubyte *buffer, GLubyte *spans, GLboolean lit )
+{
+   const char *what = lit ? "lit" : "unlit";
+   int x, y;
+
+   draw_rows(GL_FALSE, lit);
+   memcpy(spans, buffer, Width * Width * 4);
+   draw_rows(GL_TRUE, lit);
+
+   for (y = 0; y < Width; y++) {
+      for (x = 0; x <= y; x++) {
+         const GLubyte *s = spans + (y * Width + x) * 4;
+         const GLubyte *p = buffer + (y * Width + x) * 4;
+         if (memcmp(s, p, 4) != 0) {
+            printf("%s span of %d pixels: pixel %d is %d,%d,%d,%d, "
+                   "%d,%d,%d,%d as a point\n", what, y + 1, x,
+                   s[0], s[1], s[2], s[3], p[0], p[1], p[2], p[3]);
+            return 0;
+         }
+      }
+   }
+   return 1;
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+   OSMesaContext ctx;
+   GLubyte *buffer, *spans;
+
+   if (argc > 1)
+      Width = atoi(argv[1]);
+   if (Width < 1) {
+      fprintf(stderr, "usage: spancheck [width]\n");
+      return 1;
+   }
+
+   buffer = (GLubyte *) malloc(Width * Width * 4);
+   spans = (GLubyte *) malloc(Width * Width * 4);
+   if (!buffer || !spans) {
+      fprintf(stderr, "spancheck: out of memory\n");
+      return 1;
+   }
+
+   ctx = OSMesaCreateContext(OSMESA_RGBA, NULL);
+   if (!ctx || !OSMesaMakeCurrent(ctx, buffer, GL_UNSIGNED_BYTE,
+                                  Width, Width)) {
+      fprintf(stderr, "spancheck: can't create an OSMesa context\n");
+      return 1;
+   }
+
+   glViewport(0, 0, Width, Width);
+   glMatrixMode(GL_PROJECTION);
+   glLoadIdentity();
+   glOrtho(0, Width, 0, Width, -1, 1);
+   glMatrixMode(GL_MODELVIEW);
+   glLoadIdentity();
+
+   if (!check(buffer, spans, GL_FALSE) || !check(buffer, spans, GL_TRUE))
+      return 1;
+
+   printf("spans of 1 to %d pixels match single pixels\n", Width);
+
+   OSMesaDestroyContext(ctx);
+   free(buffer);
+   free(spans);
+   return 0;
+}
@@ -0,0 +1,250 @@
+/*
+ * Measure the frame rate of a double-buffered window with the back buffer
+ * presented on the rendering thread and on a helper thread
+ * (MESA_SWAP_THREAD).
+ *
+ * Usage:  swapbench [width] [height] [frames] [passes]
+ *
+ * Each frame clears the window and blends passes pairs of triangles over
+ * it, then swaps.  The same frames are drawn once without and once with
+ * the presentation thread, each time into a new window, and the final
+ * window contents of the two runs are compared.  Right after two more
+ * swaps the window is destroyed, while the thread may still be
+ * presenting to it.
+ *
+ * It needs the Xlib driver's libGL and an X server with MIT-SHM, e.g. a
+ * local Xvfb:
+ *
+ *    Xvfb :1 &
+ *    DISPLAY=:1 ./swapbench
+ *
+ * Without MIT-SHM both runs present on the rendering thread.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <GL/gl.h>
+#include <GL/glx.h>
+
+
+#define WARMUP_FRAMES 2
+
+static int Width = 640, Height = 480, Frames = 100, Passes = 8;
+
+
+static double
+now( void )
+{
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+
+static Bool
+is_map_notify( Display *dpy, XEvent *ev, XPointer arg )
+{
+   (void) dpy;
+   return ev->type == MapNotify && ev->xmap.window == *(Window *) arg;
+}
+
+
+static void
+draw( int f )
+{
+   int i;
+
+   glClearColor(0.1, 0.1, 0.2, 1.0);
+   glClear(GL_COLOR_BUFFER_BIT);
+   glEnable(GL_BLEND);
+   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+   glBegin(GL_TRIANGLES);
+   for (i = 0; i < Passes; i++) {
+      glColor4f(1.0, 0.0, 0.0, 0.3);
+      glVertex2f(0, 0);
+      glColor4f(0.0, 1.0, 0.0, 0.3);
+      glVertex2f(Width, (f * 7 + i * 13) % Height);
+      glColor4f(0.0, 0.0, 1.0, 0.3);
+      glVertex2f(Width / 2, Height);
+
+      glColor4f(1.0, 1.0, 0.0, 0.3);
+      glVertex2f(Width, Height);
+      glColor4f(0.0, 1.0, 1.0, 0.3);
+      glVertex2f(0, (f * 5 + i * 3) % Height);
+      glColor4f(1.0, 0.0, 1.0, 0.3);
+      glVertex2f(Width / 3, 0);
+   }
+   glEnd();
+}
+
+
+/*
+ * Draw Frames frames into a new window, presenting them on a helper
+ * thread if thread is set.  Return the time per frame and the final
+ * window contents.  The Xlib driver reads MESA_SWAP_THREAD when the
+ * window's buffer is created, on the first glXMakeCurrent.
+ */
+static double
+run( Display *dpy, XVisualInfo *vis, int thread, XImage **image )
+{
+   XSetWindowAttributes attr;
+   GLXContext ctx;
+   Window win;
+   XEvent ev;
+   double t = 0.0;
+   int f;
+
+   attr.colormap = XCreateColormap(dpy, RootWindow(dpy, vis->screen),
+                                   vis->visual, AllocNone);
+   attr.border_pixel = 0;
+   attr.event_mask = StructureNotifyMask;
+   win = XCreateWindow(dpy, RootWindow(dpy, vis->screen), 0, 0,
+                       Width, Height, 0, vis->depth, InputOutput,
+                       vis->visual, CWColormap | CWBorderPixel | CWEventMask,
+                       &attr);
+   XMapWindow(dpy, win);
+   XIfEvent(dpy, &ev, is_map_notify, (XPointer) &win);
+
+   if (thread)
+      setenv("MESA_SWAP_THREAD", "1", 1);
+   else
+      unsetenv("MESA_SWAP_THREAD");
+
+   ctx = glXCreateContext(dpy, vis, NULL, True);
+   if (!ctx || !glXMakeCurrent(dpy, win, ctx)) {
+      fprintf(stderr, "swapbench: can't create a GLX context\n");
+      exit(1);
+   }
+
+   glViewport(0, 0, Width, Height);
+   glMatrixMode(GL_PROJECTION);
+   glLoadIdentity();
+   glOrtho(0, Width, 0, Height, -1, 1);
+
+   for (f = 0; f < WARMUP_FRAMES + Frames; f++) {
+      if (f == WARMUP_FRAMES)
+         t = now();
+      draw(f);
+      glXSwapBuffers(dpy, win);
+   }
+   glXWaitGL();
+   t = now() - t;
+
+   *image = XGetImage(dpy, win, 0, 0, Width, Height, ~0UL, ZPixmap);
+   if (!*image) {
+      fprintf(stderr, "swapbench: XGetImage failed\n");
+      exit(1);
+   }
+
+   /* the thread may still be presenting these frames */
+   for (; f < WARMUP_FRAMES + Frames + 2; f++) {
+      draw(f);
+      glXSwapBuffers(dpy, win);
+   }
+   XDestroyWindow(dpy, win);
+   XSync(dpy, False);
+
+   glXMakeCurrent(dpy, None, NULL);
+   glXDestroyContext(dpy, ctx);
+   XFreeColormap(dpy, attr.colormap);
+
+   return t / Frames;
+}
+
+
+static int
+same_image( XImage *a, XImage *b )
+{
+   int x, y;
+
+   for (y = 0; y < Height; y++) {
+      for (x = 0; x < Width; x++) {
+         if (XGetPixel(a, x, y) != XGetPixel(b, x, y))
+            return 0;
+      }
+   }
+   return 1;
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+   static int attribs[] = {
+      GLX_RGBA, GLX_DOUBLEBUFFER, GLX_RED_SIZE, 1, GLX_GREEN_SIZE, 1,
+      GLX_BLUE_SIZE, 1, None
+   };
+   Display *dpy;
+   XVisualInfo *vis;
+   XImage *single, *threaded;
+   double tSingle, tThreaded;
+   int same;
+
+   if (argc > 1)
+      Width = atoi(argv[1]);
+   if (argc > 2)
+      Height = atoi(argv[2]);
+   if (argc > 3)
+      Frames = atoi(argv[3]);
+   if (argc > 4)
+      Passes = atoi(argv[4]);
+   if (Width < 1 || Height < 1 || Frames < 1 || Passes < 0) {
+      fprintf(stderr, "usage: swapbench [width] [height] [frames] "
+              "[passes]\n");
+      return 1;
+   }
+
+   dpy = XOpenDisplay(NULL);
+   if (!dpy) {
+      fprintf(stderr, "swapbench: can't open display\n");
+      return 1;
+   }
+   vis = glXChooseVisual(dpy, DefaultScreen(dpy), attribs);
+   if (!vis) {
+      fprintf(stderr, "swapbench: no double-buffered RGB visual\n");
+      return 1;
+   }
+
+   tSingle = run(dpy, vis, 0, &single);
+   tThreaded = run(dpy, vis, 1, &threaded);
+   same = same_image(single, threaded);
+
+   printf("%dx%d, %d frames, %d passes\n", Width, Height, Frames, Passes);
+   printf("rendering thread:    %8.2f ms/frame\n", tSingle * 1e3);
+   printf("presentation thread: %8.2f ms/frame\n", tThreaded * 1e3);
+   if (!same)
+      printf("the final window contents differ\n");
+
+   XDestroyImage(single);
+   XDestroyImage(threaded);
+   XCloseDisplay(dpy);
+   return same ? 0 : 1;
+}
@@ -0,0 +1,800 @@
+/*
+ * Replay a GL call trace recorded with MESA_TRACE, with OSMesa, and report
+ * how long each frame and each kind of GL call takes.
+ *
+ * Usage:  glreplay [options] trace-file
+ *   -n N       replay the trace N times
+ *   -c         don't time each call, only the frames
+ *   -v         print the time of every frame
+ *   -o file    write the final image to a PPM file
+ *
+ * Frames end where the traced program swapped buffers, or, if it never
+ * did (an OSMesa program), at each glFinish.  Every context of the trace
+ * gets an OSMesa context of the same size and visual; contexts don't share
+ * objects.  The trace must have been recorded on the same kind of machine,
+ * since it's in native byte order.
+ */
+
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#define GL_GLEXT_PROTOTYPES
+#include "GL/osmesa.h"
+#include "GL/glext.h"
+#include "glreplay_tmp.h"
+
+
+struct replay_reader {
+   const GLubyte *pos;          /**< next parameter of the record */
+   GLuint size;                 /**< bytes of the last replay_array() */
+   OSMESAproc *procs;           /**< GL functions, by enum trace_call_id */
+};
+
+
+static void
+replay_read( struct replay_reader *r, void *dst, GLuint bytes )
+{
+   memcpy(dst, r->pos, bytes);
+   r->pos += bytes;
+}
+
+
+static void
+replay_align( struct replay_reader *r )
+{
+   r->pos = (const GLubyte *) (((size_t) r->pos + 7) & ~(size_t) 7);
+}
+
+
+static void *
+replay_pointer( struct replay_reader *r )
+{
+   trace_uint64 value;
+   replay_align(r);
+   replay_read(r, &value, sizeof(value));
+   return (void *) (size_t) value;
+}
+
+
+/**
+ * Client memory read by the call.  Points into the trace.
+ */
+static void *
+replay_array( struct replay_reader *r )
+{
+   GLuint bytes;
+   void *p;
+
+   replay_read(r, &bytes, sizeof(bytes));
+   if (bytes == TRACE_RAW) {
+      r->size = 0;
+      return replay_pointer(r);
+   }
+   replay_align(r);
+   p = (void *) r->pos;
+   r->pos += bytes;
+   r->size = bytes;
+   return p;
+}
+
+
+static GLubyte *Scratch = NULL;
+static GLuint ScratchSize = 0;
+
+static void **Kept = NULL;
+static GLuint NumKept = 0;
+
+
+/**
+ * Client memory written by the call.  The contents are thrown away.
+ */
+static void *
+replay_output( struct replay_reader *r )
+{
+   GLuint bytes;
+
+   replay_read(r, &bytes, sizeof(bytes));
+   if (bytes == TRACE_RAW)
+      return replay_pointer(r);
+   if (bytes > ScratchSize) {
+      free(Scratch);
+      Scratch = (GLubyte *) malloc(bytes);
+      ScratchSize = Scratch ? bytes : 0;
+   }
+   return Scratch;
+}
+
+
+/**
+ * Memory written after the call, by glRenderMode: glFeedbackBuffer,
+ * glSelectBuffer.
+ */
+static void *
+replay_output_keep( struct replay_reader *r )
+{
+   GLuint bytes;
+   void *p;
+
+   replay_read(r, &bytes, sizeof(bytes));
+   if (bytes == TRACE_RAW)
+      return replay_pointer(r);
+   p = calloc(1, bytes + 1);
+   Kept = (void **) realloc(Kept, (NumKept + 1) * sizeof(void *));
+   Kept[NumKept++] = p;
+   return p;
+}
+
+
+static void
+replay_UnmapBufferARB( struct replay_reader *r )
+{
+   GLenum target;
+   const void *data;
+
+   replay_read(r, &target, sizeof(target));
+   data = replay_array(r);
+   if (data && r->size > 0) {
+      GLvoid *p = NULL;
+      glGetBufferPointervARB(target, GL_BUFFER_MAP_POINTER_ARB, &p);
+      if (p)
+         memcpy(p, data, r->size);
+   }
+   glUnmapBufferARB(target);
+}
+
+
+static void
+replay_ShaderSourceARB( struct replay_reader *r )
+{
+   GLhandleARB shaderObj;
+   GLsizei count;
+   GLuint numStrings, i;
+   const GLcharARB **string = NULL;
+   GLint *length = NULL;
+
+   replay_read(r, &shaderObj, sizeof(shaderObj));
+   replay_read(r, &count, sizeof(count));
+   replay_read(r, &numStrings, sizeof(numStrings));
+   if (numStrings > 0) {
+      string = (const GLcharARB **) malloc(numStrings * sizeof(*string));
+      length = (GLint *) malloc(numStrings * sizeof(*length));
+      for (i = 0; i < numStrings; i++) {
+         string[i] = (const GLcharARB *) replay_array(r);
+         length[i] = r->size;
+      }
+   }
+   (*(void (GLAPIENTRYP)(GLhandleARB, GLsizei, const GLcharARB **,
+                         const GLint *))
+    r->procs[TRACE_CALL_ShaderSourceARB])(shaderObj, count, string, length);
+   free(string);
+   free(length);
+}
+
+
+#define REPLAY_FUNCTIONS
+#include "glreplay_tmp.h"
+
+
+#define MAX_CONTEXTS 64
+
+struct replay_context {
+   OSMesaContext ctx;
+   GLubyte *buffer;
+   GLint width, height;
+   GLubyte *arrays[TRACE_ARRAY_SLOTS];  /**< client array storage */
+};
+
+static struct replay_context Contexts[MAX_CONTEXTS];
+static struct replay_context *Current = NULL;
+
+/** What the last current context drew, if it was destroyed */
+static GLubyte *Image = NULL;
+static GLint ImageWidth = 0, ImageHeight = 0;
+
+
+/** The trace, as read from the file */
+static GLubyte *Trace;
+static const GLubyte *TraceStart, *TraceEnd;   /**< the records */
+
+/** Local call id of each call id in the trace, or -1 */
+static GLint *CallMap;
+static GLuint NumTraceCalls;
+
+/** Size of the client array storage of each slot */
+static GLuint ArraySize[TRACE_ARRAY_SLOTS];
+
+static OSMESAproc Procs[NUM_TRACE_CALL];
+
+static GLboolean TimeCalls = GL_TRUE;
+static GLboolean Verbose = GL_FALSE;
+
+static double CallTime[NUM_TRACE_CALL];
+static unsigned long CallCount[NUM_TRACE_CALL];
+static unsigned long Skipped[NUM_TRACE_CALL];
+static double TimerOverhead = 0.0;
+
+static double *FrameTime = NULL;
+static GLuint NumFrames = 0, MaxFrames = 0;
+
+
+static double
+now( void )
+{
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+
+/**
+ * Measure the cost of the two now() calls around each GL call.
+ */
+static void
+calibrate_timer( void )
+{
+   double best = 1.0;
+   int i, j;
+
+   for (i = 0; i < 10; i++) {
+      const double t0 = now();
+      double t1 = t0;
+      for (j = 0; j < 1000; j++)
+         t1 = now();
+      if ((t1 - t0) / 1000 < best)
+         best = (t1 - t0) / 1000;
+   }
+   TimerOverhead = best;
+}
+
+
+static void
+fail( const char *what, const char *file )
+{
+   fprintf(stderr, "glreplay: %s: %s\n", file, what);
+   exit(1);
+}
+
+
+static void
+load_trace( const char *file )
+{
+   FILE *f = fopen(file, "rb");
+   const GLubyte *p;
+   long size;
+   GLuint byteOrder, i;
+
+   if (!f)
+      fail("can't open", file);
+   fseek(f, 0, SEEK_END);
+   size = ftell(f);
+   fseek(f, 0, SEEK_SET);
+
+   /* malloc'ed memory is aligned enough for doubles */
+   Trace = (GLubyte *) malloc(size + 8);
+   if (!Trace || fread(Trace, 1, size, f) != (size_t) size)
+      fail("can't read", file);
+   fclose(f);
+   TraceEnd = Trace + size;
+
+   if (size < 16 || memcmp(Trace, TRACE_MAGIC, 8) != 0)
+      fail("not a trace file", file);
+   memcpy(&byteOrder, Trace + 8, sizeof(byteOrder));
+   if (byteOrder != TRACE_BYTE_ORDER)
+      fail("recorded on a machine of another byte order", file);
+   memcpy(&NumTraceCalls, Trace + 12, sizeof(NumTraceCalls));
+
+   /* look up the functions by name */
+   CallMap = (GLint *) malloc(NumTraceCalls * sizeof(GLint));
+   p = Trace + 16;
+   for (i = 0; i < NumTraceCalls; i++) {
+      GLushort len;
+      GLint k;
+      if (p + sizeof(len) > TraceEnd)
+         fail("truncated header", file);
+      memcpy(&len, p, sizeof(len));
+      p += sizeof(len);
+      CallMap[i] = -1;
+      for (k = 0; k < NUM_TRACE_CALL; k++) {
+         if (strlen(trace_call_names[k]) == len &&
+             memcmp(trace_call_names[k], p, len) == 0) {
+            CallMap[i] = k;
+            break;
+         }
+      }
+      p += len;
+   }
+   TraceStart = Trace + (((p - Trace) + 7) & ~7);
+
+   for (i = 0; i < NUM_TRACE_CALL; i++) {
+      char name[100];
+      sprintf(name, "gl%s", trace_call_names[i]);
+      Procs[i] = OSMesaGetProcAddress(name);
+   }
+}
+
+
+/**
+ * Check the records, and find out how much storage each array slot needs
+ * and how frames are delimited.
+ */
+static GLboolean
+scan_trace( const char *file, unsigned long *numCalls )
+{
+   const GLubyte *p = TraceStart;
+   GLboolean swaps = GL_FALSE;
+
+   *numCalls = 0;
+   while (p < TraceEnd) {
+      struct trace_record rec;
+      if (p + sizeof(rec) > TraceEnd)
+         fail("truncated record", file);
+      memcpy(&rec, p, sizeof(rec));
+      if (p + sizeof(rec) + rec.size > TraceEnd)
+         fail("truncated record", file);
+
+      if (rec.id == TRACE_SWAP) {
+         swaps = GL_TRUE;
+      }
+      else if (rec.id == TRACE_ARRAY_DATA) {
+         GLuint slot, offset, bytes;
+         memcpy(&slot, p + sizeof(rec), sizeof(slot));
+         memcpy(&offset, p + sizeof(rec) + 4, sizeof(offset));
+         memcpy(&bytes, p + sizeof(rec) + 8, sizeof(bytes));
+         if (slot >= TRACE_ARRAY_SLOTS)
+            fail("bad array record", file);
+         if (bytes != TRACE_RAW && offset + bytes > ArraySize[slot])
+            ArraySize[slot] = offset + bytes;
+      }
+      else if (rec.id < NumTraceCalls) {
+         (*numCalls)++;
+      }
+      p += sizeof(rec) + rec.size;
+   }
+   return swaps;
+}
+
+
+static GLubyte *
+array_storage( struct replay_context *c, GLuint slot )
+{
+   if (!c->arrays[slot])
+      c->arrays[slot] = (GLubyte *) calloc(1, ArraySize[slot] + 16);
+   return c->arrays[slot];
+}
+
+
+static void
+client_state( GLenum cap, GLuint enabled )
+{
+   if (enabled)
+      glEnableClientState(cap);
+   else
+      glDisableClientState(cap);
+}
+
+
+static void
+set_array( struct replay_context *c, const struct trace_array_pointer *a )
+{
+   const GLvoid *ptr;
+   GLuint unit;
+
+   if (a->slot >= TRACE_ARRAY_SLOTS)
+      return;
+   if (a->buffer)
+      ptr = (const GLvoid *) (size_t) a->pointer;
+   else
+      ptr = array_storage(c, a->slot);
+
+   switch (a->slot) {
+   case TRACE_ARRAY_VERTEX:
+      glVertexPointer(a->size, a->type, a->stride, ptr);
+      client_state(GL_VERTEX_ARRAY, a->enabled);
+      break;
+   case TRACE_ARRAY_NORMAL:
+      glNormalPointer(a->type, a->stride, ptr);
+      client_state(GL_NORMAL_ARRAY, a->enabled);
+      break;
+   case TRACE_ARRAY_COLOR:
+      glColorPointer(a->size, a->type, a->stride, ptr);
+      client_state(GL_COLOR_ARRAY, a->enabled);
+      break;
+   case TRACE_ARRAY_SECONDARY_COLOR:
+      glSecondaryColorPointerEXT(a->size, a->type, a->stride, ptr);
+      client_state(GL_SECONDARY_COLOR_ARRAY_EXT, a->enabled);
+      break;
+   case TRACE_ARRAY_FOG_COORD:
+      glFogCoordPointerEXT(a->type, a->stride, ptr);
+      client_state(GL_FOG_COORDINATE_ARRAY_EXT, a->enabled);
+      break;
+   case TRACE_ARRAY_INDEX:
+      glIndexPointer(a->type, a->stride, ptr);
+      client_state(GL_INDEX_ARRAY, a->enabled);
+      break;
+   case TRACE_ARRAY_EDGE_FLAG:
+      glEdgeFlagPointer(a->stride, ptr);
+      client_state(GL_EDGE_FLAG_ARRAY, a->enabled);
+      break;
+   default:
+      if (a->slot >= TRACE_ARRAY_ATTRIB) {
+         const GLuint index = a->slot - TRACE_ARRAY_ATTRIB;
+         glVertexAttribPointerARB(index, a->size, a->type,
+                                  (GLboolean) a->normalized, a->stride, ptr);
+         if (a->enabled)
+            glEnableVertexAttribArrayARB(index);
+         else
+            glDisableVertexAttribArrayARB(index);
+      }
+      else if (a->slot >= TRACE_ARRAY_TEX_COORD) {
+         unit = a->slot - TRACE_ARRAY_TEX_COORD;
+         glClientActiveTextureARB(GL_TEXTURE0_ARB + unit);
+         glTexCoordPointer(a->size, a->type, a->stride, ptr);
+         client_state(GL_TEXTURE_COORD_ARRAY, a->enabled);
+         glClientActiveTextureARB(GL_TEXTURE0_ARB + a->client_unit);
+      }
+      break;
+   }
+}
+
+
+static void
+set_context( const GLubyte *p )
+{
+   GLuint id, rgb, width, height;
+   GLint depth, stencil, accum;
+   struct replay_context *c;
+
+   memcpy(&id, p, 4);
+   memcpy(&rgb, p + 4, 4);
+   memcpy(&depth, p + 8, 4);
+   memcpy(&stencil, p + 12, 4);
+   memcpy(&accum, p + 16, 4);
+   memcpy(&width, p + 20, 4);
+   memcpy(&height, p + 24, 4);
+   if (id == 0 || id > MAX_CONTEXTS)
+      return;
+   c = &Contexts[id - 1];
+   if (width < 1)
+      width = 1;
+   if (height < 1)
+      height = 1;
+
+   if (!c->ctx) {
+      c->ctx = OSMesaCreateContextExt(rgb ? OSMESA_RGBA : OSMESA_COLOR_INDEX,
+                                      depth, stencil, accum, NULL);
+      if (!c->ctx) {
+         fprintf(stderr, "glreplay: can't create a context\n");
+         exit(1);
+      }
+   }
+   if (!c->buffer || c->width != (GLint) width ||
+       c->height != (GLint) height) {
+      free(c->buffer);
+      c->buffer = (GLubyte *) calloc(width * height, 4);
+      c->width = width;
+      c->height = height;
+   }
+   OSMesaMakeCurrent(c->ctx, c->buffer, GL_UNSIGNED_BYTE, width, height);
+   Current = c;
+}
+
+
+static void
+destroy_context( struct replay_context *c )
+{
+   GLuint i;
+
+   if (c->ctx)
+      OSMesaDestroyContext(c->ctx);
+   if (c == Current) {
+      free(Image);
+      Image = c->buffer;
+      ImageWidth = c->width;
+      ImageHeight = c->height;
+   }
+   else {
+      free(c->buffer);
+   }
+   for (i = 0; i < TRACE_ARRAY_SLOTS; i++)
+      free(c->arrays[i]);
+   memset(c, 0, sizeof(*c));
+   if (Current == c)
+      Current = NULL;
+}
+
+
+static void
+end_frame( double *frameStart )
+{
+   double t;
+
+   glFinish();
+   t = now();
+   if (NumFrames == MaxFrames) {
+      MaxFrames = MaxFrames ? 2 * MaxFrames : 256;
+      FrameTime = (double *) realloc(FrameTime, MaxFrames * sizeof(double));
+   }
+   FrameTime[NumFrames++] = t - *frameStart;
+   if (Verbose)
+      printf("frame %5u  %9.3f ms\n", NumFrames - 1,
+             (t - *frameStart) * 1e3);
+   *frameStart = now();
+}
+
+
+/**
+ * Replay all the records once.
+ */
+static void
+replay( GLboolean swaps )
+{
+   const GLubyte *p = TraceStart;
+   double frameStart = now();
+   GLuint framesBefore = NumFrames;
+   struct replay_reader r;
+   GLuint i;
+
+   r.procs = Procs;
+
+   while (p < TraceEnd) {
+      struct trace_record rec;
+      const GLubyte *params = p + sizeof(rec);
+
+      memcpy(&rec, p, sizeof(rec));
+      p = params + rec.size;
+
+      if (rec.id < NumTraceCalls) {
+         const GLint k = CallMap[rec.id];
+         if (k < 0 || !replay_dispatch[k] || !Procs[k] || !Current) {
+            Skipped[k < 0 ? 0 : k]++;
+            continue;
+         }
+         r.pos = params;
+         if (TimeCalls) {
+            const double t0 = now();
+            replay_dispatch[k](&r);
+            CallTime[k] += now() - t0 - TimerOverhead;
+         }
+         else {
+            replay_dispatch[k](&r);
+         }
+         CallCount[k]++;
+         if (k == TRACE_CALL_Finish && !swaps)
+            end_frame(&frameStart);
+         continue;
+      }
+
+      switch (rec.id) {
+      case TRACE_CONTEXT:
+         set_context(params);
+         break;
+      case TRACE_DESTROY:
+         memcpy(&i, params, sizeof(i));
+         if (i > 0 && i <= MAX_CONTEXTS)
+            destroy_context(&Contexts[i - 1]);
+         break;
+      case TRACE_SWAP:
+         end_frame(&frameStart);
+         break;
+      case TRACE_ARRAY_POINTER:
+         if (Current) {
+            struct trace_array_pointer a;
+            memcpy(&a, params, sizeof(a));
+            set_array(Current, &a);
+         }
+         break;
+      case TRACE_ARRAY_DATA:
+         if (Current) {
+            GLuint slot, offset;
+            const void *data;
+            memcpy(&slot, params, 4);
+            memcpy(&offset, params + 4, 4);
+            r.pos = params + 8;
+            data = replay_array(&r);
+            if (r.size > 0)
+               memcpy(array_storage(Current, slot) + offset, data, r.size);
+         }
+         break;
+      default:
+         break;
+      }
+   }
+
+   /* a trace without frame boundaries is one frame */
+   if (NumFrames == framesBefore && Current)
+      end_frame(&frameStart);
+}
+
+
+static int
+compare_doubles( const void *a, const void *b )
+{
+   const double x = *(const double *) a, y = *(const double *) b;
+   return (x > y) - (x < y);
+}
+
+
+static int
+compare_calls( const void *a, const void *b )
+{
+   const double x = CallTime[*(const GLint *) a];
+   const double y = CallTime[*(const GLint *) b];
+   return (x < y) - (x > y);
+}
+
+
+static void
+print_report( int loops, unsigned long numCalls )
+{
+   GLint order[NUM_TRACE_CALL];
+   double total = 0.0, callTotal = 0.0;
+   unsigned long skipped = 0;
+   double *sorted;
+   GLuint i, n = 0;
+
+   for (i = 0; i < NumFrames; i++)
+      total += FrameTime[i];
+   sorted = (double *) malloc(NumFrames * sizeof(double));
+   memcpy(sorted, FrameTime, NumFrames * sizeof(double));
+   qsort(sorted, NumFrames, sizeof(double), compare_doubles);
+   printf("%u frames in %d replays of %lu calls\n", NumFrames, loops,
+          numCalls);
+   if (NumFrames > 0) {
+      printf("frame time: mean %.3f ms, median %.3f ms, "
+             "min %.3f ms, max %.3f ms\n",
+             total * 1e3 / NumFrames, sorted[NumFrames / 2] * 1e3,
+             sorted[0] * 1e3, sorted[NumFrames - 1] * 1e3);
+   }
+   free(sorted);
+
+   for (i = 0; i < NUM_TRACE_CALL; i++) {
+      skipped += Skipped[i];
+      if (CallCount[i] > 0) {
+         order[n++] = i;
+         callTotal += CallTime[i];
+      }
+   }
+
+   if (TimeCalls && n > 0) {
+      qsort(order, n, sizeof(GLint), compare_calls);
+      printf("\n%-32s %10s %12s %10s %7s\n",
+             "call", "count", "total ms", "mean us", "%");
+      for (i = 0; i < n; i++) {
+         const GLint k = order[i];
+         printf("gl%-30s %10lu %12.3f %10.3f %6.1f%%\n",
+                trace_call_names[k], CallCount[k], CallTime[k] * 1e3,
+                CallTime[k] * 1e6 / CallCount[k],
+                callTotal > 0.0 ? 100.0 * CallTime[k] / callTotal : 0.0);
+      }
+      printf("(timer overhead of %.1f ns per call subtracted)\n",
+             TimerOverhead * 1e9);
+   }
+
+   if (skipped > 0)
+      printf("%lu calls skipped: unknown to this replayer\n", skipped);
+}
+
+
+static void
+print_image( const char *ppm )
+{
+   const GLubyte *image = Current ? Current->buffer : Image;
+   const GLint width = Current ? Current->width : ImageWidth;
+   const GLint height = Current ? Current->height : ImageHeight;
+   GLuint hash = 2166136261u;
+   GLint i;
+
+   if (!image)
+      return;
+   for (i = 0; i < width * height * 4; i++) {
+      hash ^= image[i];
+      hash *= 16777619u;
+   }
+   printf("image %dx%d hash %08x\n", width, height, hash);
+
+   if (ppm) {
+      FILE *f = fopen(ppm, "wb");
+      GLint x, y;
+      if (!f) {
+         fprintf(stderr, "glreplay: can't write %s\n", ppm);
+         return;
+      }
+      fprintf(f, "P6\n%d %d\n255\n", width, height);
+      for (y = height - 1; y >= 0; y--) {
+         for (x = 0; x < width; x++)
+            fwrite(image + (y * width + x) * 4, 1, 3, f);
+      }
+      fclose(f);
+   }
+}
+
+
+static void
+usage( void )
+{
+   fprintf(stderr, "usage: glreplay [-n loops] [-c] [-v] [-o image.ppm] "
+           "trace-file\n");
+   exit(1);
+}
+
+
+int
+main( int argc, char *argv[] )
+{
+   const char *file = NULL, *ppm = NULL;
+   unsigned long numCalls;
+   GLboolean swaps;
+   int loops = 1, i, j;
+
+   for (i = 1; i < argc; i++) {
+      if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+         loops = atoi(argv[++i]);
+      else if (strcmp(argv[i], "-c") == 0)
+         TimeCalls = GL_FALSE;
+      else if (strcmp(argv[i], "-v") == 0)
+         Verbose = GL_TRUE;
+      else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+         ppm = argv[++i];
+      else if (argv[i][0] == '-' || file)
+         usage();
+      else
+         file = argv[i];
+   }
+   if (!file || loops < 1)
+      usage();
+
+   load_trace(file);
+   swaps = scan_trace(file, &numCalls);
+   if (TimeCalls)
+      calibrate_timer();
+
+   for (i = 0; i < loops; i++) {
+      replay(swaps);
+      print_image(i == loops - 1 ? ppm : NULL);
+      /* start the next loop with new objects */
+      if (i < loops - 1) {
+         for (j = 0; j < MAX_CONTEXTS; j++)
+            destroy_context(&Contexts[j]);
+      }
+   }
+
+   print_report(loops, numCalls);
+
+   for (j = 0; j < MAX_CONTEXTS; j++)
+      destroy_context(&Contexts[j]);
+   for (i = 0; i < (int) NumKept; i++)
+      free(Kept[i]);
+   free(Kept);
+   free(Scratch);
+   free(CallMap);
+   free(Trace);
+   free(FrameTime);
+   free(Image);
+   return 0;
+}
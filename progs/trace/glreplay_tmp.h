@@ -0,0 +1,9735 @@
+/* DO NOT EDIT - This file generated automatically by gl_trace.py script */
+
+/*
+ * This file is only included by glreplay.c.  It has a replay_X
+ * function for each call which api_trace.c records.
+ *
+ * It is included twice: first for the record layout and the call
+ * names, then with REPLAY_FUNCTIONS defined for the functions.
+ */
+
+#ifndef REPLAY_FUNCTIONS
+
+#define TRACE_MAGIC       "MESATRC1"
+#define TRACE_BYTE_ORDER  0x01020304
+#define TRACE_RAW         0xffffffffU  /**< byte count of a pointer value */
+
+#define TRACE_CONTEXT            0xfff0  /**< context id, rgb, depth, stencil, accum bits, width, height */
+#define TRACE_DESTROY            0xfff1  /**< context id */
+#define TRACE_SWAP               0xfff2  /**< end of frame */
+#define TRACE_ARRAY_POINTER      0xfff3  /**< struct trace_array_pointer */
+#define TRACE_ARRAY_DATA         0xfff4  /**< slot, offset, elements */
+
+#define TRACE_ARRAY_VERTEX           0
+#define TRACE_ARRAY_NORMAL           1
+#define TRACE_ARRAY_COLOR            2
+#define TRACE_ARRAY_SECONDARY_COLOR  3
+#define TRACE_ARRAY_FOG_COORD        4
+#define TRACE_ARRAY_INDEX            5
+#define TRACE_ARRAY_EDGE_FLAG        6
+#define TRACE_ARRAY_TEX_COORD        8
+#define TRACE_ARRAY_ATTRIB           16
+#define TRACE_ARRAY_SLOTS            32
+
+#if defined(_MSC_VER)
+typedef unsigned __int64 trace_uint64;
+#else
+typedef unsigned long long trace_uint64;
+#endif
+
+struct trace_record {
+   GLushort id;         /**< enum trace_call_id or TRACE_x */
+   GLushort pad;
+   GLuint size;         /**< bytes after this header */
+};
+
+struct trace_array_pointer {
+   GLuint slot;         /**< TRACE_ARRAY_x */
+   GLuint enabled;
+   GLint size;
+   GLenum type;
+   GLint stride;        /**< in bytes, never 0 */
+   GLuint normalized;
+   GLuint client_unit;  /**< glClientActiveTexture unit */
+   GLuint buffer;       /**< buffer object name, or 0 */
+   trace_uint64 pointer; /**< offset into the buffer object */
+};
+
+enum trace_call_id {
+   TRACE_CALL_NewList,
+   TRACE_CALL_EndList,
+   TRACE_CALL_CallList,
+   TRACE_CALL_CallLists,
+   TRACE_CALL_DeleteLists,
+   TRACE_CALL_GenLists,
+   TRACE_CALL_ListBase,
+   TRACE_CALL_Begin,
+   TRACE_CALL_Bitmap,
+   TRACE_CALL_Color3b,
+   TRACE_CALL_Color3bv,
+   TRACE_CALL_Color3d,
+   TRACE_CALL_Color3dv,
+   TRACE_CALL_Color3f,
+   TRACE_CALL_Color3fv,
+   TRACE_CALL_Color3i,
+   TRACE_CALL_Color3iv,
+   TRACE_CALL_Color3s,
+   TRACE_CALL_Color3sv,
+   TRACE_CALL_Color3ub,
+   TRACE_CALL_Color3ubv,
+   TRACE_CALL_Color3ui,
+   TRACE_CALL_Color3uiv,
+   TRACE_CALL_Color3us,
+   TRACE_CALL_Color3usv,
+   TRACE_CALL_Color4b,
+   TRACE_CALL_Color4bv,
+   TRACE_CALL_Color4d,
+   TRACE_CALL_Color4dv,
+   TRACE_CALL_Color4f,
+   TRACE_CALL_Color4fv,
+   TRACE_CALL_Color4i,
+   TRACE_CALL_Color4iv,
+   TRACE_CALL_Color4s,
+   TRACE_CALL_Color4sv,
+   TRACE_CALL_Color4ub,
+   TRACE_CALL_Color4ubv,
+   TRACE_CALL_Color4ui,
+   TRACE_CALL_Color4uiv,
+   TRACE_CALL_Color4us,
+   TRACE_CALL_Color4usv,
+   TRACE_CALL_EdgeFlag,
+   TRACE_CALL_EdgeFlagv,
+   TRACE_CALL_End,
+   TRACE_CALL_Indexd,
+   TRACE_CALL_Indexdv,
+   TRACE_CALL_Indexf,
+   TRACE_CALL_Indexfv,
+   TRACE_CALL_Indexi,
+   TRACE_CALL_Indexiv,
+   TRACE_CALL_Indexs,
+   TRACE_CALL_Indexsv,
+   TRACE_CALL_Normal3b,
+   TRACE_CALL_Normal3bv,
+   TRACE_CALL_Normal3d,
+   TRACE_CALL_Normal3dv,
+   TRACE_CALL_Normal3f,
+   TRACE_CALL_Normal3fv,
+   TRACE_CALL_Normal3i,
+   TRACE_CALL_Normal3iv,
+   TRACE_CALL_Normal3s,
+   TRACE_CALL_Normal3sv,
+   TRACE_CALL_RasterPos2d,
+   TRACE_CALL_RasterPos2dv,
+   TRACE_CALL_RasterPos2f,
+   TRACE_CALL_RasterPos2fv,
+   TRACE_CALL_RasterPos2i,
+   TRACE_CALL_RasterPos2iv,
+   TRACE_CALL_RasterPos2s,
+   TRACE_CALL_RasterPos2sv,
+   TRACE_CALL_RasterPos3d,
+   TRACE_CALL_RasterPos3dv,
+   TRACE_CALL_RasterPos3f,
+   TRACE_CALL_RasterPos3fv,
+   TRACE_CALL_RasterPos3i,
+   TRACE_CALL_RasterPos3iv,
+   TRACE_CALL_RasterPos3s,
+   TRACE_CALL_RasterPos3sv,
+   TRACE_CALL_RasterPos4d,
+   TRACE_CALL_RasterPos4dv,
+   TRACE_CALL_RasterPos4f,
+   TRACE_CALL_RasterPos4fv,
+   TRACE_CALL_RasterPos4i,
+   TRACE_CALL_RasterPos4iv,
+   TRACE_CALL_RasterPos4s,
+   TRACE_CALL_RasterPos4sv,
+   TRACE_CALL_Rectd,
+   TRACE_CALL_Rectdv,
+   TRACE_CALL_Rectf,
+   TRACE_CALL_Rectfv,
+   TRACE_CALL_Recti,
+   TRACE_CALL_Rectiv,
+   TRACE_CALL_Rects,
+   TRACE_CALL_Rectsv,
+   TRACE_CALL_TexCoord1d,
+   TRACE_CALL_TexCoord1dv,
+   TRACE_CALL_TexCoord1f,
+   TRACE_CALL_TexCoord1fv,
+   TRACE_CALL_TexCoord1i,
+   TRACE_CALL_TexCoord1iv,
+   TRACE_CALL_TexCoord1s,
+   TRACE_CALL_TexCoord1sv,
+   TRACE_CALL_TexCoord2d,
+   TRACE_CALL_TexCoord2dv,
+   TRACE_CALL_TexCoord2f,
+   TRACE_CALL_TexCoord2fv,
+   TRACE_CALL_TexCoord2i,
+   TRACE_CALL_TexCoord2iv,
+   TRACE_CALL_TexCoord2s,
+   TRACE_CALL_TexCoord2sv,
+   TRACE_CALL_TexCoord3d,
+   TRACE_CALL_TexCoord3dv,
+   TRACE_CALL_TexCoord3f,
+   TRACE_CALL_TexCoord3fv,
+   TRACE_CALL_TexCoord3i,
+   TRACE_CALL_TexCoord3iv,
+   TRACE_CALL_TexCoord3s,
+   TRACE_CALL_TexCoord3sv,
+   TRACE_CALL_TexCoord4d,
+   TRACE_CALL_TexCoord4dv,
+   TRACE_CALL_TexCoord4f,
+   TRACE_CALL_TexCoord4fv,
+   TRACE_CALL_TexCoord4i,
+   TRACE_CALL_TexCoord4iv,
+   TRACE_CALL_TexCoord4s,
+   TRACE_CALL_TexCoord4sv,
+   TRACE_CALL_Vertex2d,
+   TRACE_CALL_Vertex2dv,
+   TRACE_CALL_Vertex2f,
+   TRACE_CALL_Vertex2fv,
+   TRACE_CALL_Vertex2i,
+   TRACE_CALL_Vertex2iv,
+   TRACE_CALL_Vertex2s,
+   TRACE_CALL_Vertex2sv,
+   TRACE_CALL_Vertex3d,
+   TRACE_CALL_Vertex3dv,
+   TRACE_CALL_Vertex3f,
+   TRACE_CALL_Vertex3fv,
+   TRACE_CALL_Vertex3i,
+   TRACE_CALL_Vertex3iv,
+   TRACE_CALL_Vertex3s,
+   TRACE_CALL_Vertex3sv,
+   TRACE_CALL_Vertex4d,
+   TRACE_CALL_Vertex4dv,
+   TRACE_CALL_Vertex4f,
+   TRACE_CALL_Vertex4fv,
+   TRACE_CALL_Vertex4i,
+   TRACE_CALL_Vertex4iv,
+   TRACE_CALL_Vertex4s,
+   TRACE_CALL_Vertex4sv,
+   TRACE_CALL_ClipPlane,
+   TRACE_CALL_ColorMaterial,
+   TRACE_CALL_CullFace,
+   TRACE_CALL_Fogf,
+   TRACE_CALL_Fogfv,
+   TRACE_CALL_Fogi,
+   TRACE_CALL_Fogiv,
+   TRACE_CALL_FrontFace,
+   TRACE_CALL_Hint,
+   TRACE_CALL_Lightf,
+   TRACE_CALL_Lightfv,
+   TRACE_CALL_Lighti,
+   TRACE_CALL_Lightiv,
+   TRACE_CALL_LightModelf,
+   TRACE_CALL_LightModelfv,
+   TRACE_CALL_LightModeli,
+   TRACE_CALL_LightModeliv,
+   TRACE_CALL_LineStipple,
+   TRACE_CALL_LineWidth,
+   TRACE_CALL_Materialf,
+   TRACE_CALL_Materialfv,
+   TRACE_CALL_Materiali,
+   TRACE_CALL_Materialiv,
+   TRACE_CALL_PointSize,
+   TRACE_CALL_PolygonMode,
+   TRACE_CALL_PolygonStipple,
+   TRACE_CALL_Scissor,
+   TRACE_CALL_ShadeModel,
+   TRACE_CALL_TexParameterf,
+   TRACE_CALL_TexParameterfv,
+   TRACE_CALL_TexParameteri,
+   TRACE_CALL_TexParameteriv,
+   TRACE_CALL_TexImage1D,
+   TRACE_CALL_TexImage2D,
+   TRACE_CALL_TexEnvf,
+   TRACE_CALL_TexEnvfv,
+   TRACE_CALL_TexEnvi,
+   TRACE_CALL_TexEnviv,
+   TRACE_CALL_TexGend,
+   TRACE_CALL_TexGendv,
+   TRACE_CALL_TexGenf,
+   TRACE_CALL_TexGenfv,
+   TRACE_CALL_TexGeni,
+   TRACE_CALL_TexGeniv,
+   TRACE_CALL_FeedbackBuffer,
+   TRACE_CALL_SelectBuffer,
+   TRACE_CALL_RenderMode,
+   TRACE_CALL_InitNames,
+   TRACE_CALL_LoadName,
+   TRACE_CALL_PassThrough,
+   TRACE_CALL_PopName,
+   TRACE_CALL_PushName,
+   TRACE_CALL_DrawBuffer,
+   TRACE_CALL_Clear,
+   TRACE_CALL_ClearAccum,
+   TRACE_CALL_ClearIndex,
+   TRACE_CALL_ClearColor,
+   TRACE_CALL_ClearStencil,
+   TRACE_CALL_ClearDepth,
+   TRACE_CALL_StencilMask,
+   TRACE_CALL_ColorMask,
+   TRACE_CALL_DepthMask,
+   TRACE_CALL_IndexMask,
+   TRACE_CALL_Accum,
+   TRACE_CALL_Disable,
+   TRACE_CALL_Enable,
+   TRACE_CALL_Finish,
+   TRACE_CALL_Flush,
+   TRACE_CALL_PopAttrib,
+   TRACE_CALL_PushAttrib,
+   TRACE_CALL_Map1d,
+   TRACE_CALL_Map1f,
+   TRACE_CALL_Map2d,
+   TRACE_CALL_Map2f,
+   TRACE_CALL_MapGrid1d,
+   TRACE_CALL_MapGrid1f,
+   TRACE_CALL_MapGrid2d,
+   TRACE_CALL_MapGrid2f,
+   TRACE_CALL_EvalCoord1d,
+   TRACE_CALL_EvalCoord1dv,
+   TRACE_CALL_EvalCoord1f,
+   TRACE_CALL_EvalCoord1fv,
+   TRACE_CALL_EvalCoord2d,
+   TRACE_CALL_EvalCoord2dv,
+   TRACE_CALL_EvalCoord2f,
+   TRACE_CALL_EvalCoord2fv,
+   TRACE_CALL_EvalMesh1,
+   TRACE_CALL_EvalPoint1,
+   TRACE_CALL_EvalMesh2,
+   TRACE_CALL_EvalPoint2,
+   TRACE_CALL_AlphaFunc,
+   TRACE_CALL_BlendFunc,
+   TRACE_CALL_LogicOp,
+   TRACE_CALL_StencilFunc,
+   TRACE_CALL_StencilOp,
+   TRACE_CALL_DepthFunc,
+   TRACE_CALL_PixelZoom,
+   TRACE_CALL_PixelTransferf,
+   TRACE_CALL_PixelTransferi,
+   TRACE_CALL_PixelStoref,
+   TRACE_CALL_PixelStorei,
+   TRACE_CALL_PixelMapfv,
+   TRACE_CALL_PixelMapuiv,
+   TRACE_CALL_PixelMapusv,
+   TRACE_CALL_ReadBuffer,
+   TRACE_CALL_CopyPixels,
+   TRACE_CALL_ReadPixels,
+   TRACE_CALL_DrawPixels,
+   TRACE_CALL_GetBooleanv,
+   TRACE_CALL_GetClipPlane,
+   TRACE_CALL_GetDoublev,
+   TRACE_CALL_GetError,
+   TRACE_CALL_GetFloatv,
+   TRACE_CALL_GetIntegerv,
+   TRACE_CALL_GetLightfv,
+   TRACE_CALL_GetLightiv,
+   TRACE_CALL_GetMapdv,
+   TRACE_CALL_GetMapfv,
+   TRACE_CALL_GetMapiv,
+   TRACE_CALL_GetMaterialfv,
+   TRACE_CALL_GetMaterialiv,
+   TRACE_CALL_GetPixelMapfv,
+   TRACE_CALL_GetPixelMapuiv,
+   TRACE_CALL_GetPixelMapusv,
+   TRACE_CALL_GetPolygonStipple,
+   TRACE_CALL_GetString,
+   TRACE_CALL_GetTexEnvfv,
+   TRACE_CALL_GetTexEnviv,
+   TRACE_CALL_GetTexGendv,
+   TRACE_CALL_GetTexGenfv,
+   TRACE_CALL_GetTexGeniv,
+   TRACE_CALL_GetTexImage,
+   TRACE_CALL_GetTexParameterfv,
+   TRACE_CALL_GetTexParameteriv,
+   TRACE_CALL_GetTexLevelParameterfv,
+   TRACE_CALL_GetTexLevelParameteriv,
+   TRACE_CALL_IsEnabled,
+   TRACE_CALL_IsList,
+   TRACE_CALL_DepthRange,
+   TRACE_CALL_Frustum,
+   TRACE_CALL_LoadIdentity,
+   TRACE_CALL_LoadMatrixf,
+   TRACE_CALL_LoadMatrixd,
+   TRACE_CALL_MatrixMode,
+   TRACE_CALL_MultMatrixf,
+   TRACE_CALL_MultMatrixd,
+   TRACE_CALL_Ortho,
+   TRACE_CALL_PopMatrix,
+   TRACE_CALL_PushMatrix,
+   TRACE_CALL_Rotated,
+   TRACE_CALL_Rotatef,
+   TRACE_CALL_Scaled,
+   TRACE_CALL_Scalef,
+   TRACE_CALL_Translated,
+   TRACE_CALL_Translatef,
+   TRACE_CALL_Viewport,
+   TRACE_CALL_ArrayElement,
+   TRACE_CALL_BindTexture,
+   TRACE_CALL_ColorPointer,
+   TRACE_CALL_DisableClientState,
+   TRACE_CALL_DrawArrays,
+   TRACE_CALL_DrawElements,
+   TRACE_CALL_EdgeFlagPointer,
+   TRACE_CALL_EnableClientState,
+   TRACE_CALL_IndexPointer,
+   TRACE_CALL_Indexub,
+   TRACE_CALL_Indexubv,
+   TRACE_CALL_InterleavedArrays,
+   TRACE_CALL_NormalPointer,
+   TRACE_CALL_PolygonOffset,
+   TRACE_CALL_TexCoordPointer,
+   TRACE_CALL_VertexPointer,
+   TRACE_CALL_AreTexturesResident,
+   TRACE_CALL_CopyTexImage1D,
+   TRACE_CALL_CopyTexImage2D,
+   TRACE_CALL_CopyTexSubImage1D,
+   TRACE_CALL_CopyTexSubImage2D,
+   TRACE_CALL_DeleteTextures,
+   TRACE_CALL_GenTextures,
+   TRACE_CALL_GetPointerv,
+   TRACE_CALL_IsTexture,
+   TRACE_CALL_PrioritizeTextures,
+   TRACE_CALL_TexSubImage1D,
+   TRACE_CALL_TexSubImage2D,
+   TRACE_CALL_PopClientAttrib,
+   TRACE_CALL_PushClientAttrib,
+   TRACE_CALL_BlendColor,
+   TRACE_CALL_BlendEquation,
+   TRACE_CALL_DrawRangeElements,
+   TRACE_CALL_ColorTable,
+   TRACE_CALL_ColorTableParameterfv,
+   TRACE_CALL_ColorTableParameteriv,
+   TRACE_CALL_CopyColorTable,
+   TRACE_CALL_GetColorTable,
+   TRACE_CALL_GetColorTableParameterfv,
+   TRACE_CALL_GetColorTableParameteriv,
+   TRACE_CALL_ColorSubTable,
+   TRACE_CALL_CopyColorSubTable,
+   TRACE_CALL_ConvolutionFilter1D,
+   TRACE_CALL_ConvolutionFilter2D,
+   TRACE_CALL_ConvolutionParameterf,
+   TRACE_CALL_ConvolutionParameterfv,
+   TRACE_CALL_ConvolutionParameteri,
+   TRACE_CALL_ConvolutionParameteriv,
+   TRACE_CALL_CopyConvolutionFilter1D,
+   TRACE_CALL_CopyConvolutionFilter2D,
+   TRACE_CALL_GetConvolutionFilter,
+   TRACE_CALL_GetConvolutionParameterfv,
+   TRACE_CALL_GetConvolutionParameteriv,
+   TRACE_CALL_GetSeparableFilter,
+   TRACE_CALL_SeparableFilter2D,
+   TRACE_CALL_GetHistogram,
+   TRACE_CALL_GetHistogramParameterfv,
+   TRACE_CALL_GetHistogramParameteriv,
+   TRACE_CALL_GetMinmax,
+   TRACE_CALL_GetMinmaxParameterfv,
+   TRACE_CALL_GetMinmaxParameteriv,
+   TRACE_CALL_Histogram,
+   TRACE_CALL_Minmax,
+   TRACE_CALL_ResetHistogram,
+   TRACE_CALL_ResetMinmax,
+   TRACE_CALL_TexImage3D,
+   TRACE_CALL_TexSubImage3D,
+   TRACE_CALL_CopyTexSubImage3D,
+   TRACE_CALL_ActiveTextureARB,
+   TRACE_CALL_ClientActiveTextureARB,
+   TRACE_CALL_MultiTexCoord1dARB,
+   TRACE_CALL_MultiTexCoord1dvARB,
+   TRACE_CALL_MultiTexCoord1fARB,
+   TRACE_CALL_MultiTexCoord1fvARB,
+   TRACE_CALL_MultiTexCoord1iARB,
+   TRACE_CALL_MultiTexCoord1ivARB,
+   TRACE_CALL_MultiTexCoord1sARB,
+   TRACE_CALL_MultiTexCoord1svARB,
+   TRACE_CALL_MultiTexCoord2dARB,
+   TRACE_CALL_MultiTexCoord2dvARB,
+   TRACE_CALL_MultiTexCoord2fARB,
+   TRACE_CALL_MultiTexCoord2fvARB,
+   TRACE_CALL_MultiTexCoord2iARB,
+   TRACE_CALL_MultiTexCoord2ivARB,
+   TRACE_CALL_MultiTexCoord2sARB,
+   TRACE_CALL_MultiTexCoord2svARB,
+   TRACE_CALL_MultiTexCoord3dARB,
+   TRACE_CALL_MultiTexCoord3dvARB,
+   TRACE_CALL_MultiTexCoord3fARB,
+   TRACE_CALL_MultiTexCoord3fvARB,
+   TRACE_CALL_MultiTexCoord3iARB,
+   TRACE_CALL_MultiTexCoord3ivARB,
+   TRACE_CALL_MultiTexCoord3sARB,
+   TRACE_CALL_MultiTexCoord3svARB,
+   TRACE_CALL_MultiTexCoord4dARB,
+   TRACE_CALL_MultiTexCoord4dvARB,
+   TRACE_CALL_MultiTexCoord4fARB,
+   TRACE_CALL_MultiTexCoord4fvARB,
+   TRACE_CALL_MultiTexCoord4iARB,
+   TRACE_CALL_MultiTexCoord4ivARB,
+   TRACE_CALL_MultiTexCoord4sARB,
+   TRACE_CALL_MultiTexCoord4svARB,
+   TRACE_CALL_LoadTransposeMatrixfARB,
+   TRACE_CALL_LoadTransposeMatrixdARB,
+   TRACE_CALL_MultTransposeMatrixfARB,
+   TRACE_CALL_MultTransposeMatrixdARB,
+   TRACE_CALL_SampleCoverageARB,
+   TRACE_CALL_DrawBuffersARB,
+   TRACE_CALL_PolygonOffsetEXT,
+   TRACE_CALL_GetTexFilterFuncSGIS,
+   TRACE_CALL_TexFilterFuncSGIS,
+   TRACE_CALL_GetHistogramEXT,
+   TRACE_CALL_GetHistogramParameterfvEXT,
+   TRACE_CALL_GetHistogramParameterivEXT,
+   TRACE_CALL_GetMinmaxEXT,
+   TRACE_CALL_GetMinmaxParameterfvEXT,
+   TRACE_CALL_GetMinmaxParameterivEXT,
+   TRACE_CALL_GetConvolutionFilterEXT,
+   TRACE_CALL_GetConvolutionParameterfvEXT,
+   TRACE_CALL_GetConvolutionParameterivEXT,
+   TRACE_CALL_GetSeparableFilterEXT,
+   TRACE_CALL_GetColorTableSGI,
+   TRACE_CALL_GetColorTableParameterfvSGI,
+   TRACE_CALL_GetColorTableParameterivSGI,
+   TRACE_CALL_PixelTexGenSGIX,
+   TRACE_CALL_PixelTexGenParameteriSGIS,
+   TRACE_CALL_PixelTexGenParameterivSGIS,
+   TRACE_CALL_PixelTexGenParameterfSGIS,
+   TRACE_CALL_PixelTexGenParameterfvSGIS,
+   TRACE_CALL_GetPixelTexGenParameterivSGIS,
+   TRACE_CALL_GetPixelTexGenParameterfvSGIS,
+   TRACE_CALL_TexImage4DSGIS,
+   TRACE_CALL_TexSubImage4DSGIS,
+   TRACE_CALL_AreTexturesResidentEXT,
+   TRACE_CALL_GenTexturesEXT,
+   TRACE_CALL_IsTextureEXT,
+   TRACE_CALL_DetailTexFuncSGIS,
+   TRACE_CALL_GetDetailTexFuncSGIS,
+   TRACE_CALL_SharpenTexFuncSGIS,
+   TRACE_CALL_GetSharpenTexFuncSGIS,
+   TRACE_CALL_SampleMaskSGIS,
+   TRACE_CALL_SamplePatternSGIS,
+   TRACE_CALL_ColorPointerEXT,
+   TRACE_CALL_EdgeFlagPointerEXT,
+   TRACE_CALL_IndexPointerEXT,
+   TRACE_CALL_NormalPointerEXT,
+   TRACE_CALL_TexCoordPointerEXT,
+   TRACE_CALL_VertexPointerEXT,
+   TRACE_CALL_SpriteParameterfSGIX,
+   TRACE_CALL_SpriteParameterfvSGIX,
+   TRACE_CALL_SpriteParameteriSGIX,
+   TRACE_CALL_SpriteParameterivSGIX,
+   TRACE_CALL_PointParameterfEXT,
+   TRACE_CALL_PointParameterfvEXT,
+   TRACE_CALL_GetInstrumentsSGIX,
+   TRACE_CALL_InstrumentsBufferSGIX,
+   TRACE_CALL_PollInstrumentsSGIX,
+   TRACE_CALL_ReadInstrumentsSGIX,
+   TRACE_CALL_StartInstrumentsSGIX,
+   TRACE_CALL_StopInstrumentsSGIX,
+   TRACE_CALL_FrameZoomSGIX,
+   TRACE_CALL_TagSampleBufferSGIX,
+   TRACE_CALL_ReferencePlaneSGIX,
+   TRACE_CALL_FlushRasterSGIX,
+   TRACE_CALL_GetListParameterfvSGIX,
+   TRACE_CALL_GetListParameterivSGIX,
+   TRACE_CALL_ListParameterfSGIX,
+   TRACE_CALL_ListParameterfvSGIX,
+   TRACE_CALL_ListParameteriSGIX,
+   TRACE_CALL_ListParameterivSGIX,
+   TRACE_CALL_FragmentColorMaterialSGIX,
+   TRACE_CALL_FragmentLightfSGIX,
+   TRACE_CALL_FragmentLightfvSGIX,
+   TRACE_CALL_FragmentLightiSGIX,
+   TRACE_CALL_FragmentLightivSGIX,
+   TRACE_CALL_FragmentLightModelfSGIX,
+   TRACE_CALL_FragmentLightModelfvSGIX,
+   TRACE_CALL_FragmentLightModeliSGIX,
+   TRACE_CALL_FragmentLightModelivSGIX,
+   TRACE_CALL_FragmentMaterialfSGIX,
+   TRACE_CALL_FragmentMaterialfvSGIX,
+   TRACE_CALL_FragmentMaterialiSGIX,
+   TRACE_CALL_FragmentMaterialivSGIX,
+   TRACE_CALL_GetFragmentLightfvSGIX,
+   TRACE_CALL_GetFragmentLightivSGIX,
+   TRACE_CALL_GetFragmentMaterialfvSGIX,
+   TRACE_CALL_GetFragmentMaterialivSGIX,
+   TRACE_CALL_LightEnviSGIX,
+   TRACE_CALL_VertexWeightfEXT,
+   TRACE_CALL_VertexWeightfvEXT,
+   TRACE_CALL_VertexWeightPointerEXT,
+   TRACE_CALL_FlushVertexArrayRangeNV,
+   TRACE_CALL_VertexArrayRangeNV,
+   TRACE_CALL_CombinerParameterfvNV,
+   TRACE_CALL_CombinerParameterfNV,
+   TRACE_CALL_CombinerParameterivNV,
+   TRACE_CALL_CombinerParameteriNV,
+   TRACE_CALL_CombinerInputNV,
+   TRACE_CALL_CombinerOutputNV,
+   TRACE_CALL_FinalCombinerInputNV,
+   TRACE_CALL_GetCombinerInputParameterfvNV,
+   TRACE_CALL_GetCombinerInputParameterivNV,
+   TRACE_CALL_GetCombinerOutputParameterfvNV,
+   TRACE_CALL_GetCombinerOutputParameterivNV,
+   TRACE_CALL_GetFinalCombinerInputParameterfvNV,
+   TRACE_CALL_GetFinalCombinerInputParameterivNV,
+   TRACE_CALL_ResizeBuffersMESA,
+   TRACE_CALL_WindowPos2dMESA,
+   TRACE_CALL_WindowPos2dvMESA,
+   TRACE_CALL_WindowPos2fMESA,
+   TRACE_CALL_WindowPos2fvMESA,
+   TRACE_CALL_WindowPos2iMESA,
+   TRACE_CALL_WindowPos2ivMESA,
+   TRACE_CALL_WindowPos2sMESA,
+   TRACE_CALL_WindowPos2svMESA,
+   TRACE_CALL_WindowPos3dMESA,
+   TRACE_CALL_WindowPos3dvMESA,
+   TRACE_CALL_WindowPos3fMESA,
+   TRACE_CALL_WindowPos3fvMESA,
+   TRACE_CALL_WindowPos3iMESA,
+   TRACE_CALL_WindowPos3ivMESA,
+   TRACE_CALL_WindowPos3sMESA,
+   TRACE_CALL_WindowPos3svMESA,
+   TRACE_CALL_WindowPos4dMESA,
+   TRACE_CALL_WindowPos4dvMESA,
+   TRACE_CALL_WindowPos4fMESA,
+   TRACE_CALL_WindowPos4fvMESA,
+   TRACE_CALL_WindowPos4iMESA,
+   TRACE_CALL_WindowPos4ivMESA,
+   TRACE_CALL_WindowPos4sMESA,
+   TRACE_CALL_WindowPos4svMESA,
+   TRACE_CALL_BlendFuncSeparateEXT,
+   TRACE_CALL_IndexMaterialEXT,
+   TRACE_CALL_IndexFuncEXT,
+   TRACE_CALL_LockArraysEXT,
+   TRACE_CALL_UnlockArraysEXT,
+   TRACE_CALL_CullParameterdvEXT,
+   TRACE_CALL_CullParameterfvEXT,
+   TRACE_CALL_HintPGI,
+   TRACE_CALL_FogCoordfEXT,
+   TRACE_CALL_FogCoordfvEXT,
+   TRACE_CALL_FogCoorddEXT,
+   TRACE_CALL_FogCoorddvEXT,
+   TRACE_CALL_FogCoordPointerEXT,
+   TRACE_CALL_GetColorTableEXT,
+   TRACE_CALL_GetColorTableParameterivEXT,
+   TRACE_CALL_GetColorTableParameterfvEXT,
+   TRACE_CALL_TbufferMask3DFX,
+   TRACE_CALL_CompressedTexImage3DARB,
+   TRACE_CALL_CompressedTexImage2DARB,
+   TRACE_CALL_CompressedTexImage1DARB,
+   TRACE_CALL_CompressedTexSubImage3DARB,
+   TRACE_CALL_CompressedTexSubImage2DARB,
+   TRACE_CALL_CompressedTexSubImage1DARB,
+   TRACE_CALL_GetCompressedTexImageARB,
+   TRACE_CALL_SecondaryColor3bEXT,
+   TRACE_CALL_SecondaryColor3bvEXT,
+   TRACE_CALL_SecondaryColor3dEXT,
+   TRACE_CALL_SecondaryColor3dvEXT,
+   TRACE_CALL_SecondaryColor3fEXT,
+   TRACE_CALL_SecondaryColor3fvEXT,
+   TRACE_CALL_SecondaryColor3iEXT,
+   TRACE_CALL_SecondaryColor3ivEXT,
+   TRACE_CALL_SecondaryColor3sEXT,
+   TRACE_CALL_SecondaryColor3svEXT,
+   TRACE_CALL_SecondaryColor3ubEXT,
+   TRACE_CALL_SecondaryColor3ubvEXT,
+   TRACE_CALL_SecondaryColor3uiEXT,
+   TRACE_CALL_SecondaryColor3uivEXT,
+   TRACE_CALL_SecondaryColor3usEXT,
+   TRACE_CALL_SecondaryColor3usvEXT,
+   TRACE_CALL_SecondaryColorPointerEXT,
+   TRACE_CALL_AreProgramsResidentNV,
+   TRACE_CALL_BindProgramNV,
+   TRACE_CALL_DeleteProgramsNV,
+   TRACE_CALL_ExecuteProgramNV,
+   TRACE_CALL_GenProgramsNV,
+   TRACE_CALL_GetProgramParameterdvNV,
+   TRACE_CALL_GetProgramParameterfvNV,
+   TRACE_CALL_GetProgramivNV,
+   TRACE_CALL_GetProgramStringNV,
+   TRACE_CALL_GetTrackMatrixivNV,
+   TRACE_CALL_GetVertexAttribdvARB,
+   TRACE_CALL_GetVertexAttribfvARB,
+   TRACE_CALL_GetVertexAttribivARB,
+   TRACE_CALL_GetVertexAttribPointervNV,
+   TRACE_CALL_IsProgramNV,
+   TRACE_CALL_LoadProgramNV,
+   TRACE_CALL_ProgramParameter4dNV,
+   TRACE_CALL_ProgramParameter4dvNV,
+   TRACE_CALL_ProgramParameter4fNV,
+   TRACE_CALL_ProgramParameter4fvNV,
+   TRACE_CALL_ProgramParameters4dvNV,
+   TRACE_CALL_ProgramParameters4fvNV,
+   TRACE_CALL_RequestResidentProgramsNV,
+   TRACE_CALL_TrackMatrixNV,
+   TRACE_CALL_VertexAttribPointerNV,
+   TRACE_CALL_VertexAttrib1dARB,
+   TRACE_CALL_VertexAttrib1dvARB,
+   TRACE_CALL_VertexAttrib1fARB,
+   TRACE_CALL_VertexAttrib1fvARB,
+   TRACE_CALL_VertexAttrib1sARB,
+   TRACE_CALL_VertexAttrib1svARB,
+   TRACE_CALL_VertexAttrib2dARB,
+   TRACE_CALL_VertexAttrib2dvARB,
+   TRACE_CALL_VertexAttrib2fARB,
+   TRACE_CALL_VertexAttrib2fvARB,
+   TRACE_CALL_VertexAttrib2sARB,
+   TRACE_CALL_VertexAttrib2svARB,
+   TRACE_CALL_VertexAttrib3dARB,
+   TRACE_CALL_VertexAttrib3dvARB,
+   TRACE_CALL_VertexAttrib3fARB,
+   TRACE_CALL_VertexAttrib3fvARB,
+   TRACE_CALL_VertexAttrib3sARB,
+   TRACE_CALL_VertexAttrib3svARB,
+   TRACE_CALL_VertexAttrib4dARB,
+   TRACE_CALL_VertexAttrib4dvARB,
+   TRACE_CALL_VertexAttrib4fARB,
+   TRACE_CALL_VertexAttrib4fvARB,
+   TRACE_CALL_VertexAttrib4sARB,
+   TRACE_CALL_VertexAttrib4svARB,
+   TRACE_CALL_VertexAttrib4NubARB,
+   TRACE_CALL_VertexAttrib4NubvARB,
+   TRACE_CALL_VertexAttribs1dvNV,
+   TRACE_CALL_VertexAttribs1fvNV,
+   TRACE_CALL_VertexAttribs1svNV,
+   TRACE_CALL_VertexAttribs2dvNV,
+   TRACE_CALL_VertexAttribs2fvNV,
+   TRACE_CALL_VertexAttribs2svNV,
+   TRACE_CALL_VertexAttribs3dvNV,
+   TRACE_CALL_VertexAttribs3fvNV,
+   TRACE_CALL_VertexAttribs3svNV,
+   TRACE_CALL_VertexAttribs4dvNV,
+   TRACE_CALL_VertexAttribs4fvNV,
+   TRACE_CALL_VertexAttribs4svNV,
+   TRACE_CALL_VertexAttribs4ubvNV,
+   TRACE_CALL_PointParameteriNV,
+   TRACE_CALL_PointParameterivNV,
+   TRACE_CALL_MultiDrawArraysEXT,
+   TRACE_CALL_MultiDrawElementsEXT,
+   TRACE_CALL_ActiveStencilFaceEXT,
+   TRACE_CALL_DeleteFencesNV,
+   TRACE_CALL_GenFencesNV,
+   TRACE_CALL_IsFenceNV,
+   TRACE_CALL_TestFenceNV,
+   TRACE_CALL_GetFenceivNV,
+   TRACE_CALL_FinishFenceNV,
+   TRACE_CALL_SetFenceNV,
+   TRACE_CALL_VertexAttrib4bvARB,
+   TRACE_CALL_VertexAttrib4ivARB,
+   TRACE_CALL_VertexAttrib4ubvARB,
+   TRACE_CALL_VertexAttrib4usvARB,
+   TRACE_CALL_VertexAttrib4uivARB,
+   TRACE_CALL_VertexAttrib4NbvARB,
+   TRACE_CALL_VertexAttrib4NsvARB,
+   TRACE_CALL_VertexAttrib4NivARB,
+   TRACE_CALL_VertexAttrib4NusvARB,
+   TRACE_CALL_VertexAttrib4NuivARB,
+   TRACE_CALL_VertexAttribPointerARB,
+   TRACE_CALL_EnableVertexAttribArrayARB,
+   TRACE_CALL_DisableVertexAttribArrayARB,
+   TRACE_CALL_ProgramStringARB,
+   TRACE_CALL_ProgramEnvParameter4dARB,
+   TRACE_CALL_ProgramEnvParameter4dvARB,
+   TRACE_CALL_ProgramEnvParameter4fARB,
+   TRACE_CALL_ProgramEnvParameter4fvARB,
+   TRACE_CALL_ProgramLocalParameter4dARB,
+   TRACE_CALL_ProgramLocalParameter4dvARB,
+   TRACE_CALL_ProgramLocalParameter4fARB,
+   TRACE_CALL_ProgramLocalParameter4fvARB,
+   TRACE_CALL_GetProgramEnvParameterdvARB,
+   TRACE_CALL_GetProgramEnvParameterfvARB,
+   TRACE_CALL_GetProgramLocalParameterdvARB,
+   TRACE_CALL_GetProgramLocalParameterfvARB,
+   TRACE_CALL_GetProgramivARB,
+   TRACE_CALL_GetProgramStringARB,
+   TRACE_CALL_ProgramNamedParameter4fNV,
+   TRACE_CALL_ProgramNamedParameter4dNV,
+   TRACE_CALL_ProgramNamedParameter4fvNV,
+   TRACE_CALL_ProgramNamedParameter4dvNV,
+   TRACE_CALL_GetProgramNamedParameterfvNV,
+   TRACE_CALL_GetProgramNamedParameterdvNV,
+   TRACE_CALL_BindBufferARB,
+   TRACE_CALL_BufferDataARB,
+   TRACE_CALL_BufferSubDataARB,
+   TRACE_CALL_DeleteBuffersARB,
+   TRACE_CALL_GenBuffersARB,
+   TRACE_CALL_GetBufferParameterivARB,
+   TRACE_CALL_GetBufferPointervARB,
+   TRACE_CALL_GetBufferSubDataARB,
+   TRACE_CALL_IsBufferARB,
+   TRACE_CALL_MapBufferARB,
+   TRACE_CALL_UnmapBufferARB,
+   TRACE_CALL_DepthBoundsEXT,
+   TRACE_CALL_GenQueriesARB,
+   TRACE_CALL_DeleteQueriesARB,
+   TRACE_CALL_IsQueryARB,
+   TRACE_CALL_BeginQueryARB,
+   TRACE_CALL_EndQueryARB,
+   TRACE_CALL_GetQueryivARB,
+   TRACE_CALL_GetQueryObjectivARB,
+   TRACE_CALL_GetQueryObjectuivARB,
+   TRACE_CALL_MultiModeDrawArraysIBM,
+   TRACE_CALL_MultiModeDrawElementsIBM,
+   TRACE_CALL_BlendEquationSeparateEXT,
+   TRACE_CALL_DeleteObjectARB,
+   TRACE_CALL_GetHandleARB,
+   TRACE_CALL_DetachObjectARB,
+   TRACE_CALL_CreateShaderObjectARB,
+   TRACE_CALL_ShaderSourceARB,
+   TRACE_CALL_CompileShaderARB,
+   TRACE_CALL_CreateProgramObjectARB,
+   TRACE_CALL_AttachObjectARB,
+   TRACE_CALL_LinkProgramARB,
+   TRACE_CALL_UseProgramObjectARB,
+   TRACE_CALL_ValidateProgramARB,
+   TRACE_CALL_Uniform1fARB,
+   TRACE_CALL_Uniform2fARB,
+   TRACE_CALL_Uniform3fARB,
+   TRACE_CALL_Uniform4fARB,
+   TRACE_CALL_Uniform1iARB,
+   TRACE_CALL_Uniform2iARB,
+   TRACE_CALL_Uniform3iARB,
+   TRACE_CALL_Uniform4iARB,
+   TRACE_CALL_Uniform1fvARB,
+   TRACE_CALL_Uniform2fvARB,
+   TRACE_CALL_Uniform3fvARB,
+   TRACE_CALL_Uniform4fvARB,
+   TRACE_CALL_Uniform1ivARB,
+   TRACE_CALL_Uniform2ivARB,
+   TRACE_CALL_Uniform3ivARB,
+   TRACE_CALL_Uniform4ivARB,
+   TRACE_CALL_UniformMatrix2fvARB,
+   TRACE_CALL_UniformMatrix3fvARB,
+   TRACE_CALL_UniformMatrix4fvARB,
+   TRACE_CALL_GetObjectParameterfvARB,
+   TRACE_CALL_GetObjectParameterivARB,
+   TRACE_CALL_GetInfoLogARB,
+   TRACE_CALL_GetAttachedObjectsARB,
+   TRACE_CALL_GetUniformLocationARB,
+   TRACE_CALL_GetActiveUniformARB,
+   TRACE_CALL_GetUniformfvARB,
+   TRACE_CALL_GetUniformivARB,
+   TRACE_CALL_GetShaderSourceARB,
+   TRACE_CALL_BindAttribLocationARB,
+   TRACE_CALL_GetActiveAttribARB,
+   TRACE_CALL_GetAttribLocationARB,
+   TRACE_CALL_GetVertexAttribdvNV,
+   TRACE_CALL_GetVertexAttribfvNV,
+   TRACE_CALL_GetVertexAttribivNV,
+   TRACE_CALL_VertexAttrib1dNV,
+   TRACE_CALL_VertexAttrib1dvNV,
+   TRACE_CALL_VertexAttrib1fNV,
+   TRACE_CALL_VertexAttrib1fvNV,
+   TRACE_CALL_VertexAttrib1sNV,
+   TRACE_CALL_VertexAttrib1svNV,
+   TRACE_CALL_VertexAttrib2dNV,
+   TRACE_CALL_VertexAttrib2dvNV,
+   TRACE_CALL_VertexAttrib2fNV,
+   TRACE_CALL_VertexAttrib2fvNV,
+   TRACE_CALL_VertexAttrib2sNV,
+   TRACE_CALL_VertexAttrib2svNV,
+   TRACE_CALL_VertexAttrib3dNV,
+   TRACE_CALL_VertexAttrib3dvNV,
+   TRACE_CALL_VertexAttrib3fNV,
+   TRACE_CALL_VertexAttrib3fvNV,
+   TRACE_CALL_VertexAttrib3sNV,
+   TRACE_CALL_VertexAttrib3svNV,
+   TRACE_CALL_VertexAttrib4dNV,
+   TRACE_CALL_VertexAttrib4dvNV,
+   TRACE_CALL_VertexAttrib4fNV,
+   TRACE_CALL_VertexAttrib4fvNV,
+   TRACE_CALL_VertexAttrib4sNV,
+   TRACE_CALL_VertexAttrib4svNV,
+   TRACE_CALL_VertexAttrib4ubNV,
+   TRACE_CALL_VertexAttrib4ubvNV,
+   TRACE_CALL_GenFragmentShadersATI,
+   TRACE_CALL_BindFragmentShaderATI,
+   TRACE_CALL_DeleteFragmentShaderATI,
+   TRACE_CALL_BeginFragmentShaderATI,
+   TRACE_CALL_EndFragmentShaderATI,
+   TRACE_CALL_PassTexCoordATI,
+   TRACE_CALL_SampleMapATI,
+   TRACE_CALL_ColorFragmentOp1ATI,
+   TRACE_CALL_ColorFragmentOp2ATI,
+   TRACE_CALL_ColorFragmentOp3ATI,
+   TRACE_CALL_AlphaFragmentOp1ATI,
+   TRACE_CALL_AlphaFragmentOp2ATI,
+   TRACE_CALL_AlphaFragmentOp3ATI,
+   TRACE_CALL_SetFragmentShaderConstantATI,
+   TRACE_CALL_IsRenderbufferEXT,
+   TRACE_CALL_BindRenderbufferEXT,
+   TRACE_CALL_DeleteRenderbuffersEXT,
+   TRACE_CALL_GenRenderbuffersEXT,
+   TRACE_CALL_RenderbufferStorageEXT,
+   TRACE_CALL_GetRenderbufferParameterivEXT,
+   TRACE_CALL_IsFramebufferEXT,
+   TRACE_CALL_BindFramebufferEXT,
+   TRACE_CALL_DeleteFramebuffersEXT,
+   TRACE_CALL_GenFramebuffersEXT,
+   TRACE_CALL_CheckFramebufferStatusEXT,
+   TRACE_CALL_FramebufferTexture1DEXT,
+   TRACE_CALL_FramebufferTexture2DEXT,
+   TRACE_CALL_FramebufferTexture3DEXT,
+   TRACE_CALL_FramebufferRenderbufferEXT,
+   TRACE_CALL_GetFramebufferAttachmentParameterivEXT,
+   TRACE_CALL_GenerateMipmapEXT,
+   TRACE_CALL_StencilFuncSeparate,
+   TRACE_CALL_StencilOpSeparate,
+   TRACE_CALL_StencilMaskSeparate,
+   NUM_TRACE_CALL
+};
+
+static const char * const trace_call_names[NUM_TRACE_CALL] = {
+   "NewList",
+   "EndList",
+   "CallList",
+   "CallLists",
+   "DeleteLists",
+   "GenLists",
+   "ListBase",
+   "Begin",
+   "Bitmap",
+   "Color3b",
+   "Color3bv",
+   "Color3d",
+   "Color3dv",
+   "Color3f",
+   "Color3fv",
+   "Color3i",
+   "Color3iv",
+   "Color3s",
+   "Color3sv",
+   "Color3ub",
+   "Color3ubv",
+   "Color3ui",
+   "Color3uiv",
+   "Color3us",
+   "Color3usv",
+   "Color4b",
+   "Color4bv",
+   "Color4d",
+   "Color4dv",
+   "Color4f",
+   "Color4fv",
+   "Color4i",
+   "Color4iv",
+   "Color4s",
+   "Color4sv",
+   "Color4ub",
+   "Color4ubv",
+   "Color4ui",
+   "Color4uiv",
+   "Color4us",
+   "Color4usv",
+   "EdgeFlag",
+   "EdgeFlagv",
+   "End",
+   "Indexd",
+   "Indexdv",
+   "Indexf",
+   "Indexfv",
+   "Indexi",
+   "Indexiv",
+   "Indexs",
+   "Indexsv",
+   "Normal3b",
+   "Normal3bv",
+   "Normal3d",
+   "Normal3dv",
+   "Normal3f",
+   "Normal3fv",
+   "Normal3i",
+   "Normal3iv",
+   "Normal3s",
+   "Normal3sv",
+   "RasterPos2d",
+   "RasterPos2dv",
+   "RasterPos2f",
+   "RasterPos2fv",
+   "RasterPos2i",
+   "RasterPos2iv",
+   "RasterPos2s",
+   "RasterPos2sv",
+   "RasterPos3d",
+   "RasterPos3dv",
+   "RasterPos3f",
+   "RasterPos3fv",
+   "RasterPos3i",
+   "RasterPos3iv",
+   "RasterPos3s",
+   "RasterPos3sv",
+   "RasterPos4d",
+   "RasterPos4dv",
+   "RasterPos4f",
+   "RasterPos4fv",
+   "RasterPos4i",
+   "RasterPos4iv",
+   "RasterPos4s",
+   "RasterPos4sv",
+   "Rectd",
+   "Rectdv",
+   "Rectf",
+   "Rectfv",
+   "Recti",
+   "Rectiv",
+   "Rects",
+   "Rectsv",
+   "TexCoord1d",
+   "TexCoord1dv",
+   "TexCoord1f",
+   "TexCoord1fv",
+   "TexCoord1i",
+   "TexCoord1iv",
+   "TexCoord1s",
+   "TexCoord1sv",
+   "TexCoord2d",
+   "TexCoord2dv",
+   "TexCoord2f",
+   "TexCoord2fv",
+   "TexCoord2i",
+   "TexCoord2iv",
+   "TexCoord2s",
+   "TexCoord2sv",
+   "TexCoord3d",
+   "TexCoord3dv",
+   "TexCoord3f",
+   "TexCoord3fv",
+   "TexCoord3i",
+   "TexCoord3iv",
+   "TexCoord3s",
+   "TexCoord3sv",
+   "TexCoord4d",
+   "TexCoord4dv",
+   "TexCoord4f",
+   "TexCoord4fv",
+   "TexCoord4i",
+   "TexCoord4iv",
+   "TexCoord4s",
+   "TexCoord4sv",
+   "Vertex2d",
+   "Vertex2dv",
+   "Vertex2f",
+   "Vertex2fv",
+   "Vertex2i",
+   "Vertex2iv",
+   "Vertex2s",
+   "Vertex2sv",
+   "Vertex3d",
+   "Vertex3dv",
+   "Vertex3f",
+   "Vertex3fv",
+   "Vertex3i",
+   "Vertex3iv",
+   "Vertex3s",
+   "Vertex3sv",
+   "Vertex4d",
+   "Vertex4dv",
+   "Vertex4f",
+   "Vertex4fv",
+   "Vertex4i",
+   "Vertex4iv",
+   "Vertex4s",
+   "Vertex4sv",
+   "ClipPlane",
+   "ColorMaterial",
+   "CullFace",
+   "Fogf",
+   "Fogfv",
+   "Fogi",
+   "Fogiv",
+   "FrontFace",
+   "Hint",
+   "Lightf",
+   "Lightfv",
+   "Lighti",
+   "Lightiv",
+   "LightModelf",
+   "LightModelfv",
+   "LightModeli",
+   "LightModeliv",
+   "LineStipple",
+   "LineWidth",
+   "Materialf",
+   "Materialfv",
+   "Materiali",
+   "Materialiv",
+   "PointSize",
+   "PolygonMode",
+   "PolygonStipple",
+   "Scissor",
+   "ShadeModel",
+   "TexParameterf",
+   "TexParameterfv",
+   "TexParameteri",
+   "TexParameteriv",
+   "TexImage1D",
+   "TexImage2D",
+   "TexEnvf",
+   "TexEnvfv",
+   "TexEnvi",
+   "TexEnviv",
+   "TexGend",
+   "TexGendv",
+   "TexGenf",
+   "TexGenfv",
+   "TexGeni",
+   "TexGeniv",
+   "FeedbackBuffer",
+   "SelectBuffer",
+   "RenderMode",
+   "InitNames",
+   "LoadName",
+   "PassThrough",
+   "PopName",
+   "PushName",
+   "DrawBuffer",
+   "Clear",
+   "ClearAccum",
+   "ClearIndex",
+   "ClearColor",
+   "ClearStencil",
+   "ClearDepth",
+   "StencilMask",
+   "ColorMask",
+   "DepthMask",
+   "IndexMask",
+   "Accum",
+   "Disable",
+   "Enable",
+   "Finish",
+   "Flush",
+   "PopAttrib",
+   "PushAttrib",
+   "Map1d",
+   "Map1f",
+   "Map2d",
+   "Map2f",
+   "MapGrid1d",
+   "MapGrid1f",
+   "MapGrid2d",
+   "MapGrid2f",
+   "EvalCoord1d",
+   "EvalCoord1dv",
+   "EvalCoord1f",
+   "EvalCoord1fv",
+   "EvalCoord2d",
+   "EvalCoord2dv",
+   "EvalCoord2f",
+   "EvalCoord2fv",
+   "EvalMesh1",
+   "EvalPoint1",
+   "EvalMesh2",
+   "EvalPoint2",
+   "AlphaFunc",
+   "BlendFunc",
+   "LogicOp",
+   "StencilFunc",
+   "StencilOp",
+   "DepthFunc",
+   "PixelZoom",
+   "PixelTransferf",
+   "PixelTransferi",
+   "PixelStoref",
+   "PixelStorei",
+   "PixelMapfv",
+   "PixelMapuiv",
+   "PixelMapusv",
+   "ReadBuffer",
+   "CopyPixels",
+   "ReadPixels",
+   "DrawPixels",
+   "GetBooleanv",
+   "GetClipPlane",
+   "GetDoublev",
+   "GetError",
+   "GetFloatv",
+   "GetIntegerv",
+   "GetLightfv",
+   "GetLightiv",
+   "GetMapdv",
+   "GetMapfv",
+   "GetMapiv",
+   "GetMaterialfv",
+   "GetMaterialiv",
+   "GetPixelMapfv",
+   "GetPixelMapuiv",
+   "GetPixelMapusv",
+   "GetPolygonStipple",
+   "GetString",
+   "GetTexEnvfv",
+   "GetTexEnviv",
+   "GetTexGendv",
+   "GetTexGenfv",
+   "GetTexGeniv",
+   "GetTexImage",
+   "GetTexParameterfv",
+   "GetTexParameteriv",
+   "GetTexLevelParameterfv",
+   "GetTexLevelParameteriv",
+   "IsEnabled",
+   "IsList",
+   "DepthRange",
+   "Frustum",
+   "LoadIdentity",
+   "LoadMatrixf",
+   "LoadMatrixd",
+   "MatrixMode",
+   "MultMatrixf",
+   "MultMatrixd",
+   "Ortho",
+   "PopMatrix",
+   "PushMatrix",
+   "Rotated",
+   "Rotatef",
+   "Scaled",
+   "Scalef",
+   "Translated",
+   "Translatef",
+   "Viewport",
+   "ArrayElement",
+   "BindTexture",
+   "ColorPointer",
+   "DisableClientState",
+   "DrawArrays",
+   "DrawElements",
+   "EdgeFlagPointer",
+   "EnableClientState",
+   "IndexPointer",
+   "Indexub",
+   "Indexubv",
+   "InterleavedArrays",
+   "NormalPointer",
+   "PolygonOffset",
+   "TexCoordPointer",
+   "VertexPointer",
+   "AreTexturesResident",
+   "CopyTexImage1D",
+   "CopyTexImage2D",
+   "CopyTexSubImage1D",
+   "CopyTexSubImage2D",
+   "DeleteTextures",
+   "GenTextures",
+   "GetPointerv",
+   "IsTexture",
+   "PrioritizeTextures",
+   "TexSubImage1D",
+   "TexSubImage2D",
+   "PopClientAttrib",
+   "PushClientAttrib",
+   "BlendColor",
+   "BlendEquation",
+   "DrawRangeElements",
+   "ColorTable",
+   "ColorTableParameterfv",
+   "ColorTableParameteriv",
+   "CopyColorTable",
+   "GetColorTable",
+   "GetColorTableParameterfv",
+   "GetColorTableParameteriv",
+   "ColorSubTable",
+   "CopyColorSubTable",
+   "ConvolutionFilter1D",
+   "ConvolutionFilter2D",
+   "ConvolutionParameterf",
+   "ConvolutionParameterfv",
+   "ConvolutionParameteri",
+   "ConvolutionParameteriv",
+   "CopyConvolutionFilter1D",
+   "CopyConvolutionFilter2D",
+   "GetConvolutionFilter",
+   "GetConvolutionParameterfv",
+   "GetConvolutionParameteriv",
+   "GetSeparableFilter",
+   "SeparableFilter2D",
+   "GetHistogram",
+   "GetHistogramParameterfv",
+   "GetHistogramParameteriv",
+   "GetMinmax",
+   "GetMinmaxParameterfv",
+   "GetMinmaxParameteriv",
+   "Histogram",
+   "Minmax",
+   "ResetHistogram",
+   "ResetMinmax",
+   "TexImage3D",
+   "TexSubImage3D",
+   "CopyTexSubImage3D",
+   "ActiveTextureARB",
+   "ClientActiveTextureARB",
+   "MultiTexCoord1dARB",
+   "MultiTexCoord1dvARB",
+   "MultiTexCoord1fARB",
+   "MultiTexCoord1fvARB",
+   "MultiTexCoord1iARB",
+   "MultiTexCoord1ivARB",
+   "MultiTexCoord1sARB",
+   "MultiTexCoord1svARB",
+   "MultiTexCoord2dARB",
+   "MultiTexCoord2dvARB",
+   "MultiTexCoord2fARB",
+   "MultiTexCoord2fvARB",
+   "MultiTexCoord2iARB",
+   "MultiTexCoord2ivARB",
+   "MultiTexCoord2sARB",
+   "MultiTexCoord2svARB",
+   "MultiTexCoord3dARB",
+   "MultiTexCoord3dvARB",
+   "MultiTexCoord3fARB",
+   "MultiTexCoord3fvARB",
+   "MultiTexCoord3iARB",
+   "MultiTexCoord3ivARB",
+   "MultiTexCoord3sARB",
+   "MultiTexCoord3svARB",
+   "MultiTexCoord4dARB",
+   "MultiTexCoord4dvARB",
+   "MultiTexCoord4fARB",
+   "MultiTexCoord4fvARB",
+   "MultiTexCoord4iARB",
+   "MultiTexCoord4ivARB",
+   "MultiTexCoord4sARB",
+   "MultiTexCoord4svARB",
+   "LoadTransposeMatrixfARB",
+   "LoadTransposeMatrixdARB",
+   "MultTransposeMatrixfARB",
+   "MultTransposeMatrixdARB",
+   "SampleCoverageARB",
+   "DrawBuffersARB",
+   "PolygonOffsetEXT",
+   "GetTexFilterFuncSGIS",
+   "TexFilterFuncSGIS",
+   "GetHistogramEXT",
+   "GetHistogramParameterfvEXT",
+   "GetHistogramParameterivEXT",
+   "GetMinmaxEXT",
+   "GetMinmaxParameterfvEXT",
+   "GetMinmaxParameterivEXT",
+   "GetConvolutionFilterEXT",
+   "GetConvolutionParameterfvEXT",
+   "GetConvolutionParameterivEXT",
+   "GetSeparableFilterEXT",
+   "GetColorTableSGI",
+   "GetColorTableParameterfvSGI",
+   "GetColorTableParameterivSGI",
+   "PixelTexGenSGIX",
+   "PixelTexGenParameteriSGIS",
+   "PixelTexGenParameterivSGIS",
+   "PixelTexGenParameterfSGIS",
+   "PixelTexGenParameterfvSGIS",
+   "GetPixelTexGenParameterivSGIS",
+   "GetPixelTexGenParameterfvSGIS",
+   "TexImage4DSGIS",
+   "TexSubImage4DSGIS",
+   "AreTexturesResidentEXT",
+   "GenTexturesEXT",
+   "IsTextureEXT",
+   "DetailTexFuncSGIS",
+   "GetDetailTexFuncSGIS",
+   "SharpenTexFuncSGIS",
+   "GetSharpenTexFuncSGIS",
+   "SampleMaskSGIS",
+   "SamplePatternSGIS",
+   "ColorPointerEXT",
+   "EdgeFlagPointerEXT",
+   "IndexPointerEXT",
+   "NormalPointerEXT",
+   "TexCoordPointerEXT",
+   "VertexPointerEXT",
+   "SpriteParameterfSGIX",
+   "SpriteParameterfvSGIX",
+   "SpriteParameteriSGIX",
+   "SpriteParameterivSGIX",
+   "PointParameterfEXT",
+   "PointParameterfvEXT",
+   "GetInstrumentsSGIX",
+   "InstrumentsBufferSGIX",
+   "PollInstrumentsSGIX",
+   "ReadInstrumentsSGIX",
+   "StartInstrumentsSGIX",
+   "StopInstrumentsSGIX",
+   "FrameZoomSGIX",
+   "TagSampleBufferSGIX",
+   "ReferencePlaneSGIX",
+   "FlushRasterSGIX",
+   "GetListParameterfvSGIX",
+   "GetListParameterivSGIX",
+   "ListParameterfSGIX",
+   "ListParameterfvSGIX",
+   "ListParameteriSGIX",
+   "ListParameterivSGIX",
+   "FragmentColorMaterialSGIX",
+   "FragmentLightfSGIX",
+   "FragmentLightfvSGIX",
+   "FragmentLightiSGIX",
+   "FragmentLightivSGIX",
+   "FragmentLightModelfSGIX",
+   "FragmentLightModelfvSGIX",
+   "FragmentLightModeliSGIX",
+   "FragmentLightModelivSGIX",
+   "FragmentMaterialfSGIX",
+   "FragmentMaterialfvSGIX",
+   "FragmentMaterialiSGIX",
+   "FragmentMaterialivSGIX",
+   "GetFragmentLightfvSGIX",
+   "GetFragmentLightivSGIX",
+   "GetFragmentMaterialfvSGIX",
+   "GetFragmentMaterialivSGIX",
+   "LightEnviSGIX",
+   "VertexWeightfEXT",
+   "VertexWeightfvEXT",
+   "VertexWeightPointerEXT",
+   "FlushVertexArrayRangeNV",
+   "VertexArrayRangeNV",
+   "CombinerParameterfvNV",
+   "CombinerParameterfNV",
+   "CombinerParameterivNV",
+   "CombinerParameteriNV",
+   "CombinerInputNV",
+   "CombinerOutputNV",
+   "FinalCombinerInputNV",
+   "GetCombinerInputParameterfvNV",
+   "GetCombinerInputParameterivNV",
+   "GetCombinerOutputParameterfvNV",
+   "GetCombinerOutputParameterivNV",
+   "GetFinalCombinerInputParameterfvNV",
+   "GetFinalCombinerInputParameterivNV",
+   "ResizeBuffersMESA",
+   "WindowPos2dMESA",
+   "WindowPos2dvMESA",
+   "WindowPos2fMESA",
+   "WindowPos2fvMESA",
+   "WindowPos2iMESA",
+   "WindowPos2ivMESA",
+   "WindowPos2sMESA",
+   "WindowPos2svMESA",
+   "WindowPos3dMESA",
+   "WindowPos3dvMESA",
+   "WindowPos3fMESA",
+   "WindowPos3fvMESA",
+   "WindowPos3iMESA",
+   "WindowPos3ivMESA",
+   "WindowPos3sMESA",
+   "WindowPos3svMESA",
+   "WindowPos4dMESA",
+   "WindowPos4dvMESA",
+   "WindowPos4fMESA",
+   "WindowPos4fvMESA",
+   "WindowPos4iMESA",
+   "WindowPos4ivMESA",
+   "WindowPos4sMESA",
+   "WindowPos4svMESA",
+   "BlendFuncSeparateEXT",
+   "IndexMaterialEXT",
+   "IndexFuncEXT",
+   "LockArraysEXT",
+   "UnlockArraysEXT",
+   "CullParameterdvEXT",
+   "CullParameterfvEXT",
+   "HintPGI",
+   "FogCoordfEXT",
+   "FogCoordfvEXT",
+   "FogCoorddEXT",
+   "FogCoorddvEXT",
+   "FogCoordPointerEXT",
+   "GetColorTableEXT",
+   "GetColorTableParameterivEXT",
+   "GetColorTableParameterfvEXT",
+   "TbufferMask3DFX",
+   "CompressedTexImage3DARB",
+   "CompressedTexImage2DARB",
+   "CompressedTexImage1DARB",
+   "CompressedTexSubImage3DARB",
+   "CompressedTexSubImage2DARB",
+   "CompressedTexSubImage1DARB",
+   "GetCompressedTexImageARB",
+   "SecondaryColor3bEXT",
+   "SecondaryColor3bvEXT",
+   "SecondaryColor3dEXT",
+   "SecondaryColor3dvEXT",
+   "SecondaryColor3fEXT",
+   "SecondaryColor3fvEXT",
+   "SecondaryColor3iEXT",
+   "SecondaryColor3ivEXT",
+   "SecondaryColor3sEXT",
+   "SecondaryColor3svEXT",
+   "SecondaryColor3ubEXT",
+   "SecondaryColor3ubvEXT",
+   "SecondaryColor3uiEXT",
+   "SecondaryColor3uivEXT",
+   "SecondaryColor3usEXT",
+   "SecondaryColor3usvEXT",
+   "SecondaryColorPointerEXT",
+   "AreProgramsResidentNV",
+   "BindProgramNV",
+   "DeleteProgramsNV",
+   "ExecuteProgramNV",
+   "GenProgramsNV",
+   "GetProgramParameterdvNV",
+   "GetProgramParameterfvNV",
+   "GetProgramivNV",
+   "GetProgramStringNV",
+   "GetTrackMatrixivNV",
+   "GetVertexAttribdvARB",
+   "GetVertexAttribfvARB",
+   "GetVertexAttribivARB",
+   "GetVertexAttribPointervNV",
+   "IsProgramNV",
+   "LoadProgramNV",
+   "ProgramParameter4dNV",
+   "ProgramParameter4dvNV",
+   "ProgramParameter4fNV",
+   "ProgramParameter4fvNV",
+   "ProgramParameters4dvNV",
+   "ProgramParameters4fvNV",
+   "RequestResidentProgramsNV",
+   "TrackMatrixNV",
+   "VertexAttribPointerNV",
+   "VertexAttrib1dARB",
+   "VertexAttrib1dvARB",
+   "VertexAttrib1fARB",
+   "VertexAttrib1fvARB",
+   "VertexAttrib1sARB",
+   "VertexAttrib1svARB",
+   "VertexAttrib2dARB",
+   "VertexAttrib2dvARB",
+   "VertexAttrib2fARB",
+   "VertexAttrib2fvARB",
+   "VertexAttrib2sARB",
+   "VertexAttrib2svARB",
+   "VertexAttrib3dARB",
+   "VertexAttrib3dvARB",
+   "VertexAttrib3fARB",
+   "VertexAttrib3fvARB",
+   "VertexAttrib3sARB",
+   "VertexAttrib3svARB",
+   "VertexAttrib4dARB",
+   "VertexAttrib4dvARB",
+   "VertexAttrib4fARB",
+   "VertexAttrib4fvARB",
+   "VertexAttrib4sARB",
+   "VertexAttrib4svARB",
+   "VertexAttrib4NubARB",
+   "VertexAttrib4NubvARB",
+   "VertexAttribs1dvNV",
+   "VertexAttribs1fvNV",
+   "VertexAttribs1svNV",
+   "VertexAttribs2dvNV",
+   "VertexAttribs2fvNV",
+   "VertexAttribs2svNV",
+   "VertexAttribs3dvNV",
+   "VertexAttribs3fvNV",
+   "VertexAttribs3svNV",
+   "VertexAttribs4dvNV",
+   "VertexAttribs4fvNV",
+   "VertexAttribs4svNV",
+   "VertexAttribs4ubvNV",
+   "PointParameteriNV",
+   "PointParameterivNV",
+   "MultiDrawArraysEXT",
+   "MultiDrawElementsEXT",
+   "ActiveStencilFaceEXT",
+   "DeleteFencesNV",
+   "GenFencesNV",
+   "IsFenceNV",
+   "TestFenceNV",
+   "GetFenceivNV",
+   "FinishFenceNV",
+   "SetFenceNV",
+   "VertexAttrib4bvARB",
+   "VertexAttrib4ivARB",
+   "VertexAttrib4ubvARB",
+   "VertexAttrib4usvARB",
+   "VertexAttrib4uivARB",
+   "VertexAttrib4NbvARB",
+   "VertexAttrib4NsvARB",
+   "VertexAttrib4NivARB",
+   "VertexAttrib4NusvARB",
+   "VertexAttrib4NuivARB",
+   "VertexAttribPointerARB",
+   "EnableVertexAttribArrayARB",
+   "DisableVertexAttribArrayARB",
+   "ProgramStringARB",
+   "ProgramEnvParameter4dARB",
+   "ProgramEnvParameter4dvARB",
+   "ProgramEnvParameter4fARB",
+   "ProgramEnvParameter4fvARB",
+   "ProgramLocalParameter4dARB",
+   "ProgramLocalParameter4dvARB",
+   "ProgramLocalParameter4fARB",
+   "ProgramLocalParameter4fvARB",
+   "GetProgramEnvParameterdvARB",
+   "GetProgramEnvParameterfvARB",
+   "GetProgramLocalParameterdvARB",
+   "GetProgramLocalParameterfvARB",
+   "GetProgramivARB",
+   "GetProgramStringARB",
+   "ProgramNamedParameter4fNV",
+   "ProgramNamedParameter4dNV",
+   "ProgramNamedParameter4fvNV",
+   "ProgramNamedParameter4dvNV",
+   "GetProgramNamedParameterfvNV",
+   "GetProgramNamedParameterdvNV",
+   "BindBufferARB",
+   "BufferDataARB",
+   "BufferSubDataARB",
+   "DeleteBuffersARB",
+   "GenBuffersARB",
+   "GetBufferParameterivARB",
+   "GetBufferPointervARB",
+   "GetBufferSubDataARB",
+   "IsBufferARB",
+   "MapBufferARB",
+   "UnmapBufferARB",
+   "DepthBoundsEXT",
+   "GenQueriesARB",
+   "DeleteQueriesARB",
+   "IsQueryARB",
+   "BeginQueryARB",
+   "EndQueryARB",
+   "GetQueryivARB",
+   "GetQueryObjectivARB",
+   "GetQueryObjectuivARB",
+   "MultiModeDrawArraysIBM",
+   "MultiModeDrawElementsIBM",
+   "BlendEquationSeparateEXT",
+   "DeleteObjectARB",
+   "GetHandleARB",
+   "DetachObjectARB",
+   "CreateShaderObjectARB",
+   "ShaderSourceARB",
+   "CompileShaderARB",
+   "CreateProgramObjectARB",
+   "AttachObjectARB",
+   "LinkProgramARB",
+   "UseProgramObjectARB",
+   "ValidateProgramARB",
+   "Uniform1fARB",
+   "Uniform2fARB",
+   "Uniform3fARB",
+   "Uniform4fARB",
+   "Uniform1iARB",
+   "Uniform2iARB",
+   "Uniform3iARB",
+   "Uniform4iARB",
+   "Uniform1fvARB",
+   "Uniform2fvARB",
+   "Uniform3fvARB",
+   "Uniform4fvARB",
+   "Uniform1ivARB",
+   "Uniform2ivARB",
+   "Uniform3ivARB",
+   "Uniform4ivARB",
+   "UniformMatrix2fvARB",
+   "UniformMatrix3fvARB",
+   "UniformMatrix4fvARB",
+   "GetObjectParameterfvARB",
+   "GetObjectParameterivARB",
+   "GetInfoLogARB",
+   "GetAttachedObjectsARB",
+   "GetUniformLocationARB",
+   "GetActiveUniformARB",
+   "GetUniformfvARB",
+   "GetUniformivARB",
+   "GetShaderSourceARB",
+   "BindAttribLocationARB",
+   "GetActiveAttribARB",
+   "GetAttribLocationARB",
+   "GetVertexAttribdvNV",
+   "GetVertexAttribfvNV",
+   "GetVertexAttribivNV",
+   "VertexAttrib1dNV",
+   "VertexAttrib1dvNV",
+   "VertexAttrib1fNV",
+   "VertexAttrib1fvNV",
+   "VertexAttrib1sNV",
+   "VertexAttrib1svNV",
+   "VertexAttrib2dNV",
+   "VertexAttrib2dvNV",
+   "VertexAttrib2fNV",
+   "VertexAttrib2fvNV",
+   "VertexAttrib2sNV",
+   "VertexAttrib2svNV",
+   "VertexAttrib3dNV",
+   "VertexAttrib3dvNV",
+   "VertexAttrib3fNV",
+   "VertexAttrib3fvNV",
+   "VertexAttrib3sNV",
+   "VertexAttrib3svNV",
+   "VertexAttrib4dNV",
+   "VertexAttrib4dvNV",
+   "VertexAttrib4fNV",
+   "VertexAttrib4fvNV",
+   "VertexAttrib4sNV",
+   "VertexAttrib4svNV",
+   "VertexAttrib4ubNV",
+   "VertexAttrib4ubvNV",
+   "GenFragmentShadersATI",
+   "BindFragmentShaderATI",
+   "DeleteFragmentShaderATI",
+   "BeginFragmentShaderATI",
+   "EndFragmentShaderATI",
+   "PassTexCoordATI",
+   "SampleMapATI",
+   "ColorFragmentOp1ATI",
+   "ColorFragmentOp2ATI",
+   "ColorFragmentOp3ATI",
+   "AlphaFragmentOp1ATI",
+   "AlphaFragmentOp2ATI",
+   "AlphaFragmentOp3ATI",
+   "SetFragmentShaderConstantATI",
+   "IsRenderbufferEXT",
+   "BindRenderbufferEXT",
+   "DeleteRenderbuffersEXT",
+   "GenRenderbuffersEXT",
+   "RenderbufferStorageEXT",
+   "GetRenderbufferParameterivEXT",
+   "IsFramebufferEXT",
+   "BindFramebufferEXT",
+   "DeleteFramebuffersEXT",
+   "GenFramebuffersEXT",
+   "CheckFramebufferStatusEXT",
+   "FramebufferTexture1DEXT",
+   "FramebufferTexture2DEXT",
+   "FramebufferTexture3DEXT",
+   "FramebufferRenderbufferEXT",
+   "GetFramebufferAttachmentParameterivEXT",
+   "GenerateMipmapEXT",
+   "StencilFuncSeparate",
+   "StencilOpSeparate",
+   "StencilMaskSeparate",
+};
+
+#else /* REPLAY_FUNCTIONS */
+
+static void
+replay_NewList(struct replay_reader *reader)
+{
+   GLuint list;
+   GLenum mode;
+   replay_read(reader, &list, sizeof(list));
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLuint list, GLenum mode)) reader->procs[TRACE_CALL_NewList])(list, mode);
+}
+
+static void
+replay_EndList(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_EndList])();
+}
+
+static void
+replay_CallList(struct replay_reader *reader)
+{
+   GLuint list;
+   replay_read(reader, &list, sizeof(list));
+   (*(void (GLAPIENTRYP)(GLuint list)) reader->procs[TRACE_CALL_CallList])(list);
+}
+
+static void
+replay_CallLists(struct replay_reader *reader)
+{
+   GLsizei n;
+   GLenum type;
+   const GLvoid * lists;
+   replay_read(reader, &n, sizeof(n));
+   replay_read(reader, &type, sizeof(type));
+   lists = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, GLenum type, const GLvoid * lists)) reader->procs[TRACE_CALL_CallLists])(n, type, lists);
+}
+
+static void
+replay_DeleteLists(struct replay_reader *reader)
+{
+   GLuint list;
+   GLsizei range;
+   replay_read(reader, &list, sizeof(list));
+   replay_read(reader, &range, sizeof(range));
+   (*(void (GLAPIENTRYP)(GLuint list, GLsizei range)) reader->procs[TRACE_CALL_DeleteLists])(list, range);
+}
+
+static void
+replay_GenLists(struct replay_reader *reader)
+{
+   GLsizei range;
+   replay_read(reader, &range, sizeof(range));
+   (*(GLuint (GLAPIENTRYP)(GLsizei range)) reader->procs[TRACE_CALL_GenLists])(range);
+}
+
+static void
+replay_ListBase(struct replay_reader *reader)
+{
+   GLuint base;
+   replay_read(reader, &base, sizeof(base));
+   (*(void (GLAPIENTRYP)(GLuint base)) reader->procs[TRACE_CALL_ListBase])(base);
+}
+
+static void
+replay_Begin(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_Begin])(mode);
+}
+
+static void
+replay_Bitmap(struct replay_reader *reader)
+{
+   GLsizei width;
+   GLsizei height;
+   GLfloat xorig;
+   GLfloat yorig;
+   GLfloat xmove;
+   GLfloat ymove;
+   const GLubyte * bitmap;
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &xorig, sizeof(xorig));
+   replay_read(reader, &yorig, sizeof(yorig));
+   replay_read(reader, &xmove, sizeof(xmove));
+   replay_read(reader, &ymove, sizeof(ymove));
+   bitmap = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte * bitmap)) reader->procs[TRACE_CALL_Bitmap])(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+
+static void
+replay_Color3b(struct replay_reader *reader)
+{
+   GLbyte red;
+   GLbyte green;
+   GLbyte blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLbyte red, GLbyte green, GLbyte blue)) reader->procs[TRACE_CALL_Color3b])(red, green, blue);
+}
+
+static void
+replay_Color3bv(struct replay_reader *reader)
+{
+   const GLbyte * v;
+   v = (const GLbyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLbyte * v)) reader->procs[TRACE_CALL_Color3bv])(v);
+}
+
+static void
+replay_Color3d(struct replay_reader *reader)
+{
+   GLdouble red;
+   GLdouble green;
+   GLdouble blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLdouble red, GLdouble green, GLdouble blue)) reader->procs[TRACE_CALL_Color3d])(red, green, blue);
+}
+
+static void
+replay_Color3dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_Color3dv])(v);
+}
+
+static void
+replay_Color3f(struct replay_reader *reader)
+{
+   GLfloat red;
+   GLfloat green;
+   GLfloat blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLfloat red, GLfloat green, GLfloat blue)) reader->procs[TRACE_CALL_Color3f])(red, green, blue);
+}
+
+static void
+replay_Color3fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_Color3fv])(v);
+}
+
+static void
+replay_Color3i(struct replay_reader *reader)
+{
+   GLint red;
+   GLint green;
+   GLint blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLint red, GLint green, GLint blue)) reader->procs[TRACE_CALL_Color3i])(red, green, blue);
+}
+
+static void
+replay_Color3iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_Color3iv])(v);
+}
+
+static void
+replay_Color3s(struct replay_reader *reader)
+{
+   GLshort red;
+   GLshort green;
+   GLshort blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLshort red, GLshort green, GLshort blue)) reader->procs[TRACE_CALL_Color3s])(red, green, blue);
+}
+
+static void
+replay_Color3sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_Color3sv])(v);
+}
+
+static void
+replay_Color3ub(struct replay_reader *reader)
+{
+   GLubyte red;
+   GLubyte green;
+   GLubyte blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLubyte red, GLubyte green, GLubyte blue)) reader->procs[TRACE_CALL_Color3ub])(red, green, blue);
+}
+
+static void
+replay_Color3ubv(struct replay_reader *reader)
+{
+   const GLubyte * v;
+   v = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLubyte * v)) reader->procs[TRACE_CALL_Color3ubv])(v);
+}
+
+static void
+replay_Color3ui(struct replay_reader *reader)
+{
+   GLuint red;
+   GLuint green;
+   GLuint blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLuint red, GLuint green, GLuint blue)) reader->procs[TRACE_CALL_Color3ui])(red, green, blue);
+}
+
+static void
+replay_Color3uiv(struct replay_reader *reader)
+{
+   const GLuint * v;
+   v = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLuint * v)) reader->procs[TRACE_CALL_Color3uiv])(v);
+}
+
+static void
+replay_Color3us(struct replay_reader *reader)
+{
+   GLushort red;
+   GLushort green;
+   GLushort blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLushort red, GLushort green, GLushort blue)) reader->procs[TRACE_CALL_Color3us])(red, green, blue);
+}
+
+static void
+replay_Color3usv(struct replay_reader *reader)
+{
+   const GLushort * v;
+   v = (const GLushort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLushort * v)) reader->procs[TRACE_CALL_Color3usv])(v);
+}
+
+static void
+replay_Color4b(struct replay_reader *reader)
+{
+   GLbyte red;
+   GLbyte green;
+   GLbyte blue;
+   GLbyte alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)) reader->procs[TRACE_CALL_Color4b])(red, green, blue, alpha);
+}
+
+static void
+replay_Color4bv(struct replay_reader *reader)
+{
+   const GLbyte * v;
+   v = (const GLbyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLbyte * v)) reader->procs[TRACE_CALL_Color4bv])(v);
+}
+
+static void
+replay_Color4d(struct replay_reader *reader)
+{
+   GLdouble red;
+   GLdouble green;
+   GLdouble blue;
+   GLdouble alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)) reader->procs[TRACE_CALL_Color4d])(red, green, blue, alpha);
+}
+
+static void
+replay_Color4dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_Color4dv])(v);
+}
+
+static void
+replay_Color4f(struct replay_reader *reader)
+{
+   GLfloat red;
+   GLfloat green;
+   GLfloat blue;
+   GLfloat alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)) reader->procs[TRACE_CALL_Color4f])(red, green, blue, alpha);
+}
+
+static void
+replay_Color4fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_Color4fv])(v);
+}
+
+static void
+replay_Color4i(struct replay_reader *reader)
+{
+   GLint red;
+   GLint green;
+   GLint blue;
+   GLint alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLint red, GLint green, GLint blue, GLint alpha)) reader->procs[TRACE_CALL_Color4i])(red, green, blue, alpha);
+}
+
+static void
+replay_Color4iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_Color4iv])(v);
+}
+
+static void
+replay_Color4s(struct replay_reader *reader)
+{
+   GLshort red;
+   GLshort green;
+   GLshort blue;
+   GLshort alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLshort red, GLshort green, GLshort blue, GLshort alpha)) reader->procs[TRACE_CALL_Color4s])(red, green, blue, alpha);
+}
+
+static void
+replay_Color4sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_Color4sv])(v);
+}
+
+static void
+replay_Color4ub(struct replay_reader *reader)
+{
+   GLubyte red;
+   GLubyte green;
+   GLubyte blue;
+   GLubyte alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)) reader->procs[TRACE_CALL_Color4ub])(red, green, blue, alpha);
+}
+
+static void
+replay_Color4ubv(struct replay_reader *reader)
+{
+   const GLubyte * v;
+   v = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLubyte * v)) reader->procs[TRACE_CALL_Color4ubv])(v);
+}
+
+static void
+replay_Color4ui(struct replay_reader *reader)
+{
+   GLuint red;
+   GLuint green;
+   GLuint blue;
+   GLuint alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLuint red, GLuint green, GLuint blue, GLuint alpha)) reader->procs[TRACE_CALL_Color4ui])(red, green, blue, alpha);
+}
+
+static void
+replay_Color4uiv(struct replay_reader *reader)
+{
+   const GLuint * v;
+   v = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLuint * v)) reader->procs[TRACE_CALL_Color4uiv])(v);
+}
+
+static void
+replay_Color4us(struct replay_reader *reader)
+{
+   GLushort red;
+   GLushort green;
+   GLushort blue;
+   GLushort alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLushort red, GLushort green, GLushort blue, GLushort alpha)) reader->procs[TRACE_CALL_Color4us])(red, green, blue, alpha);
+}
+
+static void
+replay_Color4usv(struct replay_reader *reader)
+{
+   const GLushort * v;
+   v = (const GLushort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLushort * v)) reader->procs[TRACE_CALL_Color4usv])(v);
+}
+
+static void
+replay_EdgeFlag(struct replay_reader *reader)
+{
+   GLboolean flag;
+   replay_read(reader, &flag, sizeof(flag));
+   (*(void (GLAPIENTRYP)(GLboolean flag)) reader->procs[TRACE_CALL_EdgeFlag])(flag);
+}
+
+static void
+replay_EdgeFlagv(struct replay_reader *reader)
+{
+   const GLboolean * flag;
+   flag = (const GLboolean *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLboolean * flag)) reader->procs[TRACE_CALL_EdgeFlagv])(flag);
+}
+
+static void
+replay_End(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_End])();
+}
+
+static void
+replay_Indexd(struct replay_reader *reader)
+{
+   GLdouble c;
+   replay_read(reader, &c, sizeof(c));
+   (*(void (GLAPIENTRYP)(GLdouble c)) reader->procs[TRACE_CALL_Indexd])(c);
+}
+
+static void
+replay_Indexdv(struct replay_reader *reader)
+{
+   const GLdouble * c;
+   c = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * c)) reader->procs[TRACE_CALL_Indexdv])(c);
+}
+
+static void
+replay_Indexf(struct replay_reader *reader)
+{
+   GLfloat c;
+   replay_read(reader, &c, sizeof(c));
+   (*(void (GLAPIENTRYP)(GLfloat c)) reader->procs[TRACE_CALL_Indexf])(c);
+}
+
+static void
+replay_Indexfv(struct replay_reader *reader)
+{
+   const GLfloat * c;
+   c = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * c)) reader->procs[TRACE_CALL_Indexfv])(c);
+}
+
+static void
+replay_Indexi(struct replay_reader *reader)
+{
+   GLint c;
+   replay_read(reader, &c, sizeof(c));
+   (*(void (GLAPIENTRYP)(GLint c)) reader->procs[TRACE_CALL_Indexi])(c);
+}
+
+static void
+replay_Indexiv(struct replay_reader *reader)
+{
+   const GLint * c;
+   c = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * c)) reader->procs[TRACE_CALL_Indexiv])(c);
+}
+
+static void
+replay_Indexs(struct replay_reader *reader)
+{
+   GLshort c;
+   replay_read(reader, &c, sizeof(c));
+   (*(void (GLAPIENTRYP)(GLshort c)) reader->procs[TRACE_CALL_Indexs])(c);
+}
+
+static void
+replay_Indexsv(struct replay_reader *reader)
+{
+   const GLshort * c;
+   c = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * c)) reader->procs[TRACE_CALL_Indexsv])(c);
+}
+
+static void
+replay_Normal3b(struct replay_reader *reader)
+{
+   GLbyte nx;
+   GLbyte ny;
+   GLbyte nz;
+   replay_read(reader, &nx, sizeof(nx));
+   replay_read(reader, &ny, sizeof(ny));
+   replay_read(reader, &nz, sizeof(nz));
+   (*(void (GLAPIENTRYP)(GLbyte nx, GLbyte ny, GLbyte nz)) reader->procs[TRACE_CALL_Normal3b])(nx, ny, nz);
+}
+
+static void
+replay_Normal3bv(struct replay_reader *reader)
+{
+   const GLbyte * v;
+   v = (const GLbyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLbyte * v)) reader->procs[TRACE_CALL_Normal3bv])(v);
+}
+
+static void
+replay_Normal3d(struct replay_reader *reader)
+{
+   GLdouble nx;
+   GLdouble ny;
+   GLdouble nz;
+   replay_read(reader, &nx, sizeof(nx));
+   replay_read(reader, &ny, sizeof(ny));
+   replay_read(reader, &nz, sizeof(nz));
+   (*(void (GLAPIENTRYP)(GLdouble nx, GLdouble ny, GLdouble nz)) reader->procs[TRACE_CALL_Normal3d])(nx, ny, nz);
+}
+
+static void
+replay_Normal3dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_Normal3dv])(v);
+}
+
+static void
+replay_Normal3f(struct replay_reader *reader)
+{
+   GLfloat nx;
+   GLfloat ny;
+   GLfloat nz;
+   replay_read(reader, &nx, sizeof(nx));
+   replay_read(reader, &ny, sizeof(ny));
+   replay_read(reader, &nz, sizeof(nz));
+   (*(void (GLAPIENTRYP)(GLfloat nx, GLfloat ny, GLfloat nz)) reader->procs[TRACE_CALL_Normal3f])(nx, ny, nz);
+}
+
+static void
+replay_Normal3fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_Normal3fv])(v);
+}
+
+static void
+replay_Normal3i(struct replay_reader *reader)
+{
+   GLint nx;
+   GLint ny;
+   GLint nz;
+   replay_read(reader, &nx, sizeof(nx));
+   replay_read(reader, &ny, sizeof(ny));
+   replay_read(reader, &nz, sizeof(nz));
+   (*(void (GLAPIENTRYP)(GLint nx, GLint ny, GLint nz)) reader->procs[TRACE_CALL_Normal3i])(nx, ny, nz);
+}
+
+static void
+replay_Normal3iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_Normal3iv])(v);
+}
+
+static void
+replay_Normal3s(struct replay_reader *reader)
+{
+   GLshort nx;
+   GLshort ny;
+   GLshort nz;
+   replay_read(reader, &nx, sizeof(nx));
+   replay_read(reader, &ny, sizeof(ny));
+   replay_read(reader, &nz, sizeof(nz));
+   (*(void (GLAPIENTRYP)(GLshort nx, GLshort ny, GLshort nz)) reader->procs[TRACE_CALL_Normal3s])(nx, ny, nz);
+}
+
+static void
+replay_Normal3sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_Normal3sv])(v);
+}
+
+static void
+replay_RasterPos2d(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y)) reader->procs[TRACE_CALL_RasterPos2d])(x, y);
+}
+
+static void
+replay_RasterPos2dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_RasterPos2dv])(v);
+}
+
+static void
+replay_RasterPos2f(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y)) reader->procs[TRACE_CALL_RasterPos2f])(x, y);
+}
+
+static void
+replay_RasterPos2fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_RasterPos2fv])(v);
+}
+
+static void
+replay_RasterPos2i(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y)) reader->procs[TRACE_CALL_RasterPos2i])(x, y);
+}
+
+static void
+replay_RasterPos2iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_RasterPos2iv])(v);
+}
+
+static void
+replay_RasterPos2s(struct replay_reader *reader)
+{
+   GLshort x;
+   GLshort y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLshort x, GLshort y)) reader->procs[TRACE_CALL_RasterPos2s])(x, y);
+}
+
+static void
+replay_RasterPos2sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_RasterPos2sv])(v);
+}
+
+static void
+replay_RasterPos3d(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y, GLdouble z)) reader->procs[TRACE_CALL_RasterPos3d])(x, y, z);
+}
+
+static void
+replay_RasterPos3dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_RasterPos3dv])(v);
+}
+
+static void
+replay_RasterPos3f(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y, GLfloat z)) reader->procs[TRACE_CALL_RasterPos3f])(x, y, z);
+}
+
+static void
+replay_RasterPos3fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_RasterPos3fv])(v);
+}
+
+static void
+replay_RasterPos3i(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLint z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLint z)) reader->procs[TRACE_CALL_RasterPos3i])(x, y, z);
+}
+
+static void
+replay_RasterPos3iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_RasterPos3iv])(v);
+}
+
+static void
+replay_RasterPos3s(struct replay_reader *reader)
+{
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLshort x, GLshort y, GLshort z)) reader->procs[TRACE_CALL_RasterPos3s])(x, y, z);
+}
+
+static void
+replay_RasterPos3sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_RasterPos3sv])(v);
+}
+
+static void
+replay_RasterPos4d(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y, GLdouble z, GLdouble w)) reader->procs[TRACE_CALL_RasterPos4d])(x, y, z, w);
+}
+
+static void
+replay_RasterPos4dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_RasterPos4dv])(v);
+}
+
+static void
+replay_RasterPos4f(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y, GLfloat z, GLfloat w)) reader->procs[TRACE_CALL_RasterPos4f])(x, y, z, w);
+}
+
+static void
+replay_RasterPos4fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_RasterPos4fv])(v);
+}
+
+static void
+replay_RasterPos4i(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLint z;
+   GLint w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLint z, GLint w)) reader->procs[TRACE_CALL_RasterPos4i])(x, y, z, w);
+}
+
+static void
+replay_RasterPos4iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_RasterPos4iv])(v);
+}
+
+static void
+replay_RasterPos4s(struct replay_reader *reader)
+{
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLshort x, GLshort y, GLshort z, GLshort w)) reader->procs[TRACE_CALL_RasterPos4s])(x, y, z, w);
+}
+
+static void
+replay_RasterPos4sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_RasterPos4sv])(v);
+}
+
+static void
+replay_Rectd(struct replay_reader *reader)
+{
+   GLdouble x1;
+   GLdouble y1;
+   GLdouble x2;
+   GLdouble y2;
+   replay_read(reader, &x1, sizeof(x1));
+   replay_read(reader, &y1, sizeof(y1));
+   replay_read(reader, &x2, sizeof(x2));
+   replay_read(reader, &y2, sizeof(y2));
+   (*(void (GLAPIENTRYP)(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)) reader->procs[TRACE_CALL_Rectd])(x1, y1, x2, y2);
+}
+
+static void
+replay_Rectdv(struct replay_reader *reader)
+{
+   const GLdouble * v1;
+   const GLdouble * v2;
+   v1 = (const GLdouble *) replay_array(reader);
+   v2 = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v1, const GLdouble * v2)) reader->procs[TRACE_CALL_Rectdv])(v1, v2);
+}
+
+static void
+replay_Rectf(struct replay_reader *reader)
+{
+   GLfloat x1;
+   GLfloat y1;
+   GLfloat x2;
+   GLfloat y2;
+   replay_read(reader, &x1, sizeof(x1));
+   replay_read(reader, &y1, sizeof(y1));
+   replay_read(reader, &x2, sizeof(x2));
+   replay_read(reader, &y2, sizeof(y2));
+   (*(void (GLAPIENTRYP)(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)) reader->procs[TRACE_CALL_Rectf])(x1, y1, x2, y2);
+}
+
+static void
+replay_Rectfv(struct replay_reader *reader)
+{
+   const GLfloat * v1;
+   const GLfloat * v2;
+   v1 = (const GLfloat *) replay_array(reader);
+   v2 = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v1, const GLfloat * v2)) reader->procs[TRACE_CALL_Rectfv])(v1, v2);
+}
+
+static void
+replay_Recti(struct replay_reader *reader)
+{
+   GLint x1;
+   GLint y1;
+   GLint x2;
+   GLint y2;
+   replay_read(reader, &x1, sizeof(x1));
+   replay_read(reader, &y1, sizeof(y1));
+   replay_read(reader, &x2, sizeof(x2));
+   replay_read(reader, &y2, sizeof(y2));
+   (*(void (GLAPIENTRYP)(GLint x1, GLint y1, GLint x2, GLint y2)) reader->procs[TRACE_CALL_Recti])(x1, y1, x2, y2);
+}
+
+static void
+replay_Rectiv(struct replay_reader *reader)
+{
+   const GLint * v1;
+   const GLint * v2;
+   v1 = (const GLint *) replay_array(reader);
+   v2 = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v1, const GLint * v2)) reader->procs[TRACE_CALL_Rectiv])(v1, v2);
+}
+
+static void
+replay_Rects(struct replay_reader *reader)
+{
+   GLshort x1;
+   GLshort y1;
+   GLshort x2;
+   GLshort y2;
+   replay_read(reader, &x1, sizeof(x1));
+   replay_read(reader, &y1, sizeof(y1));
+   replay_read(reader, &x2, sizeof(x2));
+   replay_read(reader, &y2, sizeof(y2));
+   (*(void (GLAPIENTRYP)(GLshort x1, GLshort y1, GLshort x2, GLshort y2)) reader->procs[TRACE_CALL_Rects])(x1, y1, x2, y2);
+}
+
+static void
+replay_Rectsv(struct replay_reader *reader)
+{
+   const GLshort * v1;
+   const GLshort * v2;
+   v1 = (const GLshort *) replay_array(reader);
+   v2 = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v1, const GLshort * v2)) reader->procs[TRACE_CALL_Rectsv])(v1, v2);
+}
+
+static void
+replay_TexCoord1d(struct replay_reader *reader)
+{
+   GLdouble s;
+   replay_read(reader, &s, sizeof(s));
+   (*(void (GLAPIENTRYP)(GLdouble s)) reader->procs[TRACE_CALL_TexCoord1d])(s);
+}
+
+static void
+replay_TexCoord1dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_TexCoord1dv])(v);
+}
+
+static void
+replay_TexCoord1f(struct replay_reader *reader)
+{
+   GLfloat s;
+   replay_read(reader, &s, sizeof(s));
+   (*(void (GLAPIENTRYP)(GLfloat s)) reader->procs[TRACE_CALL_TexCoord1f])(s);
+}
+
+static void
+replay_TexCoord1fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_TexCoord1fv])(v);
+}
+
+static void
+replay_TexCoord1i(struct replay_reader *reader)
+{
+   GLint s;
+   replay_read(reader, &s, sizeof(s));
+   (*(void (GLAPIENTRYP)(GLint s)) reader->procs[TRACE_CALL_TexCoord1i])(s);
+}
+
+static void
+replay_TexCoord1iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_TexCoord1iv])(v);
+}
+
+static void
+replay_TexCoord1s(struct replay_reader *reader)
+{
+   GLshort s;
+   replay_read(reader, &s, sizeof(s));
+   (*(void (GLAPIENTRYP)(GLshort s)) reader->procs[TRACE_CALL_TexCoord1s])(s);
+}
+
+static void
+replay_TexCoord1sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_TexCoord1sv])(v);
+}
+
+static void
+replay_TexCoord2d(struct replay_reader *reader)
+{
+   GLdouble s;
+   GLdouble t;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   (*(void (GLAPIENTRYP)(GLdouble s, GLdouble t)) reader->procs[TRACE_CALL_TexCoord2d])(s, t);
+}
+
+static void
+replay_TexCoord2dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_TexCoord2dv])(v);
+}
+
+static void
+replay_TexCoord2f(struct replay_reader *reader)
+{
+   GLfloat s;
+   GLfloat t;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   (*(void (GLAPIENTRYP)(GLfloat s, GLfloat t)) reader->procs[TRACE_CALL_TexCoord2f])(s, t);
+}
+
+static void
+replay_TexCoord2fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_TexCoord2fv])(v);
+}
+
+static void
+replay_TexCoord2i(struct replay_reader *reader)
+{
+   GLint s;
+   GLint t;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   (*(void (GLAPIENTRYP)(GLint s, GLint t)) reader->procs[TRACE_CALL_TexCoord2i])(s, t);
+}
+
+static void
+replay_TexCoord2iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_TexCoord2iv])(v);
+}
+
+static void
+replay_TexCoord2s(struct replay_reader *reader)
+{
+   GLshort s;
+   GLshort t;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   (*(void (GLAPIENTRYP)(GLshort s, GLshort t)) reader->procs[TRACE_CALL_TexCoord2s])(s, t);
+}
+
+static void
+replay_TexCoord2sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_TexCoord2sv])(v);
+}
+
+static void
+replay_TexCoord3d(struct replay_reader *reader)
+{
+   GLdouble s;
+   GLdouble t;
+   GLdouble r;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   (*(void (GLAPIENTRYP)(GLdouble s, GLdouble t, GLdouble r)) reader->procs[TRACE_CALL_TexCoord3d])(s, t, r);
+}
+
+static void
+replay_TexCoord3dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_TexCoord3dv])(v);
+}
+
+static void
+replay_TexCoord3f(struct replay_reader *reader)
+{
+   GLfloat s;
+   GLfloat t;
+   GLfloat r;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   (*(void (GLAPIENTRYP)(GLfloat s, GLfloat t, GLfloat r)) reader->procs[TRACE_CALL_TexCoord3f])(s, t, r);
+}
+
+static void
+replay_TexCoord3fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_TexCoord3fv])(v);
+}
+
+static void
+replay_TexCoord3i(struct replay_reader *reader)
+{
+   GLint s;
+   GLint t;
+   GLint r;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   (*(void (GLAPIENTRYP)(GLint s, GLint t, GLint r)) reader->procs[TRACE_CALL_TexCoord3i])(s, t, r);
+}
+
+static void
+replay_TexCoord3iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_TexCoord3iv])(v);
+}
+
+static void
+replay_TexCoord3s(struct replay_reader *reader)
+{
+   GLshort s;
+   GLshort t;
+   GLshort r;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   (*(void (GLAPIENTRYP)(GLshort s, GLshort t, GLshort r)) reader->procs[TRACE_CALL_TexCoord3s])(s, t, r);
+}
+
+static void
+replay_TexCoord3sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_TexCoord3sv])(v);
+}
+
+static void
+replay_TexCoord4d(struct replay_reader *reader)
+{
+   GLdouble s;
+   GLdouble t;
+   GLdouble r;
+   GLdouble q;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   replay_read(reader, &q, sizeof(q));
+   (*(void (GLAPIENTRYP)(GLdouble s, GLdouble t, GLdouble r, GLdouble q)) reader->procs[TRACE_CALL_TexCoord4d])(s, t, r, q);
+}
+
+static void
+replay_TexCoord4dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_TexCoord4dv])(v);
+}
+
+static void
+replay_TexCoord4f(struct replay_reader *reader)
+{
+   GLfloat s;
+   GLfloat t;
+   GLfloat r;
+   GLfloat q;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   replay_read(reader, &q, sizeof(q));
+   (*(void (GLAPIENTRYP)(GLfloat s, GLfloat t, GLfloat r, GLfloat q)) reader->procs[TRACE_CALL_TexCoord4f])(s, t, r, q);
+}
+
+static void
+replay_TexCoord4fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_TexCoord4fv])(v);
+}
+
+static void
+replay_TexCoord4i(struct replay_reader *reader)
+{
+   GLint s;
+   GLint t;
+   GLint r;
+   GLint q;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   replay_read(reader, &q, sizeof(q));
+   (*(void (GLAPIENTRYP)(GLint s, GLint t, GLint r, GLint q)) reader->procs[TRACE_CALL_TexCoord4i])(s, t, r, q);
+}
+
+static void
+replay_TexCoord4iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_TexCoord4iv])(v);
+}
+
+static void
+replay_TexCoord4s(struct replay_reader *reader)
+{
+   GLshort s;
+   GLshort t;
+   GLshort r;
+   GLshort q;
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   replay_read(reader, &q, sizeof(q));
+   (*(void (GLAPIENTRYP)(GLshort s, GLshort t, GLshort r, GLshort q)) reader->procs[TRACE_CALL_TexCoord4s])(s, t, r, q);
+}
+
+static void
+replay_TexCoord4sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_TexCoord4sv])(v);
+}
+
+static void
+replay_Vertex2d(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y)) reader->procs[TRACE_CALL_Vertex2d])(x, y);
+}
+
+static void
+replay_Vertex2dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_Vertex2dv])(v);
+}
+
+static void
+replay_Vertex2f(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y)) reader->procs[TRACE_CALL_Vertex2f])(x, y);
+}
+
+static void
+replay_Vertex2fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_Vertex2fv])(v);
+}
+
+static void
+replay_Vertex2i(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y)) reader->procs[TRACE_CALL_Vertex2i])(x, y);
+}
+
+static void
+replay_Vertex2iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_Vertex2iv])(v);
+}
+
+static void
+replay_Vertex2s(struct replay_reader *reader)
+{
+   GLshort x;
+   GLshort y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLshort x, GLshort y)) reader->procs[TRACE_CALL_Vertex2s])(x, y);
+}
+
+static void
+replay_Vertex2sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_Vertex2sv])(v);
+}
+
+static void
+replay_Vertex3d(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y, GLdouble z)) reader->procs[TRACE_CALL_Vertex3d])(x, y, z);
+}
+
+static void
+replay_Vertex3dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_Vertex3dv])(v);
+}
+
+static void
+replay_Vertex3f(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y, GLfloat z)) reader->procs[TRACE_CALL_Vertex3f])(x, y, z);
+}
+
+static void
+replay_Vertex3fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_Vertex3fv])(v);
+}
+
+static void
+replay_Vertex3i(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLint z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLint z)) reader->procs[TRACE_CALL_Vertex3i])(x, y, z);
+}
+
+static void
+replay_Vertex3iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_Vertex3iv])(v);
+}
+
+static void
+replay_Vertex3s(struct replay_reader *reader)
+{
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLshort x, GLshort y, GLshort z)) reader->procs[TRACE_CALL_Vertex3s])(x, y, z);
+}
+
+static void
+replay_Vertex3sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_Vertex3sv])(v);
+}
+
+static void
+replay_Vertex4d(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y, GLdouble z, GLdouble w)) reader->procs[TRACE_CALL_Vertex4d])(x, y, z, w);
+}
+
+static void
+replay_Vertex4dv(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_Vertex4dv])(v);
+}
+
+static void
+replay_Vertex4f(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y, GLfloat z, GLfloat w)) reader->procs[TRACE_CALL_Vertex4f])(x, y, z, w);
+}
+
+static void
+replay_Vertex4fv(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_Vertex4fv])(v);
+}
+
+static void
+replay_Vertex4i(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLint z;
+   GLint w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLint z, GLint w)) reader->procs[TRACE_CALL_Vertex4i])(x, y, z, w);
+}
+
+static void
+replay_Vertex4iv(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_Vertex4iv])(v);
+}
+
+static void
+replay_Vertex4s(struct replay_reader *reader)
+{
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLshort x, GLshort y, GLshort z, GLshort w)) reader->procs[TRACE_CALL_Vertex4s])(x, y, z, w);
+}
+
+static void
+replay_Vertex4sv(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_Vertex4sv])(v);
+}
+
+static void
+replay_ClipPlane(struct replay_reader *reader)
+{
+   GLenum plane;
+   const GLdouble * equation;
+   replay_read(reader, &plane, sizeof(plane));
+   equation = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum plane, const GLdouble * equation)) reader->procs[TRACE_CALL_ClipPlane])(plane, equation);
+}
+
+static void
+replay_ColorMaterial(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum mode;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum mode)) reader->procs[TRACE_CALL_ColorMaterial])(face, mode);
+}
+
+static void
+replay_CullFace(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_CullFace])(mode);
+}
+
+static void
+replay_Fogf(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_Fogf])(pname, param);
+}
+
+static void
+replay_Fogfv(struct replay_reader *reader)
+{
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_Fogfv])(pname, params);
+}
+
+static void
+replay_Fogi(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_Fogi])(pname, param);
+}
+
+static void
+replay_Fogiv(struct replay_reader *reader)
+{
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_Fogiv])(pname, params);
+}
+
+static void
+replay_FrontFace(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_FrontFace])(mode);
+}
+
+static void
+replay_Hint(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum mode;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum mode)) reader->procs[TRACE_CALL_Hint])(target, mode);
+}
+
+static void
+replay_Lightf(struct replay_reader *reader)
+{
+   GLenum light;
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &light, sizeof(light));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum light, GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_Lightf])(light, pname, param);
+}
+
+static void
+replay_Lightfv(struct replay_reader *reader)
+{
+   GLenum light;
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &light, sizeof(light));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum light, GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_Lightfv])(light, pname, params);
+}
+
+static void
+replay_Lighti(struct replay_reader *reader)
+{
+   GLenum light;
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &light, sizeof(light));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum light, GLenum pname, GLint param)) reader->procs[TRACE_CALL_Lighti])(light, pname, param);
+}
+
+static void
+replay_Lightiv(struct replay_reader *reader)
+{
+   GLenum light;
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &light, sizeof(light));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum light, GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_Lightiv])(light, pname, params);
+}
+
+static void
+replay_LightModelf(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_LightModelf])(pname, param);
+}
+
+static void
+replay_LightModelfv(struct replay_reader *reader)
+{
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_LightModelfv])(pname, params);
+}
+
+static void
+replay_LightModeli(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_LightModeli])(pname, param);
+}
+
+static void
+replay_LightModeliv(struct replay_reader *reader)
+{
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_LightModeliv])(pname, params);
+}
+
+static void
+replay_LineStipple(struct replay_reader *reader)
+{
+   GLint factor;
+   GLushort pattern;
+   replay_read(reader, &factor, sizeof(factor));
+   replay_read(reader, &pattern, sizeof(pattern));
+   (*(void (GLAPIENTRYP)(GLint factor, GLushort pattern)) reader->procs[TRACE_CALL_LineStipple])(factor, pattern);
+}
+
+static void
+replay_LineWidth(struct replay_reader *reader)
+{
+   GLfloat width;
+   replay_read(reader, &width, sizeof(width));
+   (*(void (GLAPIENTRYP)(GLfloat width)) reader->procs[TRACE_CALL_LineWidth])(width);
+}
+
+static void
+replay_Materialf(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_Materialf])(face, pname, param);
+}
+
+static void
+replay_Materialfv(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_Materialfv])(face, pname, params);
+}
+
+static void
+replay_Materiali(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum pname, GLint param)) reader->procs[TRACE_CALL_Materiali])(face, pname, param);
+}
+
+static void
+replay_Materialiv(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_Materialiv])(face, pname, params);
+}
+
+static void
+replay_PointSize(struct replay_reader *reader)
+{
+   GLfloat size;
+   replay_read(reader, &size, sizeof(size));
+   (*(void (GLAPIENTRYP)(GLfloat size)) reader->procs[TRACE_CALL_PointSize])(size);
+}
+
+static void
+replay_PolygonMode(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum mode;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum mode)) reader->procs[TRACE_CALL_PolygonMode])(face, mode);
+}
+
+static void
+replay_PolygonStipple(struct replay_reader *reader)
+{
+   const GLubyte * mask;
+   mask = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLubyte * mask)) reader->procs[TRACE_CALL_PolygonStipple])(mask);
+}
+
+static void
+replay_Scissor(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLsizei width, GLsizei height)) reader->procs[TRACE_CALL_Scissor])(x, y, width, height);
+}
+
+static void
+replay_ShadeModel(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_ShadeModel])(mode);
+}
+
+static void
+replay_TexParameterf(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_TexParameterf])(target, pname, param);
+}
+
+static void
+replay_TexParameterfv(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_TexParameterfv])(target, pname, params);
+}
+
+static void
+replay_TexParameteri(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, GLint param)) reader->procs[TRACE_CALL_TexParameteri])(target, pname, param);
+}
+
+static void
+replay_TexParameteriv(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_TexParameteriv])(target, pname, params);
+}
+
+static void
+replay_TexImage1D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint internalformat;
+   GLsizei width;
+   GLint border;
+   GLenum format;
+   GLenum type;
+   const GLvoid * pixels;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &border, sizeof(border));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   pixels = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid * pixels)) reader->procs[TRACE_CALL_TexImage1D])(target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void
+replay_TexImage2D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint internalformat;
+   GLsizei width;
+   GLsizei height;
+   GLint border;
+   GLenum format;
+   GLenum type;
+   const GLvoid * pixels;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &border, sizeof(border));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   pixels = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels)) reader->procs[TRACE_CALL_TexImage2D])(target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void
+replay_TexEnvf(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_TexEnvf])(target, pname, param);
+}
+
+static void
+replay_TexEnvfv(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_TexEnvfv])(target, pname, params);
+}
+
+static void
+replay_TexEnvi(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, GLint param)) reader->procs[TRACE_CALL_TexEnvi])(target, pname, param);
+}
+
+static void
+replay_TexEnviv(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_TexEnviv])(target, pname, params);
+}
+
+static void
+replay_TexGend(struct replay_reader *reader)
+{
+   GLenum coord;
+   GLenum pname;
+   GLdouble param;
+   replay_read(reader, &coord, sizeof(coord));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum coord, GLenum pname, GLdouble param)) reader->procs[TRACE_CALL_TexGend])(coord, pname, param);
+}
+
+static void
+replay_TexGendv(struct replay_reader *reader)
+{
+   GLenum coord;
+   GLenum pname;
+   const GLdouble * params;
+   replay_read(reader, &coord, sizeof(coord));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum coord, GLenum pname, const GLdouble * params)) reader->procs[TRACE_CALL_TexGendv])(coord, pname, params);
+}
+
+static void
+replay_TexGenf(struct replay_reader *reader)
+{
+   GLenum coord;
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &coord, sizeof(coord));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum coord, GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_TexGenf])(coord, pname, param);
+}
+
+static void
+replay_TexGenfv(struct replay_reader *reader)
+{
+   GLenum coord;
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &coord, sizeof(coord));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum coord, GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_TexGenfv])(coord, pname, params);
+}
+
+static void
+replay_TexGeni(struct replay_reader *reader)
+{
+   GLenum coord;
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &coord, sizeof(coord));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum coord, GLenum pname, GLint param)) reader->procs[TRACE_CALL_TexGeni])(coord, pname, param);
+}
+
+static void
+replay_TexGeniv(struct replay_reader *reader)
+{
+   GLenum coord;
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &coord, sizeof(coord));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum coord, GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_TexGeniv])(coord, pname, params);
+}
+
+static void
+replay_FeedbackBuffer(struct replay_reader *reader)
+{
+   GLsizei size;
+   GLenum type;
+   GLfloat * buffer;
+   replay_read(reader, &size, sizeof(size));
+   replay_read(reader, &type, sizeof(type));
+   buffer = (GLfloat *) replay_output_keep(reader);
+   (*(void (GLAPIENTRYP)(GLsizei size, GLenum type, GLfloat * buffer)) reader->procs[TRACE_CALL_FeedbackBuffer])(size, type, buffer);
+}
+
+static void
+replay_SelectBuffer(struct replay_reader *reader)
+{
+   GLsizei size;
+   GLuint * buffer;
+   replay_read(reader, &size, sizeof(size));
+   buffer = (GLuint *) replay_output_keep(reader);
+   (*(void (GLAPIENTRYP)(GLsizei size, GLuint * buffer)) reader->procs[TRACE_CALL_SelectBuffer])(size, buffer);
+}
+
+static void
+replay_RenderMode(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(GLint (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_RenderMode])(mode);
+}
+
+static void
+replay_InitNames(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_InitNames])();
+}
+
+static void
+replay_LoadName(struct replay_reader *reader)
+{
+   GLuint name;
+   replay_read(reader, &name, sizeof(name));
+   (*(void (GLAPIENTRYP)(GLuint name)) reader->procs[TRACE_CALL_LoadName])(name);
+}
+
+static void
+replay_PassThrough(struct replay_reader *reader)
+{
+   GLfloat token;
+   replay_read(reader, &token, sizeof(token));
+   (*(void (GLAPIENTRYP)(GLfloat token)) reader->procs[TRACE_CALL_PassThrough])(token);
+}
+
+static void
+replay_PopName(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_PopName])();
+}
+
+static void
+replay_PushName(struct replay_reader *reader)
+{
+   GLuint name;
+   replay_read(reader, &name, sizeof(name));
+   (*(void (GLAPIENTRYP)(GLuint name)) reader->procs[TRACE_CALL_PushName])(name);
+}
+
+static void
+replay_DrawBuffer(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_DrawBuffer])(mode);
+}
+
+static void
+replay_Clear(struct replay_reader *reader)
+{
+   GLbitfield mask;
+   replay_read(reader, &mask, sizeof(mask));
+   (*(void (GLAPIENTRYP)(GLbitfield mask)) reader->procs[TRACE_CALL_Clear])(mask);
+}
+
+static void
+replay_ClearAccum(struct replay_reader *reader)
+{
+   GLfloat red;
+   GLfloat green;
+   GLfloat blue;
+   GLfloat alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)) reader->procs[TRACE_CALL_ClearAccum])(red, green, blue, alpha);
+}
+
+static void
+replay_ClearIndex(struct replay_reader *reader)
+{
+   GLfloat c;
+   replay_read(reader, &c, sizeof(c));
+   (*(void (GLAPIENTRYP)(GLfloat c)) reader->procs[TRACE_CALL_ClearIndex])(c);
+}
+
+static void
+replay_ClearColor(struct replay_reader *reader)
+{
+   GLclampf red;
+   GLclampf green;
+   GLclampf blue;
+   GLclampf alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)) reader->procs[TRACE_CALL_ClearColor])(red, green, blue, alpha);
+}
+
+static void
+replay_ClearStencil(struct replay_reader *reader)
+{
+   GLint s;
+   replay_read(reader, &s, sizeof(s));
+   (*(void (GLAPIENTRYP)(GLint s)) reader->procs[TRACE_CALL_ClearStencil])(s);
+}
+
+static void
+replay_ClearDepth(struct replay_reader *reader)
+{
+   GLclampd depth;
+   replay_read(reader, &depth, sizeof(depth));
+   (*(void (GLAPIENTRYP)(GLclampd depth)) reader->procs[TRACE_CALL_ClearDepth])(depth);
+}
+
+static void
+replay_StencilMask(struct replay_reader *reader)
+{
+   GLuint mask;
+   replay_read(reader, &mask, sizeof(mask));
+   (*(void (GLAPIENTRYP)(GLuint mask)) reader->procs[TRACE_CALL_StencilMask])(mask);
+}
+
+static void
+replay_ColorMask(struct replay_reader *reader)
+{
+   GLboolean red;
+   GLboolean green;
+   GLboolean blue;
+   GLboolean alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)) reader->procs[TRACE_CALL_ColorMask])(red, green, blue, alpha);
+}
+
+static void
+replay_DepthMask(struct replay_reader *reader)
+{
+   GLboolean flag;
+   replay_read(reader, &flag, sizeof(flag));
+   (*(void (GLAPIENTRYP)(GLboolean flag)) reader->procs[TRACE_CALL_DepthMask])(flag);
+}
+
+static void
+replay_IndexMask(struct replay_reader *reader)
+{
+   GLuint mask;
+   replay_read(reader, &mask, sizeof(mask));
+   (*(void (GLAPIENTRYP)(GLuint mask)) reader->procs[TRACE_CALL_IndexMask])(mask);
+}
+
+static void
+replay_Accum(struct replay_reader *reader)
+{
+   GLenum op;
+   GLfloat value;
+   replay_read(reader, &op, sizeof(op));
+   replay_read(reader, &value, sizeof(value));
+   (*(void (GLAPIENTRYP)(GLenum op, GLfloat value)) reader->procs[TRACE_CALL_Accum])(op, value);
+}
+
+static void
+replay_Disable(struct replay_reader *reader)
+{
+   GLenum cap;
+   replay_read(reader, &cap, sizeof(cap));
+   (*(void (GLAPIENTRYP)(GLenum cap)) reader->procs[TRACE_CALL_Disable])(cap);
+}
+
+static void
+replay_Enable(struct replay_reader *reader)
+{
+   GLenum cap;
+   replay_read(reader, &cap, sizeof(cap));
+   (*(void (GLAPIENTRYP)(GLenum cap)) reader->procs[TRACE_CALL_Enable])(cap);
+}
+
+static void
+replay_Finish(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_Finish])();
+}
+
+static void
+replay_Flush(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_Flush])();
+}
+
+static void
+replay_PopAttrib(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_PopAttrib])();
+}
+
+static void
+replay_PushAttrib(struct replay_reader *reader)
+{
+   GLbitfield mask;
+   replay_read(reader, &mask, sizeof(mask));
+   (*(void (GLAPIENTRYP)(GLbitfield mask)) reader->procs[TRACE_CALL_PushAttrib])(mask);
+}
+
+static void
+replay_Map1d(struct replay_reader *reader)
+{
+   GLenum target;
+   GLdouble u1;
+   GLdouble u2;
+   GLint stride;
+   GLint order;
+   const GLdouble * points;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &u1, sizeof(u1));
+   replay_read(reader, &u2, sizeof(u2));
+   replay_read(reader, &stride, sizeof(stride));
+   replay_read(reader, &order, sizeof(order));
+   points = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble * points)) reader->procs[TRACE_CALL_Map1d])(target, u1, u2, stride, order, points);
+}
+
+static void
+replay_Map1f(struct replay_reader *reader)
+{
+   GLenum target;
+   GLfloat u1;
+   GLfloat u2;
+   GLint stride;
+   GLint order;
+   const GLfloat * points;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &u1, sizeof(u1));
+   replay_read(reader, &u2, sizeof(u2));
+   replay_read(reader, &stride, sizeof(stride));
+   replay_read(reader, &order, sizeof(order));
+   points = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat * points)) reader->procs[TRACE_CALL_Map1f])(target, u1, u2, stride, order, points);
+}
+
+static void
+replay_Map2d(struct replay_reader *reader)
+{
+   GLenum target;
+   GLdouble u1;
+   GLdouble u2;
+   GLint ustride;
+   GLint uorder;
+   GLdouble v1;
+   GLdouble v2;
+   GLint vstride;
+   GLint vorder;
+   const GLdouble * points;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &u1, sizeof(u1));
+   replay_read(reader, &u2, sizeof(u2));
+   replay_read(reader, &ustride, sizeof(ustride));
+   replay_read(reader, &uorder, sizeof(uorder));
+   replay_read(reader, &v1, sizeof(v1));
+   replay_read(reader, &v2, sizeof(v2));
+   replay_read(reader, &vstride, sizeof(vstride));
+   replay_read(reader, &vorder, sizeof(vorder));
+   points = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble * points)) reader->procs[TRACE_CALL_Map2d])(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void
+replay_Map2f(struct replay_reader *reader)
+{
+   GLenum target;
+   GLfloat u1;
+   GLfloat u2;
+   GLint ustride;
+   GLint uorder;
+   GLfloat v1;
+   GLfloat v2;
+   GLint vstride;
+   GLint vorder;
+   const GLfloat * points;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &u1, sizeof(u1));
+   replay_read(reader, &u2, sizeof(u2));
+   replay_read(reader, &ustride, sizeof(ustride));
+   replay_read(reader, &uorder, sizeof(uorder));
+   replay_read(reader, &v1, sizeof(v1));
+   replay_read(reader, &v2, sizeof(v2));
+   replay_read(reader, &vstride, sizeof(vstride));
+   replay_read(reader, &vorder, sizeof(vorder));
+   points = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat * points)) reader->procs[TRACE_CALL_Map2f])(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void
+replay_MapGrid1d(struct replay_reader *reader)
+{
+   GLint un;
+   GLdouble u1;
+   GLdouble u2;
+   replay_read(reader, &un, sizeof(un));
+   replay_read(reader, &u1, sizeof(u1));
+   replay_read(reader, &u2, sizeof(u2));
+   (*(void (GLAPIENTRYP)(GLint un, GLdouble u1, GLdouble u2)) reader->procs[TRACE_CALL_MapGrid1d])(un, u1, u2);
+}
+
+static void
+replay_MapGrid1f(struct replay_reader *reader)
+{
+   GLint un;
+   GLfloat u1;
+   GLfloat u2;
+   replay_read(reader, &un, sizeof(un));
+   replay_read(reader, &u1, sizeof(u1));
+   replay_read(reader, &u2, sizeof(u2));
+   (*(void (GLAPIENTRYP)(GLint un, GLfloat u1, GLfloat u2)) reader->procs[TRACE_CALL_MapGrid1f])(un, u1, u2);
+}
+
+static void
+replay_MapGrid2d(struct replay_reader *reader)
+{
+   GLint un;
+   GLdouble u1;
+   GLdouble u2;
+   GLint vn;
+   GLdouble v1;
+   GLdouble v2;
+   replay_read(reader, &un, sizeof(un));
+   replay_read(reader, &u1, sizeof(u1));
+   replay_read(reader, &u2, sizeof(u2));
+   replay_read(reader, &vn, sizeof(vn));
+   replay_read(reader, &v1, sizeof(v1));
+   replay_read(reader, &v2, sizeof(v2));
+   (*(void (GLAPIENTRYP)(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2)) reader->procs[TRACE_CALL_MapGrid2d])(un, u1, u2, vn, v1, v2);
+}
+
+static void
+replay_MapGrid2f(struct replay_reader *reader)
+{
+   GLint un;
+   GLfloat u1;
+   GLfloat u2;
+   GLint vn;
+   GLfloat v1;
+   GLfloat v2;
+   replay_read(reader, &un, sizeof(un));
+   replay_read(reader, &u1, sizeof(u1));
+   replay_read(reader, &u2, sizeof(u2));
+   replay_read(reader, &vn, sizeof(vn));
+   replay_read(reader, &v1, sizeof(v1));
+   replay_read(reader, &v2, sizeof(v2));
+   (*(void (GLAPIENTRYP)(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2)) reader->procs[TRACE_CALL_MapGrid2f])(un, u1, u2, vn, v1, v2);
+}
+
+static void
+replay_EvalCoord1d(struct replay_reader *reader)
+{
+   GLdouble u;
+   replay_read(reader, &u, sizeof(u));
+   (*(void (GLAPIENTRYP)(GLdouble u)) reader->procs[TRACE_CALL_EvalCoord1d])(u);
+}
+
+static void
+replay_EvalCoord1dv(struct replay_reader *reader)
+{
+   const GLdouble * u;
+   u = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * u)) reader->procs[TRACE_CALL_EvalCoord1dv])(u);
+}
+
+static void
+replay_EvalCoord1f(struct replay_reader *reader)
+{
+   GLfloat u;
+   replay_read(reader, &u, sizeof(u));
+   (*(void (GLAPIENTRYP)(GLfloat u)) reader->procs[TRACE_CALL_EvalCoord1f])(u);
+}
+
+static void
+replay_EvalCoord1fv(struct replay_reader *reader)
+{
+   const GLfloat * u;
+   u = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * u)) reader->procs[TRACE_CALL_EvalCoord1fv])(u);
+}
+
+static void
+replay_EvalCoord2d(struct replay_reader *reader)
+{
+   GLdouble u;
+   GLdouble v;
+   replay_read(reader, &u, sizeof(u));
+   replay_read(reader, &v, sizeof(v));
+   (*(void (GLAPIENTRYP)(GLdouble u, GLdouble v)) reader->procs[TRACE_CALL_EvalCoord2d])(u, v);
+}
+
+static void
+replay_EvalCoord2dv(struct replay_reader *reader)
+{
+   const GLdouble * u;
+   u = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * u)) reader->procs[TRACE_CALL_EvalCoord2dv])(u);
+}
+
+static void
+replay_EvalCoord2f(struct replay_reader *reader)
+{
+   GLfloat u;
+   GLfloat v;
+   replay_read(reader, &u, sizeof(u));
+   replay_read(reader, &v, sizeof(v));
+   (*(void (GLAPIENTRYP)(GLfloat u, GLfloat v)) reader->procs[TRACE_CALL_EvalCoord2f])(u, v);
+}
+
+static void
+replay_EvalCoord2fv(struct replay_reader *reader)
+{
+   const GLfloat * u;
+   u = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * u)) reader->procs[TRACE_CALL_EvalCoord2fv])(u);
+}
+
+static void
+replay_EvalMesh1(struct replay_reader *reader)
+{
+   GLenum mode;
+   GLint i1;
+   GLint i2;
+   replay_read(reader, &mode, sizeof(mode));
+   replay_read(reader, &i1, sizeof(i1));
+   replay_read(reader, &i2, sizeof(i2));
+   (*(void (GLAPIENTRYP)(GLenum mode, GLint i1, GLint i2)) reader->procs[TRACE_CALL_EvalMesh1])(mode, i1, i2);
+}
+
+static void
+replay_EvalPoint1(struct replay_reader *reader)
+{
+   GLint i;
+   replay_read(reader, &i, sizeof(i));
+   (*(void (GLAPIENTRYP)(GLint i)) reader->procs[TRACE_CALL_EvalPoint1])(i);
+}
+
+static void
+replay_EvalMesh2(struct replay_reader *reader)
+{
+   GLenum mode;
+   GLint i1;
+   GLint i2;
+   GLint j1;
+   GLint j2;
+   replay_read(reader, &mode, sizeof(mode));
+   replay_read(reader, &i1, sizeof(i1));
+   replay_read(reader, &i2, sizeof(i2));
+   replay_read(reader, &j1, sizeof(j1));
+   replay_read(reader, &j2, sizeof(j2));
+   (*(void (GLAPIENTRYP)(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)) reader->procs[TRACE_CALL_EvalMesh2])(mode, i1, i2, j1, j2);
+}
+
+static void
+replay_EvalPoint2(struct replay_reader *reader)
+{
+   GLint i;
+   GLint j;
+   replay_read(reader, &i, sizeof(i));
+   replay_read(reader, &j, sizeof(j));
+   (*(void (GLAPIENTRYP)(GLint i, GLint j)) reader->procs[TRACE_CALL_EvalPoint2])(i, j);
+}
+
+static void
+replay_AlphaFunc(struct replay_reader *reader)
+{
+   GLenum func;
+   GLclampf ref;
+   replay_read(reader, &func, sizeof(func));
+   replay_read(reader, &ref, sizeof(ref));
+   (*(void (GLAPIENTRYP)(GLenum func, GLclampf ref)) reader->procs[TRACE_CALL_AlphaFunc])(func, ref);
+}
+
+static void
+replay_BlendFunc(struct replay_reader *reader)
+{
+   GLenum sfactor;
+   GLenum dfactor;
+   replay_read(reader, &sfactor, sizeof(sfactor));
+   replay_read(reader, &dfactor, sizeof(dfactor));
+   (*(void (GLAPIENTRYP)(GLenum sfactor, GLenum dfactor)) reader->procs[TRACE_CALL_BlendFunc])(sfactor, dfactor);
+}
+
+static void
+replay_LogicOp(struct replay_reader *reader)
+{
+   GLenum opcode;
+   replay_read(reader, &opcode, sizeof(opcode));
+   (*(void (GLAPIENTRYP)(GLenum opcode)) reader->procs[TRACE_CALL_LogicOp])(opcode);
+}
+
+static void
+replay_StencilFunc(struct replay_reader *reader)
+{
+   GLenum func;
+   GLint ref;
+   GLuint mask;
+   replay_read(reader, &func, sizeof(func));
+   replay_read(reader, &ref, sizeof(ref));
+   replay_read(reader, &mask, sizeof(mask));
+   (*(void (GLAPIENTRYP)(GLenum func, GLint ref, GLuint mask)) reader->procs[TRACE_CALL_StencilFunc])(func, ref, mask);
+}
+
+static void
+replay_StencilOp(struct replay_reader *reader)
+{
+   GLenum fail;
+   GLenum zfail;
+   GLenum zpass;
+   replay_read(reader, &fail, sizeof(fail));
+   replay_read(reader, &zfail, sizeof(zfail));
+   replay_read(reader, &zpass, sizeof(zpass));
+   (*(void (GLAPIENTRYP)(GLenum fail, GLenum zfail, GLenum zpass)) reader->procs[TRACE_CALL_StencilOp])(fail, zfail, zpass);
+}
+
+static void
+replay_DepthFunc(struct replay_reader *reader)
+{
+   GLenum func;
+   replay_read(reader, &func, sizeof(func));
+   (*(void (GLAPIENTRYP)(GLenum func)) reader->procs[TRACE_CALL_DepthFunc])(func);
+}
+
+static void
+replay_PixelZoom(struct replay_reader *reader)
+{
+   GLfloat xfactor;
+   GLfloat yfactor;
+   replay_read(reader, &xfactor, sizeof(xfactor));
+   replay_read(reader, &yfactor, sizeof(yfactor));
+   (*(void (GLAPIENTRYP)(GLfloat xfactor, GLfloat yfactor)) reader->procs[TRACE_CALL_PixelZoom])(xfactor, yfactor);
+}
+
+static void
+replay_PixelTransferf(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_PixelTransferf])(pname, param);
+}
+
+static void
+replay_PixelTransferi(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_PixelTransferi])(pname, param);
+}
+
+static void
+replay_PixelStoref(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_PixelStoref])(pname, param);
+}
+
+static void
+replay_PixelStorei(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_PixelStorei])(pname, param);
+}
+
+static void
+replay_PixelMapfv(struct replay_reader *reader)
+{
+   GLenum map;
+   GLsizei mapsize;
+   const GLfloat * values;
+   replay_read(reader, &map, sizeof(map));
+   replay_read(reader, &mapsize, sizeof(mapsize));
+   values = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum map, GLsizei mapsize, const GLfloat * values)) reader->procs[TRACE_CALL_PixelMapfv])(map, mapsize, values);
+}
+
+static void
+replay_PixelMapuiv(struct replay_reader *reader)
+{
+   GLenum map;
+   GLsizei mapsize;
+   const GLuint * values;
+   replay_read(reader, &map, sizeof(map));
+   replay_read(reader, &mapsize, sizeof(mapsize));
+   values = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum map, GLsizei mapsize, const GLuint * values)) reader->procs[TRACE_CALL_PixelMapuiv])(map, mapsize, values);
+}
+
+static void
+replay_PixelMapusv(struct replay_reader *reader)
+{
+   GLenum map;
+   GLsizei mapsize;
+   const GLushort * values;
+   replay_read(reader, &map, sizeof(map));
+   replay_read(reader, &mapsize, sizeof(mapsize));
+   values = (const GLushort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum map, GLsizei mapsize, const GLushort * values)) reader->procs[TRACE_CALL_PixelMapusv])(map, mapsize, values);
+}
+
+static void
+replay_ReadBuffer(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_ReadBuffer])(mode);
+}
+
+static void
+replay_CopyPixels(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   GLenum type;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &type, sizeof(type));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)) reader->procs[TRACE_CALL_CopyPixels])(x, y, width, height, type);
+}
+
+static void
+replay_ReadPixels(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   GLenum format;
+   GLenum type;
+   GLvoid * pixels;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   pixels = (GLvoid *) replay_output(reader);
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels)) reader->procs[TRACE_CALL_ReadPixels])(x, y, width, height, format, type, pixels);
+}
+
+static void
+replay_DrawPixels(struct replay_reader *reader)
+{
+   GLsizei width;
+   GLsizei height;
+   GLenum format;
+   GLenum type;
+   const GLvoid * pixels;
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   pixels = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)) reader->procs[TRACE_CALL_DrawPixels])(width, height, format, type, pixels);
+}
+
+static void
+replay_DepthRange(struct replay_reader *reader)
+{
+   GLclampd zNear;
+   GLclampd zFar;
+   replay_read(reader, &zNear, sizeof(zNear));
+   replay_read(reader, &zFar, sizeof(zFar));
+   (*(void (GLAPIENTRYP)(GLclampd zNear, GLclampd zFar)) reader->procs[TRACE_CALL_DepthRange])(zNear, zFar);
+}
+
+static void
+replay_Frustum(struct replay_reader *reader)
+{
+   GLdouble left;
+   GLdouble right;
+   GLdouble bottom;
+   GLdouble top;
+   GLdouble zNear;
+   GLdouble zFar;
+   replay_read(reader, &left, sizeof(left));
+   replay_read(reader, &right, sizeof(right));
+   replay_read(reader, &bottom, sizeof(bottom));
+   replay_read(reader, &top, sizeof(top));
+   replay_read(reader, &zNear, sizeof(zNear));
+   replay_read(reader, &zFar, sizeof(zFar));
+   (*(void (GLAPIENTRYP)(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)) reader->procs[TRACE_CALL_Frustum])(left, right, bottom, top, zNear, zFar);
+}
+
+static void
+replay_LoadIdentity(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_LoadIdentity])();
+}
+
+static void
+replay_LoadMatrixf(struct replay_reader *reader)
+{
+   const GLfloat * m;
+   m = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * m)) reader->procs[TRACE_CALL_LoadMatrixf])(m);
+}
+
+static void
+replay_LoadMatrixd(struct replay_reader *reader)
+{
+   const GLdouble * m;
+   m = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * m)) reader->procs[TRACE_CALL_LoadMatrixd])(m);
+}
+
+static void
+replay_MatrixMode(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_MatrixMode])(mode);
+}
+
+static void
+replay_MultMatrixf(struct replay_reader *reader)
+{
+   const GLfloat * m;
+   m = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * m)) reader->procs[TRACE_CALL_MultMatrixf])(m);
+}
+
+static void
+replay_MultMatrixd(struct replay_reader *reader)
+{
+   const GLdouble * m;
+   m = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * m)) reader->procs[TRACE_CALL_MultMatrixd])(m);
+}
+
+static void
+replay_Ortho(struct replay_reader *reader)
+{
+   GLdouble left;
+   GLdouble right;
+   GLdouble bottom;
+   GLdouble top;
+   GLdouble zNear;
+   GLdouble zFar;
+   replay_read(reader, &left, sizeof(left));
+   replay_read(reader, &right, sizeof(right));
+   replay_read(reader, &bottom, sizeof(bottom));
+   replay_read(reader, &top, sizeof(top));
+   replay_read(reader, &zNear, sizeof(zNear));
+   replay_read(reader, &zFar, sizeof(zFar));
+   (*(void (GLAPIENTRYP)(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)) reader->procs[TRACE_CALL_Ortho])(left, right, bottom, top, zNear, zFar);
+}
+
+static void
+replay_PopMatrix(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_PopMatrix])();
+}
+
+static void
+replay_PushMatrix(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_PushMatrix])();
+}
+
+static void
+replay_Rotated(struct replay_reader *reader)
+{
+   GLdouble angle;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   replay_read(reader, &angle, sizeof(angle));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)) reader->procs[TRACE_CALL_Rotated])(angle, x, y, z);
+}
+
+static void
+replay_Rotatef(struct replay_reader *reader)
+{
+   GLfloat angle;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   replay_read(reader, &angle, sizeof(angle));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)) reader->procs[TRACE_CALL_Rotatef])(angle, x, y, z);
+}
+
+static void
+replay_Scaled(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y, GLdouble z)) reader->procs[TRACE_CALL_Scaled])(x, y, z);
+}
+
+static void
+replay_Scalef(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y, GLfloat z)) reader->procs[TRACE_CALL_Scalef])(x, y, z);
+}
+
+static void
+replay_Translated(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y, GLdouble z)) reader->procs[TRACE_CALL_Translated])(x, y, z);
+}
+
+static void
+replay_Translatef(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y, GLfloat z)) reader->procs[TRACE_CALL_Translatef])(x, y, z);
+}
+
+static void
+replay_Viewport(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLsizei width, GLsizei height)) reader->procs[TRACE_CALL_Viewport])(x, y, width, height);
+}
+
+static void
+replay_ArrayElement(struct replay_reader *reader)
+{
+   GLint i;
+   replay_read(reader, &i, sizeof(i));
+   (*(void (GLAPIENTRYP)(GLint i)) reader->procs[TRACE_CALL_ArrayElement])(i);
+}
+
+static void
+replay_BindTexture(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint texture;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &texture, sizeof(texture));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint texture)) reader->procs[TRACE_CALL_BindTexture])(target, texture);
+}
+
+static void
+replay_DisableClientState(struct replay_reader *reader)
+{
+   GLenum array;
+   replay_read(reader, &array, sizeof(array));
+   (*(void (GLAPIENTRYP)(GLenum array)) reader->procs[TRACE_CALL_DisableClientState])(array);
+}
+
+static void
+replay_DrawArrays(struct replay_reader *reader)
+{
+   GLenum mode;
+   GLint first;
+   GLsizei count;
+   replay_read(reader, &mode, sizeof(mode));
+   replay_read(reader, &first, sizeof(first));
+   replay_read(reader, &count, sizeof(count));
+   (*(void (GLAPIENTRYP)(GLenum mode, GLint first, GLsizei count)) reader->procs[TRACE_CALL_DrawArrays])(mode, first, count);
+}
+
+static void
+replay_DrawElements(struct replay_reader *reader)
+{
+   GLenum mode;
+   GLsizei count;
+   GLenum type;
+   const GLvoid * indices;
+   replay_read(reader, &mode, sizeof(mode));
+   replay_read(reader, &count, sizeof(count));
+   replay_read(reader, &type, sizeof(type));
+   indices = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices)) reader->procs[TRACE_CALL_DrawElements])(mode, count, type, indices);
+}
+
+static void
+replay_EnableClientState(struct replay_reader *reader)
+{
+   GLenum array;
+   replay_read(reader, &array, sizeof(array));
+   (*(void (GLAPIENTRYP)(GLenum array)) reader->procs[TRACE_CALL_EnableClientState])(array);
+}
+
+static void
+replay_Indexub(struct replay_reader *reader)
+{
+   GLubyte c;
+   replay_read(reader, &c, sizeof(c));
+   (*(void (GLAPIENTRYP)(GLubyte c)) reader->procs[TRACE_CALL_Indexub])(c);
+}
+
+static void
+replay_Indexubv(struct replay_reader *reader)
+{
+   const GLubyte * c;
+   c = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLubyte * c)) reader->procs[TRACE_CALL_Indexubv])(c);
+}
+
+static void
+replay_PolygonOffset(struct replay_reader *reader)
+{
+   GLfloat factor;
+   GLfloat units;
+   replay_read(reader, &factor, sizeof(factor));
+   replay_read(reader, &units, sizeof(units));
+   (*(void (GLAPIENTRYP)(GLfloat factor, GLfloat units)) reader->procs[TRACE_CALL_PolygonOffset])(factor, units);
+}
+
+static void
+replay_CopyTexImage1D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLint border;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &border, sizeof(border));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)) reader->procs[TRACE_CALL_CopyTexImage1D])(target, level, internalformat, x, y, width, border);
+}
+
+static void
+replay_CopyTexImage2D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   GLint border;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &border, sizeof(border));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)) reader->procs[TRACE_CALL_CopyTexImage2D])(target, level, internalformat, x, y, width, height, border);
+}
+
+static void
+replay_CopyTexSubImage1D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &xoffset, sizeof(xoffset));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)) reader->procs[TRACE_CALL_CopyTexSubImage1D])(target, level, xoffset, x, y, width);
+}
+
+static void
+replay_CopyTexSubImage2D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint yoffset;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &xoffset, sizeof(xoffset));
+   replay_read(reader, &yoffset, sizeof(yoffset));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)) reader->procs[TRACE_CALL_CopyTexSubImage2D])(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void
+replay_DeleteTextures(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLuint * textures;
+   replay_read(reader, &n, sizeof(n));
+   textures = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLuint * textures)) reader->procs[TRACE_CALL_DeleteTextures])(n, textures);
+}
+
+static void
+replay_GenTextures(struct replay_reader *reader)
+{
+   GLsizei n;
+   GLuint * textures;
+   replay_read(reader, &n, sizeof(n));
+   textures = (GLuint *) replay_output(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, GLuint * textures)) reader->procs[TRACE_CALL_GenTextures])(n, textures);
+}
+
+static void
+replay_PrioritizeTextures(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLuint * textures;
+   const GLclampf * priorities;
+   replay_read(reader, &n, sizeof(n));
+   textures = (const GLuint *) replay_array(reader);
+   priorities = (const GLclampf *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLuint * textures, const GLclampf * priorities)) reader->procs[TRACE_CALL_PrioritizeTextures])(n, textures, priorities);
+}
+
+static void
+replay_TexSubImage1D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLsizei width;
+   GLenum format;
+   GLenum type;
+   const GLvoid * pixels;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &xoffset, sizeof(xoffset));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   pixels = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid * pixels)) reader->procs[TRACE_CALL_TexSubImage1D])(target, level, xoffset, width, format, type, pixels);
+}
+
+static void
+replay_TexSubImage2D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint yoffset;
+   GLsizei width;
+   GLsizei height;
+   GLenum format;
+   GLenum type;
+   const GLvoid * pixels;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &xoffset, sizeof(xoffset));
+   replay_read(reader, &yoffset, sizeof(yoffset));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   pixels = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)) reader->procs[TRACE_CALL_TexSubImage2D])(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void
+replay_PopClientAttrib(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_PopClientAttrib])();
+}
+
+static void
+replay_PushClientAttrib(struct replay_reader *reader)
+{
+   GLbitfield mask;
+   replay_read(reader, &mask, sizeof(mask));
+   (*(void (GLAPIENTRYP)(GLbitfield mask)) reader->procs[TRACE_CALL_PushClientAttrib])(mask);
+}
+
+static void
+replay_BlendColor(struct replay_reader *reader)
+{
+   GLclampf red;
+   GLclampf green;
+   GLclampf blue;
+   GLclampf alpha;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   replay_read(reader, &alpha, sizeof(alpha));
+   (*(void (GLAPIENTRYP)(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)) reader->procs[TRACE_CALL_BlendColor])(red, green, blue, alpha);
+}
+
+static void
+replay_BlendEquation(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_BlendEquation])(mode);
+}
+
+static void
+replay_DrawRangeElements(struct replay_reader *reader)
+{
+   GLenum mode;
+   GLuint start;
+   GLuint end;
+   GLsizei count;
+   GLenum type;
+   const GLvoid * indices;
+   replay_read(reader, &mode, sizeof(mode));
+   replay_read(reader, &start, sizeof(start));
+   replay_read(reader, &end, sizeof(end));
+   replay_read(reader, &count, sizeof(count));
+   replay_read(reader, &type, sizeof(type));
+   indices = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices)) reader->procs[TRACE_CALL_DrawRangeElements])(mode, start, end, count, type, indices);
+}
+
+static void
+replay_ColorTable(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum internalformat;
+   GLsizei width;
+   GLenum format;
+   GLenum type;
+   const GLvoid * table;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   table = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)) reader->procs[TRACE_CALL_ColorTable])(target, internalformat, width, format, type, table);
+}
+
+static void
+replay_ColorTableParameterfv(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_ColorTableParameterfv])(target, pname, params);
+}
+
+static void
+replay_ColorTableParameteriv(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_ColorTableParameteriv])(target, pname, params);
+}
+
+static void
+replay_CopyColorTable(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)) reader->procs[TRACE_CALL_CopyColorTable])(target, internalformat, x, y, width);
+}
+
+static void
+replay_ColorSubTable(struct replay_reader *reader)
+{
+   GLenum target;
+   GLsizei start;
+   GLsizei count;
+   GLenum format;
+   GLenum type;
+   const GLvoid * data;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &start, sizeof(start));
+   replay_read(reader, &count, sizeof(count));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   data = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid * data)) reader->procs[TRACE_CALL_ColorSubTable])(target, start, count, format, type, data);
+}
+
+static void
+replay_CopyColorSubTable(struct replay_reader *reader)
+{
+   GLenum target;
+   GLsizei start;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &start, sizeof(start));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   (*(void (GLAPIENTRYP)(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)) reader->procs[TRACE_CALL_CopyColorSubTable])(target, start, x, y, width);
+}
+
+static void
+replay_ConvolutionFilter1D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum internalformat;
+   GLsizei width;
+   GLenum format;
+   GLenum type;
+   const GLvoid * image;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   image = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * image)) reader->procs[TRACE_CALL_ConvolutionFilter1D])(target, internalformat, width, format, type, image);
+}
+
+static void
+replay_ConvolutionFilter2D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum internalformat;
+   GLsizei width;
+   GLsizei height;
+   GLenum format;
+   GLenum type;
+   const GLvoid * image;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   image = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * image)) reader->procs[TRACE_CALL_ConvolutionFilter2D])(target, internalformat, width, height, format, type, image);
+}
+
+static void
+replay_ConvolutionParameterf(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   GLfloat params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &params, sizeof(params));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, GLfloat params)) reader->procs[TRACE_CALL_ConvolutionParameterf])(target, pname, params);
+}
+
+static void
+replay_ConvolutionParameterfv(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_ConvolutionParameterfv])(target, pname, params);
+}
+
+static void
+replay_ConvolutionParameteri(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   GLint params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &params, sizeof(params));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, GLint params)) reader->procs[TRACE_CALL_ConvolutionParameteri])(target, pname, params);
+}
+
+static void
+replay_ConvolutionParameteriv(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_ConvolutionParameteriv])(target, pname, params);
+}
+
+static void
+replay_CopyConvolutionFilter1D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)) reader->procs[TRACE_CALL_CopyConvolutionFilter1D])(target, internalformat, x, y, width);
+}
+
+static void
+replay_CopyConvolutionFilter2D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)) reader->procs[TRACE_CALL_CopyConvolutionFilter2D])(target, internalformat, x, y, width, height);
+}
+
+static void
+replay_SeparableFilter2D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum internalformat;
+   GLsizei width;
+   GLsizei height;
+   GLenum format;
+   GLenum type;
+   const GLvoid * row;
+   const GLvoid * column;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   row = (const GLvoid *) replay_array(reader);
+   column = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * row, const GLvoid * column)) reader->procs[TRACE_CALL_SeparableFilter2D])(target, internalformat, width, height, format, type, row, column);
+}
+
+static void
+replay_Histogram(struct replay_reader *reader)
+{
+   GLenum target;
+   GLsizei width;
+   GLenum internalformat;
+   GLboolean sink;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &sink, sizeof(sink));
+   (*(void (GLAPIENTRYP)(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)) reader->procs[TRACE_CALL_Histogram])(target, width, internalformat, sink);
+}
+
+static void
+replay_Minmax(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum internalformat;
+   GLboolean sink;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &sink, sizeof(sink));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum internalformat, GLboolean sink)) reader->procs[TRACE_CALL_Minmax])(target, internalformat, sink);
+}
+
+static void
+replay_ResetHistogram(struct replay_reader *reader)
+{
+   GLenum target;
+   replay_read(reader, &target, sizeof(target));
+   (*(void (GLAPIENTRYP)(GLenum target)) reader->procs[TRACE_CALL_ResetHistogram])(target);
+}
+
+static void
+replay_ResetMinmax(struct replay_reader *reader)
+{
+   GLenum target;
+   replay_read(reader, &target, sizeof(target));
+   (*(void (GLAPIENTRYP)(GLenum target)) reader->procs[TRACE_CALL_ResetMinmax])(target);
+}
+
+static void
+replay_TexImage3D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint internalformat;
+   GLsizei width;
+   GLsizei height;
+   GLsizei depth;
+   GLint border;
+   GLenum format;
+   GLenum type;
+   const GLvoid * pixels;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &depth, sizeof(depth));
+   replay_read(reader, &border, sizeof(border));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   pixels = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels)) reader->procs[TRACE_CALL_TexImage3D])(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void
+replay_TexSubImage3D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint yoffset;
+   GLint zoffset;
+   GLsizei width;
+   GLsizei height;
+   GLsizei depth;
+   GLenum format;
+   GLenum type;
+   const GLvoid * pixels;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &xoffset, sizeof(xoffset));
+   replay_read(reader, &yoffset, sizeof(yoffset));
+   replay_read(reader, &zoffset, sizeof(zoffset));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &depth, sizeof(depth));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &type, sizeof(type));
+   pixels = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)) reader->procs[TRACE_CALL_TexSubImage3D])(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void
+replay_CopyTexSubImage3D(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint yoffset;
+   GLint zoffset;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &xoffset, sizeof(xoffset));
+   replay_read(reader, &yoffset, sizeof(yoffset));
+   replay_read(reader, &zoffset, sizeof(zoffset));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)) reader->procs[TRACE_CALL_CopyTexSubImage3D])(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void
+replay_ActiveTextureARB(struct replay_reader *reader)
+{
+   GLenum texture;
+   replay_read(reader, &texture, sizeof(texture));
+   (*(void (GLAPIENTRYP)(GLenum texture)) reader->procs[TRACE_CALL_ActiveTextureARB])(texture);
+}
+
+static void
+replay_ClientActiveTextureARB(struct replay_reader *reader)
+{
+   GLenum texture;
+   replay_read(reader, &texture, sizeof(texture));
+   (*(void (GLAPIENTRYP)(GLenum texture)) reader->procs[TRACE_CALL_ClientActiveTextureARB])(texture);
+}
+
+static void
+replay_MultiTexCoord1dARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLdouble s;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   (*(void (GLAPIENTRYP)(GLenum target, GLdouble s)) reader->procs[TRACE_CALL_MultiTexCoord1dARB])(target, s);
+}
+
+static void
+replay_MultiTexCoord1dvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLdouble * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLdouble * v)) reader->procs[TRACE_CALL_MultiTexCoord1dvARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord1fARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLfloat s;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   (*(void (GLAPIENTRYP)(GLenum target, GLfloat s)) reader->procs[TRACE_CALL_MultiTexCoord1fARB])(target, s);
+}
+
+static void
+replay_MultiTexCoord1fvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLfloat * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLfloat * v)) reader->procs[TRACE_CALL_MultiTexCoord1fvARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord1iARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint s;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint s)) reader->procs[TRACE_CALL_MultiTexCoord1iARB])(target, s);
+}
+
+static void
+replay_MultiTexCoord1ivARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLint * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLint * v)) reader->procs[TRACE_CALL_MultiTexCoord1ivARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord1sARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLshort s;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   (*(void (GLAPIENTRYP)(GLenum target, GLshort s)) reader->procs[TRACE_CALL_MultiTexCoord1sARB])(target, s);
+}
+
+static void
+replay_MultiTexCoord1svARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLshort * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLshort * v)) reader->procs[TRACE_CALL_MultiTexCoord1svARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord2dARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLdouble s;
+   GLdouble t;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   (*(void (GLAPIENTRYP)(GLenum target, GLdouble s, GLdouble t)) reader->procs[TRACE_CALL_MultiTexCoord2dARB])(target, s, t);
+}
+
+static void
+replay_MultiTexCoord2dvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLdouble * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLdouble * v)) reader->procs[TRACE_CALL_MultiTexCoord2dvARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord2fARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLfloat s;
+   GLfloat t;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   (*(void (GLAPIENTRYP)(GLenum target, GLfloat s, GLfloat t)) reader->procs[TRACE_CALL_MultiTexCoord2fARB])(target, s, t);
+}
+
+static void
+replay_MultiTexCoord2fvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLfloat * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLfloat * v)) reader->procs[TRACE_CALL_MultiTexCoord2fvARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord2iARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint s;
+   GLint t;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint s, GLint t)) reader->procs[TRACE_CALL_MultiTexCoord2iARB])(target, s, t);
+}
+
+static void
+replay_MultiTexCoord2ivARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLint * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLint * v)) reader->procs[TRACE_CALL_MultiTexCoord2ivARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord2sARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLshort s;
+   GLshort t;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   (*(void (GLAPIENTRYP)(GLenum target, GLshort s, GLshort t)) reader->procs[TRACE_CALL_MultiTexCoord2sARB])(target, s, t);
+}
+
+static void
+replay_MultiTexCoord2svARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLshort * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLshort * v)) reader->procs[TRACE_CALL_MultiTexCoord2svARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord3dARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLdouble s;
+   GLdouble t;
+   GLdouble r;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   (*(void (GLAPIENTRYP)(GLenum target, GLdouble s, GLdouble t, GLdouble r)) reader->procs[TRACE_CALL_MultiTexCoord3dARB])(target, s, t, r);
+}
+
+static void
+replay_MultiTexCoord3dvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLdouble * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLdouble * v)) reader->procs[TRACE_CALL_MultiTexCoord3dvARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord3fARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLfloat s;
+   GLfloat t;
+   GLfloat r;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   (*(void (GLAPIENTRYP)(GLenum target, GLfloat s, GLfloat t, GLfloat r)) reader->procs[TRACE_CALL_MultiTexCoord3fARB])(target, s, t, r);
+}
+
+static void
+replay_MultiTexCoord3fvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLfloat * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLfloat * v)) reader->procs[TRACE_CALL_MultiTexCoord3fvARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord3iARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint s;
+   GLint t;
+   GLint r;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint s, GLint t, GLint r)) reader->procs[TRACE_CALL_MultiTexCoord3iARB])(target, s, t, r);
+}
+
+static void
+replay_MultiTexCoord3ivARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLint * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLint * v)) reader->procs[TRACE_CALL_MultiTexCoord3ivARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord3sARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLshort s;
+   GLshort t;
+   GLshort r;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   (*(void (GLAPIENTRYP)(GLenum target, GLshort s, GLshort t, GLshort r)) reader->procs[TRACE_CALL_MultiTexCoord3sARB])(target, s, t, r);
+}
+
+static void
+replay_MultiTexCoord3svARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLshort * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLshort * v)) reader->procs[TRACE_CALL_MultiTexCoord3svARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord4dARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLdouble s;
+   GLdouble t;
+   GLdouble r;
+   GLdouble q;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   replay_read(reader, &q, sizeof(q));
+   (*(void (GLAPIENTRYP)(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)) reader->procs[TRACE_CALL_MultiTexCoord4dARB])(target, s, t, r, q);
+}
+
+static void
+replay_MultiTexCoord4dvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLdouble * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLdouble * v)) reader->procs[TRACE_CALL_MultiTexCoord4dvARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord4fARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLfloat s;
+   GLfloat t;
+   GLfloat r;
+   GLfloat q;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   replay_read(reader, &q, sizeof(q));
+   (*(void (GLAPIENTRYP)(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)) reader->procs[TRACE_CALL_MultiTexCoord4fARB])(target, s, t, r, q);
+}
+
+static void
+replay_MultiTexCoord4fvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLfloat * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLfloat * v)) reader->procs[TRACE_CALL_MultiTexCoord4fvARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord4iARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint s;
+   GLint t;
+   GLint r;
+   GLint q;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   replay_read(reader, &q, sizeof(q));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint s, GLint t, GLint r, GLint q)) reader->procs[TRACE_CALL_MultiTexCoord4iARB])(target, s, t, r, q);
+}
+
+static void
+replay_MultiTexCoord4ivARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLint * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLint * v)) reader->procs[TRACE_CALL_MultiTexCoord4ivARB])(target, v);
+}
+
+static void
+replay_MultiTexCoord4sARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLshort s;
+   GLshort t;
+   GLshort r;
+   GLshort q;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &s, sizeof(s));
+   replay_read(reader, &t, sizeof(t));
+   replay_read(reader, &r, sizeof(r));
+   replay_read(reader, &q, sizeof(q));
+   (*(void (GLAPIENTRYP)(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)) reader->procs[TRACE_CALL_MultiTexCoord4sARB])(target, s, t, r, q);
+}
+
+static void
+replay_MultiTexCoord4svARB(struct replay_reader *reader)
+{
+   GLenum target;
+   const GLshort * v;
+   replay_read(reader, &target, sizeof(target));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, const GLshort * v)) reader->procs[TRACE_CALL_MultiTexCoord4svARB])(target, v);
+}
+
+static void
+replay_LoadTransposeMatrixfARB(struct replay_reader *reader)
+{
+   const GLfloat * m;
+   m = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * m)) reader->procs[TRACE_CALL_LoadTransposeMatrixfARB])(m);
+}
+
+static void
+replay_LoadTransposeMatrixdARB(struct replay_reader *reader)
+{
+   const GLdouble * m;
+   m = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * m)) reader->procs[TRACE_CALL_LoadTransposeMatrixdARB])(m);
+}
+
+static void
+replay_MultTransposeMatrixfARB(struct replay_reader *reader)
+{
+   const GLfloat * m;
+   m = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * m)) reader->procs[TRACE_CALL_MultTransposeMatrixfARB])(m);
+}
+
+static void
+replay_MultTransposeMatrixdARB(struct replay_reader *reader)
+{
+   const GLdouble * m;
+   m = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * m)) reader->procs[TRACE_CALL_MultTransposeMatrixdARB])(m);
+}
+
+static void
+replay_SampleCoverageARB(struct replay_reader *reader)
+{
+   GLclampf value;
+   GLboolean invert;
+   replay_read(reader, &value, sizeof(value));
+   replay_read(reader, &invert, sizeof(invert));
+   (*(void (GLAPIENTRYP)(GLclampf value, GLboolean invert)) reader->procs[TRACE_CALL_SampleCoverageARB])(value, invert);
+}
+
+static void
+replay_DrawBuffersARB(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLenum * bufs;
+   replay_read(reader, &n, sizeof(n));
+   bufs = (const GLenum *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLenum * bufs)) reader->procs[TRACE_CALL_DrawBuffersARB])(n, bufs);
+}
+
+static void
+replay_PolygonOffsetEXT(struct replay_reader *reader)
+{
+   GLfloat factor;
+   GLfloat bias;
+   replay_read(reader, &factor, sizeof(factor));
+   replay_read(reader, &bias, sizeof(bias));
+   (*(void (GLAPIENTRYP)(GLfloat factor, GLfloat bias)) reader->procs[TRACE_CALL_PolygonOffsetEXT])(factor, bias);
+}
+
+static void
+replay_TexFilterFuncSGIS(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum filter;
+   GLsizei n;
+   const GLfloat * weights;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &filter, sizeof(filter));
+   replay_read(reader, &n, sizeof(n));
+   weights = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum filter, GLsizei n, const GLfloat * weights)) reader->procs[TRACE_CALL_TexFilterFuncSGIS])(target, filter, n, weights);
+}
+
+static void
+replay_PixelTexGenSGIX(struct replay_reader *reader)
+{
+   GLenum mode;
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum mode)) reader->procs[TRACE_CALL_PixelTexGenSGIX])(mode);
+}
+
+static void
+replay_PixelTexGenParameteriSGIS(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_PixelTexGenParameteriSGIS])(pname, param);
+}
+
+static void
+replay_PixelTexGenParameterfSGIS(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_PixelTexGenParameterfSGIS])(pname, param);
+}
+
+static void
+replay_GenTexturesEXT(struct replay_reader *reader)
+{
+   GLsizei n;
+   GLuint * textures;
+   replay_read(reader, &n, sizeof(n));
+   textures = (GLuint *) replay_output(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, GLuint * textures)) reader->procs[TRACE_CALL_GenTexturesEXT])(n, textures);
+}
+
+static void
+replay_DetailTexFuncSGIS(struct replay_reader *reader)
+{
+   GLenum target;
+   GLsizei n;
+   const GLfloat * points;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &n, sizeof(n));
+   points = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLsizei n, const GLfloat * points)) reader->procs[TRACE_CALL_DetailTexFuncSGIS])(target, n, points);
+}
+
+static void
+replay_SharpenTexFuncSGIS(struct replay_reader *reader)
+{
+   GLenum target;
+   GLsizei n;
+   const GLfloat * points;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &n, sizeof(n));
+   points = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLsizei n, const GLfloat * points)) reader->procs[TRACE_CALL_SharpenTexFuncSGIS])(target, n, points);
+}
+
+static void
+replay_SampleMaskSGIS(struct replay_reader *reader)
+{
+   GLclampf value;
+   GLboolean invert;
+   replay_read(reader, &value, sizeof(value));
+   replay_read(reader, &invert, sizeof(invert));
+   (*(void (GLAPIENTRYP)(GLclampf value, GLboolean invert)) reader->procs[TRACE_CALL_SampleMaskSGIS])(value, invert);
+}
+
+static void
+replay_SamplePatternSGIS(struct replay_reader *reader)
+{
+   GLenum pattern;
+   replay_read(reader, &pattern, sizeof(pattern));
+   (*(void (GLAPIENTRYP)(GLenum pattern)) reader->procs[TRACE_CALL_SamplePatternSGIS])(pattern);
+}
+
+static void
+replay_SpriteParameterfSGIX(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_SpriteParameterfSGIX])(pname, param);
+}
+
+static void
+replay_SpriteParameteriSGIX(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_SpriteParameteriSGIX])(pname, param);
+}
+
+static void
+replay_PointParameterfEXT(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_PointParameterfEXT])(pname, param);
+}
+
+static void
+replay_PointParameterfvEXT(struct replay_reader *reader)
+{
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_PointParameterfvEXT])(pname, params);
+}
+
+static void
+replay_ReadInstrumentsSGIX(struct replay_reader *reader)
+{
+   GLint marker;
+   replay_read(reader, &marker, sizeof(marker));
+   (*(void (GLAPIENTRYP)(GLint marker)) reader->procs[TRACE_CALL_ReadInstrumentsSGIX])(marker);
+}
+
+static void
+replay_StartInstrumentsSGIX(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_StartInstrumentsSGIX])();
+}
+
+static void
+replay_StopInstrumentsSGIX(struct replay_reader *reader)
+{
+   GLint marker;
+   replay_read(reader, &marker, sizeof(marker));
+   (*(void (GLAPIENTRYP)(GLint marker)) reader->procs[TRACE_CALL_StopInstrumentsSGIX])(marker);
+}
+
+static void
+replay_FrameZoomSGIX(struct replay_reader *reader)
+{
+   GLint factor;
+   replay_read(reader, &factor, sizeof(factor));
+   (*(void (GLAPIENTRYP)(GLint factor)) reader->procs[TRACE_CALL_FrameZoomSGIX])(factor);
+}
+
+static void
+replay_TagSampleBufferSGIX(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_TagSampleBufferSGIX])();
+}
+
+static void
+replay_FlushRasterSGIX(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_FlushRasterSGIX])();
+}
+
+static void
+replay_ListParameterfSGIX(struct replay_reader *reader)
+{
+   GLuint list;
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &list, sizeof(list));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLuint list, GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_ListParameterfSGIX])(list, pname, param);
+}
+
+static void
+replay_ListParameteriSGIX(struct replay_reader *reader)
+{
+   GLuint list;
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &list, sizeof(list));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLuint list, GLenum pname, GLint param)) reader->procs[TRACE_CALL_ListParameteriSGIX])(list, pname, param);
+}
+
+static void
+replay_FragmentColorMaterialSGIX(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum mode;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum mode)) reader->procs[TRACE_CALL_FragmentColorMaterialSGIX])(face, mode);
+}
+
+static void
+replay_FragmentLightfSGIX(struct replay_reader *reader)
+{
+   GLenum light;
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &light, sizeof(light));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum light, GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_FragmentLightfSGIX])(light, pname, param);
+}
+
+static void
+replay_FragmentLightiSGIX(struct replay_reader *reader)
+{
+   GLenum light;
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &light, sizeof(light));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum light, GLenum pname, GLint param)) reader->procs[TRACE_CALL_FragmentLightiSGIX])(light, pname, param);
+}
+
+static void
+replay_FragmentLightModelfSGIX(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_FragmentLightModelfSGIX])(pname, param);
+}
+
+static void
+replay_FragmentLightModeliSGIX(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_FragmentLightModeliSGIX])(pname, param);
+}
+
+static void
+replay_FragmentMaterialfSGIX(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_FragmentMaterialfSGIX])(face, pname, param);
+}
+
+static void
+replay_FragmentMaterialiSGIX(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum pname, GLint param)) reader->procs[TRACE_CALL_FragmentMaterialiSGIX])(face, pname, param);
+}
+
+static void
+replay_LightEnviSGIX(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_LightEnviSGIX])(pname, param);
+}
+
+static void
+replay_VertexWeightfEXT(struct replay_reader *reader)
+{
+   GLfloat weight;
+   replay_read(reader, &weight, sizeof(weight));
+   (*(void (GLAPIENTRYP)(GLfloat weight)) reader->procs[TRACE_CALL_VertexWeightfEXT])(weight);
+}
+
+static void
+replay_VertexWeightfvEXT(struct replay_reader *reader)
+{
+   const GLfloat * weight;
+   weight = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * weight)) reader->procs[TRACE_CALL_VertexWeightfvEXT])(weight);
+}
+
+static void
+replay_FlushVertexArrayRangeNV(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_FlushVertexArrayRangeNV])();
+}
+
+static void
+replay_CombinerParameterfvNV(struct replay_reader *reader)
+{
+   GLenum pname;
+   const GLfloat * params;
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum pname, const GLfloat * params)) reader->procs[TRACE_CALL_CombinerParameterfvNV])(pname, params);
+}
+
+static void
+replay_CombinerParameterfNV(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLfloat param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLfloat param)) reader->procs[TRACE_CALL_CombinerParameterfNV])(pname, param);
+}
+
+static void
+replay_CombinerParameterivNV(struct replay_reader *reader)
+{
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_CombinerParameterivNV])(pname, params);
+}
+
+static void
+replay_CombinerParameteriNV(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_CombinerParameteriNV])(pname, param);
+}
+
+static void
+replay_CombinerInputNV(struct replay_reader *reader)
+{
+   GLenum stage;
+   GLenum portion;
+   GLenum variable;
+   GLenum input;
+   GLenum mapping;
+   GLenum componentUsage;
+   replay_read(reader, &stage, sizeof(stage));
+   replay_read(reader, &portion, sizeof(portion));
+   replay_read(reader, &variable, sizeof(variable));
+   replay_read(reader, &input, sizeof(input));
+   replay_read(reader, &mapping, sizeof(mapping));
+   replay_read(reader, &componentUsage, sizeof(componentUsage));
+   (*(void (GLAPIENTRYP)(GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)) reader->procs[TRACE_CALL_CombinerInputNV])(stage, portion, variable, input, mapping, componentUsage);
+}
+
+static void
+replay_CombinerOutputNV(struct replay_reader *reader)
+{
+   GLenum stage;
+   GLenum portion;
+   GLenum abOutput;
+   GLenum cdOutput;
+   GLenum sumOutput;
+   GLenum scale;
+   GLenum bias;
+   GLboolean abDotProduct;
+   GLboolean cdDotProduct;
+   GLboolean muxSum;
+   replay_read(reader, &stage, sizeof(stage));
+   replay_read(reader, &portion, sizeof(portion));
+   replay_read(reader, &abOutput, sizeof(abOutput));
+   replay_read(reader, &cdOutput, sizeof(cdOutput));
+   replay_read(reader, &sumOutput, sizeof(sumOutput));
+   replay_read(reader, &scale, sizeof(scale));
+   replay_read(reader, &bias, sizeof(bias));
+   replay_read(reader, &abDotProduct, sizeof(abDotProduct));
+   replay_read(reader, &cdDotProduct, sizeof(cdDotProduct));
+   replay_read(reader, &muxSum, sizeof(muxSum));
+   (*(void (GLAPIENTRYP)(GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum)) reader->procs[TRACE_CALL_CombinerOutputNV])(stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum);
+}
+
+static void
+replay_FinalCombinerInputNV(struct replay_reader *reader)
+{
+   GLenum variable;
+   GLenum input;
+   GLenum mapping;
+   GLenum componentUsage;
+   replay_read(reader, &variable, sizeof(variable));
+   replay_read(reader, &input, sizeof(input));
+   replay_read(reader, &mapping, sizeof(mapping));
+   replay_read(reader, &componentUsage, sizeof(componentUsage));
+   (*(void (GLAPIENTRYP)(GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)) reader->procs[TRACE_CALL_FinalCombinerInputNV])(variable, input, mapping, componentUsage);
+}
+
+static void
+replay_ResizeBuffersMESA(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_ResizeBuffersMESA])();
+}
+
+static void
+replay_WindowPos2dMESA(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y)) reader->procs[TRACE_CALL_WindowPos2dMESA])(x, y);
+}
+
+static void
+replay_WindowPos2dvMESA(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_WindowPos2dvMESA])(v);
+}
+
+static void
+replay_WindowPos2fMESA(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y)) reader->procs[TRACE_CALL_WindowPos2fMESA])(x, y);
+}
+
+static void
+replay_WindowPos2fvMESA(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_WindowPos2fvMESA])(v);
+}
+
+static void
+replay_WindowPos2iMESA(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y)) reader->procs[TRACE_CALL_WindowPos2iMESA])(x, y);
+}
+
+static void
+replay_WindowPos2ivMESA(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_WindowPos2ivMESA])(v);
+}
+
+static void
+replay_WindowPos2sMESA(struct replay_reader *reader)
+{
+   GLshort x;
+   GLshort y;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLshort x, GLshort y)) reader->procs[TRACE_CALL_WindowPos2sMESA])(x, y);
+}
+
+static void
+replay_WindowPos2svMESA(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_WindowPos2svMESA])(v);
+}
+
+static void
+replay_WindowPos3dMESA(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y, GLdouble z)) reader->procs[TRACE_CALL_WindowPos3dMESA])(x, y, z);
+}
+
+static void
+replay_WindowPos3dvMESA(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_WindowPos3dvMESA])(v);
+}
+
+static void
+replay_WindowPos3fMESA(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y, GLfloat z)) reader->procs[TRACE_CALL_WindowPos3fMESA])(x, y, z);
+}
+
+static void
+replay_WindowPos3fvMESA(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_WindowPos3fvMESA])(v);
+}
+
+static void
+replay_WindowPos3iMESA(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLint z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLint z)) reader->procs[TRACE_CALL_WindowPos3iMESA])(x, y, z);
+}
+
+static void
+replay_WindowPos3ivMESA(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_WindowPos3ivMESA])(v);
+}
+
+static void
+replay_WindowPos3sMESA(struct replay_reader *reader)
+{
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLshort x, GLshort y, GLshort z)) reader->procs[TRACE_CALL_WindowPos3sMESA])(x, y, z);
+}
+
+static void
+replay_WindowPos3svMESA(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_WindowPos3svMESA])(v);
+}
+
+static void
+replay_WindowPos4dMESA(struct replay_reader *reader)
+{
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLdouble x, GLdouble y, GLdouble z, GLdouble w)) reader->procs[TRACE_CALL_WindowPos4dMESA])(x, y, z, w);
+}
+
+static void
+replay_WindowPos4dvMESA(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_WindowPos4dvMESA])(v);
+}
+
+static void
+replay_WindowPos4fMESA(struct replay_reader *reader)
+{
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLfloat x, GLfloat y, GLfloat z, GLfloat w)) reader->procs[TRACE_CALL_WindowPos4fMESA])(x, y, z, w);
+}
+
+static void
+replay_WindowPos4fvMESA(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_WindowPos4fvMESA])(v);
+}
+
+static void
+replay_WindowPos4iMESA(struct replay_reader *reader)
+{
+   GLint x;
+   GLint y;
+   GLint z;
+   GLint w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLint x, GLint y, GLint z, GLint w)) reader->procs[TRACE_CALL_WindowPos4iMESA])(x, y, z, w);
+}
+
+static void
+replay_WindowPos4ivMESA(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_WindowPos4ivMESA])(v);
+}
+
+static void
+replay_WindowPos4sMESA(struct replay_reader *reader)
+{
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLshort x, GLshort y, GLshort z, GLshort w)) reader->procs[TRACE_CALL_WindowPos4sMESA])(x, y, z, w);
+}
+
+static void
+replay_WindowPos4svMESA(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_WindowPos4svMESA])(v);
+}
+
+static void
+replay_BlendFuncSeparateEXT(struct replay_reader *reader)
+{
+   GLenum sfactorRGB;
+   GLenum dfactorRGB;
+   GLenum sfactorAlpha;
+   GLenum dfactorAlpha;
+   replay_read(reader, &sfactorRGB, sizeof(sfactorRGB));
+   replay_read(reader, &dfactorRGB, sizeof(dfactorRGB));
+   replay_read(reader, &sfactorAlpha, sizeof(sfactorAlpha));
+   replay_read(reader, &dfactorAlpha, sizeof(dfactorAlpha));
+   (*(void (GLAPIENTRYP)(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)) reader->procs[TRACE_CALL_BlendFuncSeparateEXT])(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void
+replay_IndexMaterialEXT(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum mode;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum mode)) reader->procs[TRACE_CALL_IndexMaterialEXT])(face, mode);
+}
+
+static void
+replay_IndexFuncEXT(struct replay_reader *reader)
+{
+   GLenum func;
+   GLclampf ref;
+   replay_read(reader, &func, sizeof(func));
+   replay_read(reader, &ref, sizeof(ref));
+   (*(void (GLAPIENTRYP)(GLenum func, GLclampf ref)) reader->procs[TRACE_CALL_IndexFuncEXT])(func, ref);
+}
+
+static void
+replay_LockArraysEXT(struct replay_reader *reader)
+{
+   GLint first;
+   GLsizei count;
+   replay_read(reader, &first, sizeof(first));
+   replay_read(reader, &count, sizeof(count));
+   (*(void (GLAPIENTRYP)(GLint first, GLsizei count)) reader->procs[TRACE_CALL_LockArraysEXT])(first, count);
+}
+
+static void
+replay_UnlockArraysEXT(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_UnlockArraysEXT])();
+}
+
+static void
+replay_HintPGI(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint mode;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &mode, sizeof(mode));
+   (*(void (GLAPIENTRYP)(GLenum target, GLint mode)) reader->procs[TRACE_CALL_HintPGI])(target, mode);
+}
+
+static void
+replay_FogCoordfEXT(struct replay_reader *reader)
+{
+   GLfloat coord;
+   replay_read(reader, &coord, sizeof(coord));
+   (*(void (GLAPIENTRYP)(GLfloat coord)) reader->procs[TRACE_CALL_FogCoordfEXT])(coord);
+}
+
+static void
+replay_FogCoordfvEXT(struct replay_reader *reader)
+{
+   const GLfloat * coord;
+   coord = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * coord)) reader->procs[TRACE_CALL_FogCoordfvEXT])(coord);
+}
+
+static void
+replay_FogCoorddEXT(struct replay_reader *reader)
+{
+   GLdouble coord;
+   replay_read(reader, &coord, sizeof(coord));
+   (*(void (GLAPIENTRYP)(GLdouble coord)) reader->procs[TRACE_CALL_FogCoorddEXT])(coord);
+}
+
+static void
+replay_FogCoorddvEXT(struct replay_reader *reader)
+{
+   const GLdouble * coord;
+   coord = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * coord)) reader->procs[TRACE_CALL_FogCoorddvEXT])(coord);
+}
+
+static void
+replay_TbufferMask3DFX(struct replay_reader *reader)
+{
+   GLuint mask;
+   replay_read(reader, &mask, sizeof(mask));
+   (*(void (GLAPIENTRYP)(GLuint mask)) reader->procs[TRACE_CALL_TbufferMask3DFX])(mask);
+}
+
+static void
+replay_CompressedTexImage3DARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLenum internalformat;
+   GLsizei width;
+   GLsizei height;
+   GLsizei depth;
+   GLint border;
+   GLsizei imageSize;
+   const GLvoid * data;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &depth, sizeof(depth));
+   replay_read(reader, &border, sizeof(border));
+   replay_read(reader, &imageSize, sizeof(imageSize));
+   data = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)) reader->procs[TRACE_CALL_CompressedTexImage3DARB])(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void
+replay_CompressedTexImage2DARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLenum internalformat;
+   GLsizei width;
+   GLsizei height;
+   GLint border;
+   GLsizei imageSize;
+   const GLvoid * data;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &border, sizeof(border));
+   replay_read(reader, &imageSize, sizeof(imageSize));
+   data = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)) reader->procs[TRACE_CALL_CompressedTexImage2DARB])(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void
+replay_CompressedTexImage1DARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLenum internalformat;
+   GLsizei width;
+   GLint border;
+   GLsizei imageSize;
+   const GLvoid * data;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &border, sizeof(border));
+   replay_read(reader, &imageSize, sizeof(imageSize));
+   data = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data)) reader->procs[TRACE_CALL_CompressedTexImage1DARB])(target, level, internalformat, width, border, imageSize, data);
+}
+
+static void
+replay_CompressedTexSubImage3DARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint yoffset;
+   GLint zoffset;
+   GLsizei width;
+   GLsizei height;
+   GLsizei depth;
+   GLenum format;
+   GLsizei imageSize;
+   const GLvoid * data;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &xoffset, sizeof(xoffset));
+   replay_read(reader, &yoffset, sizeof(yoffset));
+   replay_read(reader, &zoffset, sizeof(zoffset));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &depth, sizeof(depth));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &imageSize, sizeof(imageSize));
+   data = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)) reader->procs[TRACE_CALL_CompressedTexSubImage3DARB])(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void
+replay_CompressedTexSubImage2DARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint yoffset;
+   GLsizei width;
+   GLsizei height;
+   GLenum format;
+   GLsizei imageSize;
+   const GLvoid * data;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &xoffset, sizeof(xoffset));
+   replay_read(reader, &yoffset, sizeof(yoffset));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &imageSize, sizeof(imageSize));
+   data = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)) reader->procs[TRACE_CALL_CompressedTexSubImage2DARB])(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void
+replay_CompressedTexSubImage1DARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLsizei width;
+   GLenum format;
+   GLsizei imageSize;
+   const GLvoid * data;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &xoffset, sizeof(xoffset));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &imageSize, sizeof(imageSize));
+   data = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data)) reader->procs[TRACE_CALL_CompressedTexSubImage1DARB])(target, level, xoffset, width, format, imageSize, data);
+}
+
+static void
+replay_SecondaryColor3bEXT(struct replay_reader *reader)
+{
+   GLbyte red;
+   GLbyte green;
+   GLbyte blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLbyte red, GLbyte green, GLbyte blue)) reader->procs[TRACE_CALL_SecondaryColor3bEXT])(red, green, blue);
+}
+
+static void
+replay_SecondaryColor3bvEXT(struct replay_reader *reader)
+{
+   const GLbyte * v;
+   v = (const GLbyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLbyte * v)) reader->procs[TRACE_CALL_SecondaryColor3bvEXT])(v);
+}
+
+static void
+replay_SecondaryColor3dEXT(struct replay_reader *reader)
+{
+   GLdouble red;
+   GLdouble green;
+   GLdouble blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLdouble red, GLdouble green, GLdouble blue)) reader->procs[TRACE_CALL_SecondaryColor3dEXT])(red, green, blue);
+}
+
+static void
+replay_SecondaryColor3dvEXT(struct replay_reader *reader)
+{
+   const GLdouble * v;
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLdouble * v)) reader->procs[TRACE_CALL_SecondaryColor3dvEXT])(v);
+}
+
+static void
+replay_SecondaryColor3fEXT(struct replay_reader *reader)
+{
+   GLfloat red;
+   GLfloat green;
+   GLfloat blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLfloat red, GLfloat green, GLfloat blue)) reader->procs[TRACE_CALL_SecondaryColor3fEXT])(red, green, blue);
+}
+
+static void
+replay_SecondaryColor3fvEXT(struct replay_reader *reader)
+{
+   const GLfloat * v;
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLfloat * v)) reader->procs[TRACE_CALL_SecondaryColor3fvEXT])(v);
+}
+
+static void
+replay_SecondaryColor3iEXT(struct replay_reader *reader)
+{
+   GLint red;
+   GLint green;
+   GLint blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLint red, GLint green, GLint blue)) reader->procs[TRACE_CALL_SecondaryColor3iEXT])(red, green, blue);
+}
+
+static void
+replay_SecondaryColor3ivEXT(struct replay_reader *reader)
+{
+   const GLint * v;
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLint * v)) reader->procs[TRACE_CALL_SecondaryColor3ivEXT])(v);
+}
+
+static void
+replay_SecondaryColor3sEXT(struct replay_reader *reader)
+{
+   GLshort red;
+   GLshort green;
+   GLshort blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLshort red, GLshort green, GLshort blue)) reader->procs[TRACE_CALL_SecondaryColor3sEXT])(red, green, blue);
+}
+
+static void
+replay_SecondaryColor3svEXT(struct replay_reader *reader)
+{
+   const GLshort * v;
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLshort * v)) reader->procs[TRACE_CALL_SecondaryColor3svEXT])(v);
+}
+
+static void
+replay_SecondaryColor3ubEXT(struct replay_reader *reader)
+{
+   GLubyte red;
+   GLubyte green;
+   GLubyte blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLubyte red, GLubyte green, GLubyte blue)) reader->procs[TRACE_CALL_SecondaryColor3ubEXT])(red, green, blue);
+}
+
+static void
+replay_SecondaryColor3ubvEXT(struct replay_reader *reader)
+{
+   const GLubyte * v;
+   v = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLubyte * v)) reader->procs[TRACE_CALL_SecondaryColor3ubvEXT])(v);
+}
+
+static void
+replay_SecondaryColor3uiEXT(struct replay_reader *reader)
+{
+   GLuint red;
+   GLuint green;
+   GLuint blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLuint red, GLuint green, GLuint blue)) reader->procs[TRACE_CALL_SecondaryColor3uiEXT])(red, green, blue);
+}
+
+static void
+replay_SecondaryColor3uivEXT(struct replay_reader *reader)
+{
+   const GLuint * v;
+   v = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLuint * v)) reader->procs[TRACE_CALL_SecondaryColor3uivEXT])(v);
+}
+
+static void
+replay_SecondaryColor3usEXT(struct replay_reader *reader)
+{
+   GLushort red;
+   GLushort green;
+   GLushort blue;
+   replay_read(reader, &red, sizeof(red));
+   replay_read(reader, &green, sizeof(green));
+   replay_read(reader, &blue, sizeof(blue));
+   (*(void (GLAPIENTRYP)(GLushort red, GLushort green, GLushort blue)) reader->procs[TRACE_CALL_SecondaryColor3usEXT])(red, green, blue);
+}
+
+static void
+replay_SecondaryColor3usvEXT(struct replay_reader *reader)
+{
+   const GLushort * v;
+   v = (const GLushort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(const GLushort * v)) reader->procs[TRACE_CALL_SecondaryColor3usvEXT])(v);
+}
+
+static void
+replay_BindProgramNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint program;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &program, sizeof(program));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint program)) reader->procs[TRACE_CALL_BindProgramNV])(target, program);
+}
+
+static void
+replay_DeleteProgramsNV(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLuint * programs;
+   replay_read(reader, &n, sizeof(n));
+   programs = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLuint * programs)) reader->procs[TRACE_CALL_DeleteProgramsNV])(n, programs);
+}
+
+static void
+replay_ExecuteProgramNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint id;
+   const GLfloat * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &id, sizeof(id));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint id, const GLfloat * params)) reader->procs[TRACE_CALL_ExecuteProgramNV])(target, id, params);
+}
+
+static void
+replay_GenProgramsNV(struct replay_reader *reader)
+{
+   GLsizei n;
+   GLuint * programs;
+   replay_read(reader, &n, sizeof(n));
+   programs = (GLuint *) replay_output(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, GLuint * programs)) reader->procs[TRACE_CALL_GenProgramsNV])(n, programs);
+}
+
+static void
+replay_LoadProgramNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint id;
+   GLsizei len;
+   const GLubyte * program;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &id, sizeof(id));
+   replay_read(reader, &len, sizeof(len));
+   program = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint id, GLsizei len, const GLubyte * program)) reader->procs[TRACE_CALL_LoadProgramNV])(target, id, len, program);
+}
+
+static void
+replay_ProgramParameter4dNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) reader->procs[TRACE_CALL_ProgramParameter4dNV])(target, index, x, y, z, w);
+}
+
+static void
+replay_ProgramParameter4dvNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   const GLdouble * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   params = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, const GLdouble * params)) reader->procs[TRACE_CALL_ProgramParameter4dvNV])(target, index, params);
+}
+
+static void
+replay_ProgramParameter4fNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) reader->procs[TRACE_CALL_ProgramParameter4fNV])(target, index, x, y, z, w);
+}
+
+static void
+replay_ProgramParameter4fvNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   const GLfloat * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, const GLfloat * params)) reader->procs[TRACE_CALL_ProgramParameter4fvNV])(target, index, params);
+}
+
+static void
+replay_ProgramParameters4dvNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   GLuint num;
+   const GLdouble * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &num, sizeof(num));
+   params = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, GLuint num, const GLdouble * params)) reader->procs[TRACE_CALL_ProgramParameters4dvNV])(target, index, num, params);
+}
+
+static void
+replay_ProgramParameters4fvNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   GLuint num;
+   const GLfloat * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &num, sizeof(num));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, GLuint num, const GLfloat * params)) reader->procs[TRACE_CALL_ProgramParameters4fvNV])(target, index, num, params);
+}
+
+static void
+replay_RequestResidentProgramsNV(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLuint * ids;
+   replay_read(reader, &n, sizeof(n));
+   ids = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLuint * ids)) reader->procs[TRACE_CALL_RequestResidentProgramsNV])(n, ids);
+}
+
+static void
+replay_TrackMatrixNV(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint address;
+   GLenum matrix;
+   GLenum transform;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &address, sizeof(address));
+   replay_read(reader, &matrix, sizeof(matrix));
+   replay_read(reader, &transform, sizeof(transform));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint address, GLenum matrix, GLenum transform)) reader->procs[TRACE_CALL_TrackMatrixNV])(target, address, matrix, transform);
+}
+
+static void
+replay_VertexAttrib1dARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLdouble x;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   (*(void (GLAPIENTRYP)(GLuint index, GLdouble x)) reader->procs[TRACE_CALL_VertexAttrib1dARB])(index, x);
+}
+
+static void
+replay_VertexAttrib1dvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttrib1dvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib1fARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLfloat x;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   (*(void (GLAPIENTRYP)(GLuint index, GLfloat x)) reader->procs[TRACE_CALL_VertexAttrib1fARB])(index, x);
+}
+
+static void
+replay_VertexAttrib1fvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttrib1fvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib1sARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLshort x;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   (*(void (GLAPIENTRYP)(GLuint index, GLshort x)) reader->procs[TRACE_CALL_VertexAttrib1sARB])(index, x);
+}
+
+static void
+replay_VertexAttrib1svARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttrib1svARB])(index, v);
+}
+
+static void
+replay_VertexAttrib2dARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLuint index, GLdouble x, GLdouble y)) reader->procs[TRACE_CALL_VertexAttrib2dARB])(index, x, y);
+}
+
+static void
+replay_VertexAttrib2dvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttrib2dvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib2fARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLuint index, GLfloat x, GLfloat y)) reader->procs[TRACE_CALL_VertexAttrib2fARB])(index, x, y);
+}
+
+static void
+replay_VertexAttrib2fvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttrib2fvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib2sARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLuint index, GLshort x, GLshort y)) reader->procs[TRACE_CALL_VertexAttrib2sARB])(index, x, y);
+}
+
+static void
+replay_VertexAttrib2svARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttrib2svARB])(index, v);
+}
+
+static void
+replay_VertexAttrib3dARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLuint index, GLdouble x, GLdouble y, GLdouble z)) reader->procs[TRACE_CALL_VertexAttrib3dARB])(index, x, y, z);
+}
+
+static void
+replay_VertexAttrib3dvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttrib3dvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib3fARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLuint index, GLfloat x, GLfloat y, GLfloat z)) reader->procs[TRACE_CALL_VertexAttrib3fARB])(index, x, y, z);
+}
+
+static void
+replay_VertexAttrib3fvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttrib3fvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib3sARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLuint index, GLshort x, GLshort y, GLshort z)) reader->procs[TRACE_CALL_VertexAttrib3sARB])(index, x, y, z);
+}
+
+static void
+replay_VertexAttrib3svARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttrib3svARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4dARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) reader->procs[TRACE_CALL_VertexAttrib4dARB])(index, x, y, z, w);
+}
+
+static void
+replay_VertexAttrib4dvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttrib4dvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4fARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) reader->procs[TRACE_CALL_VertexAttrib4fARB])(index, x, y, z, w);
+}
+
+static void
+replay_VertexAttrib4fvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttrib4fvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4sARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)) reader->procs[TRACE_CALL_VertexAttrib4sARB])(index, x, y, z, w);
+}
+
+static void
+replay_VertexAttrib4svARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttrib4svARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4NubARB(struct replay_reader *reader)
+{
+   GLuint index;
+   GLubyte x;
+   GLubyte y;
+   GLubyte z;
+   GLubyte w;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)) reader->procs[TRACE_CALL_VertexAttrib4NubARB])(index, x, y, z, w);
+}
+
+static void
+replay_VertexAttrib4NubvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLubyte * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLubyte * v)) reader->procs[TRACE_CALL_VertexAttrib4NubvARB])(index, v);
+}
+
+static void
+replay_VertexAttribs1dvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttribs1dvNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs1fvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttribs1fvNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs1svNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttribs1svNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs2dvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttribs2dvNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs2fvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttribs2fvNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs2svNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttribs2svNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs3dvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttribs3dvNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs3fvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttribs3fvNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs3svNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttribs3svNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs4dvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttribs4dvNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs4fvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttribs4fvNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs4svNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttribs4svNV])(index, n, v);
+}
+
+static void
+replay_VertexAttribs4ubvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLsizei n;
+   const GLubyte * v;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &n, sizeof(n));
+   v = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, GLsizei n, const GLubyte * v)) reader->procs[TRACE_CALL_VertexAttribs4ubvNV])(index, n, v);
+}
+
+static void
+replay_PointParameteriNV(struct replay_reader *reader)
+{
+   GLenum pname;
+   GLint param;
+   replay_read(reader, &pname, sizeof(pname));
+   replay_read(reader, &param, sizeof(param));
+   (*(void (GLAPIENTRYP)(GLenum pname, GLint param)) reader->procs[TRACE_CALL_PointParameteriNV])(pname, param);
+}
+
+static void
+replay_PointParameterivNV(struct replay_reader *reader)
+{
+   GLenum pname;
+   const GLint * params;
+   replay_read(reader, &pname, sizeof(pname));
+   params = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum pname, const GLint * params)) reader->procs[TRACE_CALL_PointParameterivNV])(pname, params);
+}
+
+static void
+replay_MultiDrawArraysEXT(struct replay_reader *reader)
+{
+   GLenum mode;
+   GLint * first;
+   GLsizei * count;
+   GLsizei primcount;
+   replay_read(reader, &mode, sizeof(mode));
+   first = (GLint *) replay_array(reader);
+   count = (GLsizei *) replay_array(reader);
+   replay_read(reader, &primcount, sizeof(primcount));
+   (*(void (GLAPIENTRYP)(GLenum mode, GLint * first, GLsizei * count, GLsizei primcount)) reader->procs[TRACE_CALL_MultiDrawArraysEXT])(mode, first, count, primcount);
+}
+
+static void
+replay_ActiveStencilFaceEXT(struct replay_reader *reader)
+{
+   GLenum face;
+   replay_read(reader, &face, sizeof(face));
+   (*(void (GLAPIENTRYP)(GLenum face)) reader->procs[TRACE_CALL_ActiveStencilFaceEXT])(face);
+}
+
+static void
+replay_DeleteFencesNV(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLuint * fences;
+   replay_read(reader, &n, sizeof(n));
+   fences = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLuint * fences)) reader->procs[TRACE_CALL_DeleteFencesNV])(n, fences);
+}
+
+static void
+replay_GenFencesNV(struct replay_reader *reader)
+{
+   GLsizei n;
+   GLuint * fences;
+   replay_read(reader, &n, sizeof(n));
+   fences = (GLuint *) replay_output(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, GLuint * fences)) reader->procs[TRACE_CALL_GenFencesNV])(n, fences);
+}
+
+static void
+replay_FinishFenceNV(struct replay_reader *reader)
+{
+   GLuint fence;
+   replay_read(reader, &fence, sizeof(fence));
+   (*(void (GLAPIENTRYP)(GLuint fence)) reader->procs[TRACE_CALL_FinishFenceNV])(fence);
+}
+
+static void
+replay_SetFenceNV(struct replay_reader *reader)
+{
+   GLuint fence;
+   GLenum condition;
+   replay_read(reader, &fence, sizeof(fence));
+   replay_read(reader, &condition, sizeof(condition));
+   (*(void (GLAPIENTRYP)(GLuint fence, GLenum condition)) reader->procs[TRACE_CALL_SetFenceNV])(fence, condition);
+}
+
+static void
+replay_VertexAttrib4bvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLbyte * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLbyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLbyte * v)) reader->procs[TRACE_CALL_VertexAttrib4bvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4ivARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLint * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLint * v)) reader->procs[TRACE_CALL_VertexAttrib4ivARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4ubvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLubyte * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLubyte * v)) reader->procs[TRACE_CALL_VertexAttrib4ubvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4usvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLushort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLushort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLushort * v)) reader->procs[TRACE_CALL_VertexAttrib4usvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4uivARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLuint * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLuint * v)) reader->procs[TRACE_CALL_VertexAttrib4uivARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4NbvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLbyte * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLbyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLbyte * v)) reader->procs[TRACE_CALL_VertexAttrib4NbvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4NsvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttrib4NsvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4NivARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLint * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLint * v)) reader->procs[TRACE_CALL_VertexAttrib4NivARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4NusvARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLushort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLushort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLushort * v)) reader->procs[TRACE_CALL_VertexAttrib4NusvARB])(index, v);
+}
+
+static void
+replay_VertexAttrib4NuivARB(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLuint * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLuint * v)) reader->procs[TRACE_CALL_VertexAttrib4NuivARB])(index, v);
+}
+
+static void
+replay_EnableVertexAttribArrayARB(struct replay_reader *reader)
+{
+   GLuint index;
+   replay_read(reader, &index, sizeof(index));
+   (*(void (GLAPIENTRYP)(GLuint index)) reader->procs[TRACE_CALL_EnableVertexAttribArrayARB])(index);
+}
+
+static void
+replay_DisableVertexAttribArrayARB(struct replay_reader *reader)
+{
+   GLuint index;
+   replay_read(reader, &index, sizeof(index));
+   (*(void (GLAPIENTRYP)(GLuint index)) reader->procs[TRACE_CALL_DisableVertexAttribArrayARB])(index);
+}
+
+static void
+replay_ProgramStringARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum format;
+   GLsizei len;
+   const GLvoid * string;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &format, sizeof(format));
+   replay_read(reader, &len, sizeof(len));
+   string = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum format, GLsizei len, const GLvoid * string)) reader->procs[TRACE_CALL_ProgramStringARB])(target, format, len, string);
+}
+
+static void
+replay_ProgramEnvParameter4dARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) reader->procs[TRACE_CALL_ProgramEnvParameter4dARB])(target, index, x, y, z, w);
+}
+
+static void
+replay_ProgramEnvParameter4dvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   const GLdouble * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   params = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, const GLdouble * params)) reader->procs[TRACE_CALL_ProgramEnvParameter4dvARB])(target, index, params);
+}
+
+static void
+replay_ProgramEnvParameter4fARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) reader->procs[TRACE_CALL_ProgramEnvParameter4fARB])(target, index, x, y, z, w);
+}
+
+static void
+replay_ProgramEnvParameter4fvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   const GLfloat * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, const GLfloat * params)) reader->procs[TRACE_CALL_ProgramEnvParameter4fvARB])(target, index, params);
+}
+
+static void
+replay_ProgramLocalParameter4dARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) reader->procs[TRACE_CALL_ProgramLocalParameter4dARB])(target, index, x, y, z, w);
+}
+
+static void
+replay_ProgramLocalParameter4dvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   const GLdouble * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   params = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, const GLdouble * params)) reader->procs[TRACE_CALL_ProgramLocalParameter4dvARB])(target, index, params);
+}
+
+static void
+replay_ProgramLocalParameter4fARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) reader->procs[TRACE_CALL_ProgramLocalParameter4fARB])(target, index, x, y, z, w);
+}
+
+static void
+replay_ProgramLocalParameter4fvARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint index;
+   const GLfloat * params;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &index, sizeof(index));
+   params = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint index, const GLfloat * params)) reader->procs[TRACE_CALL_ProgramLocalParameter4fvARB])(target, index, params);
+}
+
+static void
+replay_ProgramNamedParameter4fNV(struct replay_reader *reader)
+{
+   GLuint id;
+   GLsizei len;
+   const GLubyte * name;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+   replay_read(reader, &id, sizeof(id));
+   replay_read(reader, &len, sizeof(len));
+   name = (const GLubyte *) replay_array(reader);
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) reader->procs[TRACE_CALL_ProgramNamedParameter4fNV])(id, len, name, x, y, z, w);
+}
+
+static void
+replay_ProgramNamedParameter4dNV(struct replay_reader *reader)
+{
+   GLuint id;
+   GLsizei len;
+   const GLubyte * name;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+   replay_read(reader, &id, sizeof(id));
+   replay_read(reader, &len, sizeof(len));
+   name = (const GLubyte *) replay_array(reader);
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) reader->procs[TRACE_CALL_ProgramNamedParameter4dNV])(id, len, name, x, y, z, w);
+}
+
+static void
+replay_ProgramNamedParameter4fvNV(struct replay_reader *reader)
+{
+   GLuint id;
+   GLsizei len;
+   const GLubyte * name;
+   const GLfloat * v;
+   replay_read(reader, &id, sizeof(id));
+   replay_read(reader, &len, sizeof(len));
+   name = (const GLubyte *) replay_array(reader);
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v)) reader->procs[TRACE_CALL_ProgramNamedParameter4fvNV])(id, len, name, v);
+}
+
+static void
+replay_ProgramNamedParameter4dvNV(struct replay_reader *reader)
+{
+   GLuint id;
+   GLsizei len;
+   const GLubyte * name;
+   const GLdouble * v;
+   replay_read(reader, &id, sizeof(id));
+   replay_read(reader, &len, sizeof(len));
+   name = (const GLubyte *) replay_array(reader);
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v)) reader->procs[TRACE_CALL_ProgramNamedParameter4dvNV])(id, len, name, v);
+}
+
+static void
+replay_BindBufferARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint buffer;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &buffer, sizeof(buffer));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint buffer)) reader->procs[TRACE_CALL_BindBufferARB])(target, buffer);
+}
+
+static void
+replay_BufferDataARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLsizeiptrARB size;
+   const GLvoid * data;
+   GLenum usage;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &size, sizeof(size));
+   data = (const GLvoid *) replay_array(reader);
+   replay_read(reader, &usage, sizeof(usage));
+   (*(void (GLAPIENTRYP)(GLenum target, GLsizeiptrARB size, const GLvoid * data, GLenum usage)) reader->procs[TRACE_CALL_BufferDataARB])(target, size, data, usage);
+}
+
+static void
+replay_BufferSubDataARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLintptrARB offset;
+   GLsizeiptrARB size;
+   const GLvoid * data;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &offset, sizeof(offset));
+   replay_read(reader, &size, sizeof(size));
+   data = (const GLvoid *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const GLvoid * data)) reader->procs[TRACE_CALL_BufferSubDataARB])(target, offset, size, data);
+}
+
+static void
+replay_DeleteBuffersARB(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLuint * buffer;
+   replay_read(reader, &n, sizeof(n));
+   buffer = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLuint * buffer)) reader->procs[TRACE_CALL_DeleteBuffersARB])(n, buffer);
+}
+
+static void
+replay_GenBuffersARB(struct replay_reader *reader)
+{
+   GLsizei n;
+   GLuint * buffer;
+   replay_read(reader, &n, sizeof(n));
+   buffer = (GLuint *) replay_output(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, GLuint * buffer)) reader->procs[TRACE_CALL_GenBuffersARB])(n, buffer);
+}
+
+static void
+replay_MapBufferARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum access;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &access, sizeof(access));
+   (*(GLvoid * (GLAPIENTRYP)(GLenum target, GLenum access)) reader->procs[TRACE_CALL_MapBufferARB])(target, access);
+}
+
+static void
+replay_DepthBoundsEXT(struct replay_reader *reader)
+{
+   GLclampd zmin;
+   GLclampd zmax;
+   replay_read(reader, &zmin, sizeof(zmin));
+   replay_read(reader, &zmax, sizeof(zmax));
+   (*(void (GLAPIENTRYP)(GLclampd zmin, GLclampd zmax)) reader->procs[TRACE_CALL_DepthBoundsEXT])(zmin, zmax);
+}
+
+static void
+replay_GenQueriesARB(struct replay_reader *reader)
+{
+   GLsizei n;
+   GLuint * ids;
+   replay_read(reader, &n, sizeof(n));
+   ids = (GLuint *) replay_output(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, GLuint * ids)) reader->procs[TRACE_CALL_GenQueriesARB])(n, ids);
+}
+
+static void
+replay_DeleteQueriesARB(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLuint * ids;
+   replay_read(reader, &n, sizeof(n));
+   ids = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLuint * ids)) reader->procs[TRACE_CALL_DeleteQueriesARB])(n, ids);
+}
+
+static void
+replay_BeginQueryARB(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint id;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &id, sizeof(id));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint id)) reader->procs[TRACE_CALL_BeginQueryARB])(target, id);
+}
+
+static void
+replay_EndQueryARB(struct replay_reader *reader)
+{
+   GLenum target;
+   replay_read(reader, &target, sizeof(target));
+   (*(void (GLAPIENTRYP)(GLenum target)) reader->procs[TRACE_CALL_EndQueryARB])(target);
+}
+
+static void
+replay_BlendEquationSeparateEXT(struct replay_reader *reader)
+{
+   GLenum modeRGB;
+   GLenum modeA;
+   replay_read(reader, &modeRGB, sizeof(modeRGB));
+   replay_read(reader, &modeA, sizeof(modeA));
+   (*(void (GLAPIENTRYP)(GLenum modeRGB, GLenum modeA)) reader->procs[TRACE_CALL_BlendEquationSeparateEXT])(modeRGB, modeA);
+}
+
+static void
+replay_DeleteObjectARB(struct replay_reader *reader)
+{
+   GLhandleARB obj;
+   replay_read(reader, &obj, sizeof(obj));
+   (*(void (GLAPIENTRYP)(GLhandleARB obj)) reader->procs[TRACE_CALL_DeleteObjectARB])(obj);
+}
+
+static void
+replay_DetachObjectARB(struct replay_reader *reader)
+{
+   GLhandleARB containerObj;
+   GLhandleARB attachedObj;
+   replay_read(reader, &containerObj, sizeof(containerObj));
+   replay_read(reader, &attachedObj, sizeof(attachedObj));
+   (*(void (GLAPIENTRYP)(GLhandleARB containerObj, GLhandleARB attachedObj)) reader->procs[TRACE_CALL_DetachObjectARB])(containerObj, attachedObj);
+}
+
+static void
+replay_CreateShaderObjectARB(struct replay_reader *reader)
+{
+   GLenum shaderType;
+   replay_read(reader, &shaderType, sizeof(shaderType));
+   (*(GLhandleARB (GLAPIENTRYP)(GLenum shaderType)) reader->procs[TRACE_CALL_CreateShaderObjectARB])(shaderType);
+}
+
+static void
+replay_CompileShaderARB(struct replay_reader *reader)
+{
+   GLhandleARB shaderObj;
+   replay_read(reader, &shaderObj, sizeof(shaderObj));
+   (*(void (GLAPIENTRYP)(GLhandleARB shaderObj)) reader->procs[TRACE_CALL_CompileShaderARB])(shaderObj);
+}
+
+static void
+replay_CreateProgramObjectARB(struct replay_reader *reader)
+{
+   (*(GLhandleARB (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_CreateProgramObjectARB])();
+}
+
+static void
+replay_AttachObjectARB(struct replay_reader *reader)
+{
+   GLhandleARB containerObj;
+   GLhandleARB obj;
+   replay_read(reader, &containerObj, sizeof(containerObj));
+   replay_read(reader, &obj, sizeof(obj));
+   (*(void (GLAPIENTRYP)(GLhandleARB containerObj, GLhandleARB obj)) reader->procs[TRACE_CALL_AttachObjectARB])(containerObj, obj);
+}
+
+static void
+replay_LinkProgramARB(struct replay_reader *reader)
+{
+   GLhandleARB programObj;
+   replay_read(reader, &programObj, sizeof(programObj));
+   (*(void (GLAPIENTRYP)(GLhandleARB programObj)) reader->procs[TRACE_CALL_LinkProgramARB])(programObj);
+}
+
+static void
+replay_UseProgramObjectARB(struct replay_reader *reader)
+{
+   GLhandleARB programObj;
+   replay_read(reader, &programObj, sizeof(programObj));
+   (*(void (GLAPIENTRYP)(GLhandleARB programObj)) reader->procs[TRACE_CALL_UseProgramObjectARB])(programObj);
+}
+
+static void
+replay_ValidateProgramARB(struct replay_reader *reader)
+{
+   GLhandleARB programObj;
+   replay_read(reader, &programObj, sizeof(programObj));
+   (*(void (GLAPIENTRYP)(GLhandleARB programObj)) reader->procs[TRACE_CALL_ValidateProgramARB])(programObj);
+}
+
+static void
+replay_Uniform1fARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLfloat v0;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &v0, sizeof(v0));
+   (*(void (GLAPIENTRYP)(GLint location, GLfloat v0)) reader->procs[TRACE_CALL_Uniform1fARB])(location, v0);
+}
+
+static void
+replay_Uniform2fARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLfloat v0;
+   GLfloat v1;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &v0, sizeof(v0));
+   replay_read(reader, &v1, sizeof(v1));
+   (*(void (GLAPIENTRYP)(GLint location, GLfloat v0, GLfloat v1)) reader->procs[TRACE_CALL_Uniform2fARB])(location, v0, v1);
+}
+
+static void
+replay_Uniform3fARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLfloat v0;
+   GLfloat v1;
+   GLfloat v2;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &v0, sizeof(v0));
+   replay_read(reader, &v1, sizeof(v1));
+   replay_read(reader, &v2, sizeof(v2));
+   (*(void (GLAPIENTRYP)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)) reader->procs[TRACE_CALL_Uniform3fARB])(location, v0, v1, v2);
+}
+
+static void
+replay_Uniform4fARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLfloat v0;
+   GLfloat v1;
+   GLfloat v2;
+   GLfloat v3;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &v0, sizeof(v0));
+   replay_read(reader, &v1, sizeof(v1));
+   replay_read(reader, &v2, sizeof(v2));
+   replay_read(reader, &v3, sizeof(v3));
+   (*(void (GLAPIENTRYP)(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)) reader->procs[TRACE_CALL_Uniform4fARB])(location, v0, v1, v2, v3);
+}
+
+static void
+replay_Uniform1iARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLint v0;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &v0, sizeof(v0));
+   (*(void (GLAPIENTRYP)(GLint location, GLint v0)) reader->procs[TRACE_CALL_Uniform1iARB])(location, v0);
+}
+
+static void
+replay_Uniform2iARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLint v0;
+   GLint v1;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &v0, sizeof(v0));
+   replay_read(reader, &v1, sizeof(v1));
+   (*(void (GLAPIENTRYP)(GLint location, GLint v0, GLint v1)) reader->procs[TRACE_CALL_Uniform2iARB])(location, v0, v1);
+}
+
+static void
+replay_Uniform3iARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLint v0;
+   GLint v1;
+   GLint v2;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &v0, sizeof(v0));
+   replay_read(reader, &v1, sizeof(v1));
+   replay_read(reader, &v2, sizeof(v2));
+   (*(void (GLAPIENTRYP)(GLint location, GLint v0, GLint v1, GLint v2)) reader->procs[TRACE_CALL_Uniform3iARB])(location, v0, v1, v2);
+}
+
+static void
+replay_Uniform4iARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLint v0;
+   GLint v1;
+   GLint v2;
+   GLint v3;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &v0, sizeof(v0));
+   replay_read(reader, &v1, sizeof(v1));
+   replay_read(reader, &v2, sizeof(v2));
+   replay_read(reader, &v3, sizeof(v3));
+   (*(void (GLAPIENTRYP)(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)) reader->procs[TRACE_CALL_Uniform4iARB])(location, v0, v1, v2, v3);
+}
+
+static void
+replay_Uniform1fvARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   const GLfloat * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   value = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, const GLfloat * value)) reader->procs[TRACE_CALL_Uniform1fvARB])(location, count, value);
+}
+
+static void
+replay_Uniform2fvARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   const GLfloat * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   value = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, const GLfloat * value)) reader->procs[TRACE_CALL_Uniform2fvARB])(location, count, value);
+}
+
+static void
+replay_Uniform3fvARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   const GLfloat * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   value = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, const GLfloat * value)) reader->procs[TRACE_CALL_Uniform3fvARB])(location, count, value);
+}
+
+static void
+replay_Uniform4fvARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   const GLfloat * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   value = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, const GLfloat * value)) reader->procs[TRACE_CALL_Uniform4fvARB])(location, count, value);
+}
+
+static void
+replay_Uniform1ivARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   const GLint * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   value = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, const GLint * value)) reader->procs[TRACE_CALL_Uniform1ivARB])(location, count, value);
+}
+
+static void
+replay_Uniform2ivARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   const GLint * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   value = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, const GLint * value)) reader->procs[TRACE_CALL_Uniform2ivARB])(location, count, value);
+}
+
+static void
+replay_Uniform3ivARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   const GLint * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   value = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, const GLint * value)) reader->procs[TRACE_CALL_Uniform3ivARB])(location, count, value);
+}
+
+static void
+replay_Uniform4ivARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   const GLint * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   value = (const GLint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, const GLint * value)) reader->procs[TRACE_CALL_Uniform4ivARB])(location, count, value);
+}
+
+static void
+replay_UniformMatrix2fvARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   GLboolean transpose;
+   const GLfloat * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   replay_read(reader, &transpose, sizeof(transpose));
+   value = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)) reader->procs[TRACE_CALL_UniformMatrix2fvARB])(location, count, transpose, value);
+}
+
+static void
+replay_UniformMatrix3fvARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   GLboolean transpose;
+   const GLfloat * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   replay_read(reader, &transpose, sizeof(transpose));
+   value = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)) reader->procs[TRACE_CALL_UniformMatrix3fvARB])(location, count, transpose, value);
+}
+
+static void
+replay_UniformMatrix4fvARB(struct replay_reader *reader)
+{
+   GLint location;
+   GLsizei count;
+   GLboolean transpose;
+   const GLfloat * value;
+   replay_read(reader, &location, sizeof(location));
+   replay_read(reader, &count, sizeof(count));
+   replay_read(reader, &transpose, sizeof(transpose));
+   value = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)) reader->procs[TRACE_CALL_UniformMatrix4fvARB])(location, count, transpose, value);
+}
+
+static void
+replay_BindAttribLocationARB(struct replay_reader *reader)
+{
+   GLhandleARB programObj;
+   GLuint index;
+   const GLcharARB * name;
+   replay_read(reader, &programObj, sizeof(programObj));
+   replay_read(reader, &index, sizeof(index));
+   name = (const GLcharARB *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLhandleARB programObj, GLuint index, const GLcharARB * name)) reader->procs[TRACE_CALL_BindAttribLocationARB])(programObj, index, name);
+}
+
+static void
+replay_VertexAttrib1dNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLdouble x;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   (*(void (GLAPIENTRYP)(GLuint index, GLdouble x)) reader->procs[TRACE_CALL_VertexAttrib1dNV])(index, x);
+}
+
+static void
+replay_VertexAttrib1dvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttrib1dvNV])(index, v);
+}
+
+static void
+replay_VertexAttrib1fNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLfloat x;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   (*(void (GLAPIENTRYP)(GLuint index, GLfloat x)) reader->procs[TRACE_CALL_VertexAttrib1fNV])(index, x);
+}
+
+static void
+replay_VertexAttrib1fvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttrib1fvNV])(index, v);
+}
+
+static void
+replay_VertexAttrib1sNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLshort x;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   (*(void (GLAPIENTRYP)(GLuint index, GLshort x)) reader->procs[TRACE_CALL_VertexAttrib1sNV])(index, x);
+}
+
+static void
+replay_VertexAttrib1svNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttrib1svNV])(index, v);
+}
+
+static void
+replay_VertexAttrib2dNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLuint index, GLdouble x, GLdouble y)) reader->procs[TRACE_CALL_VertexAttrib2dNV])(index, x, y);
+}
+
+static void
+replay_VertexAttrib2dvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttrib2dvNV])(index, v);
+}
+
+static void
+replay_VertexAttrib2fNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLuint index, GLfloat x, GLfloat y)) reader->procs[TRACE_CALL_VertexAttrib2fNV])(index, x, y);
+}
+
+static void
+replay_VertexAttrib2fvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttrib2fvNV])(index, v);
+}
+
+static void
+replay_VertexAttrib2sNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   (*(void (GLAPIENTRYP)(GLuint index, GLshort x, GLshort y)) reader->procs[TRACE_CALL_VertexAttrib2sNV])(index, x, y);
+}
+
+static void
+replay_VertexAttrib2svNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttrib2svNV])(index, v);
+}
+
+static void
+replay_VertexAttrib3dNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLuint index, GLdouble x, GLdouble y, GLdouble z)) reader->procs[TRACE_CALL_VertexAttrib3dNV])(index, x, y, z);
+}
+
+static void
+replay_VertexAttrib3dvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttrib3dvNV])(index, v);
+}
+
+static void
+replay_VertexAttrib3fNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLuint index, GLfloat x, GLfloat y, GLfloat z)) reader->procs[TRACE_CALL_VertexAttrib3fNV])(index, x, y, z);
+}
+
+static void
+replay_VertexAttrib3fvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttrib3fvNV])(index, v);
+}
+
+static void
+replay_VertexAttrib3sNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   (*(void (GLAPIENTRYP)(GLuint index, GLshort x, GLshort y, GLshort z)) reader->procs[TRACE_CALL_VertexAttrib3sNV])(index, x, y, z);
+}
+
+static void
+replay_VertexAttrib3svNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttrib3svNV])(index, v);
+}
+
+static void
+replay_VertexAttrib4dNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)) reader->procs[TRACE_CALL_VertexAttrib4dNV])(index, x, y, z, w);
+}
+
+static void
+replay_VertexAttrib4dvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLdouble * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLdouble *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLdouble * v)) reader->procs[TRACE_CALL_VertexAttrib4dvNV])(index, v);
+}
+
+static void
+replay_VertexAttrib4fNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)) reader->procs[TRACE_CALL_VertexAttrib4fNV])(index, x, y, z, w);
+}
+
+static void
+replay_VertexAttrib4fvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLfloat * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLfloat * v)) reader->procs[TRACE_CALL_VertexAttrib4fvNV])(index, v);
+}
+
+static void
+replay_VertexAttrib4sNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)) reader->procs[TRACE_CALL_VertexAttrib4sNV])(index, x, y, z, w);
+}
+
+static void
+replay_VertexAttrib4svNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLshort * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLshort *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLshort * v)) reader->procs[TRACE_CALL_VertexAttrib4svNV])(index, v);
+}
+
+static void
+replay_VertexAttrib4ubNV(struct replay_reader *reader)
+{
+   GLuint index;
+   GLubyte x;
+   GLubyte y;
+   GLubyte z;
+   GLubyte w;
+   replay_read(reader, &index, sizeof(index));
+   replay_read(reader, &x, sizeof(x));
+   replay_read(reader, &y, sizeof(y));
+   replay_read(reader, &z, sizeof(z));
+   replay_read(reader, &w, sizeof(w));
+   (*(void (GLAPIENTRYP)(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)) reader->procs[TRACE_CALL_VertexAttrib4ubNV])(index, x, y, z, w);
+}
+
+static void
+replay_VertexAttrib4ubvNV(struct replay_reader *reader)
+{
+   GLuint index;
+   const GLubyte * v;
+   replay_read(reader, &index, sizeof(index));
+   v = (const GLubyte *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint index, const GLubyte * v)) reader->procs[TRACE_CALL_VertexAttrib4ubvNV])(index, v);
+}
+
+static void
+replay_GenFragmentShadersATI(struct replay_reader *reader)
+{
+   GLuint range;
+   replay_read(reader, &range, sizeof(range));
+   (*(GLuint (GLAPIENTRYP)(GLuint range)) reader->procs[TRACE_CALL_GenFragmentShadersATI])(range);
+}
+
+static void
+replay_BindFragmentShaderATI(struct replay_reader *reader)
+{
+   GLuint id;
+   replay_read(reader, &id, sizeof(id));
+   (*(void (GLAPIENTRYP)(GLuint id)) reader->procs[TRACE_CALL_BindFragmentShaderATI])(id);
+}
+
+static void
+replay_DeleteFragmentShaderATI(struct replay_reader *reader)
+{
+   GLuint id;
+   replay_read(reader, &id, sizeof(id));
+   (*(void (GLAPIENTRYP)(GLuint id)) reader->procs[TRACE_CALL_DeleteFragmentShaderATI])(id);
+}
+
+static void
+replay_BeginFragmentShaderATI(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_BeginFragmentShaderATI])();
+}
+
+static void
+replay_EndFragmentShaderATI(struct replay_reader *reader)
+{
+   (*(void (GLAPIENTRYP)(void)) reader->procs[TRACE_CALL_EndFragmentShaderATI])();
+}
+
+static void
+replay_PassTexCoordATI(struct replay_reader *reader)
+{
+   GLuint dst;
+   GLuint coord;
+   GLenum swizzle;
+   replay_read(reader, &dst, sizeof(dst));
+   replay_read(reader, &coord, sizeof(coord));
+   replay_read(reader, &swizzle, sizeof(swizzle));
+   (*(void (GLAPIENTRYP)(GLuint dst, GLuint coord, GLenum swizzle)) reader->procs[TRACE_CALL_PassTexCoordATI])(dst, coord, swizzle);
+}
+
+static void
+replay_SampleMapATI(struct replay_reader *reader)
+{
+   GLuint dst;
+   GLuint interp;
+   GLenum swizzle;
+   replay_read(reader, &dst, sizeof(dst));
+   replay_read(reader, &interp, sizeof(interp));
+   replay_read(reader, &swizzle, sizeof(swizzle));
+   (*(void (GLAPIENTRYP)(GLuint dst, GLuint interp, GLenum swizzle)) reader->procs[TRACE_CALL_SampleMapATI])(dst, interp, swizzle);
+}
+
+static void
+replay_ColorFragmentOp1ATI(struct replay_reader *reader)
+{
+   GLenum op;
+   GLuint dst;
+   GLuint dstMask;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   replay_read(reader, &op, sizeof(op));
+   replay_read(reader, &dst, sizeof(dst));
+   replay_read(reader, &dstMask, sizeof(dstMask));
+   replay_read(reader, &dstMod, sizeof(dstMod));
+   replay_read(reader, &arg1, sizeof(arg1));
+   replay_read(reader, &arg1Rep, sizeof(arg1Rep));
+   replay_read(reader, &arg1Mod, sizeof(arg1Mod));
+   (*(void (GLAPIENTRYP)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)) reader->procs[TRACE_CALL_ColorFragmentOp1ATI])(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod);
+}
+
+static void
+replay_ColorFragmentOp2ATI(struct replay_reader *reader)
+{
+   GLenum op;
+   GLuint dst;
+   GLuint dstMask;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   GLuint arg2;
+   GLuint arg2Rep;
+   GLuint arg2Mod;
+   replay_read(reader, &op, sizeof(op));
+   replay_read(reader, &dst, sizeof(dst));
+   replay_read(reader, &dstMask, sizeof(dstMask));
+   replay_read(reader, &dstMod, sizeof(dstMod));
+   replay_read(reader, &arg1, sizeof(arg1));
+   replay_read(reader, &arg1Rep, sizeof(arg1Rep));
+   replay_read(reader, &arg1Mod, sizeof(arg1Mod));
+   replay_read(reader, &arg2, sizeof(arg2));
+   replay_read(reader, &arg2Rep, sizeof(arg2Rep));
+   replay_read(reader, &arg2Mod, sizeof(arg2Mod));
+   (*(void (GLAPIENTRYP)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)) reader->procs[TRACE_CALL_ColorFragmentOp2ATI])(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
+}
+
+static void
+replay_ColorFragmentOp3ATI(struct replay_reader *reader)
+{
+   GLenum op;
+   GLuint dst;
+   GLuint dstMask;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   GLuint arg2;
+   GLuint arg2Rep;
+   GLuint arg2Mod;
+   GLuint arg3;
+   GLuint arg3Rep;
+   GLuint arg3Mod;
+   replay_read(reader, &op, sizeof(op));
+   replay_read(reader, &dst, sizeof(dst));
+   replay_read(reader, &dstMask, sizeof(dstMask));
+   replay_read(reader, &dstMod, sizeof(dstMod));
+   replay_read(reader, &arg1, sizeof(arg1));
+   replay_read(reader, &arg1Rep, sizeof(arg1Rep));
+   replay_read(reader, &arg1Mod, sizeof(arg1Mod));
+   replay_read(reader, &arg2, sizeof(arg2));
+   replay_read(reader, &arg2Rep, sizeof(arg2Rep));
+   replay_read(reader, &arg2Mod, sizeof(arg2Mod));
+   replay_read(reader, &arg3, sizeof(arg3));
+   replay_read(reader, &arg3Rep, sizeof(arg3Rep));
+   replay_read(reader, &arg3Mod, sizeof(arg3Mod));
+   (*(void (GLAPIENTRYP)(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)) reader->procs[TRACE_CALL_ColorFragmentOp3ATI])(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
+}
+
+static void
+replay_AlphaFragmentOp1ATI(struct replay_reader *reader)
+{
+   GLenum op;
+   GLuint dst;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   replay_read(reader, &op, sizeof(op));
+   replay_read(reader, &dst, sizeof(dst));
+   replay_read(reader, &dstMod, sizeof(dstMod));
+   replay_read(reader, &arg1, sizeof(arg1));
+   replay_read(reader, &arg1Rep, sizeof(arg1Rep));
+   replay_read(reader, &arg1Mod, sizeof(arg1Mod));
+   (*(void (GLAPIENTRYP)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)) reader->procs[TRACE_CALL_AlphaFragmentOp1ATI])(op, dst, dstMod, arg1, arg1Rep, arg1Mod);
+}
+
+static void
+replay_AlphaFragmentOp2ATI(struct replay_reader *reader)
+{
+   GLenum op;
+   GLuint dst;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   GLuint arg2;
+   GLuint arg2Rep;
+   GLuint arg2Mod;
+   replay_read(reader, &op, sizeof(op));
+   replay_read(reader, &dst, sizeof(dst));
+   replay_read(reader, &dstMod, sizeof(dstMod));
+   replay_read(reader, &arg1, sizeof(arg1));
+   replay_read(reader, &arg1Rep, sizeof(arg1Rep));
+   replay_read(reader, &arg1Mod, sizeof(arg1Mod));
+   replay_read(reader, &arg2, sizeof(arg2));
+   replay_read(reader, &arg2Rep, sizeof(arg2Rep));
+   replay_read(reader, &arg2Mod, sizeof(arg2Mod));
+   (*(void (GLAPIENTRYP)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)) reader->procs[TRACE_CALL_AlphaFragmentOp2ATI])(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
+}
+
+static void
+replay_AlphaFragmentOp3ATI(struct replay_reader *reader)
+{
+   GLenum op;
+   GLuint dst;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   GLuint arg2;
+   GLuint arg2Rep;
+   GLuint arg2Mod;
+   GLuint arg3;
+   GLuint arg3Rep;
+   GLuint arg3Mod;
+   replay_read(reader, &op, sizeof(op));
+   replay_read(reader, &dst, sizeof(dst));
+   replay_read(reader, &dstMod, sizeof(dstMod));
+   replay_read(reader, &arg1, sizeof(arg1));
+   replay_read(reader, &arg1Rep, sizeof(arg1Rep));
+   replay_read(reader, &arg1Mod, sizeof(arg1Mod));
+   replay_read(reader, &arg2, sizeof(arg2));
+   replay_read(reader, &arg2Rep, sizeof(arg2Rep));
+   replay_read(reader, &arg2Mod, sizeof(arg2Mod));
+   replay_read(reader, &arg3, sizeof(arg3));
+   replay_read(reader, &arg3Rep, sizeof(arg3Rep));
+   replay_read(reader, &arg3Mod, sizeof(arg3Mod));
+   (*(void (GLAPIENTRYP)(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)) reader->procs[TRACE_CALL_AlphaFragmentOp3ATI])(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
+}
+
+static void
+replay_SetFragmentShaderConstantATI(struct replay_reader *reader)
+{
+   GLuint dst;
+   const GLfloat * value;
+   replay_read(reader, &dst, sizeof(dst));
+   value = (const GLfloat *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLuint dst, const GLfloat * value)) reader->procs[TRACE_CALL_SetFragmentShaderConstantATI])(dst, value);
+}
+
+static void
+replay_BindRenderbufferEXT(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint renderbuffer;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &renderbuffer, sizeof(renderbuffer));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint renderbuffer)) reader->procs[TRACE_CALL_BindRenderbufferEXT])(target, renderbuffer);
+}
+
+static void
+replay_DeleteRenderbuffersEXT(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLuint * renderbuffers;
+   replay_read(reader, &n, sizeof(n));
+   renderbuffers = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLuint * renderbuffers)) reader->procs[TRACE_CALL_DeleteRenderbuffersEXT])(n, renderbuffers);
+}
+
+static void
+replay_GenRenderbuffersEXT(struct replay_reader *reader)
+{
+   GLsizei n;
+   GLuint * renderbuffers;
+   replay_read(reader, &n, sizeof(n));
+   renderbuffers = (GLuint *) replay_output(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, GLuint * renderbuffers)) reader->procs[TRACE_CALL_GenRenderbuffersEXT])(n, renderbuffers);
+}
+
+static void
+replay_RenderbufferStorageEXT(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum internalformat;
+   GLsizei width;
+   GLsizei height;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &internalformat, sizeof(internalformat));
+   replay_read(reader, &width, sizeof(width));
+   replay_read(reader, &height, sizeof(height));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)) reader->procs[TRACE_CALL_RenderbufferStorageEXT])(target, internalformat, width, height);
+}
+
+static void
+replay_BindFramebufferEXT(struct replay_reader *reader)
+{
+   GLenum target;
+   GLuint framebuffer;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &framebuffer, sizeof(framebuffer));
+   (*(void (GLAPIENTRYP)(GLenum target, GLuint framebuffer)) reader->procs[TRACE_CALL_BindFramebufferEXT])(target, framebuffer);
+}
+
+static void
+replay_DeleteFramebuffersEXT(struct replay_reader *reader)
+{
+   GLsizei n;
+   const GLuint * framebuffers;
+   replay_read(reader, &n, sizeof(n));
+   framebuffers = (const GLuint *) replay_array(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, const GLuint * framebuffers)) reader->procs[TRACE_CALL_DeleteFramebuffersEXT])(n, framebuffers);
+}
+
+static void
+replay_GenFramebuffersEXT(struct replay_reader *reader)
+{
+   GLsizei n;
+   GLuint * framebuffers;
+   replay_read(reader, &n, sizeof(n));
+   framebuffers = (GLuint *) replay_output(reader);
+   (*(void (GLAPIENTRYP)(GLsizei n, GLuint * framebuffers)) reader->procs[TRACE_CALL_GenFramebuffersEXT])(n, framebuffers);
+}
+
+static void
+replay_FramebufferTexture1DEXT(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum attachment;
+   GLenum textarget;
+   GLuint texture;
+   GLint level;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &attachment, sizeof(attachment));
+   replay_read(reader, &textarget, sizeof(textarget));
+   replay_read(reader, &texture, sizeof(texture));
+   replay_read(reader, &level, sizeof(level));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)) reader->procs[TRACE_CALL_FramebufferTexture1DEXT])(target, attachment, textarget, texture, level);
+}
+
+static void
+replay_FramebufferTexture2DEXT(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum attachment;
+   GLenum textarget;
+   GLuint texture;
+   GLint level;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &attachment, sizeof(attachment));
+   replay_read(reader, &textarget, sizeof(textarget));
+   replay_read(reader, &texture, sizeof(texture));
+   replay_read(reader, &level, sizeof(level));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)) reader->procs[TRACE_CALL_FramebufferTexture2DEXT])(target, attachment, textarget, texture, level);
+}
+
+static void
+replay_FramebufferTexture3DEXT(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum attachment;
+   GLenum textarget;
+   GLuint texture;
+   GLint level;
+   GLint zoffset;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &attachment, sizeof(attachment));
+   replay_read(reader, &textarget, sizeof(textarget));
+   replay_read(reader, &texture, sizeof(texture));
+   replay_read(reader, &level, sizeof(level));
+   replay_read(reader, &zoffset, sizeof(zoffset));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)) reader->procs[TRACE_CALL_FramebufferTexture3DEXT])(target, attachment, textarget, texture, level, zoffset);
+}
+
+static void
+replay_FramebufferRenderbufferEXT(struct replay_reader *reader)
+{
+   GLenum target;
+   GLenum attachment;
+   GLenum renderbuffertarget;
+   GLuint renderbuffer;
+   replay_read(reader, &target, sizeof(target));
+   replay_read(reader, &attachment, sizeof(attachment));
+   replay_read(reader, &renderbuffertarget, sizeof(renderbuffertarget));
+   replay_read(reader, &renderbuffer, sizeof(renderbuffer));
+   (*(void (GLAPIENTRYP)(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)) reader->procs[TRACE_CALL_FramebufferRenderbufferEXT])(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void
+replay_GenerateMipmapEXT(struct replay_reader *reader)
+{
+   GLenum target;
+   replay_read(reader, &target, sizeof(target));
+   (*(void (GLAPIENTRYP)(GLenum target)) reader->procs[TRACE_CALL_GenerateMipmapEXT])(target);
+}
+
+static void
+replay_StencilFuncSeparate(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum func;
+   GLint ref;
+   GLuint mask;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &func, sizeof(func));
+   replay_read(reader, &ref, sizeof(ref));
+   replay_read(reader, &mask, sizeof(mask));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum func, GLint ref, GLuint mask)) reader->procs[TRACE_CALL_StencilFuncSeparate])(face, func, ref, mask);
+}
+
+static void
+replay_StencilOpSeparate(struct replay_reader *reader)
+{
+   GLenum face;
+   GLenum fail;
+   GLenum zfail;
+   GLenum zpass;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &fail, sizeof(fail));
+   replay_read(reader, &zfail, sizeof(zfail));
+   replay_read(reader, &zpass, sizeof(zpass));
+   (*(void (GLAPIENTRYP)(GLenum face, GLenum fail, GLenum zfail, GLenum zpass)) reader->procs[TRACE_CALL_StencilOpSeparate])(face, fail, zfail, zpass);
+}
+
+static void
+replay_StencilMaskSeparate(struct replay_reader *reader)
+{
+   GLenum face;
+   GLuint mask;
+   replay_read(reader, &face, sizeof(face));
+   replay_read(reader, &mask, sizeof(mask));
+   (*(void (GLAPIENTRYP)(GLenum face, GLuint mask)) reader->procs[TRACE_CALL_StencilMaskSeparate])(face, mask);
+}
+
+
+typedef void (*replay_func)(struct replay_reader *reader);
+
+static const replay_func replay_dispatch[NUM_TRACE_CALL] = {
+   replay_NewList,
+   replay_EndList,
+   replay_CallList,
+   replay_CallLists,
+   replay_DeleteLists,
+   replay_GenLists,
+   replay_ListBase,
+   replay_Begin,
+   replay_Bitmap,
+   replay_Color3b,
+   replay_Color3bv,
+   replay_Color3d,
+   replay_Color3dv,
+   replay_Color3f,
+   replay_Color3fv,
+   replay_Color3i,
+   replay_Color3iv,
+   replay_Color3s,
+   replay_Color3sv,
+   replay_Color3ub,
+   replay_Color3ubv,
+   replay_Color3ui,
+   replay_Color3uiv,
+   replay_Color3us,
+   replay_Color3usv,
+   replay_Color4b,
+   replay_Color4bv,
+   replay_Color4d,
+   replay_Color4dv,
+   replay_Color4f,
+   replay_Color4fv,
+   replay_Color4i,
+   replay_Color4iv,
+   replay_Color4s,
+   replay_Color4sv,
+   replay_Color4ub,
+   replay_Color4ubv,
+   replay_Color4ui,
+   replay_Color4uiv,
+   replay_Color4us,
+   replay_Color4usv,
+   replay_EdgeFlag,
+   replay_EdgeFlagv,
+   replay_End,
+   replay_Indexd,
+   replay_Indexdv,
+   replay_Indexf,
+   replay_Indexfv,
+   replay_Indexi,
+   replay_Indexiv,
+   replay_Indexs,
+   replay_Indexsv,
+   replay_Normal3b,
+   replay_Normal3bv,
+   replay_Normal3d,
+   replay_Normal3dv,
+   replay_Normal3f,
+   replay_Normal3fv,
+   replay_Normal3i,
+   replay_Normal3iv,
+   replay_Normal3s,
+   replay_Normal3sv,
+   replay_RasterPos2d,
+   replay_RasterPos2dv,
+   replay_RasterPos2f,
+   replay_RasterPos2fv,
+   replay_RasterPos2i,
+   replay_RasterPos2iv,
+   replay_RasterPos2s,
+   replay_RasterPos2sv,
+   replay_RasterPos3d,
+   replay_RasterPos3dv,
+   replay_RasterPos3f,
+   replay_RasterPos3fv,
+   replay_RasterPos3i,
+   replay_RasterPos3iv,
+   replay_RasterPos3s,
+   replay_RasterPos3sv,
+   replay_RasterPos4d,
+   replay_RasterPos4dv,
+   replay_RasterPos4f,
+   replay_RasterPos4fv,
+   replay_RasterPos4i,
+   replay_RasterPos4iv,
+   replay_RasterPos4s,
+   replay_RasterPos4sv,
+   replay_Rectd,
+   replay_Rectdv,
+   replay_Rectf,
+   replay_Rectfv,
+   replay_Recti,
+   replay_Rectiv,
+   replay_Rects,
+   replay_Rectsv,
+   replay_TexCoord1d,
+   replay_TexCoord1dv,
+   replay_TexCoord1f,
+   replay_TexCoord1fv,
+   replay_TexCoord1i,
+   replay_TexCoord1iv,
+   replay_TexCoord1s,
+   replay_TexCoord1sv,
+   replay_TexCoord2d,
+   replay_TexCoord2dv,
+   replay_TexCoord2f,
+   replay_TexCoord2fv,
+   replay_TexCoord2i,
+   replay_TexCoord2iv,
+   replay_TexCoord2s,
+   replay_TexCoord2sv,
+   replay_TexCoord3d,
+   replay_TexCoord3dv,
+   replay_TexCoord3f,
+   replay_TexCoord3fv,
+   replay_TexCoord3i,
+   replay_TexCoord3iv,
+   replay_TexCoord3s,
+   replay_TexCoord3sv,
+   replay_TexCoord4d,
+   replay_TexCoord4dv,
+   replay_TexCoord4f,
+   replay_TexCoord4fv,
+   replay_TexCoord4i,
+   replay_TexCoord4iv,
+   replay_TexCoord4s,
+   replay_TexCoord4sv,
+   replay_Vertex2d,
+   replay_Vertex2dv,
+   replay_Vertex2f,
+   replay_Vertex2fv,
+   replay_Vertex2i,
+   replay_Vertex2iv,
+   replay_Vertex2s,
+   replay_Vertex2sv,
+   replay_Vertex3d,
+   replay_Vertex3dv,
+   replay_Vertex3f,
+   replay_Vertex3fv,
+   replay_Vertex3i,
+   replay_Vertex3iv,
+   replay_Vertex3s,
+   replay_Vertex3sv,
+   replay_Vertex4d,
+   replay_Vertex4dv,
+   replay_Vertex4f,
+   replay_Vertex4fv,
+   replay_Vertex4i,
+   replay_Vertex4iv,
+   replay_Vertex4s,
+   replay_Vertex4sv,
+   replay_ClipPlane,
+   replay_ColorMaterial,
+   replay_CullFace,
+   replay_Fogf,
+   replay_Fogfv,
+   replay_Fogi,
+   replay_Fogiv,
+   replay_FrontFace,
+   replay_Hint,
+   replay_Lightf,
+   replay_Lightfv,
+   replay_Lighti,
+   replay_Lightiv,
+   replay_LightModelf,
+   replay_LightModelfv,
+   replay_LightModeli,
+   replay_LightModeliv,
+   replay_LineStipple,
+   replay_LineWidth,
+   replay_Materialf,
+   replay_Materialfv,
+   replay_Materiali,
+   replay_Materialiv,
+   replay_PointSize,
+   replay_PolygonMode,
+   replay_PolygonStipple,
+   replay_Scissor,
+   replay_ShadeModel,
+   replay_TexParameterf,
+   replay_TexParameterfv,
+   replay_TexParameteri,
+   replay_TexParameteriv,
+   replay_TexImage1D,
+   replay_TexImage2D,
+   replay_TexEnvf,
+   replay_TexEnvfv,
+   replay_TexEnvi,
+   replay_TexEnviv,
+   replay_TexGend,
+   replay_TexGendv,
+   replay_TexGenf,
+   replay_TexGenfv,
+   replay_TexGeni,
+   replay_TexGeniv,
+   replay_FeedbackBuffer,
+   replay_SelectBuffer,
+   replay_RenderMode,
+   replay_InitNames,
+   replay_LoadName,
+   replay_PassThrough,
+   replay_PopName,
+   replay_PushName,
+   replay_DrawBuffer,
+   replay_Clear,
+   replay_ClearAccum,
+   replay_ClearIndex,
+   replay_ClearColor,
+   replay_ClearStencil,
+   replay_ClearDepth,
+   replay_StencilMask,
+   replay_ColorMask,
+   replay_DepthMask,
+   replay_IndexMask,
+   replay_Accum,
+   replay_Disable,
+   replay_Enable,
+   replay_Finish,
+   replay_Flush,
+   replay_PopAttrib,
+   replay_PushAttrib,
+   replay_Map1d,
+   replay_Map1f,
+   replay_Map2d,
+   replay_Map2f,
+   replay_MapGrid1d,
+   replay_MapGrid1f,
+   replay_MapGrid2d,
+   replay_MapGrid2f,
+   replay_EvalCoord1d,
+   replay_EvalCoord1dv,
+   replay_EvalCoord1f,
+   replay_EvalCoord1fv,
+   replay_EvalCoord2d,
+   replay_EvalCoord2dv,
+   replay_EvalCoord2f,
+   replay_EvalCoord2fv,
+   replay_EvalMesh1,
+   replay_EvalPoint1,
+   replay_EvalMesh2,
+   replay_EvalPoint2,
+   replay_AlphaFunc,
+   replay_BlendFunc,
+   replay_LogicOp,
+   replay_StencilFunc,
+   replay_StencilOp,
+   replay_DepthFunc,
+   replay_PixelZoom,
+   replay_PixelTransferf,
+   replay_PixelTransferi,
+   replay_PixelStoref,
+   replay_PixelStorei,
+   replay_PixelMapfv,
+   replay_PixelMapuiv,
+   replay_PixelMapusv,
+   replay_ReadBuffer,
+   replay_CopyPixels,
+   replay_ReadPixels,
+   replay_DrawPixels,
+   NULL,  /* GetBooleanv */
+   NULL,  /* GetClipPlane */
+   NULL,  /* GetDoublev */
+   NULL,  /* GetError */
+   NULL,  /* GetFloatv */
+   NULL,  /* GetIntegerv */
+   NULL,  /* GetLightfv */
+   NULL,  /* GetLightiv */
+   NULL,  /* GetMapdv */
+   NULL,  /* GetMapfv */
+   NULL,  /* GetMapiv */
+   NULL,  /* GetMaterialfv */
+   NULL,  /* GetMaterialiv */
+   NULL,  /* GetPixelMapfv */
+   NULL,  /* GetPixelMapuiv */
+   NULL,  /* GetPixelMapusv */
+   NULL,  /* GetPolygonStipple */
+   NULL,  /* GetString */
+   NULL,  /* GetTexEnvfv */
+   NULL,  /* GetTexEnviv */
+   NULL,  /* GetTexGendv */
+   NULL,  /* GetTexGenfv */
+   NULL,  /* GetTexGeniv */
+   NULL,  /* GetTexImage */
+   NULL,  /* GetTexParameterfv */
+   NULL,  /* GetTexParameteriv */
+   NULL,  /* GetTexLevelParameterfv */
+   NULL,  /* GetTexLevelParameteriv */
+   NULL,  /* IsEnabled */
+   NULL,  /* IsList */
+   replay_DepthRange,
+   replay_Frustum,
+   replay_LoadIdentity,
+   replay_LoadMatrixf,
+   replay_LoadMatrixd,
+   replay_MatrixMode,
+   replay_MultMatrixf,
+   replay_MultMatrixd,
+   replay_Ortho,
+   replay_PopMatrix,
+   replay_PushMatrix,
+   replay_Rotated,
+   replay_Rotatef,
+   replay_Scaled,
+   replay_Scalef,
+   replay_Translated,
+   replay_Translatef,
+   replay_Viewport,
+   replay_ArrayElement,
+   replay_BindTexture,
+   NULL,  /* ColorPointer */
+   replay_DisableClientState,
+   replay_DrawArrays,
+   replay_DrawElements,
+   NULL,  /* EdgeFlagPointer */
+   replay_EnableClientState,
+   NULL,  /* IndexPointer */
+   replay_Indexub,
+   replay_Indexubv,
+   NULL,  /* InterleavedArrays */
+   NULL,  /* NormalPointer */
+   replay_PolygonOffset,
+   NULL,  /* TexCoordPointer */
+   NULL,  /* VertexPointer */
+   NULL,  /* AreTexturesResident */
+   replay_CopyTexImage1D,
+   replay_CopyTexImage2D,
+   replay_CopyTexSubImage1D,
+   replay_CopyTexSubImage2D,
+   replay_DeleteTextures,
+   replay_GenTextures,
+   NULL,  /* GetPointerv */
+   NULL,  /* IsTexture */
+   replay_PrioritizeTextures,
+   replay_TexSubImage1D,
+   replay_TexSubImage2D,
+   replay_PopClientAttrib,
+   replay_PushClientAttrib,
+   replay_BlendColor,
+   replay_BlendEquation,
+   replay_DrawRangeElements,
+   replay_ColorTable,
+   replay_ColorTableParameterfv,
+   replay_ColorTableParameteriv,
+   replay_CopyColorTable,
+   NULL,  /* GetColorTable */
+   NULL,  /* GetColorTableParameterfv */
+   NULL,  /* GetColorTableParameteriv */
+   replay_ColorSubTable,
+   replay_CopyColorSubTable,
+   replay_ConvolutionFilter1D,
+   replay_ConvolutionFilter2D,
+   replay_ConvolutionParameterf,
+   replay_ConvolutionParameterfv,
+   replay_ConvolutionParameteri,
+   replay_ConvolutionParameteriv,
+   replay_CopyConvolutionFilter1D,
+   replay_CopyConvolutionFilter2D,
+   NULL,  /* GetConvolutionFilter */
+   NULL,  /* GetConvolutionParameterfv */
+   NULL,  /* GetConvolutionParameteriv */
+   NULL,  /* GetSeparableFilter */
+   replay_SeparableFilter2D,
+   NULL,  /* GetHistogram */
+   NULL,  /* GetHistogramParameterfv */
+   NULL,  /* GetHistogramParameteriv */
+   NULL,  /* GetMinmax */
+   NULL,  /* GetMinmaxParameterfv */
+   NULL,  /* GetMinmaxParameteriv */
+   replay_Histogram,
+   replay_Minmax,
+   replay_ResetHistogram,
+   replay_ResetMinmax,
+   replay_TexImage3D,
+   replay_TexSubImage3D,
+   replay_CopyTexSubImage3D,
+   replay_ActiveTextureARB,
+   replay_ClientActiveTextureARB,
+   replay_MultiTexCoord1dARB,
+   replay_MultiTexCoord1dvARB,
+   replay_MultiTexCoord1fARB,
+   replay_MultiTexCoord1fvARB,
+   replay_MultiTexCoord1iARB,
+   replay_MultiTexCoord1ivARB,
+   replay_MultiTexCoord1sARB,
+   replay_MultiTexCoord1svARB,
+   replay_MultiTexCoord2dARB,
+   replay_MultiTexCoord2dvARB,
+   replay_MultiTexCoord2fARB,
+   replay_MultiTexCoord2fvARB,
+   replay_MultiTexCoord2iARB,
+   replay_MultiTexCoord2ivARB,
+   replay_MultiTexCoord2sARB,
+   replay_MultiTexCoord2svARB,
+   replay_MultiTexCoord3dARB,
+   replay_MultiTexCoord3dvARB,
+   replay_MultiTexCoord3fARB,
+   replay_MultiTexCoord3fvARB,
+   replay_MultiTexCoord3iARB,
+   replay_MultiTexCoord3ivARB,
+   replay_MultiTexCoord3sARB,
+   replay_MultiTexCoord3svARB,
+   replay_MultiTexCoord4dARB,
+   replay_MultiTexCoord4dvARB,
+   replay_MultiTexCoord4fARB,
+   replay_MultiTexCoord4fvARB,
+   replay_MultiTexCoord4iARB,
+   replay_MultiTexCoord4ivARB,
+   replay_MultiTexCoord4sARB,
+   replay_MultiTexCoord4svARB,
+   replay_LoadTransposeMatrixfARB,
+   replay_LoadTransposeMatrixdARB,
+   replay_MultTransposeMatrixfARB,
+   replay_MultTransposeMatrixdARB,
+   replay_SampleCoverageARB,
+   replay_DrawBuffersARB,
+   replay_PolygonOffsetEXT,
+   NULL,  /* GetTexFilterFuncSGIS */
+   replay_TexFilterFuncSGIS,
+   NULL,  /* GetHistogramEXT */
+   NULL,  /* GetHistogramParameterfvEXT */
+   NULL,  /* GetHistogramParameterivEXT */
+   NULL,  /* GetMinmaxEXT */
+   NULL,  /* GetMinmaxParameterfvEXT */
+   NULL,  /* GetMinmaxParameterivEXT */
+   NULL,  /* GetConvolutionFilterEXT */
+   NULL,  /* GetConvolutionParameterfvEXT */
+   NULL,  /* GetConvolutionParameterivEXT */
+   NULL,  /* GetSeparableFilterEXT */
+   NULL,  /* GetColorTableSGI */
+   NULL,  /* GetColorTableParameterfvSGI */
+   NULL,  /* GetColorTableParameterivSGI */
+   replay_PixelTexGenSGIX,
+   replay_PixelTexGenParameteriSGIS,
+   NULL,  /* PixelTexGenParameterivSGIS */
+   replay_PixelTexGenParameterfSGIS,
+   NULL,  /* PixelTexGenParameterfvSGIS */
+   NULL,  /* GetPixelTexGenParameterivSGIS */
+   NULL,  /* GetPixelTexGenParameterfvSGIS */
+   NULL,  /* TexImage4DSGIS */
+   NULL,  /* TexSubImage4DSGIS */
+   NULL,  /* AreTexturesResidentEXT */
+   replay_GenTexturesEXT,
+   NULL,  /* IsTextureEXT */
+   replay_DetailTexFuncSGIS,
+   NULL,  /* GetDetailTexFuncSGIS */
+   replay_SharpenTexFuncSGIS,
+   NULL,  /* GetSharpenTexFuncSGIS */
+   replay_SampleMaskSGIS,
+   replay_SamplePatternSGIS,
+   NULL,  /* ColorPointerEXT */
+   NULL,  /* EdgeFlagPointerEXT */
+   NULL,  /* IndexPointerEXT */
+   NULL,  /* NormalPointerEXT */
+   NULL,  /* TexCoordPointerEXT */
+   NULL,  /* VertexPointerEXT */
+   replay_SpriteParameterfSGIX,
+   NULL,  /* SpriteParameterfvSGIX */
+   replay_SpriteParameteriSGIX,
+   NULL,  /* SpriteParameterivSGIX */
+   replay_PointParameterfEXT,
+   replay_PointParameterfvEXT,
+   NULL,  /* GetInstrumentsSGIX */
+   NULL,  /* InstrumentsBufferSGIX */
+   NULL,  /* PollInstrumentsSGIX */
+   replay_ReadInstrumentsSGIX,
+   replay_StartInstrumentsSGIX,
+   replay_StopInstrumentsSGIX,
+   replay_FrameZoomSGIX,
+   replay_TagSampleBufferSGIX,
+   NULL,  /* ReferencePlaneSGIX */
+   replay_FlushRasterSGIX,
+   NULL,  /* GetListParameterfvSGIX */
+   NULL,  /* GetListParameterivSGIX */
+   replay_ListParameterfSGIX,
+   NULL,  /* ListParameterfvSGIX */
+   replay_ListParameteriSGIX,
+   NULL,  /* ListParameterivSGIX */
+   replay_FragmentColorMaterialSGIX,
+   replay_FragmentLightfSGIX,
+   NULL,  /* FragmentLightfvSGIX */
+   replay_FragmentLightiSGIX,
+   NULL,  /* FragmentLightivSGIX */
+   replay_FragmentLightModelfSGIX,
+   NULL,  /* FragmentLightModelfvSGIX */
+   replay_FragmentLightModeliSGIX,
+   NULL,  /* FragmentLightModelivSGIX */
+   replay_FragmentMaterialfSGIX,
+   NULL,  /* FragmentMaterialfvSGIX */
+   replay_FragmentMaterialiSGIX,
+   NULL,  /* FragmentMaterialivSGIX */
+   NULL,  /* GetFragmentLightfvSGIX */
+   NULL,  /* GetFragmentLightivSGIX */
+   NULL,  /* GetFragmentMaterialfvSGIX */
+   NULL,  /* GetFragmentMaterialivSGIX */
+   replay_LightEnviSGIX,
+   replay_VertexWeightfEXT,
+   replay_VertexWeightfvEXT,
+   NULL,  /* VertexWeightPointerEXT */
+   replay_FlushVertexArrayRangeNV,
+   NULL,  /* VertexArrayRangeNV */
+   replay_CombinerParameterfvNV,
+   replay_CombinerParameterfNV,
+   replay_CombinerParameterivNV,
+   replay_CombinerParameteriNV,
+   replay_CombinerInputNV,
+   replay_CombinerOutputNV,
+   replay_FinalCombinerInputNV,
+   NULL,  /* GetCombinerInputParameterfvNV */
+   NULL,  /* GetCombinerInputParameterivNV */
+   NULL,  /* GetCombinerOutputParameterfvNV */
+   NULL,  /* GetCombinerOutputParameterivNV */
+   NULL,  /* GetFinalCombinerInputParameterfvNV */
+   NULL,  /* GetFinalCombinerInputParameterivNV */
+   replay_ResizeBuffersMESA,
+   replay_WindowPos2dMESA,
+   replay_WindowPos2dvMESA,
+   replay_WindowPos2fMESA,
+   replay_WindowPos2fvMESA,
+   replay_WindowPos2iMESA,
+   replay_WindowPos2ivMESA,
+   replay_WindowPos2sMESA,
+   replay_WindowPos2svMESA,
+   replay_WindowPos3dMESA,
+   replay_WindowPos3dvMESA,
+   replay_WindowPos3fMESA,
+   replay_WindowPos3fvMESA,
+   replay_WindowPos3iMESA,
+   replay_WindowPos3ivMESA,
+   replay_WindowPos3sMESA,
+   replay_WindowPos3svMESA,
+   replay_WindowPos4dMESA,
+   replay_WindowPos4dvMESA,
+   replay_WindowPos4fMESA,
+   replay_WindowPos4fvMESA,
+   replay_WindowPos4iMESA,
+   replay_WindowPos4ivMESA,
+   replay_WindowPos4sMESA,
+   replay_WindowPos4svMESA,
+   replay_BlendFuncSeparateEXT,
+   replay_IndexMaterialEXT,
+   replay_IndexFuncEXT,
+   replay_LockArraysEXT,
+   replay_UnlockArraysEXT,
+   NULL,  /* CullParameterdvEXT */
+   NULL,  /* CullParameterfvEXT */
+   replay_HintPGI,
+   replay_FogCoordfEXT,
+   replay_FogCoordfvEXT,
+   replay_FogCoorddEXT,
+   replay_FogCoorddvEXT,
+   NULL,  /* FogCoordPointerEXT */
+   NULL,  /* GetColorTableEXT */
+   NULL,  /* GetColorTableParameterivEXT */
+   NULL,  /* GetColorTableParameterfvEXT */
+   replay_TbufferMask3DFX,
+   replay_CompressedTexImage3DARB,
+   replay_CompressedTexImage2DARB,
+   replay_CompressedTexImage1DARB,
+   replay_CompressedTexSubImage3DARB,
+   replay_CompressedTexSubImage2DARB,
+   replay_CompressedTexSubImage1DARB,
+   NULL,  /* GetCompressedTexImageARB */
+   replay_SecondaryColor3bEXT,
+   replay_SecondaryColor3bvEXT,
+   replay_SecondaryColor3dEXT,
+   replay_SecondaryColor3dvEXT,
+   replay_SecondaryColor3fEXT,
+   replay_SecondaryColor3fvEXT,
+   replay_SecondaryColor3iEXT,
+   replay_SecondaryColor3ivEXT,
+   replay_SecondaryColor3sEXT,
+   replay_SecondaryColor3svEXT,
+   replay_SecondaryColor3ubEXT,
+   replay_SecondaryColor3ubvEXT,
+   replay_SecondaryColor3uiEXT,
+   replay_SecondaryColor3uivEXT,
+   replay_SecondaryColor3usEXT,
+   replay_SecondaryColor3usvEXT,
+   NULL,  /* SecondaryColorPointerEXT */
+   NULL,  /* AreProgramsResidentNV */
+   replay_BindProgramNV,
+   replay_DeleteProgramsNV,
+   replay_ExecuteProgramNV,
+   replay_GenProgramsNV,
+   NULL,  /* GetProgramParameterdvNV */
+   NULL,  /* GetProgramParameterfvNV */
+   NULL,  /* GetProgramivNV */
+   NULL,  /* GetProgramStringNV */
+   NULL,  /* GetTrackMatrixivNV */
+   NULL,  /* GetVertexAttribdvARB */
+   NULL,  /* GetVertexAttribfvARB */
+   NULL,  /* GetVertexAttribivARB */
+   NULL,  /* GetVertexAttribPointervNV */
+   NULL,  /* IsProgramNV */
+   replay_LoadProgramNV,
+   replay_ProgramParameter4dNV,
+   replay_ProgramParameter4dvNV,
+   replay_ProgramParameter4fNV,
+   replay_ProgramParameter4fvNV,
+   replay_ProgramParameters4dvNV,
+   replay_ProgramParameters4fvNV,
+   replay_RequestResidentProgramsNV,
+   replay_TrackMatrixNV,
+   NULL,  /* VertexAttribPointerNV */
+   replay_VertexAttrib1dARB,
+   replay_VertexAttrib1dvARB,
+   replay_VertexAttrib1fARB,
+   replay_VertexAttrib1fvARB,
+   replay_VertexAttrib1sARB,
+   replay_VertexAttrib1svARB,
+   replay_VertexAttrib2dARB,
+   replay_VertexAttrib2dvARB,
+   replay_VertexAttrib2fARB,
+   replay_VertexAttrib2fvARB,
+   replay_VertexAttrib2sARB,
+   replay_VertexAttrib2svARB,
+   replay_VertexAttrib3dARB,
+   replay_VertexAttrib3dvARB,
+   replay_VertexAttrib3fARB,
+   replay_VertexAttrib3fvARB,
+   replay_VertexAttrib3sARB,
+   replay_VertexAttrib3svARB,
+   replay_VertexAttrib4dARB,
+   replay_VertexAttrib4dvARB,
+   replay_VertexAttrib4fARB,
+   replay_VertexAttrib4fvARB,
+   replay_VertexAttrib4sARB,
+   replay_VertexAttrib4svARB,
+   replay_VertexAttrib4NubARB,
+   replay_VertexAttrib4NubvARB,
+   replay_VertexAttribs1dvNV,
+   replay_VertexAttribs1fvNV,
+   replay_VertexAttribs1svNV,
+   replay_VertexAttribs2dvNV,
+   replay_VertexAttribs2fvNV,
+   replay_VertexAttribs2svNV,
+   replay_VertexAttribs3dvNV,
+   replay_VertexAttribs3fvNV,
+   replay_VertexAttribs3svNV,
+   replay_VertexAttribs4dvNV,
+   replay_VertexAttribs4fvNV,
+   replay_VertexAttribs4svNV,
+   replay_VertexAttribs4ubvNV,
+   replay_PointParameteriNV,
+   replay_PointParameterivNV,
+   replay_MultiDrawArraysEXT,
+   NULL,  /* MultiDrawElementsEXT */
+   replay_ActiveStencilFaceEXT,
+   replay_DeleteFencesNV,
+   replay_GenFencesNV,
+   NULL,  /* IsFenceNV */
+   NULL,  /* TestFenceNV */
+   NULL,  /* GetFenceivNV */
+   replay_FinishFenceNV,
+   replay_SetFenceNV,
+   replay_VertexAttrib4bvARB,
+   replay_VertexAttrib4ivARB,
+   replay_VertexAttrib4ubvARB,
+   replay_VertexAttrib4usvARB,
+   replay_VertexAttrib4uivARB,
+   replay_VertexAttrib4NbvARB,
+   replay_VertexAttrib4NsvARB,
+   replay_VertexAttrib4NivARB,
+   replay_VertexAttrib4NusvARB,
+   replay_VertexAttrib4NuivARB,
+   NULL,  /* VertexAttribPointerARB */
+   replay_EnableVertexAttribArrayARB,
+   replay_DisableVertexAttribArrayARB,
+   replay_ProgramStringARB,
+   replay_ProgramEnvParameter4dARB,
+   replay_ProgramEnvParameter4dvARB,
+   replay_ProgramEnvParameter4fARB,
+   replay_ProgramEnvParameter4fvARB,
+   replay_ProgramLocalParameter4dARB,
+   replay_ProgramLocalParameter4dvARB,
+   replay_ProgramLocalParameter4fARB,
+   replay_ProgramLocalParameter4fvARB,
+   NULL,  /* GetProgramEnvParameterdvARB */
+   NULL,  /* GetProgramEnvParameterfvARB */
+   NULL,  /* GetProgramLocalParameterdvARB */
+   NULL,  /* GetProgramLocalParameterfvARB */
+   NULL,  /* GetProgramivARB */
+   NULL,  /* GetProgramStringARB */
+   replay_ProgramNamedParameter4fNV,
+   replay_ProgramNamedParameter4dNV,
+   replay_ProgramNamedParameter4fvNV,
+   replay_ProgramNamedParameter4dvNV,
+   NULL,  /* GetProgramNamedParameterfvNV */
+   NULL,  /* GetProgramNamedParameterdvNV */
+   replay_BindBufferARB,
+   replay_BufferDataARB,
+   replay_BufferSubDataARB,
+   replay_DeleteBuffersARB,
+   replay_GenBuffersARB,
+   NULL,  /* GetBufferParameterivARB */
+   NULL,  /* GetBufferPointervARB */
+   NULL,  /* GetBufferSubDataARB */
+   NULL,  /* IsBufferARB */
+   replay_MapBufferARB,
+   replay_UnmapBufferARB,
+   replay_DepthBoundsEXT,
+   replay_GenQueriesARB,
+   replay_DeleteQueriesARB,
+   NULL,  /* IsQueryARB */
+   replay_BeginQueryARB,
+   replay_EndQueryARB,
+   NULL,  /* GetQueryivARB */
+   NULL,  /* GetQueryObjectivARB */
+   NULL,  /* GetQueryObjectuivARB */
+   NULL,  /* MultiModeDrawArraysIBM */
+   NULL,  /* MultiModeDrawElementsIBM */
+   replay_BlendEquationSeparateEXT,
+   replay_DeleteObjectARB,
+   NULL,  /* GetHandleARB */
+   replay_DetachObjectARB,
+   replay_CreateShaderObjectARB,
+   replay_ShaderSourceARB,
+   replay_CompileShaderARB,
+   replay_CreateProgramObjectARB,
+   replay_AttachObjectARB,
+   replay_LinkProgramARB,
+   replay_UseProgramObjectARB,
+   replay_ValidateProgramARB,
+   replay_Uniform1fARB,
+   replay_Uniform2fARB,
+   replay_Uniform3fARB,
+   replay_Uniform4fARB,
+   replay_Uniform1iARB,
+   replay_Uniform2iARB,
+   replay_Uniform3iARB,
+   replay_Uniform4iARB,
+   replay_Uniform1fvARB,
+   replay_Uniform2fvARB,
+   replay_Uniform3fvARB,
+   replay_Uniform4fvARB,
+   replay_Uniform1ivARB,
+   replay_Uniform2ivARB,
+   replay_Uniform3ivARB,
+   replay_Uniform4ivARB,
+   replay_UniformMatrix2fvARB,
+   replay_UniformMatrix3fvARB,
+   replay_UniformMatrix4fvARB,
+   NULL,  /* GetObjectParameterfvARB */
+   NULL,  /* GetObjectParameterivARB */
+   NULL,  /* GetInfoLogARB */
+   NULL,  /* GetAttachedObjectsARB */
+   NULL,  /* GetUniformLocationARB */
+   NULL,  /* GetActiveUniformARB */
+   NULL,  /* GetUniformfvARB */
+   NULL,  /* GetUniformivARB */
+   NULL,  /* GetShaderSourceARB */
+   replay_BindAttribLocationARB,
+   NULL,  /* GetActiveAttribARB */
+   NULL,  /* GetAttribLocationARB */
+   NULL,  /* GetVertexAttribdvNV */
+   NULL,  /* GetVertexAttribfvNV */
+   NULL,  /* GetVertexAttribivNV */
+   replay_VertexAttrib1dNV,
+   replay_VertexAttrib1dvNV,
+   replay_VertexAttrib1fNV,
+   replay_VertexAttrib1fvNV,
+   replay_VertexAttrib1sNV,
+   replay_VertexAttrib1svNV,
+   replay_VertexAttrib2dNV,
+   replay_VertexAttrib2dvNV,
+   replay_VertexAttrib2fNV,
+   replay_VertexAttrib2fvNV,
+   replay_VertexAttrib2sNV,
+   replay_VertexAttrib2svNV,
+   replay_VertexAttrib3dNV,
+   replay_VertexAttrib3dvNV,
+   replay_VertexAttrib3fNV,
+   replay_VertexAttrib3fvNV,
+   replay_VertexAttrib3sNV,
+   replay_VertexAttrib3svNV,
+   replay_VertexAttrib4dNV,
+   replay_VertexAttrib4dvNV,
+   replay_VertexAttrib4fNV,
+   replay_VertexAttrib4fvNV,
+   replay_VertexAttrib4sNV,
+   replay_VertexAttrib4svNV,
+   replay_VertexAttrib4ubNV,
+   replay_VertexAttrib4ubvNV,
+   replay_GenFragmentShadersATI,
+   replay_BindFragmentShaderATI,
+   replay_DeleteFragmentShaderATI,
+   replay_BeginFragmentShaderATI,
+   replay_EndFragmentShaderATI,
+   replay_PassTexCoordATI,
+   replay_SampleMapATI,
+   replay_ColorFragmentOp1ATI,
+   replay_ColorFragmentOp2ATI,
+   replay_ColorFragmentOp3ATI,
+   replay_AlphaFragmentOp1ATI,
+   replay_AlphaFragmentOp2ATI,
+   replay_AlphaFragmentOp3ATI,
+   replay_SetFragmentShaderConstantATI,
+   NULL,  /* IsRenderbufferEXT */
+   replay_BindRenderbufferEXT,
+   replay_DeleteRenderbuffersEXT,
+   replay_GenRenderbuffersEXT,
+   replay_RenderbufferStorageEXT,
+   NULL,  /* GetRenderbufferParameterivEXT */
+   NULL,  /* IsFramebufferEXT */
+   replay_BindFramebufferEXT,
+   replay_DeleteFramebuffersEXT,
+   replay_GenFramebuffersEXT,
+   NULL,  /* CheckFramebufferStatusEXT */
+   replay_FramebufferTexture1DEXT,
+   replay_FramebufferTexture2DEXT,
+   replay_FramebufferTexture3DEXT,
+   replay_FramebufferRenderbufferEXT,
+   NULL,  /* GetFramebufferAttachmentParameterivEXT */
+   replay_GenerateMipmapEXT,
+   replay_StencilFuncSeparate,
+   replay_StencilOpSeparate,
+   replay_StencilMaskSeparate,
+};
+
+#endif /* REPLAY_FUNCTIONS */
@@ -146,13 +146,13 @@ static void _ac_fallbacks_init( GLcontext *ctx )
 
 
 /*
- * Initialize the array cache pointers, types, strides, etc.
+ * Initialize the array cache pointers, types, strides, etc.  The arrays
+ * get their storage when data is first imported into them.
  */
 static void _ac_cache_init( GLcontext *ctx )
 {
    ACcontext *ac = AC_CONTEXT(ctx);
    struct gl_client_array *cl;
-   GLuint size = ctx->Const.MaxArrayLockSize + MAX_CLIPPED_VERTICES;
    GLuint i;
 
    cl = &ac->Cache.Vertex;
@@ -160,7 +160,7 @@ static void _ac_cache_init( GLcontext *ctx )
    cl->Type = GL_FLOAT;
    cl->Stride = 0;
    cl->StrideB = 4 * sizeof(GLfloat);
-   cl->Ptr = (GLubyte *) MALLOC( cl->StrideB * size );
+   cl->Ptr = NULL;
    cl->Enabled = 1;
    cl->Flags = 0;
 #if FEATURE_ARB_vertex_buffer_object
@@ -172,7 +172,7 @@ static void _ac_cache_init( GLcontext *ctx )
    cl->Type = GL_FLOAT;
    cl->Stride = 0;
    cl->StrideB = 3 * sizeof(GLfloat);
-   cl->Ptr = (GLubyte *) MALLOC( cl->StrideB * size );
+   cl->Ptr = NULL;
    cl->Enabled = 1;
    cl->Flags = 0;
 #if FEATURE_ARB_vertex_buffer_object
@@ -184,7 +184,7 @@ static void _ac_cache_init( GLcontext *ctx )
    cl->Type = GL_FLOAT;
    cl->Stride = 0;
    cl->StrideB = 4 * sizeof(GLfloat);
-   cl->Ptr = (GLubyte *) MALLOC( cl->StrideB * size );
+   cl->Ptr = NULL;
    cl->Enabled = 1;
    cl->Flags = 0;
 #if FEATURE_ARB_vertex_buffer_object
@@ -196,7 +196,7 @@ static void _ac_cache_init( GLcontext *ctx )
    cl->Type = GL_FLOAT;
    cl->Stride = 0;
    cl->StrideB = 4 * sizeof(GLfloat);
-   cl->Ptr = (GLubyte *) MALLOC( cl->StrideB * size );
+   cl->Ptr = NULL;
    cl->Enabled = 1;
    cl->Flags = 0;
 #if FEATURE_ARB_vertex_buffer_object
@@ -208,7 +208,7 @@ static void _ac_cache_init( GLcontext *ctx )
    cl->Type = GL_FLOAT;
    cl->Stride = 0;
    cl->StrideB = sizeof(GLfloat);
-   cl->Ptr = (GLubyte *) MALLOC( cl->StrideB * size );
+   cl->Ptr = NULL;
    cl->Enabled = 1;
    cl->Flags = 0;
 #if FEATURE_ARB_vertex_buffer_object
@@ -220,7 +220,7 @@ static void _ac_cache_init( GLcontext *ctx )
    cl->Type = GL_FLOAT;
    cl->Stride = 0;
    cl->StrideB = sizeof(GLfloat);
-   cl->Ptr = (GLubyte *) MALLOC( cl->StrideB * size );
+   cl->Ptr = NULL;
    cl->Enabled = 1;
    cl->Flags = 0;
 #if FEATURE_ARB_vertex_buffer_object
@@ -233,7 +233,7 @@ static void _ac_cache_init( GLcontext *ctx )
       cl->Type = GL_FLOAT;
       cl->Stride = 0;
       cl->StrideB = 4 * sizeof(GLfloat);
-      cl->Ptr = (GLubyte *) MALLOC( cl->StrideB * size );
+      cl->Ptr = NULL;
       cl->Enabled = 1;
       cl->Flags = 0;
 #if FEATURE_ARB_vertex_buffer_object
@@ -246,7 +246,7 @@ static void _ac_cache_init( GLcontext *ctx )
    cl->Type = GL_UNSIGNED_BYTE;
    cl->Stride = 0;
    cl->StrideB = sizeof(GLubyte);
-   cl->Ptr = (GLubyte *) MALLOC( cl->StrideB * size );
+   cl->Ptr = NULL;
    cl->Enabled = 1;
    cl->Flags = 0;
 #if FEATURE_ARB_vertex_buffer_object
@@ -259,7 +259,7 @@ static void _ac_cache_init( GLcontext *ctx )
       cl->Type = GL_FLOAT;
       cl->Stride = 0;
       cl->StrideB = 4 * sizeof(GLfloat);
-      cl->Ptr = (GLubyte *) MALLOC( cl->StrideB * size );
+      cl->Ptr = NULL;
       cl->Enabled = 1;
       cl->Flags = 0;
 #if FEATURE_ARB_vertex_buffer_object
@@ -275,10 +275,10 @@ static void _ac_cache_init( GLcontext *ctx )
 static void _ac_elts_init( GLcontext *ctx )
 {
    ACcontext *ac = AC_CONTEXT(ctx);
-   GLuint size = 1000;
+   GLuint size = AC_INITIAL_ELTS;
 
    ac->Elts = (GLuint *)MALLOC( sizeof(GLuint) * size );
-   ac->elt_size = size;
+   ac->elt_size = sizeof(GLuint) * size;
 }
 
 static void _ac_raw_init( GLcontext *ctx )
@@ -326,39 +326,37 @@ GLboolean _ac_CreateContext( GLcontext *ctx )
    return GL_FALSE;
 }
 
-void _ac_DestroyContext( GLcontext *ctx )
+/* Free the storage of the cache arrays.  The next import allocates it
+ * again.
+ */
+static void _ac_cache_free( GLcontext *ctx )
 {
    struct gl_buffer_object *nullObj = ctx->Array.NullBufferObj;
    ACcontext *ac = AC_CONTEXT(ctx);
-   GLint i;
-
-   /* only free vertex data if it's really a pointer to vertex data and
-    * not an offset into a buffer object.
-    */
-   if (ac->Cache.Vertex.Ptr && ac->Cache.Vertex.BufferObj == nullObj)
-      FREE( (void *) ac->Cache.Vertex.Ptr );
-   if (ac->Cache.Normal.Ptr && ac->Cache.Normal.BufferObj == nullObj)
-      FREE( (void *) ac->Cache.Normal.Ptr );
-   if (ac->Cache.Color.Ptr && ac->Cache.Color.BufferObj == nullObj)
-      FREE( (void *) ac->Cache.Color.Ptr );
-   if (ac->Cache.SecondaryColor.Ptr && ac->Cache.SecondaryColor.BufferObj == nullObj)
-      FREE( (void *) ac->Cache.SecondaryColor.Ptr );
-   if (ac->Cache.EdgeFlag.Ptr && ac->Cache.EdgeFlag.BufferObj == nullObj)
-      FREE( (void *) ac->Cache.EdgeFlag.Ptr );
-   if (ac->Cache.Index.Ptr && ac->Cache.Index.BufferObj == nullObj)
-      FREE( (void *) ac->Cache.Index.Ptr );
-   if (ac->Cache.FogCoord.Ptr && ac->Cache.FogCoord.BufferObj == nullObj)
-      FREE( (void *) ac->Cache.FogCoord.Ptr );
+   struct gl_client_array *arrays = (struct gl_client_array *) &ac->Cache;
+   GLboolean *cached = (GLboolean *) &ac->IsCached;
+   const GLuint n = sizeof(ac->Cache) / sizeof(struct gl_client_array);
+   GLuint i;
 
-   for (i = 0; i < MAX_TEXTURE_COORD_UNITS; i++) {
-      if (ac->Cache.TexCoord[i].Ptr && ac->Cache.TexCoord[i].BufferObj == nullObj)
-	 FREE( (void *) ac->Cache.TexCoord[i].Ptr );
+   for (i = 0; i < n; i++) {
+      /* only free vertex data if it's really a pointer to vertex data and
+       * not an offset into a buffer object.
+       */
+      if (arrays[i].Ptr && arrays[i].BufferObj == nullObj) {
+	 FREE( (void *) arrays[i].Ptr );
+	 arrays[i].Ptr = NULL;
+      }
+      cached[i] = GL_FALSE;
    }
 
-   for (i = 0; i < VERT_ATTRIB_MAX; i++) {
-      if (ac->Cache.Attrib[i].Ptr && ac->Cache.Attrib[i].BufferObj == nullObj)
-	 FREE( (void *) ac->Cache.Attrib[i].Ptr );
-   }
+   ac->CacheBytes = 0;
+}
+
+void _ac_DestroyContext( GLcontext *ctx )
+{
+   ACcontext *ac = AC_CONTEXT(ctx);
+
+   _ac_cache_free( ctx );
 
    if (ac->Elts)
       FREE( ac->Elts );
@@ -368,6 +366,30 @@ void _ac_DestroyContext( GLcontext *ctx )
    ctx->acache_context = NULL;
 }
 
+/* Release the array cache storage, and shrink the element list back to
+ * its initial size.  Everything is reimported on the next draw.
+ */
+void _ac_TrimContext( GLcontext *ctx )
+{
+   ACcontext *ac = AC_CONTEXT(ctx);
+
+   _ac_cache_free( ctx );
+
+   if (ac->elt_size > sizeof(GLuint) * AC_INITIAL_ELTS) {
+      FREE( ac->Elts );
+      _ac_elts_init( ctx );
+   }
+}
+
+/* Number of bytes allocated by the array cache for this context.
+ */
+GLuint _ac_ContextMemory( GLcontext *ctx )
+{
+   ACcontext *ac = AC_CONTEXT(ctx);
+
+   return sizeof(ACcontext) + ac->CacheBytes + (ac->Elts ? ac->elt_size : 0);
+}
+
 void _ac_InvalidateState( GLcontext *ctx, GLuint new_state )
 {
    AC_CONTEXT(ctx)->NewState |= new_state;
@@ -84,6 +84,7 @@ typedef struct {
    struct ac_arrays Cache;
    struct ac_arrays Raw;
    struct ac_array_flags IsCached;
+   GLuint CacheBytes;		/* storage allocated for the Cache arrays */
    GLuint start;
    GLuint count;
 
@@ -96,4 +97,10 @@ typedef struct {
 
 #define AC_CONTEXT(ctx) ((ACcontext *)ctx->acache_context)
 
+/* Number of elements each cache array holds, and the initial size of
+ * the element list:
+ */
+#define AC_CACHE_SIZE(ctx) ((ctx)->Const.MaxArrayLockSize + MAX_CLIPPED_VERTICES)
+#define AC_INITIAL_ELTS 1000
+
 #endif
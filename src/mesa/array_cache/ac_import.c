@@ -42,6 +42,25 @@ do {									\
 } while (0)
 
 
+/* The cache arrays get their storage the first time data is imported
+ * into them, since most contexts only ever convert a few kinds of array.
+ */
+static void
+alloc_cache( GLcontext *ctx, struct gl_client_array *to, GLuint elemSize )
+{
+   if (!to->Ptr) {
+      ACcontext *ac = AC_CONTEXT(ctx);
+      const GLuint bytes = elemSize * AC_CACHE_SIZE(ctx);
+
+      to->Ptr = (GLubyte *) MALLOC( bytes );
+      if (to->Ptr)
+	 ac->CacheBytes += bytes;
+      else
+	 _mesa_error( ctx, GL_OUT_OF_MEMORY, "array cache" );
+   }
+}
+
+
 /* Set the array pointer back to its source when the cached data is
  * invalidated:
  */
@@ -278,6 +297,8 @@ import_texcoord( GLcontext *ctx, GLuint unit, GLenum type, GLuint stride )
    struct gl_client_array *to = &ac->Cache.TexCoord[unit];
    (void) type; (void) stride;
 
+   alloc_cache( ctx, to, 4 * sizeof(GLfloat) );
+
    ASSERT(unit < ctx->Const.MaxTextureCoordUnits);
 
    /* Limited choices at this stage:
@@ -308,6 +329,8 @@ import_vertex( GLcontext *ctx, GLenum type, GLuint stride )
    struct gl_client_array *to = &ac->Cache.Vertex;
    (void) type; (void) stride;
 
+   alloc_cache( ctx, to, 4 * sizeof(GLfloat) );
+
    /* Limited choices at this stage:
     */
    ASSERT(type == GL_FLOAT);
@@ -335,6 +358,8 @@ import_normal( GLcontext *ctx, GLenum type, GLuint stride )
    struct gl_client_array *to = &ac->Cache.Normal;
    (void) type; (void) stride;
 
+   alloc_cache( ctx, to, 3 * sizeof(GLfloat) );
+
    /* Limited choices at this stage:
     */
    ASSERT(type == GL_FLOAT);
@@ -360,6 +385,8 @@ import_color( GLcontext *ctx, GLenum type, GLuint stride )
    struct gl_client_array *to = &ac->Cache.Color;
    (void) stride;
 
+   alloc_cache( ctx, to, 4 * sizeof(GLfloat) );
+
    import( ctx, type, to, from );
    
    ac->IsCached.Color = GL_TRUE;
@@ -373,6 +400,8 @@ import_index( GLcontext *ctx, GLenum type, GLuint stride )
    struct gl_client_array *to = &ac->Cache.Index;
    (void) type; (void) stride;
 
+   alloc_cache( ctx, to, sizeof(GLuint) );
+
    /* Limited choices at this stage:
     */
    ASSERT(type == GL_UNSIGNED_INT);
@@ -398,6 +427,8 @@ import_secondarycolor( GLcontext *ctx, GLenum type, GLuint stride )
    struct gl_client_array *to = &ac->Cache.SecondaryColor;
    (void) stride;
 
+   alloc_cache( ctx, to, 4 * sizeof(GLfloat) );
+
    import( ctx, type, to, from );
 
    ac->IsCached.SecondaryColor = GL_TRUE;
@@ -411,6 +442,8 @@ import_fogcoord( GLcontext *ctx, GLenum type, GLuint stride )
    struct gl_client_array *to = &ac->Cache.FogCoord;
    (void) type; (void) stride;
 
+   alloc_cache( ctx, to, sizeof(GLfloat) );
+
    /* Limited choices at this stage:
     */
    ASSERT(type == GL_FLOAT);
@@ -436,6 +469,8 @@ import_edgeflag( GLcontext *ctx, GLenum type, GLuint stride )
    struct gl_client_array *to = &ac->Cache.EdgeFlag;
    (void) type; (void) stride;
 
+   alloc_cache( ctx, to, sizeof(GLubyte) );
+
    /* Limited choices at this stage:
     */
    ASSERT(type == GL_UNSIGNED_BYTE);
@@ -461,6 +496,8 @@ import_attrib( GLcontext *ctx, GLuint index, GLenum type, GLuint stride )
    struct gl_client_array *to = &ac->Cache.Attrib[index];
    (void) type; (void) stride;
 
+   alloc_cache( ctx, to, 4 * sizeof(GLfloat) );
+
    ASSERT(index < MAX_VERTEX_PROGRAM_ATTRIBS);
 
    /* Limited choices at this stage:
@@ -41,6 +41,15 @@ _ac_DestroyContext( GLcontext *ctx );
 extern void
 _ac_InvalidateState( GLcontext *ctx, GLuint new_state );
 
+/* Give back the conversion buffers of an idle context, which are
+ * reallocated by the next import, and report the memory held:
+ */
+extern void
+_ac_TrimContext( GLcontext *ctx );
+
+extern GLuint
+_ac_ContextMemory( GLcontext *ctx );
+
 extern struct gl_client_array *
 _ac_import_vertex( GLcontext *ctx,
 		   GLenum type,
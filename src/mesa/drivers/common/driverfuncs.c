@@ -79,6 +79,7 @@ _mesa_init_driver_functions(struct dd_function_table *driver)
    driver->ReadPixels = _swrast_ReadPixels;
    driver->CopyPixels = _swrast_CopyPixels;
    driver->Bitmap = _swrast_Bitmap;
+   driver->DrawGlyphs = _swrast_DrawGlyphs;
 
    /* Texture functions */
    driver->ChooseTextureFormat = _mesa_choose_tex_format;
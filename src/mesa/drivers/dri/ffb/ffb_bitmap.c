@@ -156,4 +156,5 @@ ffb_bitmap(GLcontext *ctx, GLint px, GLint py,
 void ffbDDInitBitmapFuncs(GLcontext *ctx)
 {
 	ctx->Driver.Bitmap = ffb_bitmap;
+	ctx->Driver.DrawGlyphs = NULL;
 }
@@ -486,7 +486,9 @@ void r200InitPixelFuncs( GLcontext *ctx )
    if (!getenv("R200_NO_BLITS") && R200_CONTEXT(ctx)->dri.drmMinor >= 6) {
       ctx->Driver.ReadPixels = r200ReadPixels;  
       ctx->Driver.DrawPixels = r200DrawPixels; 
-      if (getenv("R200_HW_BITMAP")) 
+      if (getenv("R200_HW_BITMAP")) {
 	 ctx->Driver.Bitmap = r200Bitmap;
+	 ctx->Driver.DrawGlyphs = NULL;
+      }
    }
 }
@@ -2352,6 +2352,9 @@ void fxSetupDDPointers(GLcontext *ctx)
       ctx->Driver.Bitmap = fxDDDrawBitmap4;
       break;
    }
+   /* glyph batches would bypass our Bitmap functions */
+   if (ctx->Driver.Bitmap != _swrast_Bitmap)
+      ctx->Driver.DrawGlyphs = NULL;
 
    /* Nejc - Half here are for textures ?????*/
    ctx->Driver.Finish = fxDDFinish;
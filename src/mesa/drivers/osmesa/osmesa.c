@@ -35,11 +35,16 @@
 
 #include "glheader.h"
 #include "GL/osmesa.h"
+#include "api_marshal.h"
+#include "api_trace.h"
 #include "context.h"
+#include "dispatch.h"
+#include "dlist.h"
 #include "extensions.h"
 #include "framebuffer.h"
 #include "fbobject.h"
 #include "imports.h"
+#include "matrix.h"
 #include "mtypes.h"
 #include "renderbuffer.h"
 #include "array_cache/acache.h"
@@ -53,6 +58,15 @@
 #include "tnl/t_context.h"
 #include "tnl/t_pipeline.h"
 #include "drivers/common/driverfuncs.h"
+#include "glapi/glthread.h"
+
+#ifdef PTHREADS
+#include <pthread.h>
+#endif
+
+
+/* Largest OSMESA_TILE_THREADS */
+#define MAX_TILE_THREADS 32
 
 
 
@@ -78,6 +92,12 @@ struct osmesa_context {
    GLchan *rowaddr[MAX_HEIGHT];	/* address of first pixel in each image row */
    GLboolean yup;		/* TRUE  -> Y increases upward */
 				/* FALSE -> Y increases downward */
+   GLint tileX, tileY;		/* the part of the image drawn by this */
+   GLint tileW, tileH;		/* context, all of it unless tiled */
+   GLint maxTileWidth;		/* images larger than this are tiled */
+   GLint maxTileHeight;
+   GLint tileThreads;		/* threads replaying the tiles */
+   struct osmesa_tiler *tiler;	/* tiled rendering state, or NULL */
 };
 
 
@@ -142,8 +162,8 @@ get_buffer_size( GLframebuffer *buffer, GLuint *width, GLuint *height )
    (void) buffer;
    if (ctx) {
       OSMesaContext osmesa = OSMESA_CONTEXT(ctx);
-      *width = osmesa->width;
-      *height = osmesa->height;
+      *width = osmesa->tileW;
+      *height = osmesa->tileH;
    }
 }
 
@@ -419,6 +439,71 @@ do {							\
 
 
 
+/*
+ * Draw a flat-shaded, RGB line into one tile of an osmesa buffer.  The line
+ * is stepped in the coordinates of the whole image, like flat_rgba_line
+ * does, and only the pixels inside the tile (and scissor box) are written.
+ */
+#define NAME flat_rgba_tile_line
+#define CLIP_HACK 1
+#define CLIP_HACK_WIDTH   (osmesa->width - osmesa->tileX)
+#define CLIP_HACK_HEIGHT  (osmesa->height - osmesa->tileY)
+#define SETUP_CODE						\
+   const OSMesaContext osmesa = OSMESA_CONTEXT(ctx);		\
+   const GLframebuffer *fb = ctx->DrawBuffer;			\
+   const GLchan *color = vert1->color;
+
+#define PLOT(X, Y)						\
+do {								\
+   if (X >= fb->_Xmin && X < fb->_Xmax &&			\
+       Y >= fb->_Ymin && Y < fb->_Ymax) {			\
+      GLchan *p = PIXELADDR4(X, Y);				\
+      PACK_RGBA(p, color[0], color[1], color[2], color[3]);	\
+   }								\
+} while (0)
+
+#ifdef WIN32
+#include "..\swrast\s_linetemp.h"
+#else
+#include "swrast/s_linetemp.h"
+#endif
+
+
+
+/*
+ * Draw a flat-shaded, Z-less, RGB line into one tile of an osmesa buffer.
+ */
+#define NAME flat_rgba_z_tile_line
+#define CLIP_HACK 1
+#define CLIP_HACK_WIDTH   (osmesa->width - osmesa->tileX)
+#define CLIP_HACK_HEIGHT  (osmesa->height - osmesa->tileY)
+#define INTERP_Z 1
+#define DEPTH_TYPE DEFAULT_SOFTWARE_DEPTH_TYPE
+#define SETUP_CODE					\
+   const OSMesaContext osmesa = OSMESA_CONTEXT(ctx);	\
+   const GLframebuffer *fb = ctx->DrawBuffer;		\
+   const GLchan *color = vert1->color;
+
+#define PLOT(X, Y)					\
+do {							\
+   if (X >= fb->_Xmin && X < fb->_Xmax &&		\
+       Y >= fb->_Ymin && Y < fb->_Ymax &&		\
+       Z < *zPtr) {					\
+      GLchan *p = PIXELADDR4(X, Y);			\
+      PACK_RGBA(p, color[RCOMP], color[GCOMP],		\
+                   color[BCOMP], color[ACOMP]);		\
+      *zPtr = Z;					\
+   }							\
+} while (0)
+
+#ifdef WIN32
+#include "..\swrast\s_linetemp.h"
+#else
+#include "swrast/s_linetemp.h"
+#endif
+
+
+
 /*
  * Analyze context state to see if we can provide a fast line drawing
  * function, like those in lines.c.  Otherwise, return NULL.
@@ -441,6 +526,22 @@ osmesa_choose_line_function( GLcontext *ctx )
        osmesa->format != OSMESA_BGRA &&
        osmesa->format != OSMESA_ARGB)     return NULL;
 
+   if (ctx->DrawBuffer->Tiled) {
+      /* CLIP_BIT is always set for a tile, clipping to the tile is done
+       * by the tile lines themselves.
+       */
+      if ((swrast->_RasterMask & ~CLIP_BIT) == DEPTH_BIT
+          && ctx->Depth.Func==GL_LESS
+          && ctx->Depth.Mask==GL_TRUE
+          && ctx->Visual.depthBits == DEFAULT_SOFTWARE_DEPTH_BITS) {
+         return (swrast_line_func) flat_rgba_z_tile_line;
+      }
+      if ((swrast->_RasterMask & ~CLIP_BIT) == 0) {
+         return (swrast_line_func) flat_rgba_tile_line;
+      }
+      return (swrast_line_func) NULL;
+   }
+
    if (swrast->_RasterMask==DEPTH_BIT
        && ctx->Depth.Func==GL_LESS
        && ctx->Depth.Mask==GL_TRUE
@@ -729,6 +830,20 @@ new_osmesa_renderbuffer(GLenum format)
 
 
 
+static void
+osmesa_finish( GLcontext *ctx );
+
+static void GLAPIENTRY
+osmesa_NewList( GLuint list, GLenum mode );
+
+static void GLAPIENTRY
+osmesa_EndList( void );
+
+static void
+destroy_tiler( OSMesaContext osmesa );
+
+
+
 /**********************************************************************/
 /*****                    Public Functions                        *****/
 /**********************************************************************/
@@ -754,13 +869,12 @@ OSMesaCreateContext( GLenum format, OSMesaContext sharelist )
 
 
 /*
- * New in Mesa 3.5
- *
- * Create context and specify size of ancillary buffers.
+ * Create a context, without a worker thread.  The tiles' contexts are
+ * made with this too.
  */
-GLAPI OSMesaContext GLAPIENTRY
-OSMesaCreateContextExt( GLenum format, GLint depthBits, GLint stencilBits,
-                        GLint accumBits, OSMesaContext sharelist )
+static OSMesaContext
+create_context( GLenum format, GLint depthBits, GLint stencilBits,
+                GLint accumBits, OSMesaContext sharelist )
 {
    OSMesaContext osmesa;
    struct dd_function_table functions;
@@ -930,6 +1044,8 @@ OSMesaCreateContextExt( GLenum format, GLint depthBits, GLint stencilBits,
       functions.GetString = get_string;
       functions.UpdateState = osmesa_update_state;
       functions.GetBufferSize = get_buffer_size;
+      functions.Finish = osmesa_finish;
+      functions.Flush = osmesa_finish;
 
       if (!_mesa_initialize_context(&osmesa->mesa,
                                     osmesa->gl_visual,
@@ -941,6 +1057,10 @@ OSMesaCreateContextExt( GLenum format, GLint depthBits, GLint stencilBits,
          return NULL;
       }
 
+      /* glNewList/glEndList have to end the frame when tiling */
+      SET_NewList(osmesa->mesa.Save, osmesa_NewList);
+      SET_EndList(osmesa->mesa.Save, osmesa_EndList);
+
       _mesa_enable_sw_extensions(&(osmesa->mesa));
       _mesa_enable_1_3_extensions(&(osmesa->mesa));
       _mesa_enable_1_4_extensions(&(osmesa->mesa));
@@ -972,6 +1092,14 @@ OSMesaCreateContextExt( GLenum format, GLint depthBits, GLint stencilBits,
       osmesa->userRowLength = 0;
       osmesa->rowlength = 0;
       osmesa->yup = GL_TRUE;
+      osmesa->tileX = 0;
+      osmesa->tileY = 0;
+      osmesa->tileW = 0;
+      osmesa->tileH = 0;
+      osmesa->maxTileWidth = MAX_WIDTH;
+      osmesa->maxTileHeight = MAX_HEIGHT;
+      osmesa->tileThreads = 1;
+      osmesa->tiler = NULL;
       osmesa->rshift = rshift;
       osmesa->gshift = gshift;
       osmesa->bshift = bshift;
@@ -1021,6 +1149,27 @@ OSMesaCreateContextExt( GLenum format, GLint depthBits, GLint stencilBits,
 }
 
 
+/*
+ * New in Mesa 3.5
+ *
+ * Create context and specify size of ancillary buffers.
+ * With MESA_GLTHREAD set, the context's commands are executed on a worker
+ * thread; call glFinish before reading the image.  With MESA_TRACE set,
+ * they are recorded into that file instead.
+ */
+GLAPI OSMesaContext GLAPIENTRY
+OSMesaCreateContextExt( GLenum format, GLint depthBits, GLint stencilBits,
+                        GLint accumBits, OSMesaContext sharelist )
+{
+   OSMesaContext osmesa = create_context(format, depthBits, stencilBits,
+                                         accumBits, sharelist);
+   if (osmesa && !_mesa_trace_init(&osmesa->mesa) &&
+       _mesa_getenv("MESA_GLTHREAD"))
+      _mesa_marshal_init(&osmesa->mesa);
+   return osmesa;
+}
+
+
 /*
  * Destroy an Off-Screen Mesa rendering context.
  *
@@ -1030,6 +1179,10 @@ GLAPI void GLAPIENTRY
 OSMesaDestroyContext( OSMesaContext ctx )
 {
    if (ctx) {
+      _mesa_marshal_destroy( &ctx->mesa );
+      if (ctx->tiler)
+         destroy_tiler( ctx );
+
       _swsetup_DestroyContext( &ctx->mesa );
       _tnl_DestroyContext( &ctx->mesa );
       _ac_DestroyContext( &ctx->mesa );
@@ -1071,22 +1224,574 @@ compute_row_addresses( OSMesaContext ctx )
 
    bytesPerRow = ctx->rowlength * bytesPerPixel;
 
+   /* the part of the image drawn by this context */
+   origin += ctx->tileX * bytesPerPixel;
+
    if (ctx->yup) {
       /* Y=0 is bottom line of window */
       for (i = 0; i < MAX_HEIGHT; i++) {
-         ctx->rowaddr[i] = (GLchan *) ((GLubyte *) origin + i * bytesPerRow);
+         GLint j = ctx->tileY + i;
+         ctx->rowaddr[i] = (GLchan *) ((GLubyte *) origin + j * bytesPerRow);
       }
    }
    else {
       /* Y=0 is top line of window */
       for (i = 0; i < MAX_HEIGHT; i++) {
-         GLint j = ctx->height - i - 1;
+         GLint j = ctx->height - ctx->tileY - i - 1;
          ctx->rowaddr[i] = (GLchan *) ((GLubyte *) origin + j * bytesPerRow);
       }
    }
 }
 
 
+/**********************************************************************/
+/*****                    Tiled rendering                         *****/
+/**********************************************************************/
+
+/*
+ * Images larger than the tile size are rendered in tiles.  The context
+ * itself draws the lower-left tile as the commands arrive and records them
+ * in a display list.  When the frame ends (glFinish or glFlush) the list is
+ * replayed by a context per remaining tile, each drawing its part of the
+ * image into a framebuffer of tile size.  The tile contexts share the
+ * display lists and texture objects of the main context and, since they
+ * execute the same commands, their state tracks the main context's.
+ *
+ * The core offsets the viewport and scissor of a framebuffer marked as
+ * Tiled, so every tile context sees the viewport of the whole image.
+ */
+struct osmesa_tiler {
+   GLint tileWidth, tileHeight;	/* size of the full tiles */
+   GLint cols, rows;
+   GLint numTiles;
+   OSMesaContext *tiles;	/* [numTiles], tiles[0] is the main context */
+   GLint numBuffers;		/* one framebuffer per replaying thread */
+   GLframebuffer **buffers;
+   GLuint list;			/* display list recording the frame */
+   GLuint listBase;		/* glListBase when the recording began */
+   GLboolean recording;
+   GLuint appList;		/* list being defined by the application */
+   GLenum appListMode;
+   GLuint replayList;		/* list being replayed */
+   GLint nextTile;		/* next tile to replay */
+   _glthread_Mutex Mutex;	/* protects nextTile */
+};
+
+
+/*
+ * Create a framebuffer like the context's, for replaying tiles.
+ */
+static GLframebuffer *
+create_tile_buffer( OSMesaContext osmesa )
+{
+   GLframebuffer *fb = _mesa_create_framebuffer(osmesa->gl_visual);
+   if (fb) {
+      _mesa_add_renderbuffer(fb, BUFFER_FRONT_LEFT,
+                             new_osmesa_renderbuffer(osmesa->format));
+      _mesa_add_soft_renderbuffers(fb,
+                                   GL_FALSE, /* color */
+                                   osmesa->gl_visual->haveDepthBuffer,
+                                   osmesa->gl_visual->haveStencilBuffer,
+                                   osmesa->gl_visual->haveAccumBuffer,
+                                   GL_FALSE, /* alpha */
+                                   GL_FALSE /* aux */ );
+      fb->Tiled = GL_TRUE;
+   }
+   return fb;
+}
+
+
+static void
+copy_matrix_stack( struct matrix_stack *dst, const struct matrix_stack *src )
+{
+   GLuint i;
+   ASSERT(dst->MaxDepth == src->MaxDepth);
+   if (!_mesa_alloc_matrix_stack(dst, src->Depth))
+      return;
+   for (i = 0; i <= src->Depth; i++)
+      _math_matrix_copy(&dst->Stack[i], &src->Stack[i]);
+   dst->Depth = src->Depth;
+   dst->Top = &dst->Stack[dst->Depth];
+}
+
+
+/*
+ * Make a tile context share one of the main context's texture bindings.
+ */
+static void
+share_texture( GLcontext *ctx, struct gl_texture_object **binding,
+               struct gl_texture_object *texObj )
+{
+   struct gl_texture_object *oldTexObj = *binding;
+   if (oldTexObj == texObj)
+      return;
+   _glthread_LOCK_MUTEX(ctx->Shared->Mutex);
+   texObj->RefCount++;
+   /* a new context has the default textures bound, never freed here */
+   oldTexObj->RefCount--;
+   ASSERT(oldTexObj->RefCount > 0);
+   _glthread_UNLOCK_MUTEX(ctx->Shared->Mutex);
+   *binding = texObj;
+}
+
+
+/*
+ * Take a reference to a program a tile context now has bound, as
+ * glBindProgram does.  A new context has the default programs bound
+ * already, so nothing is needed for those.
+ */
+static void
+share_program( struct program *prog )
+{
+   if (prog->Id != 0)
+      prog->RefCount++;
+}
+
+
+/*
+ * Give a new tile context the state of the main context.  The tile
+ * context is bound to the same texture objects and programs, then gets
+ * the rest of the state copied.
+ */
+static void
+seed_tile( OSMesaContext osmesa, OSMesaContext tile )
+{
+   GLcontext *src = &osmesa->mesa;
+   GLcontext *dst = &tile->mesa;
+   GLuint i;
+
+   for (i = 0; i < MAX_TEXTURE_UNITS; i++) {
+      const struct gl_texture_unit *s = &src->Texture.Unit[i];
+      struct gl_texture_unit *d = &dst->Texture.Unit[i];
+      share_texture(dst, &d->Current1D, s->Current1D);
+      share_texture(dst, &d->Current2D, s->Current2D);
+      share_texture(dst, &d->Current3D, s->Current3D);
+      share_texture(dst, &d->CurrentCubeMap, s->CurrentCubeMap);
+      share_texture(dst, &d->CurrentRect, s->CurrentRect);
+   }
+
+   dst->VertexProgram.Current = src->VertexProgram.Current;
+   share_program(&dst->VertexProgram.Current->Base);
+   dst->FragmentProgram.Current = src->FragmentProgram.Current;
+   share_program(&dst->FragmentProgram.Current->Base);
+   dst->ATIFragmentShader.Current = src->ATIFragmentShader.Current;
+   share_program(&dst->ATIFragmentShader.Current->Base);
+
+   dst->VertexProgram.Enabled = src->VertexProgram.Enabled;
+   dst->VertexProgram.PointSizeEnabled = src->VertexProgram.PointSizeEnabled;
+   dst->VertexProgram.TwoSideEnabled = src->VertexProgram.TwoSideEnabled;
+   MEMCPY(dst->VertexProgram.TrackMatrix, src->VertexProgram.TrackMatrix,
+          sizeof(src->VertexProgram.TrackMatrix));
+   MEMCPY(dst->VertexProgram.TrackMatrixTransform,
+          src->VertexProgram.TrackMatrixTransform,
+          sizeof(src->VertexProgram.TrackMatrixTransform));
+   MEMCPY(dst->VertexProgram.Parameters, src->VertexProgram.Parameters,
+          sizeof(src->VertexProgram.Parameters));
+   dst->FragmentProgram.Enabled = src->FragmentProgram.Enabled;
+   MEMCPY(dst->FragmentProgram.Parameters, src->FragmentProgram.Parameters,
+          sizeof(src->FragmentProgram.Parameters));
+   dst->ATIFragmentShader.Enabled = src->ATIFragmentShader.Enabled;
+
+   /* the texture objects are now the same, so they copy onto themselves */
+   _mesa_copy_context(src, dst, GL_ALL_ATTRIB_BITS);
+
+   copy_matrix_stack(&dst->ModelviewMatrixStack, &src->ModelviewMatrixStack);
+   copy_matrix_stack(&dst->ProjectionMatrixStack, &src->ProjectionMatrixStack);
+   copy_matrix_stack(&dst->ColorMatrixStack, &src->ColorMatrixStack);
+   for (i = 0; i < MAX_TEXTURE_COORD_UNITS; i++)
+      copy_matrix_stack(&dst->TextureMatrixStack[i],
+                        &src->TextureMatrixStack[i]);
+   for (i = 0; i < MAX_PROGRAM_MATRICES; i++)
+      copy_matrix_stack(&dst->ProgramMatrixStack[i],
+                        &src->ProgramMatrixStack[i]);
+   /* the stacks are embedded in the context */
+   dst->CurrentStack = (struct matrix_stack *)
+      ((GLubyte *) dst + ((const GLubyte *) src->CurrentStack -
+                          (const GLubyte *) src));
+
+   dst->Const.MaxViewportWidth = src->Const.MaxViewportWidth;
+   dst->Const.MaxViewportHeight = src->Const.MaxViewportHeight;
+   /* keep the viewport copied above */
+   dst->FirstTimeCurrent = GL_FALSE;
+   dst->NewState = _NEW_ALL;
+}
+
+
+static void
+destroy_tiler( OSMesaContext osmesa )
+{
+   struct osmesa_tiler *tiler = osmesa->tiler;
+   GLint i;
+
+   /* drop the frame being recorded */
+   if (tiler->recording && _mesa_get_current_context() == &osmesa->mesa) {
+      tiler->recording = GL_FALSE;
+      _mesa_EndList();
+   }
+
+   for (i = 1; i < tiler->numTiles; i++) {
+      if (tiler->tiles[i])
+         OSMesaDestroyContext(tiler->tiles[i]);
+   }
+   for (i = 0; i < tiler->numBuffers; i++) {
+      if (tiler->buffers[i])
+         _mesa_destroy_framebuffer(tiler->buffers[i]);
+   }
+   if (tiler->list)
+      _mesa_destroy_list(&osmesa->mesa, tiler->list);
+   _glthread_DESTROY_MUTEX(tiler->Mutex);
+
+   _mesa_free(tiler->tiles);
+   _mesa_free(tiler->buffers);
+   _mesa_free(tiler);
+   osmesa->tiler = NULL;
+   osmesa->gl_buffer->Tiled = GL_FALSE;
+}
+
+
+/*
+ * Point a context at its part of the image.
+ */
+static void
+set_tile( OSMesaContext tile, const OSMesaContext osmesa,
+          GLint x, GLint y, GLint width, GLint height )
+{
+   tile->buffer = osmesa->buffer;
+   tile->width = osmesa->width;
+   tile->height = osmesa->height;
+   tile->rowlength = osmesa->rowlength;
+   tile->yup = osmesa->yup;
+   tile->tileX = x;
+   tile->tileY = y;
+   tile->tileW = width;
+   tile->tileH = height;
+   compute_row_addresses(tile);
+}
+
+
+/*
+ * Size of the tiles the context's image is split into.
+ */
+static void
+choose_tile_size( const OSMesaContext osmesa, GLint *width, GLint *height )
+{
+   GLint tw = MIN2(osmesa->width, osmesa->maxTileWidth);
+   GLint th = MIN2(osmesa->height, osmesa->maxTileHeight);
+
+   /* keep stipple and dither patterns continuous across tiles */
+   if (tw < osmesa->width && tw >= 32)
+      tw &= ~31;
+   if (th < osmesa->height && th >= 32)
+      th &= ~31;
+   *width = tw;
+   *height = th;
+}
+
+
+/*
+ * Split the image into tiles, creating the tile contexts if the layout
+ * changed.  The context must be current and not recording.
+ * Return:  GL_FALSE if out of memory.
+ */
+static GLboolean
+setup_tiles( OSMesaContext osmesa )
+{
+   struct osmesa_tiler *tiler = osmesa->tiler;
+   GLint tw, th, cols, rows, numBuffers, i;
+
+   choose_tile_size(osmesa, &tw, &th);
+   cols = (osmesa->width + tw - 1) / tw;
+   rows = (osmesa->height + th - 1) / th;
+
+#ifdef PTHREADS
+   numBuffers = MIN2(osmesa->tileThreads, cols * rows - 1);
+#else
+   numBuffers = 1;
+#endif
+
+   if (tiler && (tiler->tileWidth != tw || tiler->tileHeight != th ||
+                 tiler->cols != cols || tiler->rows != rows ||
+                 tiler->numBuffers != numBuffers)) {
+      destroy_tiler(osmesa);
+      tiler = NULL;
+   }
+
+   set_tile(osmesa, osmesa, 0, 0, tw, th);
+   if (cols * rows == 1)
+      return GL_TRUE;
+
+   if (!tiler) {
+      tiler = CALLOC_STRUCT(osmesa_tiler);
+      if (!tiler)
+         return GL_FALSE;
+      osmesa->tiler = tiler;
+      _glthread_INIT_MUTEX(tiler->Mutex);
+      tiler->tileWidth = tw;
+      tiler->tileHeight = th;
+      tiler->cols = cols;
+      tiler->rows = rows;
+      tiler->numTiles = cols * rows;
+      tiler->numBuffers = numBuffers;
+      tiler->tiles = (OSMesaContext *)
+         _mesa_calloc(tiler->numTiles * sizeof(OSMesaContext));
+      tiler->buffers = (GLframebuffer **)
+         _mesa_calloc(numBuffers * sizeof(GLframebuffer *));
+      if (!tiler->tiles || !tiler->buffers) {
+         destroy_tiler(osmesa);
+         return GL_FALSE;
+      }
+
+      {
+         GLcontext *ctx = &osmesa->mesa;
+         FLUSH_VERTICES(ctx, 0);
+      }
+      tiler->tiles[0] = osmesa;
+      for (i = 1; i < tiler->numTiles; i++) {
+         const GLvisual *vis = osmesa->gl_visual;
+         OSMesaContext tile = create_context(osmesa->format,
+                                             vis->depthBits,
+                                             vis->stencilBits,
+                                             vis->accumRedBits,
+                                             osmesa);
+         tiler->tiles[i] = tile;
+         if (!tile) {
+            destroy_tiler(osmesa);
+            return GL_FALSE;
+         }
+         seed_tile(osmesa, tile);
+      }
+      for (i = 0; i < numBuffers; i++) {
+         tiler->buffers[i] = create_tile_buffer(osmesa);
+         if (!tiler->buffers[i]) {
+            destroy_tiler(osmesa);
+            return GL_FALSE;
+         }
+      }
+      tiler->list = _mesa_GenLists(1);
+   }
+
+   for (i = 1; i < tiler->numTiles; i++) {
+      const GLint x = (i % cols) * tw, y = (i / cols) * th;
+      set_tile(tiler->tiles[i], osmesa, x, y,
+               MIN2(tw, osmesa->width - x), MIN2(th, osmesa->height - y));
+   }
+
+   osmesa->gl_buffer->Tiled = GL_TRUE;
+   osmesa->gl_buffer->TileX = 0;
+   osmesa->gl_buffer->TileY = 0;
+   return GL_TRUE;
+}
+
+
+/*
+ * Draw one tile by replaying the frame's commands on its context.
+ */
+static void
+replay_tile( OSMesaContext tile, GLframebuffer *fb, GLuint list )
+{
+   GLcontext *ctx = &tile->mesa;
+
+   fb->TileX = tile->tileX;
+   fb->TileY = tile->tileY;
+   _mesa_make_current(ctx, fb, fb);
+   _mesa_resize_framebuffer(ctx, fb, tile->tileW, tile->tileH);
+   ctx->NewState |= _NEW_BUFFERS;
+
+   _mesa_CallList(list);
+   _mesa_Finish();
+}
+
+
+/*
+ * Replay tiles until none are left, using the given framebuffer.
+ */
+static void
+replay_tiles( struct osmesa_tiler *tiler, GLframebuffer *fb )
+{
+   for (;;) {
+      GLint k;
+      _glthread_LOCK_MUTEX(tiler->Mutex);
+      k = tiler->nextTile++;
+      _glthread_UNLOCK_MUTEX(tiler->Mutex);
+      if (k >= tiler->numTiles)
+         break;
+      replay_tile(tiler->tiles[k], fb, tiler->replayList);
+   }
+}
+
+
+#ifdef PTHREADS
+struct tile_thread {
+   pthread_t thread;
+   struct osmesa_tiler *tiler;
+   GLframebuffer *fb;
+};
+
+static void *
+tile_thread_main( void *data )
+{
+   struct tile_thread *t = (struct tile_thread *) data;
+   replay_tiles(t->tiler, t->fb);
+   _mesa_make_current(NULL, NULL, NULL);
+   return NULL;
+}
+#endif
+
+
+/*
+ * Draw all tiles but the first with the given list.  Lists changing
+ * objects shared between the tile contexts are replayed by one thread.
+ */
+static void
+draw_tiles( OSMesaContext osmesa, GLuint list, GLuint listBase )
+{
+   struct osmesa_tiler *tiler = osmesa->tiler;
+   GLint numThreads = 1;
+
+   tiler->replayList = list;
+   tiler->nextTile = 1;
+
+#ifdef PTHREADS
+   if (tiler->numBuffers > 1 &&
+       !_mesa_list_changes_shared_state(&osmesa->mesa, list, listBase)) {
+      struct tile_thread threads[MAX_TILE_THREADS];
+      GLint i;
+
+      for (i = 1; i < tiler->numBuffers; i++) {
+         threads[i].tiler = tiler;
+         threads[i].fb = tiler->buffers[i];
+         if (pthread_create(&threads[i].thread, NULL, tile_thread_main,
+                            &threads[i]) != 0)
+            break;
+      }
+      numThreads = i;
+      replay_tiles(tiler, tiler->buffers[0]);
+      for (i = 1; i < numThreads; i++)
+         pthread_join(threads[i].thread, NULL);
+   }
+#else
+   (void) listBase;
+#endif
+   if (numThreads == 1)
+      replay_tiles(tiler, tiler->buffers[0]);
+
+   _mesa_make_current(&osmesa->mesa, osmesa->gl_buffer, osmesa->gl_buffer);
+}
+
+
+static void
+begin_frame( OSMesaContext osmesa )
+{
+   struct osmesa_tiler *tiler = osmesa->tiler;
+   tiler->listBase = osmesa->mesa.List.ListBase;
+   tiler->recording = GL_TRUE;
+   _mesa_NewList(tiler->list, GL_COMPILE_AND_EXECUTE);
+}
+
+
+/*
+ * Stop recording and draw the other tiles.  The context must be current.
+ */
+static void
+end_frame( OSMesaContext osmesa, GLboolean restart )
+{
+   struct osmesa_tiler *tiler = osmesa->tiler;
+   tiler->recording = GL_FALSE;
+   _mesa_EndList();
+   draw_tiles(osmesa, tiler->list, tiler->listBase);
+   if (restart)
+      begin_frame(osmesa);
+}
+
+
+/*
+ * Called by glFinish and glFlush, which end a frame.
+ */
+static void
+osmesa_finish( GLcontext *ctx )
+{
+   OSMesaContext osmesa = OSMESA_CONTEXT(ctx);
+   if (osmesa->tiler && osmesa->tiler->recording)
+      end_frame(osmesa, GL_TRUE);
+}
+
+
+/*
+ * glNewList and glEndList while recording a frame.  The application's
+ * lists are compiled in between two frames; those compiled and executed
+ * are also replayed on the tiles.
+ */
+static void GLAPIENTRY
+osmesa_NewList( GLuint list, GLenum mode )
+{
+   GET_CURRENT_CONTEXT(ctx);
+   OSMesaContext osmesa = OSMESA_CONTEXT(ctx);
+   struct osmesa_tiler *tiler = osmesa->tiler;
+
+   if (tiler && tiler->recording) {
+      end_frame(osmesa, GL_FALSE);
+      tiler->appList = list;
+      tiler->appListMode = mode;
+      tiler->listBase = ctx->List.ListBase;
+      _mesa_NewList(list, mode);
+      if (!ctx->ListState.CurrentListPtr) {
+         /* bad list or mode */
+         tiler->appList = 0;
+         begin_frame(osmesa);
+      }
+      return;
+   }
+
+   /* already compiling a list, _mesa_NewList records the error */
+   _mesa_NewList(list, mode);
+}
+
+
+static void GLAPIENTRY
+osmesa_EndList( void )
+{
+   GET_CURRENT_CONTEXT(ctx);
+   OSMesaContext osmesa = OSMESA_CONTEXT(ctx);
+   struct osmesa_tiler *tiler = osmesa->tiler;
+
+   if (tiler && tiler->recording) {
+      /* the application isn't compiling a list */
+      _mesa_error(ctx, GL_INVALID_OPERATION, "glEndList");
+      return;
+   }
+
+   _mesa_EndList();
+
+   if (tiler && tiler->appList) {
+      if (tiler->appListMode == GL_COMPILE_AND_EXECUTE)
+         draw_tiles(osmesa, tiler->appList, tiler->listBase);
+      tiler->appList = 0;
+      begin_frame(osmesa);
+   }
+}
+
+
+/*
+ * Apply a change of the image or of the tile parameters.  Starts
+ * recording the next frame if the image is tiled.
+ */
+static GLboolean
+bind_tiles( OSMesaContext osmesa )
+{
+   if (!setup_tiles(osmesa))
+      return GL_FALSE;
+
+   /* this will make ensure we recognize the new buffer size */
+   _mesa_resize_framebuffer(&osmesa->mesa, osmesa->gl_buffer,
+                            osmesa->tileW, osmesa->tileH);
+
+   if (osmesa->tiler)
+      begin_frame(osmesa);
+   return GL_TRUE;
+}
+
+
+
 /*
  * Bind an OSMesaContext to an image buffer.  The image buffer is just a
  * block of memory which the client provides.  Its size must be at least
@@ -1108,17 +1813,20 @@ compute_row_addresses( OSMesaContext ctx )
  *            then type must be GL_UNSIGNED_SHORT.  And if Mesa's been build
  *            with CHAN_BITS==32 then type must be GL_FLOAT.
  *         width, height - size of image buffer in pixels, at least 1
+ * Images larger than the tile size are rendered in tiles.
+ *
  * Return:  GL_TRUE if success, GL_FALSE if error because of invalid ctx,
- *          invalid buffer address, invalid type, width<1, height<1,
- *          width>internal limit or height>internal limit.
+ *          invalid buffer address, invalid type, width<1, height<1 or
+ *          out of memory.
  */
 GLAPI GLboolean GLAPIENTRY
 OSMesaMakeCurrent( OSMesaContext ctx, void *buffer, GLenum type,
                    GLsizei width, GLsizei height )
 {
+   GLboolean firstTime;
+
    if (!ctx || !buffer ||
-       width < 1 || height < 1 ||
-       width > MAX_WIDTH || height > MAX_HEIGHT) {
+       width < 1 || height < 1) {
       return GL_FALSE;
    }
 
@@ -1130,6 +1838,14 @@ OSMesaMakeCurrent( OSMesaContext ctx, void *buffer, GLenum type,
       return GL_FALSE;
    }
 
+   _mesa_marshal_finish( &ctx->mesa );
+
+   /* finish the frame drawn into the previous image */
+   if (ctx->tiler && ctx->tiler->recording) {
+      _mesa_make_current( &ctx->mesa, ctx->gl_buffer, ctx->gl_buffer );
+      end_frame( ctx, GL_FALSE );
+   }
+
    /* Need to set these before calling _mesa_make_current() since the first
     * time the context is bound, _mesa_make_current() will call our
     * get_buffer_size() function to initialize the viewport.  These are the
@@ -1138,24 +1854,40 @@ OSMesaMakeCurrent( OSMesaContext ctx, void *buffer, GLenum type,
    ctx->buffer = buffer;
    ctx->width = width;
    ctx->height = height;
+   ctx->tileX = 0;
+   ctx->tileY = 0;
+   choose_tile_size( ctx, &ctx->tileW, &ctx->tileH );
 
+   /* the viewport covers the whole image, not just a tile */
+   ctx->mesa.Const.MaxViewportWidth = MAX2(MAX_WIDTH, width);
+   ctx->mesa.Const.MaxViewportHeight = MAX2(MAX_HEIGHT, height);
+
+   firstTime = ctx->mesa.FirstTimeCurrent;
    osmesa_update_state( &ctx->mesa, 0 );
    _mesa_make_current( &ctx->mesa, ctx->gl_buffer, ctx->gl_buffer );
 
+   if (firstTime) {
+      _mesa_set_viewport( &ctx->mesa, 0, 0, width, height );
+      ctx->mesa.Scissor.Width = width;
+      ctx->mesa.Scissor.Height = height;
+   }
+
    if (ctx->userRowLength)
       ctx->rowlength = ctx->userRowLength;
    else
       ctx->rowlength = width;
 
-   compute_row_addresses( ctx );
-
-   /* this will make ensure we recognize the new buffer size */
-   _mesa_resize_framebuffer(&ctx->mesa, ctx->gl_buffer, width, height);
+   if (!bind_tiles( ctx ))
+      return GL_FALSE;
 
    /* Added by Gerk Huisma: */
    _tnl_MakeCurrent( &ctx->mesa, ctx->mesa.DrawBuffer,
                      ctx->mesa.ReadBuffer );
 
+   /* starting to record a tiled frame switched to the real dispatch */
+   _mesa_marshal_make_current( &ctx->mesa );
+   _mesa_trace_make_current( &ctx->mesa, width, height );
+
    return GL_TRUE;
 }
 
@@ -1178,25 +1910,46 @@ OSMesaPixelStore( GLint pname, GLint value )
 {
    OSMesaContext osmesa = OSMesaGetCurrentContext();
 
+   if ((pname == OSMESA_ROW_LENGTH && value < 0) ||
+       ((pname == OSMESA_TILE_WIDTH || pname == OSMESA_TILE_HEIGHT ||
+         pname == OSMESA_TILE_THREADS) && value < 1)) {
+      _mesa_error( &osmesa->mesa, GL_INVALID_VALUE,
+                   "OSMesaPixelStore(value)" );
+      return;
+   }
+
+   _mesa_marshal_finish( &osmesa->mesa );
+
+   /* the frame recorded so far is drawn with the old parameters */
+   if (osmesa->tiler && osmesa->tiler->recording)
+      end_frame( osmesa, GL_FALSE );
+
    switch (pname) {
       case OSMESA_ROW_LENGTH:
-         if (value<0) {
-            _mesa_error( &osmesa->mesa, GL_INVALID_VALUE,
-                      "OSMesaPixelStore(value)" );
-            return;
-         }
          osmesa->userRowLength = value;
          osmesa->rowlength = value ? value : osmesa->width;
          break;
       case OSMESA_Y_UP:
          osmesa->yup = value ? GL_TRUE : GL_FALSE;
          break;
+      case OSMESA_TILE_WIDTH:
+         osmesa->maxTileWidth = MIN2(value, MAX_WIDTH);
+         break;
+      case OSMESA_TILE_HEIGHT:
+         osmesa->maxTileHeight = MIN2(value, MAX_HEIGHT);
+         break;
+      case OSMESA_TILE_THREADS:
+         osmesa->tileThreads = MIN2(value, MAX_TILE_THREADS);
+         break;
       default:
          _mesa_error( &osmesa->mesa, GL_INVALID_ENUM, "OSMesaPixelStore(pname)" );
-         return;
+         break;
    }
 
-   compute_row_addresses( osmesa );
+   if (!bind_tiles( osmesa ))
+      _mesa_error( &osmesa->mesa, GL_OUT_OF_MEMORY, "OSMesaPixelStore" );
+   _mesa_marshal_make_current( &osmesa->mesa );
+   _mesa_trace_make_current( &osmesa->mesa, osmesa->width, osmesa->height );
 }
 
 
@@ -1230,6 +1983,15 @@ OSMesaGetIntegerv( GLint pname, GLint *value )
       case OSMESA_MAX_HEIGHT:
          *value = MAX_HEIGHT;
          return;
+      case OSMESA_TILE_WIDTH:
+         *value = osmesa->maxTileWidth;
+         return;
+      case OSMESA_TILE_HEIGHT:
+         *value = osmesa->maxTileHeight;
+         return;
+      case OSMESA_TILE_THREADS:
+         *value = osmesa->tileThreads;
+         return;
       default:
          _mesa_error(&osmesa->mesa, GL_INVALID_ENUM, "OSMesaGetIntergerv(pname)");
          return;
@@ -1250,6 +2012,8 @@ OSMesaGetDepthBuffer( OSMesaContext c, GLint *width, GLint *height,
 {
    struct gl_renderbuffer *rb = NULL;
 
+   _mesa_marshal_finish( &c->mesa );
+
    if (c->gl_buffer)
       rb = c->gl_buffer->Attachment[BUFFER_DEPTH].Renderbuffer;
 
@@ -1285,6 +2049,8 @@ GLAPI GLboolean GLAPIENTRY
 OSMesaGetColorBuffer( OSMesaContext c, GLint *width,
                       GLint *height, GLint *format, void **buffer )
 {
+   _mesa_marshal_finish( &c->mesa );
+
    if (!c->buffer) {
       *width = 0;
       *height = 0;
@@ -1302,6 +2068,78 @@ OSMesaGetColorBuffer( OSMesaContext c, GLint *width,
 }
 
 
+/*
+ * Bytes of renderbuffer storage Mesa allocated for a framebuffer.  The
+ * color buffer is the application's.
+ */
+static GLuint
+framebuffer_memory( const GLframebuffer *fb )
+{
+   GLuint bytes = sizeof(GLframebuffer);
+   GLuint i;
+
+   for (i = 0; i < BUFFER_COUNT; i++) {
+      const struct gl_renderbuffer *rb = fb->Attachment[i].Renderbuffer;
+      if (rb && rb->AllocStorage != osmesa_renderbuffer_storage) {
+         const GLuint bits = rb->ComponentSizes[0] + rb->ComponentSizes[1]
+            + rb->ComponentSizes[2] + rb->ComponentSizes[3];
+         bytes += sizeof(*rb);
+         if (rb->Data)
+            bytes += rb->Width * rb->Height * (bits / 8);
+      }
+   }
+   return bytes;
+}
+
+
+GLAPI void GLAPIENTRY
+OSMesaTrimContext( OSMesaContext osmesa )
+{
+   GLcontext *ctx = &osmesa->mesa;
+
+   _mesa_marshal_finish( ctx );
+
+   _swrast_TrimContext( ctx );
+   _swsetup_TrimContext( ctx );
+   _tnl_TrimContext( ctx );
+   _ac_TrimContext( ctx );
+
+   if (osmesa->tiler) {
+      GLint i;
+      for (i = 1; i < osmesa->tiler->numTiles; i++)
+         OSMesaTrimContext(osmesa->tiler->tiles[i]);
+   }
+}
+
+
+GLAPI GLuint GLAPIENTRY
+OSMesaGetContextMemory( OSMesaContext osmesa )
+{
+   GLcontext *ctx = &osmesa->mesa;
+   GLuint bytes = sizeof(struct osmesa_context);
+
+   _mesa_marshal_finish( ctx );
+
+   bytes += _swrast_ContextMemory( ctx );
+   bytes += _swsetup_ContextMemory( ctx );
+   bytes += _tnl_ContextMemory( ctx );
+   bytes += _ac_ContextMemory( ctx );
+   bytes += framebuffer_memory( osmesa->gl_buffer );
+
+   if (osmesa->tiler) {
+      const struct osmesa_tiler *tiler = osmesa->tiler;
+      GLint i;
+      bytes += sizeof(struct osmesa_tiler);
+      for (i = 1; i < tiler->numTiles; i++)
+         bytes += OSMesaGetContextMemory(tiler->tiles[i]);
+      for (i = 0; i < tiler->numBuffers; i++)
+         bytes += framebuffer_memory(tiler->buffers[i]);
+   }
+
+   return bytes;
+}
+
+
 struct name_function
 {
    const char *Name;
@@ -1319,6 +2157,8 @@ static struct name_function functions[] = {
    { "OSMesaGetDepthBuffer", (OSMESAproc) OSMesaGetDepthBuffer },
    { "OSMesaGetColorBuffer", (OSMESAproc) OSMesaGetColorBuffer },
    { "OSMesaGetProcAddress", (OSMESAproc) OSMesaGetProcAddress },
+   { "OSMesaTrimContext", (OSMESAproc) OSMesaTrimContext },
+   { "OSMesaGetContextMemory", (OSMESAproc) OSMesaGetContextMemory },
    { NULL, NULL }
 };
 
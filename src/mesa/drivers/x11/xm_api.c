@@ -63,6 +63,8 @@
 #include "glxheader.h"
 #include "GL/xmesa.h"
 #include "xmesaP.h"
+#include "api_marshal.h"
+#include "api_trace.h"
 #include "context.h"
 #include "extensions.h"
 #include "framebuffer.h"
@@ -353,6 +355,14 @@ alloc_xmesa_buffer(XMesaVisual vis, BufferType type, XMesaColormap cmap)
       if (vis->mesa_visual.doubleBufferMode) {
          if (vis->ximage_flag) {
             b->db_state = BACK_XIMAGE;
+            /* Push only the regions drawn since the last swap.  Opt-in,
+             * since an app that swaps again after an Expose without
+             * redrawing relies on the whole back buffer being copied.
+             */
+            if (_mesa_getenv("MESA_SWAP_DAMAGE")) {
+               b->mesa_buffer.DamageEnabled = GL_TRUE;
+               b->mesa_buffer.DamageAll = GL_TRUE;
+            }
          }
          else {
             b->db_state = BACK_PIXMAP;
@@ -622,6 +632,14 @@ xmesa_alloc_back_buffer( XMesaBuffer b, GLuint width, GLuint height )
       return;
 
    if (b->db_state == BACK_XIMAGE) {
+#ifdef XMESA_PRESENT_THREAD
+      if (b->presenter) {
+         if (xmesa_present_resize(b, width, height))
+            return;
+         /* fall back to a single image presented on this thread */
+         xmesa_present_destroy(b);
+      }
+#endif
       /* Deallocate the old backxrb->ximage, if any */
       if (b->backxrb->ximage) {
 #if defined(USE_XSHM) && !defined(XFree86Server)
@@ -672,6 +690,8 @@ xmesa_alloc_back_buffer( XMesaBuffer b, GLuint width, GLuint height )
          }
       }
       b->backxrb->pixmap = None;
+      /* the window changed size: the next swap must cover all of it */
+      b->mesa_buffer.DamageAll = GL_TRUE;
    }
    else if (b->db_state==BACK_PIXMAP) {
       if (!width)
@@ -1312,6 +1332,11 @@ static GLboolean initialize_visual_and_buffer( int client,
          /* Double buffered */
 #ifndef XFree86Server
          b->shm = check_for_xshm( v->display );
+#endif
+#ifdef XMESA_PRESENT_THREAD
+         if (b->shm && b->db_state == BACK_XIMAGE &&
+             _mesa_getenv("MESA_SWAP_THREAD"))
+            xmesa_present_init(b);
 #endif
          xmesa_alloc_back_buffer(b, b->mesa_buffer.Width, b->mesa_buffer.Height);
       }
@@ -1746,6 +1771,14 @@ XMesaContext XMesaCreateContext( XMesaVisual v, XMesaContext share_list )
    xmesa_register_swrast_functions( mesaCtx );
    _swsetup_Wakeup(mesaCtx);
 
+   /* Record the context's commands if MESA_TRACE is set.  Otherwise
+    * maybe execute them on a worker thread.  It draws with the
+    * application's display connection, so the application must have
+    * called XInitThreads().
+    */
+   if (!_mesa_trace_init(mesaCtx) && _mesa_getenv("MESA_GLTHREAD"))
+      _mesa_marshal_init(mesaCtx);
+
    return c;
 }
 
@@ -1760,6 +1793,7 @@ void XMesaDestroyContext( XMesaContext c )
    if (xmbuf && xmbuf->FXctx)
       fxMesaDestroyContext(xmbuf->FXctx);
 #endif
+   _mesa_marshal_destroy( mesaCtx );
    _swsetup_DestroyContext( mesaCtx );
    _swrast_DestroyContext( mesaCtx );
    _tnl_DestroyContext( mesaCtx );
@@ -2005,6 +2039,10 @@ XMesaCreatePBuffer(XMesaVisual v, XMesaColormap cmap,
 void XMesaDestroyBuffer( XMesaBuffer b )
 {
    int client = 0;
+   GET_CURRENT_CONTEXT(ctx);
+
+   /* the current context may still be drawing into it */
+   _mesa_marshal_finish(ctx);
 
 #ifdef XFree86Server
    if (b->frontxrb->drawable)
@@ -2017,6 +2055,10 @@ void XMesaDestroyBuffer( XMesaBuffer b )
 
    if (b->xm_visual->mesa_visual.doubleBufferMode)
    {
+#ifdef XMESA_PRESENT_THREAD
+      if (b->presenter)
+         xmesa_present_destroy(b);
+#endif
       if (b->backxrb->ximage) {
 #if defined(USE_XSHM) && !defined(XFree86Server)
          if (b->shm) {
@@ -2091,6 +2133,11 @@ GLboolean XMesaMakeCurrent2( XMesaContext c, XMesaBuffer drawBuffer,
                          &drawBuffer->mesa_buffer,
                          &readBuffer->mesa_buffer);
 
+#ifdef XMESA_PRESENT_THREAD
+      /* the context may draw to or read from the front buffer already */
+      xmesa_present_wait(&c->mesa, GL_TRUE);
+#endif
+
       if (c->xm_visual->mesa_visual.rgbMode) {
          /*
           * Must recompute and set these pixel values because colormap
@@ -2326,10 +2373,37 @@ static void FXgetImage( XMesaBuffer b )
       }
    }
    /* grLfbWriteColorFormat(GR_COLORFORMAT_ABGR); */
+   b->mesa_buffer.DamageAll = GL_TRUE;
 }
 #endif
 
 
+/**
+ * Copy a region of the XImage back buffer to the window.  The region is
+ * in GL window coordinates, with exclusive upper bounds.
+ */
+static void
+put_back_region( XMesaBuffer b, int x0, int y0, int x1, int y1 )
+{
+   const int yTop = b->mesa_buffer.Height - y1;
+#if defined(USE_XSHM) && !defined(XFree86Server)
+   if (b->shm) {
+      XShmPutImage( b->xm_visual->display, b->frontxrb->drawable,
+                    b->swapgc,
+                    b->backxrb->ximage, x0, yTop,
+                    x0, yTop, x1 - x0, y1 - y0, False );
+   }
+   else
+#endif
+   {
+      XMesaPutImage( b->xm_visual->display, b->frontxrb->drawable,
+                     b->swapgc,
+                     b->backxrb->ximage, x0, yTop,
+                     x0, yTop, x1 - x0, y1 - y0 );
+   }
+}
+
+
 /*
  * Copy the back buffer to the front buffer.  If there's no back buffer
  * this is a no-op.
@@ -2338,6 +2412,9 @@ void XMesaSwapBuffers( XMesaBuffer b )
 {
    GET_CURRENT_CONTEXT(ctx);
 
+   /* the frame must be complete, if it's drawn on a worker thread */
+   _mesa_marshal_finish(ctx);
+
    /* If we're swapping the buffer associated with the current context
     * we have to flush any pending rendering commands first.
     */
@@ -2356,27 +2433,33 @@ void XMesaSwapBuffers( XMesaBuffer b )
       }
 #endif
      if (b->backxrb->ximage) {
-	 /* Copy Ximage from host's memory to server's window */
-#if defined(USE_XSHM) && !defined(XFree86Server)
-	 if (b->shm) {
-            /*_glthread_LOCK_MUTEX(_xmesa_lock);*/
-	    XShmPutImage( b->xm_visual->display, b->frontxrb->drawable,
-			  b->swapgc,
-			  b->backxrb->ximage, 0, 0,
-			  0, 0, b->mesa_buffer.Width, b->mesa_buffer.Height,
-                          False );
-            /*_glthread_UNLOCK_MUTEX(_xmesa_lock);*/
-	 }
-	 else
+#ifdef XMESA_PRESENT_THREAD
+         if (b->presenter) {
+            /* the thread copies it, without stalling the caller */
+            xmesa_present_swap(b);
+            _swrast_reset_damage(&b->mesa_buffer);
+            /* front buffer drawing and reading must see this frame */
+            if (ctx && (ctx->DrawBuffer == &b->mesa_buffer ||
+                        ctx->ReadBuffer == &b->mesa_buffer))
+               xmesa_present_wait(ctx, GL_TRUE);
+            return;
+         }
 #endif
-         {
-            /*_glthread_LOCK_MUTEX(_xmesa_lock);*/
-            XMesaPutImage( b->xm_visual->display, b->frontxrb->drawable,
-			   b->swapgc,
-			   b->backxrb->ximage, 0, 0,
-			   0, 0, b->mesa_buffer.Width, b->mesa_buffer.Height );
-            /*_glthread_UNLOCK_MUTEX(_xmesa_lock);*/
+	 /* Copy Ximage from host's memory to server's window; with damage
+	  * tracking, only the regions drawn since the last swap.
+	  */
+         if (b->mesa_buffer.DamageEnabled && !b->mesa_buffer.DamageAll) {
+            GLuint i;
+            for (i = 0; i < b->mesa_buffer.NumDamageRects; i++) {
+               const GLint *r = b->mesa_buffer.DamageRects[i];
+               put_back_region(b, r[0], r[1], r[2], r[3]);
+            }
          }
+         else {
+            put_back_region(b, 0, 0,
+                            b->mesa_buffer.Width, b->mesa_buffer.Height);
+         }
+         _swrast_reset_damage(&b->mesa_buffer);
       }
       else {
 	 /* Copy pixmap to window on server */
@@ -2405,6 +2488,9 @@ void XMesaCopySubBuffer( XMesaBuffer b, int x, int y, int width, int height )
 {
    GET_CURRENT_CONTEXT(ctx);
 
+   /* the frame must be complete, if it's drawn on a worker thread */
+   _mesa_marshal_finish(ctx);
+
    /* If we're swapping the buffer associated with the current context
     * we have to flush any pending rendering commands first.
     */
@@ -2423,24 +2509,30 @@ void XMesaCopySubBuffer( XMesaBuffer b, int x, int y, int width, int height )
       }
 #endif
       if (b->backxrb->ximage) {
-         /* Copy Ximage from host's memory to server's window */
-#if defined(USE_XSHM) && !defined(XFree86Server)
-         if (b->shm) {
-            /* XXX assuming width and height aren't too large! */
-            XShmPutImage( b->xm_visual->display, b->frontxrb->drawable,
-                          b->swapgc,
-                          b->backxrb->ximage, x, yTop,
-                          x, yTop, width, height, False );
-            /* wait for finished event??? */
+         /* Copy Ximage from host's memory to server's window; with damage
+          * tracking, only the parts of the region drawn since the last
+          * swap can differ from the window.
+          */
+         /* XXX assuming width and height aren't too large! */
+#ifdef XMESA_PRESENT_THREAD
+         if (b->presenter) {
+            /* don't let an older frame land on top of this one */
+            xmesa_present_finish(b);
          }
-         else
 #endif
-         {
-            /* XXX assuming width and height aren't too large! */
-            XMesaPutImage( b->xm_visual->display, b->frontxrb->drawable,
-			   b->swapgc,
-			   b->backxrb->ximage, x, yTop,
-			   x, yTop, width, height );
+         if (b->mesa_buffer.DamageEnabled && !b->mesa_buffer.DamageAll) {
+            GLuint i;
+            for (i = 0; i < b->mesa_buffer.NumDamageRects; i++) {
+               const GLint *r = b->mesa_buffer.DamageRects[i];
+               const int x0 = MAX2(x, r[0]), y0 = MAX2(y, r[1]);
+               const int x1 = MIN2(x + width, r[2]);
+               const int y1 = MIN2(y + height, r[3]);
+               if (x0 < x1 && y0 < y1)
+                  put_back_region(b, x0, y0, x1, y1);
+            }
+         }
+         else {
+            put_back_region(b, x, y, x + width, y + height);
          }
       }
       else {
@@ -2471,9 +2563,14 @@ GLboolean XMesaGetBackBuffer( XMesaBuffer b,
                               XMesaPixmap *pixmap,
                               XMesaImage **ximage )
 {
+   GET_CURRENT_CONTEXT(ctx);
+   _mesa_marshal_finish(ctx);
+
    if (b->db_state) {
       if (pixmap)  *pixmap = b->backxrb->pixmap;
       if (ximage)  *ximage = b->backxrb->ximage;
+      /* the caller may draw into the back buffer behind our back */
+      b->mesa_buffer.DamageEnabled = GL_FALSE;
       return GL_TRUE;
    }
    else {
@@ -2496,8 +2593,12 @@ GLboolean XMesaGetBackBuffer( XMesaBuffer b,
 GLboolean XMesaGetDepthBuffer( XMesaBuffer b, GLint *width, GLint *height,
                                GLint *bytesPerValue, void **buffer )
 {
-   struct gl_renderbuffer *rb
-      = b->mesa_buffer.Attachment[BUFFER_DEPTH].Renderbuffer;
+   struct gl_renderbuffer *rb;
+   GET_CURRENT_CONTEXT(ctx);
+
+   _mesa_marshal_finish(ctx);
+
+   rb = b->mesa_buffer.Attachment[BUFFER_DEPTH].Renderbuffer;
    if (!rb || !rb->Data) {
       *width = 0;
       *height = 0;
@@ -2519,9 +2620,15 @@ GLboolean XMesaGetDepthBuffer( XMesaBuffer b, GLint *width, GLint *height,
 void XMesaFlush( XMesaContext c )
 {
    if (c && c->xm_visual) {
+      _mesa_marshal_finish(&c->mesa);
 #ifdef XFree86Server
       /* NOT_NEEDED */
 #else
+#ifdef XMESA_PRESENT_THREAD
+      /* frames swapped so far must be in the window, too */
+      if (c->xm_buffer && c->xm_buffer->presenter)
+         xmesa_present_finish(c->xm_buffer);
+#endif
       XSync( c->xm_visual->display, False );
 #endif
    }
@@ -2660,6 +2767,8 @@ void XMesaResizeBuffers( XMesaBuffer b )
    GLuint winwidth, winheight;
    GET_CURRENT_CONTEXT(ctx);
 
+   _mesa_marshal_finish(ctx);
+
    winwidth = MIN2(b->frontxrb->drawable->width, MAX_WIDTH);
    winheight = MIN2(b->frontxrb->drawable->height, MAX_HEIGHT);
 
@@ -2669,6 +2778,9 @@ void XMesaResizeBuffers( XMesaBuffer b )
    int xpos, ypos;
    unsigned int width, height, bw, depth;
    GET_CURRENT_CONTEXT(ctx);
+
+   _mesa_marshal_finish(ctx);
+
    XGetGeometry( b->xm_visual->display, b->frontxrb->pixmap,
                  &root, &xpos, &ypos, &width, &height, &bw, &depth);
    xmesa_resize_buffers(ctx, &(b->mesa_buffer), width, height);
@@ -140,6 +140,43 @@ finish_or_flush( GLcontext *ctx )
 }
 
 
+static void
+finish( GLcontext *ctx )
+{
+#ifdef XMESA_PRESENT_THREAD
+   /* frames swapped so far must be in the window, too */
+   xmesa_present_wait(ctx, GL_FALSE);
+#endif
+   finish_or_flush(ctx);
+}
+
+
+/*
+ * Called by glDrawBuffer.
+ */
+static void
+draw_buffer( GLcontext *ctx, GLenum buffer )
+{
+   _swrast_DrawBuffer(ctx, buffer);
+#ifdef XMESA_PRESENT_THREAD
+   xmesa_present_wait(ctx, GL_TRUE);
+#endif
+}
+
+
+/*
+ * Called by glReadBuffer.
+ */
+static void
+read_buffer( GLcontext *ctx, GLenum buffer )
+{
+   (void) buffer;
+#ifdef XMESA_PRESENT_THREAD
+   xmesa_present_wait(ctx, GL_TRUE);
+#endif
+}
+
+
 static void
 clear_index( GLcontext *ctx, GLuint index )
 {
@@ -537,6 +574,8 @@ clear_buffers( GLcontext *ctx, GLbitfield mask,
                /* renderbuffer is not wrapped - great! */
                b->backxrb->clearFunc(ctx, b->backxrb, all, x, y,
                                      width, height);
+               _swrast_add_damage(ctx->DrawBuffer, x, y,
+                                  x + width, y + height);
                mask &= ~BUFFER_BIT_BACK_LEFT;
             }
          }
@@ -1137,7 +1176,9 @@ xmesa_init_driver_functions( XMesaVisual xmvisual,
    driver->UpdateState = xmesa_update_state;
    driver->GetBufferSize = get_buffer_size;
    driver->Flush = finish_or_flush;
-   driver->Finish = finish_or_flush;
+   driver->Finish = finish;
+   driver->DrawBuffer = draw_buffer;
+   driver->ReadBuffer = read_buffer;
    driver->ClearIndex = clear_index;
    driver->ClearColor = clear_color;
    driver->IndexMask = index_mask;
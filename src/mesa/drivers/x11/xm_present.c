@@ -0,0 +1,415 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4.2
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * \file xm_present.c
+ * Presentation of XImage back buffers on a helper thread.
+ *
+ * XMesaSwapBuffers normally does an XShmPutImage and an XSync on the
+ * application's thread, so rendering stalls until the server has read
+ * the whole frame.  With MESA_SWAP_THREAD set, a double-buffered window
+ * gets XMESA_PRESENT_IMAGES shared-memory images instead of one.  A swap
+ * queues the image just rendered for a helper thread, which owns a
+ * second display connection, and rendering continues at once in an
+ * image that is neither queued nor being read by the server.
+ *
+ * The new image gets a copy of the frame just swapped, so the back buffer
+ * keeps its contents across swaps as with a single image, and a frame's
+ * damage rectangles (MESA_SWAP_DAMAGE) go along with it to the thread.
+ */
+
+
+#include "glxheader.h"
+#include "GL/xmesa.h"
+#include "xmesaP.h"
+#include "imports.h"
+
+
+#ifdef XMESA_PRESENT_THREAD
+
+
+#include <X11/Xlibint.h>	/* for XESetError() */
+
+
+/**
+ * Error handler for the thread's connection.  The application may destroy
+ * the window while a frame for it is still queued, and the BadDrawable
+ * that follows would otherwise reach the default handler, which exits.
+ * The connection doesn't refer to any other drawable, so the error only
+ * means the window is gone; the buffer is destroyed later on.
+ */
+static int
+present_error( Display *dpy, xError *err, XExtCodes *codes, int *ret )
+{
+   (void) dpy;
+   (void) codes;
+   if (err->errorCode == BadDrawable) {
+      *ret = 0;
+      return True;
+   }
+   return False;  /* not ours, pass it on */
+}
+
+
+/**
+ * Point the back renderbuffer at one of the presenter's images.
+ */
+static void
+set_back_image( XMesaBuffer b, XMesaImage *img )
+{
+   b->backxrb->ximage = img;
+   /* this call just updates the width/origin fields in the xrb */
+   b->backxrb->Base.AllocStorage(NULL, &b->backxrb->Base,
+                                 b->backxrb->Base.InternalFormat,
+                                 img->width, img->height);
+}
+
+
+/**
+ * Detach and free the shared images.  The thread must be idle.
+ */
+static void
+free_images( XMesaBuffer b )
+{
+   struct xmesa_presenter *p = b->presenter;
+   int i;
+
+   for (i = 0; i < XMESA_PRESENT_IMAGES; i++) {
+      if (p->images[i]) {
+         if (b->backxrb->ximage == p->images[i])
+            b->backxrb->ximage = NULL;
+         XShmDetach( p->display, &p->shminfo[i] );
+         XDestroyImage( p->images[i] );
+         shmdt( p->shminfo[i].shmaddr );
+         p->images[i] = NULL;
+      }
+   }
+   XSync( p->display, False );
+}
+
+
+/**
+ * Allocate the shared images and attach them on the thread's connection.
+ * The thread must be idle.
+ */
+static GLboolean
+alloc_images( XMesaBuffer b, GLuint width, GLuint height )
+{
+   struct xmesa_presenter *p = b->presenter;
+   XMesaVisual v = b->xm_visual;
+   int i;
+
+   for (i = 0; i < XMESA_PRESENT_IMAGES; i++) {
+      XShmSegmentInfo *shminfo = &p->shminfo[i];
+      XMesaImage *img = XShmCreateImage( p->display, v->visinfo->visual,
+                                         v->visinfo->depth, ZPixmap, NULL,
+                                         shminfo, width, height );
+      if (!img)
+         break;
+
+      shminfo->shmid = shmget( IPC_PRIVATE, img->bytes_per_line * img->height,
+                               IPC_CREAT|0777 );
+      if (shminfo->shmid < 0) {
+         XDestroyImage( img );
+         break;
+      }
+      shminfo->shmaddr = img->data = (char *) shmat( shminfo->shmid, 0, 0 );
+      if (shminfo->shmaddr == (char *) -1) {
+         XDestroyImage( img );
+         shmctl( shminfo->shmid, IPC_RMID, 0 );
+         break;
+      }
+      shminfo->readOnly = False;
+      XShmAttach( p->display, shminfo );
+      p->images[i] = img;
+   }
+
+   /* once the server has attached them, nobody else needs the ids */
+   XSync( p->display, False );
+   for (i = 0; i < XMESA_PRESENT_IMAGES && p->images[i]; i++)
+      shmctl( p->shminfo[i].shmid, IPC_RMID, 0 );
+
+   if (i < XMESA_PRESENT_IMAGES) {
+      _mesa_warning(NULL, "MESA_SWAP_THREAD: can't allocate shared images\n");
+      free_images(b);
+      return GL_FALSE;
+   }
+   return GL_TRUE;
+}
+
+
+/**
+ * The presentation thread: copy each queued image to the window.
+ */
+static void *
+present_thread_main( void *arg )
+{
+   struct xmesa_presenter *p = (struct xmesa_presenter *) arg;
+
+   _glthread_LOCK_MUTEX(p->mutex);
+   for (;;) {
+      GLint rects[MAX_DAMAGE_RECTS][4];
+      GLuint numRects, i;
+      XMesaImage *img;
+
+      while (p->pending < 0 && !p->quit)
+         _glthread_WAIT_COND(p->cond, p->mutex);
+      if (p->pending < 0)
+         break;  /* quitting, and the last frame is out */
+
+      p->busy = p->pending;
+      p->pending = -1;
+      img = p->images[p->busy];
+      if (p->pendingAll) {
+         rects[0][0] = rects[0][1] = 0;
+         rects[0][2] = img->width;
+         rects[0][3] = img->height;
+         numRects = 1;
+      }
+      else {
+         numRects = p->numPendingRects;
+         MEMCPY(rects, p->pendingRects, numRects * sizeof(rects[0]));
+      }
+      _glthread_BROADCAST_COND(p->cond);
+      _glthread_UNLOCK_MUTEX(p->mutex);
+
+      for (i = 0; i < numRects; i++) {
+         const GLint *r = rects[i];
+         const int yTop = img->height - r[3];
+         XShmPutImage( p->display, p->window, p->gc, img,
+                       r[0], yTop, r[0], yTop,
+                       r[2] - r[0], r[3] - r[1], False );
+      }
+      /* the server is done reading the image once the round trip ends */
+      XSync( p->display, False );
+
+      _glthread_LOCK_MUTEX(p->mutex);
+      p->busy = -1;
+      _glthread_BROADCAST_COND(p->cond);
+   }
+   _glthread_UNLOCK_MUTEX(p->mutex);
+
+   return NULL;
+}
+
+
+/**
+ * Start presenting the window buffer's frames on a helper thread.  The
+ * images are allocated by xmesa_present_resize() once the size is known.
+ * Return:  GL_TRUE if success, GL_FALSE if the buffer should present
+ *          on the calling thread as usual.
+ */
+GLboolean
+xmesa_present_init( XMesaBuffer b )
+{
+   struct xmesa_presenter *p;
+   XExtCodes *codes;
+   int major, minor;
+   Bool pixmaps;
+
+   assert(b->db_state == BACK_XIMAGE);
+   assert(b->shm);
+
+   p = CALLOC_STRUCT(xmesa_presenter);
+   if (!p)
+      return GL_FALSE;
+
+   /* Xlib isn't necessarily thread-safe: the thread gets a connection
+    * of its own.
+    */
+   p->display = XOpenDisplay( DisplayString(b->xm_visual->display) );
+   if (!p->display || !XShmQueryVersion( p->display, &major, &minor,
+                                         &pixmaps )) {
+      _mesa_warning(NULL, "MESA_SWAP_THREAD: can't open a second "
+                    "connection with XShm\n");
+      if (p->display)
+         XCloseDisplay( p->display );
+      FREE(p);
+      return GL_FALSE;
+   }
+   codes = XAddExtension( p->display );
+   if (codes)
+      XESetError( p->display, codes->extension, present_error );
+
+   p->window = b->frontxrb->drawable;
+   p->gc = XCreateGC( p->display, p->window, 0, NULL );
+   p->render = 0;
+   p->pending = -1;
+   p->busy = -1;
+   p->pendingAll = GL_TRUE;
+   _glthread_INIT_MUTEX(p->mutex);
+   _glthread_INIT_COND(p->cond);
+
+   if (!_glthread_CREATE_THREAD(p->thread, present_thread_main, p)) {
+      _glthread_DESTROY_COND(p->cond);
+      _glthread_DESTROY_MUTEX(p->mutex);
+      XFreeGC( p->display, p->gc );
+      XCloseDisplay( p->display );
+      FREE(p);
+      return GL_FALSE;
+   }
+
+   b->presenter = p;
+   return GL_TRUE;
+}
+
+
+/**
+ * (Re)allocate the images for a new window size and point the back
+ * buffer at the first one.
+ * Return:  GL_FALSE if the images couldn't be allocated; the caller
+ *          should then destroy the presenter.
+ */
+GLboolean
+xmesa_present_resize( XMesaBuffer b, GLuint width, GLuint height )
+{
+   struct xmesa_presenter *p = b->presenter;
+
+   xmesa_present_finish(b);
+   free_images(b);
+   if (!alloc_images(b, width, height))
+      return GL_FALSE;
+
+   p->width = width;
+   p->height = height;
+   p->render = 0;
+   set_back_image(b, p->images[0]);
+   b->mesa_buffer.DamageAll = GL_TRUE;
+   return GL_TRUE;
+}
+
+
+/**
+ * Queue the back buffer's image, with the framebuffer's damage, for
+ * presentation and switch the back buffer to a free image.  Blocks only
+ * if the previous frame hasn't been picked up by the thread yet.
+ */
+void
+xmesa_present_swap( XMesaBuffer b )
+{
+   struct xmesa_presenter *p = b->presenter;
+   const GLframebuffer *fb = &b->mesa_buffer;
+   XMesaImage *prev = p->images[p->render];
+   int i;
+
+   _glthread_LOCK_MUTEX(p->mutex);
+   while (p->pending >= 0)
+      _glthread_WAIT_COND(p->cond, p->mutex);
+   p->pending = p->render;
+   if (fb->DamageEnabled && !fb->DamageAll) {
+      p->pendingAll = GL_FALSE;
+      p->numPendingRects = fb->NumDamageRects;
+      MEMCPY(p->pendingRects, fb->DamageRects,
+             fb->NumDamageRects * sizeof(fb->DamageRects[0]));
+   }
+   else {
+      p->pendingAll = GL_TRUE;
+   }
+   for (i = 0; i < XMESA_PRESENT_IMAGES; i++) {
+      if (i != p->pending && i != p->busy)
+         break;
+   }
+   p->render = i;
+   _glthread_BROADCAST_COND(p->cond);
+   _glthread_UNLOCK_MUTEX(p->mutex);
+
+   /* the thread only reads prev, so it can be copied concurrently */
+   MEMCPY(p->images[i]->data, prev->data,
+          prev->bytes_per_line * prev->height);
+   set_back_image(b, p->images[i]);
+}
+
+
+/**
+ * Wait until every queued frame has reached the window.
+ */
+void
+xmesa_present_finish( XMesaBuffer b )
+{
+   struct xmesa_presenter *p = b->presenter;
+
+   _glthread_LOCK_MUTEX(p->mutex);
+   while (p->pending >= 0 || p->busy >= 0)
+      _glthread_WAIT_COND(p->cond, p->mutex);
+   _glthread_UNLOCK_MUTEX(p->mutex);
+}
+
+
+/**
+ * Wait for the frames queued for ctx's draw and read buffers to reach the
+ * window.  With frontOnly, only for a buffer whose front ctx draws to or
+ * reads from: front reads must see the frames, and front drawing mustn't
+ * be covered by them later on.
+ */
+void
+xmesa_present_wait( GLcontext *ctx, GLboolean frontOnly )
+{
+   const GLbitfield front = BUFFER_BIT_FRONT_LEFT | BUFFER_BIT_FRONT_RIGHT;
+   GLframebuffer *draw = ctx->DrawBuffer, *read = ctx->ReadBuffer;
+
+   if (draw && draw->Name == 0 && XMESA_BUFFER(draw)->presenter) {
+      GLbitfield mask = 0x0;
+      GLuint i;
+      for (i = 0; i < ctx->Const.MaxDrawBuffers; i++)
+         mask |= draw->_ColorDrawBufferMask[i];
+      if (read == draw)
+         mask |= read->_ColorReadBufferMask;
+      if (!frontOnly || (mask & front))
+         xmesa_present_finish(XMESA_BUFFER(draw));
+   }
+   if (read && read != draw && read->Name == 0 &&
+       XMESA_BUFFER(read)->presenter) {
+      if (!frontOnly || (read->_ColorReadBufferMask & front))
+         xmesa_present_finish(XMESA_BUFFER(read));
+   }
+}
+
+
+/**
+ * Present any queued frame, stop the thread and free its resources.
+ * The back buffer is left without an image.
+ */
+void
+xmesa_present_destroy( XMesaBuffer b )
+{
+   struct xmesa_presenter *p = b->presenter;
+
+   _glthread_LOCK_MUTEX(p->mutex);
+   p->quit = GL_TRUE;
+   _glthread_BROADCAST_COND(p->cond);
+   _glthread_UNLOCK_MUTEX(p->mutex);
+   _glthread_JOIN_THREAD(p->thread);
+
+   free_images(b);
+   XFreeGC( p->display, p->gc );
+   XCloseDisplay( p->display );
+   _glthread_DESTROY_COND(p->cond);
+   _glthread_DESTROY_MUTEX(p->mutex);
+   FREE(p);
+   b->presenter = NULL;
+}
+
+
+#endif /* XMESA_PRESENT_THREAD */
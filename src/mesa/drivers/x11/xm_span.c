@@ -37,6 +37,11 @@
 
 #include "swrast/swrast.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define XMESA_USE_SSE2
+#endif
+
 
 /*
  * The following functions are used to trap XGetImage() calls which
@@ -1303,6 +1308,179 @@ static void put_row_rgb_TRUEDITHER_ximage( RGB_SPAN_ARGS )
 }
 
 
+#ifdef XMESA_USE_SSE2
+
+/*
+ * SSE2 row converters for the XImage truecolor formats.  Each one
+ * handles the leading multiple of 4 (32bpp) or 8 (16bpp) pixels of a
+ * row and returns how many it did; the caller finishes the rest with
+ * its scalar loop.  Only built on x86, so pixels are little-endian.
+ */
+
+/*
+ * Convert four RGBA pixels to 32-bit pixels.  The G byte stays in place,
+ * R and B trade places if SWAPRB, and the result is ANDed with KEEP to
+ * drop the alpha byte when the format has none.
+ */
+#define SSE2_PACK_8888(C, SWAPRB, KEEP)					\
+   _mm_and_si128((SWAPRB)						\
+      ? _mm_or_si128(_mm_and_si128(C, _mm_set1_epi32(0xff00ff00)),	\
+           _mm_or_si128(_mm_and_si128(_mm_srli_epi32(C, 16), byte0),	\
+                        _mm_slli_epi32(_mm_and_si128(C, byte0), 16)))	\
+      : (C), KEEP)
+
+/*
+ * Convert four RGBA pixels to 5R6G5B, one per 32-bit lane.
+ */
+#define SSE2_PACK_5R6G5B(C)						\
+   _mm_or_si128(_mm_slli_epi32(_mm_and_si128(C, _mm_set1_epi32(0xf8)), 8),\
+      _mm_or_si128(_mm_and_si128(_mm_srli_epi32(C, 5), _mm_set1_epi32(0x7e0)),\
+                   _mm_and_si128(_mm_srli_epi32(C, 19), _mm_set1_epi32(0x1f))))
+
+
+static INLINE GLuint
+put_row_8888_sse2(GLuint n, const GLubyte rgba[][4], const GLubyte mask[],
+                  GLuint *ptr, GLboolean swapRB, GLuint keepBits)
+{
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i byte0 = _mm_set1_epi32(0xff);
+   const __m128i keep = _mm_set1_epi32((int) keepBits);
+   GLuint i;
+   for (i = 0; i + 4 <= n; i += 4) {
+      const __m128i c = _mm_loadu_si128((const __m128i *) rgba[i]);
+      __m128i p = SSE2_PACK_8888(c, swapRB, keep);
+      if (mask) {
+         /* lanes with a zero mask byte keep the old pixel */
+         const __m128i old = _mm_cmpeq_epi32(zero,
+            _mm_set_epi32(mask[i+3], mask[i+2], mask[i+1], mask[i]));
+         p = _mm_or_si128(_mm_andnot_si128(old, p),
+                _mm_and_si128(old, _mm_loadu_si128((const __m128i *) (ptr + i))));
+      }
+      _mm_storeu_si128((__m128i *) (ptr + i), p);
+   }
+   return i;
+}
+
+
+/*
+ * As above for 5R6G5B.  If DITHER is non-null it holds the four kernel
+ * values for pixels x..x+3 of the row; with unit gamma (the only case
+ * PF_Dither_5R6G5B is chosen for) PACK_TRUEDITHER reduces to a
+ * saturating add of the kernel value to each component.
+ */
+static INLINE GLuint
+put_row_5R6G5B_sse2(GLuint n, const GLubyte rgba[][4], const GLubyte mask[],
+                    GLushort *ptr, const GLubyte *dither)
+{
+   const __m128i zero = _mm_setzero_si128();
+   __m128i d = zero;
+   GLuint i;
+   if (dither) {
+      GLuint j, k[4];
+      for (j = 0; j < 4; j++)
+         k[j] = dither[j] * 0x010101;
+      d = _mm_set_epi32(k[3], k[2], k[1], k[0]);
+   }
+   for (i = 0; i + 8 <= n; i += 8) {
+      __m128i c0 = _mm_loadu_si128((const __m128i *) rgba[i]);
+      __m128i c1 = _mm_loadu_si128((const __m128i *) rgba[i+4]);
+      __m128i p0, p1, p;
+      c0 = _mm_adds_epu8(c0, d);
+      c1 = _mm_adds_epu8(c1, d);
+      /* sign-extend the 16-bit pixels so packs_epi32 doesn't saturate */
+      p0 = _mm_srai_epi32(_mm_slli_epi32(SSE2_PACK_5R6G5B(c0), 16), 16);
+      p1 = _mm_srai_epi32(_mm_slli_epi32(SSE2_PACK_5R6G5B(c1), 16), 16);
+      p = _mm_packs_epi32(p0, p1);
+      if (mask) {
+         const __m128i old = _mm_cmpeq_epi16(zero,
+            _mm_set_epi16(mask[i+7], mask[i+6], mask[i+5], mask[i+4],
+                          mask[i+3], mask[i+2], mask[i+1], mask[i]));
+         p = _mm_or_si128(_mm_andnot_si128(old, p),
+                _mm_and_si128(old, _mm_loadu_si128((const __m128i *) (ptr + i))));
+      }
+      _mm_storeu_si128((__m128i *) (ptr + i), p);
+   }
+   return i;
+}
+
+
+/*
+ * Fill a row of 32-bit pixels with PIXEL where MASK is set.
+ */
+static INLINE GLuint
+put_mono_row_32_sse2(GLuint n, const GLubyte mask[], GLuint *ptr, GLuint pixel)
+{
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i p = _mm_set1_epi32((int) pixel);
+   GLuint i;
+   for (i = 0; i + 4 <= n; i += 4) {
+      if (mask) {
+         const __m128i old = _mm_cmpeq_epi32(zero,
+            _mm_set_epi32(mask[i+3], mask[i+2], mask[i+1], mask[i]));
+         _mm_storeu_si128((__m128i *) (ptr + i),
+            _mm_or_si128(_mm_andnot_si128(old, p),
+               _mm_and_si128(old, _mm_loadu_si128((const __m128i *) (ptr + i)))));
+      }
+      else {
+         _mm_storeu_si128((__m128i *) (ptr + i), p);
+      }
+   }
+   return i;
+}
+
+
+/*
+ * Fill a row of 16-bit pixels where MASK is set, repeating the eight
+ * pixels in PATTERN (one value for a plain color, the dithered values
+ * of pixels x..x+7 for a dithered one).
+ */
+static INLINE GLuint
+put_mono_row_16_sse2(GLuint n, const GLubyte mask[], GLushort *ptr,
+                     const GLushort pattern[8])
+{
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i p = _mm_loadu_si128((const __m128i *) pattern);
+   GLuint i;
+   for (i = 0; i + 8 <= n; i += 8) {
+      if (mask) {
+         const __m128i old = _mm_cmpeq_epi16(zero,
+            _mm_set_epi16(mask[i+7], mask[i+6], mask[i+5], mask[i+4],
+                          mask[i+3], mask[i+2], mask[i+1], mask[i]));
+         _mm_storeu_si128((__m128i *) (ptr + i),
+            _mm_or_si128(_mm_andnot_si128(old, p),
+               _mm_and_si128(old, _mm_loadu_si128((const __m128i *) (ptr + i)))));
+      }
+      else {
+         _mm_storeu_si128((__m128i *) (ptr + i), p);
+      }
+   }
+   return i;
+}
+
+
+/*
+ * Convert four 32-bit pixels back to RGBA; the inverse of SSE2_PACK_8888.
+ * SETBITS is ORed in to supply alpha for formats without it.
+ */
+static INLINE GLuint
+get_row_8888_sse2(GLuint n, const GLuint *ptr, GLubyte rgba[][4],
+                  GLboolean swapRB, GLuint setBits)
+{
+   const __m128i byte0 = _mm_set1_epi32(0xff);
+   const __m128i keep = _mm_set1_epi32(~0);
+   const __m128i set = _mm_set1_epi32((int) setBits);
+   GLuint i;
+   for (i = 0; i + 4 <= n; i += 4) {
+      const __m128i p = _mm_loadu_si128((const __m128i *) (ptr + i));
+      _mm_storeu_si128((__m128i *) rgba[i],
+                       _mm_or_si128(SSE2_PACK_8888(p, swapRB, keep), set));
+   }
+   return i;
+}
+
+#endif /* XMESA_USE_SSE2 */
+
+
 /*
  * Write a span of PF_8A8B8G8R-format pixels to an ximage.
  */
@@ -1310,10 +1488,13 @@ static void put_row_8A8B8G8R_ximage( PUT_ROW_ARGS )
 {
    const GLubyte (*rgba)[4] = (const GLubyte (*)[4]) values;
    struct xmesa_renderbuffer *xrb = (struct xmesa_renderbuffer *) rb;
-   register GLuint i;
+   register GLuint i = 0;
    register GLuint *ptr = PIXEL_ADDR4(xrb, x, y);
+#ifdef XMESA_USE_SSE2
+   i = put_row_8888_sse2(n, rgba, mask, ptr, GL_FALSE, 0xffffffff);
+#endif
    if (mask) {
-      for (i=0;i<n;i++) {
+      for (;i<n;i++) {
          if (mask[i]) {
             ptr[i] = PACK_8A8B8G8R( rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP], rgba[i][ACOMP] );
          }
@@ -1321,7 +1502,7 @@ static void put_row_8A8B8G8R_ximage( PUT_ROW_ARGS )
    }
    else {
       /* draw all pixels */
-      for (i=0;i<n;i++) {
+      for (;i<n;i++) {
          ptr[i] = PACK_8A8B8G8R( rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP], rgba[i][ACOMP] );
       }
    }
@@ -1359,10 +1540,13 @@ static void put_row_8A8R8G8B_ximage( PUT_ROW_ARGS )
 {
    const GLubyte (*rgba)[4] = (const GLubyte (*)[4]) values;
    struct xmesa_renderbuffer *xrb = (struct xmesa_renderbuffer *) rb;
-   register GLuint i;
+   register GLuint i = 0;
    register GLuint *ptr = PIXEL_ADDR4(xrb, x, y);
+#ifdef XMESA_USE_SSE2
+   i = put_row_8888_sse2(n, rgba, mask, ptr, GL_TRUE, 0xffffffff);
+#endif
    if (mask) {
-      for (i=0;i<n;i++) {
+      for (;i<n;i++) {
          if (mask[i]) {
             ptr[i] = PACK_8A8R8G8B( rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP], rgba[i][ACOMP] );
          }
@@ -1370,7 +1554,7 @@ static void put_row_8A8R8G8B_ximage( PUT_ROW_ARGS )
    }
    else {
       /* draw all pixels */
-      for (i=0;i<n;i++) {
+      for (;i<n;i++) {
          ptr[i] = PACK_8A8R8G8B( rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP], rgba[i][ACOMP] );
       }
    }
@@ -1409,17 +1593,20 @@ static void put_row_8R8G8B_ximage( PUT_ROW_ARGS )
 {
    const GLubyte (*rgba)[4] = (const GLubyte (*)[4]) values;
    struct xmesa_renderbuffer *xrb = (struct xmesa_renderbuffer *) rb;
-   register GLuint i;
+   register GLuint i = 0;
    register GLuint *ptr = PIXEL_ADDR4(xrb, x, y);
+#ifdef XMESA_USE_SSE2
+   i = put_row_8888_sse2(n, rgba, mask, ptr, GL_TRUE, 0x00ffffff);
+#endif
    if (mask) {
-      for (i=0;i<n;i++) {
+      for (;i<n;i++) {
          if (mask[i]) {
             ptr[i] = PACK_8R8G8B(rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP]);
          }
       }
    }
    else {
-      for (i=0;i<n;i++) {
+      for (;i<n;i++) {
          ptr[i] = PACK_8R8G8B(rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP]);
       }
    }
@@ -1641,10 +1828,13 @@ static void put_row_5R6G5B_ximage( PUT_ROW_ARGS )
 {
    const GLubyte (*rgba)[4] = (const GLubyte (*)[4]) values;
    struct xmesa_renderbuffer *xrb = (struct xmesa_renderbuffer *) rb;
-   register GLuint i;
+   register GLuint i = 0;
    register GLushort *ptr = PIXEL_ADDR2(xrb, x, y);
+#ifdef XMESA_USE_SSE2
+   i = put_row_5R6G5B_sse2(n, rgba, mask, ptr, NULL);
+#endif
    if (mask) {
-      for (i=0;i<n;i++) {
+      for (;i<n;i++) {
          if (mask[i]) {
             ptr[i] = PACK_5R6G5B( rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP] );
          }
@@ -1652,7 +1842,7 @@ static void put_row_5R6G5B_ximage( PUT_ROW_ARGS )
    }
    else {
       /* draw all pixels */
-#if defined(__i386__) /* word stores don't have to be on 4-byte boundaries */
+#if defined(__i386__) && !defined(XMESA_USE_SSE2) /* word stores don't have to be on 4-byte boundaries */
       GLuint *ptr32 = (GLuint *) ptr;
       GLuint extraPixel = (n & 1);
       n -= extraPixel;
@@ -1666,7 +1856,7 @@ static void put_row_5R6G5B_ximage( PUT_ROW_ARGS )
          ptr[n] = PACK_5R6G5B(rgba[n][RCOMP], rgba[n][GCOMP], rgba[n][BCOMP]);
       }
 #else
-      for (i = 0; i < n; i++) {
+      for (; i < n; i++) {
          ptr[i] = PACK_5R6G5B(rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP]);
       }
 #endif
@@ -1682,11 +1872,21 @@ static void put_row_DITHER_5R6G5B_ximage( PUT_ROW_ARGS )
    const GLubyte (*rgba)[4] = (const GLubyte (*)[4]) values;
    struct xmesa_renderbuffer *xrb = (struct xmesa_renderbuffer *) rb;
    const XMesaContext xmesa = XMESA_CONTEXT(ctx);
-   register GLuint i;
+   register GLuint i = 0;
    register GLushort *ptr = PIXEL_ADDR2(xrb, x, y);
    const GLint y2 = YFLIP(xrb, y);
+#ifdef XMESA_USE_SSE2
+   {
+      GLubyte kernel[4];
+      GLuint j;
+      for (j = 0; j < 4; j++)
+         kernel[j] = xmesa->xm_visual->Kernel[((x + j) & 3) | ((y2 & 3) << 2)];
+      i = put_row_5R6G5B_sse2(n, rgba, mask, ptr, kernel);
+      x += i;
+   }
+#endif
    if (mask) {
-      for (i=0;i<n;i++,x++) {
+      for (;i<n;i++,x++) {
          if (mask[i]) {
             PACK_TRUEDITHER( ptr[i], x, y2, rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP] );
          }
@@ -1694,7 +1894,7 @@ static void put_row_DITHER_5R6G5B_ximage( PUT_ROW_ARGS )
    }
    else {
       /* draw all pixels */
-#if defined(__i386__) /* word stores don't have to be on 4-byte boundaries */
+#if defined(__i386__) && !defined(XMESA_USE_SSE2) /* word stores don't have to be on 4-byte boundaries */
       GLuint *ptr32 = (GLuint *) ptr;
       GLuint extraPixel = (n & 1);
       n -= extraPixel;
@@ -1708,7 +1908,7 @@ static void put_row_DITHER_5R6G5B_ximage( PUT_ROW_ARGS )
          PACK_TRUEDITHER( ptr[n], x+n, y2, rgba[n][RCOMP], rgba[n][GCOMP], rgba[n][BCOMP]);
       }
 #else
-      for (i = 0; i < n; i++, x++) {
+      for (; i < n; i++, x++) {
          PACK_TRUEDITHER( ptr[i], x, y2, rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP]);
       }
 #endif
@@ -2651,7 +2851,7 @@ static void put_values_DITHER_5R6G5B_ximage( PUT_VALUES_ARGS )
    for (i=0;i<n;i++) {
       if (mask[i]) {
 	 GLushort *ptr = PIXEL_ADDR2(xrb, x[i], y[i] );
-         PACK_TRUEDITHER( *ptr, x[i], y[i], rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP] );
+         PACK_TRUEDITHER( *ptr, x[i], YFLIP(xrb, y[i]), rgba[i][RCOMP], rgba[i][GCOMP], rgba[i][BCOMP] );
       }
    }
 }
@@ -3037,7 +3237,12 @@ static void put_mono_row_8A8B8G8R_ximage( PUT_MONO_ROW_ARGS )
    const unsigned long pixel = xmesa_color_to_pixel(ctx, color[RCOMP],
                color[GCOMP], color[BCOMP], color[ACOMP], xmesa->pixelformat);
    ptr = PIXEL_ADDR4(xrb, x, y );
-   for (i=0;i<n;i++) {
+#ifdef XMESA_USE_SSE2
+   i = put_mono_row_32_sse2(n, mask, ptr, (GLuint) pixel);
+#else
+   i = 0;
+#endif
+   for (;i<n;i++) {
       if (!mask || mask[i]) {
 	 ptr[i] = pixel;
       }
@@ -3056,7 +3261,12 @@ static void put_mono_row_8A8R8G8B_ximage( PUT_MONO_ROW_ARGS )
    const unsigned long pixel = xmesa_color_to_pixel(ctx, color[RCOMP],
                color[GCOMP], color[BCOMP], color[ACOMP], xmesa->pixelformat);
    ptr = PIXEL_ADDR4(xrb, x, y );
-   for (i=0;i<n;i++) {
+#ifdef XMESA_USE_SSE2
+   i = put_mono_row_32_sse2(n, mask, ptr, (GLuint) pixel);
+#else
+   i = 0;
+#endif
+   for (;i<n;i++) {
       if (!mask || mask[i]) {
 	 ptr[i] = pixel;
       }
@@ -3074,7 +3284,12 @@ static void put_mono_row_8R8G8B_ximage( PUT_MONO_ROW_ARGS )
    const GLuint pixel = PACK_8R8G8B(color[RCOMP], color[GCOMP], color[BCOMP]);
    GLuint *ptr = PIXEL_ADDR4(xrb, x, y );
    GLuint i;
-   for (i=0;i<n;i++) {
+#ifdef XMESA_USE_SSE2
+   i = put_mono_row_32_sse2(n, mask, ptr, pixel);
+#else
+   i = 0;
+#endif
+   for (;i<n;i++) {
       if (!mask || mask[i]) {
 	 ptr[i] = pixel;
       }
@@ -3222,6 +3437,34 @@ static void put_mono_row_GRAYSCALE8_ximage( PUT_MONO_ROW_ARGS )
 
 
 
+/*
+ * Write a span of identical PF_5R6G5B pixels to an XImage.
+ */
+static void put_mono_row_5R6G5B_ximage( PUT_MONO_ROW_ARGS )
+{
+   const GLubyte *color = (const GLubyte *) value;
+   struct xmesa_renderbuffer *xrb = (struct xmesa_renderbuffer *) rb;
+   register GLushort *ptr = PIXEL_ADDR2(xrb, x, y );
+   const GLushort pixel = PACK_5R6G5B(color[RCOMP], color[GCOMP], color[BCOMP]);
+   GLuint i;
+#ifdef XMESA_USE_SSE2
+   {
+      GLushort pattern[8];
+      for (i = 0; i < 8; i++)
+         pattern[i] = pixel;
+      i = put_mono_row_16_sse2(n, mask, ptr, pattern);
+   }
+#else
+   i = 0;
+#endif
+   for (;i<n;i++) {
+      if (!mask || mask[i]) {
+         ptr[i] = pixel;
+      }
+   }
+}
+
+
 /*
  * Write a span of identical PF_DITHER_5R6G5B pixels to an XImage.
  */
@@ -3234,7 +3477,19 @@ static void put_mono_row_DITHER_5R6G5B_ximage( PUT_MONO_ROW_ARGS )
    const GLint r = color[RCOMP], g = color[GCOMP], b = color[BCOMP];
    GLuint i;
    y = YFLIP(xrb, y);
-   for (i=0;i<n;i++) {
+#ifdef XMESA_USE_SSE2
+   {
+      /* the dither pattern repeats every four pixels */
+      GLushort pattern[8];
+      for (i = 0; i < 8; i++) {
+         PACK_TRUEDITHER(pattern[i], x+i, y, r, g, b);
+      }
+      i = put_mono_row_16_sse2(n, mask, ptr, pattern);
+   }
+#else
+   i = 0;
+#endif
+   for (;i<n;i++) {
       if (!mask || mask[i]) {
          PACK_TRUEDITHER(ptr[i], x+i, y, r, g, b);
       }
@@ -3630,7 +3885,7 @@ static void put_mono_values_DITHER_5R6G5B_ximage( PUT_MONO_VALUES_ARGS )
    for (i=0;i<n;i++) {
       if (mask[i]) {
 	 GLushort *ptr = PIXEL_ADDR2(xrb, x[i], y[i] );
-         PACK_TRUEDITHER(*ptr, x[i], y[i], r, g, b);
+         PACK_TRUEDITHER(*ptr, x[i], YFLIP(xrb, y[i]), r, g, b);
       }
    }
 }
@@ -4132,7 +4387,13 @@ get_row_rgba(GLcontext *ctx, struct gl_renderbuffer *rb,
             {
                const GLuint *ptr4 = PIXEL_ADDR4(xrb, x, y);
                GLuint i;
-               for (i=0;i<n;i++) {
+#ifdef XMESA_USE_SSE2
+               i = get_row_8888_sse2(n, ptr4, rgba, GL_FALSE, 0);
+               ptr4 += i;
+#else
+               i = 0;
+#endif
+               for (;i<n;i++) {
                   GLuint p4 = *ptr4++;
                   rgba[i][RCOMP] = (GLubyte) ( p4        & 0xff);
                   rgba[i][GCOMP] = (GLubyte) ((p4 >> 8)  & 0xff);
@@ -4145,7 +4406,13 @@ get_row_rgba(GLcontext *ctx, struct gl_renderbuffer *rb,
             {
                const GLuint *ptr4 = PIXEL_ADDR4(xrb, x, y);
                GLuint i;
-               for (i=0;i<n;i++) {
+#ifdef XMESA_USE_SSE2
+               i = get_row_8888_sse2(n, ptr4, rgba, GL_TRUE, 0);
+               ptr4 += i;
+#else
+               i = 0;
+#endif
+               for (;i<n;i++) {
                   GLuint p4 = *ptr4++;
                   rgba[i][RCOMP] = (GLubyte) ((p4 >> 16) & 0xff);
                   rgba[i][GCOMP] = (GLubyte) ((p4 >> 8)  & 0xff);
@@ -4158,7 +4425,13 @@ get_row_rgba(GLcontext *ctx, struct gl_renderbuffer *rb,
             {
                const GLuint *ptr4 = PIXEL_ADDR4(xrb, x, y);
                GLuint i;
-               for (i=0;i<n;i++) {
+#ifdef XMESA_USE_SSE2
+               i = get_row_8888_sse2(n, ptr4, rgba, GL_TRUE, 0xff000000);
+               ptr4 += i;
+#else
+               i = 0;
+#endif
+               for (;i<n;i++) {
                   GLuint p4 = *ptr4++;
                   rgba[i][RCOMP] = (GLubyte) ((p4 >> 16) & 0xff);
                   rgba[i][GCOMP] = (GLubyte) ((p4 >> 8)  & 0xff);
@@ -4653,7 +4926,7 @@ xmesa_set_renderbuffer_funcs(struct xmesa_renderbuffer *xrb,
       else {
          xrb->Base.PutRow        = put_row_5R6G5B_ximage;
          xrb->Base.PutRowRGB     = put_row_rgb_5R6G5B_ximage;
-         xrb->Base.PutMonoRow    = put_mono_row_ximage;
+         xrb->Base.PutMonoRow    = put_mono_row_5R6G5B_ximage;
          xrb->Base.PutValues     = put_values_5R6G5B_ximage;
          xrb->Base.PutMonoValues = put_mono_values_ximage;
       }
@@ -44,6 +44,40 @@
 extern _glthread_Mutex _xmesa_lock;
 
 
+/*
+ * With XShm and worker threads, a window's XImage back buffer can be
+ * presented by a helper thread (MESA_SWAP_THREAD) so that rendering the
+ * next frame overlaps the transfer of the previous one.
+ */
+#if defined(USE_XSHM) && defined(WORKER_THREADS) && !defined(XFree86Server)
+#define XMESA_PRESENT_THREAD
+
+#define XMESA_PRESENT_IMAGES 3	/* rendering, queued, being presented */
+
+struct xmesa_presenter {
+   XMesaDisplay *display;	/* the thread's own connection */
+   XMesaWindow window;
+   XMesaGC gc;
+   XMesaImage *images[XMESA_PRESENT_IMAGES];
+   XShmSegmentInfo shminfo[XMESA_PRESENT_IMAGES];
+   GLuint width, height;	/* size of the images */
+
+   /* The fields below are protected by the mutex */
+   int render;			/* image the back buffer points to */
+   int pending;			/* image waiting for the thread, or -1 */
+   int busy;			/* image the thread is presenting, or -1 */
+   GLboolean pendingAll;	/* present all of the pending image, or */
+   GLuint numPendingRects;	/* just its damage rectangles */
+   GLint pendingRects[MAX_DAMAGE_RECTS][4];
+   GLboolean quit;
+
+   _glthread_Mutex mutex;
+   _glthread_Cond cond;		/* broadcast whenever the above change */
+   _glthread_Thread thread;
+};
+#endif
+
+
 /* for PF_8R8G8B24 pixel format */
 typedef struct {
    GLubyte b;
@@ -223,6 +257,10 @@ struct xmesa_buffer {
 #endif
 #endif
 
+#ifdef XMESA_PRESENT_THREAD
+   struct xmesa_presenter *presenter;	/* NULL unless MESA_SWAP_THREAD */
+#endif
+
    XMesaImage *rowimage;	/* Used for optimized span writing */
    XMesaPixmap stipple_pixmap;	/* For polygon stippling */
    XMesaGC stipple_gc;		/* For polygon stippling */
@@ -517,6 +555,16 @@ extern void xmesa_init_driver_functions( XMesaVisual xmvisual,
 
 extern void xmesa_update_state( GLcontext *ctx, GLuint new_state );
 
+#ifdef XMESA_PRESENT_THREAD
+extern GLboolean xmesa_present_init( XMesaBuffer b );
+extern GLboolean xmesa_present_resize( XMesaBuffer b,
+                                       GLuint width, GLuint height );
+extern void xmesa_present_swap( XMesaBuffer b );
+extern void xmesa_present_finish( XMesaBuffer b );
+extern void xmesa_present_wait( GLcontext *ctx, GLboolean frontOnly );
+extern void xmesa_present_destroy( XMesaBuffer b );
+#endif
+
 extern void
 xmesa_set_renderbuffer_funcs(struct xmesa_renderbuffer *xrb,
                              enum pixel_format pixelformat, GLint depth);
@@ -0,0 +1,208 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * This generates glprocs_hash.h, a perfect hash of the static function
+ * names in glprocs.h, which glapi.c uses to look up entrypoints by name.
+ * Run it again whenever glprocs.h is regenerated:
+ *
+ *    ./gen_procs_hash > glprocs_hash.h
+ *
+ * Each name hashes to one of HASH_BUCKETS buckets.  Every bucket gets a
+ * displacement, chosen here, which moves all of its names to free slots
+ * of the HASH_SIZE entry table, so a lookup costs one hash of the name
+ * and one string compare.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "glheader.h"
+#include "glapi.h"
+#include "glapioffsets.h"
+
+/* only the names and offsets are needed here */
+#undef NEED_FUNCTION_POINTER
+#include "glprocs.h"
+
+
+#define HASH_SIZE_LOG2  11
+#define HASH_SIZE       (1 << HASH_SIZE_LOG2)
+#define HASH_BUCKETS    512
+#define MAX_DISPLACEMENT 0xff
+
+/*
+ * The hash functions.  These are copied into the generated header, so
+ * glapi.c is guaranteed to compute exactly the same thing.
+ */
+#define PROCS_HASH_INIT        2166136261u
+#define PROCS_HASH_STEP(h, c)  (((h) ^ (GLubyte) (c)) * 16777619u)
+#define PROCS_HASH_BUCKET(h)   ((h) & (HASH_BUCKETS - 1))
+#define PROCS_HASH_SLOT(h, d)  \
+   ((((h) ^ (d)) * 2654435761u) >> (32 - HASH_SIZE_LOG2))
+
+#define STRINGIFY(x)   #x
+#define XSTRINGIFY(x)  STRINGIFY(x)
+
+
+static GLuint
+hash_name(const char *name)
+{
+   GLuint h = PROCS_HASH_INIT;
+   while (*name) {
+      h = PROCS_HASH_STEP(h, *name);
+      name++;
+   }
+   return h;
+}
+
+
+static GLuint NumFunctions;
+static GLuint Hash[sizeof(static_functions) / sizeof(static_functions[0])];
+static GLint Table[HASH_SIZE];
+static GLuint Displacement[HASH_BUCKETS];
+static GLuint BucketSize[HASH_BUCKETS];
+static GLuint BucketOrder[HASH_BUCKETS];
+
+
+static int
+compare_buckets(const void *a, const void *b)
+{
+   const GLuint ba = *(const GLuint *) a, bb = *(const GLuint *) b;
+   if (BucketSize[ba] != BucketSize[bb])
+      return (BucketSize[ba] < BucketSize[bb]) ? 1 : -1;
+   return (ba < bb) ? -1 : (ba > bb);
+}
+
+
+/**
+ * Try to place all the names of bucket b using displacement d.
+ */
+static GLboolean
+place_bucket(GLuint b, GLuint d)
+{
+   GLuint placed[HASH_SIZE];
+   GLuint count = 0, i, j;
+
+   for (i = 0; i < NumFunctions; i++) {
+      if (PROCS_HASH_BUCKET(Hash[i]) == b) {
+         const GLuint slot = PROCS_HASH_SLOT(Hash[i], d);
+         if (Table[slot] >= 0) {
+            for (j = 0; j < count; j++)
+               Table[placed[j]] = -1;
+            return GL_FALSE;
+         }
+         Table[slot] = i;
+         placed[count++] = slot;
+      }
+   }
+   return GL_TRUE;
+}
+
+
+int
+main(void)
+{
+   GLuint i, j;
+
+   for (i = 0; static_functions[i].Name_offset >= 0; i++) {
+      const char *name = gl_string_table + static_functions[i].Name_offset;
+      for (j = 0; j < i; j++) {
+         if (strcmp(name, gl_string_table + static_functions[j].Name_offset)
+             == 0) {
+            fprintf(stderr, "gen_procs_hash: %s is listed twice\n", name);
+            return 1;
+         }
+      }
+      Hash[i] = hash_name(name);
+      BucketSize[PROCS_HASH_BUCKET(Hash[i])]++;
+   }
+   NumFunctions = i;
+
+   if (NumFunctions > HASH_SIZE / 2) {
+      fprintf(stderr, "gen_procs_hash: too many functions, "
+              "increase HASH_SIZE_LOG2\n");
+      return 1;
+   }
+
+   for (i = 0; i < HASH_SIZE; i++)
+      Table[i] = -1;
+   for (i = 0; i < HASH_BUCKETS; i++)
+      BucketOrder[i] = i;
+   qsort(BucketOrder, HASH_BUCKETS, sizeof(GLuint), compare_buckets);
+
+   /* place the fullest buckets first, while the table is still empty */
+   for (i = 0; i < HASH_BUCKETS && BucketSize[BucketOrder[i]] > 0; i++) {
+      const GLuint b = BucketOrder[i];
+      GLuint d;
+      for (d = 0; d <= MAX_DISPLACEMENT; d++) {
+         if (place_bucket(b, d))
+            break;
+      }
+      if (d > MAX_DISPLACEMENT) {
+         fprintf(stderr, "gen_procs_hash: no displacement for bucket %u\n",
+                 b);
+         return 1;
+      }
+      Displacement[b] = d;
+   }
+
+   printf("/* DO NOT EDIT - This file generated automatically by "
+          "gen_procs_hash.c */\n");
+   printf("\n");
+   printf("/* This file is only included by glapi.c.  It is a perfect hash "
+          "of the\n");
+   printf(" * names in glprocs.h and must be regenerated along with it.\n");
+   printf(" */\n");
+   printf("\n");
+   printf("#define GLPROCS_HASH_NUM_FUNCTIONS %u\n", NumFunctions);
+   printf("#define GLPROCS_HASH_INIT        %s\n",
+          XSTRINGIFY(PROCS_HASH_INIT));
+   printf("#define GLPROCS_HASH_STEP(h, c)  %s\n",
+          XSTRINGIFY(PROCS_HASH_STEP(h, c)));
+   printf("#define GLPROCS_HASH_BUCKET(h)   %s\n",
+          XSTRINGIFY(PROCS_HASH_BUCKET(h)));
+   printf("#define GLPROCS_HASH_SLOT(h, d)  %s\n",
+          XSTRINGIFY(PROCS_HASH_SLOT(h, d)));
+   printf("\n");
+
+   printf("static const GLubyte gl_procs_displacement[%d] = {\n",
+          HASH_BUCKETS);
+   for (i = 0; i < HASH_BUCKETS; i++) {
+      printf("%s%3u,%s", (i % 10) ? " " : "   ", Displacement[i],
+             (i % 10 == 9 || i == HASH_BUCKETS - 1) ? "\n" : "");
+   }
+   printf("};\n");
+   printf("\n");
+
+   printf("/* index into static_functions, or -1 */\n");
+   printf("static const GLshort gl_procs_hash[%d] = {\n", HASH_SIZE);
+   for (i = 0; i < HASH_SIZE; i++) {
+      printf("%s%4d,%s", (i % 12) ? " " : "   ", Table[i],
+             (i % 12 == 11 || i == HASH_SIZE - 1) ? "\n" : "");
+   }
+   printf("};\n");
+
+   return 0;
+}
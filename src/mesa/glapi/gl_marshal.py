@@ -0,0 +1,276 @@
+#!/usr/bin/env python
+
+# Mesa 3-D graphics library
+# Version:  6.4
+#
+# Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+# BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+# AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+"""Generate main/api_marshal_tmp.h from glapitable.h.
+
+For every slot of struct _glapi_table this writes a marshal_X function
+for the marshalling dispatch table in main/api_marshal.c:
+
+ - Functions which return nothing and take their parameters by value are
+   recorded as a command, executed later on the worker thread by
+   unmarshal_X.  So are the vector forms of the per-vertex functions and
+   the matrix functions, whose arrays have a fixed size, and the state
+   functions listed in PNAME_COUNT, whose array size depends on pname.
+
+ - All other functions (those that return a value, read or write client
+   memory of unknown size, or are listed in SYNC) wait for the worker to
+   finish and then call the real function on the application's thread.
+
+Usage:  python gl_marshal.py glapitable.h > ../main/api_marshal_tmp.h
+"""
+
+import re
+import sys
+
+
+# By-value functions which must still run on the application's thread:
+# they read client arrays, or promise completion when they return.
+SYNC = [ 'ArrayElement', 'DrawArrays', 'Finish', 'FinishFenceNV' ]
+
+# Functions which also submit the batch being recorded to the worker.
+FLUSH = [ 'Flush' ]
+
+# Per-vertex and matrix functions whose array parameters have a fixed size.
+VECTOR_RE = re.compile(r'^(Color|SecondaryColor|Normal|TexCoord|MultiTexCoord|'
+                       r'Vertex|RasterPos|WindowPos|EvalCoord|VertexAttrib|'
+                       r'Rect)([1-4])N?(b|s|i|f|d|ub|us|ui)v(ARB|EXT|NV|MESA)?$')
+VECTOR_COUNT = {
+   'EdgeFlagv': 1,
+   'Indexdv': 1, 'Indexfv': 1, 'Indexiv': 1, 'Indexsv': 1, 'Indexubv': 1,
+   'FogCoordfvEXT': 1, 'FogCoorddvEXT': 1,
+   'Rectdv': 2, 'Rectfv': 2, 'Rectiv': 2, 'Rectsv': 2,
+   'LoadMatrixf': 16, 'LoadMatrixd': 16, 'MultMatrixf': 16, 'MultMatrixd': 16,
+   'LoadTransposeMatrixfARB': 16, 'LoadTransposeMatrixdARB': 16,
+   'MultTransposeMatrixfARB': 16, 'MultTransposeMatrixdARB': 16,
+   'ProgramEnvParameter4dvARB': 4, 'ProgramEnvParameter4fvARB': 4,
+   'ProgramLocalParameter4dvARB': 4, 'ProgramLocalParameter4fvARB': 4,
+   'ProgramParameter4dvNV': 4, 'ProgramParameter4fvNV': 4,
+}
+
+# State functions whose array size depends on pname.  The named function
+# in api_marshal.c returns the number of elements for a pname, or 0 if it
+# doesn't know the pname; the call is then made synchronously, so the
+# real function can report the error.
+PNAME_COUNT = {
+   'Materialfv': '_mesa_material_count',
+   'Materialiv': '_mesa_material_count',
+   'Lightfv': '_mesa_light_count', 'Lightiv': '_mesa_light_count',
+   'LightModelfv': '_mesa_light_model_count',
+   'LightModeliv': '_mesa_light_model_count',
+   'Fogfv': '_mesa_fog_count', 'Fogiv': '_mesa_fog_count',
+   'TexEnvfv': '_mesa_tex_env_count', 'TexEnviv': '_mesa_tex_env_count',
+   'TexParameterfv': '_mesa_tex_parameter_count',
+   'TexParameteriv': '_mesa_tex_parameter_count',
+   'TexGenfv': '_mesa_tex_gen_count', 'TexGendv': '_mesa_tex_gen_count',
+   'TexGeniv': '_mesa_tex_gen_count',
+}
+PNAME_MAX = 4
+
+LINE_RE = re.compile(r'^\s*(.+?)\s*\(GLAPIENTRYP (\w+)\)\((.*)\); /\* (\d+) \*/')
+
+
+class Param:
+   def __init__(self, text):
+      m = re.match(r'^(.*?)\s*(\w+)$', text.strip())
+      self.type = m.group(1)
+      self.name = m.group(2)
+      self.is_pointer = '*' in self.type
+      self.count = 0             # array elements copied, for pointers
+
+   def elem_type(self):
+      return self.type.replace('const', '').replace('*', '').strip()
+
+
+class Function:
+   def __init__(self, ret, name, params, offset):
+      self.ret = ret
+      self.name = name
+      self.offset = int(offset)
+      if params.strip() == 'void':
+         self.params = []
+      else:
+         self.params = [Param(p) for p in params.split(',')]
+      self.pname_count = None
+      self.is_async = self.classify()
+
+   def classify(self):
+      if self.ret != 'void' or self.name in SYNC:
+         return False
+      pointers = [p for p in self.params if p.is_pointer]
+      if not pointers:
+         return True
+      for p in pointers:
+         if not p.type.startswith('const ') or p.type.count('*') != 1:
+            return False
+      m = VECTOR_RE.match(self.name)
+      if m:
+         count = int(m.group(2))
+      elif self.name in VECTOR_COUNT:
+         count = VECTOR_COUNT[self.name]
+      elif self.name in PNAME_COUNT and len(pointers) == 1:
+         self.pname_count = PNAME_COUNT[self.name]
+         count = PNAME_MAX
+      else:
+         return False
+      for p in pointers:
+         p.count = count
+      return True
+
+   def decl_params(self):
+      if not self.params:
+         return 'void'
+      return ', '.join(['%s %s' % (p.type, p.name) for p in self.params])
+
+   def call_args(self, prefix=''):
+      return ', '.join([prefix + p.name for p in self.params])
+
+
+def print_async(f):
+   print('')
+   print('struct marshal_cmd_%s {' % f.name)
+   print('   struct marshal_cmd_base header;')
+   for p in f.params:
+      if p.is_pointer:
+         print('   %s %s[%d];' % (p.elem_type(), p.name, p.count))
+      else:
+         print('   %s %s;' % (p.type, p.name))
+   print('};')
+   print('')
+   print('static void')
+   print('unmarshal_%s(GLcontext *ctx, const struct marshal_cmd_%s *cmd)'
+         % (f.name, f.name))
+   print('{')
+   print('   CALL_%s(ctx->CurrentDispatch, (%s));'
+         % (f.name, f.call_args('cmd->')))
+   print('}')
+   print('')
+   print('static void GLAPIENTRY')
+   print('marshal_%s(%s)' % (f.name, f.decl_params()))
+   print('{')
+   print('   GET_CURRENT_CONTEXT(ctx);')
+   if f.pname_count:
+      print('   const GLuint count = %s(pname);' % f.pname_count)
+   print('   struct marshal_cmd_%s *cmd;' % f.name)
+   if f.pname_count:
+      print('   if (count == 0) {')
+      print('      marshal_sync_begin(ctx);')
+      print('      CALL_%s(ctx->CurrentDispatch, (%s));'
+            % (f.name, f.call_args()))
+      print('      marshal_sync_end(ctx);')
+      print('      return;')
+      print('   }')
+   print('   cmd = (struct marshal_cmd_%s *)' % f.name)
+   print('      marshal_alloc(ctx, DISPATCH_CMD_%s, sizeof(*cmd));' % f.name)
+   for p in f.params:
+      if not p.is_pointer:
+         print('   cmd->%s = %s;' % (p.name, p.name))
+      elif f.pname_count:
+         print('   MEMCPY(cmd->%s, %s, count * sizeof(%s));'
+               % (p.name, p.name, p.elem_type()))
+      else:
+         print('   MEMCPY(cmd->%s, %s, sizeof(cmd->%s));'
+               % (p.name, p.name, p.name))
+   if f.name in FLUSH:
+      print('   marshal_submit(ctx->Marshal);')
+   print('}')
+
+
+def print_sync(f):
+   print('')
+   print('static %s GLAPIENTRY' % f.ret)
+   print('marshal_%s(%s)' % (f.name, f.decl_params()))
+   print('{')
+   print('   GET_CURRENT_CONTEXT(ctx);')
+   if f.ret != 'void':
+      print('   %s ret;' % f.ret)
+   print('   marshal_sync_begin(ctx);')
+   if f.ret != 'void':
+      print('   ret = CALL_%s(ctx->CurrentDispatch, (%s));'
+            % (f.name, f.call_args()))
+   else:
+      print('   CALL_%s(ctx->CurrentDispatch, (%s));'
+            % (f.name, f.call_args()))
+   print('   marshal_sync_end(ctx);')
+   if f.ret != 'void':
+      print('   return ret;')
+   print('}')
+
+
+def main(argv):
+   path = 'glapitable.h'
+   if len(argv) > 1:
+      path = argv[1]
+
+   functions = []
+   for line in open(path):
+      m = LINE_RE.match(line)
+      if m:
+         functions.append(Function(m.group(1), m.group(2), m.group(3),
+                                   m.group(4)))
+   async_functions = [f for f in functions if f.is_async]
+
+   print('/* DO NOT EDIT - This file generated automatically by '
+         'gl_marshal.py script */')
+   print('')
+   print('/*')
+   print(' * This file is only included by api_marshal.c.  It has a')
+   print(' * marshal_X function for each of the %d dispatch table slots;'
+         % len(functions))
+   print(' * %d of them are recorded for the worker thread, the others'
+         % len(async_functions))
+   print(' * are synchronous.')
+   print(' */')
+   print('')
+   print('enum marshal_cmd_id {')
+   for f in async_functions:
+      print('   DISPATCH_CMD_%s,' % f.name)
+   print('   NUM_DISPATCH_CMD')
+   print('};')
+
+   for f in functions:
+      if f.is_async:
+         print_async(f)
+      else:
+         print_sync(f)
+
+   print('')
+   print('')
+   print('typedef void (*unmarshal_func)(GLcontext *ctx, const void *cmd);')
+   print('')
+   print('static const unmarshal_func unmarshal_dispatch[NUM_DISPATCH_CMD] = {')
+   for f in async_functions:
+      print('   (unmarshal_func) unmarshal_%s,' % f.name)
+   print('};')
+   print('')
+   print('')
+   print('static void')
+   print('init_marshal_table(struct _glapi_table *table)')
+   print('{')
+   for f in functions:
+      print('   SET_%s(table, marshal_%s);' % (f.name, f.name))
+   print('}')
+
+
+if __name__ == '__main__':
+   main(sys.argv)
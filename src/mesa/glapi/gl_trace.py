@@ -0,0 +1,515 @@
+#!/usr/bin/env python
+
+# Mesa 3-D graphics library
+# Version:  6.4
+#
+# Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+# BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+# AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+"""Generate the writer and the reader of MESA_TRACE files from glapitable.h.
+
+With -m trace this writes main/api_trace_tmp.h, with a trace_X function for
+every slot of struct _glapi_table, for the tracing dispatch table of
+main/api_trace.c.  With -m replay it writes progs/trace/glreplay_tmp.h, with
+the replay_X function which decodes each recorded call and makes it again.
+Both get the record layout and the call names from here, so they always
+agree on the format.
+
+A record is a struct trace_record header, the parameters in order and then
+padding to a multiple of 8 bytes.  Scalar parameters are stored as they
+are.  Pointer parameters are stored as a GLuint byte count and, after
+padding to 8 bytes, the client memory they point to; a count of TRACE_RAW
+is followed by the pointer value itself, for offsets into buffer objects.
+Output parameters (glReadPixels, glGenTextures, ...) only store the count.
+
+ - Queries (glGet*, glIs*, ...) are not recorded.
+ - The vertex array functions are not recorded either.  Instead api_trace.c
+   records the state of each array they change, and draw calls record the
+   elements of the client arrays they read beforehand.
+ - Functions reading client memory of a size this script doesn't know are
+   not recorded; api_trace.c warns once about each of them.
+
+Usage:  python gl_trace.py -m trace glapitable.h > ../main/api_trace_tmp.h
+        python gl_trace.py -m replay glapitable.h > \\
+            ../../../progs/trace/glreplay_tmp.h
+"""
+
+import getopt
+import re
+import sys
+
+import gl_marshal
+
+
+TRACE_MAGIC = 'MESATRC1'
+TRACE_BYTE_ORDER = 0x01020304
+TRACE_RAW = 0xffffffff
+
+# Records which aren't GL calls
+SPECIAL_RECORDS = [
+   ('TRACE_CONTEXT', 0xfff0,
+    'context id, rgb, depth, stencil, accum bits, width, height'),
+   ('TRACE_DESTROY', 0xfff1, 'context id'),
+   ('TRACE_SWAP', 0xfff2, 'end of frame'),
+   ('TRACE_ARRAY_POINTER', 0xfff3, 'struct trace_array_pointer'),
+   ('TRACE_ARRAY_DATA', 0xfff4, 'slot, offset, elements'),
+]
+
+# Array slots of TRACE_ARRAY_POINTER and TRACE_ARRAY_DATA records
+ARRAY_SLOTS = [
+   ('TRACE_ARRAY_VERTEX', 0),
+   ('TRACE_ARRAY_NORMAL', 1),
+   ('TRACE_ARRAY_COLOR', 2),
+   ('TRACE_ARRAY_SECONDARY_COLOR', 3),
+   ('TRACE_ARRAY_FOG_COORD', 4),
+   ('TRACE_ARRAY_INDEX', 5),
+   ('TRACE_ARRAY_EDGE_FLAG', 6),
+   ('TRACE_ARRAY_TEX_COORD', 8),       # + texture unit
+   ('TRACE_ARRAY_ATTRIB', 16),         # + attribute index
+   ('TRACE_ARRAY_SLOTS', 32),
+]
+
+QUERY_RE = re.compile(r'^(Get|Is|Are|Test)[A-Z]')
+QUERY = [ 'CheckFramebufferStatusEXT', 'PollInstrumentsSGIX' ]
+
+# Functions which only set vertex array state; see trace_arrays_changed()
+POINTER = [
+   'ColorPointer', 'EdgeFlagPointer', 'IndexPointer', 'NormalPointer',
+   'TexCoordPointer', 'VertexPointer', 'InterleavedArrays',
+   'ColorPointerEXT', 'EdgeFlagPointerEXT', 'IndexPointerEXT',
+   'NormalPointerEXT', 'TexCoordPointerEXT', 'VertexPointerEXT',
+   'SecondaryColorPointerEXT', 'FogCoordPointerEXT',
+   'VertexAttribPointerNV', 'VertexAttribPointerARB',
+]
+
+# Functions written by hand, in api_trace.c and glreplay.c
+CUSTOM = [ 'UnmapBufferARB', 'ShaderSourceARB' ]
+
+# Functions drawing from the client arrays: the elements they read
+DRAW = {
+   'ArrayElement': 'trace_client_arrays(ctx, i, i + 1);',
+   'DrawArrays': 'trace_client_arrays(ctx, first, first + count);',
+   'DrawRangeElements': 'trace_client_arrays(ctx, start, end + 1);',
+   'DrawElements': 'trace_element_arrays(ctx, count, type, indices);',
+   'MultiDrawArraysEXT':
+      'trace_multi_arrays(ctx, first, count, primcount);',
+}
+
+# Functions which let Mesa switch the dispatch table, or need the file
+# to be up to date when they return
+POST = {
+   'NewList': ['trace_restore_dispatch(ctx);'],
+   'EndList': ['trace_restore_dispatch(ctx);'],
+   'CallList': ['trace_restore_dispatch(ctx);'],
+   'CallLists': ['trace_restore_dispatch(ctx);'],
+   'Flush': ['trace_restore_dispatch(ctx);'],
+   'Finish': ['trace_restore_dispatch(ctx);', 'trace_flush();'],
+}
+
+UNPACK = '&ctx->Unpack'
+PACK = '&ctx->Pack'
+
+def image(dims, w, h, d, fmt, typ, ptr, packing=UNPACK):
+   return ('image_bytes(%s, %d, %s, %s, %s, %s, %s, %s)'
+           % (packing, dims, w, h, d, fmt, typ, ptr))
+
+def tex_image(dims, ptr='pixels', fmt='format', typ='type'):
+   size = ['width', 'height', 'depth'][:dims] + ['1'] * (3 - dims)
+   return image(dims, size[0], size[1], size[2], fmt, typ, ptr)
+
+def compressed(ptr='data'):
+   return 'compressed_bytes(ctx, imageSize, %s)' % ptr
+
+# Byte counts of pointer parameters, as C expressions.  The functions
+# used here are defined in api_trace.c.
+SIZES = {
+   'CallLists': { 'lists': 'list_bytes(n, type)' },
+   'Bitmap': { 'bitmap': image(2, 'width', 'height', '1', 'GL_COLOR_INDEX',
+                               'GL_BITMAP', 'bitmap') },
+   'PolygonStipple': { 'mask': image(2, '32', '32', '1', 'GL_COLOR_INDEX',
+                                     'GL_BITMAP', 'mask') },
+   'ClipPlane': { 'equation': '4 * sizeof(GLdouble)' },
+   'TexImage1D': { 'pixels': tex_image(1) },
+   'TexImage2D': { 'pixels': tex_image(2) },
+   'TexImage3D': { 'pixels': tex_image(3) },
+   'TexSubImage1D': { 'pixels': tex_image(1) },
+   'TexSubImage2D': { 'pixels': tex_image(2) },
+   'TexSubImage3D': { 'pixels': tex_image(3) },
+   'DrawPixels': { 'pixels': tex_image(2) },
+   'ReadPixels': { 'pixels': image(2, 'width', 'height', '1', 'format',
+                                   'type', 'pixels', PACK) },
+   'ColorTable': { 'table': image(1, 'width', '1', '1', 'format', 'type',
+                                  'table') },
+   'ColorSubTable': { 'data': image(1, 'count', '1', '1', 'format', 'type',
+                                    'data') },
+   'ConvolutionFilter1D': { 'image': image(1, 'width', '1', '1', 'format',
+                                           'type', 'image') },
+   'ConvolutionFilter2D': { 'image': image(2, 'width', 'height', '1',
+                                           'format', 'type', 'image') },
+   'SeparableFilter2D': {
+      'row': image(1, 'width', '1', '1', 'format', 'type', 'row'),
+      'column': image(1, 'height', '1', '1', 'format', 'type', 'column') },
+   'CompressedTexImage1DARB': { 'data': compressed() },
+   'CompressedTexImage2DARB': { 'data': compressed() },
+   'CompressedTexImage3DARB': { 'data': compressed() },
+   'CompressedTexSubImage1DARB': { 'data': compressed() },
+   'CompressedTexSubImage2DARB': { 'data': compressed() },
+   'CompressedTexSubImage3DARB': { 'data': compressed() },
+   'Map1d': { 'points': 'map1_bytes(target, stride, order, sizeof(GLdouble))' },
+   'Map1f': { 'points': 'map1_bytes(target, stride, order, sizeof(GLfloat))' },
+   'Map2d': { 'points': 'map2_bytes(target, ustride, uorder, vstride, '
+                        'vorder, sizeof(GLdouble))' },
+   'Map2f': { 'points': 'map2_bytes(target, ustride, uorder, vstride, '
+                        'vorder, sizeof(GLfloat))' },
+   'PixelMapfv': { 'values': 'count_bytes(mapsize, sizeof(GLfloat))' },
+   'PixelMapuiv': { 'values': 'count_bytes(mapsize, sizeof(GLuint))' },
+   'PixelMapusv': { 'values': 'count_bytes(mapsize, sizeof(GLushort))' },
+   'FeedbackBuffer': { 'buffer': 'count_bytes(size, sizeof(GLfloat))' },
+   'SelectBuffer': { 'buffer': 'count_bytes(size, sizeof(GLuint))' },
+   'ColorTableParameterfv':
+      { 'params': 'color_table_parameter_count(pname) * sizeof(GLfloat)' },
+   'ColorTableParameteriv':
+      { 'params': 'color_table_parameter_count(pname) * sizeof(GLint)' },
+   'ConvolutionParameterfv':
+      { 'params': 'convolution_parameter_count(pname) * sizeof(GLfloat)' },
+   'ConvolutionParameteriv':
+      { 'params': 'convolution_parameter_count(pname) * sizeof(GLint)' },
+   'PointParameterfvEXT':
+      { 'params': 'point_parameter_count(pname) * sizeof(GLfloat)' },
+   'PointParameterivNV':
+      { 'params': 'point_parameter_count(pname) * sizeof(GLint)' },
+   'CombinerParameterfvNV':
+      { 'params': 'combiner_parameter_count(pname) * sizeof(GLfloat)' },
+   'CombinerParameterivNV':
+      { 'params': 'combiner_parameter_count(pname) * sizeof(GLint)' },
+   'DetailTexFuncSGIS': { 'points': 'count_bytes(2 * n, sizeof(GLfloat))' },
+   'SharpenTexFuncSGIS': { 'points': 'count_bytes(2 * n, sizeof(GLfloat))' },
+   'VertexWeightfvEXT': { 'weight': 'sizeof(GLfloat)' },
+   'ExecuteProgramNV': { 'params': '4 * sizeof(GLfloat)' },
+   'SetFragmentShaderConstantATI': { 'value': '4 * sizeof(GLfloat)' },
+   'LoadProgramNV': { 'program': 'count_bytes(len, 1)' },
+   'ProgramStringARB': { 'string': 'count_bytes(len, 1)' },
+   'ProgramNamedParameter4fNV': { 'name': 'count_bytes(len, 1)' },
+   'ProgramNamedParameter4dNV': { 'name': 'count_bytes(len, 1)' },
+   'ProgramNamedParameter4fvNV': { 'name': 'count_bytes(len, 1)',
+                                   'v': '4 * sizeof(GLfloat)' },
+   'ProgramNamedParameter4dvNV': { 'name': 'count_bytes(len, 1)',
+                                   'v': '4 * sizeof(GLdouble)' },
+   'ProgramParameters4dvNV':
+      { 'params': 'count_bytes(4 * num, sizeof(GLdouble))' },
+   'ProgramParameters4fvNV':
+      { 'params': 'count_bytes(4 * num, sizeof(GLfloat))' },
+   'BufferDataARB': { 'data': 'buffer_bytes(size, data)' },
+   'BufferSubDataARB': { 'data': 'buffer_bytes(size, data)' },
+   'DrawElements': { 'indices': 'element_bytes(ctx, count, type, indices)' },
+   'DrawRangeElements':
+      { 'indices': 'element_bytes(ctx, count, type, indices)' },
+   'MultiDrawArraysEXT': { 'first': 'count_bytes(primcount, sizeof(GLint))',
+                           'count':
+                              'count_bytes(primcount, sizeof(GLsizei))' },
+   'BindAttribLocationARB':
+      { 'name': '(GLuint) _mesa_strlen((const char *) name) + 1' },
+}
+
+for k, n in [(1, 1), (2, 2), (3, 3), (4, 4)]:
+   for t in ['s', 'f', 'd']:
+      elem = {'s': 'GLshort', 'f': 'GLfloat', 'd': 'GLdouble'}[t]
+      SIZES['VertexAttribs%d%svNV' % (k, t)] = \
+         { 'v': 'count_bytes(%d * n, sizeof(%s))' % (n, elem) }
+   SIZES['Uniform%dfvARB' % k] = \
+      { 'value': 'count_bytes(%d * count, sizeof(GLfloat))' % n }
+   SIZES['Uniform%divARB' % k] = \
+      { 'value': 'count_bytes(%d * count, sizeof(GLint))' % n }
+SIZES['VertexAttribs4ubvNV'] = { 'v': 'count_bytes(4 * n, sizeof(GLubyte))' }
+for k in [2, 3, 4]:
+   SIZES['UniformMatrix%dfvARB' % k] = \
+      { 'value': 'count_bytes(%d * count, sizeof(GLfloat))' % (k * k) }
+
+# Non-const pointers which are read, not written
+INPUT = { 'MultiDrawArraysEXT': [ 'first', 'count' ] }
+
+# Output buffers which GL keeps writing to after the call returns
+KEEP = [ 'FeedbackBuffer', 'SelectBuffer' ]
+
+
+class Function(gl_marshal.Function):
+   def __init__(self, ret, name, params, offset):
+      gl_marshal.Function.__init__(self, ret, name, params, offset)
+      self.kind = self.trace_kind()
+
+   def trace_kind(self):
+      if QUERY_RE.match(self.name) or self.name in QUERY:
+         return 'query'
+      if self.name in POINTER:
+         return 'pointer'
+      if self.name in CUSTOM:
+         return 'custom'
+      sizes = SIZES.get(self.name, {})
+      for p in self.params:
+         if not p.is_pointer:
+            continue
+         if p.type.count('*') != 1:
+            return 'unsupported'
+         if p.name in sizes:
+            p.bytes = sizes[p.name]
+         elif self.is_async:
+            if self.pname_count:
+               p.bytes = '%s(pname) * sizeof(%s)' % (self.pname_count,
+                                                     p.elem_type())
+            else:
+               p.bytes = '%d * sizeof(%s)' % (p.count, p.elem_type())
+         elif p.elem_type() != 'GLvoid' and \
+              [q for q in self.params if q.name == 'n']:
+            p.bytes = 'count_bytes(n, sizeof(%s))' % p.elem_type()
+         else:
+            return 'unsupported'
+         p.output = not p.type.startswith('const ') and \
+                    p.name not in INPUT.get(self.name, [])
+      return 'record'
+
+   def call(self, table, indent):
+      if self.ret != 'void':
+         return '%sret = CALL_%s(%s, (%s));' % (indent, self.name, table,
+                                               self.call_args())
+      return '%sCALL_%s(%s, (%s));' % (indent, self.name, table,
+                                       self.call_args())
+
+
+def print_format():
+   print('')
+   print('#define TRACE_MAGIC       "%s"' % TRACE_MAGIC)
+   print('#define TRACE_BYTE_ORDER  0x%08x' % TRACE_BYTE_ORDER)
+   print('#define TRACE_RAW         0x%xU  /**< byte count of a pointer '
+         'value */' % TRACE_RAW)
+   print('')
+   for name, value, comment in SPECIAL_RECORDS:
+      print('#define %-24s 0x%04x  /**< %s */' % (name, value, comment))
+   print('')
+   for name, value in ARRAY_SLOTS:
+      print('#define %-28s %d' % (name, value))
+   print('')
+   print('#if defined(_MSC_VER)')
+   print('typedef unsigned __int64 trace_uint64;')
+   print('#else')
+   print('typedef unsigned long long trace_uint64;')
+   print('#endif')
+   print('')
+   print('struct trace_record {')
+   print('   GLushort id;         /**< enum trace_call_id or TRACE_x */')
+   print('   GLushort pad;')
+   print('   GLuint size;         /**< bytes after this header */')
+   print('};')
+   print('')
+   print('struct trace_array_pointer {')
+   print('   GLuint slot;         /**< TRACE_ARRAY_x */')
+   print('   GLuint enabled;')
+   print('   GLint size;')
+   print('   GLenum type;')
+   print('   GLint stride;        /**< in bytes, never 0 */')
+   print('   GLuint normalized;')
+   print('   GLuint client_unit;  /**< glClientActiveTexture unit */')
+   print('   GLuint buffer;       /**< buffer object name, or 0 */')
+   print('   trace_uint64 pointer; /**< offset into the buffer object */')
+   print('};')
+
+
+def print_names(functions):
+   print('')
+   print('enum trace_call_id {')
+   for f in functions:
+      print('   TRACE_CALL_%s,' % f.name)
+   print('   NUM_TRACE_CALL')
+   print('};')
+   print('')
+   print('static const char * const trace_call_names[NUM_TRACE_CALL] = {')
+   for f in functions:
+      print('   "%s",' % f.name)
+   print('};')
+
+
+def print_trace(f):
+   print('')
+   print('static %s GLAPIENTRY' % f.ret)
+   print('trace_%s(%s)' % (f.name, f.decl_params()))
+   print('{')
+   print('   GET_CURRENT_CONTEXT(ctx);')
+   if f.ret != 'void':
+      print('   %s ret;' % f.ret)
+
+   if f.kind == 'query':
+      print(f.call('ctx->CurrentDispatch', '   '))
+   elif f.kind == 'unsupported':
+      print('   trace_unsupported(ctx, TRACE_CALL_%s);' % f.name)
+      print(f.call('ctx->CurrentDispatch', '   '))
+   elif f.kind == 'pointer':
+      print('   if (trace_lock(ctx)) {')
+      print('      struct trace_array_state before;')
+      print('      trace_save_arrays(ctx, &before);')
+      print(f.call('ctx->CurrentDispatch', '      '))
+      print('      trace_arrays_changed(ctx, &before);')
+      print('      trace_unlock();')
+      print('   }')
+      print('   else {')
+      print(f.call('ctx->CurrentDispatch', '      '))
+      print('   }')
+   else:
+      print('   if (trace_lock(ctx)) {')
+      if f.name in DRAW:
+         print('      ' + DRAW[f.name])
+      print('      trace_record(TRACE_CALL_%s);' % f.name)
+      for p in f.params:
+         if not p.is_pointer:
+            print('      trace_write(&%s, sizeof(%s));' % (p.name, p.name))
+         elif p.output:
+            print('      trace_output(%s, %s);' % (p.name, p.bytes))
+         else:
+            print('      trace_array(%s, %s);' % (p.name, p.bytes))
+      print(f.call('ctx->CurrentDispatch', '      '))
+      for statement in POST.get(f.name, []):
+         print('      ' + statement)
+      print('      trace_unlock();')
+      print('   }')
+      print('   else {')
+      print(f.call('ctx->CurrentDispatch', '      '))
+      print('   }')
+
+   if f.ret != 'void':
+      print('   return ret;')
+   print('}')
+
+
+def print_trace_file(functions):
+   print('/* DO NOT EDIT - This file generated automatically by '
+         'gl_trace.py script */')
+   print('')
+   print('/*')
+   print(' * This file is only included by api_trace.c.  It has a trace_X')
+   print(' * function for each of the %d dispatch table slots; %d of them'
+         % (len(functions), len([f for f in functions
+                                 if f.kind == 'record'])))
+   print(' * are recorded.')
+   print(' *')
+   print(' * It is included twice: first for the record layout and the call')
+   print(' * names, then with TRACE_FUNCTIONS defined for the functions.')
+   print(' */')
+   print('')
+   print('#ifndef TRACE_FUNCTIONS')
+   print_format()
+   print_names(functions)
+   print('')
+   print('#else /* TRACE_FUNCTIONS */')
+   for f in functions:
+      if f.kind != 'custom':
+         print_trace(f)
+   print('')
+   print('')
+   print('static void')
+   print('init_trace_table(struct _glapi_table *table)')
+   print('{')
+   for f in functions:
+      print('   SET_%s(table, trace_%s);' % (f.name, f.name))
+   print('}')
+   print('')
+   print('#endif /* TRACE_FUNCTIONS */')
+
+
+def print_replay(f):
+   print('')
+   print('static void')
+   print('replay_%s(struct replay_reader *reader)' % f.name)
+   print('{')
+   for p in f.params:
+      print('   %s %s;' % (p.type, p.name))
+   for p in f.params:
+      if not p.is_pointer:
+         print('   replay_read(reader, &%s, sizeof(%s));' % (p.name, p.name))
+      elif p.output and f.name in KEEP:
+         print('   %s = (%s) replay_output_keep(reader);' % (p.name, p.type))
+      elif p.output:
+         print('   %s = (%s) replay_output(reader);' % (p.name, p.type))
+      else:
+         print('   %s = (%s) replay_array(reader);' % (p.name, p.type))
+   print('   (*(%s (GLAPIENTRYP)(%s)) reader->procs[TRACE_CALL_%s])(%s);'
+         % (f.ret, f.decl_params(), f.name, f.call_args()))
+   print('}')
+
+
+def print_replay_file(functions):
+   print('/* DO NOT EDIT - This file generated automatically by '
+         'gl_trace.py script */')
+   print('')
+   print('/*')
+   print(' * This file is only included by glreplay.c.  It has a replay_X')
+   print(' * function for each call which api_trace.c records.')
+   print(' *')
+   print(' * It is included twice: first for the record layout and the call')
+   print(' * names, then with REPLAY_FUNCTIONS defined for the functions.')
+   print(' */')
+   print('')
+   print('#ifndef REPLAY_FUNCTIONS')
+   print_format()
+   print_names(functions)
+   print('')
+   print('#else /* REPLAY_FUNCTIONS */')
+   for f in functions:
+      if f.kind == 'record':
+         print_replay(f)
+   print('')
+   print('')
+   print('typedef void (*replay_func)(struct replay_reader *reader);')
+   print('')
+   print('static const replay_func replay_dispatch[NUM_TRACE_CALL] = {')
+   for f in functions:
+      if f.kind in ('record', 'custom'):
+         print('   replay_%s,' % f.name)
+      else:
+         print('   NULL,  /* %s */' % f.name)
+   print('};')
+   print('')
+   print('#endif /* REPLAY_FUNCTIONS */')
+
+
+def main(argv):
+   mode = 'trace'
+   opts, args = getopt.getopt(argv[1:], 'm:')
+   for o, a in opts:
+      if o == '-m':
+         mode = a
+   path = 'glapitable.h'
+   if args:
+      path = args[0]
+
+   functions = []
+   for line in open(path):
+      m = gl_marshal.LINE_RE.match(line)
+      if m:
+         functions.append(Function(m.group(1), m.group(2), m.group(3),
+                                   m.group(4)))
+
+   if mode == 'trace':
+      print_trace_file(functions)
+   elif mode == 'replay':
+      print_replay_file(functions)
+   else:
+      sys.stderr.write('gl_trace.py: unknown mode %s\n' % mode)
+      sys.exit(1)
+
+
+if __name__ == '__main__':
+   main(sys.argv)
@@ -231,7 +231,7 @@ _glapi_check_multithread(void)
          _glapi_set_dispatch(NULL);
       }
    }
-   else if (!_glapi_get_dispatch()) {
+   else if (!_glthread_GetTSD(&_gl_DispatchTSD)) {
       /* make sure that this thread's dispatch pointer isn't null */
       _glapi_set_dispatch(NULL);
    }
@@ -350,23 +350,33 @@ _glapi_get_dispatch(void)
 /* The code in this file is auto-generated with Python */
 #include "glprocs.h"
 
+/* Perfect hash of the names above, generated by gen_procs_hash.c */
+#include "glprocs_hash.h"
+
 
 /**
  * Search the table of static entrypoint functions for the named function
  * and return the corresponding glprocs_table_t entry.
+ *
+ * The perfect hash maps every static name to its own slot, so only the
+ * entry in that slot needs to be compared.
  */
 static const glprocs_table_t *
 find_entry( const char * n )
 {
-   GLuint i;
+   GLuint h = GLPROCS_HASH_INIT;
+   GLint i;
+   const char * c;
 
-   for (i = 0; static_functions[i].Name_offset >= 0; i++) {
-      const char * test_name;
+   for (c = n; *c; c++) {
+      h = GLPROCS_HASH_STEP(h, *c);
+   }
 
-      test_name = gl_string_table + static_functions[i].Name_offset;
-      if (strcmp(test_name, n) == 0) {
-	 return & static_functions[i];
-      }
+   i = gl_procs_hash[GLPROCS_HASH_SLOT(h,
+                        gl_procs_displacement[GLPROCS_HASH_BUCKET(h)])];
+   if (i >= 0
+       && strcmp(gl_string_table + static_functions[i].Name_offset, n) == 0) {
+      return & static_functions[i];
    }
    return NULL;
 }
@@ -527,6 +537,21 @@ struct _glapi_function {
 static struct _glapi_function ExtEntryTable[MAX_EXTENSION_FUNCS];
 static GLuint NumExtEntryPoints = 0;
 
+/*
+ * Open-addressed hash of the names in ExtEntryTable.  Each slot holds an
+ * index into ExtEntryTable, or -1.  The size must be a power of two
+ * larger than MAX_EXTENSION_FUNCS.
+ */
+#define EXT_ENTRY_HASH_SIZE 512
+static GLshort ExtEntryHash[EXT_ENTRY_HASH_SIZE];
+static GLboolean ExtEntryHashInit = GL_FALSE;
+
+/*
+ * Protects ExtEntryTable, ExtEntryHash and the dynamic dispatch offsets.
+ * The static function tables are constant and need no locking.
+ */
+_glthread_DECLARE_STATIC_MUTEX(ExtEntryMutex);
+
 #ifdef USE_SPARC_ASM
 extern void __glapi_sparc_icache_flush(unsigned int *);
 #endif
@@ -659,6 +684,46 @@ fill_in_entrypoint_offset(_glapi_proc entrypoint, GLuint offset)
 }
 
 
+/**
+ * Return the first ExtEntryHash slot to probe for the named function.
+ */
+static GLuint
+ext_entry_hash( const char * funcName )
+{
+   GLuint h = GLPROCS_HASH_INIT;
+   while (*funcName) {
+      h = GLPROCS_HASH_STEP(h, *funcName);
+      funcName++;
+   }
+   return h & (EXT_ENTRY_HASH_SIZE - 1);
+}
+
+
+/**
+ * Find the named function among the dynamically added functions.
+ * The caller must hold ExtEntryMutex.
+ */
+static struct _glapi_function *
+find_ext_entry( const char * funcName )
+{
+   GLuint slot;
+
+   if (!ExtEntryHashInit) {
+      (void) memset( ExtEntryHash, 0xff, sizeof( ExtEntryHash ) );
+      ExtEntryHashInit = GL_TRUE;
+   }
+
+   for (slot = ext_entry_hash(funcName); ExtEntryHash[slot] >= 0;
+        slot = (slot + 1) & (EXT_ENTRY_HASH_SIZE - 1)) {
+      struct _glapi_function * entry = & ExtEntryTable[ExtEntryHash[slot]];
+      if (strcmp(entry->name, funcName) == 0) {
+	 return entry;
+      }
+   }
+   return NULL;
+}
+
+
 /**
  * Generate new entrypoint
  *
@@ -669,6 +734,8 @@ fill_in_entrypoint_offset(_glapi_proc entrypoint, GLuint offset)
  * 
  * \param funcName  Name of the function to create an entry-point for.
  * 
+ * The caller must hold ExtEntryMutex.
+ *
  * \sa _glapi_add_entrypoint
  */
 
@@ -680,12 +747,22 @@ add_function_name( const char * funcName )
    if (NumExtEntryPoints < MAX_EXTENSION_FUNCS) {
       _glapi_proc entrypoint = generate_entrypoint(~0);
       if (entrypoint != NULL) {
+	 GLuint slot;
+
 	 entry = & ExtEntryTable[NumExtEntryPoints];
 
 	 ExtEntryTable[NumExtEntryPoints].name = str_dup(funcName);
 	 ExtEntryTable[NumExtEntryPoints].parameter_signature = NULL;
 	 ExtEntryTable[NumExtEntryPoints].dispatch_offset = ~0;
 	 ExtEntryTable[NumExtEntryPoints].dispatch_stub = entrypoint;
+
+	 /* find_ext_entry() was called first, so the hash is initialized */
+	 slot = ext_entry_hash(funcName);
+	 while (ExtEntryHash[slot] >= 0) {
+	    slot = (slot + 1) & (EXT_ENTRY_HASH_SIZE - 1);
+	 }
+	 ExtEntryHash[slot] = (GLshort) NumExtEntryPoints;
+
 	 NumExtEntryPoints++;
       }
    }
@@ -751,7 +828,6 @@ _glapi_add_dispatch( const char * const * function_names,
    struct _glapi_function * entry[8];
    GLboolean is_static[8];
    unsigned i;
-   unsigned j;
    int offset = ~0;
    int new_offset;
 
@@ -770,6 +846,12 @@ _glapi_add_dispatch( const char * const * function_names,
       if (!function_names[i] || function_names[i][0] != 'g' || function_names[i][1] != 'l')
 	return GL_FALSE;
 #endif
+   }
+
+
+   _glthread_LOCK_MUTEX(ExtEntryMutex);
+
+   for ( i = 0 ; function_names[i] != NULL ; i++ ) {
    
    
       /* Determine if the named function already exists.  If the function does
@@ -784,6 +866,7 @@ _glapi_add_dispatch( const char * const * function_names,
 	  */
 
 	 if ( (offset != ~0) && (new_offset != offset) ) {
+	    _glthread_UNLOCK_MUTEX(ExtEntryMutex);
 	    return -1;
 	 }
 
@@ -792,27 +875,24 @@ _glapi_add_dispatch( const char * const * function_names,
       }
    
    
-      for ( j = 0 ; j < NumExtEntryPoints ; j++ ) {
-	 if (strcmp(ExtEntryTable[j].name, function_names[i]) == 0) {
-	    /* The offset may be ~0 if the function name was added by
-	     * glXGetProcAddress but never filled in by the driver.
-	     */
-
-	    if (ExtEntryTable[j].dispatch_offset != ~0) {
-	       if (strcmp(real_sig, ExtEntryTable[j].parameter_signature) 
-		   != 0) {
-		  return -1;
-	       }
-
-	       if ( (offset != ~0) && (ExtEntryTable[j].dispatch_offset != offset) ) {
-		  return -1;
-	       }
-
-	       offset = ExtEntryTable[j].dispatch_offset;
+      entry[i] = find_ext_entry( function_names[i] );
+      if (entry[i] != NULL) {
+	 /* The offset may be ~0 if the function name was added by
+	  * glXGetProcAddress but never filled in by the driver.
+	  */
+
+	 if (entry[i]->dispatch_offset != ~0) {
+	    if (strcmp(real_sig, entry[i]->parameter_signature) != 0) {
+	       _glthread_UNLOCK_MUTEX(ExtEntryMutex);
+	       return -1;
+	    }
+
+	    if ( (offset != ~0) && (entry[i]->dispatch_offset != offset) ) {
+	       _glthread_UNLOCK_MUTEX(ExtEntryMutex);
+	       return -1;
 	    }
-	    
-	    entry[i] = & ExtEntryTable[j];
-	    break;
+
+	    offset = entry[i]->dispatch_offset;
 	 }
       }
    }
@@ -831,6 +911,7 @@ _glapi_add_dispatch( const char * const * function_names,
 	    if (entry[i] == NULL) {
 	       /* FIXME: Possible memory leak here.
 		*/
+	       _glthread_UNLOCK_MUTEX(ExtEntryMutex);
 	       return -1;
 	    }
 	 }
@@ -841,6 +922,8 @@ _glapi_add_dispatch( const char * const * function_names,
 	 entry[i]->dispatch_offset = offset;
       }
    }
+
+   _glthread_UNLOCK_MUTEX(ExtEntryMutex);
    
    return offset;
 }
@@ -852,16 +935,20 @@ _glapi_add_dispatch( const char * const * function_names,
 PUBLIC GLint
 _glapi_get_proc_offset(const char *funcName)
 {
-   /* search extension functions first */
-   GLuint i;
-   for (i = 0; i < NumExtEntryPoints; i++) {
-      if (strcmp(ExtEntryTable[i].name, funcName) == 0) {
-         return ExtEntryTable[i].dispatch_offset;
-      }
-   }
-
-   /* search static functions */
-   return get_static_proc_offset(funcName);
+   struct _glapi_function * entry;
+   GLint offset;
+
+   /* search static functions first, they can't be added dynamically */
+   offset = get_static_proc_offset(funcName);
+   if (offset >= 0)
+      return offset;
+
+   /* search extension functions */
+   _glthread_LOCK_MUTEX(ExtEntryMutex);
+   entry = find_ext_entry(funcName);
+   offset = (entry == NULL) ? -1 : (GLint) entry->dispatch_offset;
+   _glthread_UNLOCK_MUTEX(ExtEntryMutex);
+   return offset;
 }
 
 
@@ -875,7 +962,6 @@ _glapi_proc
 _glapi_get_proc_address(const char *funcName)
 {
    struct _glapi_function * entry;
-   GLuint i;
 
 #ifdef MANGLE
    if (funcName[0] != 'm' || funcName[1] != 'g' || funcName[2] != 'l')
@@ -885,15 +971,8 @@ _glapi_get_proc_address(const char *funcName)
       return NULL;
 #endif
 
-   /* search extension functions first */
-   for (i = 0; i < NumExtEntryPoints; i++) {
-      if (strcmp(ExtEntryTable[i].name, funcName) == 0) {
-         return ExtEntryTable[i].dispatch_stub;
-      }
-   }
-
 #if !defined( XFree86Server )
-   /* search static functions */
+   /* search static functions first, without taking the lock */
    {
       const _glapi_proc func = get_static_proc_address(funcName);
       if (func)
@@ -901,7 +980,13 @@ _glapi_get_proc_address(const char *funcName)
    }
 #endif /* !defined( XFree86Server ) */
 
-   entry = add_function_name(funcName);
+   /* search extension functions, adding a new stub if not found */
+   _glthread_LOCK_MUTEX(ExtEntryMutex);
+   entry = find_ext_entry(funcName);
+   if (entry == NULL) {
+      entry = add_function_name(funcName);
+   }
+   _glthread_UNLOCK_MUTEX(ExtEntryMutex);
    return (entry == NULL) ? NULL : entry->dispatch_stub;
 }
 
@@ -924,12 +1009,16 @@ _glapi_get_proc_name(GLuint offset)
    }
 
    /* search added extension functions */
+   n = NULL;
+   _glthread_LOCK_MUTEX(ExtEntryMutex);
    for (i = 0; i < NumExtEntryPoints; i++) {
       if (ExtEntryTable[i].dispatch_offset == offset) {
-         return ExtEntryTable[i].name;
+         n = ExtEntryTable[i].name;
+         break;
       }
    }
-   return NULL;
+   _glthread_UNLOCK_MUTEX(ExtEntryMutex);
+   return n;
 }
 
 
@@ -961,6 +1050,14 @@ _glapi_check_table(const struct _glapi_table *table)
       assert(tab[i]);
    }
 
+   /* Make sure glprocs_hash.h was regenerated along with glprocs.h */
+   assert(sizeof(static_functions) / sizeof(static_functions[0])
+          == GLPROCS_HASH_NUM_FUNCTIONS + 1);
+   for (i = 0; static_functions[i].Name_offset >= 0; i++) {
+      assert(find_entry(gl_string_table + static_functions[i].Name_offset)
+             == & static_functions[i]);
+   }
+
    /* Do some spot checks to be sure that the dispatch table
     * slots are assigned correctly.
     */
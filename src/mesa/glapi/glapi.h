@@ -46,6 +46,7 @@
 
 
 #include "GL/gl.h"
+#include "glthread.h"
 #include "glapitable.h"
 
 typedef void (*_glapi_warning_func)(void *ctx, const char *str, ...);
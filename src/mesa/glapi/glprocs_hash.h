@@ -0,0 +1,241 @@
+/* DO NOT EDIT - This file generated automatically by gen_procs_hash.c */
+
+/* This file is only included by glapi.c.  It is a perfect hash of the
+ * names in glprocs.h and must be regenerated along with it.
+ */
+
+#define GLPROCS_HASH_NUM_FUNCTIONS 994
+#define GLPROCS_HASH_INIT        2166136261u
+#define GLPROCS_HASH_STEP(h, c)  (((h) ^ (GLubyte) (c)) * 16777619u)
+#define GLPROCS_HASH_BUCKET(h)   ((h) & (512 - 1))
+#define GLPROCS_HASH_SLOT(h, d)  ((((h) ^ (d)) * 2654435761u) >> (32 - 11))
+
+static const GLubyte gl_procs_displacement[512] = {
+     0,   1,   1,   0,   0,   0,   5,   0,   0,   1,
+     0,   0,   0,   3,   1,   0,   4,   1,   2,   0,
+     0,   0,   1,   3,   1,   0,   1,   0,   0,   1,
+     0,   0,   0,   0,   3,   0,   0,   0,   0,   0,
+     0,   0,   1,   0,   2,   1,   0,   0,   0,   1,
+     0,   0,   0,   2,   0,   0,   0,   0,   0,   1,
+     0,   0,   1,   2,   0,   0,   0,   0,   1,   0,
+     0,   0,   0,   0,   0,   2,   7,   0,   0,   4,
+     0,   4,   2,   1,   0,   0,   0,   0,   0,   0,
+     0,   0,   0,   1,   1,   1,   2,   0,   1,   3,
+     0,   0,   0,   0,   2,   3,   1,   3,   1,   1,
+     1,   0,   0,   0,   0,   2,   0,   0,   0,   2,
+     0,   0,   0,   0,   0,   0,   0,   0,   0,   2,
+     0,   0,   0,   0,   0,   1,   0,   1,   1,   2,
+     0,   1,   0,   0,   0,   0,   3,   0,   0,   1,
+     0,   3,   3,   0,   0,   0,   0,   3,   0,   0,
+     0,   0,   0,   0,   0,   0,   0,   1,   0,   4,
+     4,   0,   0,   0,   0,   3,   0,   4,   2,   0,
+     0,   1,   0,   0,   3,   0,   0,   1,   0,   2,
+     0,   2,   1,   0,   0,   0,   0,   1,   0,   2,
+     0,   1,   0,   6,   1,   1,   1,   1,   1,   0,
+     0,   0,   1,   0,   0,   2,   1,   1,   0,   0,
+     0,   0,   3,   0,   4,   3,   0,   0,   0,   0,
+     0,   0,   3,   0,   0,   2,   4,   1,   0,   0,
+     0,   0,   0,   1,   0,   0,   0,   0,   0,   0,
+     0,   0,   0,   0,   4,   2,   1,   0,   1,   2,
+     2,   0,   1,   5,   0,   0,   0,   1,   2,   0,
+     0,   1,   0,   0,   2,   0,   0,   0,   3,   0,
+     0,   3,   2,   0,   0,   1,   2,   2,   1,   2,
+     3,   0,   0,   1,   1,   2,   1,   0,   1,   0,
+     5,   0,   1,   0,   0,   0,   2,   0,   0,   0,
+     1,   0,   5,   0,   2,   0,   0,   0,   7,   3,
+     0,   1,   1,   0,   0,   1,   0,   0,   3,   0,
+     2,   3,   0,   2,   0,   2,   0,   1,   3,   0,
+     0,   5,   2,   5,   0,   0,   4,   0,   0,   0,
+     0,   0,   0,   0,   1,   2,  13,   0,   0,   1,
+     0,   0,   0,   6,   1,   0,   0,   1,   0,   2,
+     1,   2,   0,   0,   0,   0,   0,   3,   3,   1,
+     0,   0,   1,   1,   0,   6,   3,   2,   0,   0,
+     0,   0,   0,   3,   0,   0,   2,   1,   1,   0,
+     0,   2,   2,   0,   2,   1,   0,   0,   4,   0,
+     0,   0,   3,   1,   1,   0,   2,   0,   1,   1,
+     1,   0,   1,   0,   0,   0,   0,   0,   3,   0,
+     1,   0,   1,   0,   0,   2,   0,   0,   0,   0,
+     0,   2,   0,   1,   2,   1,   2,   0,   0,   0,
+     1,   0,   0,   0,   2,   5,   0,   1,   6,   2,
+     0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+     0,   2,   0,   2,   0,   1,   0,   1,   5,   0,
+     0,   0,   0,   1,   3,   0,   0,   0,   7,   6,
+     2,   3,   0,   0,   0,   0,   0,   0,   0,   1,
+     0,   0,   0,   0,   0,   1,   0,   2,   3,   2,
+     1,  18,
+};
+
+/* index into static_functions, or -1 */
+static const GLshort gl_procs_hash[2048] = {
+     -1,   -1,   -1,  919,  786,   -1,   -1,  974,  945,   92,   -1,   -1,
+    311,  479,   -1,   -1,   -1,  128,   -1,  789,   -1,  308,  272,  661,
+    439,   -1,   -1,   -1,  333,   52,  906,   -1,   -1,  918,   -1,  775,
+     -1,  734,  157,  231,   -1,   -1,  952,   -1,   -1,  961,   -1,   -1,
+     -1,  696,  652,  699,   -1,  389,  471,   -1,   -1,   -1,   -1,   -1,
+    120,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  792,   -1,
+    805,  596,   -1,   24,   -1,  410,   -1,   -1,  983,   -1,  496,   -1,
+     -1,   -1,   -1,   -1,  409,  469,   -1,   -1,   -1,   -1,  327,   -1,
+     -1,   -1,   47,  729,  160,  793,   -1,  523,   -1,   -1,  698,   -1,
+     -1,  198,   -1,  687,   78,  233,   72,  249,   -1,  948,   -1,   -1,
+     -1,   -1,  935,   -1,   -1,   -1,  387,   -1,  719,   -1,  499,  418,
+    411,   60,   -1,   -1,   -1,   -1,   -1,  394,   12,  920,  292,  315,
+     -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  943,   -1,   -1,  708,
+    379,  625,  331,  669,  947,   -1,  291,  790,  461,   -1,   -1,  464,
+    701,   -1,   -1,  898,  155,  295,  724,  610,   -1,   -1,  851,  220,
+    626,    6,  875,   -1,   -1,   -1,   -1,   -1,   -1,  940,  916,  897,
+     -1,  158,   -1,  753,   -1,  119,   -1,   -1,   -1,   -1,   -1,  346,
+    670,  951,   -1,   42,  436,   26,  298,   -1,   -1,  946,  967,  769,
+     -1,   -1,   -1,   -1,   -1,  968,  405,  351,  312,  303,  237,   -1,
+     -1,  478,  649,   -1,   -1,   -1,  812,   -1,   -1,   -1,   -1,  620,
+     -1,   -1,  421,   -1,  705,   35,   -1,   -1,   -1,  838,  218,  861,
+    473,   -1,  568,   -1,   -1,  614,   -1,  990,   -1,  316,   -1,   96,
+    365,   -1,  899,   -1,   -1,   -1,   -1,  422,   -1,   -1,  912,  803,
+     77,   -1,   -1,   -1,  493,  359,   64,  406,  877,   -1,  876,   -1,
+     85,   -1,  216,  690,   -1,   -1,   -1,  150,  783,  136,   -1,   -1,
+     99,   -1,   -1,  892,  829,  169,  332,  604,  655,   -1,   -1,  252,
+    733,  807,   -1,  887,   -1,   -1,  767,  510,  166,   -1,  637,   -1,
+     -1,   -1,  423,  522,  170,   -1,   -1,   -1,  179,   -1,   86,   -1,
+    443,   -1,   -1,  777,  656,   -1,   -1,   -1,  263,  751,  481,  300,
+     -1,   -1,   -1,  347,   -1,   -1,  978,   -1,  455,    1,  752,  524,
+     -1,  130,   -1,   -1,  453,  762,   -1,   -1,  350,  806,  171,   -1,
+    749,  638,   -1,  840,  754,  450,    2,  531,  420,  340,   -1,   -1,
+    221,  222,  683,  678,   -1,  513,  630,   21,  497,  151,   -1,   -1,
+     46,  985,   -1,   -1,  142,  115,  987,   -1,  554,   -1,   -1,  168,
+     -1,  629,  349,   67,   -1,   -1,   -1,  862,  412,   -1,   -1,  517,
+     -1,   -1,   -1,   -1,  902,  403,   -1,   -1,  251,   -1,    7,  903,
+     -1,  776,  868,   -1,   -1,  138,  556,   -1,   -1,  668,  474,   -1,
+    778,   -1,   -1,  229,  923,   -1,   -1,  483,   -1,   -1,  795,  725,
+    628,   -1,   -1,   -1,   -1,  476,   -1,   -1,   -1,  758,  544,   -1,
+     -1,   -1,  646,   -1,   -1,   -1,   -1,   -1,  607,  424,  502,   -1,
+    609,   -1,   -1,  430,   -1,   -1,  235,  139,   -1,  208,  939,   -1,
+     -1,   22,  306,   -1,  266,  408,   -1,  253,   -1,  131,  574,  309,
+    730,   -1,  427,  512,  477,   -1,   -1,  929,  113,   -1,   -1,   -1,
+     -1,  808,   -1,  957,   -1,   23,   -1,  921,  195,   -1,  264,   -1,
+     -1,   -1,  336,   -1,  814,   -1,   -1,  562,  194,  305,  884,  647,
+     -1,    0,   -1,   -1,  516,   -1,   -1,   -1,   -1,   -1,  448,  397,
+     -1,  798,  618,   -1,   -1,   -1,   -1,   -1,  535,   58,  842,  748,
+     -1,  407,  756,  140,  509,   -1,   -1,  116,   -1,  927,  765,   -1,
+     -1,  386,  435,  677,  529,   -1,  281,  274,  224,   -1,   -1,   -1,
+     -1,   -1,  204,   -1,   -1,   -1,  485,  126,  186,   -1,   -1,  976,
+    937,   -1,   -1,  822,  129,  809,   -1,   -1,   -1,  636,  689,  857,
+     -1,  310,   -1,  329,   -1,   28,   51,  839,  492,   -1,  290,  248,
+    202,   -1,  727,  296,  446,  881,  635,   -1,  459,   -1,   -1,   -1,
+     -1,  388,  973,  651,  605,   -1,   -1,  549,   -1,   -1,   73,   -1,
+     -1,  257,   -1,   -1,   -1,  594,   -1,  338,  475,   45,   27,  178,
+    642,  356,   -1,  800,   37,   91,  743,   -1,   -1,   -1,   -1,   -1,
+    907,   -1,   -1,  772,   71,  528,   -1,  465,   -1,   -1,  288,  261,
+    585,   -1,   -1,  650,  488,   -1,  611,  330,  215,  971,  942,  536,
+    787,  472,  643,   -1,   -1,   -1,   -1,   -1,  872,   -1,   -1,   -1,
+    615,   -1,   -1,   -1,   -1,   -1,  595,   -1,   -1,   -1,   -1,   -1,
+     -1,  836,  848,  891,  314,  344,   -1,   -1,   -1,   -1,  720,   -1,
+     -1,   -1,   -1,   -1,  557,   -1,  616,   -1,   -1,  540,   -1,  569,
+    623,   20,   -1,  174,  102,  613,  666,   -1,   -1,   25,  575,   -1,
+    837,   -1,   -1,   -1,  740,  735,   -1,  495,   -1,  207,  810,   -1,
+     -1,  213,  879,  184,   -1,   -1,   -1,  145,   -1,  573,  122,   -1,
+     -1,   -1,   -1,   -1,   -1,   -1,   -1,  925,  438,  584,   -1,   -1,
+    480,  741,   -1,  981,   -1,  360,   -1,  287,  134,  718,   -1,  784,
+     38,  230,  205,   -1,   -1,  527,  542,  580,  712,  571,   -1,   -1,
+    717,   -1,  343,  546,   -1,  547,   -1,   -1,   -1,  878,   -1,   -1,
+     -1,   -1,   -1,   74,   39,  675,  631,  844,   -1,   -1,   -1,   -1,
+     -1,  110,   -1,  442,   -1,   -1,   -1,   -1,  963,   68,   -1,   -1,
+     -1,   -1,  173,  601,   41,   -1,   -1,  289,  707,  845,  452,  370,
+     -1,  852,   -1,   -1,   -1,   -1,  372,   -1,  913,   -1,  278,   -1,
+     -1,   -1,   -1,  501,  676,  352,   -1,  206,  567,  519,   -1,  219,
+     -1,  458,   -1,   -1,   -1,  197,  938,  706,   -1,   -1,   -1,   11,
+    660,   -1,   -1,   -1,   -1,   -1,  520,  124,  354,   -1,  582,   -1,
+    680,   -1,   17,   -1,   -1,   -1,   -1,  944,   -1,   -1,  794,   -1,
+     59,   -1,  745,   -1,   -1,   -1,   -1,   -1,   -1,  854,   -1,  398,
+    815,  592,  757,  362,   -1,   -1,   -1,   -1,   -1,   -1,  203,   -1,
+     -1,   -1,   40,   -1,  104,  664,  860,   -1,   -1,  882,   -1,  561,
+    377,  984,  199,   -1,  236,   -1,   -1,   -1,   -1,   -1,  384,   -1,
+     -1,  977,   -1,  234,  986,   -1,  993,   66,  515,   -1,   53,   -1,
+    444,  859,   -1,   -1,   -1,  911,  500,  143,  914,   -1,   -1,   -1,
+     -1,   -1,  371,  538,  400,   -1,  673,   -1,   -1,  771,  176,  682,
+     -1,   -1,  270,   -1,  240,  737,  553,   -1,  200,   -1,  759,  486,
+     -1,  726,   -1,   -1,  285,   -1,   57,  820,   34,  950,   -1,  286,
+     -1,   -1,   -1,   -1,   -1,   -1,  657,   48,   -1,  888,   -1,   -1,
+     62,  598,  982,  307,   -1,  597,   -1,   -1,   -1,   -1,   -1,  121,
+    893,   -1,   -1,  791,   -1,  871,  334,  320,   -1,  489,  161,  415,
+    843,  835,    3,  692,   -1,  846,   -1,   -1,   -1,  217,  559,  468,
+     -1,   -1,  979,  965,  970,  926,   -1,   -1,  688,   -1,    4,   -1,
+     -1,   -1,   -1,  917,   -1,  654,  936,  779,   70,   -1,  414,  123,
+     -1,   -1,   -1,  581,   84,   19,   98,  114,   -1,   -1,  909,   -1,
+    811,  277,   -1,  774,  276,  152,   -1,  324,  402,   -1,   -1,   -1,
+    260,   -1,  715,  545,   -1,  506,   -1,   -1,   -1,   -1,  932,   -1,
+     -1,  282,   -1,  383,   43,   -1,   -1,  640,  250,   -1,  426,  433,
+     -1,   -1,  619,  466,  645,   -1,   -1,  185,   -1,   -1,  799,   -1,
+     -1,  731,   -1,   -1,  482,  896,   -1,  686,   -1,   -1,   -1,   -1,
+     -1,  454,  667,  565,   -1,   -1,   -1,  543,   81,   -1,   -1,  107,
+     -1,  109,   -1,  577,   -1,  709,   -1,  490,   -1,   -1,   -1,   -1,
+     -1,   -1,  101,  302,   -1,  548,  831,  367,   -1,   -1,   -1,   -1,
+     -1,   -1,   -1,  863,  539,  181,  742,   -1,  111,  163,  933,  189,
+    873,   -1,   -1,  658,   -1,  484,  401,   -1,   -1,   -1,  283,   -1,
+     -1,  342,  744,   -1,   -1,   -1,   -1,   -1,  242,   -1,   -1,  376,
+     -1,   -1,  832,   -1,   -1,   -1,   -1,  364,   -1,   -1,  796,   -1,
+     -1,  106,   -1,  770,   -1,  341,  591,   -1,  694,  313,  192,   -1,
+    317,   -1,  905,  507,   -1,   -1,   -1,  966,   -1,  864,  419,  279,
+    928,  964,    5,   -1,   -1,  532,   -1,   -1,  395,  326,   -1,   -1,
+    135,   -1,   -1,   -1,  361,  180,   -1,   -1,  955,   -1,  210,   -1,
+     -1,   -1,   -1,  429,   -1,  691,  268,  648,   -1,   -1,   -1,   -1,
+     -1,  175,  280,   -1,   -1,   -1,   -1,  989,  345,   -1,   14,  375,
+    462,  299,  141,  722,  617,   -1,  428,   -1,   -1,  551,  804,  508,
+     -1,   -1,   -1,   -1,  855,  256,   -1,  608,   -1,  641,   -1,  915,
+    504,   -1,  849,  750,  558,   -1,   -1,  149,   -1,  363,  390,   -1,
+     -1,   -1,   -1,  449,  223,  634,   -1,   -1,   -1,   -1,   -1,   -1,
+     -1,   -1,   -1,   -1,   -1,   -1,  225,   -1,   -1,   -1,   -1,  802,
+     50,  885,  214,   88,   -1,  830,   -1,   55,   -1,  265,   -1,   -1,
+     -1,   -1,  451,  271,  301,   -1,   -1,   -1,   15,   -1,   -1,  247,
+    254,   -1,   -1,   -1,   -1,  684,  373,  679,   -1,  828,   -1,   -1,
+     61,  153,   87,  576,   -1,   -1,  437,  541,   -1,   -1,   -1,  191,
+    761,  883,  378,   -1,   76,   -1,   -1,   -1,  337,   -1,   -1,   -1,
+     -1,  816,   -1,   -1,   -1,  445,   -1,   -1,   -1,  144,   -1,   54,
+    100,  392,   49,   -1,  162,   -1,   -1,  621,   -1,  209,  262,   -1,
+     75,  525,   -1,  232,  117,   -1,  587,   56,  246,  259,   -1,   -1,
+    988,   -1,  934,   -1,   -1,  494,   -1,   -1,   -1,   -1,   -1,  212,
+    369,   -1,  785,  505,  534,  159,   -1,   -1,   -1,   -1,   -1,   -1,
+     -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,   -1,  211,   -1,
+     -1,   -1,  847,  969,  503,  572,   -1,   -1,  238,   -1,   -1,   -1,
+     -1,   -1,   36,  550,   -1,   -1,   -1,   -1,   -1,  850,  172,   -1,
+    518,  602,   -1,  603,  431,   -1,  182,   -1,   -1,   -1,   -1,  105,
+    866,  552,  148,  704,  434,  869,   -1,   -1,   -1,  328,   -1,   -1,
+    226,  788,   -1,   -1,   -1,   -1,  922,  900,  335,  747,  763,   -1,
+     -1,   -1,  244,   -1,  348,   -1,  958,   -1,   -1,   79,  440,   -1,
+     -1,   -1,   -1,   -1,   -1,   -1,  177,   -1,  380,   -1,  201,   -1,
+     -1,  432,   -1,  321,   -1,   -1,   97,  358,   -1,   -1,   -1,   -1,
+     -1,   -1,   -1,  639,   -1,   -1,   -1,  644,   -1,  297,   -1,   -1,
+     -1,   -1,  103,  991,   -1,  797,   -1,  685,   -1,  154,  467,   -1,
+    870,   29,  599,  600,   82,   -1,  780,  241,   -1,  674,   -1,  323,
+     -1,   80,   -1,   -1,   -1,   -1,    9,  357,   -1,   -1,  841,   -1,
+    764,  980,  895,  167,  245,   -1,   -1,  714,  853,  511,   -1,  865,
+     -1,   -1,   -1,  255,   -1,  702,   -1,   -1,   -1,   -1,   -1,  874,
+    391,  456,   -1,  537,  586,   -1,  930,  193,   -1,   -1,   -1,   -1,
+    693,  695,  239,  856,   -1,  417,  890,  773,   -1,  284,   -1,   -1,
+    514,   -1,  294,   -1,  133,  413,  588,   -1,  833,  368,   -1,  322,
+     -1,   33,  960,  146,  470,   -1,  590,  187,  716,   -1,  498,   -1,
+     -1,   -1,   18,   93,   -1,   -1,  908,   -1,  355,  697,   -1,   -1,
+    156,   -1,   -1,  381,  824,   -1,   -1,  127,  183,   -1,  817,   -1,
+    721,   -1,   -1,  659,   95,   -1,   -1,   -1,   -1,  273,   -1,   -1,
+     -1,  227,   -1,   -1,   -1,  147,  713,   -1,   -1,   -1,  962,  663,
+    627,   -1,  672,  275,  228,   -1,  941,  132,   -1,  325,  755,  374,
+    108,  858,   -1,   -1,   -1,    8,   -1,   -1,   94,   -1,   -1,   -1,
+     -1,   -1,   90,   -1,  399,  826,   -1,  188,  738,   -1,   -1,   -1,
+     -1,   -1,  258,  711,   -1,  118,   -1,  382,   -1,   -1,   -1,   -1,
+     -1,  760,   -1,  190,   -1,   -1,   -1,   -1,   -1,  825,   -1,   -1,
+    404,   -1,  728,   -1,   -1,   -1,  293,  137,   32,   -1,   -1,   31,
+    766,  425,  665,   -1,  801,   -1,  393,   -1,   -1,   -1,   -1,   -1,
+    521,  739,   -1,   -1,  563,  463,   -1,  813,   -1,  560,   -1,   -1,
+    304,  416,   13,   -1,   -1,  949,   -1,   -1,  457,   -1,  566,   -1,
+     -1,   -1,  746,   -1,  904,   -1,  112,  589,  910,   -1,   -1,   -1,
+    579,  975,  555,  396,   -1,   -1,   -1,  353,   -1,   -1,  533,  165,
+     -1,  732,   30,  633,  953,   -1,   -1,   -1,  662,   69,   -1,   -1,
+     -1,   -1,   -1,  992,  339,  570,   -1,   -1,  723,   44,  164,   -1,
+     -1,   -1,  867,  318,   -1,  768,  125,   -1,   -1,  243,   -1,   -1,
+    366,  901,  606,   -1,  653,  821,  823,  781,  530,  924,  931,  196,
+     -1,  703,  956,   -1,   10,   -1,  818,   -1,   -1,  441,  526,  564,
+     -1,   -1,  736,   -1,  460,   -1,   -1,  487,   89,   -1,  583,   -1,
+    593,   -1,   -1,   -1,   -1,   -1,   -1,  671,  578,  972,   63,  632,
+     -1,   -1,  710,  622,  491,  959,  681,  319,  819,   -1,   -1,  782,
+     -1,   -1,  880,  385,   -1,  624,   -1,  827,   -1,   -1,  954,   -1,
+    889,  267,  700,  894,   65,   -1,   -1,  612,   -1,  447,   16,  834,
+     83,   -1,   -1,  269,  886,   -1,   -1,   -1,
+};
@@ -46,6 +46,17 @@
  *   _glthread_LOCK_MUTEX(name)             Lock a mutex
  *   _glthread_UNLOCK_MUTEX(name)           Unlock a mutex
  *
+ * With POSIX threads, WORKER_THREADS is also defined and these are
+ * available for code that wants to run work on helper threads:
+ *   _glthread_Cond                         Condition variable type
+ *   _glthread_INIT_COND(name)              Initialize a condition variable
+ *   _glthread_DESTROY_COND(name)           Destroy a condition variable
+ *   _glthread_WAIT_COND(name, mutex)       Wait on a condition variable
+ *   _glthread_SIGNAL_COND(name)            Wake one waiter
+ *   _glthread_BROADCAST_COND(name)         Wake all waiters
+ *   _glthread_CREATE_THREAD(t, func, arg)  Start a thread, true on success
+ *   _glthread_JOIN_THREAD(t)               Wait for a thread to exit
+ *
  * Functions:
  *   _glthread_GetID(v)      Get integer thread ID
  *   _glthread_InitTSD()     Initialize thread-specific data
@@ -110,6 +121,31 @@ typedef pthread_mutex_t _glthread_Mutex;
 #define _glthread_UNLOCK_MUTEX(name) \
    (void) pthread_mutex_unlock(&(name))
 
+#define WORKER_THREADS
+
+typedef pthread_cond_t _glthread_Cond;
+
+#define _glthread_INIT_COND(name) \
+   pthread_cond_init(&(name), NULL)
+
+#define _glthread_DESTROY_COND(name) \
+   pthread_cond_destroy(&(name))
+
+#define _glthread_WAIT_COND(name, mutex) \
+   (void) pthread_cond_wait(&(name), &(mutex))
+
+#define _glthread_SIGNAL_COND(name) \
+   (void) pthread_cond_signal(&(name))
+
+#define _glthread_BROADCAST_COND(name) \
+   (void) pthread_cond_broadcast(&(name))
+
+#define _glthread_CREATE_THREAD(thread, func, arg) \
+   (pthread_create(&(thread), NULL, func, arg) == 0)
+
+#define _glthread_JOIN_THREAD(thread) \
+   (void) pthread_join(thread, NULL)
+
 #endif /* PTHREADS */
 
 
@@ -28,6 +28,7 @@
 
 #include "glheader.h"
 #include "api_arrayelt.h"
+#include "bufferobj.h"
 #include "context.h"
 #include "glapi.h"
 #include "imports.h"
@@ -773,16 +774,18 @@ void GLAPIENTRY _ae_loopback_array_elt( GLint elt )
 
    /* generic attributes */
    for (at = actx->attribs; at->func; at++) {
-      const GLubyte *src
-         = ADD_POINTERS(at->array->BufferObj->Data, at->array->Ptr)
+      const GLubyte *src;
+      _mesa_wait_buffer_object(at->array->BufferObj);
+      src = ADD_POINTERS(at->array->BufferObj->Data, at->array->Ptr)
          + elt * at->array->StrideB;
       at->func( at->index, src );
    }
 
    /* conventional arrays */
    for (aa = actx->arrays; aa->offset != -1 ; aa++) {
-      const GLubyte *src
-         = ADD_POINTERS(aa->array->BufferObj->Data, aa->array->Ptr)
+      const GLubyte *src;
+      _mesa_wait_buffer_object(aa->array->BufferObj);
+      src = ADD_POINTERS(aa->array->BufferObj->Data, aa->array->Ptr)
          + elt * aa->array->StrideB;
       CALL_by_offset( disp, (array_func), aa->offset, 
 		      ((const void *) src) );
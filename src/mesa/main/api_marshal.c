@@ -0,0 +1,597 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * \file api_marshal.c
+ * Execution of GL commands on a worker thread.
+ *
+ * A context set up with _mesa_marshal_init() gets a thread of its own.
+ * While the context is current, the application's thread dispatches to
+ * the marshalling table instead of ctx->CurrentDispatch.  Its functions,
+ * generated into api_marshal_tmp.h by glapi/gl_marshal.py, just copy the
+ * command and its parameters into a batch buffer.  Full batches go to the
+ * worker thread, which calls the real functions, so state validation,
+ * T&L and rasterization overlap with the application's own work.
+ *
+ * Functions which return a value or read client memory of unknown size
+ * (glGet*, glReadPixels, glTexImage*, vertex arrays, ...) are synchronous:
+ * they wait for the worker to execute everything recorded so far and then
+ * call the real function on the application's thread.  So do glFinish and
+ * the driver entrypoints which call _mesa_marshal_finish().
+ */
+
+
+#include "glheader.h"
+#include "api_marshal.h"
+#include "context.h"
+#include "dispatch.h"
+#include "glapi.h"
+#include "glthread.h"
+#include "imports.h"
+#include "macros.h"
+#include "mtypes.h"
+
+
+/*
+ * Number of elements in the array parameter of the pname-dependent state
+ * functions, or 0 if the pname isn't known here.  Also used by
+ * api_trace.c.
+ */
+
+GLuint
+_mesa_material_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_AMBIENT:
+   case GL_DIFFUSE:
+   case GL_SPECULAR:
+   case GL_EMISSION:
+   case GL_AMBIENT_AND_DIFFUSE:
+      return 4;
+   case GL_COLOR_INDEXES:
+      return 3;
+   case GL_SHININESS:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+
+GLuint
+_mesa_light_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_AMBIENT:
+   case GL_DIFFUSE:
+   case GL_SPECULAR:
+   case GL_POSITION:
+      return 4;
+   case GL_SPOT_DIRECTION:
+      return 3;
+   case GL_SPOT_EXPONENT:
+   case GL_SPOT_CUTOFF:
+   case GL_CONSTANT_ATTENUATION:
+   case GL_LINEAR_ATTENUATION:
+   case GL_QUADRATIC_ATTENUATION:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+
+GLuint
+_mesa_light_model_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_LIGHT_MODEL_AMBIENT:
+      return 4;
+   case GL_LIGHT_MODEL_LOCAL_VIEWER:
+   case GL_LIGHT_MODEL_TWO_SIDE:
+   case GL_LIGHT_MODEL_COLOR_CONTROL:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+
+GLuint
+_mesa_fog_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_FOG_COLOR:
+      return 4;
+   case GL_FOG_MODE:
+   case GL_FOG_DENSITY:
+   case GL_FOG_START:
+   case GL_FOG_END:
+   case GL_FOG_INDEX:
+   case GL_FOG_COORDINATE_SOURCE_EXT:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+
+GLuint
+_mesa_tex_env_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_TEXTURE_ENV_COLOR:
+      return 4;
+   case GL_TEXTURE_ENV_MODE:
+   case GL_COMBINE_RGB:
+   case GL_COMBINE_ALPHA:
+   case GL_SOURCE0_RGB:
+   case GL_SOURCE1_RGB:
+   case GL_SOURCE2_RGB:
+   case GL_SOURCE0_ALPHA:
+   case GL_SOURCE1_ALPHA:
+   case GL_SOURCE2_ALPHA:
+   case GL_OPERAND0_RGB:
+   case GL_OPERAND1_RGB:
+   case GL_OPERAND2_RGB:
+   case GL_OPERAND0_ALPHA:
+   case GL_OPERAND1_ALPHA:
+   case GL_OPERAND2_ALPHA:
+   case GL_RGB_SCALE:
+   case GL_ALPHA_SCALE:
+   case GL_TEXTURE_LOD_BIAS:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+
+GLuint
+_mesa_tex_parameter_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_TEXTURE_BORDER_COLOR:
+      return 4;
+   case GL_TEXTURE_MIN_FILTER:
+   case GL_TEXTURE_MAG_FILTER:
+   case GL_TEXTURE_WRAP_S:
+   case GL_TEXTURE_WRAP_T:
+   case GL_TEXTURE_WRAP_R:
+   case GL_TEXTURE_MIN_LOD:
+   case GL_TEXTURE_MAX_LOD:
+   case GL_TEXTURE_BASE_LEVEL:
+   case GL_TEXTURE_MAX_LEVEL:
+   case GL_TEXTURE_PRIORITY:
+   case GL_TEXTURE_MAX_ANISOTROPY_EXT:
+   case GL_TEXTURE_COMPARE_SGIX:
+   case GL_TEXTURE_COMPARE_OPERATOR_SGIX:
+   case GL_SHADOW_AMBIENT_SGIX:
+   case GL_GENERATE_MIPMAP_SGIS:
+   case GL_TEXTURE_COMPARE_MODE_ARB:
+   case GL_TEXTURE_COMPARE_FUNC_ARB:
+   case GL_DEPTH_TEXTURE_MODE_ARB:
+   case GL_TEXTURE_LOD_BIAS:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+
+GLuint
+_mesa_tex_gen_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_OBJECT_PLANE:
+   case GL_EYE_PLANE:
+      return 4;
+   case GL_TEXTURE_GEN_MODE:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+
+#ifdef WORKER_THREADS
+
+
+#define MARSHAL_BATCH_SIZE (32 * 1024)  /**< bytes per batch */
+#define MARSHAL_BATCHES    4            /**< batches in the ring */
+
+
+/**
+ * Header of every recorded command.  Commands are padded to a multiple
+ * of 8 bytes so that the doubles in the next one are aligned.
+ */
+struct marshal_cmd_base {
+   GLushort cmd_id;     /**< enum marshal_cmd_id */
+   GLushort cmd_size;   /**< bytes, including this header */
+};
+
+
+struct marshal_batch {
+   GLubyte *Buffer;
+   GLuint Used;         /**< bytes recorded */
+};
+
+
+struct gl_marshal_context {
+   GLcontext *ctx;
+
+   /** The ring of batches; Fill is the one being recorded. */
+   struct marshal_batch Batch[MARSHAL_BATCHES];
+   GLuint Fill;
+
+   /* Protected by Mutex; Cond is broadcast whenever these change. */
+   GLuint Submitted;    /**< batches handed to the worker so far */
+   GLuint Executed;     /**< batches the worker has finished */
+   GLboolean Started;
+   GLboolean Quit;
+
+   _glthread_Mutex Mutex;
+   _glthread_Cond Cond;
+   _glthread_Thread Thread;
+   unsigned long ThreadID;
+};
+
+
+/** The marshalling dispatch table, shared by all contexts */
+static struct _glapi_table *MarshalTable = NULL;
+_glthread_DECLARE_STATIC_MUTEX(MarshalTableMutex);
+
+
+/**
+ * Hand the batch being recorded to the worker and start the next one.
+ * Blocks while all the other batches are still queued.
+ */
+static void
+marshal_submit( struct gl_marshal_context *m )
+{
+   _glthread_LOCK_MUTEX(m->Mutex);
+   m->Submitted++;
+   _glthread_BROADCAST_COND(m->Cond);
+   while (m->Submitted - m->Executed >= MARSHAL_BATCHES)
+      _glthread_WAIT_COND(m->Cond, m->Mutex);
+   m->Fill = m->Submitted % MARSHAL_BATCHES;
+   _glthread_UNLOCK_MUTEX(m->Mutex);
+
+   m->Batch[m->Fill].Used = 0;
+}
+
+
+/**
+ * Reserve space for a command in the current batch.
+ */
+static INLINE void *
+marshal_alloc( GLcontext *ctx, GLuint id, GLuint size )
+{
+   struct gl_marshal_context *m = ctx->Marshal;
+   struct marshal_batch *batch = &m->Batch[m->Fill];
+   struct marshal_cmd_base *cmd;
+
+   size = (size + 7) & ~7;
+   if (batch->Used + size > MARSHAL_BATCH_SIZE) {
+      marshal_submit(m);
+      batch = &m->Batch[m->Fill];
+   }
+
+   cmd = (struct marshal_cmd_base *) (batch->Buffer + batch->Used);
+   batch->Used += size;
+   cmd->cmd_id = (GLushort) id;
+   cmd->cmd_size = (GLushort) size;
+   return cmd;
+}
+
+
+/**
+ * Called before a synchronous function: wait for the worker and switch
+ * this thread to the real dispatch table.
+ */
+static void
+marshal_sync_begin( GLcontext *ctx )
+{
+   _mesa_marshal_finish(ctx);
+   _glapi_set_dispatch(ctx->CurrentDispatch);
+}
+
+
+static void
+marshal_sync_end( GLcontext *ctx )
+{
+   (void) ctx;
+   _glapi_set_dispatch(MarshalTable);
+}
+
+
+#include "api_marshal_tmp.h"
+
+
+static int
+marshal_nop( void )
+{
+   _mesa_problem(NULL, "User called no-op dispatch function (an unsupported extension function?)");
+   return 0;
+}
+
+
+/**
+ * Build the marshalling table, the first time it's needed.
+ */
+static GLboolean
+init_marshal_dispatch( void )
+{
+   _glthread_LOCK_MUTEX(MarshalTableMutex);
+   if (!MarshalTable) {
+      const GLuint numEntries =
+         MAX2(_glapi_get_dispatch_table_size(),
+              sizeof(struct _glapi_table) / sizeof(_glapi_proc));
+      _glapi_proc *entry =
+         (_glapi_proc *) _mesa_malloc(numEntries * sizeof(_glapi_proc));
+      if (entry) {
+         GLuint i;
+         for (i = 0; i < numEntries; i++)
+            entry[i] = (_glapi_proc) marshal_nop;
+         init_marshal_table((struct _glapi_table *) entry);
+         MarshalTable = (struct _glapi_table *) entry;
+      }
+   }
+   _glthread_UNLOCK_MUTEX(MarshalTableMutex);
+   return MarshalTable != NULL;
+}
+
+
+static void
+execute_batch( GLcontext *ctx, const struct marshal_batch *batch )
+{
+   const GLubyte *pos = batch->Buffer;
+   const GLubyte *end = batch->Buffer + batch->Used;
+
+   /* synchronous functions may have switched the context between the
+    * execute and compile tables (glNewList, glEndList)
+    */
+   if (_glapi_get_dispatch() != ctx->CurrentDispatch)
+      _glapi_set_dispatch(ctx->CurrentDispatch);
+
+   while (pos < end) {
+      const struct marshal_cmd_base *cmd =
+         (const struct marshal_cmd_base *) pos;
+      unmarshal_dispatch[cmd->cmd_id](ctx, cmd);
+      pos += cmd->cmd_size;
+   }
+}
+
+
+/**
+ * The worker thread: execute the batches in the order they're submitted.
+ */
+static void *
+marshal_thread_main( void *arg )
+{
+   struct gl_marshal_context *m = (struct gl_marshal_context *) arg;
+   GLcontext *ctx = m->ctx;
+
+   /* The context is current here too, with the real dispatch table, so
+    * that the functions called from the batches see it.
+    */
+   _glapi_check_multithread();
+   _glapi_set_context(ctx);
+   _glapi_set_dispatch(ctx->CurrentDispatch);
+
+   _glthread_LOCK_MUTEX(m->Mutex);
+   m->ThreadID = _glthread_GetID();
+   m->Started = GL_TRUE;
+   _glthread_BROADCAST_COND(m->Cond);
+
+   for (;;) {
+      const struct marshal_batch *batch;
+
+      while (m->Executed == m->Submitted && !m->Quit)
+         _glthread_WAIT_COND(m->Cond, m->Mutex);
+      if (m->Executed == m->Submitted)
+         break;  /* quitting, and everything has been executed */
+
+      batch = &m->Batch[m->Executed % MARSHAL_BATCHES];
+      _glthread_UNLOCK_MUTEX(m->Mutex);
+
+      execute_batch(ctx, batch);
+
+      _glthread_LOCK_MUTEX(m->Mutex);
+      m->Executed++;
+      _glthread_BROADCAST_COND(m->Cond);
+   }
+   _glthread_UNLOCK_MUTEX(m->Mutex);
+
+   return NULL;
+}
+
+
+static void
+free_marshal_context( struct gl_marshal_context *m )
+{
+   GLuint i;
+   for (i = 0; i < MARSHAL_BATCHES; i++) {
+      if (m->Batch[i].Buffer)
+         _mesa_align_free(m->Batch[i].Buffer);
+   }
+   FREE(m);
+}
+
+
+/**
+ * Start executing the context's commands on a worker thread.  Call this
+ * once the context is completely initialized, before it's first made
+ * current.
+ * Return:  GL_TRUE if success, GL_FALSE if the context should execute
+ *          on the calling thread as usual.
+ */
+GLboolean
+_mesa_marshal_init( GLcontext *ctx )
+{
+   struct gl_marshal_context *m;
+   GLuint i;
+
+   if (!init_marshal_dispatch())
+      return GL_FALSE;
+
+   m = CALLOC_STRUCT(gl_marshal_context);
+   if (!m)
+      return GL_FALSE;
+   for (i = 0; i < MARSHAL_BATCHES; i++) {
+      m->Batch[i].Buffer = (GLubyte *) _mesa_align_malloc(MARSHAL_BATCH_SIZE,
+                                                           16);
+      if (!m->Batch[i].Buffer) {
+         free_marshal_context(m);
+         return GL_FALSE;
+      }
+   }
+   m->ctx = ctx;
+   _glthread_INIT_MUTEX(m->Mutex);
+   _glthread_INIT_COND(m->Cond);
+
+   /* Make sure glapi knows about this thread before the worker starts,
+    * so that it switches to thread-specific dispatch.
+    */
+   _glapi_check_multithread();
+
+   if (!_glthread_CREATE_THREAD(m->Thread, marshal_thread_main, m)) {
+      _glthread_DESTROY_COND(m->Cond);
+      _glthread_DESTROY_MUTEX(m->Mutex);
+      free_marshal_context(m);
+      return GL_FALSE;
+   }
+
+   _glthread_LOCK_MUTEX(m->Mutex);
+   while (!m->Started)
+      _glthread_WAIT_COND(m->Cond, m->Mutex);
+   _glthread_UNLOCK_MUTEX(m->Mutex);
+
+   ctx->Marshal = m;
+   return GL_TRUE;
+}
+
+
+/**
+ * Execute everything recorded so far and stop the worker thread.
+ */
+void
+_mesa_marshal_destroy( GLcontext *ctx )
+{
+   struct gl_marshal_context *m = ctx->Marshal;
+
+   if (!m)
+      return;
+
+   _mesa_marshal_finish(ctx);
+
+   _glthread_LOCK_MUTEX(m->Mutex);
+   m->Quit = GL_TRUE;
+   _glthread_BROADCAST_COND(m->Cond);
+   _glthread_UNLOCK_MUTEX(m->Mutex);
+   _glthread_JOIN_THREAD(m->Thread);
+
+   _glthread_DESTROY_COND(m->Cond);
+   _glthread_DESTROY_MUTEX(m->Mutex);
+   free_marshal_context(m);
+   ctx->Marshal = NULL;
+
+   if (_glapi_get_context() == ctx)
+      _glapi_set_dispatch(ctx->CurrentDispatch);
+}
+
+
+/**
+ * Switch the calling thread to the marshalling table if the context is
+ * marshalled.  Called by _mesa_make_current() and by drivers which bind
+ * ctx->CurrentDispatch themselves.  Does nothing on the worker thread.
+ */
+void
+_mesa_marshal_make_current( GLcontext *ctx )
+{
+   struct gl_marshal_context *m = ctx->Marshal;
+
+   if (m && _glthread_GetID() != m->ThreadID)
+      _glapi_set_dispatch(MarshalTable);
+}
+
+
+/**
+ * Wait until the worker thread has executed every command recorded so
+ * far.  Window-system code must call this before it touches the context
+ * or its drawables.  Does nothing for a context which isn't marshalled,
+ * or when called on the worker thread itself (by a driver function).
+ */
+void
+_mesa_marshal_finish( GLcontext *ctx )
+{
+   struct gl_marshal_context *m = ctx ? ctx->Marshal : NULL;
+
+   if (!m || _glthread_GetID() == m->ThreadID)
+      return;
+
+   if (m->Batch[m->Fill].Used > 0)
+      marshal_submit(m);
+
+   _glthread_LOCK_MUTEX(m->Mutex);
+   while (m->Executed != m->Submitted)
+      _glthread_WAIT_COND(m->Cond, m->Mutex);
+   _glthread_UNLOCK_MUTEX(m->Mutex);
+}
+
+
+#else /* WORKER_THREADS */
+
+
+GLboolean
+_mesa_marshal_init( GLcontext *ctx )
+{
+   (void) ctx;
+   return GL_FALSE;
+}
+
+
+void
+_mesa_marshal_destroy( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+
+void
+_mesa_marshal_make_current( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+
+void
+_mesa_marshal_finish( GLcontext *ctx )
+{
+   (void) ctx;
+}
+
+
+#endif /* WORKER_THREADS */
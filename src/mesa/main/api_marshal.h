@@ -0,0 +1,67 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef API_MARSHAL_H
+#define API_MARSHAL_H
+
+
+#include "mtypes.h"
+
+
+extern GLboolean
+_mesa_marshal_init( GLcontext *ctx );
+
+extern void
+_mesa_marshal_destroy( GLcontext *ctx );
+
+extern void
+_mesa_marshal_make_current( GLcontext *ctx );
+
+extern void
+_mesa_marshal_finish( GLcontext *ctx );
+
+extern GLuint
+_mesa_material_count( GLenum pname );
+
+extern GLuint
+_mesa_light_count( GLenum pname );
+
+extern GLuint
+_mesa_light_model_count( GLenum pname );
+
+extern GLuint
+_mesa_fog_count( GLenum pname );
+
+extern GLuint
+_mesa_tex_env_count( GLenum pname );
+
+extern GLuint
+_mesa_tex_parameter_count( GLenum pname );
+
+extern GLuint
+_mesa_tex_gen_count( GLenum pname );
+
+
+#endif
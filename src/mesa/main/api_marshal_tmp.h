@@ -0,0 +1,17196 @@
+/* DO NOT EDIT - This file generated automatically by gl_marshal.py script */
+
+/*
+ * This file is only included by api_marshal.c.  It has a
+ * marshal_X function for each of the 816 dispatch table slots;
+ * 528 of them are recorded for the worker thread, the others
+ * are synchronous.
+ */
+
+enum marshal_cmd_id {
+   DISPATCH_CMD_NewList,
+   DISPATCH_CMD_EndList,
+   DISPATCH_CMD_CallList,
+   DISPATCH_CMD_DeleteLists,
+   DISPATCH_CMD_ListBase,
+   DISPATCH_CMD_Begin,
+   DISPATCH_CMD_Color3b,
+   DISPATCH_CMD_Color3bv,
+   DISPATCH_CMD_Color3d,
+   DISPATCH_CMD_Color3dv,
+   DISPATCH_CMD_Color3f,
+   DISPATCH_CMD_Color3fv,
+   DISPATCH_CMD_Color3i,
+   DISPATCH_CMD_Color3iv,
+   DISPATCH_CMD_Color3s,
+   DISPATCH_CMD_Color3sv,
+   DISPATCH_CMD_Color3ub,
+   DISPATCH_CMD_Color3ubv,
+   DISPATCH_CMD_Color3ui,
+   DISPATCH_CMD_Color3uiv,
+   DISPATCH_CMD_Color3us,
+   DISPATCH_CMD_Color3usv,
+   DISPATCH_CMD_Color4b,
+   DISPATCH_CMD_Color4bv,
+   DISPATCH_CMD_Color4d,
+   DISPATCH_CMD_Color4dv,
+   DISPATCH_CMD_Color4f,
+   DISPATCH_CMD_Color4fv,
+   DISPATCH_CMD_Color4i,
+   DISPATCH_CMD_Color4iv,
+   DISPATCH_CMD_Color4s,
+   DISPATCH_CMD_Color4sv,
+   DISPATCH_CMD_Color4ub,
+   DISPATCH_CMD_Color4ubv,
+   DISPATCH_CMD_Color4ui,
+   DISPATCH_CMD_Color4uiv,
+   DISPATCH_CMD_Color4us,
+   DISPATCH_CMD_Color4usv,
+   DISPATCH_CMD_EdgeFlag,
+   DISPATCH_CMD_EdgeFlagv,
+   DISPATCH_CMD_End,
+   DISPATCH_CMD_Indexd,
+   DISPATCH_CMD_Indexdv,
+   DISPATCH_CMD_Indexf,
+   DISPATCH_CMD_Indexfv,
+   DISPATCH_CMD_Indexi,
+   DISPATCH_CMD_Indexiv,
+   DISPATCH_CMD_Indexs,
+   DISPATCH_CMD_Indexsv,
+   DISPATCH_CMD_Normal3b,
+   DISPATCH_CMD_Normal3bv,
+   DISPATCH_CMD_Normal3d,
+   DISPATCH_CMD_Normal3dv,
+   DISPATCH_CMD_Normal3f,
+   DISPATCH_CMD_Normal3fv,
+   DISPATCH_CMD_Normal3i,
+   DISPATCH_CMD_Normal3iv,
+   DISPATCH_CMD_Normal3s,
+   DISPATCH_CMD_Normal3sv,
+   DISPATCH_CMD_RasterPos2d,
+   DISPATCH_CMD_RasterPos2dv,
+   DISPATCH_CMD_RasterPos2f,
+   DISPATCH_CMD_RasterPos2fv,
+   DISPATCH_CMD_RasterPos2i,
+   DISPATCH_CMD_RasterPos2iv,
+   DISPATCH_CMD_RasterPos2s,
+   DISPATCH_CMD_RasterPos2sv,
+   DISPATCH_CMD_RasterPos3d,
+   DISPATCH_CMD_RasterPos3dv,
+   DISPATCH_CMD_RasterPos3f,
+   DISPATCH_CMD_RasterPos3fv,
+   DISPATCH_CMD_RasterPos3i,
+   DISPATCH_CMD_RasterPos3iv,
+   DISPATCH_CMD_RasterPos3s,
+   DISPATCH_CMD_RasterPos3sv,
+   DISPATCH_CMD_RasterPos4d,
+   DISPATCH_CMD_RasterPos4dv,
+   DISPATCH_CMD_RasterPos4f,
+   DISPATCH_CMD_RasterPos4fv,
+   DISPATCH_CMD_RasterPos4i,
+   DISPATCH_CMD_RasterPos4iv,
+   DISPATCH_CMD_RasterPos4s,
+   DISPATCH_CMD_RasterPos4sv,
+   DISPATCH_CMD_Rectd,
+   DISPATCH_CMD_Rectdv,
+   DISPATCH_CMD_Rectf,
+   DISPATCH_CMD_Rectfv,
+   DISPATCH_CMD_Recti,
+   DISPATCH_CMD_Rectiv,
+   DISPATCH_CMD_Rects,
+   DISPATCH_CMD_Rectsv,
+   DISPATCH_CMD_TexCoord1d,
+   DISPATCH_CMD_TexCoord1dv,
+   DISPATCH_CMD_TexCoord1f,
+   DISPATCH_CMD_TexCoord1fv,
+   DISPATCH_CMD_TexCoord1i,
+   DISPATCH_CMD_TexCoord1iv,
+   DISPATCH_CMD_TexCoord1s,
+   DISPATCH_CMD_TexCoord1sv,
+   DISPATCH_CMD_TexCoord2d,
+   DISPATCH_CMD_TexCoord2dv,
+   DISPATCH_CMD_TexCoord2f,
+   DISPATCH_CMD_TexCoord2fv,
+   DISPATCH_CMD_TexCoord2i,
+   DISPATCH_CMD_TexCoord2iv,
+   DISPATCH_CMD_TexCoord2s,
+   DISPATCH_CMD_TexCoord2sv,
+   DISPATCH_CMD_TexCoord3d,
+   DISPATCH_CMD_TexCoord3dv,
+   DISPATCH_CMD_TexCoord3f,
+   DISPATCH_CMD_TexCoord3fv,
+   DISPATCH_CMD_TexCoord3i,
+   DISPATCH_CMD_TexCoord3iv,
+   DISPATCH_CMD_TexCoord3s,
+   DISPATCH_CMD_TexCoord3sv,
+   DISPATCH_CMD_TexCoord4d,
+   DISPATCH_CMD_TexCoord4dv,
+   DISPATCH_CMD_TexCoord4f,
+   DISPATCH_CMD_TexCoord4fv,
+   DISPATCH_CMD_TexCoord4i,
+   DISPATCH_CMD_TexCoord4iv,
+   DISPATCH_CMD_TexCoord4s,
+   DISPATCH_CMD_TexCoord4sv,
+   DISPATCH_CMD_Vertex2d,
+   DISPATCH_CMD_Vertex2dv,
+   DISPATCH_CMD_Vertex2f,
+   DISPATCH_CMD_Vertex2fv,
+   DISPATCH_CMD_Vertex2i,
+   DISPATCH_CMD_Vertex2iv,
+   DISPATCH_CMD_Vertex2s,
+   DISPATCH_CMD_Vertex2sv,
+   DISPATCH_CMD_Vertex3d,
+   DISPATCH_CMD_Vertex3dv,
+   DISPATCH_CMD_Vertex3f,
+   DISPATCH_CMD_Vertex3fv,
+   DISPATCH_CMD_Vertex3i,
+   DISPATCH_CMD_Vertex3iv,
+   DISPATCH_CMD_Vertex3s,
+   DISPATCH_CMD_Vertex3sv,
+   DISPATCH_CMD_Vertex4d,
+   DISPATCH_CMD_Vertex4dv,
+   DISPATCH_CMD_Vertex4f,
+   DISPATCH_CMD_Vertex4fv,
+   DISPATCH_CMD_Vertex4i,
+   DISPATCH_CMD_Vertex4iv,
+   DISPATCH_CMD_Vertex4s,
+   DISPATCH_CMD_Vertex4sv,
+   DISPATCH_CMD_ColorMaterial,
+   DISPATCH_CMD_CullFace,
+   DISPATCH_CMD_Fogf,
+   DISPATCH_CMD_Fogfv,
+   DISPATCH_CMD_Fogi,
+   DISPATCH_CMD_Fogiv,
+   DISPATCH_CMD_FrontFace,
+   DISPATCH_CMD_Hint,
+   DISPATCH_CMD_Lightf,
+   DISPATCH_CMD_Lightfv,
+   DISPATCH_CMD_Lighti,
+   DISPATCH_CMD_Lightiv,
+   DISPATCH_CMD_LightModelf,
+   DISPATCH_CMD_LightModelfv,
+   DISPATCH_CMD_LightModeli,
+   DISPATCH_CMD_LightModeliv,
+   DISPATCH_CMD_LineStipple,
+   DISPATCH_CMD_LineWidth,
+   DISPATCH_CMD_Materialf,
+   DISPATCH_CMD_Materialfv,
+   DISPATCH_CMD_Materiali,
+   DISPATCH_CMD_Materialiv,
+   DISPATCH_CMD_PointSize,
+   DISPATCH_CMD_PolygonMode,
+   DISPATCH_CMD_Scissor,
+   DISPATCH_CMD_ShadeModel,
+   DISPATCH_CMD_TexParameterf,
+   DISPATCH_CMD_TexParameterfv,
+   DISPATCH_CMD_TexParameteri,
+   DISPATCH_CMD_TexParameteriv,
+   DISPATCH_CMD_TexEnvf,
+   DISPATCH_CMD_TexEnvfv,
+   DISPATCH_CMD_TexEnvi,
+   DISPATCH_CMD_TexEnviv,
+   DISPATCH_CMD_TexGend,
+   DISPATCH_CMD_TexGendv,
+   DISPATCH_CMD_TexGenf,
+   DISPATCH_CMD_TexGenfv,
+   DISPATCH_CMD_TexGeni,
+   DISPATCH_CMD_TexGeniv,
+   DISPATCH_CMD_InitNames,
+   DISPATCH_CMD_LoadName,
+   DISPATCH_CMD_PassThrough,
+   DISPATCH_CMD_PopName,
+   DISPATCH_CMD_PushName,
+   DISPATCH_CMD_DrawBuffer,
+   DISPATCH_CMD_Clear,
+   DISPATCH_CMD_ClearAccum,
+   DISPATCH_CMD_ClearIndex,
+   DISPATCH_CMD_ClearColor,
+   DISPATCH_CMD_ClearStencil,
+   DISPATCH_CMD_ClearDepth,
+   DISPATCH_CMD_StencilMask,
+   DISPATCH_CMD_ColorMask,
+   DISPATCH_CMD_DepthMask,
+   DISPATCH_CMD_IndexMask,
+   DISPATCH_CMD_Accum,
+   DISPATCH_CMD_Disable,
+   DISPATCH_CMD_Enable,
+   DISPATCH_CMD_Flush,
+   DISPATCH_CMD_PopAttrib,
+   DISPATCH_CMD_PushAttrib,
+   DISPATCH_CMD_MapGrid1d,
+   DISPATCH_CMD_MapGrid1f,
+   DISPATCH_CMD_MapGrid2d,
+   DISPATCH_CMD_MapGrid2f,
+   DISPATCH_CMD_EvalCoord1d,
+   DISPATCH_CMD_EvalCoord1dv,
+   DISPATCH_CMD_EvalCoord1f,
+   DISPATCH_CMD_EvalCoord1fv,
+   DISPATCH_CMD_EvalCoord2d,
+   DISPATCH_CMD_EvalCoord2dv,
+   DISPATCH_CMD_EvalCoord2f,
+   DISPATCH_CMD_EvalCoord2fv,
+   DISPATCH_CMD_EvalMesh1,
+   DISPATCH_CMD_EvalPoint1,
+   DISPATCH_CMD_EvalMesh2,
+   DISPATCH_CMD_EvalPoint2,
+   DISPATCH_CMD_AlphaFunc,
+   DISPATCH_CMD_BlendFunc,
+   DISPATCH_CMD_LogicOp,
+   DISPATCH_CMD_StencilFunc,
+   DISPATCH_CMD_StencilOp,
+   DISPATCH_CMD_DepthFunc,
+   DISPATCH_CMD_PixelZoom,
+   DISPATCH_CMD_PixelTransferf,
+   DISPATCH_CMD_PixelTransferi,
+   DISPATCH_CMD_PixelStoref,
+   DISPATCH_CMD_PixelStorei,
+   DISPATCH_CMD_ReadBuffer,
+   DISPATCH_CMD_CopyPixels,
+   DISPATCH_CMD_DepthRange,
+   DISPATCH_CMD_Frustum,
+   DISPATCH_CMD_LoadIdentity,
+   DISPATCH_CMD_LoadMatrixf,
+   DISPATCH_CMD_LoadMatrixd,
+   DISPATCH_CMD_MatrixMode,
+   DISPATCH_CMD_MultMatrixf,
+   DISPATCH_CMD_MultMatrixd,
+   DISPATCH_CMD_Ortho,
+   DISPATCH_CMD_PopMatrix,
+   DISPATCH_CMD_PushMatrix,
+   DISPATCH_CMD_Rotated,
+   DISPATCH_CMD_Rotatef,
+   DISPATCH_CMD_Scaled,
+   DISPATCH_CMD_Scalef,
+   DISPATCH_CMD_Translated,
+   DISPATCH_CMD_Translatef,
+   DISPATCH_CMD_Viewport,
+   DISPATCH_CMD_BindTexture,
+   DISPATCH_CMD_DisableClientState,
+   DISPATCH_CMD_EnableClientState,
+   DISPATCH_CMD_Indexub,
+   DISPATCH_CMD_Indexubv,
+   DISPATCH_CMD_PolygonOffset,
+   DISPATCH_CMD_CopyTexImage1D,
+   DISPATCH_CMD_CopyTexImage2D,
+   DISPATCH_CMD_CopyTexSubImage1D,
+   DISPATCH_CMD_CopyTexSubImage2D,
+   DISPATCH_CMD_PopClientAttrib,
+   DISPATCH_CMD_PushClientAttrib,
+   DISPATCH_CMD_BlendColor,
+   DISPATCH_CMD_BlendEquation,
+   DISPATCH_CMD_CopyColorTable,
+   DISPATCH_CMD_CopyColorSubTable,
+   DISPATCH_CMD_ConvolutionParameterf,
+   DISPATCH_CMD_ConvolutionParameteri,
+   DISPATCH_CMD_CopyConvolutionFilter1D,
+   DISPATCH_CMD_CopyConvolutionFilter2D,
+   DISPATCH_CMD_Histogram,
+   DISPATCH_CMD_Minmax,
+   DISPATCH_CMD_ResetHistogram,
+   DISPATCH_CMD_ResetMinmax,
+   DISPATCH_CMD_CopyTexSubImage3D,
+   DISPATCH_CMD_ActiveTextureARB,
+   DISPATCH_CMD_ClientActiveTextureARB,
+   DISPATCH_CMD_MultiTexCoord1dARB,
+   DISPATCH_CMD_MultiTexCoord1dvARB,
+   DISPATCH_CMD_MultiTexCoord1fARB,
+   DISPATCH_CMD_MultiTexCoord1fvARB,
+   DISPATCH_CMD_MultiTexCoord1iARB,
+   DISPATCH_CMD_MultiTexCoord1ivARB,
+   DISPATCH_CMD_MultiTexCoord1sARB,
+   DISPATCH_CMD_MultiTexCoord1svARB,
+   DISPATCH_CMD_MultiTexCoord2dARB,
+   DISPATCH_CMD_MultiTexCoord2dvARB,
+   DISPATCH_CMD_MultiTexCoord2fARB,
+   DISPATCH_CMD_MultiTexCoord2fvARB,
+   DISPATCH_CMD_MultiTexCoord2iARB,
+   DISPATCH_CMD_MultiTexCoord2ivARB,
+   DISPATCH_CMD_MultiTexCoord2sARB,
+   DISPATCH_CMD_MultiTexCoord2svARB,
+   DISPATCH_CMD_MultiTexCoord3dARB,
+   DISPATCH_CMD_MultiTexCoord3dvARB,
+   DISPATCH_CMD_MultiTexCoord3fARB,
+   DISPATCH_CMD_MultiTexCoord3fvARB,
+   DISPATCH_CMD_MultiTexCoord3iARB,
+   DISPATCH_CMD_MultiTexCoord3ivARB,
+   DISPATCH_CMD_MultiTexCoord3sARB,
+   DISPATCH_CMD_MultiTexCoord3svARB,
+   DISPATCH_CMD_MultiTexCoord4dARB,
+   DISPATCH_CMD_MultiTexCoord4dvARB,
+   DISPATCH_CMD_MultiTexCoord4fARB,
+   DISPATCH_CMD_MultiTexCoord4fvARB,
+   DISPATCH_CMD_MultiTexCoord4iARB,
+   DISPATCH_CMD_MultiTexCoord4ivARB,
+   DISPATCH_CMD_MultiTexCoord4sARB,
+   DISPATCH_CMD_MultiTexCoord4svARB,
+   DISPATCH_CMD_LoadTransposeMatrixfARB,
+   DISPATCH_CMD_LoadTransposeMatrixdARB,
+   DISPATCH_CMD_MultTransposeMatrixfARB,
+   DISPATCH_CMD_MultTransposeMatrixdARB,
+   DISPATCH_CMD_SampleCoverageARB,
+   DISPATCH_CMD_PolygonOffsetEXT,
+   DISPATCH_CMD_PixelTexGenSGIX,
+   DISPATCH_CMD_PixelTexGenParameteriSGIS,
+   DISPATCH_CMD_PixelTexGenParameterfSGIS,
+   DISPATCH_CMD_SampleMaskSGIS,
+   DISPATCH_CMD_SamplePatternSGIS,
+   DISPATCH_CMD_SpriteParameterfSGIX,
+   DISPATCH_CMD_SpriteParameteriSGIX,
+   DISPATCH_CMD_PointParameterfEXT,
+   DISPATCH_CMD_ReadInstrumentsSGIX,
+   DISPATCH_CMD_StartInstrumentsSGIX,
+   DISPATCH_CMD_StopInstrumentsSGIX,
+   DISPATCH_CMD_FrameZoomSGIX,
+   DISPATCH_CMD_TagSampleBufferSGIX,
+   DISPATCH_CMD_FlushRasterSGIX,
+   DISPATCH_CMD_ListParameterfSGIX,
+   DISPATCH_CMD_ListParameteriSGIX,
+   DISPATCH_CMD_FragmentColorMaterialSGIX,
+   DISPATCH_CMD_FragmentLightfSGIX,
+   DISPATCH_CMD_FragmentLightiSGIX,
+   DISPATCH_CMD_FragmentLightModelfSGIX,
+   DISPATCH_CMD_FragmentLightModeliSGIX,
+   DISPATCH_CMD_FragmentMaterialfSGIX,
+   DISPATCH_CMD_FragmentMaterialiSGIX,
+   DISPATCH_CMD_LightEnviSGIX,
+   DISPATCH_CMD_VertexWeightfEXT,
+   DISPATCH_CMD_FlushVertexArrayRangeNV,
+   DISPATCH_CMD_CombinerParameterfNV,
+   DISPATCH_CMD_CombinerParameteriNV,
+   DISPATCH_CMD_CombinerInputNV,
+   DISPATCH_CMD_CombinerOutputNV,
+   DISPATCH_CMD_FinalCombinerInputNV,
+   DISPATCH_CMD_ResizeBuffersMESA,
+   DISPATCH_CMD_WindowPos2dMESA,
+   DISPATCH_CMD_WindowPos2dvMESA,
+   DISPATCH_CMD_WindowPos2fMESA,
+   DISPATCH_CMD_WindowPos2fvMESA,
+   DISPATCH_CMD_WindowPos2iMESA,
+   DISPATCH_CMD_WindowPos2ivMESA,
+   DISPATCH_CMD_WindowPos2sMESA,
+   DISPATCH_CMD_WindowPos2svMESA,
+   DISPATCH_CMD_WindowPos3dMESA,
+   DISPATCH_CMD_WindowPos3dvMESA,
+   DISPATCH_CMD_WindowPos3fMESA,
+   DISPATCH_CMD_WindowPos3fvMESA,
+   DISPATCH_CMD_WindowPos3iMESA,
+   DISPATCH_CMD_WindowPos3ivMESA,
+   DISPATCH_CMD_WindowPos3sMESA,
+   DISPATCH_CMD_WindowPos3svMESA,
+   DISPATCH_CMD_WindowPos4dMESA,
+   DISPATCH_CMD_WindowPos4dvMESA,
+   DISPATCH_CMD_WindowPos4fMESA,
+   DISPATCH_CMD_WindowPos4fvMESA,
+   DISPATCH_CMD_WindowPos4iMESA,
+   DISPATCH_CMD_WindowPos4ivMESA,
+   DISPATCH_CMD_WindowPos4sMESA,
+   DISPATCH_CMD_WindowPos4svMESA,
+   DISPATCH_CMD_BlendFuncSeparateEXT,
+   DISPATCH_CMD_IndexMaterialEXT,
+   DISPATCH_CMD_IndexFuncEXT,
+   DISPATCH_CMD_LockArraysEXT,
+   DISPATCH_CMD_UnlockArraysEXT,
+   DISPATCH_CMD_HintPGI,
+   DISPATCH_CMD_FogCoordfEXT,
+   DISPATCH_CMD_FogCoordfvEXT,
+   DISPATCH_CMD_FogCoorddEXT,
+   DISPATCH_CMD_FogCoorddvEXT,
+   DISPATCH_CMD_TbufferMask3DFX,
+   DISPATCH_CMD_SecondaryColor3bEXT,
+   DISPATCH_CMD_SecondaryColor3bvEXT,
+   DISPATCH_CMD_SecondaryColor3dEXT,
+   DISPATCH_CMD_SecondaryColor3dvEXT,
+   DISPATCH_CMD_SecondaryColor3fEXT,
+   DISPATCH_CMD_SecondaryColor3fvEXT,
+   DISPATCH_CMD_SecondaryColor3iEXT,
+   DISPATCH_CMD_SecondaryColor3ivEXT,
+   DISPATCH_CMD_SecondaryColor3sEXT,
+   DISPATCH_CMD_SecondaryColor3svEXT,
+   DISPATCH_CMD_SecondaryColor3ubEXT,
+   DISPATCH_CMD_SecondaryColor3ubvEXT,
+   DISPATCH_CMD_SecondaryColor3uiEXT,
+   DISPATCH_CMD_SecondaryColor3uivEXT,
+   DISPATCH_CMD_SecondaryColor3usEXT,
+   DISPATCH_CMD_SecondaryColor3usvEXT,
+   DISPATCH_CMD_BindProgramNV,
+   DISPATCH_CMD_ProgramParameter4dNV,
+   DISPATCH_CMD_ProgramParameter4dvNV,
+   DISPATCH_CMD_ProgramParameter4fNV,
+   DISPATCH_CMD_ProgramParameter4fvNV,
+   DISPATCH_CMD_TrackMatrixNV,
+   DISPATCH_CMD_VertexAttrib1dARB,
+   DISPATCH_CMD_VertexAttrib1dvARB,
+   DISPATCH_CMD_VertexAttrib1fARB,
+   DISPATCH_CMD_VertexAttrib1fvARB,
+   DISPATCH_CMD_VertexAttrib1sARB,
+   DISPATCH_CMD_VertexAttrib1svARB,
+   DISPATCH_CMD_VertexAttrib2dARB,
+   DISPATCH_CMD_VertexAttrib2dvARB,
+   DISPATCH_CMD_VertexAttrib2fARB,
+   DISPATCH_CMD_VertexAttrib2fvARB,
+   DISPATCH_CMD_VertexAttrib2sARB,
+   DISPATCH_CMD_VertexAttrib2svARB,
+   DISPATCH_CMD_VertexAttrib3dARB,
+   DISPATCH_CMD_VertexAttrib3dvARB,
+   DISPATCH_CMD_VertexAttrib3fARB,
+   DISPATCH_CMD_VertexAttrib3fvARB,
+   DISPATCH_CMD_VertexAttrib3sARB,
+   DISPATCH_CMD_VertexAttrib3svARB,
+   DISPATCH_CMD_VertexAttrib4dARB,
+   DISPATCH_CMD_VertexAttrib4dvARB,
+   DISPATCH_CMD_VertexAttrib4fARB,
+   DISPATCH_CMD_VertexAttrib4fvARB,
+   DISPATCH_CMD_VertexAttrib4sARB,
+   DISPATCH_CMD_VertexAttrib4svARB,
+   DISPATCH_CMD_VertexAttrib4NubARB,
+   DISPATCH_CMD_VertexAttrib4NubvARB,
+   DISPATCH_CMD_PointParameteriNV,
+   DISPATCH_CMD_ActiveStencilFaceEXT,
+   DISPATCH_CMD_SetFenceNV,
+   DISPATCH_CMD_VertexAttrib4bvARB,
+   DISPATCH_CMD_VertexAttrib4ivARB,
+   DISPATCH_CMD_VertexAttrib4ubvARB,
+   DISPATCH_CMD_VertexAttrib4usvARB,
+   DISPATCH_CMD_VertexAttrib4uivARB,
+   DISPATCH_CMD_VertexAttrib4NbvARB,
+   DISPATCH_CMD_VertexAttrib4NsvARB,
+   DISPATCH_CMD_VertexAttrib4NivARB,
+   DISPATCH_CMD_VertexAttrib4NusvARB,
+   DISPATCH_CMD_VertexAttrib4NuivARB,
+   DISPATCH_CMD_EnableVertexAttribArrayARB,
+   DISPATCH_CMD_DisableVertexAttribArrayARB,
+   DISPATCH_CMD_ProgramEnvParameter4dARB,
+   DISPATCH_CMD_ProgramEnvParameter4dvARB,
+   DISPATCH_CMD_ProgramEnvParameter4fARB,
+   DISPATCH_CMD_ProgramEnvParameter4fvARB,
+   DISPATCH_CMD_ProgramLocalParameter4dARB,
+   DISPATCH_CMD_ProgramLocalParameter4dvARB,
+   DISPATCH_CMD_ProgramLocalParameter4fARB,
+   DISPATCH_CMD_ProgramLocalParameter4fvARB,
+   DISPATCH_CMD_BindBufferARB,
+   DISPATCH_CMD_DepthBoundsEXT,
+   DISPATCH_CMD_BeginQueryARB,
+   DISPATCH_CMD_EndQueryARB,
+   DISPATCH_CMD_BlendEquationSeparateEXT,
+   DISPATCH_CMD_DeleteObjectARB,
+   DISPATCH_CMD_DetachObjectARB,
+   DISPATCH_CMD_CompileShaderARB,
+   DISPATCH_CMD_AttachObjectARB,
+   DISPATCH_CMD_LinkProgramARB,
+   DISPATCH_CMD_UseProgramObjectARB,
+   DISPATCH_CMD_ValidateProgramARB,
+   DISPATCH_CMD_Uniform1fARB,
+   DISPATCH_CMD_Uniform2fARB,
+   DISPATCH_CMD_Uniform3fARB,
+   DISPATCH_CMD_Uniform4fARB,
+   DISPATCH_CMD_Uniform1iARB,
+   DISPATCH_CMD_Uniform2iARB,
+   DISPATCH_CMD_Uniform3iARB,
+   DISPATCH_CMD_Uniform4iARB,
+   DISPATCH_CMD_VertexAttrib1dNV,
+   DISPATCH_CMD_VertexAttrib1dvNV,
+   DISPATCH_CMD_VertexAttrib1fNV,
+   DISPATCH_CMD_VertexAttrib1fvNV,
+   DISPATCH_CMD_VertexAttrib1sNV,
+   DISPATCH_CMD_VertexAttrib1svNV,
+   DISPATCH_CMD_VertexAttrib2dNV,
+   DISPATCH_CMD_VertexAttrib2dvNV,
+   DISPATCH_CMD_VertexAttrib2fNV,
+   DISPATCH_CMD_VertexAttrib2fvNV,
+   DISPATCH_CMD_VertexAttrib2sNV,
+   DISPATCH_CMD_VertexAttrib2svNV,
+   DISPATCH_CMD_VertexAttrib3dNV,
+   DISPATCH_CMD_VertexAttrib3dvNV,
+   DISPATCH_CMD_VertexAttrib3fNV,
+   DISPATCH_CMD_VertexAttrib3fvNV,
+   DISPATCH_CMD_VertexAttrib3sNV,
+   DISPATCH_CMD_VertexAttrib3svNV,
+   DISPATCH_CMD_VertexAttrib4dNV,
+   DISPATCH_CMD_VertexAttrib4dvNV,
+   DISPATCH_CMD_VertexAttrib4fNV,
+   DISPATCH_CMD_VertexAttrib4fvNV,
+   DISPATCH_CMD_VertexAttrib4sNV,
+   DISPATCH_CMD_VertexAttrib4svNV,
+   DISPATCH_CMD_VertexAttrib4ubNV,
+   DISPATCH_CMD_VertexAttrib4ubvNV,
+   DISPATCH_CMD_BindFragmentShaderATI,
+   DISPATCH_CMD_DeleteFragmentShaderATI,
+   DISPATCH_CMD_BeginFragmentShaderATI,
+   DISPATCH_CMD_EndFragmentShaderATI,
+   DISPATCH_CMD_PassTexCoordATI,
+   DISPATCH_CMD_SampleMapATI,
+   DISPATCH_CMD_ColorFragmentOp1ATI,
+   DISPATCH_CMD_ColorFragmentOp2ATI,
+   DISPATCH_CMD_ColorFragmentOp3ATI,
+   DISPATCH_CMD_AlphaFragmentOp1ATI,
+   DISPATCH_CMD_AlphaFragmentOp2ATI,
+   DISPATCH_CMD_AlphaFragmentOp3ATI,
+   DISPATCH_CMD_BindRenderbufferEXT,
+   DISPATCH_CMD_RenderbufferStorageEXT,
+   DISPATCH_CMD_BindFramebufferEXT,
+   DISPATCH_CMD_FramebufferTexture1DEXT,
+   DISPATCH_CMD_FramebufferTexture2DEXT,
+   DISPATCH_CMD_FramebufferTexture3DEXT,
+   DISPATCH_CMD_FramebufferRenderbufferEXT,
+   DISPATCH_CMD_GenerateMipmapEXT,
+   DISPATCH_CMD_StencilFuncSeparate,
+   DISPATCH_CMD_StencilOpSeparate,
+   DISPATCH_CMD_StencilMaskSeparate,
+   NUM_DISPATCH_CMD
+};
+
+struct marshal_cmd_NewList {
+   struct marshal_cmd_base header;
+   GLuint list;
+   GLenum mode;
+};
+
+static void
+unmarshal_NewList(GLcontext *ctx, const struct marshal_cmd_NewList *cmd)
+{
+   CALL_NewList(ctx->CurrentDispatch, (cmd->list, cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_NewList(GLuint list, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_NewList *cmd;
+   cmd = (struct marshal_cmd_NewList *)
+      marshal_alloc(ctx, DISPATCH_CMD_NewList, sizeof(*cmd));
+   cmd->list = list;
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_EndList {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_EndList(GLcontext *ctx, const struct marshal_cmd_EndList *cmd)
+{
+   CALL_EndList(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_EndList(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EndList *cmd;
+   cmd = (struct marshal_cmd_EndList *)
+      marshal_alloc(ctx, DISPATCH_CMD_EndList, sizeof(*cmd));
+}
+
+struct marshal_cmd_CallList {
+   struct marshal_cmd_base header;
+   GLuint list;
+};
+
+static void
+unmarshal_CallList(GLcontext *ctx, const struct marshal_cmd_CallList *cmd)
+{
+   CALL_CallList(ctx->CurrentDispatch, (cmd->list));
+}
+
+static void GLAPIENTRY
+marshal_CallList(GLuint list)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CallList *cmd;
+   cmd = (struct marshal_cmd_CallList *)
+      marshal_alloc(ctx, DISPATCH_CMD_CallList, sizeof(*cmd));
+   cmd->list = list;
+}
+
+static void GLAPIENTRY
+marshal_CallLists(GLsizei n, GLenum type, const GLvoid * lists)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CallLists(ctx->CurrentDispatch, (n, type, lists));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_DeleteLists {
+   struct marshal_cmd_base header;
+   GLuint list;
+   GLsizei range;
+};
+
+static void
+unmarshal_DeleteLists(GLcontext *ctx, const struct marshal_cmd_DeleteLists *cmd)
+{
+   CALL_DeleteLists(ctx->CurrentDispatch, (cmd->list, cmd->range));
+}
+
+static void GLAPIENTRY
+marshal_DeleteLists(GLuint list, GLsizei range)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DeleteLists *cmd;
+   cmd = (struct marshal_cmd_DeleteLists *)
+      marshal_alloc(ctx, DISPATCH_CMD_DeleteLists, sizeof(*cmd));
+   cmd->list = list;
+   cmd->range = range;
+}
+
+static GLuint GLAPIENTRY
+marshal_GenLists(GLsizei range)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLuint ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_GenLists(ctx->CurrentDispatch, (range));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_ListBase {
+   struct marshal_cmd_base header;
+   GLuint base;
+};
+
+static void
+unmarshal_ListBase(GLcontext *ctx, const struct marshal_cmd_ListBase *cmd)
+{
+   CALL_ListBase(ctx->CurrentDispatch, (cmd->base));
+}
+
+static void GLAPIENTRY
+marshal_ListBase(GLuint base)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ListBase *cmd;
+   cmd = (struct marshal_cmd_ListBase *)
+      marshal_alloc(ctx, DISPATCH_CMD_ListBase, sizeof(*cmd));
+   cmd->base = base;
+}
+
+struct marshal_cmd_Begin {
+   struct marshal_cmd_base header;
+   GLenum mode;
+};
+
+static void
+unmarshal_Begin(GLcontext *ctx, const struct marshal_cmd_Begin *cmd)
+{
+   CALL_Begin(ctx->CurrentDispatch, (cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_Begin(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Begin *cmd;
+   cmd = (struct marshal_cmd_Begin *)
+      marshal_alloc(ctx, DISPATCH_CMD_Begin, sizeof(*cmd));
+   cmd->mode = mode;
+}
+
+static void GLAPIENTRY
+marshal_Bitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte * bitmap)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Bitmap(ctx->CurrentDispatch, (width, height, xorig, yorig, xmove, ymove, bitmap));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_Color3b {
+   struct marshal_cmd_base header;
+   GLbyte red;
+   GLbyte green;
+   GLbyte blue;
+};
+
+static void
+unmarshal_Color3b(GLcontext *ctx, const struct marshal_cmd_Color3b *cmd)
+{
+   CALL_Color3b(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_Color3b(GLbyte red, GLbyte green, GLbyte blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3b *cmd;
+   cmd = (struct marshal_cmd_Color3b *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3b, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_Color3bv {
+   struct marshal_cmd_base header;
+   GLbyte v[3];
+};
+
+static void
+unmarshal_Color3bv(GLcontext *ctx, const struct marshal_cmd_Color3bv *cmd)
+{
+   CALL_Color3bv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color3bv(const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3bv *cmd;
+   cmd = (struct marshal_cmd_Color3bv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3bv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color3d {
+   struct marshal_cmd_base header;
+   GLdouble red;
+   GLdouble green;
+   GLdouble blue;
+};
+
+static void
+unmarshal_Color3d(GLcontext *ctx, const struct marshal_cmd_Color3d *cmd)
+{
+   CALL_Color3d(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_Color3d(GLdouble red, GLdouble green, GLdouble blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3d *cmd;
+   cmd = (struct marshal_cmd_Color3d *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3d, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_Color3dv {
+   struct marshal_cmd_base header;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_Color3dv(GLcontext *ctx, const struct marshal_cmd_Color3dv *cmd)
+{
+   CALL_Color3dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3dv *cmd;
+   cmd = (struct marshal_cmd_Color3dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color3f {
+   struct marshal_cmd_base header;
+   GLfloat red;
+   GLfloat green;
+   GLfloat blue;
+};
+
+static void
+unmarshal_Color3f(GLcontext *ctx, const struct marshal_cmd_Color3f *cmd)
+{
+   CALL_Color3f(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_Color3f(GLfloat red, GLfloat green, GLfloat blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3f *cmd;
+   cmd = (struct marshal_cmd_Color3f *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3f, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_Color3fv {
+   struct marshal_cmd_base header;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_Color3fv(GLcontext *ctx, const struct marshal_cmd_Color3fv *cmd)
+{
+   CALL_Color3fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3fv *cmd;
+   cmd = (struct marshal_cmd_Color3fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color3i {
+   struct marshal_cmd_base header;
+   GLint red;
+   GLint green;
+   GLint blue;
+};
+
+static void
+unmarshal_Color3i(GLcontext *ctx, const struct marshal_cmd_Color3i *cmd)
+{
+   CALL_Color3i(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_Color3i(GLint red, GLint green, GLint blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3i *cmd;
+   cmd = (struct marshal_cmd_Color3i *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3i, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_Color3iv {
+   struct marshal_cmd_base header;
+   GLint v[3];
+};
+
+static void
+unmarshal_Color3iv(GLcontext *ctx, const struct marshal_cmd_Color3iv *cmd)
+{
+   CALL_Color3iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3iv *cmd;
+   cmd = (struct marshal_cmd_Color3iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color3s {
+   struct marshal_cmd_base header;
+   GLshort red;
+   GLshort green;
+   GLshort blue;
+};
+
+static void
+unmarshal_Color3s(GLcontext *ctx, const struct marshal_cmd_Color3s *cmd)
+{
+   CALL_Color3s(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_Color3s(GLshort red, GLshort green, GLshort blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3s *cmd;
+   cmd = (struct marshal_cmd_Color3s *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3s, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_Color3sv {
+   struct marshal_cmd_base header;
+   GLshort v[3];
+};
+
+static void
+unmarshal_Color3sv(GLcontext *ctx, const struct marshal_cmd_Color3sv *cmd)
+{
+   CALL_Color3sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3sv *cmd;
+   cmd = (struct marshal_cmd_Color3sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color3ub {
+   struct marshal_cmd_base header;
+   GLubyte red;
+   GLubyte green;
+   GLubyte blue;
+};
+
+static void
+unmarshal_Color3ub(GLcontext *ctx, const struct marshal_cmd_Color3ub *cmd)
+{
+   CALL_Color3ub(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_Color3ub(GLubyte red, GLubyte green, GLubyte blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3ub *cmd;
+   cmd = (struct marshal_cmd_Color3ub *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3ub, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_Color3ubv {
+   struct marshal_cmd_base header;
+   GLubyte v[3];
+};
+
+static void
+unmarshal_Color3ubv(GLcontext *ctx, const struct marshal_cmd_Color3ubv *cmd)
+{
+   CALL_Color3ubv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color3ubv(const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3ubv *cmd;
+   cmd = (struct marshal_cmd_Color3ubv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3ubv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color3ui {
+   struct marshal_cmd_base header;
+   GLuint red;
+   GLuint green;
+   GLuint blue;
+};
+
+static void
+unmarshal_Color3ui(GLcontext *ctx, const struct marshal_cmd_Color3ui *cmd)
+{
+   CALL_Color3ui(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_Color3ui(GLuint red, GLuint green, GLuint blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3ui *cmd;
+   cmd = (struct marshal_cmd_Color3ui *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3ui, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_Color3uiv {
+   struct marshal_cmd_base header;
+   GLuint v[3];
+};
+
+static void
+unmarshal_Color3uiv(GLcontext *ctx, const struct marshal_cmd_Color3uiv *cmd)
+{
+   CALL_Color3uiv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color3uiv(const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3uiv *cmd;
+   cmd = (struct marshal_cmd_Color3uiv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3uiv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color3us {
+   struct marshal_cmd_base header;
+   GLushort red;
+   GLushort green;
+   GLushort blue;
+};
+
+static void
+unmarshal_Color3us(GLcontext *ctx, const struct marshal_cmd_Color3us *cmd)
+{
+   CALL_Color3us(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_Color3us(GLushort red, GLushort green, GLushort blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3us *cmd;
+   cmd = (struct marshal_cmd_Color3us *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3us, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_Color3usv {
+   struct marshal_cmd_base header;
+   GLushort v[3];
+};
+
+static void
+unmarshal_Color3usv(GLcontext *ctx, const struct marshal_cmd_Color3usv *cmd)
+{
+   CALL_Color3usv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color3usv(const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color3usv *cmd;
+   cmd = (struct marshal_cmd_Color3usv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color3usv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color4b {
+   struct marshal_cmd_base header;
+   GLbyte red;
+   GLbyte green;
+   GLbyte blue;
+   GLbyte alpha;
+};
+
+static void
+unmarshal_Color4b(GLcontext *ctx, const struct marshal_cmd_Color4b *cmd)
+{
+   CALL_Color4b(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_Color4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4b *cmd;
+   cmd = (struct marshal_cmd_Color4b *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4b, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_Color4bv {
+   struct marshal_cmd_base header;
+   GLbyte v[4];
+};
+
+static void
+unmarshal_Color4bv(GLcontext *ctx, const struct marshal_cmd_Color4bv *cmd)
+{
+   CALL_Color4bv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color4bv(const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4bv *cmd;
+   cmd = (struct marshal_cmd_Color4bv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4bv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color4d {
+   struct marshal_cmd_base header;
+   GLdouble red;
+   GLdouble green;
+   GLdouble blue;
+   GLdouble alpha;
+};
+
+static void
+unmarshal_Color4d(GLcontext *ctx, const struct marshal_cmd_Color4d *cmd)
+{
+   CALL_Color4d(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_Color4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4d *cmd;
+   cmd = (struct marshal_cmd_Color4d *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4d, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_Color4dv {
+   struct marshal_cmd_base header;
+   GLdouble v[4];
+};
+
+static void
+unmarshal_Color4dv(GLcontext *ctx, const struct marshal_cmd_Color4dv *cmd)
+{
+   CALL_Color4dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color4dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4dv *cmd;
+   cmd = (struct marshal_cmd_Color4dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color4f {
+   struct marshal_cmd_base header;
+   GLfloat red;
+   GLfloat green;
+   GLfloat blue;
+   GLfloat alpha;
+};
+
+static void
+unmarshal_Color4f(GLcontext *ctx, const struct marshal_cmd_Color4f *cmd)
+{
+   CALL_Color4f(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4f *cmd;
+   cmd = (struct marshal_cmd_Color4f *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4f, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_Color4fv {
+   struct marshal_cmd_base header;
+   GLfloat v[4];
+};
+
+static void
+unmarshal_Color4fv(GLcontext *ctx, const struct marshal_cmd_Color4fv *cmd)
+{
+   CALL_Color4fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color4fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4fv *cmd;
+   cmd = (struct marshal_cmd_Color4fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color4i {
+   struct marshal_cmd_base header;
+   GLint red;
+   GLint green;
+   GLint blue;
+   GLint alpha;
+};
+
+static void
+unmarshal_Color4i(GLcontext *ctx, const struct marshal_cmd_Color4i *cmd)
+{
+   CALL_Color4i(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_Color4i(GLint red, GLint green, GLint blue, GLint alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4i *cmd;
+   cmd = (struct marshal_cmd_Color4i *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4i, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_Color4iv {
+   struct marshal_cmd_base header;
+   GLint v[4];
+};
+
+static void
+unmarshal_Color4iv(GLcontext *ctx, const struct marshal_cmd_Color4iv *cmd)
+{
+   CALL_Color4iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color4iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4iv *cmd;
+   cmd = (struct marshal_cmd_Color4iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color4s {
+   struct marshal_cmd_base header;
+   GLshort red;
+   GLshort green;
+   GLshort blue;
+   GLshort alpha;
+};
+
+static void
+unmarshal_Color4s(GLcontext *ctx, const struct marshal_cmd_Color4s *cmd)
+{
+   CALL_Color4s(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_Color4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4s *cmd;
+   cmd = (struct marshal_cmd_Color4s *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4s, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_Color4sv {
+   struct marshal_cmd_base header;
+   GLshort v[4];
+};
+
+static void
+unmarshal_Color4sv(GLcontext *ctx, const struct marshal_cmd_Color4sv *cmd)
+{
+   CALL_Color4sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color4sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4sv *cmd;
+   cmd = (struct marshal_cmd_Color4sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color4ub {
+   struct marshal_cmd_base header;
+   GLubyte red;
+   GLubyte green;
+   GLubyte blue;
+   GLubyte alpha;
+};
+
+static void
+unmarshal_Color4ub(GLcontext *ctx, const struct marshal_cmd_Color4ub *cmd)
+{
+   CALL_Color4ub(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4ub *cmd;
+   cmd = (struct marshal_cmd_Color4ub *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4ub, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_Color4ubv {
+   struct marshal_cmd_base header;
+   GLubyte v[4];
+};
+
+static void
+unmarshal_Color4ubv(GLcontext *ctx, const struct marshal_cmd_Color4ubv *cmd)
+{
+   CALL_Color4ubv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color4ubv(const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4ubv *cmd;
+   cmd = (struct marshal_cmd_Color4ubv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4ubv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color4ui {
+   struct marshal_cmd_base header;
+   GLuint red;
+   GLuint green;
+   GLuint blue;
+   GLuint alpha;
+};
+
+static void
+unmarshal_Color4ui(GLcontext *ctx, const struct marshal_cmd_Color4ui *cmd)
+{
+   CALL_Color4ui(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_Color4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4ui *cmd;
+   cmd = (struct marshal_cmd_Color4ui *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4ui, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_Color4uiv {
+   struct marshal_cmd_base header;
+   GLuint v[4];
+};
+
+static void
+unmarshal_Color4uiv(GLcontext *ctx, const struct marshal_cmd_Color4uiv *cmd)
+{
+   CALL_Color4uiv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color4uiv(const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4uiv *cmd;
+   cmd = (struct marshal_cmd_Color4uiv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4uiv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Color4us {
+   struct marshal_cmd_base header;
+   GLushort red;
+   GLushort green;
+   GLushort blue;
+   GLushort alpha;
+};
+
+static void
+unmarshal_Color4us(GLcontext *ctx, const struct marshal_cmd_Color4us *cmd)
+{
+   CALL_Color4us(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_Color4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4us *cmd;
+   cmd = (struct marshal_cmd_Color4us *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4us, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_Color4usv {
+   struct marshal_cmd_base header;
+   GLushort v[4];
+};
+
+static void
+unmarshal_Color4usv(GLcontext *ctx, const struct marshal_cmd_Color4usv *cmd)
+{
+   CALL_Color4usv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Color4usv(const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Color4usv *cmd;
+   cmd = (struct marshal_cmd_Color4usv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Color4usv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_EdgeFlag {
+   struct marshal_cmd_base header;
+   GLboolean flag;
+};
+
+static void
+unmarshal_EdgeFlag(GLcontext *ctx, const struct marshal_cmd_EdgeFlag *cmd)
+{
+   CALL_EdgeFlag(ctx->CurrentDispatch, (cmd->flag));
+}
+
+static void GLAPIENTRY
+marshal_EdgeFlag(GLboolean flag)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EdgeFlag *cmd;
+   cmd = (struct marshal_cmd_EdgeFlag *)
+      marshal_alloc(ctx, DISPATCH_CMD_EdgeFlag, sizeof(*cmd));
+   cmd->flag = flag;
+}
+
+struct marshal_cmd_EdgeFlagv {
+   struct marshal_cmd_base header;
+   GLboolean flag[1];
+};
+
+static void
+unmarshal_EdgeFlagv(GLcontext *ctx, const struct marshal_cmd_EdgeFlagv *cmd)
+{
+   CALL_EdgeFlagv(ctx->CurrentDispatch, (cmd->flag));
+}
+
+static void GLAPIENTRY
+marshal_EdgeFlagv(const GLboolean * flag)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EdgeFlagv *cmd;
+   cmd = (struct marshal_cmd_EdgeFlagv *)
+      marshal_alloc(ctx, DISPATCH_CMD_EdgeFlagv, sizeof(*cmd));
+   MEMCPY(cmd->flag, flag, sizeof(cmd->flag));
+}
+
+struct marshal_cmd_End {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_End(GLcontext *ctx, const struct marshal_cmd_End *cmd)
+{
+   CALL_End(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_End(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_End *cmd;
+   cmd = (struct marshal_cmd_End *)
+      marshal_alloc(ctx, DISPATCH_CMD_End, sizeof(*cmd));
+}
+
+struct marshal_cmd_Indexd {
+   struct marshal_cmd_base header;
+   GLdouble c;
+};
+
+static void
+unmarshal_Indexd(GLcontext *ctx, const struct marshal_cmd_Indexd *cmd)
+{
+   CALL_Indexd(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexd(GLdouble c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexd *cmd;
+   cmd = (struct marshal_cmd_Indexd *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexd, sizeof(*cmd));
+   cmd->c = c;
+}
+
+struct marshal_cmd_Indexdv {
+   struct marshal_cmd_base header;
+   GLdouble c[1];
+};
+
+static void
+unmarshal_Indexdv(GLcontext *ctx, const struct marshal_cmd_Indexdv *cmd)
+{
+   CALL_Indexdv(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexdv(const GLdouble * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexdv *cmd;
+   cmd = (struct marshal_cmd_Indexdv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexdv, sizeof(*cmd));
+   MEMCPY(cmd->c, c, sizeof(cmd->c));
+}
+
+struct marshal_cmd_Indexf {
+   struct marshal_cmd_base header;
+   GLfloat c;
+};
+
+static void
+unmarshal_Indexf(GLcontext *ctx, const struct marshal_cmd_Indexf *cmd)
+{
+   CALL_Indexf(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexf(GLfloat c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexf *cmd;
+   cmd = (struct marshal_cmd_Indexf *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexf, sizeof(*cmd));
+   cmd->c = c;
+}
+
+struct marshal_cmd_Indexfv {
+   struct marshal_cmd_base header;
+   GLfloat c[1];
+};
+
+static void
+unmarshal_Indexfv(GLcontext *ctx, const struct marshal_cmd_Indexfv *cmd)
+{
+   CALL_Indexfv(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexfv(const GLfloat * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexfv *cmd;
+   cmd = (struct marshal_cmd_Indexfv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexfv, sizeof(*cmd));
+   MEMCPY(cmd->c, c, sizeof(cmd->c));
+}
+
+struct marshal_cmd_Indexi {
+   struct marshal_cmd_base header;
+   GLint c;
+};
+
+static void
+unmarshal_Indexi(GLcontext *ctx, const struct marshal_cmd_Indexi *cmd)
+{
+   CALL_Indexi(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexi(GLint c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexi *cmd;
+   cmd = (struct marshal_cmd_Indexi *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexi, sizeof(*cmd));
+   cmd->c = c;
+}
+
+struct marshal_cmd_Indexiv {
+   struct marshal_cmd_base header;
+   GLint c[1];
+};
+
+static void
+unmarshal_Indexiv(GLcontext *ctx, const struct marshal_cmd_Indexiv *cmd)
+{
+   CALL_Indexiv(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexiv(const GLint * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexiv *cmd;
+   cmd = (struct marshal_cmd_Indexiv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexiv, sizeof(*cmd));
+   MEMCPY(cmd->c, c, sizeof(cmd->c));
+}
+
+struct marshal_cmd_Indexs {
+   struct marshal_cmd_base header;
+   GLshort c;
+};
+
+static void
+unmarshal_Indexs(GLcontext *ctx, const struct marshal_cmd_Indexs *cmd)
+{
+   CALL_Indexs(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexs(GLshort c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexs *cmd;
+   cmd = (struct marshal_cmd_Indexs *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexs, sizeof(*cmd));
+   cmd->c = c;
+}
+
+struct marshal_cmd_Indexsv {
+   struct marshal_cmd_base header;
+   GLshort c[1];
+};
+
+static void
+unmarshal_Indexsv(GLcontext *ctx, const struct marshal_cmd_Indexsv *cmd)
+{
+   CALL_Indexsv(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexsv(const GLshort * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexsv *cmd;
+   cmd = (struct marshal_cmd_Indexsv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexsv, sizeof(*cmd));
+   MEMCPY(cmd->c, c, sizeof(cmd->c));
+}
+
+struct marshal_cmd_Normal3b {
+   struct marshal_cmd_base header;
+   GLbyte nx;
+   GLbyte ny;
+   GLbyte nz;
+};
+
+static void
+unmarshal_Normal3b(GLcontext *ctx, const struct marshal_cmd_Normal3b *cmd)
+{
+   CALL_Normal3b(ctx->CurrentDispatch, (cmd->nx, cmd->ny, cmd->nz));
+}
+
+static void GLAPIENTRY
+marshal_Normal3b(GLbyte nx, GLbyte ny, GLbyte nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3b *cmd;
+   cmd = (struct marshal_cmd_Normal3b *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3b, sizeof(*cmd));
+   cmd->nx = nx;
+   cmd->ny = ny;
+   cmd->nz = nz;
+}
+
+struct marshal_cmd_Normal3bv {
+   struct marshal_cmd_base header;
+   GLbyte v[3];
+};
+
+static void
+unmarshal_Normal3bv(GLcontext *ctx, const struct marshal_cmd_Normal3bv *cmd)
+{
+   CALL_Normal3bv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Normal3bv(const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3bv *cmd;
+   cmd = (struct marshal_cmd_Normal3bv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3bv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Normal3d {
+   struct marshal_cmd_base header;
+   GLdouble nx;
+   GLdouble ny;
+   GLdouble nz;
+};
+
+static void
+unmarshal_Normal3d(GLcontext *ctx, const struct marshal_cmd_Normal3d *cmd)
+{
+   CALL_Normal3d(ctx->CurrentDispatch, (cmd->nx, cmd->ny, cmd->nz));
+}
+
+static void GLAPIENTRY
+marshal_Normal3d(GLdouble nx, GLdouble ny, GLdouble nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3d *cmd;
+   cmd = (struct marshal_cmd_Normal3d *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3d, sizeof(*cmd));
+   cmd->nx = nx;
+   cmd->ny = ny;
+   cmd->nz = nz;
+}
+
+struct marshal_cmd_Normal3dv {
+   struct marshal_cmd_base header;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_Normal3dv(GLcontext *ctx, const struct marshal_cmd_Normal3dv *cmd)
+{
+   CALL_Normal3dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Normal3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3dv *cmd;
+   cmd = (struct marshal_cmd_Normal3dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Normal3f {
+   struct marshal_cmd_base header;
+   GLfloat nx;
+   GLfloat ny;
+   GLfloat nz;
+};
+
+static void
+unmarshal_Normal3f(GLcontext *ctx, const struct marshal_cmd_Normal3f *cmd)
+{
+   CALL_Normal3f(ctx->CurrentDispatch, (cmd->nx, cmd->ny, cmd->nz));
+}
+
+static void GLAPIENTRY
+marshal_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3f *cmd;
+   cmd = (struct marshal_cmd_Normal3f *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3f, sizeof(*cmd));
+   cmd->nx = nx;
+   cmd->ny = ny;
+   cmd->nz = nz;
+}
+
+struct marshal_cmd_Normal3fv {
+   struct marshal_cmd_base header;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_Normal3fv(GLcontext *ctx, const struct marshal_cmd_Normal3fv *cmd)
+{
+   CALL_Normal3fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Normal3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3fv *cmd;
+   cmd = (struct marshal_cmd_Normal3fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Normal3i {
+   struct marshal_cmd_base header;
+   GLint nx;
+   GLint ny;
+   GLint nz;
+};
+
+static void
+unmarshal_Normal3i(GLcontext *ctx, const struct marshal_cmd_Normal3i *cmd)
+{
+   CALL_Normal3i(ctx->CurrentDispatch, (cmd->nx, cmd->ny, cmd->nz));
+}
+
+static void GLAPIENTRY
+marshal_Normal3i(GLint nx, GLint ny, GLint nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3i *cmd;
+   cmd = (struct marshal_cmd_Normal3i *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3i, sizeof(*cmd));
+   cmd->nx = nx;
+   cmd->ny = ny;
+   cmd->nz = nz;
+}
+
+struct marshal_cmd_Normal3iv {
+   struct marshal_cmd_base header;
+   GLint v[3];
+};
+
+static void
+unmarshal_Normal3iv(GLcontext *ctx, const struct marshal_cmd_Normal3iv *cmd)
+{
+   CALL_Normal3iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Normal3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3iv *cmd;
+   cmd = (struct marshal_cmd_Normal3iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Normal3s {
+   struct marshal_cmd_base header;
+   GLshort nx;
+   GLshort ny;
+   GLshort nz;
+};
+
+static void
+unmarshal_Normal3s(GLcontext *ctx, const struct marshal_cmd_Normal3s *cmd)
+{
+   CALL_Normal3s(ctx->CurrentDispatch, (cmd->nx, cmd->ny, cmd->nz));
+}
+
+static void GLAPIENTRY
+marshal_Normal3s(GLshort nx, GLshort ny, GLshort nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3s *cmd;
+   cmd = (struct marshal_cmd_Normal3s *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3s, sizeof(*cmd));
+   cmd->nx = nx;
+   cmd->ny = ny;
+   cmd->nz = nz;
+}
+
+struct marshal_cmd_Normal3sv {
+   struct marshal_cmd_base header;
+   GLshort v[3];
+};
+
+static void
+unmarshal_Normal3sv(GLcontext *ctx, const struct marshal_cmd_Normal3sv *cmd)
+{
+   CALL_Normal3sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Normal3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Normal3sv *cmd;
+   cmd = (struct marshal_cmd_Normal3sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Normal3sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos2d {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+};
+
+static void
+unmarshal_RasterPos2d(GLcontext *ctx, const struct marshal_cmd_RasterPos2d *cmd)
+{
+   CALL_RasterPos2d(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos2d(GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos2d *cmd;
+   cmd = (struct marshal_cmd_RasterPos2d *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos2d, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_RasterPos2dv {
+   struct marshal_cmd_base header;
+   GLdouble v[2];
+};
+
+static void
+unmarshal_RasterPos2dv(GLcontext *ctx, const struct marshal_cmd_RasterPos2dv *cmd)
+{
+   CALL_RasterPos2dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos2dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos2dv *cmd;
+   cmd = (struct marshal_cmd_RasterPos2dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos2dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos2f {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+};
+
+static void
+unmarshal_RasterPos2f(GLcontext *ctx, const struct marshal_cmd_RasterPos2f *cmd)
+{
+   CALL_RasterPos2f(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos2f(GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos2f *cmd;
+   cmd = (struct marshal_cmd_RasterPos2f *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos2f, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_RasterPos2fv {
+   struct marshal_cmd_base header;
+   GLfloat v[2];
+};
+
+static void
+unmarshal_RasterPos2fv(GLcontext *ctx, const struct marshal_cmd_RasterPos2fv *cmd)
+{
+   CALL_RasterPos2fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos2fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos2fv *cmd;
+   cmd = (struct marshal_cmd_RasterPos2fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos2fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos2i {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+};
+
+static void
+unmarshal_RasterPos2i(GLcontext *ctx, const struct marshal_cmd_RasterPos2i *cmd)
+{
+   CALL_RasterPos2i(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos2i(GLint x, GLint y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos2i *cmd;
+   cmd = (struct marshal_cmd_RasterPos2i *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos2i, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_RasterPos2iv {
+   struct marshal_cmd_base header;
+   GLint v[2];
+};
+
+static void
+unmarshal_RasterPos2iv(GLcontext *ctx, const struct marshal_cmd_RasterPos2iv *cmd)
+{
+   CALL_RasterPos2iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos2iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos2iv *cmd;
+   cmd = (struct marshal_cmd_RasterPos2iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos2iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos2s {
+   struct marshal_cmd_base header;
+   GLshort x;
+   GLshort y;
+};
+
+static void
+unmarshal_RasterPos2s(GLcontext *ctx, const struct marshal_cmd_RasterPos2s *cmd)
+{
+   CALL_RasterPos2s(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos2s(GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos2s *cmd;
+   cmd = (struct marshal_cmd_RasterPos2s *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos2s, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_RasterPos2sv {
+   struct marshal_cmd_base header;
+   GLshort v[2];
+};
+
+static void
+unmarshal_RasterPos2sv(GLcontext *ctx, const struct marshal_cmd_RasterPos2sv *cmd)
+{
+   CALL_RasterPos2sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos2sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos2sv *cmd;
+   cmd = (struct marshal_cmd_RasterPos2sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos2sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos3d {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+};
+
+static void
+unmarshal_RasterPos3d(GLcontext *ctx, const struct marshal_cmd_RasterPos3d *cmd)
+{
+   CALL_RasterPos3d(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos3d(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos3d *cmd;
+   cmd = (struct marshal_cmd_RasterPos3d *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos3d, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_RasterPos3dv {
+   struct marshal_cmd_base header;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_RasterPos3dv(GLcontext *ctx, const struct marshal_cmd_RasterPos3dv *cmd)
+{
+   CALL_RasterPos3dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos3dv *cmd;
+   cmd = (struct marshal_cmd_RasterPos3dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos3dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos3f {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+};
+
+static void
+unmarshal_RasterPos3f(GLcontext *ctx, const struct marshal_cmd_RasterPos3f *cmd)
+{
+   CALL_RasterPos3f(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos3f(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos3f *cmd;
+   cmd = (struct marshal_cmd_RasterPos3f *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos3f, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_RasterPos3fv {
+   struct marshal_cmd_base header;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_RasterPos3fv(GLcontext *ctx, const struct marshal_cmd_RasterPos3fv *cmd)
+{
+   CALL_RasterPos3fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos3fv *cmd;
+   cmd = (struct marshal_cmd_RasterPos3fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos3fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos3i {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+   GLint z;
+};
+
+static void
+unmarshal_RasterPos3i(GLcontext *ctx, const struct marshal_cmd_RasterPos3i *cmd)
+{
+   CALL_RasterPos3i(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos3i(GLint x, GLint y, GLint z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos3i *cmd;
+   cmd = (struct marshal_cmd_RasterPos3i *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos3i, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_RasterPos3iv {
+   struct marshal_cmd_base header;
+   GLint v[3];
+};
+
+static void
+unmarshal_RasterPos3iv(GLcontext *ctx, const struct marshal_cmd_RasterPos3iv *cmd)
+{
+   CALL_RasterPos3iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos3iv *cmd;
+   cmd = (struct marshal_cmd_RasterPos3iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos3iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos3s {
+   struct marshal_cmd_base header;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+};
+
+static void
+unmarshal_RasterPos3s(GLcontext *ctx, const struct marshal_cmd_RasterPos3s *cmd)
+{
+   CALL_RasterPos3s(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos3s(GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos3s *cmd;
+   cmd = (struct marshal_cmd_RasterPos3s *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos3s, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_RasterPos3sv {
+   struct marshal_cmd_base header;
+   GLshort v[3];
+};
+
+static void
+unmarshal_RasterPos3sv(GLcontext *ctx, const struct marshal_cmd_RasterPos3sv *cmd)
+{
+   CALL_RasterPos3sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos3sv *cmd;
+   cmd = (struct marshal_cmd_RasterPos3sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos3sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos4d {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+};
+
+static void
+unmarshal_RasterPos4d(GLcontext *ctx, const struct marshal_cmd_RasterPos4d *cmd)
+{
+   CALL_RasterPos4d(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos4d *cmd;
+   cmd = (struct marshal_cmd_RasterPos4d *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos4d, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_RasterPos4dv {
+   struct marshal_cmd_base header;
+   GLdouble v[4];
+};
+
+static void
+unmarshal_RasterPos4dv(GLcontext *ctx, const struct marshal_cmd_RasterPos4dv *cmd)
+{
+   CALL_RasterPos4dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos4dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos4dv *cmd;
+   cmd = (struct marshal_cmd_RasterPos4dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos4dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos4f {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+};
+
+static void
+unmarshal_RasterPos4f(GLcontext *ctx, const struct marshal_cmd_RasterPos4f *cmd)
+{
+   CALL_RasterPos4f(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos4f *cmd;
+   cmd = (struct marshal_cmd_RasterPos4f *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos4f, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_RasterPos4fv {
+   struct marshal_cmd_base header;
+   GLfloat v[4];
+};
+
+static void
+unmarshal_RasterPos4fv(GLcontext *ctx, const struct marshal_cmd_RasterPos4fv *cmd)
+{
+   CALL_RasterPos4fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos4fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos4fv *cmd;
+   cmd = (struct marshal_cmd_RasterPos4fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos4fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos4i {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+   GLint z;
+   GLint w;
+};
+
+static void
+unmarshal_RasterPos4i(GLcontext *ctx, const struct marshal_cmd_RasterPos4i *cmd)
+{
+   CALL_RasterPos4i(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos4i(GLint x, GLint y, GLint z, GLint w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos4i *cmd;
+   cmd = (struct marshal_cmd_RasterPos4i *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos4i, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_RasterPos4iv {
+   struct marshal_cmd_base header;
+   GLint v[4];
+};
+
+static void
+unmarshal_RasterPos4iv(GLcontext *ctx, const struct marshal_cmd_RasterPos4iv *cmd)
+{
+   CALL_RasterPos4iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos4iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos4iv *cmd;
+   cmd = (struct marshal_cmd_RasterPos4iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos4iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_RasterPos4s {
+   struct marshal_cmd_base header;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+};
+
+static void
+unmarshal_RasterPos4s(GLcontext *ctx, const struct marshal_cmd_RasterPos4s *cmd)
+{
+   CALL_RasterPos4s(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos4s *cmd;
+   cmd = (struct marshal_cmd_RasterPos4s *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos4s, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_RasterPos4sv {
+   struct marshal_cmd_base header;
+   GLshort v[4];
+};
+
+static void
+unmarshal_RasterPos4sv(GLcontext *ctx, const struct marshal_cmd_RasterPos4sv *cmd)
+{
+   CALL_RasterPos4sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_RasterPos4sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RasterPos4sv *cmd;
+   cmd = (struct marshal_cmd_RasterPos4sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_RasterPos4sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Rectd {
+   struct marshal_cmd_base header;
+   GLdouble x1;
+   GLdouble y1;
+   GLdouble x2;
+   GLdouble y2;
+};
+
+static void
+unmarshal_Rectd(GLcontext *ctx, const struct marshal_cmd_Rectd *cmd)
+{
+   CALL_Rectd(ctx->CurrentDispatch, (cmd->x1, cmd->y1, cmd->x2, cmd->y2));
+}
+
+static void GLAPIENTRY
+marshal_Rectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Rectd *cmd;
+   cmd = (struct marshal_cmd_Rectd *)
+      marshal_alloc(ctx, DISPATCH_CMD_Rectd, sizeof(*cmd));
+   cmd->x1 = x1;
+   cmd->y1 = y1;
+   cmd->x2 = x2;
+   cmd->y2 = y2;
+}
+
+struct marshal_cmd_Rectdv {
+   struct marshal_cmd_base header;
+   GLdouble v1[2];
+   GLdouble v2[2];
+};
+
+static void
+unmarshal_Rectdv(GLcontext *ctx, const struct marshal_cmd_Rectdv *cmd)
+{
+   CALL_Rectdv(ctx->CurrentDispatch, (cmd->v1, cmd->v2));
+}
+
+static void GLAPIENTRY
+marshal_Rectdv(const GLdouble * v1, const GLdouble * v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Rectdv *cmd;
+   cmd = (struct marshal_cmd_Rectdv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Rectdv, sizeof(*cmd));
+   MEMCPY(cmd->v1, v1, sizeof(cmd->v1));
+   MEMCPY(cmd->v2, v2, sizeof(cmd->v2));
+}
+
+struct marshal_cmd_Rectf {
+   struct marshal_cmd_base header;
+   GLfloat x1;
+   GLfloat y1;
+   GLfloat x2;
+   GLfloat y2;
+};
+
+static void
+unmarshal_Rectf(GLcontext *ctx, const struct marshal_cmd_Rectf *cmd)
+{
+   CALL_Rectf(ctx->CurrentDispatch, (cmd->x1, cmd->y1, cmd->x2, cmd->y2));
+}
+
+static void GLAPIENTRY
+marshal_Rectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Rectf *cmd;
+   cmd = (struct marshal_cmd_Rectf *)
+      marshal_alloc(ctx, DISPATCH_CMD_Rectf, sizeof(*cmd));
+   cmd->x1 = x1;
+   cmd->y1 = y1;
+   cmd->x2 = x2;
+   cmd->y2 = y2;
+}
+
+struct marshal_cmd_Rectfv {
+   struct marshal_cmd_base header;
+   GLfloat v1[2];
+   GLfloat v2[2];
+};
+
+static void
+unmarshal_Rectfv(GLcontext *ctx, const struct marshal_cmd_Rectfv *cmd)
+{
+   CALL_Rectfv(ctx->CurrentDispatch, (cmd->v1, cmd->v2));
+}
+
+static void GLAPIENTRY
+marshal_Rectfv(const GLfloat * v1, const GLfloat * v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Rectfv *cmd;
+   cmd = (struct marshal_cmd_Rectfv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Rectfv, sizeof(*cmd));
+   MEMCPY(cmd->v1, v1, sizeof(cmd->v1));
+   MEMCPY(cmd->v2, v2, sizeof(cmd->v2));
+}
+
+struct marshal_cmd_Recti {
+   struct marshal_cmd_base header;
+   GLint x1;
+   GLint y1;
+   GLint x2;
+   GLint y2;
+};
+
+static void
+unmarshal_Recti(GLcontext *ctx, const struct marshal_cmd_Recti *cmd)
+{
+   CALL_Recti(ctx->CurrentDispatch, (cmd->x1, cmd->y1, cmd->x2, cmd->y2));
+}
+
+static void GLAPIENTRY
+marshal_Recti(GLint x1, GLint y1, GLint x2, GLint y2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Recti *cmd;
+   cmd = (struct marshal_cmd_Recti *)
+      marshal_alloc(ctx, DISPATCH_CMD_Recti, sizeof(*cmd));
+   cmd->x1 = x1;
+   cmd->y1 = y1;
+   cmd->x2 = x2;
+   cmd->y2 = y2;
+}
+
+struct marshal_cmd_Rectiv {
+   struct marshal_cmd_base header;
+   GLint v1[2];
+   GLint v2[2];
+};
+
+static void
+unmarshal_Rectiv(GLcontext *ctx, const struct marshal_cmd_Rectiv *cmd)
+{
+   CALL_Rectiv(ctx->CurrentDispatch, (cmd->v1, cmd->v2));
+}
+
+static void GLAPIENTRY
+marshal_Rectiv(const GLint * v1, const GLint * v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Rectiv *cmd;
+   cmd = (struct marshal_cmd_Rectiv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Rectiv, sizeof(*cmd));
+   MEMCPY(cmd->v1, v1, sizeof(cmd->v1));
+   MEMCPY(cmd->v2, v2, sizeof(cmd->v2));
+}
+
+struct marshal_cmd_Rects {
+   struct marshal_cmd_base header;
+   GLshort x1;
+   GLshort y1;
+   GLshort x2;
+   GLshort y2;
+};
+
+static void
+unmarshal_Rects(GLcontext *ctx, const struct marshal_cmd_Rects *cmd)
+{
+   CALL_Rects(ctx->CurrentDispatch, (cmd->x1, cmd->y1, cmd->x2, cmd->y2));
+}
+
+static void GLAPIENTRY
+marshal_Rects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Rects *cmd;
+   cmd = (struct marshal_cmd_Rects *)
+      marshal_alloc(ctx, DISPATCH_CMD_Rects, sizeof(*cmd));
+   cmd->x1 = x1;
+   cmd->y1 = y1;
+   cmd->x2 = x2;
+   cmd->y2 = y2;
+}
+
+struct marshal_cmd_Rectsv {
+   struct marshal_cmd_base header;
+   GLshort v1[2];
+   GLshort v2[2];
+};
+
+static void
+unmarshal_Rectsv(GLcontext *ctx, const struct marshal_cmd_Rectsv *cmd)
+{
+   CALL_Rectsv(ctx->CurrentDispatch, (cmd->v1, cmd->v2));
+}
+
+static void GLAPIENTRY
+marshal_Rectsv(const GLshort * v1, const GLshort * v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Rectsv *cmd;
+   cmd = (struct marshal_cmd_Rectsv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Rectsv, sizeof(*cmd));
+   MEMCPY(cmd->v1, v1, sizeof(cmd->v1));
+   MEMCPY(cmd->v2, v2, sizeof(cmd->v2));
+}
+
+struct marshal_cmd_TexCoord1d {
+   struct marshal_cmd_base header;
+   GLdouble s;
+};
+
+static void
+unmarshal_TexCoord1d(GLcontext *ctx, const struct marshal_cmd_TexCoord1d *cmd)
+{
+   CALL_TexCoord1d(ctx->CurrentDispatch, (cmd->s));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord1d(GLdouble s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord1d *cmd;
+   cmd = (struct marshal_cmd_TexCoord1d *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord1d, sizeof(*cmd));
+   cmd->s = s;
+}
+
+struct marshal_cmd_TexCoord1dv {
+   struct marshal_cmd_base header;
+   GLdouble v[1];
+};
+
+static void
+unmarshal_TexCoord1dv(GLcontext *ctx, const struct marshal_cmd_TexCoord1dv *cmd)
+{
+   CALL_TexCoord1dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord1dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord1dv *cmd;
+   cmd = (struct marshal_cmd_TexCoord1dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord1dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord1f {
+   struct marshal_cmd_base header;
+   GLfloat s;
+};
+
+static void
+unmarshal_TexCoord1f(GLcontext *ctx, const struct marshal_cmd_TexCoord1f *cmd)
+{
+   CALL_TexCoord1f(ctx->CurrentDispatch, (cmd->s));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord1f(GLfloat s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord1f *cmd;
+   cmd = (struct marshal_cmd_TexCoord1f *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord1f, sizeof(*cmd));
+   cmd->s = s;
+}
+
+struct marshal_cmd_TexCoord1fv {
+   struct marshal_cmd_base header;
+   GLfloat v[1];
+};
+
+static void
+unmarshal_TexCoord1fv(GLcontext *ctx, const struct marshal_cmd_TexCoord1fv *cmd)
+{
+   CALL_TexCoord1fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord1fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord1fv *cmd;
+   cmd = (struct marshal_cmd_TexCoord1fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord1fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord1i {
+   struct marshal_cmd_base header;
+   GLint s;
+};
+
+static void
+unmarshal_TexCoord1i(GLcontext *ctx, const struct marshal_cmd_TexCoord1i *cmd)
+{
+   CALL_TexCoord1i(ctx->CurrentDispatch, (cmd->s));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord1i(GLint s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord1i *cmd;
+   cmd = (struct marshal_cmd_TexCoord1i *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord1i, sizeof(*cmd));
+   cmd->s = s;
+}
+
+struct marshal_cmd_TexCoord1iv {
+   struct marshal_cmd_base header;
+   GLint v[1];
+};
+
+static void
+unmarshal_TexCoord1iv(GLcontext *ctx, const struct marshal_cmd_TexCoord1iv *cmd)
+{
+   CALL_TexCoord1iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord1iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord1iv *cmd;
+   cmd = (struct marshal_cmd_TexCoord1iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord1iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord1s {
+   struct marshal_cmd_base header;
+   GLshort s;
+};
+
+static void
+unmarshal_TexCoord1s(GLcontext *ctx, const struct marshal_cmd_TexCoord1s *cmd)
+{
+   CALL_TexCoord1s(ctx->CurrentDispatch, (cmd->s));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord1s(GLshort s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord1s *cmd;
+   cmd = (struct marshal_cmd_TexCoord1s *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord1s, sizeof(*cmd));
+   cmd->s = s;
+}
+
+struct marshal_cmd_TexCoord1sv {
+   struct marshal_cmd_base header;
+   GLshort v[1];
+};
+
+static void
+unmarshal_TexCoord1sv(GLcontext *ctx, const struct marshal_cmd_TexCoord1sv *cmd)
+{
+   CALL_TexCoord1sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord1sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord1sv *cmd;
+   cmd = (struct marshal_cmd_TexCoord1sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord1sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord2d {
+   struct marshal_cmd_base header;
+   GLdouble s;
+   GLdouble t;
+};
+
+static void
+unmarshal_TexCoord2d(GLcontext *ctx, const struct marshal_cmd_TexCoord2d *cmd)
+{
+   CALL_TexCoord2d(ctx->CurrentDispatch, (cmd->s, cmd->t));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord2d(GLdouble s, GLdouble t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord2d *cmd;
+   cmd = (struct marshal_cmd_TexCoord2d *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord2d, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+}
+
+struct marshal_cmd_TexCoord2dv {
+   struct marshal_cmd_base header;
+   GLdouble v[2];
+};
+
+static void
+unmarshal_TexCoord2dv(GLcontext *ctx, const struct marshal_cmd_TexCoord2dv *cmd)
+{
+   CALL_TexCoord2dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord2dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord2dv *cmd;
+   cmd = (struct marshal_cmd_TexCoord2dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord2dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord2f {
+   struct marshal_cmd_base header;
+   GLfloat s;
+   GLfloat t;
+};
+
+static void
+unmarshal_TexCoord2f(GLcontext *ctx, const struct marshal_cmd_TexCoord2f *cmd)
+{
+   CALL_TexCoord2f(ctx->CurrentDispatch, (cmd->s, cmd->t));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord2f(GLfloat s, GLfloat t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord2f *cmd;
+   cmd = (struct marshal_cmd_TexCoord2f *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord2f, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+}
+
+struct marshal_cmd_TexCoord2fv {
+   struct marshal_cmd_base header;
+   GLfloat v[2];
+};
+
+static void
+unmarshal_TexCoord2fv(GLcontext *ctx, const struct marshal_cmd_TexCoord2fv *cmd)
+{
+   CALL_TexCoord2fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord2fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord2fv *cmd;
+   cmd = (struct marshal_cmd_TexCoord2fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord2fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord2i {
+   struct marshal_cmd_base header;
+   GLint s;
+   GLint t;
+};
+
+static void
+unmarshal_TexCoord2i(GLcontext *ctx, const struct marshal_cmd_TexCoord2i *cmd)
+{
+   CALL_TexCoord2i(ctx->CurrentDispatch, (cmd->s, cmd->t));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord2i(GLint s, GLint t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord2i *cmd;
+   cmd = (struct marshal_cmd_TexCoord2i *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord2i, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+}
+
+struct marshal_cmd_TexCoord2iv {
+   struct marshal_cmd_base header;
+   GLint v[2];
+};
+
+static void
+unmarshal_TexCoord2iv(GLcontext *ctx, const struct marshal_cmd_TexCoord2iv *cmd)
+{
+   CALL_TexCoord2iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord2iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord2iv *cmd;
+   cmd = (struct marshal_cmd_TexCoord2iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord2iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord2s {
+   struct marshal_cmd_base header;
+   GLshort s;
+   GLshort t;
+};
+
+static void
+unmarshal_TexCoord2s(GLcontext *ctx, const struct marshal_cmd_TexCoord2s *cmd)
+{
+   CALL_TexCoord2s(ctx->CurrentDispatch, (cmd->s, cmd->t));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord2s(GLshort s, GLshort t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord2s *cmd;
+   cmd = (struct marshal_cmd_TexCoord2s *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord2s, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+}
+
+struct marshal_cmd_TexCoord2sv {
+   struct marshal_cmd_base header;
+   GLshort v[2];
+};
+
+static void
+unmarshal_TexCoord2sv(GLcontext *ctx, const struct marshal_cmd_TexCoord2sv *cmd)
+{
+   CALL_TexCoord2sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord2sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord2sv *cmd;
+   cmd = (struct marshal_cmd_TexCoord2sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord2sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord3d {
+   struct marshal_cmd_base header;
+   GLdouble s;
+   GLdouble t;
+   GLdouble r;
+};
+
+static void
+unmarshal_TexCoord3d(GLcontext *ctx, const struct marshal_cmd_TexCoord3d *cmd)
+{
+   CALL_TexCoord3d(ctx->CurrentDispatch, (cmd->s, cmd->t, cmd->r));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord3d(GLdouble s, GLdouble t, GLdouble r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord3d *cmd;
+   cmd = (struct marshal_cmd_TexCoord3d *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord3d, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+}
+
+struct marshal_cmd_TexCoord3dv {
+   struct marshal_cmd_base header;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_TexCoord3dv(GLcontext *ctx, const struct marshal_cmd_TexCoord3dv *cmd)
+{
+   CALL_TexCoord3dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord3dv *cmd;
+   cmd = (struct marshal_cmd_TexCoord3dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord3dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord3f {
+   struct marshal_cmd_base header;
+   GLfloat s;
+   GLfloat t;
+   GLfloat r;
+};
+
+static void
+unmarshal_TexCoord3f(GLcontext *ctx, const struct marshal_cmd_TexCoord3f *cmd)
+{
+   CALL_TexCoord3f(ctx->CurrentDispatch, (cmd->s, cmd->t, cmd->r));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord3f(GLfloat s, GLfloat t, GLfloat r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord3f *cmd;
+   cmd = (struct marshal_cmd_TexCoord3f *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord3f, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+}
+
+struct marshal_cmd_TexCoord3fv {
+   struct marshal_cmd_base header;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_TexCoord3fv(GLcontext *ctx, const struct marshal_cmd_TexCoord3fv *cmd)
+{
+   CALL_TexCoord3fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord3fv *cmd;
+   cmd = (struct marshal_cmd_TexCoord3fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord3fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord3i {
+   struct marshal_cmd_base header;
+   GLint s;
+   GLint t;
+   GLint r;
+};
+
+static void
+unmarshal_TexCoord3i(GLcontext *ctx, const struct marshal_cmd_TexCoord3i *cmd)
+{
+   CALL_TexCoord3i(ctx->CurrentDispatch, (cmd->s, cmd->t, cmd->r));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord3i(GLint s, GLint t, GLint r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord3i *cmd;
+   cmd = (struct marshal_cmd_TexCoord3i *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord3i, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+}
+
+struct marshal_cmd_TexCoord3iv {
+   struct marshal_cmd_base header;
+   GLint v[3];
+};
+
+static void
+unmarshal_TexCoord3iv(GLcontext *ctx, const struct marshal_cmd_TexCoord3iv *cmd)
+{
+   CALL_TexCoord3iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord3iv *cmd;
+   cmd = (struct marshal_cmd_TexCoord3iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord3iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord3s {
+   struct marshal_cmd_base header;
+   GLshort s;
+   GLshort t;
+   GLshort r;
+};
+
+static void
+unmarshal_TexCoord3s(GLcontext *ctx, const struct marshal_cmd_TexCoord3s *cmd)
+{
+   CALL_TexCoord3s(ctx->CurrentDispatch, (cmd->s, cmd->t, cmd->r));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord3s(GLshort s, GLshort t, GLshort r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord3s *cmd;
+   cmd = (struct marshal_cmd_TexCoord3s *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord3s, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+}
+
+struct marshal_cmd_TexCoord3sv {
+   struct marshal_cmd_base header;
+   GLshort v[3];
+};
+
+static void
+unmarshal_TexCoord3sv(GLcontext *ctx, const struct marshal_cmd_TexCoord3sv *cmd)
+{
+   CALL_TexCoord3sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord3sv *cmd;
+   cmd = (struct marshal_cmd_TexCoord3sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord3sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord4d {
+   struct marshal_cmd_base header;
+   GLdouble s;
+   GLdouble t;
+   GLdouble r;
+   GLdouble q;
+};
+
+static void
+unmarshal_TexCoord4d(GLcontext *ctx, const struct marshal_cmd_TexCoord4d *cmd)
+{
+   CALL_TexCoord4d(ctx->CurrentDispatch, (cmd->s, cmd->t, cmd->r, cmd->q));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord4d *cmd;
+   cmd = (struct marshal_cmd_TexCoord4d *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord4d, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+   cmd->q = q;
+}
+
+struct marshal_cmd_TexCoord4dv {
+   struct marshal_cmd_base header;
+   GLdouble v[4];
+};
+
+static void
+unmarshal_TexCoord4dv(GLcontext *ctx, const struct marshal_cmd_TexCoord4dv *cmd)
+{
+   CALL_TexCoord4dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord4dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord4dv *cmd;
+   cmd = (struct marshal_cmd_TexCoord4dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord4dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord4f {
+   struct marshal_cmd_base header;
+   GLfloat s;
+   GLfloat t;
+   GLfloat r;
+   GLfloat q;
+};
+
+static void
+unmarshal_TexCoord4f(GLcontext *ctx, const struct marshal_cmd_TexCoord4f *cmd)
+{
+   CALL_TexCoord4f(ctx->CurrentDispatch, (cmd->s, cmd->t, cmd->r, cmd->q));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord4f *cmd;
+   cmd = (struct marshal_cmd_TexCoord4f *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord4f, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+   cmd->q = q;
+}
+
+struct marshal_cmd_TexCoord4fv {
+   struct marshal_cmd_base header;
+   GLfloat v[4];
+};
+
+static void
+unmarshal_TexCoord4fv(GLcontext *ctx, const struct marshal_cmd_TexCoord4fv *cmd)
+{
+   CALL_TexCoord4fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord4fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord4fv *cmd;
+   cmd = (struct marshal_cmd_TexCoord4fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord4fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord4i {
+   struct marshal_cmd_base header;
+   GLint s;
+   GLint t;
+   GLint r;
+   GLint q;
+};
+
+static void
+unmarshal_TexCoord4i(GLcontext *ctx, const struct marshal_cmd_TexCoord4i *cmd)
+{
+   CALL_TexCoord4i(ctx->CurrentDispatch, (cmd->s, cmd->t, cmd->r, cmd->q));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord4i(GLint s, GLint t, GLint r, GLint q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord4i *cmd;
+   cmd = (struct marshal_cmd_TexCoord4i *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord4i, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+   cmd->q = q;
+}
+
+struct marshal_cmd_TexCoord4iv {
+   struct marshal_cmd_base header;
+   GLint v[4];
+};
+
+static void
+unmarshal_TexCoord4iv(GLcontext *ctx, const struct marshal_cmd_TexCoord4iv *cmd)
+{
+   CALL_TexCoord4iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord4iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord4iv *cmd;
+   cmd = (struct marshal_cmd_TexCoord4iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord4iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_TexCoord4s {
+   struct marshal_cmd_base header;
+   GLshort s;
+   GLshort t;
+   GLshort r;
+   GLshort q;
+};
+
+static void
+unmarshal_TexCoord4s(GLcontext *ctx, const struct marshal_cmd_TexCoord4s *cmd)
+{
+   CALL_TexCoord4s(ctx->CurrentDispatch, (cmd->s, cmd->t, cmd->r, cmd->q));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord4s *cmd;
+   cmd = (struct marshal_cmd_TexCoord4s *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord4s, sizeof(*cmd));
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+   cmd->q = q;
+}
+
+struct marshal_cmd_TexCoord4sv {
+   struct marshal_cmd_base header;
+   GLshort v[4];
+};
+
+static void
+unmarshal_TexCoord4sv(GLcontext *ctx, const struct marshal_cmd_TexCoord4sv *cmd)
+{
+   CALL_TexCoord4sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_TexCoord4sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexCoord4sv *cmd;
+   cmd = (struct marshal_cmd_TexCoord4sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexCoord4sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex2d {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+};
+
+static void
+unmarshal_Vertex2d(GLcontext *ctx, const struct marshal_cmd_Vertex2d *cmd)
+{
+   CALL_Vertex2d(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_Vertex2d(GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex2d *cmd;
+   cmd = (struct marshal_cmd_Vertex2d *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex2d, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_Vertex2dv {
+   struct marshal_cmd_base header;
+   GLdouble v[2];
+};
+
+static void
+unmarshal_Vertex2dv(GLcontext *ctx, const struct marshal_cmd_Vertex2dv *cmd)
+{
+   CALL_Vertex2dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex2dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex2dv *cmd;
+   cmd = (struct marshal_cmd_Vertex2dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex2dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex2f {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+};
+
+static void
+unmarshal_Vertex2f(GLcontext *ctx, const struct marshal_cmd_Vertex2f *cmd)
+{
+   CALL_Vertex2f(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_Vertex2f(GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex2f *cmd;
+   cmd = (struct marshal_cmd_Vertex2f *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex2f, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_Vertex2fv {
+   struct marshal_cmd_base header;
+   GLfloat v[2];
+};
+
+static void
+unmarshal_Vertex2fv(GLcontext *ctx, const struct marshal_cmd_Vertex2fv *cmd)
+{
+   CALL_Vertex2fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex2fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex2fv *cmd;
+   cmd = (struct marshal_cmd_Vertex2fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex2fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex2i {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+};
+
+static void
+unmarshal_Vertex2i(GLcontext *ctx, const struct marshal_cmd_Vertex2i *cmd)
+{
+   CALL_Vertex2i(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_Vertex2i(GLint x, GLint y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex2i *cmd;
+   cmd = (struct marshal_cmd_Vertex2i *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex2i, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_Vertex2iv {
+   struct marshal_cmd_base header;
+   GLint v[2];
+};
+
+static void
+unmarshal_Vertex2iv(GLcontext *ctx, const struct marshal_cmd_Vertex2iv *cmd)
+{
+   CALL_Vertex2iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex2iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex2iv *cmd;
+   cmd = (struct marshal_cmd_Vertex2iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex2iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex2s {
+   struct marshal_cmd_base header;
+   GLshort x;
+   GLshort y;
+};
+
+static void
+unmarshal_Vertex2s(GLcontext *ctx, const struct marshal_cmd_Vertex2s *cmd)
+{
+   CALL_Vertex2s(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_Vertex2s(GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex2s *cmd;
+   cmd = (struct marshal_cmd_Vertex2s *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex2s, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_Vertex2sv {
+   struct marshal_cmd_base header;
+   GLshort v[2];
+};
+
+static void
+unmarshal_Vertex2sv(GLcontext *ctx, const struct marshal_cmd_Vertex2sv *cmd)
+{
+   CALL_Vertex2sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex2sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex2sv *cmd;
+   cmd = (struct marshal_cmd_Vertex2sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex2sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex3d {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+};
+
+static void
+unmarshal_Vertex3d(GLcontext *ctx, const struct marshal_cmd_Vertex3d *cmd)
+{
+   CALL_Vertex3d(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Vertex3d(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex3d *cmd;
+   cmd = (struct marshal_cmd_Vertex3d *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex3d, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Vertex3dv {
+   struct marshal_cmd_base header;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_Vertex3dv(GLcontext *ctx, const struct marshal_cmd_Vertex3dv *cmd)
+{
+   CALL_Vertex3dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex3dv *cmd;
+   cmd = (struct marshal_cmd_Vertex3dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex3dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex3f {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+};
+
+static void
+unmarshal_Vertex3f(GLcontext *ctx, const struct marshal_cmd_Vertex3f *cmd)
+{
+   CALL_Vertex3f(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Vertex3f(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex3f *cmd;
+   cmd = (struct marshal_cmd_Vertex3f *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex3f, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Vertex3fv {
+   struct marshal_cmd_base header;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_Vertex3fv(GLcontext *ctx, const struct marshal_cmd_Vertex3fv *cmd)
+{
+   CALL_Vertex3fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex3fv *cmd;
+   cmd = (struct marshal_cmd_Vertex3fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex3fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex3i {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+   GLint z;
+};
+
+static void
+unmarshal_Vertex3i(GLcontext *ctx, const struct marshal_cmd_Vertex3i *cmd)
+{
+   CALL_Vertex3i(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Vertex3i(GLint x, GLint y, GLint z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex3i *cmd;
+   cmd = (struct marshal_cmd_Vertex3i *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex3i, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Vertex3iv {
+   struct marshal_cmd_base header;
+   GLint v[3];
+};
+
+static void
+unmarshal_Vertex3iv(GLcontext *ctx, const struct marshal_cmd_Vertex3iv *cmd)
+{
+   CALL_Vertex3iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex3iv *cmd;
+   cmd = (struct marshal_cmd_Vertex3iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex3iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex3s {
+   struct marshal_cmd_base header;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+};
+
+static void
+unmarshal_Vertex3s(GLcontext *ctx, const struct marshal_cmd_Vertex3s *cmd)
+{
+   CALL_Vertex3s(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Vertex3s(GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex3s *cmd;
+   cmd = (struct marshal_cmd_Vertex3s *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex3s, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Vertex3sv {
+   struct marshal_cmd_base header;
+   GLshort v[3];
+};
+
+static void
+unmarshal_Vertex3sv(GLcontext *ctx, const struct marshal_cmd_Vertex3sv *cmd)
+{
+   CALL_Vertex3sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex3sv *cmd;
+   cmd = (struct marshal_cmd_Vertex3sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex3sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex4d {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+};
+
+static void
+unmarshal_Vertex4d(GLcontext *ctx, const struct marshal_cmd_Vertex4d *cmd)
+{
+   CALL_Vertex4d(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_Vertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex4d *cmd;
+   cmd = (struct marshal_cmd_Vertex4d *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex4d, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_Vertex4dv {
+   struct marshal_cmd_base header;
+   GLdouble v[4];
+};
+
+static void
+unmarshal_Vertex4dv(GLcontext *ctx, const struct marshal_cmd_Vertex4dv *cmd)
+{
+   CALL_Vertex4dv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex4dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex4dv *cmd;
+   cmd = (struct marshal_cmd_Vertex4dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex4dv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex4f {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+};
+
+static void
+unmarshal_Vertex4f(GLcontext *ctx, const struct marshal_cmd_Vertex4f *cmd)
+{
+   CALL_Vertex4f(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_Vertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex4f *cmd;
+   cmd = (struct marshal_cmd_Vertex4f *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex4f, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_Vertex4fv {
+   struct marshal_cmd_base header;
+   GLfloat v[4];
+};
+
+static void
+unmarshal_Vertex4fv(GLcontext *ctx, const struct marshal_cmd_Vertex4fv *cmd)
+{
+   CALL_Vertex4fv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex4fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex4fv *cmd;
+   cmd = (struct marshal_cmd_Vertex4fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex4fv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex4i {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+   GLint z;
+   GLint w;
+};
+
+static void
+unmarshal_Vertex4i(GLcontext *ctx, const struct marshal_cmd_Vertex4i *cmd)
+{
+   CALL_Vertex4i(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_Vertex4i(GLint x, GLint y, GLint z, GLint w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex4i *cmd;
+   cmd = (struct marshal_cmd_Vertex4i *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex4i, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_Vertex4iv {
+   struct marshal_cmd_base header;
+   GLint v[4];
+};
+
+static void
+unmarshal_Vertex4iv(GLcontext *ctx, const struct marshal_cmd_Vertex4iv *cmd)
+{
+   CALL_Vertex4iv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex4iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex4iv *cmd;
+   cmd = (struct marshal_cmd_Vertex4iv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex4iv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_Vertex4s {
+   struct marshal_cmd_base header;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+};
+
+static void
+unmarshal_Vertex4s(GLcontext *ctx, const struct marshal_cmd_Vertex4s *cmd)
+{
+   CALL_Vertex4s(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_Vertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex4s *cmd;
+   cmd = (struct marshal_cmd_Vertex4s *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex4s, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_Vertex4sv {
+   struct marshal_cmd_base header;
+   GLshort v[4];
+};
+
+static void
+unmarshal_Vertex4sv(GLcontext *ctx, const struct marshal_cmd_Vertex4sv *cmd)
+{
+   CALL_Vertex4sv(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_Vertex4sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Vertex4sv *cmd;
+   cmd = (struct marshal_cmd_Vertex4sv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Vertex4sv, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_ClipPlane(GLenum plane, const GLdouble * equation)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ClipPlane(ctx->CurrentDispatch, (plane, equation));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ColorMaterial {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum mode;
+};
+
+static void
+unmarshal_ColorMaterial(GLcontext *ctx, const struct marshal_cmd_ColorMaterial *cmd)
+{
+   CALL_ColorMaterial(ctx->CurrentDispatch, (cmd->face, cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_ColorMaterial(GLenum face, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ColorMaterial *cmd;
+   cmd = (struct marshal_cmd_ColorMaterial *)
+      marshal_alloc(ctx, DISPATCH_CMD_ColorMaterial, sizeof(*cmd));
+   cmd->face = face;
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_CullFace {
+   struct marshal_cmd_base header;
+   GLenum mode;
+};
+
+static void
+unmarshal_CullFace(GLcontext *ctx, const struct marshal_cmd_CullFace *cmd)
+{
+   CALL_CullFace(ctx->CurrentDispatch, (cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_CullFace(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CullFace *cmd;
+   cmd = (struct marshal_cmd_CullFace *)
+      marshal_alloc(ctx, DISPATCH_CMD_CullFace, sizeof(*cmd));
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_Fogf {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_Fogf(GLcontext *ctx, const struct marshal_cmd_Fogf *cmd)
+{
+   CALL_Fogf(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_Fogf(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Fogf *cmd;
+   cmd = (struct marshal_cmd_Fogf *)
+      marshal_alloc(ctx, DISPATCH_CMD_Fogf, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_Fogfv {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_Fogfv(GLcontext *ctx, const struct marshal_cmd_Fogfv *cmd)
+{
+   CALL_Fogfv(ctx->CurrentDispatch, (cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_Fogfv(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_fog_count(pname);
+   struct marshal_cmd_Fogfv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_Fogfv(ctx->CurrentDispatch, (pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_Fogfv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Fogfv, sizeof(*cmd));
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLfloat));
+}
+
+struct marshal_cmd_Fogi {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_Fogi(GLcontext *ctx, const struct marshal_cmd_Fogi *cmd)
+{
+   CALL_Fogi(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_Fogi(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Fogi *cmd;
+   cmd = (struct marshal_cmd_Fogi *)
+      marshal_alloc(ctx, DISPATCH_CMD_Fogi, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_Fogiv {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint params[4];
+};
+
+static void
+unmarshal_Fogiv(GLcontext *ctx, const struct marshal_cmd_Fogiv *cmd)
+{
+   CALL_Fogiv(ctx->CurrentDispatch, (cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_Fogiv(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_fog_count(pname);
+   struct marshal_cmd_Fogiv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_Fogiv(ctx->CurrentDispatch, (pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_Fogiv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Fogiv, sizeof(*cmd));
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLint));
+}
+
+struct marshal_cmd_FrontFace {
+   struct marshal_cmd_base header;
+   GLenum mode;
+};
+
+static void
+unmarshal_FrontFace(GLcontext *ctx, const struct marshal_cmd_FrontFace *cmd)
+{
+   CALL_FrontFace(ctx->CurrentDispatch, (cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_FrontFace(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FrontFace *cmd;
+   cmd = (struct marshal_cmd_FrontFace *)
+      marshal_alloc(ctx, DISPATCH_CMD_FrontFace, sizeof(*cmd));
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_Hint {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum mode;
+};
+
+static void
+unmarshal_Hint(GLcontext *ctx, const struct marshal_cmd_Hint *cmd)
+{
+   CALL_Hint(ctx->CurrentDispatch, (cmd->target, cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_Hint(GLenum target, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Hint *cmd;
+   cmd = (struct marshal_cmd_Hint *)
+      marshal_alloc(ctx, DISPATCH_CMD_Hint, sizeof(*cmd));
+   cmd->target = target;
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_Lightf {
+   struct marshal_cmd_base header;
+   GLenum light;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_Lightf(GLcontext *ctx, const struct marshal_cmd_Lightf *cmd)
+{
+   CALL_Lightf(ctx->CurrentDispatch, (cmd->light, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_Lightf(GLenum light, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Lightf *cmd;
+   cmd = (struct marshal_cmd_Lightf *)
+      marshal_alloc(ctx, DISPATCH_CMD_Lightf, sizeof(*cmd));
+   cmd->light = light;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_Lightfv {
+   struct marshal_cmd_base header;
+   GLenum light;
+   GLenum pname;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_Lightfv(GLcontext *ctx, const struct marshal_cmd_Lightfv *cmd)
+{
+   CALL_Lightfv(ctx->CurrentDispatch, (cmd->light, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_Lightfv(GLenum light, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_light_count(pname);
+   struct marshal_cmd_Lightfv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_Lightfv(ctx->CurrentDispatch, (light, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_Lightfv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Lightfv, sizeof(*cmd));
+   cmd->light = light;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLfloat));
+}
+
+struct marshal_cmd_Lighti {
+   struct marshal_cmd_base header;
+   GLenum light;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_Lighti(GLcontext *ctx, const struct marshal_cmd_Lighti *cmd)
+{
+   CALL_Lighti(ctx->CurrentDispatch, (cmd->light, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_Lighti(GLenum light, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Lighti *cmd;
+   cmd = (struct marshal_cmd_Lighti *)
+      marshal_alloc(ctx, DISPATCH_CMD_Lighti, sizeof(*cmd));
+   cmd->light = light;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_Lightiv {
+   struct marshal_cmd_base header;
+   GLenum light;
+   GLenum pname;
+   GLint params[4];
+};
+
+static void
+unmarshal_Lightiv(GLcontext *ctx, const struct marshal_cmd_Lightiv *cmd)
+{
+   CALL_Lightiv(ctx->CurrentDispatch, (cmd->light, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_Lightiv(GLenum light, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_light_count(pname);
+   struct marshal_cmd_Lightiv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_Lightiv(ctx->CurrentDispatch, (light, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_Lightiv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Lightiv, sizeof(*cmd));
+   cmd->light = light;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLint));
+}
+
+struct marshal_cmd_LightModelf {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_LightModelf(GLcontext *ctx, const struct marshal_cmd_LightModelf *cmd)
+{
+   CALL_LightModelf(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_LightModelf(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LightModelf *cmd;
+   cmd = (struct marshal_cmd_LightModelf *)
+      marshal_alloc(ctx, DISPATCH_CMD_LightModelf, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_LightModelfv {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_LightModelfv(GLcontext *ctx, const struct marshal_cmd_LightModelfv *cmd)
+{
+   CALL_LightModelfv(ctx->CurrentDispatch, (cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_LightModelfv(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_light_model_count(pname);
+   struct marshal_cmd_LightModelfv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_LightModelfv(ctx->CurrentDispatch, (pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_LightModelfv *)
+      marshal_alloc(ctx, DISPATCH_CMD_LightModelfv, sizeof(*cmd));
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLfloat));
+}
+
+struct marshal_cmd_LightModeli {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_LightModeli(GLcontext *ctx, const struct marshal_cmd_LightModeli *cmd)
+{
+   CALL_LightModeli(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_LightModeli(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LightModeli *cmd;
+   cmd = (struct marshal_cmd_LightModeli *)
+      marshal_alloc(ctx, DISPATCH_CMD_LightModeli, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_LightModeliv {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint params[4];
+};
+
+static void
+unmarshal_LightModeliv(GLcontext *ctx, const struct marshal_cmd_LightModeliv *cmd)
+{
+   CALL_LightModeliv(ctx->CurrentDispatch, (cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_LightModeliv(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_light_model_count(pname);
+   struct marshal_cmd_LightModeliv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_LightModeliv(ctx->CurrentDispatch, (pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_LightModeliv *)
+      marshal_alloc(ctx, DISPATCH_CMD_LightModeliv, sizeof(*cmd));
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLint));
+}
+
+struct marshal_cmd_LineStipple {
+   struct marshal_cmd_base header;
+   GLint factor;
+   GLushort pattern;
+};
+
+static void
+unmarshal_LineStipple(GLcontext *ctx, const struct marshal_cmd_LineStipple *cmd)
+{
+   CALL_LineStipple(ctx->CurrentDispatch, (cmd->factor, cmd->pattern));
+}
+
+static void GLAPIENTRY
+marshal_LineStipple(GLint factor, GLushort pattern)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LineStipple *cmd;
+   cmd = (struct marshal_cmd_LineStipple *)
+      marshal_alloc(ctx, DISPATCH_CMD_LineStipple, sizeof(*cmd));
+   cmd->factor = factor;
+   cmd->pattern = pattern;
+}
+
+struct marshal_cmd_LineWidth {
+   struct marshal_cmd_base header;
+   GLfloat width;
+};
+
+static void
+unmarshal_LineWidth(GLcontext *ctx, const struct marshal_cmd_LineWidth *cmd)
+{
+   CALL_LineWidth(ctx->CurrentDispatch, (cmd->width));
+}
+
+static void GLAPIENTRY
+marshal_LineWidth(GLfloat width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LineWidth *cmd;
+   cmd = (struct marshal_cmd_LineWidth *)
+      marshal_alloc(ctx, DISPATCH_CMD_LineWidth, sizeof(*cmd));
+   cmd->width = width;
+}
+
+struct marshal_cmd_Materialf {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_Materialf(GLcontext *ctx, const struct marshal_cmd_Materialf *cmd)
+{
+   CALL_Materialf(ctx->CurrentDispatch, (cmd->face, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_Materialf(GLenum face, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Materialf *cmd;
+   cmd = (struct marshal_cmd_Materialf *)
+      marshal_alloc(ctx, DISPATCH_CMD_Materialf, sizeof(*cmd));
+   cmd->face = face;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_Materialfv {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum pname;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_Materialfv(GLcontext *ctx, const struct marshal_cmd_Materialfv *cmd)
+{
+   CALL_Materialfv(ctx->CurrentDispatch, (cmd->face, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_Materialfv(GLenum face, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_material_count(pname);
+   struct marshal_cmd_Materialfv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_Materialfv(ctx->CurrentDispatch, (face, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_Materialfv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Materialfv, sizeof(*cmd));
+   cmd->face = face;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLfloat));
+}
+
+struct marshal_cmd_Materiali {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_Materiali(GLcontext *ctx, const struct marshal_cmd_Materiali *cmd)
+{
+   CALL_Materiali(ctx->CurrentDispatch, (cmd->face, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_Materiali(GLenum face, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Materiali *cmd;
+   cmd = (struct marshal_cmd_Materiali *)
+      marshal_alloc(ctx, DISPATCH_CMD_Materiali, sizeof(*cmd));
+   cmd->face = face;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_Materialiv {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum pname;
+   GLint params[4];
+};
+
+static void
+unmarshal_Materialiv(GLcontext *ctx, const struct marshal_cmd_Materialiv *cmd)
+{
+   CALL_Materialiv(ctx->CurrentDispatch, (cmd->face, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_Materialiv(GLenum face, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_material_count(pname);
+   struct marshal_cmd_Materialiv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_Materialiv(ctx->CurrentDispatch, (face, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_Materialiv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Materialiv, sizeof(*cmd));
+   cmd->face = face;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLint));
+}
+
+struct marshal_cmd_PointSize {
+   struct marshal_cmd_base header;
+   GLfloat size;
+};
+
+static void
+unmarshal_PointSize(GLcontext *ctx, const struct marshal_cmd_PointSize *cmd)
+{
+   CALL_PointSize(ctx->CurrentDispatch, (cmd->size));
+}
+
+static void GLAPIENTRY
+marshal_PointSize(GLfloat size)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PointSize *cmd;
+   cmd = (struct marshal_cmd_PointSize *)
+      marshal_alloc(ctx, DISPATCH_CMD_PointSize, sizeof(*cmd));
+   cmd->size = size;
+}
+
+struct marshal_cmd_PolygonMode {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum mode;
+};
+
+static void
+unmarshal_PolygonMode(GLcontext *ctx, const struct marshal_cmd_PolygonMode *cmd)
+{
+   CALL_PolygonMode(ctx->CurrentDispatch, (cmd->face, cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_PolygonMode(GLenum face, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PolygonMode *cmd;
+   cmd = (struct marshal_cmd_PolygonMode *)
+      marshal_alloc(ctx, DISPATCH_CMD_PolygonMode, sizeof(*cmd));
+   cmd->face = face;
+   cmd->mode = mode;
+}
+
+static void GLAPIENTRY
+marshal_PolygonStipple(const GLubyte * mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_PolygonStipple(ctx->CurrentDispatch, (mask));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_Scissor {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+};
+
+static void
+unmarshal_Scissor(GLcontext *ctx, const struct marshal_cmd_Scissor *cmd)
+{
+   CALL_Scissor(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->width, cmd->height));
+}
+
+static void GLAPIENTRY
+marshal_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Scissor *cmd;
+   cmd = (struct marshal_cmd_Scissor *)
+      marshal_alloc(ctx, DISPATCH_CMD_Scissor, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+   cmd->height = height;
+}
+
+struct marshal_cmd_ShadeModel {
+   struct marshal_cmd_base header;
+   GLenum mode;
+};
+
+static void
+unmarshal_ShadeModel(GLcontext *ctx, const struct marshal_cmd_ShadeModel *cmd)
+{
+   CALL_ShadeModel(ctx->CurrentDispatch, (cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_ShadeModel(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ShadeModel *cmd;
+   cmd = (struct marshal_cmd_ShadeModel *)
+      marshal_alloc(ctx, DISPATCH_CMD_ShadeModel, sizeof(*cmd));
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_TexParameterf {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_TexParameterf(GLcontext *ctx, const struct marshal_cmd_TexParameterf *cmd)
+{
+   CALL_TexParameterf(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_TexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexParameterf *cmd;
+   cmd = (struct marshal_cmd_TexParameterf *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexParameterf, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_TexParameterfv {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_TexParameterfv(GLcontext *ctx, const struct marshal_cmd_TexParameterfv *cmd)
+{
+   CALL_TexParameterfv(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_TexParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_tex_parameter_count(pname);
+   struct marshal_cmd_TexParameterfv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_TexParameterfv(ctx->CurrentDispatch, (target, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_TexParameterfv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexParameterfv, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLfloat));
+}
+
+struct marshal_cmd_TexParameteri {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_TexParameteri(GLcontext *ctx, const struct marshal_cmd_TexParameteri *cmd)
+{
+   CALL_TexParameteri(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_TexParameteri(GLenum target, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexParameteri *cmd;
+   cmd = (struct marshal_cmd_TexParameteri *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexParameteri, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_TexParameteriv {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLint params[4];
+};
+
+static void
+unmarshal_TexParameteriv(GLcontext *ctx, const struct marshal_cmd_TexParameteriv *cmd)
+{
+   CALL_TexParameteriv(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_TexParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_tex_parameter_count(pname);
+   struct marshal_cmd_TexParameteriv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_TexParameteriv(ctx->CurrentDispatch, (target, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_TexParameteriv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexParameteriv, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLint));
+}
+
+static void GLAPIENTRY
+marshal_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexImage1D(ctx->CurrentDispatch, (target, level, internalformat, width, border, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexImage2D(ctx->CurrentDispatch, (target, level, internalformat, width, height, border, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_TexEnvf {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_TexEnvf(GLcontext *ctx, const struct marshal_cmd_TexEnvf *cmd)
+{
+   CALL_TexEnvf(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_TexEnvf(GLenum target, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexEnvf *cmd;
+   cmd = (struct marshal_cmd_TexEnvf *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexEnvf, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_TexEnvfv {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_TexEnvfv(GLcontext *ctx, const struct marshal_cmd_TexEnvfv *cmd)
+{
+   CALL_TexEnvfv(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_TexEnvfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_tex_env_count(pname);
+   struct marshal_cmd_TexEnvfv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_TexEnvfv(ctx->CurrentDispatch, (target, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_TexEnvfv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexEnvfv, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLfloat));
+}
+
+struct marshal_cmd_TexEnvi {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_TexEnvi(GLcontext *ctx, const struct marshal_cmd_TexEnvi *cmd)
+{
+   CALL_TexEnvi(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_TexEnvi(GLenum target, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexEnvi *cmd;
+   cmd = (struct marshal_cmd_TexEnvi *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexEnvi, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_TexEnviv {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLint params[4];
+};
+
+static void
+unmarshal_TexEnviv(GLcontext *ctx, const struct marshal_cmd_TexEnviv *cmd)
+{
+   CALL_TexEnviv(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_TexEnviv(GLenum target, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_tex_env_count(pname);
+   struct marshal_cmd_TexEnviv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_TexEnviv(ctx->CurrentDispatch, (target, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_TexEnviv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexEnviv, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLint));
+}
+
+struct marshal_cmd_TexGend {
+   struct marshal_cmd_base header;
+   GLenum coord;
+   GLenum pname;
+   GLdouble param;
+};
+
+static void
+unmarshal_TexGend(GLcontext *ctx, const struct marshal_cmd_TexGend *cmd)
+{
+   CALL_TexGend(ctx->CurrentDispatch, (cmd->coord, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_TexGend(GLenum coord, GLenum pname, GLdouble param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexGend *cmd;
+   cmd = (struct marshal_cmd_TexGend *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexGend, sizeof(*cmd));
+   cmd->coord = coord;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_TexGendv {
+   struct marshal_cmd_base header;
+   GLenum coord;
+   GLenum pname;
+   GLdouble params[4];
+};
+
+static void
+unmarshal_TexGendv(GLcontext *ctx, const struct marshal_cmd_TexGendv *cmd)
+{
+   CALL_TexGendv(ctx->CurrentDispatch, (cmd->coord, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_TexGendv(GLenum coord, GLenum pname, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_tex_gen_count(pname);
+   struct marshal_cmd_TexGendv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_TexGendv(ctx->CurrentDispatch, (coord, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_TexGendv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexGendv, sizeof(*cmd));
+   cmd->coord = coord;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLdouble));
+}
+
+struct marshal_cmd_TexGenf {
+   struct marshal_cmd_base header;
+   GLenum coord;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_TexGenf(GLcontext *ctx, const struct marshal_cmd_TexGenf *cmd)
+{
+   CALL_TexGenf(ctx->CurrentDispatch, (cmd->coord, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_TexGenf(GLenum coord, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexGenf *cmd;
+   cmd = (struct marshal_cmd_TexGenf *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexGenf, sizeof(*cmd));
+   cmd->coord = coord;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_TexGenfv {
+   struct marshal_cmd_base header;
+   GLenum coord;
+   GLenum pname;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_TexGenfv(GLcontext *ctx, const struct marshal_cmd_TexGenfv *cmd)
+{
+   CALL_TexGenfv(ctx->CurrentDispatch, (cmd->coord, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_TexGenfv(GLenum coord, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_tex_gen_count(pname);
+   struct marshal_cmd_TexGenfv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_TexGenfv(ctx->CurrentDispatch, (coord, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_TexGenfv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexGenfv, sizeof(*cmd));
+   cmd->coord = coord;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLfloat));
+}
+
+struct marshal_cmd_TexGeni {
+   struct marshal_cmd_base header;
+   GLenum coord;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_TexGeni(GLcontext *ctx, const struct marshal_cmd_TexGeni *cmd)
+{
+   CALL_TexGeni(ctx->CurrentDispatch, (cmd->coord, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_TexGeni(GLenum coord, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TexGeni *cmd;
+   cmd = (struct marshal_cmd_TexGeni *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexGeni, sizeof(*cmd));
+   cmd->coord = coord;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_TexGeniv {
+   struct marshal_cmd_base header;
+   GLenum coord;
+   GLenum pname;
+   GLint params[4];
+};
+
+static void
+unmarshal_TexGeniv(GLcontext *ctx, const struct marshal_cmd_TexGeniv *cmd)
+{
+   CALL_TexGeniv(ctx->CurrentDispatch, (cmd->coord, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_TexGeniv(GLenum coord, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLuint count = _mesa_tex_gen_count(pname);
+   struct marshal_cmd_TexGeniv *cmd;
+   if (count == 0) {
+      marshal_sync_begin(ctx);
+      CALL_TexGeniv(ctx->CurrentDispatch, (coord, pname, params));
+      marshal_sync_end(ctx);
+      return;
+   }
+   cmd = (struct marshal_cmd_TexGeniv *)
+      marshal_alloc(ctx, DISPATCH_CMD_TexGeniv, sizeof(*cmd));
+   cmd->coord = coord;
+   cmd->pname = pname;
+   MEMCPY(cmd->params, params, count * sizeof(GLint));
+}
+
+static void GLAPIENTRY
+marshal_FeedbackBuffer(GLsizei size, GLenum type, GLfloat * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_FeedbackBuffer(ctx->CurrentDispatch, (size, type, buffer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_SelectBuffer(GLsizei size, GLuint * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_SelectBuffer(ctx->CurrentDispatch, (size, buffer));
+   marshal_sync_end(ctx);
+}
+
+static GLint GLAPIENTRY
+marshal_RenderMode(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_RenderMode(ctx->CurrentDispatch, (mode));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_InitNames {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_InitNames(GLcontext *ctx, const struct marshal_cmd_InitNames *cmd)
+{
+   CALL_InitNames(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_InitNames(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_InitNames *cmd;
+   cmd = (struct marshal_cmd_InitNames *)
+      marshal_alloc(ctx, DISPATCH_CMD_InitNames, sizeof(*cmd));
+}
+
+struct marshal_cmd_LoadName {
+   struct marshal_cmd_base header;
+   GLuint name;
+};
+
+static void
+unmarshal_LoadName(GLcontext *ctx, const struct marshal_cmd_LoadName *cmd)
+{
+   CALL_LoadName(ctx->CurrentDispatch, (cmd->name));
+}
+
+static void GLAPIENTRY
+marshal_LoadName(GLuint name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LoadName *cmd;
+   cmd = (struct marshal_cmd_LoadName *)
+      marshal_alloc(ctx, DISPATCH_CMD_LoadName, sizeof(*cmd));
+   cmd->name = name;
+}
+
+struct marshal_cmd_PassThrough {
+   struct marshal_cmd_base header;
+   GLfloat token;
+};
+
+static void
+unmarshal_PassThrough(GLcontext *ctx, const struct marshal_cmd_PassThrough *cmd)
+{
+   CALL_PassThrough(ctx->CurrentDispatch, (cmd->token));
+}
+
+static void GLAPIENTRY
+marshal_PassThrough(GLfloat token)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PassThrough *cmd;
+   cmd = (struct marshal_cmd_PassThrough *)
+      marshal_alloc(ctx, DISPATCH_CMD_PassThrough, sizeof(*cmd));
+   cmd->token = token;
+}
+
+struct marshal_cmd_PopName {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_PopName(GLcontext *ctx, const struct marshal_cmd_PopName *cmd)
+{
+   CALL_PopName(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_PopName(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PopName *cmd;
+   cmd = (struct marshal_cmd_PopName *)
+      marshal_alloc(ctx, DISPATCH_CMD_PopName, sizeof(*cmd));
+}
+
+struct marshal_cmd_PushName {
+   struct marshal_cmd_base header;
+   GLuint name;
+};
+
+static void
+unmarshal_PushName(GLcontext *ctx, const struct marshal_cmd_PushName *cmd)
+{
+   CALL_PushName(ctx->CurrentDispatch, (cmd->name));
+}
+
+static void GLAPIENTRY
+marshal_PushName(GLuint name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PushName *cmd;
+   cmd = (struct marshal_cmd_PushName *)
+      marshal_alloc(ctx, DISPATCH_CMD_PushName, sizeof(*cmd));
+   cmd->name = name;
+}
+
+struct marshal_cmd_DrawBuffer {
+   struct marshal_cmd_base header;
+   GLenum mode;
+};
+
+static void
+unmarshal_DrawBuffer(GLcontext *ctx, const struct marshal_cmd_DrawBuffer *cmd)
+{
+   CALL_DrawBuffer(ctx->CurrentDispatch, (cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_DrawBuffer(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DrawBuffer *cmd;
+   cmd = (struct marshal_cmd_DrawBuffer *)
+      marshal_alloc(ctx, DISPATCH_CMD_DrawBuffer, sizeof(*cmd));
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_Clear {
+   struct marshal_cmd_base header;
+   GLbitfield mask;
+};
+
+static void
+unmarshal_Clear(GLcontext *ctx, const struct marshal_cmd_Clear *cmd)
+{
+   CALL_Clear(ctx->CurrentDispatch, (cmd->mask));
+}
+
+static void GLAPIENTRY
+marshal_Clear(GLbitfield mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Clear *cmd;
+   cmd = (struct marshal_cmd_Clear *)
+      marshal_alloc(ctx, DISPATCH_CMD_Clear, sizeof(*cmd));
+   cmd->mask = mask;
+}
+
+struct marshal_cmd_ClearAccum {
+   struct marshal_cmd_base header;
+   GLfloat red;
+   GLfloat green;
+   GLfloat blue;
+   GLfloat alpha;
+};
+
+static void
+unmarshal_ClearAccum(GLcontext *ctx, const struct marshal_cmd_ClearAccum *cmd)
+{
+   CALL_ClearAccum(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_ClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ClearAccum *cmd;
+   cmd = (struct marshal_cmd_ClearAccum *)
+      marshal_alloc(ctx, DISPATCH_CMD_ClearAccum, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_ClearIndex {
+   struct marshal_cmd_base header;
+   GLfloat c;
+};
+
+static void
+unmarshal_ClearIndex(GLcontext *ctx, const struct marshal_cmd_ClearIndex *cmd)
+{
+   CALL_ClearIndex(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_ClearIndex(GLfloat c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ClearIndex *cmd;
+   cmd = (struct marshal_cmd_ClearIndex *)
+      marshal_alloc(ctx, DISPATCH_CMD_ClearIndex, sizeof(*cmd));
+   cmd->c = c;
+}
+
+struct marshal_cmd_ClearColor {
+   struct marshal_cmd_base header;
+   GLclampf red;
+   GLclampf green;
+   GLclampf blue;
+   GLclampf alpha;
+};
+
+static void
+unmarshal_ClearColor(GLcontext *ctx, const struct marshal_cmd_ClearColor *cmd)
+{
+   CALL_ClearColor(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_ClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ClearColor *cmd;
+   cmd = (struct marshal_cmd_ClearColor *)
+      marshal_alloc(ctx, DISPATCH_CMD_ClearColor, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_ClearStencil {
+   struct marshal_cmd_base header;
+   GLint s;
+};
+
+static void
+unmarshal_ClearStencil(GLcontext *ctx, const struct marshal_cmd_ClearStencil *cmd)
+{
+   CALL_ClearStencil(ctx->CurrentDispatch, (cmd->s));
+}
+
+static void GLAPIENTRY
+marshal_ClearStencil(GLint s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ClearStencil *cmd;
+   cmd = (struct marshal_cmd_ClearStencil *)
+      marshal_alloc(ctx, DISPATCH_CMD_ClearStencil, sizeof(*cmd));
+   cmd->s = s;
+}
+
+struct marshal_cmd_ClearDepth {
+   struct marshal_cmd_base header;
+   GLclampd depth;
+};
+
+static void
+unmarshal_ClearDepth(GLcontext *ctx, const struct marshal_cmd_ClearDepth *cmd)
+{
+   CALL_ClearDepth(ctx->CurrentDispatch, (cmd->depth));
+}
+
+static void GLAPIENTRY
+marshal_ClearDepth(GLclampd depth)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ClearDepth *cmd;
+   cmd = (struct marshal_cmd_ClearDepth *)
+      marshal_alloc(ctx, DISPATCH_CMD_ClearDepth, sizeof(*cmd));
+   cmd->depth = depth;
+}
+
+struct marshal_cmd_StencilMask {
+   struct marshal_cmd_base header;
+   GLuint mask;
+};
+
+static void
+unmarshal_StencilMask(GLcontext *ctx, const struct marshal_cmd_StencilMask *cmd)
+{
+   CALL_StencilMask(ctx->CurrentDispatch, (cmd->mask));
+}
+
+static void GLAPIENTRY
+marshal_StencilMask(GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_StencilMask *cmd;
+   cmd = (struct marshal_cmd_StencilMask *)
+      marshal_alloc(ctx, DISPATCH_CMD_StencilMask, sizeof(*cmd));
+   cmd->mask = mask;
+}
+
+struct marshal_cmd_ColorMask {
+   struct marshal_cmd_base header;
+   GLboolean red;
+   GLboolean green;
+   GLboolean blue;
+   GLboolean alpha;
+};
+
+static void
+unmarshal_ColorMask(GLcontext *ctx, const struct marshal_cmd_ColorMask *cmd)
+{
+   CALL_ColorMask(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ColorMask *cmd;
+   cmd = (struct marshal_cmd_ColorMask *)
+      marshal_alloc(ctx, DISPATCH_CMD_ColorMask, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_DepthMask {
+   struct marshal_cmd_base header;
+   GLboolean flag;
+};
+
+static void
+unmarshal_DepthMask(GLcontext *ctx, const struct marshal_cmd_DepthMask *cmd)
+{
+   CALL_DepthMask(ctx->CurrentDispatch, (cmd->flag));
+}
+
+static void GLAPIENTRY
+marshal_DepthMask(GLboolean flag)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DepthMask *cmd;
+   cmd = (struct marshal_cmd_DepthMask *)
+      marshal_alloc(ctx, DISPATCH_CMD_DepthMask, sizeof(*cmd));
+   cmd->flag = flag;
+}
+
+struct marshal_cmd_IndexMask {
+   struct marshal_cmd_base header;
+   GLuint mask;
+};
+
+static void
+unmarshal_IndexMask(GLcontext *ctx, const struct marshal_cmd_IndexMask *cmd)
+{
+   CALL_IndexMask(ctx->CurrentDispatch, (cmd->mask));
+}
+
+static void GLAPIENTRY
+marshal_IndexMask(GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_IndexMask *cmd;
+   cmd = (struct marshal_cmd_IndexMask *)
+      marshal_alloc(ctx, DISPATCH_CMD_IndexMask, sizeof(*cmd));
+   cmd->mask = mask;
+}
+
+struct marshal_cmd_Accum {
+   struct marshal_cmd_base header;
+   GLenum op;
+   GLfloat value;
+};
+
+static void
+unmarshal_Accum(GLcontext *ctx, const struct marshal_cmd_Accum *cmd)
+{
+   CALL_Accum(ctx->CurrentDispatch, (cmd->op, cmd->value));
+}
+
+static void GLAPIENTRY
+marshal_Accum(GLenum op, GLfloat value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Accum *cmd;
+   cmd = (struct marshal_cmd_Accum *)
+      marshal_alloc(ctx, DISPATCH_CMD_Accum, sizeof(*cmd));
+   cmd->op = op;
+   cmd->value = value;
+}
+
+struct marshal_cmd_Disable {
+   struct marshal_cmd_base header;
+   GLenum cap;
+};
+
+static void
+unmarshal_Disable(GLcontext *ctx, const struct marshal_cmd_Disable *cmd)
+{
+   CALL_Disable(ctx->CurrentDispatch, (cmd->cap));
+}
+
+static void GLAPIENTRY
+marshal_Disable(GLenum cap)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Disable *cmd;
+   cmd = (struct marshal_cmd_Disable *)
+      marshal_alloc(ctx, DISPATCH_CMD_Disable, sizeof(*cmd));
+   cmd->cap = cap;
+}
+
+struct marshal_cmd_Enable {
+   struct marshal_cmd_base header;
+   GLenum cap;
+};
+
+static void
+unmarshal_Enable(GLcontext *ctx, const struct marshal_cmd_Enable *cmd)
+{
+   CALL_Enable(ctx->CurrentDispatch, (cmd->cap));
+}
+
+static void GLAPIENTRY
+marshal_Enable(GLenum cap)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Enable *cmd;
+   cmd = (struct marshal_cmd_Enable *)
+      marshal_alloc(ctx, DISPATCH_CMD_Enable, sizeof(*cmd));
+   cmd->cap = cap;
+}
+
+static void GLAPIENTRY
+marshal_Finish(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Finish(ctx->CurrentDispatch, ());
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_Flush {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_Flush(GLcontext *ctx, const struct marshal_cmd_Flush *cmd)
+{
+   CALL_Flush(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_Flush(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Flush *cmd;
+   cmd = (struct marshal_cmd_Flush *)
+      marshal_alloc(ctx, DISPATCH_CMD_Flush, sizeof(*cmd));
+   marshal_submit(ctx->Marshal);
+}
+
+struct marshal_cmd_PopAttrib {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_PopAttrib(GLcontext *ctx, const struct marshal_cmd_PopAttrib *cmd)
+{
+   CALL_PopAttrib(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_PopAttrib(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PopAttrib *cmd;
+   cmd = (struct marshal_cmd_PopAttrib *)
+      marshal_alloc(ctx, DISPATCH_CMD_PopAttrib, sizeof(*cmd));
+}
+
+struct marshal_cmd_PushAttrib {
+   struct marshal_cmd_base header;
+   GLbitfield mask;
+};
+
+static void
+unmarshal_PushAttrib(GLcontext *ctx, const struct marshal_cmd_PushAttrib *cmd)
+{
+   CALL_PushAttrib(ctx->CurrentDispatch, (cmd->mask));
+}
+
+static void GLAPIENTRY
+marshal_PushAttrib(GLbitfield mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PushAttrib *cmd;
+   cmd = (struct marshal_cmd_PushAttrib *)
+      marshal_alloc(ctx, DISPATCH_CMD_PushAttrib, sizeof(*cmd));
+   cmd->mask = mask;
+}
+
+static void GLAPIENTRY
+marshal_Map1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Map1d(ctx->CurrentDispatch, (target, u1, u2, stride, order, points));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Map1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Map1f(ctx->CurrentDispatch, (target, u1, u2, stride, order, points));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Map2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Map2d(ctx->CurrentDispatch, (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Map2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Map2f(ctx->CurrentDispatch, (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_MapGrid1d {
+   struct marshal_cmd_base header;
+   GLint un;
+   GLdouble u1;
+   GLdouble u2;
+};
+
+static void
+unmarshal_MapGrid1d(GLcontext *ctx, const struct marshal_cmd_MapGrid1d *cmd)
+{
+   CALL_MapGrid1d(ctx->CurrentDispatch, (cmd->un, cmd->u1, cmd->u2));
+}
+
+static void GLAPIENTRY
+marshal_MapGrid1d(GLint un, GLdouble u1, GLdouble u2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MapGrid1d *cmd;
+   cmd = (struct marshal_cmd_MapGrid1d *)
+      marshal_alloc(ctx, DISPATCH_CMD_MapGrid1d, sizeof(*cmd));
+   cmd->un = un;
+   cmd->u1 = u1;
+   cmd->u2 = u2;
+}
+
+struct marshal_cmd_MapGrid1f {
+   struct marshal_cmd_base header;
+   GLint un;
+   GLfloat u1;
+   GLfloat u2;
+};
+
+static void
+unmarshal_MapGrid1f(GLcontext *ctx, const struct marshal_cmd_MapGrid1f *cmd)
+{
+   CALL_MapGrid1f(ctx->CurrentDispatch, (cmd->un, cmd->u1, cmd->u2));
+}
+
+static void GLAPIENTRY
+marshal_MapGrid1f(GLint un, GLfloat u1, GLfloat u2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MapGrid1f *cmd;
+   cmd = (struct marshal_cmd_MapGrid1f *)
+      marshal_alloc(ctx, DISPATCH_CMD_MapGrid1f, sizeof(*cmd));
+   cmd->un = un;
+   cmd->u1 = u1;
+   cmd->u2 = u2;
+}
+
+struct marshal_cmd_MapGrid2d {
+   struct marshal_cmd_base header;
+   GLint un;
+   GLdouble u1;
+   GLdouble u2;
+   GLint vn;
+   GLdouble v1;
+   GLdouble v2;
+};
+
+static void
+unmarshal_MapGrid2d(GLcontext *ctx, const struct marshal_cmd_MapGrid2d *cmd)
+{
+   CALL_MapGrid2d(ctx->CurrentDispatch, (cmd->un, cmd->u1, cmd->u2, cmd->vn, cmd->v1, cmd->v2));
+}
+
+static void GLAPIENTRY
+marshal_MapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MapGrid2d *cmd;
+   cmd = (struct marshal_cmd_MapGrid2d *)
+      marshal_alloc(ctx, DISPATCH_CMD_MapGrid2d, sizeof(*cmd));
+   cmd->un = un;
+   cmd->u1 = u1;
+   cmd->u2 = u2;
+   cmd->vn = vn;
+   cmd->v1 = v1;
+   cmd->v2 = v2;
+}
+
+struct marshal_cmd_MapGrid2f {
+   struct marshal_cmd_base header;
+   GLint un;
+   GLfloat u1;
+   GLfloat u2;
+   GLint vn;
+   GLfloat v1;
+   GLfloat v2;
+};
+
+static void
+unmarshal_MapGrid2f(GLcontext *ctx, const struct marshal_cmd_MapGrid2f *cmd)
+{
+   CALL_MapGrid2f(ctx->CurrentDispatch, (cmd->un, cmd->u1, cmd->u2, cmd->vn, cmd->v1, cmd->v2));
+}
+
+static void GLAPIENTRY
+marshal_MapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MapGrid2f *cmd;
+   cmd = (struct marshal_cmd_MapGrid2f *)
+      marshal_alloc(ctx, DISPATCH_CMD_MapGrid2f, sizeof(*cmd));
+   cmd->un = un;
+   cmd->u1 = u1;
+   cmd->u2 = u2;
+   cmd->vn = vn;
+   cmd->v1 = v1;
+   cmd->v2 = v2;
+}
+
+struct marshal_cmd_EvalCoord1d {
+   struct marshal_cmd_base header;
+   GLdouble u;
+};
+
+static void
+unmarshal_EvalCoord1d(GLcontext *ctx, const struct marshal_cmd_EvalCoord1d *cmd)
+{
+   CALL_EvalCoord1d(ctx->CurrentDispatch, (cmd->u));
+}
+
+static void GLAPIENTRY
+marshal_EvalCoord1d(GLdouble u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalCoord1d *cmd;
+   cmd = (struct marshal_cmd_EvalCoord1d *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalCoord1d, sizeof(*cmd));
+   cmd->u = u;
+}
+
+struct marshal_cmd_EvalCoord1dv {
+   struct marshal_cmd_base header;
+   GLdouble u[1];
+};
+
+static void
+unmarshal_EvalCoord1dv(GLcontext *ctx, const struct marshal_cmd_EvalCoord1dv *cmd)
+{
+   CALL_EvalCoord1dv(ctx->CurrentDispatch, (cmd->u));
+}
+
+static void GLAPIENTRY
+marshal_EvalCoord1dv(const GLdouble * u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalCoord1dv *cmd;
+   cmd = (struct marshal_cmd_EvalCoord1dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalCoord1dv, sizeof(*cmd));
+   MEMCPY(cmd->u, u, sizeof(cmd->u));
+}
+
+struct marshal_cmd_EvalCoord1f {
+   struct marshal_cmd_base header;
+   GLfloat u;
+};
+
+static void
+unmarshal_EvalCoord1f(GLcontext *ctx, const struct marshal_cmd_EvalCoord1f *cmd)
+{
+   CALL_EvalCoord1f(ctx->CurrentDispatch, (cmd->u));
+}
+
+static void GLAPIENTRY
+marshal_EvalCoord1f(GLfloat u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalCoord1f *cmd;
+   cmd = (struct marshal_cmd_EvalCoord1f *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalCoord1f, sizeof(*cmd));
+   cmd->u = u;
+}
+
+struct marshal_cmd_EvalCoord1fv {
+   struct marshal_cmd_base header;
+   GLfloat u[1];
+};
+
+static void
+unmarshal_EvalCoord1fv(GLcontext *ctx, const struct marshal_cmd_EvalCoord1fv *cmd)
+{
+   CALL_EvalCoord1fv(ctx->CurrentDispatch, (cmd->u));
+}
+
+static void GLAPIENTRY
+marshal_EvalCoord1fv(const GLfloat * u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalCoord1fv *cmd;
+   cmd = (struct marshal_cmd_EvalCoord1fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalCoord1fv, sizeof(*cmd));
+   MEMCPY(cmd->u, u, sizeof(cmd->u));
+}
+
+struct marshal_cmd_EvalCoord2d {
+   struct marshal_cmd_base header;
+   GLdouble u;
+   GLdouble v;
+};
+
+static void
+unmarshal_EvalCoord2d(GLcontext *ctx, const struct marshal_cmd_EvalCoord2d *cmd)
+{
+   CALL_EvalCoord2d(ctx->CurrentDispatch, (cmd->u, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_EvalCoord2d(GLdouble u, GLdouble v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalCoord2d *cmd;
+   cmd = (struct marshal_cmd_EvalCoord2d *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalCoord2d, sizeof(*cmd));
+   cmd->u = u;
+   cmd->v = v;
+}
+
+struct marshal_cmd_EvalCoord2dv {
+   struct marshal_cmd_base header;
+   GLdouble u[2];
+};
+
+static void
+unmarshal_EvalCoord2dv(GLcontext *ctx, const struct marshal_cmd_EvalCoord2dv *cmd)
+{
+   CALL_EvalCoord2dv(ctx->CurrentDispatch, (cmd->u));
+}
+
+static void GLAPIENTRY
+marshal_EvalCoord2dv(const GLdouble * u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalCoord2dv *cmd;
+   cmd = (struct marshal_cmd_EvalCoord2dv *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalCoord2dv, sizeof(*cmd));
+   MEMCPY(cmd->u, u, sizeof(cmd->u));
+}
+
+struct marshal_cmd_EvalCoord2f {
+   struct marshal_cmd_base header;
+   GLfloat u;
+   GLfloat v;
+};
+
+static void
+unmarshal_EvalCoord2f(GLcontext *ctx, const struct marshal_cmd_EvalCoord2f *cmd)
+{
+   CALL_EvalCoord2f(ctx->CurrentDispatch, (cmd->u, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_EvalCoord2f(GLfloat u, GLfloat v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalCoord2f *cmd;
+   cmd = (struct marshal_cmd_EvalCoord2f *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalCoord2f, sizeof(*cmd));
+   cmd->u = u;
+   cmd->v = v;
+}
+
+struct marshal_cmd_EvalCoord2fv {
+   struct marshal_cmd_base header;
+   GLfloat u[2];
+};
+
+static void
+unmarshal_EvalCoord2fv(GLcontext *ctx, const struct marshal_cmd_EvalCoord2fv *cmd)
+{
+   CALL_EvalCoord2fv(ctx->CurrentDispatch, (cmd->u));
+}
+
+static void GLAPIENTRY
+marshal_EvalCoord2fv(const GLfloat * u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalCoord2fv *cmd;
+   cmd = (struct marshal_cmd_EvalCoord2fv *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalCoord2fv, sizeof(*cmd));
+   MEMCPY(cmd->u, u, sizeof(cmd->u));
+}
+
+struct marshal_cmd_EvalMesh1 {
+   struct marshal_cmd_base header;
+   GLenum mode;
+   GLint i1;
+   GLint i2;
+};
+
+static void
+unmarshal_EvalMesh1(GLcontext *ctx, const struct marshal_cmd_EvalMesh1 *cmd)
+{
+   CALL_EvalMesh1(ctx->CurrentDispatch, (cmd->mode, cmd->i1, cmd->i2));
+}
+
+static void GLAPIENTRY
+marshal_EvalMesh1(GLenum mode, GLint i1, GLint i2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalMesh1 *cmd;
+   cmd = (struct marshal_cmd_EvalMesh1 *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalMesh1, sizeof(*cmd));
+   cmd->mode = mode;
+   cmd->i1 = i1;
+   cmd->i2 = i2;
+}
+
+struct marshal_cmd_EvalPoint1 {
+   struct marshal_cmd_base header;
+   GLint i;
+};
+
+static void
+unmarshal_EvalPoint1(GLcontext *ctx, const struct marshal_cmd_EvalPoint1 *cmd)
+{
+   CALL_EvalPoint1(ctx->CurrentDispatch, (cmd->i));
+}
+
+static void GLAPIENTRY
+marshal_EvalPoint1(GLint i)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalPoint1 *cmd;
+   cmd = (struct marshal_cmd_EvalPoint1 *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalPoint1, sizeof(*cmd));
+   cmd->i = i;
+}
+
+struct marshal_cmd_EvalMesh2 {
+   struct marshal_cmd_base header;
+   GLenum mode;
+   GLint i1;
+   GLint i2;
+   GLint j1;
+   GLint j2;
+};
+
+static void
+unmarshal_EvalMesh2(GLcontext *ctx, const struct marshal_cmd_EvalMesh2 *cmd)
+{
+   CALL_EvalMesh2(ctx->CurrentDispatch, (cmd->mode, cmd->i1, cmd->i2, cmd->j1, cmd->j2));
+}
+
+static void GLAPIENTRY
+marshal_EvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalMesh2 *cmd;
+   cmd = (struct marshal_cmd_EvalMesh2 *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalMesh2, sizeof(*cmd));
+   cmd->mode = mode;
+   cmd->i1 = i1;
+   cmd->i2 = i2;
+   cmd->j1 = j1;
+   cmd->j2 = j2;
+}
+
+struct marshal_cmd_EvalPoint2 {
+   struct marshal_cmd_base header;
+   GLint i;
+   GLint j;
+};
+
+static void
+unmarshal_EvalPoint2(GLcontext *ctx, const struct marshal_cmd_EvalPoint2 *cmd)
+{
+   CALL_EvalPoint2(ctx->CurrentDispatch, (cmd->i, cmd->j));
+}
+
+static void GLAPIENTRY
+marshal_EvalPoint2(GLint i, GLint j)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EvalPoint2 *cmd;
+   cmd = (struct marshal_cmd_EvalPoint2 *)
+      marshal_alloc(ctx, DISPATCH_CMD_EvalPoint2, sizeof(*cmd));
+   cmd->i = i;
+   cmd->j = j;
+}
+
+struct marshal_cmd_AlphaFunc {
+   struct marshal_cmd_base header;
+   GLenum func;
+   GLclampf ref;
+};
+
+static void
+unmarshal_AlphaFunc(GLcontext *ctx, const struct marshal_cmd_AlphaFunc *cmd)
+{
+   CALL_AlphaFunc(ctx->CurrentDispatch, (cmd->func, cmd->ref));
+}
+
+static void GLAPIENTRY
+marshal_AlphaFunc(GLenum func, GLclampf ref)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_AlphaFunc *cmd;
+   cmd = (struct marshal_cmd_AlphaFunc *)
+      marshal_alloc(ctx, DISPATCH_CMD_AlphaFunc, sizeof(*cmd));
+   cmd->func = func;
+   cmd->ref = ref;
+}
+
+struct marshal_cmd_BlendFunc {
+   struct marshal_cmd_base header;
+   GLenum sfactor;
+   GLenum dfactor;
+};
+
+static void
+unmarshal_BlendFunc(GLcontext *ctx, const struct marshal_cmd_BlendFunc *cmd)
+{
+   CALL_BlendFunc(ctx->CurrentDispatch, (cmd->sfactor, cmd->dfactor));
+}
+
+static void GLAPIENTRY
+marshal_BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BlendFunc *cmd;
+   cmd = (struct marshal_cmd_BlendFunc *)
+      marshal_alloc(ctx, DISPATCH_CMD_BlendFunc, sizeof(*cmd));
+   cmd->sfactor = sfactor;
+   cmd->dfactor = dfactor;
+}
+
+struct marshal_cmd_LogicOp {
+   struct marshal_cmd_base header;
+   GLenum opcode;
+};
+
+static void
+unmarshal_LogicOp(GLcontext *ctx, const struct marshal_cmd_LogicOp *cmd)
+{
+   CALL_LogicOp(ctx->CurrentDispatch, (cmd->opcode));
+}
+
+static void GLAPIENTRY
+marshal_LogicOp(GLenum opcode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LogicOp *cmd;
+   cmd = (struct marshal_cmd_LogicOp *)
+      marshal_alloc(ctx, DISPATCH_CMD_LogicOp, sizeof(*cmd));
+   cmd->opcode = opcode;
+}
+
+struct marshal_cmd_StencilFunc {
+   struct marshal_cmd_base header;
+   GLenum func;
+   GLint ref;
+   GLuint mask;
+};
+
+static void
+unmarshal_StencilFunc(GLcontext *ctx, const struct marshal_cmd_StencilFunc *cmd)
+{
+   CALL_StencilFunc(ctx->CurrentDispatch, (cmd->func, cmd->ref, cmd->mask));
+}
+
+static void GLAPIENTRY
+marshal_StencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_StencilFunc *cmd;
+   cmd = (struct marshal_cmd_StencilFunc *)
+      marshal_alloc(ctx, DISPATCH_CMD_StencilFunc, sizeof(*cmd));
+   cmd->func = func;
+   cmd->ref = ref;
+   cmd->mask = mask;
+}
+
+struct marshal_cmd_StencilOp {
+   struct marshal_cmd_base header;
+   GLenum fail;
+   GLenum zfail;
+   GLenum zpass;
+};
+
+static void
+unmarshal_StencilOp(GLcontext *ctx, const struct marshal_cmd_StencilOp *cmd)
+{
+   CALL_StencilOp(ctx->CurrentDispatch, (cmd->fail, cmd->zfail, cmd->zpass));
+}
+
+static void GLAPIENTRY
+marshal_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_StencilOp *cmd;
+   cmd = (struct marshal_cmd_StencilOp *)
+      marshal_alloc(ctx, DISPATCH_CMD_StencilOp, sizeof(*cmd));
+   cmd->fail = fail;
+   cmd->zfail = zfail;
+   cmd->zpass = zpass;
+}
+
+struct marshal_cmd_DepthFunc {
+   struct marshal_cmd_base header;
+   GLenum func;
+};
+
+static void
+unmarshal_DepthFunc(GLcontext *ctx, const struct marshal_cmd_DepthFunc *cmd)
+{
+   CALL_DepthFunc(ctx->CurrentDispatch, (cmd->func));
+}
+
+static void GLAPIENTRY
+marshal_DepthFunc(GLenum func)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DepthFunc *cmd;
+   cmd = (struct marshal_cmd_DepthFunc *)
+      marshal_alloc(ctx, DISPATCH_CMD_DepthFunc, sizeof(*cmd));
+   cmd->func = func;
+}
+
+struct marshal_cmd_PixelZoom {
+   struct marshal_cmd_base header;
+   GLfloat xfactor;
+   GLfloat yfactor;
+};
+
+static void
+unmarshal_PixelZoom(GLcontext *ctx, const struct marshal_cmd_PixelZoom *cmd)
+{
+   CALL_PixelZoom(ctx->CurrentDispatch, (cmd->xfactor, cmd->yfactor));
+}
+
+static void GLAPIENTRY
+marshal_PixelZoom(GLfloat xfactor, GLfloat yfactor)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PixelZoom *cmd;
+   cmd = (struct marshal_cmd_PixelZoom *)
+      marshal_alloc(ctx, DISPATCH_CMD_PixelZoom, sizeof(*cmd));
+   cmd->xfactor = xfactor;
+   cmd->yfactor = yfactor;
+}
+
+struct marshal_cmd_PixelTransferf {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_PixelTransferf(GLcontext *ctx, const struct marshal_cmd_PixelTransferf *cmd)
+{
+   CALL_PixelTransferf(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_PixelTransferf(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PixelTransferf *cmd;
+   cmd = (struct marshal_cmd_PixelTransferf *)
+      marshal_alloc(ctx, DISPATCH_CMD_PixelTransferf, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_PixelTransferi {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_PixelTransferi(GLcontext *ctx, const struct marshal_cmd_PixelTransferi *cmd)
+{
+   CALL_PixelTransferi(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_PixelTransferi(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PixelTransferi *cmd;
+   cmd = (struct marshal_cmd_PixelTransferi *)
+      marshal_alloc(ctx, DISPATCH_CMD_PixelTransferi, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_PixelStoref {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_PixelStoref(GLcontext *ctx, const struct marshal_cmd_PixelStoref *cmd)
+{
+   CALL_PixelStoref(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_PixelStoref(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PixelStoref *cmd;
+   cmd = (struct marshal_cmd_PixelStoref *)
+      marshal_alloc(ctx, DISPATCH_CMD_PixelStoref, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_PixelStorei {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_PixelStorei(GLcontext *ctx, const struct marshal_cmd_PixelStorei *cmd)
+{
+   CALL_PixelStorei(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_PixelStorei(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PixelStorei *cmd;
+   cmd = (struct marshal_cmd_PixelStorei *)
+      marshal_alloc(ctx, DISPATCH_CMD_PixelStorei, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_PixelMapfv(GLenum map, GLsizei mapsize, const GLfloat * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_PixelMapfv(ctx->CurrentDispatch, (map, mapsize, values));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_PixelMapuiv(GLenum map, GLsizei mapsize, const GLuint * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_PixelMapuiv(ctx->CurrentDispatch, (map, mapsize, values));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_PixelMapusv(GLenum map, GLsizei mapsize, const GLushort * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_PixelMapusv(ctx->CurrentDispatch, (map, mapsize, values));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ReadBuffer {
+   struct marshal_cmd_base header;
+   GLenum mode;
+};
+
+static void
+unmarshal_ReadBuffer(GLcontext *ctx, const struct marshal_cmd_ReadBuffer *cmd)
+{
+   CALL_ReadBuffer(ctx->CurrentDispatch, (cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_ReadBuffer(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ReadBuffer *cmd;
+   cmd = (struct marshal_cmd_ReadBuffer *)
+      marshal_alloc(ctx, DISPATCH_CMD_ReadBuffer, sizeof(*cmd));
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_CopyPixels {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   GLenum type;
+};
+
+static void
+unmarshal_CopyPixels(GLcontext *ctx, const struct marshal_cmd_CopyPixels *cmd)
+{
+   CALL_CopyPixels(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->width, cmd->height, cmd->type));
+}
+
+static void GLAPIENTRY
+marshal_CopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyPixels *cmd;
+   cmd = (struct marshal_cmd_CopyPixels *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyPixels, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+   cmd->height = height;
+   cmd->type = type;
+}
+
+static void GLAPIENTRY
+marshal_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ReadPixels(ctx->CurrentDispatch, (x, y, width, height, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_DrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DrawPixels(ctx->CurrentDispatch, (width, height, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetBooleanv(GLenum pname, GLboolean * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetBooleanv(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetClipPlane(GLenum plane, GLdouble * equation)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetClipPlane(ctx->CurrentDispatch, (plane, equation));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetDoublev(GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetDoublev(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static GLenum GLAPIENTRY
+marshal_GetError(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLenum ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_GetError(ctx->CurrentDispatch, ());
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_GetFloatv(GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetFloatv(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetIntegerv(GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetIntegerv(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetLightfv(GLenum light, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetLightfv(ctx->CurrentDispatch, (light, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetLightiv(GLenum light, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetLightiv(ctx->CurrentDispatch, (light, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMapdv(GLenum target, GLenum query, GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMapdv(ctx->CurrentDispatch, (target, query, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMapfv(GLenum target, GLenum query, GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMapfv(ctx->CurrentDispatch, (target, query, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMapiv(GLenum target, GLenum query, GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMapiv(ctx->CurrentDispatch, (target, query, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMaterialfv(GLenum face, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMaterialfv(ctx->CurrentDispatch, (face, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMaterialiv(GLenum face, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMaterialiv(ctx->CurrentDispatch, (face, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetPixelMapfv(GLenum map, GLfloat * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetPixelMapfv(ctx->CurrentDispatch, (map, values));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetPixelMapuiv(GLenum map, GLuint * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetPixelMapuiv(ctx->CurrentDispatch, (map, values));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetPixelMapusv(GLenum map, GLushort * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetPixelMapusv(ctx->CurrentDispatch, (map, values));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetPolygonStipple(GLubyte * mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetPolygonStipple(ctx->CurrentDispatch, (mask));
+   marshal_sync_end(ctx);
+}
+
+static const GLubyte * GLAPIENTRY
+marshal_GetString(GLenum name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLubyte * ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_GetString(ctx->CurrentDispatch, (name));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_GetTexEnvfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexEnvfv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTexEnviv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexEnviv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTexGendv(GLenum coord, GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexGendv(ctx->CurrentDispatch, (coord, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTexGenfv(GLenum coord, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexGenfv(ctx->CurrentDispatch, (coord, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTexGeniv(GLenum coord, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexGeniv(ctx->CurrentDispatch, (coord, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexImage(ctx->CurrentDispatch, (target, level, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTexParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTexParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexLevelParameterfv(ctx->CurrentDispatch, (target, level, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexLevelParameteriv(ctx->CurrentDispatch, (target, level, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsEnabled(GLenum cap)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsEnabled(ctx->CurrentDispatch, (cap));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsList(GLuint list)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsList(ctx->CurrentDispatch, (list));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_DepthRange {
+   struct marshal_cmd_base header;
+   GLclampd zNear;
+   GLclampd zFar;
+};
+
+static void
+unmarshal_DepthRange(GLcontext *ctx, const struct marshal_cmd_DepthRange *cmd)
+{
+   CALL_DepthRange(ctx->CurrentDispatch, (cmd->zNear, cmd->zFar));
+}
+
+static void GLAPIENTRY
+marshal_DepthRange(GLclampd zNear, GLclampd zFar)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DepthRange *cmd;
+   cmd = (struct marshal_cmd_DepthRange *)
+      marshal_alloc(ctx, DISPATCH_CMD_DepthRange, sizeof(*cmd));
+   cmd->zNear = zNear;
+   cmd->zFar = zFar;
+}
+
+struct marshal_cmd_Frustum {
+   struct marshal_cmd_base header;
+   GLdouble left;
+   GLdouble right;
+   GLdouble bottom;
+   GLdouble top;
+   GLdouble zNear;
+   GLdouble zFar;
+};
+
+static void
+unmarshal_Frustum(GLcontext *ctx, const struct marshal_cmd_Frustum *cmd)
+{
+   CALL_Frustum(ctx->CurrentDispatch, (cmd->left, cmd->right, cmd->bottom, cmd->top, cmd->zNear, cmd->zFar));
+}
+
+static void GLAPIENTRY
+marshal_Frustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Frustum *cmd;
+   cmd = (struct marshal_cmd_Frustum *)
+      marshal_alloc(ctx, DISPATCH_CMD_Frustum, sizeof(*cmd));
+   cmd->left = left;
+   cmd->right = right;
+   cmd->bottom = bottom;
+   cmd->top = top;
+   cmd->zNear = zNear;
+   cmd->zFar = zFar;
+}
+
+struct marshal_cmd_LoadIdentity {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_LoadIdentity(GLcontext *ctx, const struct marshal_cmd_LoadIdentity *cmd)
+{
+   CALL_LoadIdentity(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_LoadIdentity(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LoadIdentity *cmd;
+   cmd = (struct marshal_cmd_LoadIdentity *)
+      marshal_alloc(ctx, DISPATCH_CMD_LoadIdentity, sizeof(*cmd));
+}
+
+struct marshal_cmd_LoadMatrixf {
+   struct marshal_cmd_base header;
+   GLfloat m[16];
+};
+
+static void
+unmarshal_LoadMatrixf(GLcontext *ctx, const struct marshal_cmd_LoadMatrixf *cmd)
+{
+   CALL_LoadMatrixf(ctx->CurrentDispatch, (cmd->m));
+}
+
+static void GLAPIENTRY
+marshal_LoadMatrixf(const GLfloat * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LoadMatrixf *cmd;
+   cmd = (struct marshal_cmd_LoadMatrixf *)
+      marshal_alloc(ctx, DISPATCH_CMD_LoadMatrixf, sizeof(*cmd));
+   MEMCPY(cmd->m, m, sizeof(cmd->m));
+}
+
+struct marshal_cmd_LoadMatrixd {
+   struct marshal_cmd_base header;
+   GLdouble m[16];
+};
+
+static void
+unmarshal_LoadMatrixd(GLcontext *ctx, const struct marshal_cmd_LoadMatrixd *cmd)
+{
+   CALL_LoadMatrixd(ctx->CurrentDispatch, (cmd->m));
+}
+
+static void GLAPIENTRY
+marshal_LoadMatrixd(const GLdouble * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LoadMatrixd *cmd;
+   cmd = (struct marshal_cmd_LoadMatrixd *)
+      marshal_alloc(ctx, DISPATCH_CMD_LoadMatrixd, sizeof(*cmd));
+   MEMCPY(cmd->m, m, sizeof(cmd->m));
+}
+
+struct marshal_cmd_MatrixMode {
+   struct marshal_cmd_base header;
+   GLenum mode;
+};
+
+static void
+unmarshal_MatrixMode(GLcontext *ctx, const struct marshal_cmd_MatrixMode *cmd)
+{
+   CALL_MatrixMode(ctx->CurrentDispatch, (cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_MatrixMode(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MatrixMode *cmd;
+   cmd = (struct marshal_cmd_MatrixMode *)
+      marshal_alloc(ctx, DISPATCH_CMD_MatrixMode, sizeof(*cmd));
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_MultMatrixf {
+   struct marshal_cmd_base header;
+   GLfloat m[16];
+};
+
+static void
+unmarshal_MultMatrixf(GLcontext *ctx, const struct marshal_cmd_MultMatrixf *cmd)
+{
+   CALL_MultMatrixf(ctx->CurrentDispatch, (cmd->m));
+}
+
+static void GLAPIENTRY
+marshal_MultMatrixf(const GLfloat * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultMatrixf *cmd;
+   cmd = (struct marshal_cmd_MultMatrixf *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultMatrixf, sizeof(*cmd));
+   MEMCPY(cmd->m, m, sizeof(cmd->m));
+}
+
+struct marshal_cmd_MultMatrixd {
+   struct marshal_cmd_base header;
+   GLdouble m[16];
+};
+
+static void
+unmarshal_MultMatrixd(GLcontext *ctx, const struct marshal_cmd_MultMatrixd *cmd)
+{
+   CALL_MultMatrixd(ctx->CurrentDispatch, (cmd->m));
+}
+
+static void GLAPIENTRY
+marshal_MultMatrixd(const GLdouble * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultMatrixd *cmd;
+   cmd = (struct marshal_cmd_MultMatrixd *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultMatrixd, sizeof(*cmd));
+   MEMCPY(cmd->m, m, sizeof(cmd->m));
+}
+
+struct marshal_cmd_Ortho {
+   struct marshal_cmd_base header;
+   GLdouble left;
+   GLdouble right;
+   GLdouble bottom;
+   GLdouble top;
+   GLdouble zNear;
+   GLdouble zFar;
+};
+
+static void
+unmarshal_Ortho(GLcontext *ctx, const struct marshal_cmd_Ortho *cmd)
+{
+   CALL_Ortho(ctx->CurrentDispatch, (cmd->left, cmd->right, cmd->bottom, cmd->top, cmd->zNear, cmd->zFar));
+}
+
+static void GLAPIENTRY
+marshal_Ortho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Ortho *cmd;
+   cmd = (struct marshal_cmd_Ortho *)
+      marshal_alloc(ctx, DISPATCH_CMD_Ortho, sizeof(*cmd));
+   cmd->left = left;
+   cmd->right = right;
+   cmd->bottom = bottom;
+   cmd->top = top;
+   cmd->zNear = zNear;
+   cmd->zFar = zFar;
+}
+
+struct marshal_cmd_PopMatrix {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_PopMatrix(GLcontext *ctx, const struct marshal_cmd_PopMatrix *cmd)
+{
+   CALL_PopMatrix(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_PopMatrix(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PopMatrix *cmd;
+   cmd = (struct marshal_cmd_PopMatrix *)
+      marshal_alloc(ctx, DISPATCH_CMD_PopMatrix, sizeof(*cmd));
+}
+
+struct marshal_cmd_PushMatrix {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_PushMatrix(GLcontext *ctx, const struct marshal_cmd_PushMatrix *cmd)
+{
+   CALL_PushMatrix(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_PushMatrix(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PushMatrix *cmd;
+   cmd = (struct marshal_cmd_PushMatrix *)
+      marshal_alloc(ctx, DISPATCH_CMD_PushMatrix, sizeof(*cmd));
+}
+
+struct marshal_cmd_Rotated {
+   struct marshal_cmd_base header;
+   GLdouble angle;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+};
+
+static void
+unmarshal_Rotated(GLcontext *ctx, const struct marshal_cmd_Rotated *cmd)
+{
+   CALL_Rotated(ctx->CurrentDispatch, (cmd->angle, cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Rotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Rotated *cmd;
+   cmd = (struct marshal_cmd_Rotated *)
+      marshal_alloc(ctx, DISPATCH_CMD_Rotated, sizeof(*cmd));
+   cmd->angle = angle;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Rotatef {
+   struct marshal_cmd_base header;
+   GLfloat angle;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+};
+
+static void
+unmarshal_Rotatef(GLcontext *ctx, const struct marshal_cmd_Rotatef *cmd)
+{
+   CALL_Rotatef(ctx->CurrentDispatch, (cmd->angle, cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Rotatef *cmd;
+   cmd = (struct marshal_cmd_Rotatef *)
+      marshal_alloc(ctx, DISPATCH_CMD_Rotatef, sizeof(*cmd));
+   cmd->angle = angle;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Scaled {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+};
+
+static void
+unmarshal_Scaled(GLcontext *ctx, const struct marshal_cmd_Scaled *cmd)
+{
+   CALL_Scaled(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Scaled(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Scaled *cmd;
+   cmd = (struct marshal_cmd_Scaled *)
+      marshal_alloc(ctx, DISPATCH_CMD_Scaled, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Scalef {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+};
+
+static void
+unmarshal_Scalef(GLcontext *ctx, const struct marshal_cmd_Scalef *cmd)
+{
+   CALL_Scalef(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Scalef(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Scalef *cmd;
+   cmd = (struct marshal_cmd_Scalef *)
+      marshal_alloc(ctx, DISPATCH_CMD_Scalef, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Translated {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+};
+
+static void
+unmarshal_Translated(GLcontext *ctx, const struct marshal_cmd_Translated *cmd)
+{
+   CALL_Translated(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Translated(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Translated *cmd;
+   cmd = (struct marshal_cmd_Translated *)
+      marshal_alloc(ctx, DISPATCH_CMD_Translated, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Translatef {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+};
+
+static void
+unmarshal_Translatef(GLcontext *ctx, const struct marshal_cmd_Translatef *cmd)
+{
+   CALL_Translatef(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_Translatef(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Translatef *cmd;
+   cmd = (struct marshal_cmd_Translatef *)
+      marshal_alloc(ctx, DISPATCH_CMD_Translatef, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_Viewport {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+};
+
+static void
+unmarshal_Viewport(GLcontext *ctx, const struct marshal_cmd_Viewport *cmd)
+{
+   CALL_Viewport(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->width, cmd->height));
+}
+
+static void GLAPIENTRY
+marshal_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Viewport *cmd;
+   cmd = (struct marshal_cmd_Viewport *)
+      marshal_alloc(ctx, DISPATCH_CMD_Viewport, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+   cmd->height = height;
+}
+
+static void GLAPIENTRY
+marshal_ArrayElement(GLint i)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ArrayElement(ctx->CurrentDispatch, (i));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_BindTexture {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint texture;
+};
+
+static void
+unmarshal_BindTexture(GLcontext *ctx, const struct marshal_cmd_BindTexture *cmd)
+{
+   CALL_BindTexture(ctx->CurrentDispatch, (cmd->target, cmd->texture));
+}
+
+static void GLAPIENTRY
+marshal_BindTexture(GLenum target, GLuint texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BindTexture *cmd;
+   cmd = (struct marshal_cmd_BindTexture *)
+      marshal_alloc(ctx, DISPATCH_CMD_BindTexture, sizeof(*cmd));
+   cmd->target = target;
+   cmd->texture = texture;
+}
+
+static void GLAPIENTRY
+marshal_ColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ColorPointer(ctx->CurrentDispatch, (size, type, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_DisableClientState {
+   struct marshal_cmd_base header;
+   GLenum array;
+};
+
+static void
+unmarshal_DisableClientState(GLcontext *ctx, const struct marshal_cmd_DisableClientState *cmd)
+{
+   CALL_DisableClientState(ctx->CurrentDispatch, (cmd->array));
+}
+
+static void GLAPIENTRY
+marshal_DisableClientState(GLenum array)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DisableClientState *cmd;
+   cmd = (struct marshal_cmd_DisableClientState *)
+      marshal_alloc(ctx, DISPATCH_CMD_DisableClientState, sizeof(*cmd));
+   cmd->array = array;
+}
+
+static void GLAPIENTRY
+marshal_DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DrawArrays(ctx->CurrentDispatch, (mode, first, count));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_DrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DrawElements(ctx->CurrentDispatch, (mode, count, type, indices));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_EdgeFlagPointer(GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_EdgeFlagPointer(ctx->CurrentDispatch, (stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_EnableClientState {
+   struct marshal_cmd_base header;
+   GLenum array;
+};
+
+static void
+unmarshal_EnableClientState(GLcontext *ctx, const struct marshal_cmd_EnableClientState *cmd)
+{
+   CALL_EnableClientState(ctx->CurrentDispatch, (cmd->array));
+}
+
+static void GLAPIENTRY
+marshal_EnableClientState(GLenum array)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EnableClientState *cmd;
+   cmd = (struct marshal_cmd_EnableClientState *)
+      marshal_alloc(ctx, DISPATCH_CMD_EnableClientState, sizeof(*cmd));
+   cmd->array = array;
+}
+
+static void GLAPIENTRY
+marshal_IndexPointer(GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_IndexPointer(ctx->CurrentDispatch, (type, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_Indexub {
+   struct marshal_cmd_base header;
+   GLubyte c;
+};
+
+static void
+unmarshal_Indexub(GLcontext *ctx, const struct marshal_cmd_Indexub *cmd)
+{
+   CALL_Indexub(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexub(GLubyte c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexub *cmd;
+   cmd = (struct marshal_cmd_Indexub *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexub, sizeof(*cmd));
+   cmd->c = c;
+}
+
+struct marshal_cmd_Indexubv {
+   struct marshal_cmd_base header;
+   GLubyte c[1];
+};
+
+static void
+unmarshal_Indexubv(GLcontext *ctx, const struct marshal_cmd_Indexubv *cmd)
+{
+   CALL_Indexubv(ctx->CurrentDispatch, (cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_Indexubv(const GLubyte * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Indexubv *cmd;
+   cmd = (struct marshal_cmd_Indexubv *)
+      marshal_alloc(ctx, DISPATCH_CMD_Indexubv, sizeof(*cmd));
+   MEMCPY(cmd->c, c, sizeof(cmd->c));
+}
+
+static void GLAPIENTRY
+marshal_InterleavedArrays(GLenum format, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_InterleavedArrays(ctx->CurrentDispatch, (format, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_NormalPointer(GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_NormalPointer(ctx->CurrentDispatch, (type, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_PolygonOffset {
+   struct marshal_cmd_base header;
+   GLfloat factor;
+   GLfloat units;
+};
+
+static void
+unmarshal_PolygonOffset(GLcontext *ctx, const struct marshal_cmd_PolygonOffset *cmd)
+{
+   CALL_PolygonOffset(ctx->CurrentDispatch, (cmd->factor, cmd->units));
+}
+
+static void GLAPIENTRY
+marshal_PolygonOffset(GLfloat factor, GLfloat units)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PolygonOffset *cmd;
+   cmd = (struct marshal_cmd_PolygonOffset *)
+      marshal_alloc(ctx, DISPATCH_CMD_PolygonOffset, sizeof(*cmd));
+   cmd->factor = factor;
+   cmd->units = units;
+}
+
+static void GLAPIENTRY
+marshal_TexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexCoordPointer(ctx->CurrentDispatch, (size, type, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexPointer(ctx->CurrentDispatch, (size, type, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_AreTexturesResident(GLsizei n, const GLuint * textures, GLboolean * residences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_AreTexturesResident(ctx->CurrentDispatch, (n, textures, residences));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_CopyTexImage1D {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint level;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLint border;
+};
+
+static void
+unmarshal_CopyTexImage1D(GLcontext *ctx, const struct marshal_cmd_CopyTexImage1D *cmd)
+{
+   CALL_CopyTexImage1D(ctx->CurrentDispatch, (cmd->target, cmd->level, cmd->internalformat, cmd->x, cmd->y, cmd->width, cmd->border));
+}
+
+static void GLAPIENTRY
+marshal_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyTexImage1D *cmd;
+   cmd = (struct marshal_cmd_CopyTexImage1D *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyTexImage1D, sizeof(*cmd));
+   cmd->target = target;
+   cmd->level = level;
+   cmd->internalformat = internalformat;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+   cmd->border = border;
+}
+
+struct marshal_cmd_CopyTexImage2D {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint level;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+   GLint border;
+};
+
+static void
+unmarshal_CopyTexImage2D(GLcontext *ctx, const struct marshal_cmd_CopyTexImage2D *cmd)
+{
+   CALL_CopyTexImage2D(ctx->CurrentDispatch, (cmd->target, cmd->level, cmd->internalformat, cmd->x, cmd->y, cmd->width, cmd->height, cmd->border));
+}
+
+static void GLAPIENTRY
+marshal_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyTexImage2D *cmd;
+   cmd = (struct marshal_cmd_CopyTexImage2D *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyTexImage2D, sizeof(*cmd));
+   cmd->target = target;
+   cmd->level = level;
+   cmd->internalformat = internalformat;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+   cmd->height = height;
+   cmd->border = border;
+}
+
+struct marshal_cmd_CopyTexSubImage1D {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint x;
+   GLint y;
+   GLsizei width;
+};
+
+static void
+unmarshal_CopyTexSubImage1D(GLcontext *ctx, const struct marshal_cmd_CopyTexSubImage1D *cmd)
+{
+   CALL_CopyTexSubImage1D(ctx->CurrentDispatch, (cmd->target, cmd->level, cmd->xoffset, cmd->x, cmd->y, cmd->width));
+}
+
+static void GLAPIENTRY
+marshal_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyTexSubImage1D *cmd;
+   cmd = (struct marshal_cmd_CopyTexSubImage1D *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyTexSubImage1D, sizeof(*cmd));
+   cmd->target = target;
+   cmd->level = level;
+   cmd->xoffset = xoffset;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+}
+
+struct marshal_cmd_CopyTexSubImage2D {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint yoffset;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+};
+
+static void
+unmarshal_CopyTexSubImage2D(GLcontext *ctx, const struct marshal_cmd_CopyTexSubImage2D *cmd)
+{
+   CALL_CopyTexSubImage2D(ctx->CurrentDispatch, (cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->x, cmd->y, cmd->width, cmd->height));
+}
+
+static void GLAPIENTRY
+marshal_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyTexSubImage2D *cmd;
+   cmd = (struct marshal_cmd_CopyTexSubImage2D *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyTexSubImage2D, sizeof(*cmd));
+   cmd->target = target;
+   cmd->level = level;
+   cmd->xoffset = xoffset;
+   cmd->yoffset = yoffset;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+   cmd->height = height;
+}
+
+static void GLAPIENTRY
+marshal_DeleteTextures(GLsizei n, const GLuint * textures)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DeleteTextures(ctx->CurrentDispatch, (n, textures));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GenTextures(GLsizei n, GLuint * textures)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GenTextures(ctx->CurrentDispatch, (n, textures));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetPointerv(GLenum pname, GLvoid ** params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetPointerv(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsTexture(GLuint texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsTexture(ctx->CurrentDispatch, (texture));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_PrioritizeTextures(GLsizei n, const GLuint * textures, const GLclampf * priorities)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_PrioritizeTextures(ctx->CurrentDispatch, (n, textures, priorities));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexSubImage1D(ctx->CurrentDispatch, (target, level, xoffset, width, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexSubImage2D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, width, height, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_PopClientAttrib {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_PopClientAttrib(GLcontext *ctx, const struct marshal_cmd_PopClientAttrib *cmd)
+{
+   CALL_PopClientAttrib(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_PopClientAttrib(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PopClientAttrib *cmd;
+   cmd = (struct marshal_cmd_PopClientAttrib *)
+      marshal_alloc(ctx, DISPATCH_CMD_PopClientAttrib, sizeof(*cmd));
+}
+
+struct marshal_cmd_PushClientAttrib {
+   struct marshal_cmd_base header;
+   GLbitfield mask;
+};
+
+static void
+unmarshal_PushClientAttrib(GLcontext *ctx, const struct marshal_cmd_PushClientAttrib *cmd)
+{
+   CALL_PushClientAttrib(ctx->CurrentDispatch, (cmd->mask));
+}
+
+static void GLAPIENTRY
+marshal_PushClientAttrib(GLbitfield mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PushClientAttrib *cmd;
+   cmd = (struct marshal_cmd_PushClientAttrib *)
+      marshal_alloc(ctx, DISPATCH_CMD_PushClientAttrib, sizeof(*cmd));
+   cmd->mask = mask;
+}
+
+struct marshal_cmd_BlendColor {
+   struct marshal_cmd_base header;
+   GLclampf red;
+   GLclampf green;
+   GLclampf blue;
+   GLclampf alpha;
+};
+
+static void
+unmarshal_BlendColor(GLcontext *ctx, const struct marshal_cmd_BlendColor *cmd)
+{
+   CALL_BlendColor(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue, cmd->alpha));
+}
+
+static void GLAPIENTRY
+marshal_BlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BlendColor *cmd;
+   cmd = (struct marshal_cmd_BlendColor *)
+      marshal_alloc(ctx, DISPATCH_CMD_BlendColor, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+   cmd->alpha = alpha;
+}
+
+struct marshal_cmd_BlendEquation {
+   struct marshal_cmd_base header;
+   GLenum mode;
+};
+
+static void
+unmarshal_BlendEquation(GLcontext *ctx, const struct marshal_cmd_BlendEquation *cmd)
+{
+   CALL_BlendEquation(ctx->CurrentDispatch, (cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_BlendEquation(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BlendEquation *cmd;
+   cmd = (struct marshal_cmd_BlendEquation *)
+      marshal_alloc(ctx, DISPATCH_CMD_BlendEquation, sizeof(*cmd));
+   cmd->mode = mode;
+}
+
+static void GLAPIENTRY
+marshal_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DrawRangeElements(ctx->CurrentDispatch, (mode, start, end, count, type, indices));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ColorTable(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ColorTable(ctx->CurrentDispatch, (target, internalformat, width, format, type, table));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ColorTableParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ColorTableParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ColorTableParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ColorTableParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_CopyColorTable {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+};
+
+static void
+unmarshal_CopyColorTable(GLcontext *ctx, const struct marshal_cmd_CopyColorTable *cmd)
+{
+   CALL_CopyColorTable(ctx->CurrentDispatch, (cmd->target, cmd->internalformat, cmd->x, cmd->y, cmd->width));
+}
+
+static void GLAPIENTRY
+marshal_CopyColorTable(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyColorTable *cmd;
+   cmd = (struct marshal_cmd_CopyColorTable *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyColorTable, sizeof(*cmd));
+   cmd->target = target;
+   cmd->internalformat = internalformat;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+}
+
+static void GLAPIENTRY
+marshal_GetColorTable(GLenum target, GLenum format, GLenum type, GLvoid * table)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetColorTable(ctx->CurrentDispatch, (target, format, type, table));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetColorTableParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetColorTableParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetColorTableParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetColorTableParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ColorSubTable(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ColorSubTable(ctx->CurrentDispatch, (target, start, count, format, type, data));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_CopyColorSubTable {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLsizei start;
+   GLint x;
+   GLint y;
+   GLsizei width;
+};
+
+static void
+unmarshal_CopyColorSubTable(GLcontext *ctx, const struct marshal_cmd_CopyColorSubTable *cmd)
+{
+   CALL_CopyColorSubTable(ctx->CurrentDispatch, (cmd->target, cmd->start, cmd->x, cmd->y, cmd->width));
+}
+
+static void GLAPIENTRY
+marshal_CopyColorSubTable(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyColorSubTable *cmd;
+   cmd = (struct marshal_cmd_CopyColorSubTable *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyColorSubTable, sizeof(*cmd));
+   cmd->target = target;
+   cmd->start = start;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+}
+
+static void GLAPIENTRY
+marshal_ConvolutionFilter1D(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * image)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ConvolutionFilter1D(ctx->CurrentDispatch, (target, internalformat, width, format, type, image));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ConvolutionFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * image)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ConvolutionFilter2D(ctx->CurrentDispatch, (target, internalformat, width, height, format, type, image));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ConvolutionParameterf {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLfloat params;
+};
+
+static void
+unmarshal_ConvolutionParameterf(GLcontext *ctx, const struct marshal_cmd_ConvolutionParameterf *cmd)
+{
+   CALL_ConvolutionParameterf(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_ConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ConvolutionParameterf *cmd;
+   cmd = (struct marshal_cmd_ConvolutionParameterf *)
+      marshal_alloc(ctx, DISPATCH_CMD_ConvolutionParameterf, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   cmd->params = params;
+}
+
+static void GLAPIENTRY
+marshal_ConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ConvolutionParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ConvolutionParameteri {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum pname;
+   GLint params;
+};
+
+static void
+unmarshal_ConvolutionParameteri(GLcontext *ctx, const struct marshal_cmd_ConvolutionParameteri *cmd)
+{
+   CALL_ConvolutionParameteri(ctx->CurrentDispatch, (cmd->target, cmd->pname, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_ConvolutionParameteri(GLenum target, GLenum pname, GLint params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ConvolutionParameteri *cmd;
+   cmd = (struct marshal_cmd_ConvolutionParameteri *)
+      marshal_alloc(ctx, DISPATCH_CMD_ConvolutionParameteri, sizeof(*cmd));
+   cmd->target = target;
+   cmd->pname = pname;
+   cmd->params = params;
+}
+
+static void GLAPIENTRY
+marshal_ConvolutionParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ConvolutionParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_CopyConvolutionFilter1D {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+};
+
+static void
+unmarshal_CopyConvolutionFilter1D(GLcontext *ctx, const struct marshal_cmd_CopyConvolutionFilter1D *cmd)
+{
+   CALL_CopyConvolutionFilter1D(ctx->CurrentDispatch, (cmd->target, cmd->internalformat, cmd->x, cmd->y, cmd->width));
+}
+
+static void GLAPIENTRY
+marshal_CopyConvolutionFilter1D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyConvolutionFilter1D *cmd;
+   cmd = (struct marshal_cmd_CopyConvolutionFilter1D *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyConvolutionFilter1D, sizeof(*cmd));
+   cmd->target = target;
+   cmd->internalformat = internalformat;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+}
+
+struct marshal_cmd_CopyConvolutionFilter2D {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum internalformat;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+};
+
+static void
+unmarshal_CopyConvolutionFilter2D(GLcontext *ctx, const struct marshal_cmd_CopyConvolutionFilter2D *cmd)
+{
+   CALL_CopyConvolutionFilter2D(ctx->CurrentDispatch, (cmd->target, cmd->internalformat, cmd->x, cmd->y, cmd->width, cmd->height));
+}
+
+static void GLAPIENTRY
+marshal_CopyConvolutionFilter2D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyConvolutionFilter2D *cmd;
+   cmd = (struct marshal_cmd_CopyConvolutionFilter2D *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyConvolutionFilter2D, sizeof(*cmd));
+   cmd->target = target;
+   cmd->internalformat = internalformat;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+   cmd->height = height;
+}
+
+static void GLAPIENTRY
+marshal_GetConvolutionFilter(GLenum target, GLenum format, GLenum type, GLvoid * image)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetConvolutionFilter(ctx->CurrentDispatch, (target, format, type, image));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetConvolutionParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetConvolutionParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetConvolutionParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetSeparableFilter(GLenum target, GLenum format, GLenum type, GLvoid * row, GLvoid * column, GLvoid * span)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetSeparableFilter(ctx->CurrentDispatch, (target, format, type, row, column, span));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_SeparableFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * row, const GLvoid * column)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_SeparableFilter2D(ctx->CurrentDispatch, (target, internalformat, width, height, format, type, row, column));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetHistogram(ctx->CurrentDispatch, (target, reset, format, type, values));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetHistogramParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetHistogramParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetHistogramParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetHistogramParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMinmax(ctx->CurrentDispatch, (target, reset, format, type, values));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMinmaxParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMinmaxParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMinmaxParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMinmaxParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_Histogram {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLsizei width;
+   GLenum internalformat;
+   GLboolean sink;
+};
+
+static void
+unmarshal_Histogram(GLcontext *ctx, const struct marshal_cmd_Histogram *cmd)
+{
+   CALL_Histogram(ctx->CurrentDispatch, (cmd->target, cmd->width, cmd->internalformat, cmd->sink));
+}
+
+static void GLAPIENTRY
+marshal_Histogram(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Histogram *cmd;
+   cmd = (struct marshal_cmd_Histogram *)
+      marshal_alloc(ctx, DISPATCH_CMD_Histogram, sizeof(*cmd));
+   cmd->target = target;
+   cmd->width = width;
+   cmd->internalformat = internalformat;
+   cmd->sink = sink;
+}
+
+struct marshal_cmd_Minmax {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum internalformat;
+   GLboolean sink;
+};
+
+static void
+unmarshal_Minmax(GLcontext *ctx, const struct marshal_cmd_Minmax *cmd)
+{
+   CALL_Minmax(ctx->CurrentDispatch, (cmd->target, cmd->internalformat, cmd->sink));
+}
+
+static void GLAPIENTRY
+marshal_Minmax(GLenum target, GLenum internalformat, GLboolean sink)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Minmax *cmd;
+   cmd = (struct marshal_cmd_Minmax *)
+      marshal_alloc(ctx, DISPATCH_CMD_Minmax, sizeof(*cmd));
+   cmd->target = target;
+   cmd->internalformat = internalformat;
+   cmd->sink = sink;
+}
+
+struct marshal_cmd_ResetHistogram {
+   struct marshal_cmd_base header;
+   GLenum target;
+};
+
+static void
+unmarshal_ResetHistogram(GLcontext *ctx, const struct marshal_cmd_ResetHistogram *cmd)
+{
+   CALL_ResetHistogram(ctx->CurrentDispatch, (cmd->target));
+}
+
+static void GLAPIENTRY
+marshal_ResetHistogram(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ResetHistogram *cmd;
+   cmd = (struct marshal_cmd_ResetHistogram *)
+      marshal_alloc(ctx, DISPATCH_CMD_ResetHistogram, sizeof(*cmd));
+   cmd->target = target;
+}
+
+struct marshal_cmd_ResetMinmax {
+   struct marshal_cmd_base header;
+   GLenum target;
+};
+
+static void
+unmarshal_ResetMinmax(GLcontext *ctx, const struct marshal_cmd_ResetMinmax *cmd)
+{
+   CALL_ResetMinmax(ctx->CurrentDispatch, (cmd->target));
+}
+
+static void GLAPIENTRY
+marshal_ResetMinmax(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ResetMinmax *cmd;
+   cmd = (struct marshal_cmd_ResetMinmax *)
+      marshal_alloc(ctx, DISPATCH_CMD_ResetMinmax, sizeof(*cmd));
+   cmd->target = target;
+}
+
+static void GLAPIENTRY
+marshal_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexImage3D(ctx->CurrentDispatch, (target, level, internalformat, width, height, depth, border, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexSubImage3D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_CopyTexSubImage3D {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint level;
+   GLint xoffset;
+   GLint yoffset;
+   GLint zoffset;
+   GLint x;
+   GLint y;
+   GLsizei width;
+   GLsizei height;
+};
+
+static void
+unmarshal_CopyTexSubImage3D(GLcontext *ctx, const struct marshal_cmd_CopyTexSubImage3D *cmd)
+{
+   CALL_CopyTexSubImage3D(ctx->CurrentDispatch, (cmd->target, cmd->level, cmd->xoffset, cmd->yoffset, cmd->zoffset, cmd->x, cmd->y, cmd->width, cmd->height));
+}
+
+static void GLAPIENTRY
+marshal_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CopyTexSubImage3D *cmd;
+   cmd = (struct marshal_cmd_CopyTexSubImage3D *)
+      marshal_alloc(ctx, DISPATCH_CMD_CopyTexSubImage3D, sizeof(*cmd));
+   cmd->target = target;
+   cmd->level = level;
+   cmd->xoffset = xoffset;
+   cmd->yoffset = yoffset;
+   cmd->zoffset = zoffset;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->width = width;
+   cmd->height = height;
+}
+
+struct marshal_cmd_ActiveTextureARB {
+   struct marshal_cmd_base header;
+   GLenum texture;
+};
+
+static void
+unmarshal_ActiveTextureARB(GLcontext *ctx, const struct marshal_cmd_ActiveTextureARB *cmd)
+{
+   CALL_ActiveTextureARB(ctx->CurrentDispatch, (cmd->texture));
+}
+
+static void GLAPIENTRY
+marshal_ActiveTextureARB(GLenum texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ActiveTextureARB *cmd;
+   cmd = (struct marshal_cmd_ActiveTextureARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ActiveTextureARB, sizeof(*cmd));
+   cmd->texture = texture;
+}
+
+struct marshal_cmd_ClientActiveTextureARB {
+   struct marshal_cmd_base header;
+   GLenum texture;
+};
+
+static void
+unmarshal_ClientActiveTextureARB(GLcontext *ctx, const struct marshal_cmd_ClientActiveTextureARB *cmd)
+{
+   CALL_ClientActiveTextureARB(ctx->CurrentDispatch, (cmd->texture));
+}
+
+static void GLAPIENTRY
+marshal_ClientActiveTextureARB(GLenum texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ClientActiveTextureARB *cmd;
+   cmd = (struct marshal_cmd_ClientActiveTextureARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ClientActiveTextureARB, sizeof(*cmd));
+   cmd->texture = texture;
+}
+
+struct marshal_cmd_MultiTexCoord1dARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLdouble s;
+};
+
+static void
+unmarshal_MultiTexCoord1dARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord1dARB *cmd)
+{
+   CALL_MultiTexCoord1dARB(ctx->CurrentDispatch, (cmd->target, cmd->s));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord1dARB(GLenum target, GLdouble s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord1dARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord1dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord1dARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+}
+
+struct marshal_cmd_MultiTexCoord1dvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLdouble v[1];
+};
+
+static void
+unmarshal_MultiTexCoord1dvARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord1dvARB *cmd)
+{
+   CALL_MultiTexCoord1dvARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord1dvARB(GLenum target, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord1dvARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord1dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord1dvARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord1fARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLfloat s;
+};
+
+static void
+unmarshal_MultiTexCoord1fARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord1fARB *cmd)
+{
+   CALL_MultiTexCoord1fARB(ctx->CurrentDispatch, (cmd->target, cmd->s));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord1fARB(GLenum target, GLfloat s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord1fARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord1fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord1fARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+}
+
+struct marshal_cmd_MultiTexCoord1fvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLfloat v[1];
+};
+
+static void
+unmarshal_MultiTexCoord1fvARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord1fvARB *cmd)
+{
+   CALL_MultiTexCoord1fvARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord1fvARB(GLenum target, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord1fvARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord1fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord1fvARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord1iARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint s;
+};
+
+static void
+unmarshal_MultiTexCoord1iARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord1iARB *cmd)
+{
+   CALL_MultiTexCoord1iARB(ctx->CurrentDispatch, (cmd->target, cmd->s));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord1iARB(GLenum target, GLint s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord1iARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord1iARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord1iARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+}
+
+struct marshal_cmd_MultiTexCoord1ivARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint v[1];
+};
+
+static void
+unmarshal_MultiTexCoord1ivARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord1ivARB *cmd)
+{
+   CALL_MultiTexCoord1ivARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord1ivARB(GLenum target, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord1ivARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord1ivARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord1ivARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord1sARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLshort s;
+};
+
+static void
+unmarshal_MultiTexCoord1sARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord1sARB *cmd)
+{
+   CALL_MultiTexCoord1sARB(ctx->CurrentDispatch, (cmd->target, cmd->s));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord1sARB(GLenum target, GLshort s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord1sARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord1sARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord1sARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+}
+
+struct marshal_cmd_MultiTexCoord1svARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLshort v[1];
+};
+
+static void
+unmarshal_MultiTexCoord1svARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord1svARB *cmd)
+{
+   CALL_MultiTexCoord1svARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord1svARB(GLenum target, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord1svARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord1svARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord1svARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord2dARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLdouble s;
+   GLdouble t;
+};
+
+static void
+unmarshal_MultiTexCoord2dARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord2dARB *cmd)
+{
+   CALL_MultiTexCoord2dARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord2dARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord2dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord2dARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+}
+
+struct marshal_cmd_MultiTexCoord2dvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLdouble v[2];
+};
+
+static void
+unmarshal_MultiTexCoord2dvARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord2dvARB *cmd)
+{
+   CALL_MultiTexCoord2dvARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord2dvARB(GLenum target, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord2dvARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord2dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord2dvARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord2fARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLfloat s;
+   GLfloat t;
+};
+
+static void
+unmarshal_MultiTexCoord2fARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord2fARB *cmd)
+{
+   CALL_MultiTexCoord2fARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord2fARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord2fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord2fARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+}
+
+struct marshal_cmd_MultiTexCoord2fvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLfloat v[2];
+};
+
+static void
+unmarshal_MultiTexCoord2fvARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord2fvARB *cmd)
+{
+   CALL_MultiTexCoord2fvARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord2fvARB(GLenum target, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord2fvARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord2fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord2fvARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord2iARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint s;
+   GLint t;
+};
+
+static void
+unmarshal_MultiTexCoord2iARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord2iARB *cmd)
+{
+   CALL_MultiTexCoord2iARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord2iARB(GLenum target, GLint s, GLint t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord2iARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord2iARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord2iARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+}
+
+struct marshal_cmd_MultiTexCoord2ivARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint v[2];
+};
+
+static void
+unmarshal_MultiTexCoord2ivARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord2ivARB *cmd)
+{
+   CALL_MultiTexCoord2ivARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord2ivARB(GLenum target, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord2ivARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord2ivARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord2ivARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord2sARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLshort s;
+   GLshort t;
+};
+
+static void
+unmarshal_MultiTexCoord2sARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord2sARB *cmd)
+{
+   CALL_MultiTexCoord2sARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord2sARB(GLenum target, GLshort s, GLshort t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord2sARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord2sARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord2sARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+}
+
+struct marshal_cmd_MultiTexCoord2svARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLshort v[2];
+};
+
+static void
+unmarshal_MultiTexCoord2svARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord2svARB *cmd)
+{
+   CALL_MultiTexCoord2svARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord2svARB(GLenum target, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord2svARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord2svARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord2svARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord3dARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLdouble s;
+   GLdouble t;
+   GLdouble r;
+};
+
+static void
+unmarshal_MultiTexCoord3dARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord3dARB *cmd)
+{
+   CALL_MultiTexCoord3dARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t, cmd->r));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord3dARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord3dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord3dARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+}
+
+struct marshal_cmd_MultiTexCoord3dvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_MultiTexCoord3dvARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord3dvARB *cmd)
+{
+   CALL_MultiTexCoord3dvARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord3dvARB(GLenum target, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord3dvARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord3dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord3dvARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord3fARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLfloat s;
+   GLfloat t;
+   GLfloat r;
+};
+
+static void
+unmarshal_MultiTexCoord3fARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord3fARB *cmd)
+{
+   CALL_MultiTexCoord3fARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t, cmd->r));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord3fARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord3fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord3fARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+}
+
+struct marshal_cmd_MultiTexCoord3fvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_MultiTexCoord3fvARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord3fvARB *cmd)
+{
+   CALL_MultiTexCoord3fvARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord3fvARB(GLenum target, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord3fvARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord3fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord3fvARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord3iARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint s;
+   GLint t;
+   GLint r;
+};
+
+static void
+unmarshal_MultiTexCoord3iARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord3iARB *cmd)
+{
+   CALL_MultiTexCoord3iARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t, cmd->r));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord3iARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord3iARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord3iARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+}
+
+struct marshal_cmd_MultiTexCoord3ivARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint v[3];
+};
+
+static void
+unmarshal_MultiTexCoord3ivARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord3ivARB *cmd)
+{
+   CALL_MultiTexCoord3ivARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord3ivARB(GLenum target, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord3ivARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord3ivARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord3ivARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord3sARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLshort s;
+   GLshort t;
+   GLshort r;
+};
+
+static void
+unmarshal_MultiTexCoord3sARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord3sARB *cmd)
+{
+   CALL_MultiTexCoord3sARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t, cmd->r));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord3sARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord3sARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord3sARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+}
+
+struct marshal_cmd_MultiTexCoord3svARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLshort v[3];
+};
+
+static void
+unmarshal_MultiTexCoord3svARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord3svARB *cmd)
+{
+   CALL_MultiTexCoord3svARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord3svARB(GLenum target, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord3svARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord3svARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord3svARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord4dARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLdouble s;
+   GLdouble t;
+   GLdouble r;
+   GLdouble q;
+};
+
+static void
+unmarshal_MultiTexCoord4dARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord4dARB *cmd)
+{
+   CALL_MultiTexCoord4dARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t, cmd->r, cmd->q));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord4dARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord4dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord4dARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+   cmd->q = q;
+}
+
+struct marshal_cmd_MultiTexCoord4dvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLdouble v[4];
+};
+
+static void
+unmarshal_MultiTexCoord4dvARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord4dvARB *cmd)
+{
+   CALL_MultiTexCoord4dvARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord4dvARB(GLenum target, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord4dvARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord4dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord4dvARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord4fARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLfloat s;
+   GLfloat t;
+   GLfloat r;
+   GLfloat q;
+};
+
+static void
+unmarshal_MultiTexCoord4fARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord4fARB *cmd)
+{
+   CALL_MultiTexCoord4fARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t, cmd->r, cmd->q));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord4fARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord4fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord4fARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+   cmd->q = q;
+}
+
+struct marshal_cmd_MultiTexCoord4fvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLfloat v[4];
+};
+
+static void
+unmarshal_MultiTexCoord4fvARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord4fvARB *cmd)
+{
+   CALL_MultiTexCoord4fvARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord4fvARB(GLenum target, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord4fvARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord4fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord4fvARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord4iARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint s;
+   GLint t;
+   GLint r;
+   GLint q;
+};
+
+static void
+unmarshal_MultiTexCoord4iARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord4iARB *cmd)
+{
+   CALL_MultiTexCoord4iARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t, cmd->r, cmd->q));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord4iARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord4iARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord4iARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+   cmd->q = q;
+}
+
+struct marshal_cmd_MultiTexCoord4ivARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint v[4];
+};
+
+static void
+unmarshal_MultiTexCoord4ivARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord4ivARB *cmd)
+{
+   CALL_MultiTexCoord4ivARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord4ivARB(GLenum target, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord4ivARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord4ivARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord4ivARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_MultiTexCoord4sARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLshort s;
+   GLshort t;
+   GLshort r;
+   GLshort q;
+};
+
+static void
+unmarshal_MultiTexCoord4sARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord4sARB *cmd)
+{
+   CALL_MultiTexCoord4sARB(ctx->CurrentDispatch, (cmd->target, cmd->s, cmd->t, cmd->r, cmd->q));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord4sARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord4sARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord4sARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->s = s;
+   cmd->t = t;
+   cmd->r = r;
+   cmd->q = q;
+}
+
+struct marshal_cmd_MultiTexCoord4svARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLshort v[4];
+};
+
+static void
+unmarshal_MultiTexCoord4svARB(GLcontext *ctx, const struct marshal_cmd_MultiTexCoord4svARB *cmd)
+{
+   CALL_MultiTexCoord4svARB(ctx->CurrentDispatch, (cmd->target, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_MultiTexCoord4svARB(GLenum target, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultiTexCoord4svARB *cmd;
+   cmd = (struct marshal_cmd_MultiTexCoord4svARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultiTexCoord4svARB, sizeof(*cmd));
+   cmd->target = target;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_LoadTransposeMatrixfARB {
+   struct marshal_cmd_base header;
+   GLfloat m[16];
+};
+
+static void
+unmarshal_LoadTransposeMatrixfARB(GLcontext *ctx, const struct marshal_cmd_LoadTransposeMatrixfARB *cmd)
+{
+   CALL_LoadTransposeMatrixfARB(ctx->CurrentDispatch, (cmd->m));
+}
+
+static void GLAPIENTRY
+marshal_LoadTransposeMatrixfARB(const GLfloat * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LoadTransposeMatrixfARB *cmd;
+   cmd = (struct marshal_cmd_LoadTransposeMatrixfARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_LoadTransposeMatrixfARB, sizeof(*cmd));
+   MEMCPY(cmd->m, m, sizeof(cmd->m));
+}
+
+struct marshal_cmd_LoadTransposeMatrixdARB {
+   struct marshal_cmd_base header;
+   GLdouble m[16];
+};
+
+static void
+unmarshal_LoadTransposeMatrixdARB(GLcontext *ctx, const struct marshal_cmd_LoadTransposeMatrixdARB *cmd)
+{
+   CALL_LoadTransposeMatrixdARB(ctx->CurrentDispatch, (cmd->m));
+}
+
+static void GLAPIENTRY
+marshal_LoadTransposeMatrixdARB(const GLdouble * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LoadTransposeMatrixdARB *cmd;
+   cmd = (struct marshal_cmd_LoadTransposeMatrixdARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_LoadTransposeMatrixdARB, sizeof(*cmd));
+   MEMCPY(cmd->m, m, sizeof(cmd->m));
+}
+
+struct marshal_cmd_MultTransposeMatrixfARB {
+   struct marshal_cmd_base header;
+   GLfloat m[16];
+};
+
+static void
+unmarshal_MultTransposeMatrixfARB(GLcontext *ctx, const struct marshal_cmd_MultTransposeMatrixfARB *cmd)
+{
+   CALL_MultTransposeMatrixfARB(ctx->CurrentDispatch, (cmd->m));
+}
+
+static void GLAPIENTRY
+marshal_MultTransposeMatrixfARB(const GLfloat * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultTransposeMatrixfARB *cmd;
+   cmd = (struct marshal_cmd_MultTransposeMatrixfARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultTransposeMatrixfARB, sizeof(*cmd));
+   MEMCPY(cmd->m, m, sizeof(cmd->m));
+}
+
+struct marshal_cmd_MultTransposeMatrixdARB {
+   struct marshal_cmd_base header;
+   GLdouble m[16];
+};
+
+static void
+unmarshal_MultTransposeMatrixdARB(GLcontext *ctx, const struct marshal_cmd_MultTransposeMatrixdARB *cmd)
+{
+   CALL_MultTransposeMatrixdARB(ctx->CurrentDispatch, (cmd->m));
+}
+
+static void GLAPIENTRY
+marshal_MultTransposeMatrixdARB(const GLdouble * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_MultTransposeMatrixdARB *cmd;
+   cmd = (struct marshal_cmd_MultTransposeMatrixdARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_MultTransposeMatrixdARB, sizeof(*cmd));
+   MEMCPY(cmd->m, m, sizeof(cmd->m));
+}
+
+struct marshal_cmd_SampleCoverageARB {
+   struct marshal_cmd_base header;
+   GLclampf value;
+   GLboolean invert;
+};
+
+static void
+unmarshal_SampleCoverageARB(GLcontext *ctx, const struct marshal_cmd_SampleCoverageARB *cmd)
+{
+   CALL_SampleCoverageARB(ctx->CurrentDispatch, (cmd->value, cmd->invert));
+}
+
+static void GLAPIENTRY
+marshal_SampleCoverageARB(GLclampf value, GLboolean invert)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SampleCoverageARB *cmd;
+   cmd = (struct marshal_cmd_SampleCoverageARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_SampleCoverageARB, sizeof(*cmd));
+   cmd->value = value;
+   cmd->invert = invert;
+}
+
+static void GLAPIENTRY
+marshal_DrawBuffersARB(GLsizei n, const GLenum * bufs)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DrawBuffersARB(ctx->CurrentDispatch, (n, bufs));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_PolygonOffsetEXT {
+   struct marshal_cmd_base header;
+   GLfloat factor;
+   GLfloat bias;
+};
+
+static void
+unmarshal_PolygonOffsetEXT(GLcontext *ctx, const struct marshal_cmd_PolygonOffsetEXT *cmd)
+{
+   CALL_PolygonOffsetEXT(ctx->CurrentDispatch, (cmd->factor, cmd->bias));
+}
+
+static void GLAPIENTRY
+marshal_PolygonOffsetEXT(GLfloat factor, GLfloat bias)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PolygonOffsetEXT *cmd;
+   cmd = (struct marshal_cmd_PolygonOffsetEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_PolygonOffsetEXT, sizeof(*cmd));
+   cmd->factor = factor;
+   cmd->bias = bias;
+}
+
+static void GLAPIENTRY
+marshal_GetTexFilterFuncSGIS(GLenum target, GLenum filter, GLfloat * weights)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTexFilterFuncSGIS(ctx->CurrentDispatch, (target, filter, weights));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_TexFilterFuncSGIS(GLenum target, GLenum filter, GLsizei n, const GLfloat * weights)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexFilterFuncSGIS(ctx->CurrentDispatch, (target, filter, n, weights));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetHistogramEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetHistogramEXT(ctx->CurrentDispatch, (target, reset, format, type, values));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetHistogramParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetHistogramParameterfvEXT(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetHistogramParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetHistogramParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMinmaxEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMinmaxEXT(ctx->CurrentDispatch, (target, reset, format, type, values));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMinmaxParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMinmaxParameterfvEXT(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetMinmaxParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetMinmaxParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetConvolutionFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid * image)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetConvolutionFilterEXT(ctx->CurrentDispatch, (target, format, type, image));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetConvolutionParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetConvolutionParameterfvEXT(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetConvolutionParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetConvolutionParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetSeparableFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid * row, GLvoid * column, GLvoid * span)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetSeparableFilterEXT(ctx->CurrentDispatch, (target, format, type, row, column, span));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetColorTableSGI(GLenum target, GLenum format, GLenum type, GLvoid * table)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetColorTableSGI(ctx->CurrentDispatch, (target, format, type, table));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetColorTableParameterfvSGI(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetColorTableParameterfvSGI(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetColorTableParameterivSGI(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetColorTableParameterivSGI(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_PixelTexGenSGIX {
+   struct marshal_cmd_base header;
+   GLenum mode;
+};
+
+static void
+unmarshal_PixelTexGenSGIX(GLcontext *ctx, const struct marshal_cmd_PixelTexGenSGIX *cmd)
+{
+   CALL_PixelTexGenSGIX(ctx->CurrentDispatch, (cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_PixelTexGenSGIX(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PixelTexGenSGIX *cmd;
+   cmd = (struct marshal_cmd_PixelTexGenSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_PixelTexGenSGIX, sizeof(*cmd));
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_PixelTexGenParameteriSGIS {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_PixelTexGenParameteriSGIS(GLcontext *ctx, const struct marshal_cmd_PixelTexGenParameteriSGIS *cmd)
+{
+   CALL_PixelTexGenParameteriSGIS(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_PixelTexGenParameteriSGIS(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PixelTexGenParameteriSGIS *cmd;
+   cmd = (struct marshal_cmd_PixelTexGenParameteriSGIS *)
+      marshal_alloc(ctx, DISPATCH_CMD_PixelTexGenParameteriSGIS, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_PixelTexGenParameterivSGIS(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_PixelTexGenParameterivSGIS(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_PixelTexGenParameterfSGIS {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_PixelTexGenParameterfSGIS(GLcontext *ctx, const struct marshal_cmd_PixelTexGenParameterfSGIS *cmd)
+{
+   CALL_PixelTexGenParameterfSGIS(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_PixelTexGenParameterfSGIS(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PixelTexGenParameterfSGIS *cmd;
+   cmd = (struct marshal_cmd_PixelTexGenParameterfSGIS *)
+      marshal_alloc(ctx, DISPATCH_CMD_PixelTexGenParameterfSGIS, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_PixelTexGenParameterfvSGIS(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_PixelTexGenParameterfvSGIS(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetPixelTexGenParameterivSGIS(GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetPixelTexGenParameterivSGIS(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetPixelTexGenParameterfvSGIS(GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetPixelTexGenParameterfvSGIS(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_TexImage4DSGIS(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexImage4DSGIS(ctx->CurrentDispatch, (target, level, internalformat, width, height, depth, size4d, border, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_TexSubImage4DSGIS(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexSubImage4DSGIS(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, size4d, format, type, pixels));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_AreTexturesResidentEXT(GLsizei n, const GLuint * textures, GLboolean * residences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_AreTexturesResidentEXT(ctx->CurrentDispatch, (n, textures, residences));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_GenTexturesEXT(GLsizei n, GLuint * textures)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GenTexturesEXT(ctx->CurrentDispatch, (n, textures));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsTextureEXT(GLuint texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsTextureEXT(ctx->CurrentDispatch, (texture));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_DetailTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DetailTexFuncSGIS(ctx->CurrentDispatch, (target, n, points));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetDetailTexFuncSGIS(GLenum target, GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetDetailTexFuncSGIS(ctx->CurrentDispatch, (target, points));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_SharpenTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_SharpenTexFuncSGIS(ctx->CurrentDispatch, (target, n, points));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetSharpenTexFuncSGIS(GLenum target, GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetSharpenTexFuncSGIS(ctx->CurrentDispatch, (target, points));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_SampleMaskSGIS {
+   struct marshal_cmd_base header;
+   GLclampf value;
+   GLboolean invert;
+};
+
+static void
+unmarshal_SampleMaskSGIS(GLcontext *ctx, const struct marshal_cmd_SampleMaskSGIS *cmd)
+{
+   CALL_SampleMaskSGIS(ctx->CurrentDispatch, (cmd->value, cmd->invert));
+}
+
+static void GLAPIENTRY
+marshal_SampleMaskSGIS(GLclampf value, GLboolean invert)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SampleMaskSGIS *cmd;
+   cmd = (struct marshal_cmd_SampleMaskSGIS *)
+      marshal_alloc(ctx, DISPATCH_CMD_SampleMaskSGIS, sizeof(*cmd));
+   cmd->value = value;
+   cmd->invert = invert;
+}
+
+struct marshal_cmd_SamplePatternSGIS {
+   struct marshal_cmd_base header;
+   GLenum pattern;
+};
+
+static void
+unmarshal_SamplePatternSGIS(GLcontext *ctx, const struct marshal_cmd_SamplePatternSGIS *cmd)
+{
+   CALL_SamplePatternSGIS(ctx->CurrentDispatch, (cmd->pattern));
+}
+
+static void GLAPIENTRY
+marshal_SamplePatternSGIS(GLenum pattern)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SamplePatternSGIS *cmd;
+   cmd = (struct marshal_cmd_SamplePatternSGIS *)
+      marshal_alloc(ctx, DISPATCH_CMD_SamplePatternSGIS, sizeof(*cmd));
+   cmd->pattern = pattern;
+}
+
+static void GLAPIENTRY
+marshal_ColorPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ColorPointerEXT(ctx->CurrentDispatch, (size, type, stride, count, pointer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_EdgeFlagPointerEXT(GLsizei stride, GLsizei count, const GLboolean * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_EdgeFlagPointerEXT(ctx->CurrentDispatch, (stride, count, pointer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_IndexPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_IndexPointerEXT(ctx->CurrentDispatch, (type, stride, count, pointer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_NormalPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_NormalPointerEXT(ctx->CurrentDispatch, (type, stride, count, pointer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_TexCoordPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_TexCoordPointerEXT(ctx->CurrentDispatch, (size, type, stride, count, pointer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexPointerEXT(ctx->CurrentDispatch, (size, type, stride, count, pointer));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_SpriteParameterfSGIX {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_SpriteParameterfSGIX(GLcontext *ctx, const struct marshal_cmd_SpriteParameterfSGIX *cmd)
+{
+   CALL_SpriteParameterfSGIX(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_SpriteParameterfSGIX(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SpriteParameterfSGIX *cmd;
+   cmd = (struct marshal_cmd_SpriteParameterfSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_SpriteParameterfSGIX, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_SpriteParameterfvSGIX(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_SpriteParameterfvSGIX(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_SpriteParameteriSGIX {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_SpriteParameteriSGIX(GLcontext *ctx, const struct marshal_cmd_SpriteParameteriSGIX *cmd)
+{
+   CALL_SpriteParameteriSGIX(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_SpriteParameteriSGIX(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SpriteParameteriSGIX *cmd;
+   cmd = (struct marshal_cmd_SpriteParameteriSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_SpriteParameteriSGIX, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_SpriteParameterivSGIX(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_SpriteParameterivSGIX(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_PointParameterfEXT {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_PointParameterfEXT(GLcontext *ctx, const struct marshal_cmd_PointParameterfEXT *cmd)
+{
+   CALL_PointParameterfEXT(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_PointParameterfEXT(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PointParameterfEXT *cmd;
+   cmd = (struct marshal_cmd_PointParameterfEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_PointParameterfEXT, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_PointParameterfvEXT(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_PointParameterfvEXT(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static GLint GLAPIENTRY
+marshal_GetInstrumentsSGIX(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_GetInstrumentsSGIX(ctx->CurrentDispatch, ());
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_InstrumentsBufferSGIX(GLsizei size, GLint * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_InstrumentsBufferSGIX(ctx->CurrentDispatch, (size, buffer));
+   marshal_sync_end(ctx);
+}
+
+static GLint GLAPIENTRY
+marshal_PollInstrumentsSGIX(GLint * marker_p)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_PollInstrumentsSGIX(ctx->CurrentDispatch, (marker_p));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_ReadInstrumentsSGIX {
+   struct marshal_cmd_base header;
+   GLint marker;
+};
+
+static void
+unmarshal_ReadInstrumentsSGIX(GLcontext *ctx, const struct marshal_cmd_ReadInstrumentsSGIX *cmd)
+{
+   CALL_ReadInstrumentsSGIX(ctx->CurrentDispatch, (cmd->marker));
+}
+
+static void GLAPIENTRY
+marshal_ReadInstrumentsSGIX(GLint marker)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ReadInstrumentsSGIX *cmd;
+   cmd = (struct marshal_cmd_ReadInstrumentsSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_ReadInstrumentsSGIX, sizeof(*cmd));
+   cmd->marker = marker;
+}
+
+struct marshal_cmd_StartInstrumentsSGIX {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_StartInstrumentsSGIX(GLcontext *ctx, const struct marshal_cmd_StartInstrumentsSGIX *cmd)
+{
+   CALL_StartInstrumentsSGIX(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_StartInstrumentsSGIX(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_StartInstrumentsSGIX *cmd;
+   cmd = (struct marshal_cmd_StartInstrumentsSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_StartInstrumentsSGIX, sizeof(*cmd));
+}
+
+struct marshal_cmd_StopInstrumentsSGIX {
+   struct marshal_cmd_base header;
+   GLint marker;
+};
+
+static void
+unmarshal_StopInstrumentsSGIX(GLcontext *ctx, const struct marshal_cmd_StopInstrumentsSGIX *cmd)
+{
+   CALL_StopInstrumentsSGIX(ctx->CurrentDispatch, (cmd->marker));
+}
+
+static void GLAPIENTRY
+marshal_StopInstrumentsSGIX(GLint marker)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_StopInstrumentsSGIX *cmd;
+   cmd = (struct marshal_cmd_StopInstrumentsSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_StopInstrumentsSGIX, sizeof(*cmd));
+   cmd->marker = marker;
+}
+
+struct marshal_cmd_FrameZoomSGIX {
+   struct marshal_cmd_base header;
+   GLint factor;
+};
+
+static void
+unmarshal_FrameZoomSGIX(GLcontext *ctx, const struct marshal_cmd_FrameZoomSGIX *cmd)
+{
+   CALL_FrameZoomSGIX(ctx->CurrentDispatch, (cmd->factor));
+}
+
+static void GLAPIENTRY
+marshal_FrameZoomSGIX(GLint factor)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FrameZoomSGIX *cmd;
+   cmd = (struct marshal_cmd_FrameZoomSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_FrameZoomSGIX, sizeof(*cmd));
+   cmd->factor = factor;
+}
+
+struct marshal_cmd_TagSampleBufferSGIX {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_TagSampleBufferSGIX(GLcontext *ctx, const struct marshal_cmd_TagSampleBufferSGIX *cmd)
+{
+   CALL_TagSampleBufferSGIX(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_TagSampleBufferSGIX(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TagSampleBufferSGIX *cmd;
+   cmd = (struct marshal_cmd_TagSampleBufferSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_TagSampleBufferSGIX, sizeof(*cmd));
+}
+
+static void GLAPIENTRY
+marshal_ReferencePlaneSGIX(const GLdouble * equation)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ReferencePlaneSGIX(ctx->CurrentDispatch, (equation));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_FlushRasterSGIX {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_FlushRasterSGIX(GLcontext *ctx, const struct marshal_cmd_FlushRasterSGIX *cmd)
+{
+   CALL_FlushRasterSGIX(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_FlushRasterSGIX(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FlushRasterSGIX *cmd;
+   cmd = (struct marshal_cmd_FlushRasterSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_FlushRasterSGIX, sizeof(*cmd));
+}
+
+static void GLAPIENTRY
+marshal_GetListParameterfvSGIX(GLuint list, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetListParameterfvSGIX(ctx->CurrentDispatch, (list, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetListParameterivSGIX(GLuint list, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetListParameterivSGIX(ctx->CurrentDispatch, (list, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ListParameterfSGIX {
+   struct marshal_cmd_base header;
+   GLuint list;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_ListParameterfSGIX(GLcontext *ctx, const struct marshal_cmd_ListParameterfSGIX *cmd)
+{
+   CALL_ListParameterfSGIX(ctx->CurrentDispatch, (cmd->list, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_ListParameterfSGIX(GLuint list, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ListParameterfSGIX *cmd;
+   cmd = (struct marshal_cmd_ListParameterfSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_ListParameterfSGIX, sizeof(*cmd));
+   cmd->list = list;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_ListParameterfvSGIX(GLuint list, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ListParameterfvSGIX(ctx->CurrentDispatch, (list, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ListParameteriSGIX {
+   struct marshal_cmd_base header;
+   GLuint list;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_ListParameteriSGIX(GLcontext *ctx, const struct marshal_cmd_ListParameteriSGIX *cmd)
+{
+   CALL_ListParameteriSGIX(ctx->CurrentDispatch, (cmd->list, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_ListParameteriSGIX(GLuint list, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ListParameteriSGIX *cmd;
+   cmd = (struct marshal_cmd_ListParameteriSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_ListParameteriSGIX, sizeof(*cmd));
+   cmd->list = list;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_ListParameterivSGIX(GLuint list, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ListParameterivSGIX(ctx->CurrentDispatch, (list, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_FragmentColorMaterialSGIX {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum mode;
+};
+
+static void
+unmarshal_FragmentColorMaterialSGIX(GLcontext *ctx, const struct marshal_cmd_FragmentColorMaterialSGIX *cmd)
+{
+   CALL_FragmentColorMaterialSGIX(ctx->CurrentDispatch, (cmd->face, cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_FragmentColorMaterialSGIX(GLenum face, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FragmentColorMaterialSGIX *cmd;
+   cmd = (struct marshal_cmd_FragmentColorMaterialSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_FragmentColorMaterialSGIX, sizeof(*cmd));
+   cmd->face = face;
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_FragmentLightfSGIX {
+   struct marshal_cmd_base header;
+   GLenum light;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_FragmentLightfSGIX(GLcontext *ctx, const struct marshal_cmd_FragmentLightfSGIX *cmd)
+{
+   CALL_FragmentLightfSGIX(ctx->CurrentDispatch, (cmd->light, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_FragmentLightfSGIX(GLenum light, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FragmentLightfSGIX *cmd;
+   cmd = (struct marshal_cmd_FragmentLightfSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_FragmentLightfSGIX, sizeof(*cmd));
+   cmd->light = light;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_FragmentLightfvSGIX(GLenum light, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_FragmentLightfvSGIX(ctx->CurrentDispatch, (light, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_FragmentLightiSGIX {
+   struct marshal_cmd_base header;
+   GLenum light;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_FragmentLightiSGIX(GLcontext *ctx, const struct marshal_cmd_FragmentLightiSGIX *cmd)
+{
+   CALL_FragmentLightiSGIX(ctx->CurrentDispatch, (cmd->light, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_FragmentLightiSGIX(GLenum light, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FragmentLightiSGIX *cmd;
+   cmd = (struct marshal_cmd_FragmentLightiSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_FragmentLightiSGIX, sizeof(*cmd));
+   cmd->light = light;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_FragmentLightivSGIX(GLenum light, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_FragmentLightivSGIX(ctx->CurrentDispatch, (light, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_FragmentLightModelfSGIX {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_FragmentLightModelfSGIX(GLcontext *ctx, const struct marshal_cmd_FragmentLightModelfSGIX *cmd)
+{
+   CALL_FragmentLightModelfSGIX(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_FragmentLightModelfSGIX(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FragmentLightModelfSGIX *cmd;
+   cmd = (struct marshal_cmd_FragmentLightModelfSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_FragmentLightModelfSGIX, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_FragmentLightModelfvSGIX(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_FragmentLightModelfvSGIX(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_FragmentLightModeliSGIX {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_FragmentLightModeliSGIX(GLcontext *ctx, const struct marshal_cmd_FragmentLightModeliSGIX *cmd)
+{
+   CALL_FragmentLightModeliSGIX(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_FragmentLightModeliSGIX(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FragmentLightModeliSGIX *cmd;
+   cmd = (struct marshal_cmd_FragmentLightModeliSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_FragmentLightModeliSGIX, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_FragmentLightModelivSGIX(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_FragmentLightModelivSGIX(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_FragmentMaterialfSGIX {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_FragmentMaterialfSGIX(GLcontext *ctx, const struct marshal_cmd_FragmentMaterialfSGIX *cmd)
+{
+   CALL_FragmentMaterialfSGIX(ctx->CurrentDispatch, (cmd->face, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_FragmentMaterialfSGIX(GLenum face, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FragmentMaterialfSGIX *cmd;
+   cmd = (struct marshal_cmd_FragmentMaterialfSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_FragmentMaterialfSGIX, sizeof(*cmd));
+   cmd->face = face;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_FragmentMaterialfvSGIX(GLenum face, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_FragmentMaterialfvSGIX(ctx->CurrentDispatch, (face, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_FragmentMaterialiSGIX {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_FragmentMaterialiSGIX(GLcontext *ctx, const struct marshal_cmd_FragmentMaterialiSGIX *cmd)
+{
+   CALL_FragmentMaterialiSGIX(ctx->CurrentDispatch, (cmd->face, cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_FragmentMaterialiSGIX(GLenum face, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FragmentMaterialiSGIX *cmd;
+   cmd = (struct marshal_cmd_FragmentMaterialiSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_FragmentMaterialiSGIX, sizeof(*cmd));
+   cmd->face = face;
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_FragmentMaterialivSGIX(GLenum face, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_FragmentMaterialivSGIX(ctx->CurrentDispatch, (face, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetFragmentLightfvSGIX(GLenum light, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetFragmentLightfvSGIX(ctx->CurrentDispatch, (light, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetFragmentLightivSGIX(GLenum light, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetFragmentLightivSGIX(ctx->CurrentDispatch, (light, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetFragmentMaterialfvSGIX(GLenum face, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetFragmentMaterialfvSGIX(ctx->CurrentDispatch, (face, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetFragmentMaterialivSGIX(GLenum face, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetFragmentMaterialivSGIX(ctx->CurrentDispatch, (face, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_LightEnviSGIX {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_LightEnviSGIX(GLcontext *ctx, const struct marshal_cmd_LightEnviSGIX *cmd)
+{
+   CALL_LightEnviSGIX(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_LightEnviSGIX(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LightEnviSGIX *cmd;
+   cmd = (struct marshal_cmd_LightEnviSGIX *)
+      marshal_alloc(ctx, DISPATCH_CMD_LightEnviSGIX, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_VertexWeightfEXT {
+   struct marshal_cmd_base header;
+   GLfloat weight;
+};
+
+static void
+unmarshal_VertexWeightfEXT(GLcontext *ctx, const struct marshal_cmd_VertexWeightfEXT *cmd)
+{
+   CALL_VertexWeightfEXT(ctx->CurrentDispatch, (cmd->weight));
+}
+
+static void GLAPIENTRY
+marshal_VertexWeightfEXT(GLfloat weight)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexWeightfEXT *cmd;
+   cmd = (struct marshal_cmd_VertexWeightfEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexWeightfEXT, sizeof(*cmd));
+   cmd->weight = weight;
+}
+
+static void GLAPIENTRY
+marshal_VertexWeightfvEXT(const GLfloat * weight)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexWeightfvEXT(ctx->CurrentDispatch, (weight));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexWeightPointerEXT(GLsizei size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexWeightPointerEXT(ctx->CurrentDispatch, (size, type, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_FlushVertexArrayRangeNV {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_FlushVertexArrayRangeNV(GLcontext *ctx, const struct marshal_cmd_FlushVertexArrayRangeNV *cmd)
+{
+   CALL_FlushVertexArrayRangeNV(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_FlushVertexArrayRangeNV(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FlushVertexArrayRangeNV *cmd;
+   cmd = (struct marshal_cmd_FlushVertexArrayRangeNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_FlushVertexArrayRangeNV, sizeof(*cmd));
+}
+
+static void GLAPIENTRY
+marshal_VertexArrayRangeNV(GLsizei length, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexArrayRangeNV(ctx->CurrentDispatch, (length, pointer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_CombinerParameterfvNV(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CombinerParameterfvNV(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_CombinerParameterfNV {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLfloat param;
+};
+
+static void
+unmarshal_CombinerParameterfNV(GLcontext *ctx, const struct marshal_cmd_CombinerParameterfNV *cmd)
+{
+   CALL_CombinerParameterfNV(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_CombinerParameterfNV(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CombinerParameterfNV *cmd;
+   cmd = (struct marshal_cmd_CombinerParameterfNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_CombinerParameterfNV, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_CombinerParameterivNV(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CombinerParameterivNV(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_CombinerParameteriNV {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_CombinerParameteriNV(GLcontext *ctx, const struct marshal_cmd_CombinerParameteriNV *cmd)
+{
+   CALL_CombinerParameteriNV(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_CombinerParameteriNV(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CombinerParameteriNV *cmd;
+   cmd = (struct marshal_cmd_CombinerParameteriNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_CombinerParameteriNV, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+struct marshal_cmd_CombinerInputNV {
+   struct marshal_cmd_base header;
+   GLenum stage;
+   GLenum portion;
+   GLenum variable;
+   GLenum input;
+   GLenum mapping;
+   GLenum componentUsage;
+};
+
+static void
+unmarshal_CombinerInputNV(GLcontext *ctx, const struct marshal_cmd_CombinerInputNV *cmd)
+{
+   CALL_CombinerInputNV(ctx->CurrentDispatch, (cmd->stage, cmd->portion, cmd->variable, cmd->input, cmd->mapping, cmd->componentUsage));
+}
+
+static void GLAPIENTRY
+marshal_CombinerInputNV(GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CombinerInputNV *cmd;
+   cmd = (struct marshal_cmd_CombinerInputNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_CombinerInputNV, sizeof(*cmd));
+   cmd->stage = stage;
+   cmd->portion = portion;
+   cmd->variable = variable;
+   cmd->input = input;
+   cmd->mapping = mapping;
+   cmd->componentUsage = componentUsage;
+}
+
+struct marshal_cmd_CombinerOutputNV {
+   struct marshal_cmd_base header;
+   GLenum stage;
+   GLenum portion;
+   GLenum abOutput;
+   GLenum cdOutput;
+   GLenum sumOutput;
+   GLenum scale;
+   GLenum bias;
+   GLboolean abDotProduct;
+   GLboolean cdDotProduct;
+   GLboolean muxSum;
+};
+
+static void
+unmarshal_CombinerOutputNV(GLcontext *ctx, const struct marshal_cmd_CombinerOutputNV *cmd)
+{
+   CALL_CombinerOutputNV(ctx->CurrentDispatch, (cmd->stage, cmd->portion, cmd->abOutput, cmd->cdOutput, cmd->sumOutput, cmd->scale, cmd->bias, cmd->abDotProduct, cmd->cdDotProduct, cmd->muxSum));
+}
+
+static void GLAPIENTRY
+marshal_CombinerOutputNV(GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CombinerOutputNV *cmd;
+   cmd = (struct marshal_cmd_CombinerOutputNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_CombinerOutputNV, sizeof(*cmd));
+   cmd->stage = stage;
+   cmd->portion = portion;
+   cmd->abOutput = abOutput;
+   cmd->cdOutput = cdOutput;
+   cmd->sumOutput = sumOutput;
+   cmd->scale = scale;
+   cmd->bias = bias;
+   cmd->abDotProduct = abDotProduct;
+   cmd->cdDotProduct = cdDotProduct;
+   cmd->muxSum = muxSum;
+}
+
+struct marshal_cmd_FinalCombinerInputNV {
+   struct marshal_cmd_base header;
+   GLenum variable;
+   GLenum input;
+   GLenum mapping;
+   GLenum componentUsage;
+};
+
+static void
+unmarshal_FinalCombinerInputNV(GLcontext *ctx, const struct marshal_cmd_FinalCombinerInputNV *cmd)
+{
+   CALL_FinalCombinerInputNV(ctx->CurrentDispatch, (cmd->variable, cmd->input, cmd->mapping, cmd->componentUsage));
+}
+
+static void GLAPIENTRY
+marshal_FinalCombinerInputNV(GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FinalCombinerInputNV *cmd;
+   cmd = (struct marshal_cmd_FinalCombinerInputNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_FinalCombinerInputNV, sizeof(*cmd));
+   cmd->variable = variable;
+   cmd->input = input;
+   cmd->mapping = mapping;
+   cmd->componentUsage = componentUsage;
+}
+
+static void GLAPIENTRY
+marshal_GetCombinerInputParameterfvNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetCombinerInputParameterfvNV(ctx->CurrentDispatch, (stage, portion, variable, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetCombinerInputParameterivNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetCombinerInputParameterivNV(ctx->CurrentDispatch, (stage, portion, variable, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetCombinerOutputParameterfvNV(GLenum stage, GLenum portion, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetCombinerOutputParameterfvNV(ctx->CurrentDispatch, (stage, portion, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetCombinerOutputParameterivNV(GLenum stage, GLenum portion, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetCombinerOutputParameterivNV(ctx->CurrentDispatch, (stage, portion, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetFinalCombinerInputParameterfvNV(GLenum variable, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetFinalCombinerInputParameterfvNV(ctx->CurrentDispatch, (variable, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetFinalCombinerInputParameterivNV(GLenum variable, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetFinalCombinerInputParameterivNV(ctx->CurrentDispatch, (variable, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ResizeBuffersMESA {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_ResizeBuffersMESA(GLcontext *ctx, const struct marshal_cmd_ResizeBuffersMESA *cmd)
+{
+   CALL_ResizeBuffersMESA(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_ResizeBuffersMESA(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ResizeBuffersMESA *cmd;
+   cmd = (struct marshal_cmd_ResizeBuffersMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_ResizeBuffersMESA, sizeof(*cmd));
+}
+
+struct marshal_cmd_WindowPos2dMESA {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+};
+
+static void
+unmarshal_WindowPos2dMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos2dMESA *cmd)
+{
+   CALL_WindowPos2dMESA(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos2dMESA(GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos2dMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos2dMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos2dMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_WindowPos2dvMESA {
+   struct marshal_cmd_base header;
+   GLdouble v[2];
+};
+
+static void
+unmarshal_WindowPos2dvMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos2dvMESA *cmd)
+{
+   CALL_WindowPos2dvMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos2dvMESA(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos2dvMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos2dvMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos2dvMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos2fMESA {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+};
+
+static void
+unmarshal_WindowPos2fMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos2fMESA *cmd)
+{
+   CALL_WindowPos2fMESA(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos2fMESA(GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos2fMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos2fMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos2fMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_WindowPos2fvMESA {
+   struct marshal_cmd_base header;
+   GLfloat v[2];
+};
+
+static void
+unmarshal_WindowPos2fvMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos2fvMESA *cmd)
+{
+   CALL_WindowPos2fvMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos2fvMESA(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos2fvMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos2fvMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos2fvMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos2iMESA {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+};
+
+static void
+unmarshal_WindowPos2iMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos2iMESA *cmd)
+{
+   CALL_WindowPos2iMESA(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos2iMESA(GLint x, GLint y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos2iMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos2iMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos2iMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_WindowPos2ivMESA {
+   struct marshal_cmd_base header;
+   GLint v[2];
+};
+
+static void
+unmarshal_WindowPos2ivMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos2ivMESA *cmd)
+{
+   CALL_WindowPos2ivMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos2ivMESA(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos2ivMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos2ivMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos2ivMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos2sMESA {
+   struct marshal_cmd_base header;
+   GLshort x;
+   GLshort y;
+};
+
+static void
+unmarshal_WindowPos2sMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos2sMESA *cmd)
+{
+   CALL_WindowPos2sMESA(ctx->CurrentDispatch, (cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos2sMESA(GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos2sMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos2sMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos2sMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_WindowPos2svMESA {
+   struct marshal_cmd_base header;
+   GLshort v[2];
+};
+
+static void
+unmarshal_WindowPos2svMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos2svMESA *cmd)
+{
+   CALL_WindowPos2svMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos2svMESA(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos2svMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos2svMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos2svMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos3dMESA {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+};
+
+static void
+unmarshal_WindowPos3dMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos3dMESA *cmd)
+{
+   CALL_WindowPos3dMESA(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos3dMESA(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos3dMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos3dMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos3dMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_WindowPos3dvMESA {
+   struct marshal_cmd_base header;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_WindowPos3dvMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos3dvMESA *cmd)
+{
+   CALL_WindowPos3dvMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos3dvMESA(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos3dvMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos3dvMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos3dvMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos3fMESA {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+};
+
+static void
+unmarshal_WindowPos3fMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos3fMESA *cmd)
+{
+   CALL_WindowPos3fMESA(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos3fMESA(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos3fMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos3fMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos3fMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_WindowPos3fvMESA {
+   struct marshal_cmd_base header;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_WindowPos3fvMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos3fvMESA *cmd)
+{
+   CALL_WindowPos3fvMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos3fvMESA(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos3fvMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos3fvMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos3fvMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos3iMESA {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+   GLint z;
+};
+
+static void
+unmarshal_WindowPos3iMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos3iMESA *cmd)
+{
+   CALL_WindowPos3iMESA(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos3iMESA(GLint x, GLint y, GLint z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos3iMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos3iMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos3iMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_WindowPos3ivMESA {
+   struct marshal_cmd_base header;
+   GLint v[3];
+};
+
+static void
+unmarshal_WindowPos3ivMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos3ivMESA *cmd)
+{
+   CALL_WindowPos3ivMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos3ivMESA(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos3ivMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos3ivMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos3ivMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos3sMESA {
+   struct marshal_cmd_base header;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+};
+
+static void
+unmarshal_WindowPos3sMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos3sMESA *cmd)
+{
+   CALL_WindowPos3sMESA(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos3sMESA(GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos3sMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos3sMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos3sMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_WindowPos3svMESA {
+   struct marshal_cmd_base header;
+   GLshort v[3];
+};
+
+static void
+unmarshal_WindowPos3svMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos3svMESA *cmd)
+{
+   CALL_WindowPos3svMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos3svMESA(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos3svMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos3svMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos3svMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos4dMESA {
+   struct marshal_cmd_base header;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+};
+
+static void
+unmarshal_WindowPos4dMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos4dMESA *cmd)
+{
+   CALL_WindowPos4dMESA(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos4dMESA(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos4dMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos4dMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos4dMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_WindowPos4dvMESA {
+   struct marshal_cmd_base header;
+   GLdouble v[4];
+};
+
+static void
+unmarshal_WindowPos4dvMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos4dvMESA *cmd)
+{
+   CALL_WindowPos4dvMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos4dvMESA(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos4dvMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos4dvMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos4dvMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos4fMESA {
+   struct marshal_cmd_base header;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+};
+
+static void
+unmarshal_WindowPos4fMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos4fMESA *cmd)
+{
+   CALL_WindowPos4fMESA(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos4fMESA(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos4fMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos4fMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos4fMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_WindowPos4fvMESA {
+   struct marshal_cmd_base header;
+   GLfloat v[4];
+};
+
+static void
+unmarshal_WindowPos4fvMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos4fvMESA *cmd)
+{
+   CALL_WindowPos4fvMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos4fvMESA(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos4fvMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos4fvMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos4fvMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos4iMESA {
+   struct marshal_cmd_base header;
+   GLint x;
+   GLint y;
+   GLint z;
+   GLint w;
+};
+
+static void
+unmarshal_WindowPos4iMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos4iMESA *cmd)
+{
+   CALL_WindowPos4iMESA(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos4iMESA(GLint x, GLint y, GLint z, GLint w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos4iMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos4iMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos4iMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_WindowPos4ivMESA {
+   struct marshal_cmd_base header;
+   GLint v[4];
+};
+
+static void
+unmarshal_WindowPos4ivMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos4ivMESA *cmd)
+{
+   CALL_WindowPos4ivMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos4ivMESA(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos4ivMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos4ivMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos4ivMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_WindowPos4sMESA {
+   struct marshal_cmd_base header;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+};
+
+static void
+unmarshal_WindowPos4sMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos4sMESA *cmd)
+{
+   CALL_WindowPos4sMESA(ctx->CurrentDispatch, (cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos4sMESA(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos4sMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos4sMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos4sMESA, sizeof(*cmd));
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_WindowPos4svMESA {
+   struct marshal_cmd_base header;
+   GLshort v[4];
+};
+
+static void
+unmarshal_WindowPos4svMESA(GLcontext *ctx, const struct marshal_cmd_WindowPos4svMESA *cmd)
+{
+   CALL_WindowPos4svMESA(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_WindowPos4svMESA(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_WindowPos4svMESA *cmd;
+   cmd = (struct marshal_cmd_WindowPos4svMESA *)
+      marshal_alloc(ctx, DISPATCH_CMD_WindowPos4svMESA, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_BlendFuncSeparateEXT {
+   struct marshal_cmd_base header;
+   GLenum sfactorRGB;
+   GLenum dfactorRGB;
+   GLenum sfactorAlpha;
+   GLenum dfactorAlpha;
+};
+
+static void
+unmarshal_BlendFuncSeparateEXT(GLcontext *ctx, const struct marshal_cmd_BlendFuncSeparateEXT *cmd)
+{
+   CALL_BlendFuncSeparateEXT(ctx->CurrentDispatch, (cmd->sfactorRGB, cmd->dfactorRGB, cmd->sfactorAlpha, cmd->dfactorAlpha));
+}
+
+static void GLAPIENTRY
+marshal_BlendFuncSeparateEXT(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BlendFuncSeparateEXT *cmd;
+   cmd = (struct marshal_cmd_BlendFuncSeparateEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_BlendFuncSeparateEXT, sizeof(*cmd));
+   cmd->sfactorRGB = sfactorRGB;
+   cmd->dfactorRGB = dfactorRGB;
+   cmd->sfactorAlpha = sfactorAlpha;
+   cmd->dfactorAlpha = dfactorAlpha;
+}
+
+struct marshal_cmd_IndexMaterialEXT {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum mode;
+};
+
+static void
+unmarshal_IndexMaterialEXT(GLcontext *ctx, const struct marshal_cmd_IndexMaterialEXT *cmd)
+{
+   CALL_IndexMaterialEXT(ctx->CurrentDispatch, (cmd->face, cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_IndexMaterialEXT(GLenum face, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_IndexMaterialEXT *cmd;
+   cmd = (struct marshal_cmd_IndexMaterialEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_IndexMaterialEXT, sizeof(*cmd));
+   cmd->face = face;
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_IndexFuncEXT {
+   struct marshal_cmd_base header;
+   GLenum func;
+   GLclampf ref;
+};
+
+static void
+unmarshal_IndexFuncEXT(GLcontext *ctx, const struct marshal_cmd_IndexFuncEXT *cmd)
+{
+   CALL_IndexFuncEXT(ctx->CurrentDispatch, (cmd->func, cmd->ref));
+}
+
+static void GLAPIENTRY
+marshal_IndexFuncEXT(GLenum func, GLclampf ref)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_IndexFuncEXT *cmd;
+   cmd = (struct marshal_cmd_IndexFuncEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_IndexFuncEXT, sizeof(*cmd));
+   cmd->func = func;
+   cmd->ref = ref;
+}
+
+struct marshal_cmd_LockArraysEXT {
+   struct marshal_cmd_base header;
+   GLint first;
+   GLsizei count;
+};
+
+static void
+unmarshal_LockArraysEXT(GLcontext *ctx, const struct marshal_cmd_LockArraysEXT *cmd)
+{
+   CALL_LockArraysEXT(ctx->CurrentDispatch, (cmd->first, cmd->count));
+}
+
+static void GLAPIENTRY
+marshal_LockArraysEXT(GLint first, GLsizei count)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LockArraysEXT *cmd;
+   cmd = (struct marshal_cmd_LockArraysEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_LockArraysEXT, sizeof(*cmd));
+   cmd->first = first;
+   cmd->count = count;
+}
+
+struct marshal_cmd_UnlockArraysEXT {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_UnlockArraysEXT(GLcontext *ctx, const struct marshal_cmd_UnlockArraysEXT *cmd)
+{
+   CALL_UnlockArraysEXT(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_UnlockArraysEXT(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_UnlockArraysEXT *cmd;
+   cmd = (struct marshal_cmd_UnlockArraysEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_UnlockArraysEXT, sizeof(*cmd));
+}
+
+static void GLAPIENTRY
+marshal_CullParameterdvEXT(GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CullParameterdvEXT(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_CullParameterfvEXT(GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CullParameterfvEXT(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_HintPGI {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLint mode;
+};
+
+static void
+unmarshal_HintPGI(GLcontext *ctx, const struct marshal_cmd_HintPGI *cmd)
+{
+   CALL_HintPGI(ctx->CurrentDispatch, (cmd->target, cmd->mode));
+}
+
+static void GLAPIENTRY
+marshal_HintPGI(GLenum target, GLint mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_HintPGI *cmd;
+   cmd = (struct marshal_cmd_HintPGI *)
+      marshal_alloc(ctx, DISPATCH_CMD_HintPGI, sizeof(*cmd));
+   cmd->target = target;
+   cmd->mode = mode;
+}
+
+struct marshal_cmd_FogCoordfEXT {
+   struct marshal_cmd_base header;
+   GLfloat coord;
+};
+
+static void
+unmarshal_FogCoordfEXT(GLcontext *ctx, const struct marshal_cmd_FogCoordfEXT *cmd)
+{
+   CALL_FogCoordfEXT(ctx->CurrentDispatch, (cmd->coord));
+}
+
+static void GLAPIENTRY
+marshal_FogCoordfEXT(GLfloat coord)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FogCoordfEXT *cmd;
+   cmd = (struct marshal_cmd_FogCoordfEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_FogCoordfEXT, sizeof(*cmd));
+   cmd->coord = coord;
+}
+
+struct marshal_cmd_FogCoordfvEXT {
+   struct marshal_cmd_base header;
+   GLfloat coord[1];
+};
+
+static void
+unmarshal_FogCoordfvEXT(GLcontext *ctx, const struct marshal_cmd_FogCoordfvEXT *cmd)
+{
+   CALL_FogCoordfvEXT(ctx->CurrentDispatch, (cmd->coord));
+}
+
+static void GLAPIENTRY
+marshal_FogCoordfvEXT(const GLfloat * coord)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FogCoordfvEXT *cmd;
+   cmd = (struct marshal_cmd_FogCoordfvEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_FogCoordfvEXT, sizeof(*cmd));
+   MEMCPY(cmd->coord, coord, sizeof(cmd->coord));
+}
+
+struct marshal_cmd_FogCoorddEXT {
+   struct marshal_cmd_base header;
+   GLdouble coord;
+};
+
+static void
+unmarshal_FogCoorddEXT(GLcontext *ctx, const struct marshal_cmd_FogCoorddEXT *cmd)
+{
+   CALL_FogCoorddEXT(ctx->CurrentDispatch, (cmd->coord));
+}
+
+static void GLAPIENTRY
+marshal_FogCoorddEXT(GLdouble coord)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FogCoorddEXT *cmd;
+   cmd = (struct marshal_cmd_FogCoorddEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_FogCoorddEXT, sizeof(*cmd));
+   cmd->coord = coord;
+}
+
+struct marshal_cmd_FogCoorddvEXT {
+   struct marshal_cmd_base header;
+   GLdouble coord[1];
+};
+
+static void
+unmarshal_FogCoorddvEXT(GLcontext *ctx, const struct marshal_cmd_FogCoorddvEXT *cmd)
+{
+   CALL_FogCoorddvEXT(ctx->CurrentDispatch, (cmd->coord));
+}
+
+static void GLAPIENTRY
+marshal_FogCoorddvEXT(const GLdouble * coord)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FogCoorddvEXT *cmd;
+   cmd = (struct marshal_cmd_FogCoorddvEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_FogCoorddvEXT, sizeof(*cmd));
+   MEMCPY(cmd->coord, coord, sizeof(cmd->coord));
+}
+
+static void GLAPIENTRY
+marshal_FogCoordPointerEXT(GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_FogCoordPointerEXT(ctx->CurrentDispatch, (type, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetColorTableEXT(GLenum target, GLenum format, GLenum type, GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetColorTableEXT(ctx->CurrentDispatch, (target, format, type, data));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetColorTableParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetColorTableParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetColorTableParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetColorTableParameterfvEXT(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_TbufferMask3DFX {
+   struct marshal_cmd_base header;
+   GLuint mask;
+};
+
+static void
+unmarshal_TbufferMask3DFX(GLcontext *ctx, const struct marshal_cmd_TbufferMask3DFX *cmd)
+{
+   CALL_TbufferMask3DFX(ctx->CurrentDispatch, (cmd->mask));
+}
+
+static void GLAPIENTRY
+marshal_TbufferMask3DFX(GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TbufferMask3DFX *cmd;
+   cmd = (struct marshal_cmd_TbufferMask3DFX *)
+      marshal_alloc(ctx, DISPATCH_CMD_TbufferMask3DFX, sizeof(*cmd));
+   cmd->mask = mask;
+}
+
+static void GLAPIENTRY
+marshal_CompressedTexImage3DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CompressedTexImage3DARB(ctx->CurrentDispatch, (target, level, internalformat, width, height, depth, border, imageSize, data));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_CompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CompressedTexImage2DARB(ctx->CurrentDispatch, (target, level, internalformat, width, height, border, imageSize, data));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_CompressedTexImage1DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CompressedTexImage1DARB(ctx->CurrentDispatch, (target, level, internalformat, width, border, imageSize, data));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_CompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CompressedTexSubImage3DARB(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_CompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CompressedTexSubImage2DARB(ctx->CurrentDispatch, (target, level, xoffset, yoffset, width, height, format, imageSize, data));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_CompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_CompressedTexSubImage1DARB(ctx->CurrentDispatch, (target, level, xoffset, width, format, imageSize, data));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetCompressedTexImageARB(GLenum target, GLint level, GLvoid * img)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetCompressedTexImageARB(ctx->CurrentDispatch, (target, level, img));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_SecondaryColor3bEXT {
+   struct marshal_cmd_base header;
+   GLbyte red;
+   GLbyte green;
+   GLbyte blue;
+};
+
+static void
+unmarshal_SecondaryColor3bEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3bEXT *cmd)
+{
+   CALL_SecondaryColor3bEXT(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3bEXT(GLbyte red, GLbyte green, GLbyte blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3bEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3bEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3bEXT, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_SecondaryColor3bvEXT {
+   struct marshal_cmd_base header;
+   GLbyte v[3];
+};
+
+static void
+unmarshal_SecondaryColor3bvEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3bvEXT *cmd)
+{
+   CALL_SecondaryColor3bvEXT(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3bvEXT(const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3bvEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3bvEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3bvEXT, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_SecondaryColor3dEXT {
+   struct marshal_cmd_base header;
+   GLdouble red;
+   GLdouble green;
+   GLdouble blue;
+};
+
+static void
+unmarshal_SecondaryColor3dEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3dEXT *cmd)
+{
+   CALL_SecondaryColor3dEXT(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3dEXT(GLdouble red, GLdouble green, GLdouble blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3dEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3dEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3dEXT, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_SecondaryColor3dvEXT {
+   struct marshal_cmd_base header;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_SecondaryColor3dvEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3dvEXT *cmd)
+{
+   CALL_SecondaryColor3dvEXT(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3dvEXT(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3dvEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3dvEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3dvEXT, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_SecondaryColor3fEXT {
+   struct marshal_cmd_base header;
+   GLfloat red;
+   GLfloat green;
+   GLfloat blue;
+};
+
+static void
+unmarshal_SecondaryColor3fEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3fEXT *cmd)
+{
+   CALL_SecondaryColor3fEXT(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3fEXT(GLfloat red, GLfloat green, GLfloat blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3fEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3fEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3fEXT, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_SecondaryColor3fvEXT {
+   struct marshal_cmd_base header;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_SecondaryColor3fvEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3fvEXT *cmd)
+{
+   CALL_SecondaryColor3fvEXT(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3fvEXT(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3fvEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3fvEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3fvEXT, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_SecondaryColor3iEXT {
+   struct marshal_cmd_base header;
+   GLint red;
+   GLint green;
+   GLint blue;
+};
+
+static void
+unmarshal_SecondaryColor3iEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3iEXT *cmd)
+{
+   CALL_SecondaryColor3iEXT(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3iEXT(GLint red, GLint green, GLint blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3iEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3iEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3iEXT, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_SecondaryColor3ivEXT {
+   struct marshal_cmd_base header;
+   GLint v[3];
+};
+
+static void
+unmarshal_SecondaryColor3ivEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3ivEXT *cmd)
+{
+   CALL_SecondaryColor3ivEXT(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3ivEXT(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3ivEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3ivEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3ivEXT, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_SecondaryColor3sEXT {
+   struct marshal_cmd_base header;
+   GLshort red;
+   GLshort green;
+   GLshort blue;
+};
+
+static void
+unmarshal_SecondaryColor3sEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3sEXT *cmd)
+{
+   CALL_SecondaryColor3sEXT(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3sEXT(GLshort red, GLshort green, GLshort blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3sEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3sEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3sEXT, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_SecondaryColor3svEXT {
+   struct marshal_cmd_base header;
+   GLshort v[3];
+};
+
+static void
+unmarshal_SecondaryColor3svEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3svEXT *cmd)
+{
+   CALL_SecondaryColor3svEXT(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3svEXT(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3svEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3svEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3svEXT, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_SecondaryColor3ubEXT {
+   struct marshal_cmd_base header;
+   GLubyte red;
+   GLubyte green;
+   GLubyte blue;
+};
+
+static void
+unmarshal_SecondaryColor3ubEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3ubEXT *cmd)
+{
+   CALL_SecondaryColor3ubEXT(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3ubEXT(GLubyte red, GLubyte green, GLubyte blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3ubEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3ubEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3ubEXT, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_SecondaryColor3ubvEXT {
+   struct marshal_cmd_base header;
+   GLubyte v[3];
+};
+
+static void
+unmarshal_SecondaryColor3ubvEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3ubvEXT *cmd)
+{
+   CALL_SecondaryColor3ubvEXT(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3ubvEXT(const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3ubvEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3ubvEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3ubvEXT, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_SecondaryColor3uiEXT {
+   struct marshal_cmd_base header;
+   GLuint red;
+   GLuint green;
+   GLuint blue;
+};
+
+static void
+unmarshal_SecondaryColor3uiEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3uiEXT *cmd)
+{
+   CALL_SecondaryColor3uiEXT(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3uiEXT(GLuint red, GLuint green, GLuint blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3uiEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3uiEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3uiEXT, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_SecondaryColor3uivEXT {
+   struct marshal_cmd_base header;
+   GLuint v[3];
+};
+
+static void
+unmarshal_SecondaryColor3uivEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3uivEXT *cmd)
+{
+   CALL_SecondaryColor3uivEXT(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3uivEXT(const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3uivEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3uivEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3uivEXT, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_SecondaryColor3usEXT {
+   struct marshal_cmd_base header;
+   GLushort red;
+   GLushort green;
+   GLushort blue;
+};
+
+static void
+unmarshal_SecondaryColor3usEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3usEXT *cmd)
+{
+   CALL_SecondaryColor3usEXT(ctx->CurrentDispatch, (cmd->red, cmd->green, cmd->blue));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3usEXT(GLushort red, GLushort green, GLushort blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3usEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3usEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3usEXT, sizeof(*cmd));
+   cmd->red = red;
+   cmd->green = green;
+   cmd->blue = blue;
+}
+
+struct marshal_cmd_SecondaryColor3usvEXT {
+   struct marshal_cmd_base header;
+   GLushort v[3];
+};
+
+static void
+unmarshal_SecondaryColor3usvEXT(GLcontext *ctx, const struct marshal_cmd_SecondaryColor3usvEXT *cmd)
+{
+   CALL_SecondaryColor3usvEXT(ctx->CurrentDispatch, (cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColor3usvEXT(const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SecondaryColor3usvEXT *cmd;
+   cmd = (struct marshal_cmd_SecondaryColor3usvEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_SecondaryColor3usvEXT, sizeof(*cmd));
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_SecondaryColorPointerEXT(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_SecondaryColorPointerEXT(ctx->CurrentDispatch, (size, type, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_AreProgramsResidentNV(GLsizei n, const GLuint * ids, GLboolean * residences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_AreProgramsResidentNV(ctx->CurrentDispatch, (n, ids, residences));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_BindProgramNV {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint program;
+};
+
+static void
+unmarshal_BindProgramNV(GLcontext *ctx, const struct marshal_cmd_BindProgramNV *cmd)
+{
+   CALL_BindProgramNV(ctx->CurrentDispatch, (cmd->target, cmd->program));
+}
+
+static void GLAPIENTRY
+marshal_BindProgramNV(GLenum target, GLuint program)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BindProgramNV *cmd;
+   cmd = (struct marshal_cmd_BindProgramNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_BindProgramNV, sizeof(*cmd));
+   cmd->target = target;
+   cmd->program = program;
+}
+
+static void GLAPIENTRY
+marshal_DeleteProgramsNV(GLsizei n, const GLuint * programs)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DeleteProgramsNV(ctx->CurrentDispatch, (n, programs));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ExecuteProgramNV(GLenum target, GLuint id, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ExecuteProgramNV(ctx->CurrentDispatch, (target, id, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GenProgramsNV(GLsizei n, GLuint * programs)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GenProgramsNV(ctx->CurrentDispatch, (n, programs));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramParameterdvNV(GLenum target, GLuint index, GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramParameterdvNV(ctx->CurrentDispatch, (target, index, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramParameterfvNV(ctx->CurrentDispatch, (target, index, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramivNV(GLuint id, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramivNV(ctx->CurrentDispatch, (id, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramStringNV(GLuint id, GLenum pname, GLubyte * program)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramStringNV(ctx->CurrentDispatch, (id, pname, program));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetTrackMatrixivNV(GLenum target, GLuint address, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetTrackMatrixivNV(ctx->CurrentDispatch, (target, address, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetVertexAttribdvARB(GLuint index, GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetVertexAttribdvARB(ctx->CurrentDispatch, (index, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetVertexAttribfvARB(GLuint index, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetVertexAttribfvARB(ctx->CurrentDispatch, (index, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetVertexAttribivARB(GLuint index, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetVertexAttribivARB(ctx->CurrentDispatch, (index, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetVertexAttribPointervNV(GLuint index, GLenum pname, GLvoid ** params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetVertexAttribPointervNV(ctx->CurrentDispatch, (index, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsProgramNV(GLuint program)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsProgramNV(ctx->CurrentDispatch, (program));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_LoadProgramNV(GLenum target, GLuint id, GLsizei len, const GLubyte * program)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_LoadProgramNV(ctx->CurrentDispatch, (target, id, len, program));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ProgramParameter4dNV {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+};
+
+static void
+unmarshal_ProgramParameter4dNV(GLcontext *ctx, const struct marshal_cmd_ProgramParameter4dNV *cmd)
+{
+   CALL_ProgramParameter4dNV(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_ProgramParameter4dNV(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramParameter4dNV *cmd;
+   cmd = (struct marshal_cmd_ProgramParameter4dNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramParameter4dNV, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_ProgramParameter4dvNV {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLdouble params[4];
+};
+
+static void
+unmarshal_ProgramParameter4dvNV(GLcontext *ctx, const struct marshal_cmd_ProgramParameter4dvNV *cmd)
+{
+   CALL_ProgramParameter4dvNV(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_ProgramParameter4dvNV(GLenum target, GLuint index, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramParameter4dvNV *cmd;
+   cmd = (struct marshal_cmd_ProgramParameter4dvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramParameter4dvNV, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   MEMCPY(cmd->params, params, sizeof(cmd->params));
+}
+
+struct marshal_cmd_ProgramParameter4fNV {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+};
+
+static void
+unmarshal_ProgramParameter4fNV(GLcontext *ctx, const struct marshal_cmd_ProgramParameter4fNV *cmd)
+{
+   CALL_ProgramParameter4fNV(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_ProgramParameter4fNV(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramParameter4fNV *cmd;
+   cmd = (struct marshal_cmd_ProgramParameter4fNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramParameter4fNV, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_ProgramParameter4fvNV {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_ProgramParameter4fvNV(GLcontext *ctx, const struct marshal_cmd_ProgramParameter4fvNV *cmd)
+{
+   CALL_ProgramParameter4fvNV(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_ProgramParameter4fvNV(GLenum target, GLuint index, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramParameter4fvNV *cmd;
+   cmd = (struct marshal_cmd_ProgramParameter4fvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramParameter4fvNV, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   MEMCPY(cmd->params, params, sizeof(cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_ProgramParameters4dvNV(GLenum target, GLuint index, GLuint num, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ProgramParameters4dvNV(ctx->CurrentDispatch, (target, index, num, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ProgramParameters4fvNV(GLenum target, GLuint index, GLuint num, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ProgramParameters4fvNV(ctx->CurrentDispatch, (target, index, num, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_RequestResidentProgramsNV(GLsizei n, const GLuint * ids)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_RequestResidentProgramsNV(ctx->CurrentDispatch, (n, ids));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_TrackMatrixNV {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint address;
+   GLenum matrix;
+   GLenum transform;
+};
+
+static void
+unmarshal_TrackMatrixNV(GLcontext *ctx, const struct marshal_cmd_TrackMatrixNV *cmd)
+{
+   CALL_TrackMatrixNV(ctx->CurrentDispatch, (cmd->target, cmd->address, cmd->matrix, cmd->transform));
+}
+
+static void GLAPIENTRY
+marshal_TrackMatrixNV(GLenum target, GLuint address, GLenum matrix, GLenum transform)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_TrackMatrixNV *cmd;
+   cmd = (struct marshal_cmd_TrackMatrixNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_TrackMatrixNV, sizeof(*cmd));
+   cmd->target = target;
+   cmd->address = address;
+   cmd->matrix = matrix;
+   cmd->transform = transform;
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribPointerNV(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribPointerNV(ctx->CurrentDispatch, (index, size, type, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_VertexAttrib1dARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble x;
+};
+
+static void
+unmarshal_VertexAttrib1dARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1dARB *cmd)
+{
+   CALL_VertexAttrib1dARB(ctx->CurrentDispatch, (cmd->index, cmd->x));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1dARB(GLuint index, GLdouble x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1dARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1dARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+}
+
+struct marshal_cmd_VertexAttrib1dvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble v[1];
+};
+
+static void
+unmarshal_VertexAttrib1dvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1dvARB *cmd)
+{
+   CALL_VertexAttrib1dvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1dvARB(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1dvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1dvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib1fARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat x;
+};
+
+static void
+unmarshal_VertexAttrib1fARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1fARB *cmd)
+{
+   CALL_VertexAttrib1fARB(ctx->CurrentDispatch, (cmd->index, cmd->x));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1fARB(GLuint index, GLfloat x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1fARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1fARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+}
+
+struct marshal_cmd_VertexAttrib1fvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat v[1];
+};
+
+static void
+unmarshal_VertexAttrib1fvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1fvARB *cmd)
+{
+   CALL_VertexAttrib1fvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1fvARB(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1fvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1fvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib1sARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort x;
+};
+
+static void
+unmarshal_VertexAttrib1sARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1sARB *cmd)
+{
+   CALL_VertexAttrib1sARB(ctx->CurrentDispatch, (cmd->index, cmd->x));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1sARB(GLuint index, GLshort x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1sARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1sARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1sARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+}
+
+struct marshal_cmd_VertexAttrib1svARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort v[1];
+};
+
+static void
+unmarshal_VertexAttrib1svARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1svARB *cmd)
+{
+   CALL_VertexAttrib1svARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1svARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1svARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1svARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1svARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib2dARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+};
+
+static void
+unmarshal_VertexAttrib2dARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2dARB *cmd)
+{
+   CALL_VertexAttrib2dARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2dARB(GLuint index, GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2dARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2dARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_VertexAttrib2dvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble v[2];
+};
+
+static void
+unmarshal_VertexAttrib2dvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2dvARB *cmd)
+{
+   CALL_VertexAttrib2dvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2dvARB(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2dvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2dvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib2fARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+};
+
+static void
+unmarshal_VertexAttrib2fARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2fARB *cmd)
+{
+   CALL_VertexAttrib2fARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2fARB(GLuint index, GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2fARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2fARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_VertexAttrib2fvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat v[2];
+};
+
+static void
+unmarshal_VertexAttrib2fvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2fvARB *cmd)
+{
+   CALL_VertexAttrib2fvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2fvARB(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2fvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2fvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib2sARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort x;
+   GLshort y;
+};
+
+static void
+unmarshal_VertexAttrib2sARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2sARB *cmd)
+{
+   CALL_VertexAttrib2sARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2sARB(GLuint index, GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2sARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2sARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2sARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_VertexAttrib2svARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort v[2];
+};
+
+static void
+unmarshal_VertexAttrib2svARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2svARB *cmd)
+{
+   CALL_VertexAttrib2svARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2svARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2svARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2svARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2svARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib3dARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+};
+
+static void
+unmarshal_VertexAttrib3dARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3dARB *cmd)
+{
+   CALL_VertexAttrib3dARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3dARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3dARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_VertexAttrib3dvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_VertexAttrib3dvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3dvARB *cmd)
+{
+   CALL_VertexAttrib3dvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3dvARB(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3dvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3dvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib3fARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+};
+
+static void
+unmarshal_VertexAttrib3fARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3fARB *cmd)
+{
+   CALL_VertexAttrib3fARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3fARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3fARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_VertexAttrib3fvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_VertexAttrib3fvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3fvARB *cmd)
+{
+   CALL_VertexAttrib3fvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3fvARB(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3fvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3fvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib3sARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+};
+
+static void
+unmarshal_VertexAttrib3sARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3sARB *cmd)
+{
+   CALL_VertexAttrib3sARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3sARB(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3sARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3sARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3sARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_VertexAttrib3svARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort v[3];
+};
+
+static void
+unmarshal_VertexAttrib3svARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3svARB *cmd)
+{
+   CALL_VertexAttrib3svARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3svARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3svARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3svARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3svARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4dARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+};
+
+static void
+unmarshal_VertexAttrib4dARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4dARB *cmd)
+{
+   CALL_VertexAttrib4dARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4dARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4dARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_VertexAttrib4dvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble v[4];
+};
+
+static void
+unmarshal_VertexAttrib4dvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4dvARB *cmd)
+{
+   CALL_VertexAttrib4dvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4dvARB(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4dvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4dvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4fARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+};
+
+static void
+unmarshal_VertexAttrib4fARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4fARB *cmd)
+{
+   CALL_VertexAttrib4fARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4fARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4fARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_VertexAttrib4fvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat v[4];
+};
+
+static void
+unmarshal_VertexAttrib4fvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4fvARB *cmd)
+{
+   CALL_VertexAttrib4fvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4fvARB(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4fvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4fvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4sARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+};
+
+static void
+unmarshal_VertexAttrib4sARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4sARB *cmd)
+{
+   CALL_VertexAttrib4sARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4sARB(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4sARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4sARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4sARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_VertexAttrib4svARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort v[4];
+};
+
+static void
+unmarshal_VertexAttrib4svARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4svARB *cmd)
+{
+   CALL_VertexAttrib4svARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4svARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4svARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4svARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4svARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4NubARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLubyte x;
+   GLubyte y;
+   GLubyte z;
+   GLubyte w;
+};
+
+static void
+unmarshal_VertexAttrib4NubARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4NubARB *cmd)
+{
+   CALL_VertexAttrib4NubARB(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4NubARB(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4NubARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4NubARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4NubARB, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_VertexAttrib4NubvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLubyte v[4];
+};
+
+static void
+unmarshal_VertexAttrib4NubvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4NubvARB *cmd)
+{
+   CALL_VertexAttrib4NubvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4NubvARB(GLuint index, const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4NubvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4NubvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4NubvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs1dvNV(GLuint index, GLsizei n, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs1dvNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs1fvNV(GLuint index, GLsizei n, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs1fvNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs1svNV(GLuint index, GLsizei n, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs1svNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs2dvNV(GLuint index, GLsizei n, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs2dvNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs2fvNV(GLuint index, GLsizei n, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs2fvNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs2svNV(GLuint index, GLsizei n, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs2svNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs3dvNV(GLuint index, GLsizei n, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs3dvNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs3fvNV(GLuint index, GLsizei n, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs3fvNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs3svNV(GLuint index, GLsizei n, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs3svNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs4dvNV(GLuint index, GLsizei n, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs4dvNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs4fvNV(GLuint index, GLsizei n, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs4fvNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs4svNV(GLuint index, GLsizei n, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs4svNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribs4ubvNV(GLuint index, GLsizei n, const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribs4ubvNV(ctx->CurrentDispatch, (index, n, v));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_PointParameteriNV {
+   struct marshal_cmd_base header;
+   GLenum pname;
+   GLint param;
+};
+
+static void
+unmarshal_PointParameteriNV(GLcontext *ctx, const struct marshal_cmd_PointParameteriNV *cmd)
+{
+   CALL_PointParameteriNV(ctx->CurrentDispatch, (cmd->pname, cmd->param));
+}
+
+static void GLAPIENTRY
+marshal_PointParameteriNV(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PointParameteriNV *cmd;
+   cmd = (struct marshal_cmd_PointParameteriNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_PointParameteriNV, sizeof(*cmd));
+   cmd->pname = pname;
+   cmd->param = param;
+}
+
+static void GLAPIENTRY
+marshal_PointParameterivNV(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_PointParameterivNV(ctx->CurrentDispatch, (pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_MultiDrawArraysEXT(GLenum mode, GLint * first, GLsizei * count, GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_MultiDrawArraysEXT(ctx->CurrentDispatch, (mode, first, count, primcount));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_MultiDrawElementsEXT(GLenum mode, const GLsizei * count, GLenum type, const GLvoid ** indices, GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_MultiDrawElementsEXT(ctx->CurrentDispatch, (mode, count, type, indices, primcount));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ActiveStencilFaceEXT {
+   struct marshal_cmd_base header;
+   GLenum face;
+};
+
+static void
+unmarshal_ActiveStencilFaceEXT(GLcontext *ctx, const struct marshal_cmd_ActiveStencilFaceEXT *cmd)
+{
+   CALL_ActiveStencilFaceEXT(ctx->CurrentDispatch, (cmd->face));
+}
+
+static void GLAPIENTRY
+marshal_ActiveStencilFaceEXT(GLenum face)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ActiveStencilFaceEXT *cmd;
+   cmd = (struct marshal_cmd_ActiveStencilFaceEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_ActiveStencilFaceEXT, sizeof(*cmd));
+   cmd->face = face;
+}
+
+static void GLAPIENTRY
+marshal_DeleteFencesNV(GLsizei n, const GLuint * fences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DeleteFencesNV(ctx->CurrentDispatch, (n, fences));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GenFencesNV(GLsizei n, GLuint * fences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GenFencesNV(ctx->CurrentDispatch, (n, fences));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsFenceNV(GLuint fence)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsFenceNV(ctx->CurrentDispatch, (fence));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static GLboolean GLAPIENTRY
+marshal_TestFenceNV(GLuint fence)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_TestFenceNV(ctx->CurrentDispatch, (fence));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_GetFenceivNV(GLuint fence, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetFenceivNV(ctx->CurrentDispatch, (fence, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_FinishFenceNV(GLuint fence)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_FinishFenceNV(ctx->CurrentDispatch, (fence));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_SetFenceNV {
+   struct marshal_cmd_base header;
+   GLuint fence;
+   GLenum condition;
+};
+
+static void
+unmarshal_SetFenceNV(GLcontext *ctx, const struct marshal_cmd_SetFenceNV *cmd)
+{
+   CALL_SetFenceNV(ctx->CurrentDispatch, (cmd->fence, cmd->condition));
+}
+
+static void GLAPIENTRY
+marshal_SetFenceNV(GLuint fence, GLenum condition)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SetFenceNV *cmd;
+   cmd = (struct marshal_cmd_SetFenceNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_SetFenceNV, sizeof(*cmd));
+   cmd->fence = fence;
+   cmd->condition = condition;
+}
+
+struct marshal_cmd_VertexAttrib4bvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLbyte v[4];
+};
+
+static void
+unmarshal_VertexAttrib4bvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4bvARB *cmd)
+{
+   CALL_VertexAttrib4bvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4bvARB(GLuint index, const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4bvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4bvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4bvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4ivARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLint v[4];
+};
+
+static void
+unmarshal_VertexAttrib4ivARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4ivARB *cmd)
+{
+   CALL_VertexAttrib4ivARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4ivARB(GLuint index, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4ivARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4ivARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4ivARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4ubvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLubyte v[4];
+};
+
+static void
+unmarshal_VertexAttrib4ubvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4ubvARB *cmd)
+{
+   CALL_VertexAttrib4ubvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4ubvARB(GLuint index, const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4ubvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4ubvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4ubvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4usvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLushort v[4];
+};
+
+static void
+unmarshal_VertexAttrib4usvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4usvARB *cmd)
+{
+   CALL_VertexAttrib4usvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4usvARB(GLuint index, const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4usvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4usvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4usvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4uivARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLuint v[4];
+};
+
+static void
+unmarshal_VertexAttrib4uivARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4uivARB *cmd)
+{
+   CALL_VertexAttrib4uivARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4uivARB(GLuint index, const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4uivARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4uivARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4uivARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4NbvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLbyte v[4];
+};
+
+static void
+unmarshal_VertexAttrib4NbvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4NbvARB *cmd)
+{
+   CALL_VertexAttrib4NbvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4NbvARB(GLuint index, const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4NbvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4NbvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4NbvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4NsvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort v[4];
+};
+
+static void
+unmarshal_VertexAttrib4NsvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4NsvARB *cmd)
+{
+   CALL_VertexAttrib4NsvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4NsvARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4NsvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4NsvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4NsvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4NivARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLint v[4];
+};
+
+static void
+unmarshal_VertexAttrib4NivARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4NivARB *cmd)
+{
+   CALL_VertexAttrib4NivARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4NivARB(GLuint index, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4NivARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4NivARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4NivARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4NusvARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLushort v[4];
+};
+
+static void
+unmarshal_VertexAttrib4NusvARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4NusvARB *cmd)
+{
+   CALL_VertexAttrib4NusvARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4NusvARB(GLuint index, const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4NusvARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4NusvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4NusvARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4NuivARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLuint v[4];
+};
+
+static void
+unmarshal_VertexAttrib4NuivARB(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4NuivARB *cmd)
+{
+   CALL_VertexAttrib4NuivARB(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4NuivARB(GLuint index, const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4NuivARB *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4NuivARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4NuivARB, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttribPointerARB(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_VertexAttribPointerARB(ctx->CurrentDispatch, (index, size, type, normalized, stride, pointer));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_EnableVertexAttribArrayARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+};
+
+static void
+unmarshal_EnableVertexAttribArrayARB(GLcontext *ctx, const struct marshal_cmd_EnableVertexAttribArrayARB *cmd)
+{
+   CALL_EnableVertexAttribArrayARB(ctx->CurrentDispatch, (cmd->index));
+}
+
+static void GLAPIENTRY
+marshal_EnableVertexAttribArrayARB(GLuint index)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EnableVertexAttribArrayARB *cmd;
+   cmd = (struct marshal_cmd_EnableVertexAttribArrayARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_EnableVertexAttribArrayARB, sizeof(*cmd));
+   cmd->index = index;
+}
+
+struct marshal_cmd_DisableVertexAttribArrayARB {
+   struct marshal_cmd_base header;
+   GLuint index;
+};
+
+static void
+unmarshal_DisableVertexAttribArrayARB(GLcontext *ctx, const struct marshal_cmd_DisableVertexAttribArrayARB *cmd)
+{
+   CALL_DisableVertexAttribArrayARB(ctx->CurrentDispatch, (cmd->index));
+}
+
+static void GLAPIENTRY
+marshal_DisableVertexAttribArrayARB(GLuint index)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DisableVertexAttribArrayARB *cmd;
+   cmd = (struct marshal_cmd_DisableVertexAttribArrayARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_DisableVertexAttribArrayARB, sizeof(*cmd));
+   cmd->index = index;
+}
+
+static void GLAPIENTRY
+marshal_ProgramStringARB(GLenum target, GLenum format, GLsizei len, const GLvoid * string)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ProgramStringARB(ctx->CurrentDispatch, (target, format, len, string));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_ProgramEnvParameter4dARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+};
+
+static void
+unmarshal_ProgramEnvParameter4dARB(GLcontext *ctx, const struct marshal_cmd_ProgramEnvParameter4dARB *cmd)
+{
+   CALL_ProgramEnvParameter4dARB(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_ProgramEnvParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramEnvParameter4dARB *cmd;
+   cmd = (struct marshal_cmd_ProgramEnvParameter4dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramEnvParameter4dARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_ProgramEnvParameter4dvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLdouble params[4];
+};
+
+static void
+unmarshal_ProgramEnvParameter4dvARB(GLcontext *ctx, const struct marshal_cmd_ProgramEnvParameter4dvARB *cmd)
+{
+   CALL_ProgramEnvParameter4dvARB(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_ProgramEnvParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramEnvParameter4dvARB *cmd;
+   cmd = (struct marshal_cmd_ProgramEnvParameter4dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramEnvParameter4dvARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   MEMCPY(cmd->params, params, sizeof(cmd->params));
+}
+
+struct marshal_cmd_ProgramEnvParameter4fARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+};
+
+static void
+unmarshal_ProgramEnvParameter4fARB(GLcontext *ctx, const struct marshal_cmd_ProgramEnvParameter4fARB *cmd)
+{
+   CALL_ProgramEnvParameter4fARB(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_ProgramEnvParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramEnvParameter4fARB *cmd;
+   cmd = (struct marshal_cmd_ProgramEnvParameter4fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramEnvParameter4fARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_ProgramEnvParameter4fvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_ProgramEnvParameter4fvARB(GLcontext *ctx, const struct marshal_cmd_ProgramEnvParameter4fvARB *cmd)
+{
+   CALL_ProgramEnvParameter4fvARB(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_ProgramEnvParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramEnvParameter4fvARB *cmd;
+   cmd = (struct marshal_cmd_ProgramEnvParameter4fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramEnvParameter4fvARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   MEMCPY(cmd->params, params, sizeof(cmd->params));
+}
+
+struct marshal_cmd_ProgramLocalParameter4dARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+};
+
+static void
+unmarshal_ProgramLocalParameter4dARB(GLcontext *ctx, const struct marshal_cmd_ProgramLocalParameter4dARB *cmd)
+{
+   CALL_ProgramLocalParameter4dARB(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_ProgramLocalParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramLocalParameter4dARB *cmd;
+   cmd = (struct marshal_cmd_ProgramLocalParameter4dARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramLocalParameter4dARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_ProgramLocalParameter4dvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLdouble params[4];
+};
+
+static void
+unmarshal_ProgramLocalParameter4dvARB(GLcontext *ctx, const struct marshal_cmd_ProgramLocalParameter4dvARB *cmd)
+{
+   CALL_ProgramLocalParameter4dvARB(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_ProgramLocalParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramLocalParameter4dvARB *cmd;
+   cmd = (struct marshal_cmd_ProgramLocalParameter4dvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramLocalParameter4dvARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   MEMCPY(cmd->params, params, sizeof(cmd->params));
+}
+
+struct marshal_cmd_ProgramLocalParameter4fARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+};
+
+static void
+unmarshal_ProgramLocalParameter4fARB(GLcontext *ctx, const struct marshal_cmd_ProgramLocalParameter4fARB *cmd)
+{
+   CALL_ProgramLocalParameter4fARB(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_ProgramLocalParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramLocalParameter4fARB *cmd;
+   cmd = (struct marshal_cmd_ProgramLocalParameter4fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramLocalParameter4fARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_ProgramLocalParameter4fvARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint index;
+   GLfloat params[4];
+};
+
+static void
+unmarshal_ProgramLocalParameter4fvARB(GLcontext *ctx, const struct marshal_cmd_ProgramLocalParameter4fvARB *cmd)
+{
+   CALL_ProgramLocalParameter4fvARB(ctx->CurrentDispatch, (cmd->target, cmd->index, cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_ProgramLocalParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ProgramLocalParameter4fvARB *cmd;
+   cmd = (struct marshal_cmd_ProgramLocalParameter4fvARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ProgramLocalParameter4fvARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->index = index;
+   MEMCPY(cmd->params, params, sizeof(cmd->params));
+}
+
+static void GLAPIENTRY
+marshal_GetProgramEnvParameterdvARB(GLenum target, GLuint index, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramEnvParameterdvARB(ctx->CurrentDispatch, (target, index, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramEnvParameterfvARB(GLenum target, GLuint index, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramEnvParameterfvARB(ctx->CurrentDispatch, (target, index, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramLocalParameterdvARB(GLenum target, GLuint index, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramLocalParameterdvARB(ctx->CurrentDispatch, (target, index, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramLocalParameterfvARB(GLenum target, GLuint index, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramLocalParameterfvARB(ctx->CurrentDispatch, (target, index, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramivARB(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramivARB(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramStringARB(GLenum target, GLenum pname, GLvoid * string)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramStringARB(ctx->CurrentDispatch, (target, pname, string));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ProgramNamedParameter4fNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ProgramNamedParameter4fNV(ctx->CurrentDispatch, (id, len, name, x, y, z, w));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ProgramNamedParameter4dNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ProgramNamedParameter4dNV(ctx->CurrentDispatch, (id, len, name, x, y, z, w));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ProgramNamedParameter4fvNV(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ProgramNamedParameter4fvNV(ctx->CurrentDispatch, (id, len, name, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_ProgramNamedParameter4dvNV(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ProgramNamedParameter4dvNV(ctx->CurrentDispatch, (id, len, name, v));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramNamedParameterfvNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramNamedParameterfvNV(ctx->CurrentDispatch, (id, len, name, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetProgramNamedParameterdvNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetProgramNamedParameterdvNV(ctx->CurrentDispatch, (id, len, name, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_BindBufferARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint buffer;
+};
+
+static void
+unmarshal_BindBufferARB(GLcontext *ctx, const struct marshal_cmd_BindBufferARB *cmd)
+{
+   CALL_BindBufferARB(ctx->CurrentDispatch, (cmd->target, cmd->buffer));
+}
+
+static void GLAPIENTRY
+marshal_BindBufferARB(GLenum target, GLuint buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BindBufferARB *cmd;
+   cmd = (struct marshal_cmd_BindBufferARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_BindBufferARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->buffer = buffer;
+}
+
+static void GLAPIENTRY
+marshal_BufferDataARB(GLenum target, GLsizeiptrARB size, const GLvoid * data, GLenum usage)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_BufferDataARB(ctx->CurrentDispatch, (target, size, data, usage));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_BufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_BufferSubDataARB(ctx->CurrentDispatch, (target, offset, size, data));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_DeleteBuffersARB(GLsizei n, const GLuint * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DeleteBuffersARB(ctx->CurrentDispatch, (n, buffer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GenBuffersARB(GLsizei n, GLuint * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GenBuffersARB(ctx->CurrentDispatch, (n, buffer));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetBufferParameterivARB(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetBufferParameterivARB(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetBufferPointervARB(GLenum target, GLenum pname, GLvoid ** params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetBufferPointervARB(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetBufferSubDataARB(ctx->CurrentDispatch, (target, offset, size, data));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsBufferARB(GLuint buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsBufferARB(ctx->CurrentDispatch, (buffer));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static GLvoid * GLAPIENTRY
+marshal_MapBufferARB(GLenum target, GLenum access)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLvoid * ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_MapBufferARB(ctx->CurrentDispatch, (target, access));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static GLboolean GLAPIENTRY
+marshal_UnmapBufferARB(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_UnmapBufferARB(ctx->CurrentDispatch, (target));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_DepthBoundsEXT {
+   struct marshal_cmd_base header;
+   GLclampd zmin;
+   GLclampd zmax;
+};
+
+static void
+unmarshal_DepthBoundsEXT(GLcontext *ctx, const struct marshal_cmd_DepthBoundsEXT *cmd)
+{
+   CALL_DepthBoundsEXT(ctx->CurrentDispatch, (cmd->zmin, cmd->zmax));
+}
+
+static void GLAPIENTRY
+marshal_DepthBoundsEXT(GLclampd zmin, GLclampd zmax)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DepthBoundsEXT *cmd;
+   cmd = (struct marshal_cmd_DepthBoundsEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_DepthBoundsEXT, sizeof(*cmd));
+   cmd->zmin = zmin;
+   cmd->zmax = zmax;
+}
+
+static void GLAPIENTRY
+marshal_GenQueriesARB(GLsizei n, GLuint * ids)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GenQueriesARB(ctx->CurrentDispatch, (n, ids));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_DeleteQueriesARB(GLsizei n, const GLuint * ids)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DeleteQueriesARB(ctx->CurrentDispatch, (n, ids));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsQueryARB(GLuint id)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsQueryARB(ctx->CurrentDispatch, (id));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_BeginQueryARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint id;
+};
+
+static void
+unmarshal_BeginQueryARB(GLcontext *ctx, const struct marshal_cmd_BeginQueryARB *cmd)
+{
+   CALL_BeginQueryARB(ctx->CurrentDispatch, (cmd->target, cmd->id));
+}
+
+static void GLAPIENTRY
+marshal_BeginQueryARB(GLenum target, GLuint id)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BeginQueryARB *cmd;
+   cmd = (struct marshal_cmd_BeginQueryARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_BeginQueryARB, sizeof(*cmd));
+   cmd->target = target;
+   cmd->id = id;
+}
+
+struct marshal_cmd_EndQueryARB {
+   struct marshal_cmd_base header;
+   GLenum target;
+};
+
+static void
+unmarshal_EndQueryARB(GLcontext *ctx, const struct marshal_cmd_EndQueryARB *cmd)
+{
+   CALL_EndQueryARB(ctx->CurrentDispatch, (cmd->target));
+}
+
+static void GLAPIENTRY
+marshal_EndQueryARB(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EndQueryARB *cmd;
+   cmd = (struct marshal_cmd_EndQueryARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_EndQueryARB, sizeof(*cmd));
+   cmd->target = target;
+}
+
+static void GLAPIENTRY
+marshal_GetQueryivARB(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetQueryivARB(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetQueryObjectivARB(GLuint id, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetQueryObjectivARB(ctx->CurrentDispatch, (id, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetQueryObjectuivARB(GLuint id, GLenum pname, GLuint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetQueryObjectuivARB(ctx->CurrentDispatch, (id, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_MultiModeDrawArraysIBM(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_MultiModeDrawArraysIBM(ctx->CurrentDispatch, (mode, first, count, primcount, modestride));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_MultiModeDrawElementsIBM(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, GLint modestride)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_MultiModeDrawElementsIBM(ctx->CurrentDispatch, (mode, count, type, indices, primcount, modestride));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_BlendEquationSeparateEXT {
+   struct marshal_cmd_base header;
+   GLenum modeRGB;
+   GLenum modeA;
+};
+
+static void
+unmarshal_BlendEquationSeparateEXT(GLcontext *ctx, const struct marshal_cmd_BlendEquationSeparateEXT *cmd)
+{
+   CALL_BlendEquationSeparateEXT(ctx->CurrentDispatch, (cmd->modeRGB, cmd->modeA));
+}
+
+static void GLAPIENTRY
+marshal_BlendEquationSeparateEXT(GLenum modeRGB, GLenum modeA)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BlendEquationSeparateEXT *cmd;
+   cmd = (struct marshal_cmd_BlendEquationSeparateEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_BlendEquationSeparateEXT, sizeof(*cmd));
+   cmd->modeRGB = modeRGB;
+   cmd->modeA = modeA;
+}
+
+struct marshal_cmd_DeleteObjectARB {
+   struct marshal_cmd_base header;
+   GLhandleARB obj;
+};
+
+static void
+unmarshal_DeleteObjectARB(GLcontext *ctx, const struct marshal_cmd_DeleteObjectARB *cmd)
+{
+   CALL_DeleteObjectARB(ctx->CurrentDispatch, (cmd->obj));
+}
+
+static void GLAPIENTRY
+marshal_DeleteObjectARB(GLhandleARB obj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DeleteObjectARB *cmd;
+   cmd = (struct marshal_cmd_DeleteObjectARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_DeleteObjectARB, sizeof(*cmd));
+   cmd->obj = obj;
+}
+
+static GLhandleARB GLAPIENTRY
+marshal_GetHandleARB(GLenum pname)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLhandleARB ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_GetHandleARB(ctx->CurrentDispatch, (pname));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_DetachObjectARB {
+   struct marshal_cmd_base header;
+   GLhandleARB containerObj;
+   GLhandleARB attachedObj;
+};
+
+static void
+unmarshal_DetachObjectARB(GLcontext *ctx, const struct marshal_cmd_DetachObjectARB *cmd)
+{
+   CALL_DetachObjectARB(ctx->CurrentDispatch, (cmd->containerObj, cmd->attachedObj));
+}
+
+static void GLAPIENTRY
+marshal_DetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DetachObjectARB *cmd;
+   cmd = (struct marshal_cmd_DetachObjectARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_DetachObjectARB, sizeof(*cmd));
+   cmd->containerObj = containerObj;
+   cmd->attachedObj = attachedObj;
+}
+
+static GLhandleARB GLAPIENTRY
+marshal_CreateShaderObjectARB(GLenum shaderType)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLhandleARB ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_CreateShaderObjectARB(ctx->CurrentDispatch, (shaderType));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_ShaderSourceARB(GLhandleARB shaderObj, GLsizei count, const GLcharARB ** string, const GLint * length)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_ShaderSourceARB(ctx->CurrentDispatch, (shaderObj, count, string, length));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_CompileShaderARB {
+   struct marshal_cmd_base header;
+   GLhandleARB shaderObj;
+};
+
+static void
+unmarshal_CompileShaderARB(GLcontext *ctx, const struct marshal_cmd_CompileShaderARB *cmd)
+{
+   CALL_CompileShaderARB(ctx->CurrentDispatch, (cmd->shaderObj));
+}
+
+static void GLAPIENTRY
+marshal_CompileShaderARB(GLhandleARB shaderObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_CompileShaderARB *cmd;
+   cmd = (struct marshal_cmd_CompileShaderARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_CompileShaderARB, sizeof(*cmd));
+   cmd->shaderObj = shaderObj;
+}
+
+static GLhandleARB GLAPIENTRY
+marshal_CreateProgramObjectARB(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLhandleARB ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_CreateProgramObjectARB(ctx->CurrentDispatch, ());
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_AttachObjectARB {
+   struct marshal_cmd_base header;
+   GLhandleARB containerObj;
+   GLhandleARB obj;
+};
+
+static void
+unmarshal_AttachObjectARB(GLcontext *ctx, const struct marshal_cmd_AttachObjectARB *cmd)
+{
+   CALL_AttachObjectARB(ctx->CurrentDispatch, (cmd->containerObj, cmd->obj));
+}
+
+static void GLAPIENTRY
+marshal_AttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_AttachObjectARB *cmd;
+   cmd = (struct marshal_cmd_AttachObjectARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_AttachObjectARB, sizeof(*cmd));
+   cmd->containerObj = containerObj;
+   cmd->obj = obj;
+}
+
+struct marshal_cmd_LinkProgramARB {
+   struct marshal_cmd_base header;
+   GLhandleARB programObj;
+};
+
+static void
+unmarshal_LinkProgramARB(GLcontext *ctx, const struct marshal_cmd_LinkProgramARB *cmd)
+{
+   CALL_LinkProgramARB(ctx->CurrentDispatch, (cmd->programObj));
+}
+
+static void GLAPIENTRY
+marshal_LinkProgramARB(GLhandleARB programObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_LinkProgramARB *cmd;
+   cmd = (struct marshal_cmd_LinkProgramARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_LinkProgramARB, sizeof(*cmd));
+   cmd->programObj = programObj;
+}
+
+struct marshal_cmd_UseProgramObjectARB {
+   struct marshal_cmd_base header;
+   GLhandleARB programObj;
+};
+
+static void
+unmarshal_UseProgramObjectARB(GLcontext *ctx, const struct marshal_cmd_UseProgramObjectARB *cmd)
+{
+   CALL_UseProgramObjectARB(ctx->CurrentDispatch, (cmd->programObj));
+}
+
+static void GLAPIENTRY
+marshal_UseProgramObjectARB(GLhandleARB programObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_UseProgramObjectARB *cmd;
+   cmd = (struct marshal_cmd_UseProgramObjectARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_UseProgramObjectARB, sizeof(*cmd));
+   cmd->programObj = programObj;
+}
+
+struct marshal_cmd_ValidateProgramARB {
+   struct marshal_cmd_base header;
+   GLhandleARB programObj;
+};
+
+static void
+unmarshal_ValidateProgramARB(GLcontext *ctx, const struct marshal_cmd_ValidateProgramARB *cmd)
+{
+   CALL_ValidateProgramARB(ctx->CurrentDispatch, (cmd->programObj));
+}
+
+static void GLAPIENTRY
+marshal_ValidateProgramARB(GLhandleARB programObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ValidateProgramARB *cmd;
+   cmd = (struct marshal_cmd_ValidateProgramARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_ValidateProgramARB, sizeof(*cmd));
+   cmd->programObj = programObj;
+}
+
+struct marshal_cmd_Uniform1fARB {
+   struct marshal_cmd_base header;
+   GLint location;
+   GLfloat v0;
+};
+
+static void
+unmarshal_Uniform1fARB(GLcontext *ctx, const struct marshal_cmd_Uniform1fARB *cmd)
+{
+   CALL_Uniform1fARB(ctx->CurrentDispatch, (cmd->location, cmd->v0));
+}
+
+static void GLAPIENTRY
+marshal_Uniform1fARB(GLint location, GLfloat v0)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Uniform1fARB *cmd;
+   cmd = (struct marshal_cmd_Uniform1fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_Uniform1fARB, sizeof(*cmd));
+   cmd->location = location;
+   cmd->v0 = v0;
+}
+
+struct marshal_cmd_Uniform2fARB {
+   struct marshal_cmd_base header;
+   GLint location;
+   GLfloat v0;
+   GLfloat v1;
+};
+
+static void
+unmarshal_Uniform2fARB(GLcontext *ctx, const struct marshal_cmd_Uniform2fARB *cmd)
+{
+   CALL_Uniform2fARB(ctx->CurrentDispatch, (cmd->location, cmd->v0, cmd->v1));
+}
+
+static void GLAPIENTRY
+marshal_Uniform2fARB(GLint location, GLfloat v0, GLfloat v1)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Uniform2fARB *cmd;
+   cmd = (struct marshal_cmd_Uniform2fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_Uniform2fARB, sizeof(*cmd));
+   cmd->location = location;
+   cmd->v0 = v0;
+   cmd->v1 = v1;
+}
+
+struct marshal_cmd_Uniform3fARB {
+   struct marshal_cmd_base header;
+   GLint location;
+   GLfloat v0;
+   GLfloat v1;
+   GLfloat v2;
+};
+
+static void
+unmarshal_Uniform3fARB(GLcontext *ctx, const struct marshal_cmd_Uniform3fARB *cmd)
+{
+   CALL_Uniform3fARB(ctx->CurrentDispatch, (cmd->location, cmd->v0, cmd->v1, cmd->v2));
+}
+
+static void GLAPIENTRY
+marshal_Uniform3fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Uniform3fARB *cmd;
+   cmd = (struct marshal_cmd_Uniform3fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_Uniform3fARB, sizeof(*cmd));
+   cmd->location = location;
+   cmd->v0 = v0;
+   cmd->v1 = v1;
+   cmd->v2 = v2;
+}
+
+struct marshal_cmd_Uniform4fARB {
+   struct marshal_cmd_base header;
+   GLint location;
+   GLfloat v0;
+   GLfloat v1;
+   GLfloat v2;
+   GLfloat v3;
+};
+
+static void
+unmarshal_Uniform4fARB(GLcontext *ctx, const struct marshal_cmd_Uniform4fARB *cmd)
+{
+   CALL_Uniform4fARB(ctx->CurrentDispatch, (cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3));
+}
+
+static void GLAPIENTRY
+marshal_Uniform4fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Uniform4fARB *cmd;
+   cmd = (struct marshal_cmd_Uniform4fARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_Uniform4fARB, sizeof(*cmd));
+   cmd->location = location;
+   cmd->v0 = v0;
+   cmd->v1 = v1;
+   cmd->v2 = v2;
+   cmd->v3 = v3;
+}
+
+struct marshal_cmd_Uniform1iARB {
+   struct marshal_cmd_base header;
+   GLint location;
+   GLint v0;
+};
+
+static void
+unmarshal_Uniform1iARB(GLcontext *ctx, const struct marshal_cmd_Uniform1iARB *cmd)
+{
+   CALL_Uniform1iARB(ctx->CurrentDispatch, (cmd->location, cmd->v0));
+}
+
+static void GLAPIENTRY
+marshal_Uniform1iARB(GLint location, GLint v0)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Uniform1iARB *cmd;
+   cmd = (struct marshal_cmd_Uniform1iARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_Uniform1iARB, sizeof(*cmd));
+   cmd->location = location;
+   cmd->v0 = v0;
+}
+
+struct marshal_cmd_Uniform2iARB {
+   struct marshal_cmd_base header;
+   GLint location;
+   GLint v0;
+   GLint v1;
+};
+
+static void
+unmarshal_Uniform2iARB(GLcontext *ctx, const struct marshal_cmd_Uniform2iARB *cmd)
+{
+   CALL_Uniform2iARB(ctx->CurrentDispatch, (cmd->location, cmd->v0, cmd->v1));
+}
+
+static void GLAPIENTRY
+marshal_Uniform2iARB(GLint location, GLint v0, GLint v1)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Uniform2iARB *cmd;
+   cmd = (struct marshal_cmd_Uniform2iARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_Uniform2iARB, sizeof(*cmd));
+   cmd->location = location;
+   cmd->v0 = v0;
+   cmd->v1 = v1;
+}
+
+struct marshal_cmd_Uniform3iARB {
+   struct marshal_cmd_base header;
+   GLint location;
+   GLint v0;
+   GLint v1;
+   GLint v2;
+};
+
+static void
+unmarshal_Uniform3iARB(GLcontext *ctx, const struct marshal_cmd_Uniform3iARB *cmd)
+{
+   CALL_Uniform3iARB(ctx->CurrentDispatch, (cmd->location, cmd->v0, cmd->v1, cmd->v2));
+}
+
+static void GLAPIENTRY
+marshal_Uniform3iARB(GLint location, GLint v0, GLint v1, GLint v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Uniform3iARB *cmd;
+   cmd = (struct marshal_cmd_Uniform3iARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_Uniform3iARB, sizeof(*cmd));
+   cmd->location = location;
+   cmd->v0 = v0;
+   cmd->v1 = v1;
+   cmd->v2 = v2;
+}
+
+struct marshal_cmd_Uniform4iARB {
+   struct marshal_cmd_base header;
+   GLint location;
+   GLint v0;
+   GLint v1;
+   GLint v2;
+   GLint v3;
+};
+
+static void
+unmarshal_Uniform4iARB(GLcontext *ctx, const struct marshal_cmd_Uniform4iARB *cmd)
+{
+   CALL_Uniform4iARB(ctx->CurrentDispatch, (cmd->location, cmd->v0, cmd->v1, cmd->v2, cmd->v3));
+}
+
+static void GLAPIENTRY
+marshal_Uniform4iARB(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_Uniform4iARB *cmd;
+   cmd = (struct marshal_cmd_Uniform4iARB *)
+      marshal_alloc(ctx, DISPATCH_CMD_Uniform4iARB, sizeof(*cmd));
+   cmd->location = location;
+   cmd->v0 = v0;
+   cmd->v1 = v1;
+   cmd->v2 = v2;
+   cmd->v3 = v3;
+}
+
+static void GLAPIENTRY
+marshal_Uniform1fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Uniform1fvARB(ctx->CurrentDispatch, (location, count, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Uniform2fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Uniform2fvARB(ctx->CurrentDispatch, (location, count, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Uniform3fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Uniform3fvARB(ctx->CurrentDispatch, (location, count, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Uniform4fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Uniform4fvARB(ctx->CurrentDispatch, (location, count, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Uniform1ivARB(GLint location, GLsizei count, const GLint * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Uniform1ivARB(ctx->CurrentDispatch, (location, count, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Uniform2ivARB(GLint location, GLsizei count, const GLint * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Uniform2ivARB(ctx->CurrentDispatch, (location, count, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Uniform3ivARB(GLint location, GLsizei count, const GLint * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Uniform3ivARB(ctx->CurrentDispatch, (location, count, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_Uniform4ivARB(GLint location, GLsizei count, const GLint * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_Uniform4ivARB(ctx->CurrentDispatch, (location, count, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_UniformMatrix2fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_UniformMatrix2fvARB(ctx->CurrentDispatch, (location, count, transpose, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_UniformMatrix3fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_UniformMatrix3fvARB(ctx->CurrentDispatch, (location, count, transpose, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_UniformMatrix4fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_UniformMatrix4fvARB(ctx->CurrentDispatch, (location, count, transpose, value));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetObjectParameterfvARB(GLhandleARB obj, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetObjectParameterfvARB(ctx->CurrentDispatch, (obj, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetObjectParameterivARB(ctx->CurrentDispatch, (obj, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * infoLog)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetInfoLogARB(ctx->CurrentDispatch, (obj, maxLength, length, infoLog));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetAttachedObjectsARB(GLhandleARB containerObj, GLsizei maxLength, GLsizei * length, GLhandleARB * infoLog)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetAttachedObjectsARB(ctx->CurrentDispatch, (containerObj, maxLength, length, infoLog));
+   marshal_sync_end(ctx);
+}
+
+static GLint GLAPIENTRY
+marshal_GetUniformLocationARB(GLhandleARB programObj, const GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_GetUniformLocationARB(ctx->CurrentDispatch, (programObj, name));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_GetActiveUniformARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetActiveUniformARB(ctx->CurrentDispatch, (programObj, index, maxLength, length, size, type, name));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetUniformfvARB(GLhandleARB programObj, GLint location, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetUniformfvARB(ctx->CurrentDispatch, (programObj, location, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetUniformivARB(GLhandleARB programObj, GLint location, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetUniformivARB(ctx->CurrentDispatch, (programObj, location, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetShaderSourceARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * source)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetShaderSourceARB(ctx->CurrentDispatch, (obj, maxLength, length, source));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_BindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_BindAttribLocationARB(ctx->CurrentDispatch, (programObj, index, name));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetActiveAttribARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetActiveAttribARB(ctx->CurrentDispatch, (programObj, index, maxLength, length, size, type, name));
+   marshal_sync_end(ctx);
+}
+
+static GLint GLAPIENTRY
+marshal_GetAttribLocationARB(GLhandleARB programObj, const GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_GetAttribLocationARB(ctx->CurrentDispatch, (programObj, name));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+static void GLAPIENTRY
+marshal_GetVertexAttribdvNV(GLuint index, GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetVertexAttribdvNV(ctx->CurrentDispatch, (index, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetVertexAttribfvNV(GLuint index, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetVertexAttribfvNV(ctx->CurrentDispatch, (index, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GetVertexAttribivNV(GLuint index, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetVertexAttribivNV(ctx->CurrentDispatch, (index, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_VertexAttrib1dNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble x;
+};
+
+static void
+unmarshal_VertexAttrib1dNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1dNV *cmd)
+{
+   CALL_VertexAttrib1dNV(ctx->CurrentDispatch, (cmd->index, cmd->x));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1dNV(GLuint index, GLdouble x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1dNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1dNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1dNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+}
+
+struct marshal_cmd_VertexAttrib1dvNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble v[1];
+};
+
+static void
+unmarshal_VertexAttrib1dvNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1dvNV *cmd)
+{
+   CALL_VertexAttrib1dvNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1dvNV(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1dvNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1dvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1dvNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib1fNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat x;
+};
+
+static void
+unmarshal_VertexAttrib1fNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1fNV *cmd)
+{
+   CALL_VertexAttrib1fNV(ctx->CurrentDispatch, (cmd->index, cmd->x));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1fNV(GLuint index, GLfloat x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1fNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1fNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1fNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+}
+
+struct marshal_cmd_VertexAttrib1fvNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat v[1];
+};
+
+static void
+unmarshal_VertexAttrib1fvNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1fvNV *cmd)
+{
+   CALL_VertexAttrib1fvNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1fvNV(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1fvNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1fvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1fvNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib1sNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort x;
+};
+
+static void
+unmarshal_VertexAttrib1sNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1sNV *cmd)
+{
+   CALL_VertexAttrib1sNV(ctx->CurrentDispatch, (cmd->index, cmd->x));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1sNV(GLuint index, GLshort x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1sNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1sNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1sNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+}
+
+struct marshal_cmd_VertexAttrib1svNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort v[1];
+};
+
+static void
+unmarshal_VertexAttrib1svNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib1svNV *cmd)
+{
+   CALL_VertexAttrib1svNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib1svNV(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib1svNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib1svNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib1svNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib2dNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+};
+
+static void
+unmarshal_VertexAttrib2dNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2dNV *cmd)
+{
+   CALL_VertexAttrib2dNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2dNV(GLuint index, GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2dNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2dNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2dNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_VertexAttrib2dvNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble v[2];
+};
+
+static void
+unmarshal_VertexAttrib2dvNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2dvNV *cmd)
+{
+   CALL_VertexAttrib2dvNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2dvNV(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2dvNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2dvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2dvNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib2fNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+};
+
+static void
+unmarshal_VertexAttrib2fNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2fNV *cmd)
+{
+   CALL_VertexAttrib2fNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2fNV(GLuint index, GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2fNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2fNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2fNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_VertexAttrib2fvNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat v[2];
+};
+
+static void
+unmarshal_VertexAttrib2fvNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2fvNV *cmd)
+{
+   CALL_VertexAttrib2fvNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2fvNV(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2fvNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2fvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2fvNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib2sNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort x;
+   GLshort y;
+};
+
+static void
+unmarshal_VertexAttrib2sNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2sNV *cmd)
+{
+   CALL_VertexAttrib2sNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2sNV(GLuint index, GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2sNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2sNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2sNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+}
+
+struct marshal_cmd_VertexAttrib2svNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort v[2];
+};
+
+static void
+unmarshal_VertexAttrib2svNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib2svNV *cmd)
+{
+   CALL_VertexAttrib2svNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib2svNV(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib2svNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib2svNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib2svNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib3dNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+};
+
+static void
+unmarshal_VertexAttrib3dNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3dNV *cmd)
+{
+   CALL_VertexAttrib3dNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3dNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3dNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3dNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_VertexAttrib3dvNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble v[3];
+};
+
+static void
+unmarshal_VertexAttrib3dvNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3dvNV *cmd)
+{
+   CALL_VertexAttrib3dvNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3dvNV(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3dvNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3dvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3dvNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib3fNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+};
+
+static void
+unmarshal_VertexAttrib3fNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3fNV *cmd)
+{
+   CALL_VertexAttrib3fNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3fNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3fNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3fNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_VertexAttrib3fvNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat v[3];
+};
+
+static void
+unmarshal_VertexAttrib3fvNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3fvNV *cmd)
+{
+   CALL_VertexAttrib3fvNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3fvNV(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3fvNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3fvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3fvNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib3sNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+};
+
+static void
+unmarshal_VertexAttrib3sNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3sNV *cmd)
+{
+   CALL_VertexAttrib3sNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3sNV(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3sNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3sNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3sNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+}
+
+struct marshal_cmd_VertexAttrib3svNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort v[3];
+};
+
+static void
+unmarshal_VertexAttrib3svNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib3svNV *cmd)
+{
+   CALL_VertexAttrib3svNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib3svNV(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib3svNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib3svNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib3svNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4dNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble x;
+   GLdouble y;
+   GLdouble z;
+   GLdouble w;
+};
+
+static void
+unmarshal_VertexAttrib4dNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4dNV *cmd)
+{
+   CALL_VertexAttrib4dNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4dNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4dNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4dNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_VertexAttrib4dvNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLdouble v[4];
+};
+
+static void
+unmarshal_VertexAttrib4dvNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4dvNV *cmd)
+{
+   CALL_VertexAttrib4dvNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4dvNV(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4dvNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4dvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4dvNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4fNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat x;
+   GLfloat y;
+   GLfloat z;
+   GLfloat w;
+};
+
+static void
+unmarshal_VertexAttrib4fNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4fNV *cmd)
+{
+   CALL_VertexAttrib4fNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4fNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4fNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4fNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_VertexAttrib4fvNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLfloat v[4];
+};
+
+static void
+unmarshal_VertexAttrib4fvNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4fvNV *cmd)
+{
+   CALL_VertexAttrib4fvNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4fvNV(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4fvNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4fvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4fvNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4sNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort x;
+   GLshort y;
+   GLshort z;
+   GLshort w;
+};
+
+static void
+unmarshal_VertexAttrib4sNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4sNV *cmd)
+{
+   CALL_VertexAttrib4sNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4sNV(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4sNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4sNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4sNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_VertexAttrib4svNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLshort v[4];
+};
+
+static void
+unmarshal_VertexAttrib4svNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4svNV *cmd)
+{
+   CALL_VertexAttrib4svNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4svNV(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4svNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4svNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4svNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+struct marshal_cmd_VertexAttrib4ubNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLubyte x;
+   GLubyte y;
+   GLubyte z;
+   GLubyte w;
+};
+
+static void
+unmarshal_VertexAttrib4ubNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4ubNV *cmd)
+{
+   CALL_VertexAttrib4ubNV(ctx->CurrentDispatch, (cmd->index, cmd->x, cmd->y, cmd->z, cmd->w));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4ubNV(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4ubNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4ubNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4ubNV, sizeof(*cmd));
+   cmd->index = index;
+   cmd->x = x;
+   cmd->y = y;
+   cmd->z = z;
+   cmd->w = w;
+}
+
+struct marshal_cmd_VertexAttrib4ubvNV {
+   struct marshal_cmd_base header;
+   GLuint index;
+   GLubyte v[4];
+};
+
+static void
+unmarshal_VertexAttrib4ubvNV(GLcontext *ctx, const struct marshal_cmd_VertexAttrib4ubvNV *cmd)
+{
+   CALL_VertexAttrib4ubvNV(ctx->CurrentDispatch, (cmd->index, cmd->v));
+}
+
+static void GLAPIENTRY
+marshal_VertexAttrib4ubvNV(GLuint index, const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_VertexAttrib4ubvNV *cmd;
+   cmd = (struct marshal_cmd_VertexAttrib4ubvNV *)
+      marshal_alloc(ctx, DISPATCH_CMD_VertexAttrib4ubvNV, sizeof(*cmd));
+   cmd->index = index;
+   MEMCPY(cmd->v, v, sizeof(cmd->v));
+}
+
+static GLuint GLAPIENTRY
+marshal_GenFragmentShadersATI(GLuint range)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLuint ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_GenFragmentShadersATI(ctx->CurrentDispatch, (range));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_BindFragmentShaderATI {
+   struct marshal_cmd_base header;
+   GLuint id;
+};
+
+static void
+unmarshal_BindFragmentShaderATI(GLcontext *ctx, const struct marshal_cmd_BindFragmentShaderATI *cmd)
+{
+   CALL_BindFragmentShaderATI(ctx->CurrentDispatch, (cmd->id));
+}
+
+static void GLAPIENTRY
+marshal_BindFragmentShaderATI(GLuint id)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BindFragmentShaderATI *cmd;
+   cmd = (struct marshal_cmd_BindFragmentShaderATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_BindFragmentShaderATI, sizeof(*cmd));
+   cmd->id = id;
+}
+
+struct marshal_cmd_DeleteFragmentShaderATI {
+   struct marshal_cmd_base header;
+   GLuint id;
+};
+
+static void
+unmarshal_DeleteFragmentShaderATI(GLcontext *ctx, const struct marshal_cmd_DeleteFragmentShaderATI *cmd)
+{
+   CALL_DeleteFragmentShaderATI(ctx->CurrentDispatch, (cmd->id));
+}
+
+static void GLAPIENTRY
+marshal_DeleteFragmentShaderATI(GLuint id)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_DeleteFragmentShaderATI *cmd;
+   cmd = (struct marshal_cmd_DeleteFragmentShaderATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_DeleteFragmentShaderATI, sizeof(*cmd));
+   cmd->id = id;
+}
+
+struct marshal_cmd_BeginFragmentShaderATI {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_BeginFragmentShaderATI(GLcontext *ctx, const struct marshal_cmd_BeginFragmentShaderATI *cmd)
+{
+   CALL_BeginFragmentShaderATI(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_BeginFragmentShaderATI(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BeginFragmentShaderATI *cmd;
+   cmd = (struct marshal_cmd_BeginFragmentShaderATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_BeginFragmentShaderATI, sizeof(*cmd));
+}
+
+struct marshal_cmd_EndFragmentShaderATI {
+   struct marshal_cmd_base header;
+};
+
+static void
+unmarshal_EndFragmentShaderATI(GLcontext *ctx, const struct marshal_cmd_EndFragmentShaderATI *cmd)
+{
+   CALL_EndFragmentShaderATI(ctx->CurrentDispatch, ());
+}
+
+static void GLAPIENTRY
+marshal_EndFragmentShaderATI(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_EndFragmentShaderATI *cmd;
+   cmd = (struct marshal_cmd_EndFragmentShaderATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_EndFragmentShaderATI, sizeof(*cmd));
+}
+
+struct marshal_cmd_PassTexCoordATI {
+   struct marshal_cmd_base header;
+   GLuint dst;
+   GLuint coord;
+   GLenum swizzle;
+};
+
+static void
+unmarshal_PassTexCoordATI(GLcontext *ctx, const struct marshal_cmd_PassTexCoordATI *cmd)
+{
+   CALL_PassTexCoordATI(ctx->CurrentDispatch, (cmd->dst, cmd->coord, cmd->swizzle));
+}
+
+static void GLAPIENTRY
+marshal_PassTexCoordATI(GLuint dst, GLuint coord, GLenum swizzle)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_PassTexCoordATI *cmd;
+   cmd = (struct marshal_cmd_PassTexCoordATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_PassTexCoordATI, sizeof(*cmd));
+   cmd->dst = dst;
+   cmd->coord = coord;
+   cmd->swizzle = swizzle;
+}
+
+struct marshal_cmd_SampleMapATI {
+   struct marshal_cmd_base header;
+   GLuint dst;
+   GLuint interp;
+   GLenum swizzle;
+};
+
+static void
+unmarshal_SampleMapATI(GLcontext *ctx, const struct marshal_cmd_SampleMapATI *cmd)
+{
+   CALL_SampleMapATI(ctx->CurrentDispatch, (cmd->dst, cmd->interp, cmd->swizzle));
+}
+
+static void GLAPIENTRY
+marshal_SampleMapATI(GLuint dst, GLuint interp, GLenum swizzle)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_SampleMapATI *cmd;
+   cmd = (struct marshal_cmd_SampleMapATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_SampleMapATI, sizeof(*cmd));
+   cmd->dst = dst;
+   cmd->interp = interp;
+   cmd->swizzle = swizzle;
+}
+
+struct marshal_cmd_ColorFragmentOp1ATI {
+   struct marshal_cmd_base header;
+   GLenum op;
+   GLuint dst;
+   GLuint dstMask;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+};
+
+static void
+unmarshal_ColorFragmentOp1ATI(GLcontext *ctx, const struct marshal_cmd_ColorFragmentOp1ATI *cmd)
+{
+   CALL_ColorFragmentOp1ATI(ctx->CurrentDispatch, (cmd->op, cmd->dst, cmd->dstMask, cmd->dstMod, cmd->arg1, cmd->arg1Rep, cmd->arg1Mod));
+}
+
+static void GLAPIENTRY
+marshal_ColorFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ColorFragmentOp1ATI *cmd;
+   cmd = (struct marshal_cmd_ColorFragmentOp1ATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_ColorFragmentOp1ATI, sizeof(*cmd));
+   cmd->op = op;
+   cmd->dst = dst;
+   cmd->dstMask = dstMask;
+   cmd->dstMod = dstMod;
+   cmd->arg1 = arg1;
+   cmd->arg1Rep = arg1Rep;
+   cmd->arg1Mod = arg1Mod;
+}
+
+struct marshal_cmd_ColorFragmentOp2ATI {
+   struct marshal_cmd_base header;
+   GLenum op;
+   GLuint dst;
+   GLuint dstMask;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   GLuint arg2;
+   GLuint arg2Rep;
+   GLuint arg2Mod;
+};
+
+static void
+unmarshal_ColorFragmentOp2ATI(GLcontext *ctx, const struct marshal_cmd_ColorFragmentOp2ATI *cmd)
+{
+   CALL_ColorFragmentOp2ATI(ctx->CurrentDispatch, (cmd->op, cmd->dst, cmd->dstMask, cmd->dstMod, cmd->arg1, cmd->arg1Rep, cmd->arg1Mod, cmd->arg2, cmd->arg2Rep, cmd->arg2Mod));
+}
+
+static void GLAPIENTRY
+marshal_ColorFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ColorFragmentOp2ATI *cmd;
+   cmd = (struct marshal_cmd_ColorFragmentOp2ATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_ColorFragmentOp2ATI, sizeof(*cmd));
+   cmd->op = op;
+   cmd->dst = dst;
+   cmd->dstMask = dstMask;
+   cmd->dstMod = dstMod;
+   cmd->arg1 = arg1;
+   cmd->arg1Rep = arg1Rep;
+   cmd->arg1Mod = arg1Mod;
+   cmd->arg2 = arg2;
+   cmd->arg2Rep = arg2Rep;
+   cmd->arg2Mod = arg2Mod;
+}
+
+struct marshal_cmd_ColorFragmentOp3ATI {
+   struct marshal_cmd_base header;
+   GLenum op;
+   GLuint dst;
+   GLuint dstMask;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   GLuint arg2;
+   GLuint arg2Rep;
+   GLuint arg2Mod;
+   GLuint arg3;
+   GLuint arg3Rep;
+   GLuint arg3Mod;
+};
+
+static void
+unmarshal_ColorFragmentOp3ATI(GLcontext *ctx, const struct marshal_cmd_ColorFragmentOp3ATI *cmd)
+{
+   CALL_ColorFragmentOp3ATI(ctx->CurrentDispatch, (cmd->op, cmd->dst, cmd->dstMask, cmd->dstMod, cmd->arg1, cmd->arg1Rep, cmd->arg1Mod, cmd->arg2, cmd->arg2Rep, cmd->arg2Mod, cmd->arg3, cmd->arg3Rep, cmd->arg3Mod));
+}
+
+static void GLAPIENTRY
+marshal_ColorFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_ColorFragmentOp3ATI *cmd;
+   cmd = (struct marshal_cmd_ColorFragmentOp3ATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_ColorFragmentOp3ATI, sizeof(*cmd));
+   cmd->op = op;
+   cmd->dst = dst;
+   cmd->dstMask = dstMask;
+   cmd->dstMod = dstMod;
+   cmd->arg1 = arg1;
+   cmd->arg1Rep = arg1Rep;
+   cmd->arg1Mod = arg1Mod;
+   cmd->arg2 = arg2;
+   cmd->arg2Rep = arg2Rep;
+   cmd->arg2Mod = arg2Mod;
+   cmd->arg3 = arg3;
+   cmd->arg3Rep = arg3Rep;
+   cmd->arg3Mod = arg3Mod;
+}
+
+struct marshal_cmd_AlphaFragmentOp1ATI {
+   struct marshal_cmd_base header;
+   GLenum op;
+   GLuint dst;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+};
+
+static void
+unmarshal_AlphaFragmentOp1ATI(GLcontext *ctx, const struct marshal_cmd_AlphaFragmentOp1ATI *cmd)
+{
+   CALL_AlphaFragmentOp1ATI(ctx->CurrentDispatch, (cmd->op, cmd->dst, cmd->dstMod, cmd->arg1, cmd->arg1Rep, cmd->arg1Mod));
+}
+
+static void GLAPIENTRY
+marshal_AlphaFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_AlphaFragmentOp1ATI *cmd;
+   cmd = (struct marshal_cmd_AlphaFragmentOp1ATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_AlphaFragmentOp1ATI, sizeof(*cmd));
+   cmd->op = op;
+   cmd->dst = dst;
+   cmd->dstMod = dstMod;
+   cmd->arg1 = arg1;
+   cmd->arg1Rep = arg1Rep;
+   cmd->arg1Mod = arg1Mod;
+}
+
+struct marshal_cmd_AlphaFragmentOp2ATI {
+   struct marshal_cmd_base header;
+   GLenum op;
+   GLuint dst;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   GLuint arg2;
+   GLuint arg2Rep;
+   GLuint arg2Mod;
+};
+
+static void
+unmarshal_AlphaFragmentOp2ATI(GLcontext *ctx, const struct marshal_cmd_AlphaFragmentOp2ATI *cmd)
+{
+   CALL_AlphaFragmentOp2ATI(ctx->CurrentDispatch, (cmd->op, cmd->dst, cmd->dstMod, cmd->arg1, cmd->arg1Rep, cmd->arg1Mod, cmd->arg2, cmd->arg2Rep, cmd->arg2Mod));
+}
+
+static void GLAPIENTRY
+marshal_AlphaFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_AlphaFragmentOp2ATI *cmd;
+   cmd = (struct marshal_cmd_AlphaFragmentOp2ATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_AlphaFragmentOp2ATI, sizeof(*cmd));
+   cmd->op = op;
+   cmd->dst = dst;
+   cmd->dstMod = dstMod;
+   cmd->arg1 = arg1;
+   cmd->arg1Rep = arg1Rep;
+   cmd->arg1Mod = arg1Mod;
+   cmd->arg2 = arg2;
+   cmd->arg2Rep = arg2Rep;
+   cmd->arg2Mod = arg2Mod;
+}
+
+struct marshal_cmd_AlphaFragmentOp3ATI {
+   struct marshal_cmd_base header;
+   GLenum op;
+   GLuint dst;
+   GLuint dstMod;
+   GLuint arg1;
+   GLuint arg1Rep;
+   GLuint arg1Mod;
+   GLuint arg2;
+   GLuint arg2Rep;
+   GLuint arg2Mod;
+   GLuint arg3;
+   GLuint arg3Rep;
+   GLuint arg3Mod;
+};
+
+static void
+unmarshal_AlphaFragmentOp3ATI(GLcontext *ctx, const struct marshal_cmd_AlphaFragmentOp3ATI *cmd)
+{
+   CALL_AlphaFragmentOp3ATI(ctx->CurrentDispatch, (cmd->op, cmd->dst, cmd->dstMod, cmd->arg1, cmd->arg1Rep, cmd->arg1Mod, cmd->arg2, cmd->arg2Rep, cmd->arg2Mod, cmd->arg3, cmd->arg3Rep, cmd->arg3Mod));
+}
+
+static void GLAPIENTRY
+marshal_AlphaFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_AlphaFragmentOp3ATI *cmd;
+   cmd = (struct marshal_cmd_AlphaFragmentOp3ATI *)
+      marshal_alloc(ctx, DISPATCH_CMD_AlphaFragmentOp3ATI, sizeof(*cmd));
+   cmd->op = op;
+   cmd->dst = dst;
+   cmd->dstMod = dstMod;
+   cmd->arg1 = arg1;
+   cmd->arg1Rep = arg1Rep;
+   cmd->arg1Mod = arg1Mod;
+   cmd->arg2 = arg2;
+   cmd->arg2Rep = arg2Rep;
+   cmd->arg2Mod = arg2Mod;
+   cmd->arg3 = arg3;
+   cmd->arg3Rep = arg3Rep;
+   cmd->arg3Mod = arg3Mod;
+}
+
+static void GLAPIENTRY
+marshal_SetFragmentShaderConstantATI(GLuint dst, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_SetFragmentShaderConstantATI(ctx->CurrentDispatch, (dst, value));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsRenderbufferEXT(GLuint renderbuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsRenderbufferEXT(ctx->CurrentDispatch, (renderbuffer));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_BindRenderbufferEXT {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint renderbuffer;
+};
+
+static void
+unmarshal_BindRenderbufferEXT(GLcontext *ctx, const struct marshal_cmd_BindRenderbufferEXT *cmd)
+{
+   CALL_BindRenderbufferEXT(ctx->CurrentDispatch, (cmd->target, cmd->renderbuffer));
+}
+
+static void GLAPIENTRY
+marshal_BindRenderbufferEXT(GLenum target, GLuint renderbuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BindRenderbufferEXT *cmd;
+   cmd = (struct marshal_cmd_BindRenderbufferEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_BindRenderbufferEXT, sizeof(*cmd));
+   cmd->target = target;
+   cmd->renderbuffer = renderbuffer;
+}
+
+static void GLAPIENTRY
+marshal_DeleteRenderbuffersEXT(GLsizei n, const GLuint * renderbuffers)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DeleteRenderbuffersEXT(ctx->CurrentDispatch, (n, renderbuffers));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GenRenderbuffersEXT(GLsizei n, GLuint * renderbuffers)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GenRenderbuffersEXT(ctx->CurrentDispatch, (n, renderbuffers));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_RenderbufferStorageEXT {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum internalformat;
+   GLsizei width;
+   GLsizei height;
+};
+
+static void
+unmarshal_RenderbufferStorageEXT(GLcontext *ctx, const struct marshal_cmd_RenderbufferStorageEXT *cmd)
+{
+   CALL_RenderbufferStorageEXT(ctx->CurrentDispatch, (cmd->target, cmd->internalformat, cmd->width, cmd->height));
+}
+
+static void GLAPIENTRY
+marshal_RenderbufferStorageEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_RenderbufferStorageEXT *cmd;
+   cmd = (struct marshal_cmd_RenderbufferStorageEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_RenderbufferStorageEXT, sizeof(*cmd));
+   cmd->target = target;
+   cmd->internalformat = internalformat;
+   cmd->width = width;
+   cmd->height = height;
+}
+
+static void GLAPIENTRY
+marshal_GetRenderbufferParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetRenderbufferParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+   marshal_sync_end(ctx);
+}
+
+static GLboolean GLAPIENTRY
+marshal_IsFramebufferEXT(GLuint framebuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_IsFramebufferEXT(ctx->CurrentDispatch, (framebuffer));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_BindFramebufferEXT {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLuint framebuffer;
+};
+
+static void
+unmarshal_BindFramebufferEXT(GLcontext *ctx, const struct marshal_cmd_BindFramebufferEXT *cmd)
+{
+   CALL_BindFramebufferEXT(ctx->CurrentDispatch, (cmd->target, cmd->framebuffer));
+}
+
+static void GLAPIENTRY
+marshal_BindFramebufferEXT(GLenum target, GLuint framebuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_BindFramebufferEXT *cmd;
+   cmd = (struct marshal_cmd_BindFramebufferEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_BindFramebufferEXT, sizeof(*cmd));
+   cmd->target = target;
+   cmd->framebuffer = framebuffer;
+}
+
+static void GLAPIENTRY
+marshal_DeleteFramebuffersEXT(GLsizei n, const GLuint * framebuffers)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_DeleteFramebuffersEXT(ctx->CurrentDispatch, (n, framebuffers));
+   marshal_sync_end(ctx);
+}
+
+static void GLAPIENTRY
+marshal_GenFramebuffersEXT(GLsizei n, GLuint * framebuffers)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GenFramebuffersEXT(ctx->CurrentDispatch, (n, framebuffers));
+   marshal_sync_end(ctx);
+}
+
+static GLenum GLAPIENTRY
+marshal_CheckFramebufferStatusEXT(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLenum ret;
+   marshal_sync_begin(ctx);
+   ret = CALL_CheckFramebufferStatusEXT(ctx->CurrentDispatch, (target));
+   marshal_sync_end(ctx);
+   return ret;
+}
+
+struct marshal_cmd_FramebufferTexture1DEXT {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum attachment;
+   GLenum textarget;
+   GLuint texture;
+   GLint level;
+};
+
+static void
+unmarshal_FramebufferTexture1DEXT(GLcontext *ctx, const struct marshal_cmd_FramebufferTexture1DEXT *cmd)
+{
+   CALL_FramebufferTexture1DEXT(ctx->CurrentDispatch, (cmd->target, cmd->attachment, cmd->textarget, cmd->texture, cmd->level));
+}
+
+static void GLAPIENTRY
+marshal_FramebufferTexture1DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FramebufferTexture1DEXT *cmd;
+   cmd = (struct marshal_cmd_FramebufferTexture1DEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_FramebufferTexture1DEXT, sizeof(*cmd));
+   cmd->target = target;
+   cmd->attachment = attachment;
+   cmd->textarget = textarget;
+   cmd->texture = texture;
+   cmd->level = level;
+}
+
+struct marshal_cmd_FramebufferTexture2DEXT {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum attachment;
+   GLenum textarget;
+   GLuint texture;
+   GLint level;
+};
+
+static void
+unmarshal_FramebufferTexture2DEXT(GLcontext *ctx, const struct marshal_cmd_FramebufferTexture2DEXT *cmd)
+{
+   CALL_FramebufferTexture2DEXT(ctx->CurrentDispatch, (cmd->target, cmd->attachment, cmd->textarget, cmd->texture, cmd->level));
+}
+
+static void GLAPIENTRY
+marshal_FramebufferTexture2DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FramebufferTexture2DEXT *cmd;
+   cmd = (struct marshal_cmd_FramebufferTexture2DEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_FramebufferTexture2DEXT, sizeof(*cmd));
+   cmd->target = target;
+   cmd->attachment = attachment;
+   cmd->textarget = textarget;
+   cmd->texture = texture;
+   cmd->level = level;
+}
+
+struct marshal_cmd_FramebufferTexture3DEXT {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum attachment;
+   GLenum textarget;
+   GLuint texture;
+   GLint level;
+   GLint zoffset;
+};
+
+static void
+unmarshal_FramebufferTexture3DEXT(GLcontext *ctx, const struct marshal_cmd_FramebufferTexture3DEXT *cmd)
+{
+   CALL_FramebufferTexture3DEXT(ctx->CurrentDispatch, (cmd->target, cmd->attachment, cmd->textarget, cmd->texture, cmd->level, cmd->zoffset));
+}
+
+static void GLAPIENTRY
+marshal_FramebufferTexture3DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FramebufferTexture3DEXT *cmd;
+   cmd = (struct marshal_cmd_FramebufferTexture3DEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_FramebufferTexture3DEXT, sizeof(*cmd));
+   cmd->target = target;
+   cmd->attachment = attachment;
+   cmd->textarget = textarget;
+   cmd->texture = texture;
+   cmd->level = level;
+   cmd->zoffset = zoffset;
+}
+
+struct marshal_cmd_FramebufferRenderbufferEXT {
+   struct marshal_cmd_base header;
+   GLenum target;
+   GLenum attachment;
+   GLenum renderbuffertarget;
+   GLuint renderbuffer;
+};
+
+static void
+unmarshal_FramebufferRenderbufferEXT(GLcontext *ctx, const struct marshal_cmd_FramebufferRenderbufferEXT *cmd)
+{
+   CALL_FramebufferRenderbufferEXT(ctx->CurrentDispatch, (cmd->target, cmd->attachment, cmd->renderbuffertarget, cmd->renderbuffer));
+}
+
+static void GLAPIENTRY
+marshal_FramebufferRenderbufferEXT(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_FramebufferRenderbufferEXT *cmd;
+   cmd = (struct marshal_cmd_FramebufferRenderbufferEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_FramebufferRenderbufferEXT, sizeof(*cmd));
+   cmd->target = target;
+   cmd->attachment = attachment;
+   cmd->renderbuffertarget = renderbuffertarget;
+   cmd->renderbuffer = renderbuffer;
+}
+
+static void GLAPIENTRY
+marshal_GetFramebufferAttachmentParameterivEXT(GLenum target, GLenum attachment, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   marshal_sync_begin(ctx);
+   CALL_GetFramebufferAttachmentParameterivEXT(ctx->CurrentDispatch, (target, attachment, pname, params));
+   marshal_sync_end(ctx);
+}
+
+struct marshal_cmd_GenerateMipmapEXT {
+   struct marshal_cmd_base header;
+   GLenum target;
+};
+
+static void
+unmarshal_GenerateMipmapEXT(GLcontext *ctx, const struct marshal_cmd_GenerateMipmapEXT *cmd)
+{
+   CALL_GenerateMipmapEXT(ctx->CurrentDispatch, (cmd->target));
+}
+
+static void GLAPIENTRY
+marshal_GenerateMipmapEXT(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_GenerateMipmapEXT *cmd;
+   cmd = (struct marshal_cmd_GenerateMipmapEXT *)
+      marshal_alloc(ctx, DISPATCH_CMD_GenerateMipmapEXT, sizeof(*cmd));
+   cmd->target = target;
+}
+
+struct marshal_cmd_StencilFuncSeparate {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum func;
+   GLint ref;
+   GLuint mask;
+};
+
+static void
+unmarshal_StencilFuncSeparate(GLcontext *ctx, const struct marshal_cmd_StencilFuncSeparate *cmd)
+{
+   CALL_StencilFuncSeparate(ctx->CurrentDispatch, (cmd->face, cmd->func, cmd->ref, cmd->mask));
+}
+
+static void GLAPIENTRY
+marshal_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_StencilFuncSeparate *cmd;
+   cmd = (struct marshal_cmd_StencilFuncSeparate *)
+      marshal_alloc(ctx, DISPATCH_CMD_StencilFuncSeparate, sizeof(*cmd));
+   cmd->face = face;
+   cmd->func = func;
+   cmd->ref = ref;
+   cmd->mask = mask;
+}
+
+struct marshal_cmd_StencilOpSeparate {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLenum fail;
+   GLenum zfail;
+   GLenum zpass;
+};
+
+static void
+unmarshal_StencilOpSeparate(GLcontext *ctx, const struct marshal_cmd_StencilOpSeparate *cmd)
+{
+   CALL_StencilOpSeparate(ctx->CurrentDispatch, (cmd->face, cmd->fail, cmd->zfail, cmd->zpass));
+}
+
+static void GLAPIENTRY
+marshal_StencilOpSeparate(GLenum face, GLenum fail, GLenum zfail, GLenum zpass)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_StencilOpSeparate *cmd;
+   cmd = (struct marshal_cmd_StencilOpSeparate *)
+      marshal_alloc(ctx, DISPATCH_CMD_StencilOpSeparate, sizeof(*cmd));
+   cmd->face = face;
+   cmd->fail = fail;
+   cmd->zfail = zfail;
+   cmd->zpass = zpass;
+}
+
+struct marshal_cmd_StencilMaskSeparate {
+   struct marshal_cmd_base header;
+   GLenum face;
+   GLuint mask;
+};
+
+static void
+unmarshal_StencilMaskSeparate(GLcontext *ctx, const struct marshal_cmd_StencilMaskSeparate *cmd)
+{
+   CALL_StencilMaskSeparate(ctx->CurrentDispatch, (cmd->face, cmd->mask));
+}
+
+static void GLAPIENTRY
+marshal_StencilMaskSeparate(GLenum face, GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   struct marshal_cmd_StencilMaskSeparate *cmd;
+   cmd = (struct marshal_cmd_StencilMaskSeparate *)
+      marshal_alloc(ctx, DISPATCH_CMD_StencilMaskSeparate, sizeof(*cmd));
+   cmd->face = face;
+   cmd->mask = mask;
+}
+
+
+typedef void (*unmarshal_func)(GLcontext *ctx, const void *cmd);
+
+static const unmarshal_func unmarshal_dispatch[NUM_DISPATCH_CMD] = {
+   (unmarshal_func) unmarshal_NewList,
+   (unmarshal_func) unmarshal_EndList,
+   (unmarshal_func) unmarshal_CallList,
+   (unmarshal_func) unmarshal_DeleteLists,
+   (unmarshal_func) unmarshal_ListBase,
+   (unmarshal_func) unmarshal_Begin,
+   (unmarshal_func) unmarshal_Color3b,
+   (unmarshal_func) unmarshal_Color3bv,
+   (unmarshal_func) unmarshal_Color3d,
+   (unmarshal_func) unmarshal_Color3dv,
+   (unmarshal_func) unmarshal_Color3f,
+   (unmarshal_func) unmarshal_Color3fv,
+   (unmarshal_func) unmarshal_Color3i,
+   (unmarshal_func) unmarshal_Color3iv,
+   (unmarshal_func) unmarshal_Color3s,
+   (unmarshal_func) unmarshal_Color3sv,
+   (unmarshal_func) unmarshal_Color3ub,
+   (unmarshal_func) unmarshal_Color3ubv,
+   (unmarshal_func) unmarshal_Color3ui,
+   (unmarshal_func) unmarshal_Color3uiv,
+   (unmarshal_func) unmarshal_Color3us,
+   (unmarshal_func) unmarshal_Color3usv,
+   (unmarshal_func) unmarshal_Color4b,
+   (unmarshal_func) unmarshal_Color4bv,
+   (unmarshal_func) unmarshal_Color4d,
+   (unmarshal_func) unmarshal_Color4dv,
+   (unmarshal_func) unmarshal_Color4f,
+   (unmarshal_func) unmarshal_Color4fv,
+   (unmarshal_func) unmarshal_Color4i,
+   (unmarshal_func) unmarshal_Color4iv,
+   (unmarshal_func) unmarshal_Color4s,
+   (unmarshal_func) unmarshal_Color4sv,
+   (unmarshal_func) unmarshal_Color4ub,
+   (unmarshal_func) unmarshal_Color4ubv,
+   (unmarshal_func) unmarshal_Color4ui,
+   (unmarshal_func) unmarshal_Color4uiv,
+   (unmarshal_func) unmarshal_Color4us,
+   (unmarshal_func) unmarshal_Color4usv,
+   (unmarshal_func) unmarshal_EdgeFlag,
+   (unmarshal_func) unmarshal_EdgeFlagv,
+   (unmarshal_func) unmarshal_End,
+   (unmarshal_func) unmarshal_Indexd,
+   (unmarshal_func) unmarshal_Indexdv,
+   (unmarshal_func) unmarshal_Indexf,
+   (unmarshal_func) unmarshal_Indexfv,
+   (unmarshal_func) unmarshal_Indexi,
+   (unmarshal_func) unmarshal_Indexiv,
+   (unmarshal_func) unmarshal_Indexs,
+   (unmarshal_func) unmarshal_Indexsv,
+   (unmarshal_func) unmarshal_Normal3b,
+   (unmarshal_func) unmarshal_Normal3bv,
+   (unmarshal_func) unmarshal_Normal3d,
+   (unmarshal_func) unmarshal_Normal3dv,
+   (unmarshal_func) unmarshal_Normal3f,
+   (unmarshal_func) unmarshal_Normal3fv,
+   (unmarshal_func) unmarshal_Normal3i,
+   (unmarshal_func) unmarshal_Normal3iv,
+   (unmarshal_func) unmarshal_Normal3s,
+   (unmarshal_func) unmarshal_Normal3sv,
+   (unmarshal_func) unmarshal_RasterPos2d,
+   (unmarshal_func) unmarshal_RasterPos2dv,
+   (unmarshal_func) unmarshal_RasterPos2f,
+   (unmarshal_func) unmarshal_RasterPos2fv,
+   (unmarshal_func) unmarshal_RasterPos2i,
+   (unmarshal_func) unmarshal_RasterPos2iv,
+   (unmarshal_func) unmarshal_RasterPos2s,
+   (unmarshal_func) unmarshal_RasterPos2sv,
+   (unmarshal_func) unmarshal_RasterPos3d,
+   (unmarshal_func) unmarshal_RasterPos3dv,
+   (unmarshal_func) unmarshal_RasterPos3f,
+   (unmarshal_func) unmarshal_RasterPos3fv,
+   (unmarshal_func) unmarshal_RasterPos3i,
+   (unmarshal_func) unmarshal_RasterPos3iv,
+   (unmarshal_func) unmarshal_RasterPos3s,
+   (unmarshal_func) unmarshal_RasterPos3sv,
+   (unmarshal_func) unmarshal_RasterPos4d,
+   (unmarshal_func) unmarshal_RasterPos4dv,
+   (unmarshal_func) unmarshal_RasterPos4f,
+   (unmarshal_func) unmarshal_RasterPos4fv,
+   (unmarshal_func) unmarshal_RasterPos4i,
+   (unmarshal_func) unmarshal_RasterPos4iv,
+   (unmarshal_func) unmarshal_RasterPos4s,
+   (unmarshal_func) unmarshal_RasterPos4sv,
+   (unmarshal_func) unmarshal_Rectd,
+   (unmarshal_func) unmarshal_Rectdv,
+   (unmarshal_func) unmarshal_Rectf,
+   (unmarshal_func) unmarshal_Rectfv,
+   (unmarshal_func) unmarshal_Recti,
+   (unmarshal_func) unmarshal_Rectiv,
+   (unmarshal_func) unmarshal_Rects,
+   (unmarshal_func) unmarshal_Rectsv,
+   (unmarshal_func) unmarshal_TexCoord1d,
+   (unmarshal_func) unmarshal_TexCoord1dv,
+   (unmarshal_func) unmarshal_TexCoord1f,
+   (unmarshal_func) unmarshal_TexCoord1fv,
+   (unmarshal_func) unmarshal_TexCoord1i,
+   (unmarshal_func) unmarshal_TexCoord1iv,
+   (unmarshal_func) unmarshal_TexCoord1s,
+   (unmarshal_func) unmarshal_TexCoord1sv,
+   (unmarshal_func) unmarshal_TexCoord2d,
+   (unmarshal_func) unmarshal_TexCoord2dv,
+   (unmarshal_func) unmarshal_TexCoord2f,
+   (unmarshal_func) unmarshal_TexCoord2fv,
+   (unmarshal_func) unmarshal_TexCoord2i,
+   (unmarshal_func) unmarshal_TexCoord2iv,
+   (unmarshal_func) unmarshal_TexCoord2s,
+   (unmarshal_func) unmarshal_TexCoord2sv,
+   (unmarshal_func) unmarshal_TexCoord3d,
+   (unmarshal_func) unmarshal_TexCoord3dv,
+   (unmarshal_func) unmarshal_TexCoord3f,
+   (unmarshal_func) unmarshal_TexCoord3fv,
+   (unmarshal_func) unmarshal_TexCoord3i,
+   (unmarshal_func) unmarshal_TexCoord3iv,
+   (unmarshal_func) unmarshal_TexCoord3s,
+   (unmarshal_func) unmarshal_TexCoord3sv,
+   (unmarshal_func) unmarshal_TexCoord4d,
+   (unmarshal_func) unmarshal_TexCoord4dv,
+   (unmarshal_func) unmarshal_TexCoord4f,
+   (unmarshal_func) unmarshal_TexCoord4fv,
+   (unmarshal_func) unmarshal_TexCoord4i,
+   (unmarshal_func) unmarshal_TexCoord4iv,
+   (unmarshal_func) unmarshal_TexCoord4s,
+   (unmarshal_func) unmarshal_TexCoord4sv,
+   (unmarshal_func) unmarshal_Vertex2d,
+   (unmarshal_func) unmarshal_Vertex2dv,
+   (unmarshal_func) unmarshal_Vertex2f,
+   (unmarshal_func) unmarshal_Vertex2fv,
+   (unmarshal_func) unmarshal_Vertex2i,
+   (unmarshal_func) unmarshal_Vertex2iv,
+   (unmarshal_func) unmarshal_Vertex2s,
+   (unmarshal_func) unmarshal_Vertex2sv,
+   (unmarshal_func) unmarshal_Vertex3d,
+   (unmarshal_func) unmarshal_Vertex3dv,
+   (unmarshal_func) unmarshal_Vertex3f,
+   (unmarshal_func) unmarshal_Vertex3fv,
+   (unmarshal_func) unmarshal_Vertex3i,
+   (unmarshal_func) unmarshal_Vertex3iv,
+   (unmarshal_func) unmarshal_Vertex3s,
+   (unmarshal_func) unmarshal_Vertex3sv,
+   (unmarshal_func) unmarshal_Vertex4d,
+   (unmarshal_func) unmarshal_Vertex4dv,
+   (unmarshal_func) unmarshal_Vertex4f,
+   (unmarshal_func) unmarshal_Vertex4fv,
+   (unmarshal_func) unmarshal_Vertex4i,
+   (unmarshal_func) unmarshal_Vertex4iv,
+   (unmarshal_func) unmarshal_Vertex4s,
+   (unmarshal_func) unmarshal_Vertex4sv,
+   (unmarshal_func) unmarshal_ColorMaterial,
+   (unmarshal_func) unmarshal_CullFace,
+   (unmarshal_func) unmarshal_Fogf,
+   (unmarshal_func) unmarshal_Fogfv,
+   (unmarshal_func) unmarshal_Fogi,
+   (unmarshal_func) unmarshal_Fogiv,
+   (unmarshal_func) unmarshal_FrontFace,
+   (unmarshal_func) unmarshal_Hint,
+   (unmarshal_func) unmarshal_Lightf,
+   (unmarshal_func) unmarshal_Lightfv,
+   (unmarshal_func) unmarshal_Lighti,
+   (unmarshal_func) unmarshal_Lightiv,
+   (unmarshal_func) unmarshal_LightModelf,
+   (unmarshal_func) unmarshal_LightModelfv,
+   (unmarshal_func) unmarshal_LightModeli,
+   (unmarshal_func) unmarshal_LightModeliv,
+   (unmarshal_func) unmarshal_LineStipple,
+   (unmarshal_func) unmarshal_LineWidth,
+   (unmarshal_func) unmarshal_Materialf,
+   (unmarshal_func) unmarshal_Materialfv,
+   (unmarshal_func) unmarshal_Materiali,
+   (unmarshal_func) unmarshal_Materialiv,
+   (unmarshal_func) unmarshal_PointSize,
+   (unmarshal_func) unmarshal_PolygonMode,
+   (unmarshal_func) unmarshal_Scissor,
+   (unmarshal_func) unmarshal_ShadeModel,
+   (unmarshal_func) unmarshal_TexParameterf,
+   (unmarshal_func) unmarshal_TexParameterfv,
+   (unmarshal_func) unmarshal_TexParameteri,
+   (unmarshal_func) unmarshal_TexParameteriv,
+   (unmarshal_func) unmarshal_TexEnvf,
+   (unmarshal_func) unmarshal_TexEnvfv,
+   (unmarshal_func) unmarshal_TexEnvi,
+   (unmarshal_func) unmarshal_TexEnviv,
+   (unmarshal_func) unmarshal_TexGend,
+   (unmarshal_func) unmarshal_TexGendv,
+   (unmarshal_func) unmarshal_TexGenf,
+   (unmarshal_func) unmarshal_TexGenfv,
+   (unmarshal_func) unmarshal_TexGeni,
+   (unmarshal_func) unmarshal_TexGeniv,
+   (unmarshal_func) unmarshal_InitNames,
+   (unmarshal_func) unmarshal_LoadName,
+   (unmarshal_func) unmarshal_PassThrough,
+   (unmarshal_func) unmarshal_PopName,
+   (unmarshal_func) unmarshal_PushName,
+   (unmarshal_func) unmarshal_DrawBuffer,
+   (unmarshal_func) unmarshal_Clear,
+   (unmarshal_func) unmarshal_ClearAccum,
+   (unmarshal_func) unmarshal_ClearIndex,
+   (unmarshal_func) unmarshal_ClearColor,
+   (unmarshal_func) unmarshal_ClearStencil,
+   (unmarshal_func) unmarshal_ClearDepth,
+   (unmarshal_func) unmarshal_StencilMask,
+   (unmarshal_func) unmarshal_ColorMask,
+   (unmarshal_func) unmarshal_DepthMask,
+   (unmarshal_func) unmarshal_IndexMask,
+   (unmarshal_func) unmarshal_Accum,
+   (unmarshal_func) unmarshal_Disable,
+   (unmarshal_func) unmarshal_Enable,
+   (unmarshal_func) unmarshal_Flush,
+   (unmarshal_func) unmarshal_PopAttrib,
+   (unmarshal_func) unmarshal_PushAttrib,
+   (unmarshal_func) unmarshal_MapGrid1d,
+   (unmarshal_func) unmarshal_MapGrid1f,
+   (unmarshal_func) unmarshal_MapGrid2d,
+   (unmarshal_func) unmarshal_MapGrid2f,
+   (unmarshal_func) unmarshal_EvalCoord1d,
+   (unmarshal_func) unmarshal_EvalCoord1dv,
+   (unmarshal_func) unmarshal_EvalCoord1f,
+   (unmarshal_func) unmarshal_EvalCoord1fv,
+   (unmarshal_func) unmarshal_EvalCoord2d,
+   (unmarshal_func) unmarshal_EvalCoord2dv,
+   (unmarshal_func) unmarshal_EvalCoord2f,
+   (unmarshal_func) unmarshal_EvalCoord2fv,
+   (unmarshal_func) unmarshal_EvalMesh1,
+   (unmarshal_func) unmarshal_EvalPoint1,
+   (unmarshal_func) unmarshal_EvalMesh2,
+   (unmarshal_func) unmarshal_EvalPoint2,
+   (unmarshal_func) unmarshal_AlphaFunc,
+   (unmarshal_func) unmarshal_BlendFunc,
+   (unmarshal_func) unmarshal_LogicOp,
+   (unmarshal_func) unmarshal_StencilFunc,
+   (unmarshal_func) unmarshal_StencilOp,
+   (unmarshal_func) unmarshal_DepthFunc,
+   (unmarshal_func) unmarshal_PixelZoom,
+   (unmarshal_func) unmarshal_PixelTransferf,
+   (unmarshal_func) unmarshal_PixelTransferi,
+   (unmarshal_func) unmarshal_PixelStoref,
+   (unmarshal_func) unmarshal_PixelStorei,
+   (unmarshal_func) unmarshal_ReadBuffer,
+   (unmarshal_func) unmarshal_CopyPixels,
+   (unmarshal_func) unmarshal_DepthRange,
+   (unmarshal_func) unmarshal_Frustum,
+   (unmarshal_func) unmarshal_LoadIdentity,
+   (unmarshal_func) unmarshal_LoadMatrixf,
+   (unmarshal_func) unmarshal_LoadMatrixd,
+   (unmarshal_func) unmarshal_MatrixMode,
+   (unmarshal_func) unmarshal_MultMatrixf,
+   (unmarshal_func) unmarshal_MultMatrixd,
+   (unmarshal_func) unmarshal_Ortho,
+   (unmarshal_func) unmarshal_PopMatrix,
+   (unmarshal_func) unmarshal_PushMatrix,
+   (unmarshal_func) unmarshal_Rotated,
+   (unmarshal_func) unmarshal_Rotatef,
+   (unmarshal_func) unmarshal_Scaled,
+   (unmarshal_func) unmarshal_Scalef,
+   (unmarshal_func) unmarshal_Translated,
+   (unmarshal_func) unmarshal_Translatef,
+   (unmarshal_func) unmarshal_Viewport,
+   (unmarshal_func) unmarshal_BindTexture,
+   (unmarshal_func) unmarshal_DisableClientState,
+   (unmarshal_func) unmarshal_EnableClientState,
+   (unmarshal_func) unmarshal_Indexub,
+   (unmarshal_func) unmarshal_Indexubv,
+   (unmarshal_func) unmarshal_PolygonOffset,
+   (unmarshal_func) unmarshal_CopyTexImage1D,
+   (unmarshal_func) unmarshal_CopyTexImage2D,
+   (unmarshal_func) unmarshal_CopyTexSubImage1D,
+   (unmarshal_func) unmarshal_CopyTexSubImage2D,
+   (unmarshal_func) unmarshal_PopClientAttrib,
+   (unmarshal_func) unmarshal_PushClientAttrib,
+   (unmarshal_func) unmarshal_BlendColor,
+   (unmarshal_func) unmarshal_BlendEquation,
+   (unmarshal_func) unmarshal_CopyColorTable,
+   (unmarshal_func) unmarshal_CopyColorSubTable,
+   (unmarshal_func) unmarshal_ConvolutionParameterf,
+   (unmarshal_func) unmarshal_ConvolutionParameteri,
+   (unmarshal_func) unmarshal_CopyConvolutionFilter1D,
+   (unmarshal_func) unmarshal_CopyConvolutionFilter2D,
+   (unmarshal_func) unmarshal_Histogram,
+   (unmarshal_func) unmarshal_Minmax,
+   (unmarshal_func) unmarshal_ResetHistogram,
+   (unmarshal_func) unmarshal_ResetMinmax,
+   (unmarshal_func) unmarshal_CopyTexSubImage3D,
+   (unmarshal_func) unmarshal_ActiveTextureARB,
+   (unmarshal_func) unmarshal_ClientActiveTextureARB,
+   (unmarshal_func) unmarshal_MultiTexCoord1dARB,
+   (unmarshal_func) unmarshal_MultiTexCoord1dvARB,
+   (unmarshal_func) unmarshal_MultiTexCoord1fARB,
+   (unmarshal_func) unmarshal_MultiTexCoord1fvARB,
+   (unmarshal_func) unmarshal_MultiTexCoord1iARB,
+   (unmarshal_func) unmarshal_MultiTexCoord1ivARB,
+   (unmarshal_func) unmarshal_MultiTexCoord1sARB,
+   (unmarshal_func) unmarshal_MultiTexCoord1svARB,
+   (unmarshal_func) unmarshal_MultiTexCoord2dARB,
+   (unmarshal_func) unmarshal_MultiTexCoord2dvARB,
+   (unmarshal_func) unmarshal_MultiTexCoord2fARB,
+   (unmarshal_func) unmarshal_MultiTexCoord2fvARB,
+   (unmarshal_func) unmarshal_MultiTexCoord2iARB,
+   (unmarshal_func) unmarshal_MultiTexCoord2ivARB,
+   (unmarshal_func) unmarshal_MultiTexCoord2sARB,
+   (unmarshal_func) unmarshal_MultiTexCoord2svARB,
+   (unmarshal_func) unmarshal_MultiTexCoord3dARB,
+   (unmarshal_func) unmarshal_MultiTexCoord3dvARB,
+   (unmarshal_func) unmarshal_MultiTexCoord3fARB,
+   (unmarshal_func) unmarshal_MultiTexCoord3fvARB,
+   (unmarshal_func) unmarshal_MultiTexCoord3iARB,
+   (unmarshal_func) unmarshal_MultiTexCoord3ivARB,
+   (unmarshal_func) unmarshal_MultiTexCoord3sARB,
+   (unmarshal_func) unmarshal_MultiTexCoord3svARB,
+   (unmarshal_func) unmarshal_MultiTexCoord4dARB,
+   (unmarshal_func) unmarshal_MultiTexCoord4dvARB,
+   (unmarshal_func) unmarshal_MultiTexCoord4fARB,
+   (unmarshal_func) unmarshal_MultiTexCoord4fvARB,
+   (unmarshal_func) unmarshal_MultiTexCoord4iARB,
+   (unmarshal_func) unmarshal_MultiTexCoord4ivARB,
+   (unmarshal_func) unmarshal_MultiTexCoord4sARB,
+   (unmarshal_func) unmarshal_MultiTexCoord4svARB,
+   (unmarshal_func) unmarshal_LoadTransposeMatrixfARB,
+   (unmarshal_func) unmarshal_LoadTransposeMatrixdARB,
+   (unmarshal_func) unmarshal_MultTransposeMatrixfARB,
+   (unmarshal_func) unmarshal_MultTransposeMatrixdARB,
+   (unmarshal_func) unmarshal_SampleCoverageARB,
+   (unmarshal_func) unmarshal_PolygonOffsetEXT,
+   (unmarshal_func) unmarshal_PixelTexGenSGIX,
+   (unmarshal_func) unmarshal_PixelTexGenParameteriSGIS,
+   (unmarshal_func) unmarshal_PixelTexGenParameterfSGIS,
+   (unmarshal_func) unmarshal_SampleMaskSGIS,
+   (unmarshal_func) unmarshal_SamplePatternSGIS,
+   (unmarshal_func) unmarshal_SpriteParameterfSGIX,
+   (unmarshal_func) unmarshal_SpriteParameteriSGIX,
+   (unmarshal_func) unmarshal_PointParameterfEXT,
+   (unmarshal_func) unmarshal_ReadInstrumentsSGIX,
+   (unmarshal_func) unmarshal_StartInstrumentsSGIX,
+   (unmarshal_func) unmarshal_StopInstrumentsSGIX,
+   (unmarshal_func) unmarshal_FrameZoomSGIX,
+   (unmarshal_func) unmarshal_TagSampleBufferSGIX,
+   (unmarshal_func) unmarshal_FlushRasterSGIX,
+   (unmarshal_func) unmarshal_ListParameterfSGIX,
+   (unmarshal_func) unmarshal_ListParameteriSGIX,
+   (unmarshal_func) unmarshal_FragmentColorMaterialSGIX,
+   (unmarshal_func) unmarshal_FragmentLightfSGIX,
+   (unmarshal_func) unmarshal_FragmentLightiSGIX,
+   (unmarshal_func) unmarshal_FragmentLightModelfSGIX,
+   (unmarshal_func) unmarshal_FragmentLightModeliSGIX,
+   (unmarshal_func) unmarshal_FragmentMaterialfSGIX,
+   (unmarshal_func) unmarshal_FragmentMaterialiSGIX,
+   (unmarshal_func) unmarshal_LightEnviSGIX,
+   (unmarshal_func) unmarshal_VertexWeightfEXT,
+   (unmarshal_func) unmarshal_FlushVertexArrayRangeNV,
+   (unmarshal_func) unmarshal_CombinerParameterfNV,
+   (unmarshal_func) unmarshal_CombinerParameteriNV,
+   (unmarshal_func) unmarshal_CombinerInputNV,
+   (unmarshal_func) unmarshal_CombinerOutputNV,
+   (unmarshal_func) unmarshal_FinalCombinerInputNV,
+   (unmarshal_func) unmarshal_ResizeBuffersMESA,
+   (unmarshal_func) unmarshal_WindowPos2dMESA,
+   (unmarshal_func) unmarshal_WindowPos2dvMESA,
+   (unmarshal_func) unmarshal_WindowPos2fMESA,
+   (unmarshal_func) unmarshal_WindowPos2fvMESA,
+   (unmarshal_func) unmarshal_WindowPos2iMESA,
+   (unmarshal_func) unmarshal_WindowPos2ivMESA,
+   (unmarshal_func) unmarshal_WindowPos2sMESA,
+   (unmarshal_func) unmarshal_WindowPos2svMESA,
+   (unmarshal_func) unmarshal_WindowPos3dMESA,
+   (unmarshal_func) unmarshal_WindowPos3dvMESA,
+   (unmarshal_func) unmarshal_WindowPos3fMESA,
+   (unmarshal_func) unmarshal_WindowPos3fvMESA,
+   (unmarshal_func) unmarshal_WindowPos3iMESA,
+   (unmarshal_func) unmarshal_WindowPos3ivMESA,
+   (unmarshal_func) unmarshal_WindowPos3sMESA,
+   (unmarshal_func) unmarshal_WindowPos3svMESA,
+   (unmarshal_func) unmarshal_WindowPos4dMESA,
+   (unmarshal_func) unmarshal_WindowPos4dvMESA,
+   (unmarshal_func) unmarshal_WindowPos4fMESA,
+   (unmarshal_func) unmarshal_WindowPos4fvMESA,
+   (unmarshal_func) unmarshal_WindowPos4iMESA,
+   (unmarshal_func) unmarshal_WindowPos4ivMESA,
+   (unmarshal_func) unmarshal_WindowPos4sMESA,
+   (unmarshal_func) unmarshal_WindowPos4svMESA,
+   (unmarshal_func) unmarshal_BlendFuncSeparateEXT,
+   (unmarshal_func) unmarshal_IndexMaterialEXT,
+   (unmarshal_func) unmarshal_IndexFuncEXT,
+   (unmarshal_func) unmarshal_LockArraysEXT,
+   (unmarshal_func) unmarshal_UnlockArraysEXT,
+   (unmarshal_func) unmarshal_HintPGI,
+   (unmarshal_func) unmarshal_FogCoordfEXT,
+   (unmarshal_func) unmarshal_FogCoordfvEXT,
+   (unmarshal_func) unmarshal_FogCoorddEXT,
+   (unmarshal_func) unmarshal_FogCoorddvEXT,
+   (unmarshal_func) unmarshal_TbufferMask3DFX,
+   (unmarshal_func) unmarshal_SecondaryColor3bEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3bvEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3dEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3dvEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3fEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3fvEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3iEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3ivEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3sEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3svEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3ubEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3ubvEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3uiEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3uivEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3usEXT,
+   (unmarshal_func) unmarshal_SecondaryColor3usvEXT,
+   (unmarshal_func) unmarshal_BindProgramNV,
+   (unmarshal_func) unmarshal_ProgramParameter4dNV,
+   (unmarshal_func) unmarshal_ProgramParameter4dvNV,
+   (unmarshal_func) unmarshal_ProgramParameter4fNV,
+   (unmarshal_func) unmarshal_ProgramParameter4fvNV,
+   (unmarshal_func) unmarshal_TrackMatrixNV,
+   (unmarshal_func) unmarshal_VertexAttrib1dARB,
+   (unmarshal_func) unmarshal_VertexAttrib1dvARB,
+   (unmarshal_func) unmarshal_VertexAttrib1fARB,
+   (unmarshal_func) unmarshal_VertexAttrib1fvARB,
+   (unmarshal_func) unmarshal_VertexAttrib1sARB,
+   (unmarshal_func) unmarshal_VertexAttrib1svARB,
+   (unmarshal_func) unmarshal_VertexAttrib2dARB,
+   (unmarshal_func) unmarshal_VertexAttrib2dvARB,
+   (unmarshal_func) unmarshal_VertexAttrib2fARB,
+   (unmarshal_func) unmarshal_VertexAttrib2fvARB,
+   (unmarshal_func) unmarshal_VertexAttrib2sARB,
+   (unmarshal_func) unmarshal_VertexAttrib2svARB,
+   (unmarshal_func) unmarshal_VertexAttrib3dARB,
+   (unmarshal_func) unmarshal_VertexAttrib3dvARB,
+   (unmarshal_func) unmarshal_VertexAttrib3fARB,
+   (unmarshal_func) unmarshal_VertexAttrib3fvARB,
+   (unmarshal_func) unmarshal_VertexAttrib3sARB,
+   (unmarshal_func) unmarshal_VertexAttrib3svARB,
+   (unmarshal_func) unmarshal_VertexAttrib4dARB,
+   (unmarshal_func) unmarshal_VertexAttrib4dvARB,
+   (unmarshal_func) unmarshal_VertexAttrib4fARB,
+   (unmarshal_func) unmarshal_VertexAttrib4fvARB,
+   (unmarshal_func) unmarshal_VertexAttrib4sARB,
+   (unmarshal_func) unmarshal_VertexAttrib4svARB,
+   (unmarshal_func) unmarshal_VertexAttrib4NubARB,
+   (unmarshal_func) unmarshal_VertexAttrib4NubvARB,
+   (unmarshal_func) unmarshal_PointParameteriNV,
+   (unmarshal_func) unmarshal_ActiveStencilFaceEXT,
+   (unmarshal_func) unmarshal_SetFenceNV,
+   (unmarshal_func) unmarshal_VertexAttrib4bvARB,
+   (unmarshal_func) unmarshal_VertexAttrib4ivARB,
+   (unmarshal_func) unmarshal_VertexAttrib4ubvARB,
+   (unmarshal_func) unmarshal_VertexAttrib4usvARB,
+   (unmarshal_func) unmarshal_VertexAttrib4uivARB,
+   (unmarshal_func) unmarshal_VertexAttrib4NbvARB,
+   (unmarshal_func) unmarshal_VertexAttrib4NsvARB,
+   (unmarshal_func) unmarshal_VertexAttrib4NivARB,
+   (unmarshal_func) unmarshal_VertexAttrib4NusvARB,
+   (unmarshal_func) unmarshal_VertexAttrib4NuivARB,
+   (unmarshal_func) unmarshal_EnableVertexAttribArrayARB,
+   (unmarshal_func) unmarshal_DisableVertexAttribArrayARB,
+   (unmarshal_func) unmarshal_ProgramEnvParameter4dARB,
+   (unmarshal_func) unmarshal_ProgramEnvParameter4dvARB,
+   (unmarshal_func) unmarshal_ProgramEnvParameter4fARB,
+   (unmarshal_func) unmarshal_ProgramEnvParameter4fvARB,
+   (unmarshal_func) unmarshal_ProgramLocalParameter4dARB,
+   (unmarshal_func) unmarshal_ProgramLocalParameter4dvARB,
+   (unmarshal_func) unmarshal_ProgramLocalParameter4fARB,
+   (unmarshal_func) unmarshal_ProgramLocalParameter4fvARB,
+   (unmarshal_func) unmarshal_BindBufferARB,
+   (unmarshal_func) unmarshal_DepthBoundsEXT,
+   (unmarshal_func) unmarshal_BeginQueryARB,
+   (unmarshal_func) unmarshal_EndQueryARB,
+   (unmarshal_func) unmarshal_BlendEquationSeparateEXT,
+   (unmarshal_func) unmarshal_DeleteObjectARB,
+   (unmarshal_func) unmarshal_DetachObjectARB,
+   (unmarshal_func) unmarshal_CompileShaderARB,
+   (unmarshal_func) unmarshal_AttachObjectARB,
+   (unmarshal_func) unmarshal_LinkProgramARB,
+   (unmarshal_func) unmarshal_UseProgramObjectARB,
+   (unmarshal_func) unmarshal_ValidateProgramARB,
+   (unmarshal_func) unmarshal_Uniform1fARB,
+   (unmarshal_func) unmarshal_Uniform2fARB,
+   (unmarshal_func) unmarshal_Uniform3fARB,
+   (unmarshal_func) unmarshal_Uniform4fARB,
+   (unmarshal_func) unmarshal_Uniform1iARB,
+   (unmarshal_func) unmarshal_Uniform2iARB,
+   (unmarshal_func) unmarshal_Uniform3iARB,
+   (unmarshal_func) unmarshal_Uniform4iARB,
+   (unmarshal_func) unmarshal_VertexAttrib1dNV,
+   (unmarshal_func) unmarshal_VertexAttrib1dvNV,
+   (unmarshal_func) unmarshal_VertexAttrib1fNV,
+   (unmarshal_func) unmarshal_VertexAttrib1fvNV,
+   (unmarshal_func) unmarshal_VertexAttrib1sNV,
+   (unmarshal_func) unmarshal_VertexAttrib1svNV,
+   (unmarshal_func) unmarshal_VertexAttrib2dNV,
+   (unmarshal_func) unmarshal_VertexAttrib2dvNV,
+   (unmarshal_func) unmarshal_VertexAttrib2fNV,
+   (unmarshal_func) unmarshal_VertexAttrib2fvNV,
+   (unmarshal_func) unmarshal_VertexAttrib2sNV,
+   (unmarshal_func) unmarshal_VertexAttrib2svNV,
+   (unmarshal_func) unmarshal_VertexAttrib3dNV,
+   (unmarshal_func) unmarshal_VertexAttrib3dvNV,
+   (unmarshal_func) unmarshal_VertexAttrib3fNV,
+   (unmarshal_func) unmarshal_VertexAttrib3fvNV,
+   (unmarshal_func) unmarshal_VertexAttrib3sNV,
+   (unmarshal_func) unmarshal_VertexAttrib3svNV,
+   (unmarshal_func) unmarshal_VertexAttrib4dNV,
+   (unmarshal_func) unmarshal_VertexAttrib4dvNV,
+   (unmarshal_func) unmarshal_VertexAttrib4fNV,
+   (unmarshal_func) unmarshal_VertexAttrib4fvNV,
+   (unmarshal_func) unmarshal_VertexAttrib4sNV,
+   (unmarshal_func) unmarshal_VertexAttrib4svNV,
+   (unmarshal_func) unmarshal_VertexAttrib4ubNV,
+   (unmarshal_func) unmarshal_VertexAttrib4ubvNV,
+   (unmarshal_func) unmarshal_BindFragmentShaderATI,
+   (unmarshal_func) unmarshal_DeleteFragmentShaderATI,
+   (unmarshal_func) unmarshal_BeginFragmentShaderATI,
+   (unmarshal_func) unmarshal_EndFragmentShaderATI,
+   (unmarshal_func) unmarshal_PassTexCoordATI,
+   (unmarshal_func) unmarshal_SampleMapATI,
+   (unmarshal_func) unmarshal_ColorFragmentOp1ATI,
+   (unmarshal_func) unmarshal_ColorFragmentOp2ATI,
+   (unmarshal_func) unmarshal_ColorFragmentOp3ATI,
+   (unmarshal_func) unmarshal_AlphaFragmentOp1ATI,
+   (unmarshal_func) unmarshal_AlphaFragmentOp2ATI,
+   (unmarshal_func) unmarshal_AlphaFragmentOp3ATI,
+   (unmarshal_func) unmarshal_BindRenderbufferEXT,
+   (unmarshal_func) unmarshal_RenderbufferStorageEXT,
+   (unmarshal_func) unmarshal_BindFramebufferEXT,
+   (unmarshal_func) unmarshal_FramebufferTexture1DEXT,
+   (unmarshal_func) unmarshal_FramebufferTexture2DEXT,
+   (unmarshal_func) unmarshal_FramebufferTexture3DEXT,
+   (unmarshal_func) unmarshal_FramebufferRenderbufferEXT,
+   (unmarshal_func) unmarshal_GenerateMipmapEXT,
+   (unmarshal_func) unmarshal_StencilFuncSeparate,
+   (unmarshal_func) unmarshal_StencilOpSeparate,
+   (unmarshal_func) unmarshal_StencilMaskSeparate,
+};
+
+
+static void
+init_marshal_table(struct _glapi_table *table)
+{
+   SET_NewList(table, marshal_NewList);
+   SET_EndList(table, marshal_EndList);
+   SET_CallList(table, marshal_CallList);
+   SET_CallLists(table, marshal_CallLists);
+   SET_DeleteLists(table, marshal_DeleteLists);
+   SET_GenLists(table, marshal_GenLists);
+   SET_ListBase(table, marshal_ListBase);
+   SET_Begin(table, marshal_Begin);
+   SET_Bitmap(table, marshal_Bitmap);
+   SET_Color3b(table, marshal_Color3b);
+   SET_Color3bv(table, marshal_Color3bv);
+   SET_Color3d(table, marshal_Color3d);
+   SET_Color3dv(table, marshal_Color3dv);
+   SET_Color3f(table, marshal_Color3f);
+   SET_Color3fv(table, marshal_Color3fv);
+   SET_Color3i(table, marshal_Color3i);
+   SET_Color3iv(table, marshal_Color3iv);
+   SET_Color3s(table, marshal_Color3s);
+   SET_Color3sv(table, marshal_Color3sv);
+   SET_Color3ub(table, marshal_Color3ub);
+   SET_Color3ubv(table, marshal_Color3ubv);
+   SET_Color3ui(table, marshal_Color3ui);
+   SET_Color3uiv(table, marshal_Color3uiv);
+   SET_Color3us(table, marshal_Color3us);
+   SET_Color3usv(table, marshal_Color3usv);
+   SET_Color4b(table, marshal_Color4b);
+   SET_Color4bv(table, marshal_Color4bv);
+   SET_Color4d(table, marshal_Color4d);
+   SET_Color4dv(table, marshal_Color4dv);
+   SET_Color4f(table, marshal_Color4f);
+   SET_Color4fv(table, marshal_Color4fv);
+   SET_Color4i(table, marshal_Color4i);
+   SET_Color4iv(table, marshal_Color4iv);
+   SET_Color4s(table, marshal_Color4s);
+   SET_Color4sv(table, marshal_Color4sv);
+   SET_Color4ub(table, marshal_Color4ub);
+   SET_Color4ubv(table, marshal_Color4ubv);
+   SET_Color4ui(table, marshal_Color4ui);
+   SET_Color4uiv(table, marshal_Color4uiv);
+   SET_Color4us(table, marshal_Color4us);
+   SET_Color4usv(table, marshal_Color4usv);
+   SET_EdgeFlag(table, marshal_EdgeFlag);
+   SET_EdgeFlagv(table, marshal_EdgeFlagv);
+   SET_End(table, marshal_End);
+   SET_Indexd(table, marshal_Indexd);
+   SET_Indexdv(table, marshal_Indexdv);
+   SET_Indexf(table, marshal_Indexf);
+   SET_Indexfv(table, marshal_Indexfv);
+   SET_Indexi(table, marshal_Indexi);
+   SET_Indexiv(table, marshal_Indexiv);
+   SET_Indexs(table, marshal_Indexs);
+   SET_Indexsv(table, marshal_Indexsv);
+   SET_Normal3b(table, marshal_Normal3b);
+   SET_Normal3bv(table, marshal_Normal3bv);
+   SET_Normal3d(table, marshal_Normal3d);
+   SET_Normal3dv(table, marshal_Normal3dv);
+   SET_Normal3f(table, marshal_Normal3f);
+   SET_Normal3fv(table, marshal_Normal3fv);
+   SET_Normal3i(table, marshal_Normal3i);
+   SET_Normal3iv(table, marshal_Normal3iv);
+   SET_Normal3s(table, marshal_Normal3s);
+   SET_Normal3sv(table, marshal_Normal3sv);
+   SET_RasterPos2d(table, marshal_RasterPos2d);
+   SET_RasterPos2dv(table, marshal_RasterPos2dv);
+   SET_RasterPos2f(table, marshal_RasterPos2f);
+   SET_RasterPos2fv(table, marshal_RasterPos2fv);
+   SET_RasterPos2i(table, marshal_RasterPos2i);
+   SET_RasterPos2iv(table, marshal_RasterPos2iv);
+   SET_RasterPos2s(table, marshal_RasterPos2s);
+   SET_RasterPos2sv(table, marshal_RasterPos2sv);
+   SET_RasterPos3d(table, marshal_RasterPos3d);
+   SET_RasterPos3dv(table, marshal_RasterPos3dv);
+   SET_RasterPos3f(table, marshal_RasterPos3f);
+   SET_RasterPos3fv(table, marshal_RasterPos3fv);
+   SET_RasterPos3i(table, marshal_RasterPos3i);
+   SET_RasterPos3iv(table, marshal_RasterPos3iv);
+   SET_RasterPos3s(table, marshal_RasterPos3s);
+   SET_RasterPos3sv(table, marshal_RasterPos3sv);
+   SET_RasterPos4d(table, marshal_RasterPos4d);
+   SET_RasterPos4dv(table, marshal_RasterPos4dv);
+   SET_RasterPos4f(table, marshal_RasterPos4f);
+   SET_RasterPos4fv(table, marshal_RasterPos4fv);
+   SET_RasterPos4i(table, marshal_RasterPos4i);
+   SET_RasterPos4iv(table, marshal_RasterPos4iv);
+   SET_RasterPos4s(table, marshal_RasterPos4s);
+   SET_RasterPos4sv(table, marshal_RasterPos4sv);
+   SET_Rectd(table, marshal_Rectd);
+   SET_Rectdv(table, marshal_Rectdv);
+   SET_Rectf(table, marshal_Rectf);
+   SET_Rectfv(table, marshal_Rectfv);
+   SET_Recti(table, marshal_Recti);
+   SET_Rectiv(table, marshal_Rectiv);
+   SET_Rects(table, marshal_Rects);
+   SET_Rectsv(table, marshal_Rectsv);
+   SET_TexCoord1d(table, marshal_TexCoord1d);
+   SET_TexCoord1dv(table, marshal_TexCoord1dv);
+   SET_TexCoord1f(table, marshal_TexCoord1f);
+   SET_TexCoord1fv(table, marshal_TexCoord1fv);
+   SET_TexCoord1i(table, marshal_TexCoord1i);
+   SET_TexCoord1iv(table, marshal_TexCoord1iv);
+   SET_TexCoord1s(table, marshal_TexCoord1s);
+   SET_TexCoord1sv(table, marshal_TexCoord1sv);
+   SET_TexCoord2d(table, marshal_TexCoord2d);
+   SET_TexCoord2dv(table, marshal_TexCoord2dv);
+   SET_TexCoord2f(table, marshal_TexCoord2f);
+   SET_TexCoord2fv(table, marshal_TexCoord2fv);
+   SET_TexCoord2i(table, marshal_TexCoord2i);
+   SET_TexCoord2iv(table, marshal_TexCoord2iv);
+   SET_TexCoord2s(table, marshal_TexCoord2s);
+   SET_TexCoord2sv(table, marshal_TexCoord2sv);
+   SET_TexCoord3d(table, marshal_TexCoord3d);
+   SET_TexCoord3dv(table, marshal_TexCoord3dv);
+   SET_TexCoord3f(table, marshal_TexCoord3f);
+   SET_TexCoord3fv(table, marshal_TexCoord3fv);
+   SET_TexCoord3i(table, marshal_TexCoord3i);
+   SET_TexCoord3iv(table, marshal_TexCoord3iv);
+   SET_TexCoord3s(table, marshal_TexCoord3s);
+   SET_TexCoord3sv(table, marshal_TexCoord3sv);
+   SET_TexCoord4d(table, marshal_TexCoord4d);
+   SET_TexCoord4dv(table, marshal_TexCoord4dv);
+   SET_TexCoord4f(table, marshal_TexCoord4f);
+   SET_TexCoord4fv(table, marshal_TexCoord4fv);
+   SET_TexCoord4i(table, marshal_TexCoord4i);
+   SET_TexCoord4iv(table, marshal_TexCoord4iv);
+   SET_TexCoord4s(table, marshal_TexCoord4s);
+   SET_TexCoord4sv(table, marshal_TexCoord4sv);
+   SET_Vertex2d(table, marshal_Vertex2d);
+   SET_Vertex2dv(table, marshal_Vertex2dv);
+   SET_Vertex2f(table, marshal_Vertex2f);
+   SET_Vertex2fv(table, marshal_Vertex2fv);
+   SET_Vertex2i(table, marshal_Vertex2i);
+   SET_Vertex2iv(table, marshal_Vertex2iv);
+   SET_Vertex2s(table, marshal_Vertex2s);
+   SET_Vertex2sv(table, marshal_Vertex2sv);
+   SET_Vertex3d(table, marshal_Vertex3d);
+   SET_Vertex3dv(table, marshal_Vertex3dv);
+   SET_Vertex3f(table, marshal_Vertex3f);
+   SET_Vertex3fv(table, marshal_Vertex3fv);
+   SET_Vertex3i(table, marshal_Vertex3i);
+   SET_Vertex3iv(table, marshal_Vertex3iv);
+   SET_Vertex3s(table, marshal_Vertex3s);
+   SET_Vertex3sv(table, marshal_Vertex3sv);
+   SET_Vertex4d(table, marshal_Vertex4d);
+   SET_Vertex4dv(table, marshal_Vertex4dv);
+   SET_Vertex4f(table, marshal_Vertex4f);
+   SET_Vertex4fv(table, marshal_Vertex4fv);
+   SET_Vertex4i(table, marshal_Vertex4i);
+   SET_Vertex4iv(table, marshal_Vertex4iv);
+   SET_Vertex4s(table, marshal_Vertex4s);
+   SET_Vertex4sv(table, marshal_Vertex4sv);
+   SET_ClipPlane(table, marshal_ClipPlane);
+   SET_ColorMaterial(table, marshal_ColorMaterial);
+   SET_CullFace(table, marshal_CullFace);
+   SET_Fogf(table, marshal_Fogf);
+   SET_Fogfv(table, marshal_Fogfv);
+   SET_Fogi(table, marshal_Fogi);
+   SET_Fogiv(table, marshal_Fogiv);
+   SET_FrontFace(table, marshal_FrontFace);
+   SET_Hint(table, marshal_Hint);
+   SET_Lightf(table, marshal_Lightf);
+   SET_Lightfv(table, marshal_Lightfv);
+   SET_Lighti(table, marshal_Lighti);
+   SET_Lightiv(table, marshal_Lightiv);
+   SET_LightModelf(table, marshal_LightModelf);
+   SET_LightModelfv(table, marshal_LightModelfv);
+   SET_LightModeli(table, marshal_LightModeli);
+   SET_LightModeliv(table, marshal_LightModeliv);
+   SET_LineStipple(table, marshal_LineStipple);
+   SET_LineWidth(table, marshal_LineWidth);
+   SET_Materialf(table, marshal_Materialf);
+   SET_Materialfv(table, marshal_Materialfv);
+   SET_Materiali(table, marshal_Materiali);
+   SET_Materialiv(table, marshal_Materialiv);
+   SET_PointSize(table, marshal_PointSize);
+   SET_PolygonMode(table, marshal_PolygonMode);
+   SET_PolygonStipple(table, marshal_PolygonStipple);
+   SET_Scissor(table, marshal_Scissor);
+   SET_ShadeModel(table, marshal_ShadeModel);
+   SET_TexParameterf(table, marshal_TexParameterf);
+   SET_TexParameterfv(table, marshal_TexParameterfv);
+   SET_TexParameteri(table, marshal_TexParameteri);
+   SET_TexParameteriv(table, marshal_TexParameteriv);
+   SET_TexImage1D(table, marshal_TexImage1D);
+   SET_TexImage2D(table, marshal_TexImage2D);
+   SET_TexEnvf(table, marshal_TexEnvf);
+   SET_TexEnvfv(table, marshal_TexEnvfv);
+   SET_TexEnvi(table, marshal_TexEnvi);
+   SET_TexEnviv(table, marshal_TexEnviv);
+   SET_TexGend(table, marshal_TexGend);
+   SET_TexGendv(table, marshal_TexGendv);
+   SET_TexGenf(table, marshal_TexGenf);
+   SET_TexGenfv(table, marshal_TexGenfv);
+   SET_TexGeni(table, marshal_TexGeni);
+   SET_TexGeniv(table, marshal_TexGeniv);
+   SET_FeedbackBuffer(table, marshal_FeedbackBuffer);
+   SET_SelectBuffer(table, marshal_SelectBuffer);
+   SET_RenderMode(table, marshal_RenderMode);
+   SET_InitNames(table, marshal_InitNames);
+   SET_LoadName(table, marshal_LoadName);
+   SET_PassThrough(table, marshal_PassThrough);
+   SET_PopName(table, marshal_PopName);
+   SET_PushName(table, marshal_PushName);
+   SET_DrawBuffer(table, marshal_DrawBuffer);
+   SET_Clear(table, marshal_Clear);
+   SET_ClearAccum(table, marshal_ClearAccum);
+   SET_ClearIndex(table, marshal_ClearIndex);
+   SET_ClearColor(table, marshal_ClearColor);
+   SET_ClearStencil(table, marshal_ClearStencil);
+   SET_ClearDepth(table, marshal_ClearDepth);
+   SET_StencilMask(table, marshal_StencilMask);
+   SET_ColorMask(table, marshal_ColorMask);
+   SET_DepthMask(table, marshal_DepthMask);
+   SET_IndexMask(table, marshal_IndexMask);
+   SET_Accum(table, marshal_Accum);
+   SET_Disable(table, marshal_Disable);
+   SET_Enable(table, marshal_Enable);
+   SET_Finish(table, marshal_Finish);
+   SET_Flush(table, marshal_Flush);
+   SET_PopAttrib(table, marshal_PopAttrib);
+   SET_PushAttrib(table, marshal_PushAttrib);
+   SET_Map1d(table, marshal_Map1d);
+   SET_Map1f(table, marshal_Map1f);
+   SET_Map2d(table, marshal_Map2d);
+   SET_Map2f(table, marshal_Map2f);
+   SET_MapGrid1d(table, marshal_MapGrid1d);
+   SET_MapGrid1f(table, marshal_MapGrid1f);
+   SET_MapGrid2d(table, marshal_MapGrid2d);
+   SET_MapGrid2f(table, marshal_MapGrid2f);
+   SET_EvalCoord1d(table, marshal_EvalCoord1d);
+   SET_EvalCoord1dv(table, marshal_EvalCoord1dv);
+   SET_EvalCoord1f(table, marshal_EvalCoord1f);
+   SET_EvalCoord1fv(table, marshal_EvalCoord1fv);
+   SET_EvalCoord2d(table, marshal_EvalCoord2d);
+   SET_EvalCoord2dv(table, marshal_EvalCoord2dv);
+   SET_EvalCoord2f(table, marshal_EvalCoord2f);
+   SET_EvalCoord2fv(table, marshal_EvalCoord2fv);
+   SET_EvalMesh1(table, marshal_EvalMesh1);
+   SET_EvalPoint1(table, marshal_EvalPoint1);
+   SET_EvalMesh2(table, marshal_EvalMesh2);
+   SET_EvalPoint2(table, marshal_EvalPoint2);
+   SET_AlphaFunc(table, marshal_AlphaFunc);
+   SET_BlendFunc(table, marshal_BlendFunc);
+   SET_LogicOp(table, marshal_LogicOp);
+   SET_StencilFunc(table, marshal_StencilFunc);
+   SET_StencilOp(table, marshal_StencilOp);
+   SET_DepthFunc(table, marshal_DepthFunc);
+   SET_PixelZoom(table, marshal_PixelZoom);
+   SET_PixelTransferf(table, marshal_PixelTransferf);
+   SET_PixelTransferi(table, marshal_PixelTransferi);
+   SET_PixelStoref(table, marshal_PixelStoref);
+   SET_PixelStorei(table, marshal_PixelStorei);
+   SET_PixelMapfv(table, marshal_PixelMapfv);
+   SET_PixelMapuiv(table, marshal_PixelMapuiv);
+   SET_PixelMapusv(table, marshal_PixelMapusv);
+   SET_ReadBuffer(table, marshal_ReadBuffer);
+   SET_CopyPixels(table, marshal_CopyPixels);
+   SET_ReadPixels(table, marshal_ReadPixels);
+   SET_DrawPixels(table, marshal_DrawPixels);
+   SET_GetBooleanv(table, marshal_GetBooleanv);
+   SET_GetClipPlane(table, marshal_GetClipPlane);
+   SET_GetDoublev(table, marshal_GetDoublev);
+   SET_GetError(table, marshal_GetError);
+   SET_GetFloatv(table, marshal_GetFloatv);
+   SET_GetIntegerv(table, marshal_GetIntegerv);
+   SET_GetLightfv(table, marshal_GetLightfv);
+   SET_GetLightiv(table, marshal_GetLightiv);
+   SET_GetMapdv(table, marshal_GetMapdv);
+   SET_GetMapfv(table, marshal_GetMapfv);
+   SET_GetMapiv(table, marshal_GetMapiv);
+   SET_GetMaterialfv(table, marshal_GetMaterialfv);
+   SET_GetMaterialiv(table, marshal_GetMaterialiv);
+   SET_GetPixelMapfv(table, marshal_GetPixelMapfv);
+   SET_GetPixelMapuiv(table, marshal_GetPixelMapuiv);
+   SET_GetPixelMapusv(table, marshal_GetPixelMapusv);
+   SET_GetPolygonStipple(table, marshal_GetPolygonStipple);
+   SET_GetString(table, marshal_GetString);
+   SET_GetTexEnvfv(table, marshal_GetTexEnvfv);
+   SET_GetTexEnviv(table, marshal_GetTexEnviv);
+   SET_GetTexGendv(table, marshal_GetTexGendv);
+   SET_GetTexGenfv(table, marshal_GetTexGenfv);
+   SET_GetTexGeniv(table, marshal_GetTexGeniv);
+   SET_GetTexImage(table, marshal_GetTexImage);
+   SET_GetTexParameterfv(table, marshal_GetTexParameterfv);
+   SET_GetTexParameteriv(table, marshal_GetTexParameteriv);
+   SET_GetTexLevelParameterfv(table, marshal_GetTexLevelParameterfv);
+   SET_GetTexLevelParameteriv(table, marshal_GetTexLevelParameteriv);
+   SET_IsEnabled(table, marshal_IsEnabled);
+   SET_IsList(table, marshal_IsList);
+   SET_DepthRange(table, marshal_DepthRange);
+   SET_Frustum(table, marshal_Frustum);
+   SET_LoadIdentity(table, marshal_LoadIdentity);
+   SET_LoadMatrixf(table, marshal_LoadMatrixf);
+   SET_LoadMatrixd(table, marshal_LoadMatrixd);
+   SET_MatrixMode(table, marshal_MatrixMode);
+   SET_MultMatrixf(table, marshal_MultMatrixf);
+   SET_MultMatrixd(table, marshal_MultMatrixd);
+   SET_Ortho(table, marshal_Ortho);
+   SET_PopMatrix(table, marshal_PopMatrix);
+   SET_PushMatrix(table, marshal_PushMatrix);
+   SET_Rotated(table, marshal_Rotated);
+   SET_Rotatef(table, marshal_Rotatef);
+   SET_Scaled(table, marshal_Scaled);
+   SET_Scalef(table, marshal_Scalef);
+   SET_Translated(table, marshal_Translated);
+   SET_Translatef(table, marshal_Translatef);
+   SET_Viewport(table, marshal_Viewport);
+   SET_ArrayElement(table, marshal_ArrayElement);
+   SET_BindTexture(table, marshal_BindTexture);
+   SET_ColorPointer(table, marshal_ColorPointer);
+   SET_DisableClientState(table, marshal_DisableClientState);
+   SET_DrawArrays(table, marshal_DrawArrays);
+   SET_DrawElements(table, marshal_DrawElements);
+   SET_EdgeFlagPointer(table, marshal_EdgeFlagPointer);
+   SET_EnableClientState(table, marshal_EnableClientState);
+   SET_IndexPointer(table, marshal_IndexPointer);
+   SET_Indexub(table, marshal_Indexub);
+   SET_Indexubv(table, marshal_Indexubv);
+   SET_InterleavedArrays(table, marshal_InterleavedArrays);
+   SET_NormalPointer(table, marshal_NormalPointer);
+   SET_PolygonOffset(table, marshal_PolygonOffset);
+   SET_TexCoordPointer(table, marshal_TexCoordPointer);
+   SET_VertexPointer(table, marshal_VertexPointer);
+   SET_AreTexturesResident(table, marshal_AreTexturesResident);
+   SET_CopyTexImage1D(table, marshal_CopyTexImage1D);
+   SET_CopyTexImage2D(table, marshal_CopyTexImage2D);
+   SET_CopyTexSubImage1D(table, marshal_CopyTexSubImage1D);
+   SET_CopyTexSubImage2D(table, marshal_CopyTexSubImage2D);
+   SET_DeleteTextures(table, marshal_DeleteTextures);
+   SET_GenTextures(table, marshal_GenTextures);
+   SET_GetPointerv(table, marshal_GetPointerv);
+   SET_IsTexture(table, marshal_IsTexture);
+   SET_PrioritizeTextures(table, marshal_PrioritizeTextures);
+   SET_TexSubImage1D(table, marshal_TexSubImage1D);
+   SET_TexSubImage2D(table, marshal_TexSubImage2D);
+   SET_PopClientAttrib(table, marshal_PopClientAttrib);
+   SET_PushClientAttrib(table, marshal_PushClientAttrib);
+   SET_BlendColor(table, marshal_BlendColor);
+   SET_BlendEquation(table, marshal_BlendEquation);
+   SET_DrawRangeElements(table, marshal_DrawRangeElements);
+   SET_ColorTable(table, marshal_ColorTable);
+   SET_ColorTableParameterfv(table, marshal_ColorTableParameterfv);
+   SET_ColorTableParameteriv(table, marshal_ColorTableParameteriv);
+   SET_CopyColorTable(table, marshal_CopyColorTable);
+   SET_GetColorTable(table, marshal_GetColorTable);
+   SET_GetColorTableParameterfv(table, marshal_GetColorTableParameterfv);
+   SET_GetColorTableParameteriv(table, marshal_GetColorTableParameteriv);
+   SET_ColorSubTable(table, marshal_ColorSubTable);
+   SET_CopyColorSubTable(table, marshal_CopyColorSubTable);
+   SET_ConvolutionFilter1D(table, marshal_ConvolutionFilter1D);
+   SET_ConvolutionFilter2D(table, marshal_ConvolutionFilter2D);
+   SET_ConvolutionParameterf(table, marshal_ConvolutionParameterf);
+   SET_ConvolutionParameterfv(table, marshal_ConvolutionParameterfv);
+   SET_ConvolutionParameteri(table, marshal_ConvolutionParameteri);
+   SET_ConvolutionParameteriv(table, marshal_ConvolutionParameteriv);
+   SET_CopyConvolutionFilter1D(table, marshal_CopyConvolutionFilter1D);
+   SET_CopyConvolutionFilter2D(table, marshal_CopyConvolutionFilter2D);
+   SET_GetConvolutionFilter(table, marshal_GetConvolutionFilter);
+   SET_GetConvolutionParameterfv(table, marshal_GetConvolutionParameterfv);
+   SET_GetConvolutionParameteriv(table, marshal_GetConvolutionParameteriv);
+   SET_GetSeparableFilter(table, marshal_GetSeparableFilter);
+   SET_SeparableFilter2D(table, marshal_SeparableFilter2D);
+   SET_GetHistogram(table, marshal_GetHistogram);
+   SET_GetHistogramParameterfv(table, marshal_GetHistogramParameterfv);
+   SET_GetHistogramParameteriv(table, marshal_GetHistogramParameteriv);
+   SET_GetMinmax(table, marshal_GetMinmax);
+   SET_GetMinmaxParameterfv(table, marshal_GetMinmaxParameterfv);
+   SET_GetMinmaxParameteriv(table, marshal_GetMinmaxParameteriv);
+   SET_Histogram(table, marshal_Histogram);
+   SET_Minmax(table, marshal_Minmax);
+   SET_ResetHistogram(table, marshal_ResetHistogram);
+   SET_ResetMinmax(table, marshal_ResetMinmax);
+   SET_TexImage3D(table, marshal_TexImage3D);
+   SET_TexSubImage3D(table, marshal_TexSubImage3D);
+   SET_CopyTexSubImage3D(table, marshal_CopyTexSubImage3D);
+   SET_ActiveTextureARB(table, marshal_ActiveTextureARB);
+   SET_ClientActiveTextureARB(table, marshal_ClientActiveTextureARB);
+   SET_MultiTexCoord1dARB(table, marshal_MultiTexCoord1dARB);
+   SET_MultiTexCoord1dvARB(table, marshal_MultiTexCoord1dvARB);
+   SET_MultiTexCoord1fARB(table, marshal_MultiTexCoord1fARB);
+   SET_MultiTexCoord1fvARB(table, marshal_MultiTexCoord1fvARB);
+   SET_MultiTexCoord1iARB(table, marshal_MultiTexCoord1iARB);
+   SET_MultiTexCoord1ivARB(table, marshal_MultiTexCoord1ivARB);
+   SET_MultiTexCoord1sARB(table, marshal_MultiTexCoord1sARB);
+   SET_MultiTexCoord1svARB(table, marshal_MultiTexCoord1svARB);
+   SET_MultiTexCoord2dARB(table, marshal_MultiTexCoord2dARB);
+   SET_MultiTexCoord2dvARB(table, marshal_MultiTexCoord2dvARB);
+   SET_MultiTexCoord2fARB(table, marshal_MultiTexCoord2fARB);
+   SET_MultiTexCoord2fvARB(table, marshal_MultiTexCoord2fvARB);
+   SET_MultiTexCoord2iARB(table, marshal_MultiTexCoord2iARB);
+   SET_MultiTexCoord2ivARB(table, marshal_MultiTexCoord2ivARB);
+   SET_MultiTexCoord2sARB(table, marshal_MultiTexCoord2sARB);
+   SET_MultiTexCoord2svARB(table, marshal_MultiTexCoord2svARB);
+   SET_MultiTexCoord3dARB(table, marshal_MultiTexCoord3dARB);
+   SET_MultiTexCoord3dvARB(table, marshal_MultiTexCoord3dvARB);
+   SET_MultiTexCoord3fARB(table, marshal_MultiTexCoord3fARB);
+   SET_MultiTexCoord3fvARB(table, marshal_MultiTexCoord3fvARB);
+   SET_MultiTexCoord3iARB(table, marshal_MultiTexCoord3iARB);
+   SET_MultiTexCoord3ivARB(table, marshal_MultiTexCoord3ivARB);
+   SET_MultiTexCoord3sARB(table, marshal_MultiTexCoord3sARB);
+   SET_MultiTexCoord3svARB(table, marshal_MultiTexCoord3svARB);
+   SET_MultiTexCoord4dARB(table, marshal_MultiTexCoord4dARB);
+   SET_MultiTexCoord4dvARB(table, marshal_MultiTexCoord4dvARB);
+   SET_MultiTexCoord4fARB(table, marshal_MultiTexCoord4fARB);
+   SET_MultiTexCoord4fvARB(table, marshal_MultiTexCoord4fvARB);
+   SET_MultiTexCoord4iARB(table, marshal_MultiTexCoord4iARB);
+   SET_MultiTexCoord4ivARB(table, marshal_MultiTexCoord4ivARB);
+   SET_MultiTexCoord4sARB(table, marshal_MultiTexCoord4sARB);
+   SET_MultiTexCoord4svARB(table, marshal_MultiTexCoord4svARB);
+   SET_LoadTransposeMatrixfARB(table, marshal_LoadTransposeMatrixfARB);
+   SET_LoadTransposeMatrixdARB(table, marshal_LoadTransposeMatrixdARB);
+   SET_MultTransposeMatrixfARB(table, marshal_MultTransposeMatrixfARB);
+   SET_MultTransposeMatrixdARB(table, marshal_MultTransposeMatrixdARB);
+   SET_SampleCoverageARB(table, marshal_SampleCoverageARB);
+   SET_DrawBuffersARB(table, marshal_DrawBuffersARB);
+   SET_PolygonOffsetEXT(table, marshal_PolygonOffsetEXT);
+   SET_GetTexFilterFuncSGIS(table, marshal_GetTexFilterFuncSGIS);
+   SET_TexFilterFuncSGIS(table, marshal_TexFilterFuncSGIS);
+   SET_GetHistogramEXT(table, marshal_GetHistogramEXT);
+   SET_GetHistogramParameterfvEXT(table, marshal_GetHistogramParameterfvEXT);
+   SET_GetHistogramParameterivEXT(table, marshal_GetHistogramParameterivEXT);
+   SET_GetMinmaxEXT(table, marshal_GetMinmaxEXT);
+   SET_GetMinmaxParameterfvEXT(table, marshal_GetMinmaxParameterfvEXT);
+   SET_GetMinmaxParameterivEXT(table, marshal_GetMinmaxParameterivEXT);
+   SET_GetConvolutionFilterEXT(table, marshal_GetConvolutionFilterEXT);
+   SET_GetConvolutionParameterfvEXT(table, marshal_GetConvolutionParameterfvEXT);
+   SET_GetConvolutionParameterivEXT(table, marshal_GetConvolutionParameterivEXT);
+   SET_GetSeparableFilterEXT(table, marshal_GetSeparableFilterEXT);
+   SET_GetColorTableSGI(table, marshal_GetColorTableSGI);
+   SET_GetColorTableParameterfvSGI(table, marshal_GetColorTableParameterfvSGI);
+   SET_GetColorTableParameterivSGI(table, marshal_GetColorTableParameterivSGI);
+   SET_PixelTexGenSGIX(table, marshal_PixelTexGenSGIX);
+   SET_PixelTexGenParameteriSGIS(table, marshal_PixelTexGenParameteriSGIS);
+   SET_PixelTexGenParameterivSGIS(table, marshal_PixelTexGenParameterivSGIS);
+   SET_PixelTexGenParameterfSGIS(table, marshal_PixelTexGenParameterfSGIS);
+   SET_PixelTexGenParameterfvSGIS(table, marshal_PixelTexGenParameterfvSGIS);
+   SET_GetPixelTexGenParameterivSGIS(table, marshal_GetPixelTexGenParameterivSGIS);
+   SET_GetPixelTexGenParameterfvSGIS(table, marshal_GetPixelTexGenParameterfvSGIS);
+   SET_TexImage4DSGIS(table, marshal_TexImage4DSGIS);
+   SET_TexSubImage4DSGIS(table, marshal_TexSubImage4DSGIS);
+   SET_AreTexturesResidentEXT(table, marshal_AreTexturesResidentEXT);
+   SET_GenTexturesEXT(table, marshal_GenTexturesEXT);
+   SET_IsTextureEXT(table, marshal_IsTextureEXT);
+   SET_DetailTexFuncSGIS(table, marshal_DetailTexFuncSGIS);
+   SET_GetDetailTexFuncSGIS(table, marshal_GetDetailTexFuncSGIS);
+   SET_SharpenTexFuncSGIS(table, marshal_SharpenTexFuncSGIS);
+   SET_GetSharpenTexFuncSGIS(table, marshal_GetSharpenTexFuncSGIS);
+   SET_SampleMaskSGIS(table, marshal_SampleMaskSGIS);
+   SET_SamplePatternSGIS(table, marshal_SamplePatternSGIS);
+   SET_ColorPointerEXT(table, marshal_ColorPointerEXT);
+   SET_EdgeFlagPointerEXT(table, marshal_EdgeFlagPointerEXT);
+   SET_IndexPointerEXT(table, marshal_IndexPointerEXT);
+   SET_NormalPointerEXT(table, marshal_NormalPointerEXT);
+   SET_TexCoordPointerEXT(table, marshal_TexCoordPointerEXT);
+   SET_VertexPointerEXT(table, marshal_VertexPointerEXT);
+   SET_SpriteParameterfSGIX(table, marshal_SpriteParameterfSGIX);
+   SET_SpriteParameterfvSGIX(table, marshal_SpriteParameterfvSGIX);
+   SET_SpriteParameteriSGIX(table, marshal_SpriteParameteriSGIX);
+   SET_SpriteParameterivSGIX(table, marshal_SpriteParameterivSGIX);
+   SET_PointParameterfEXT(table, marshal_PointParameterfEXT);
+   SET_PointParameterfvEXT(table, marshal_PointParameterfvEXT);
+   SET_GetInstrumentsSGIX(table, marshal_GetInstrumentsSGIX);
+   SET_InstrumentsBufferSGIX(table, marshal_InstrumentsBufferSGIX);
+   SET_PollInstrumentsSGIX(table, marshal_PollInstrumentsSGIX);
+   SET_ReadInstrumentsSGIX(table, marshal_ReadInstrumentsSGIX);
+   SET_StartInstrumentsSGIX(table, marshal_StartInstrumentsSGIX);
+   SET_StopInstrumentsSGIX(table, marshal_StopInstrumentsSGIX);
+   SET_FrameZoomSGIX(table, marshal_FrameZoomSGIX);
+   SET_TagSampleBufferSGIX(table, marshal_TagSampleBufferSGIX);
+   SET_ReferencePlaneSGIX(table, marshal_ReferencePlaneSGIX);
+   SET_FlushRasterSGIX(table, marshal_FlushRasterSGIX);
+   SET_GetListParameterfvSGIX(table, marshal_GetListParameterfvSGIX);
+   SET_GetListParameterivSGIX(table, marshal_GetListParameterivSGIX);
+   SET_ListParameterfSGIX(table, marshal_ListParameterfSGIX);
+   SET_ListParameterfvSGIX(table, marshal_ListParameterfvSGIX);
+   SET_ListParameteriSGIX(table, marshal_ListParameteriSGIX);
+   SET_ListParameterivSGIX(table, marshal_ListParameterivSGIX);
+   SET_FragmentColorMaterialSGIX(table, marshal_FragmentColorMaterialSGIX);
+   SET_FragmentLightfSGIX(table, marshal_FragmentLightfSGIX);
+   SET_FragmentLightfvSGIX(table, marshal_FragmentLightfvSGIX);
+   SET_FragmentLightiSGIX(table, marshal_FragmentLightiSGIX);
+   SET_FragmentLightivSGIX(table, marshal_FragmentLightivSGIX);
+   SET_FragmentLightModelfSGIX(table, marshal_FragmentLightModelfSGIX);
+   SET_FragmentLightModelfvSGIX(table, marshal_FragmentLightModelfvSGIX);
+   SET_FragmentLightModeliSGIX(table, marshal_FragmentLightModeliSGIX);
+   SET_FragmentLightModelivSGIX(table, marshal_FragmentLightModelivSGIX);
+   SET_FragmentMaterialfSGIX(table, marshal_FragmentMaterialfSGIX);
+   SET_FragmentMaterialfvSGIX(table, marshal_FragmentMaterialfvSGIX);
+   SET_FragmentMaterialiSGIX(table, marshal_FragmentMaterialiSGIX);
+   SET_FragmentMaterialivSGIX(table, marshal_FragmentMaterialivSGIX);
+   SET_GetFragmentLightfvSGIX(table, marshal_GetFragmentLightfvSGIX);
+   SET_GetFragmentLightivSGIX(table, marshal_GetFragmentLightivSGIX);
+   SET_GetFragmentMaterialfvSGIX(table, marshal_GetFragmentMaterialfvSGIX);
+   SET_GetFragmentMaterialivSGIX(table, marshal_GetFragmentMaterialivSGIX);
+   SET_LightEnviSGIX(table, marshal_LightEnviSGIX);
+   SET_VertexWeightfEXT(table, marshal_VertexWeightfEXT);
+   SET_VertexWeightfvEXT(table, marshal_VertexWeightfvEXT);
+   SET_VertexWeightPointerEXT(table, marshal_VertexWeightPointerEXT);
+   SET_FlushVertexArrayRangeNV(table, marshal_FlushVertexArrayRangeNV);
+   SET_VertexArrayRangeNV(table, marshal_VertexArrayRangeNV);
+   SET_CombinerParameterfvNV(table, marshal_CombinerParameterfvNV);
+   SET_CombinerParameterfNV(table, marshal_CombinerParameterfNV);
+   SET_CombinerParameterivNV(table, marshal_CombinerParameterivNV);
+   SET_CombinerParameteriNV(table, marshal_CombinerParameteriNV);
+   SET_CombinerInputNV(table, marshal_CombinerInputNV);
+   SET_CombinerOutputNV(table, marshal_CombinerOutputNV);
+   SET_FinalCombinerInputNV(table, marshal_FinalCombinerInputNV);
+   SET_GetCombinerInputParameterfvNV(table, marshal_GetCombinerInputParameterfvNV);
+   SET_GetCombinerInputParameterivNV(table, marshal_GetCombinerInputParameterivNV);
+   SET_GetCombinerOutputParameterfvNV(table, marshal_GetCombinerOutputParameterfvNV);
+   SET_GetCombinerOutputParameterivNV(table, marshal_GetCombinerOutputParameterivNV);
+   SET_GetFinalCombinerInputParameterfvNV(table, marshal_GetFinalCombinerInputParameterfvNV);
+   SET_GetFinalCombinerInputParameterivNV(table, marshal_GetFinalCombinerInputParameterivNV);
+   SET_ResizeBuffersMESA(table, marshal_ResizeBuffersMESA);
+   SET_WindowPos2dMESA(table, marshal_WindowPos2dMESA);
+   SET_WindowPos2dvMESA(table, marshal_WindowPos2dvMESA);
+   SET_WindowPos2fMESA(table, marshal_WindowPos2fMESA);
+   SET_WindowPos2fvMESA(table, marshal_WindowPos2fvMESA);
+   SET_WindowPos2iMESA(table, marshal_WindowPos2iMESA);
+   SET_WindowPos2ivMESA(table, marshal_WindowPos2ivMESA);
+   SET_WindowPos2sMESA(table, marshal_WindowPos2sMESA);
+   SET_WindowPos2svMESA(table, marshal_WindowPos2svMESA);
+   SET_WindowPos3dMESA(table, marshal_WindowPos3dMESA);
+   SET_WindowPos3dvMESA(table, marshal_WindowPos3dvMESA);
+   SET_WindowPos3fMESA(table, marshal_WindowPos3fMESA);
+   SET_WindowPos3fvMESA(table, marshal_WindowPos3fvMESA);
+   SET_WindowPos3iMESA(table, marshal_WindowPos3iMESA);
+   SET_WindowPos3ivMESA(table, marshal_WindowPos3ivMESA);
+   SET_WindowPos3sMESA(table, marshal_WindowPos3sMESA);
+   SET_WindowPos3svMESA(table, marshal_WindowPos3svMESA);
+   SET_WindowPos4dMESA(table, marshal_WindowPos4dMESA);
+   SET_WindowPos4dvMESA(table, marshal_WindowPos4dvMESA);
+   SET_WindowPos4fMESA(table, marshal_WindowPos4fMESA);
+   SET_WindowPos4fvMESA(table, marshal_WindowPos4fvMESA);
+   SET_WindowPos4iMESA(table, marshal_WindowPos4iMESA);
+   SET_WindowPos4ivMESA(table, marshal_WindowPos4ivMESA);
+   SET_WindowPos4sMESA(table, marshal_WindowPos4sMESA);
+   SET_WindowPos4svMESA(table, marshal_WindowPos4svMESA);
+   SET_BlendFuncSeparateEXT(table, marshal_BlendFuncSeparateEXT);
+   SET_IndexMaterialEXT(table, marshal_IndexMaterialEXT);
+   SET_IndexFuncEXT(table, marshal_IndexFuncEXT);
+   SET_LockArraysEXT(table, marshal_LockArraysEXT);
+   SET_UnlockArraysEXT(table, marshal_UnlockArraysEXT);
+   SET_CullParameterdvEXT(table, marshal_CullParameterdvEXT);
+   SET_CullParameterfvEXT(table, marshal_CullParameterfvEXT);
+   SET_HintPGI(table, marshal_HintPGI);
+   SET_FogCoordfEXT(table, marshal_FogCoordfEXT);
+   SET_FogCoordfvEXT(table, marshal_FogCoordfvEXT);
+   SET_FogCoorddEXT(table, marshal_FogCoorddEXT);
+   SET_FogCoorddvEXT(table, marshal_FogCoorddvEXT);
+   SET_FogCoordPointerEXT(table, marshal_FogCoordPointerEXT);
+   SET_GetColorTableEXT(table, marshal_GetColorTableEXT);
+   SET_GetColorTableParameterivEXT(table, marshal_GetColorTableParameterivEXT);
+   SET_GetColorTableParameterfvEXT(table, marshal_GetColorTableParameterfvEXT);
+   SET_TbufferMask3DFX(table, marshal_TbufferMask3DFX);
+   SET_CompressedTexImage3DARB(table, marshal_CompressedTexImage3DARB);
+   SET_CompressedTexImage2DARB(table, marshal_CompressedTexImage2DARB);
+   SET_CompressedTexImage1DARB(table, marshal_CompressedTexImage1DARB);
+   SET_CompressedTexSubImage3DARB(table, marshal_CompressedTexSubImage3DARB);
+   SET_CompressedTexSubImage2DARB(table, marshal_CompressedTexSubImage2DARB);
+   SET_CompressedTexSubImage1DARB(table, marshal_CompressedTexSubImage1DARB);
+   SET_GetCompressedTexImageARB(table, marshal_GetCompressedTexImageARB);
+   SET_SecondaryColor3bEXT(table, marshal_SecondaryColor3bEXT);
+   SET_SecondaryColor3bvEXT(table, marshal_SecondaryColor3bvEXT);
+   SET_SecondaryColor3dEXT(table, marshal_SecondaryColor3dEXT);
+   SET_SecondaryColor3dvEXT(table, marshal_SecondaryColor3dvEXT);
+   SET_SecondaryColor3fEXT(table, marshal_SecondaryColor3fEXT);
+   SET_SecondaryColor3fvEXT(table, marshal_SecondaryColor3fvEXT);
+   SET_SecondaryColor3iEXT(table, marshal_SecondaryColor3iEXT);
+   SET_SecondaryColor3ivEXT(table, marshal_SecondaryColor3ivEXT);
+   SET_SecondaryColor3sEXT(table, marshal_SecondaryColor3sEXT);
+   SET_SecondaryColor3svEXT(table, marshal_SecondaryColor3svEXT);
+   SET_SecondaryColor3ubEXT(table, marshal_SecondaryColor3ubEXT);
+   SET_SecondaryColor3ubvEXT(table, marshal_SecondaryColor3ubvEXT);
+   SET_SecondaryColor3uiEXT(table, marshal_SecondaryColor3uiEXT);
+   SET_SecondaryColor3uivEXT(table, marshal_SecondaryColor3uivEXT);
+   SET_SecondaryColor3usEXT(table, marshal_SecondaryColor3usEXT);
+   SET_SecondaryColor3usvEXT(table, marshal_SecondaryColor3usvEXT);
+   SET_SecondaryColorPointerEXT(table, marshal_SecondaryColorPointerEXT);
+   SET_AreProgramsResidentNV(table, marshal_AreProgramsResidentNV);
+   SET_BindProgramNV(table, marshal_BindProgramNV);
+   SET_DeleteProgramsNV(table, marshal_DeleteProgramsNV);
+   SET_ExecuteProgramNV(table, marshal_ExecuteProgramNV);
+   SET_GenProgramsNV(table, marshal_GenProgramsNV);
+   SET_GetProgramParameterdvNV(table, marshal_GetProgramParameterdvNV);
+   SET_GetProgramParameterfvNV(table, marshal_GetProgramParameterfvNV);
+   SET_GetProgramivNV(table, marshal_GetProgramivNV);
+   SET_GetProgramStringNV(table, marshal_GetProgramStringNV);
+   SET_GetTrackMatrixivNV(table, marshal_GetTrackMatrixivNV);
+   SET_GetVertexAttribdvARB(table, marshal_GetVertexAttribdvARB);
+   SET_GetVertexAttribfvARB(table, marshal_GetVertexAttribfvARB);
+   SET_GetVertexAttribivARB(table, marshal_GetVertexAttribivARB);
+   SET_GetVertexAttribPointervNV(table, marshal_GetVertexAttribPointervNV);
+   SET_IsProgramNV(table, marshal_IsProgramNV);
+   SET_LoadProgramNV(table, marshal_LoadProgramNV);
+   SET_ProgramParameter4dNV(table, marshal_ProgramParameter4dNV);
+   SET_ProgramParameter4dvNV(table, marshal_ProgramParameter4dvNV);
+   SET_ProgramParameter4fNV(table, marshal_ProgramParameter4fNV);
+   SET_ProgramParameter4fvNV(table, marshal_ProgramParameter4fvNV);
+   SET_ProgramParameters4dvNV(table, marshal_ProgramParameters4dvNV);
+   SET_ProgramParameters4fvNV(table, marshal_ProgramParameters4fvNV);
+   SET_RequestResidentProgramsNV(table, marshal_RequestResidentProgramsNV);
+   SET_TrackMatrixNV(table, marshal_TrackMatrixNV);
+   SET_VertexAttribPointerNV(table, marshal_VertexAttribPointerNV);
+   SET_VertexAttrib1dARB(table, marshal_VertexAttrib1dARB);
+   SET_VertexAttrib1dvARB(table, marshal_VertexAttrib1dvARB);
+   SET_VertexAttrib1fARB(table, marshal_VertexAttrib1fARB);
+   SET_VertexAttrib1fvARB(table, marshal_VertexAttrib1fvARB);
+   SET_VertexAttrib1sARB(table, marshal_VertexAttrib1sARB);
+   SET_VertexAttrib1svARB(table, marshal_VertexAttrib1svARB);
+   SET_VertexAttrib2dARB(table, marshal_VertexAttrib2dARB);
+   SET_VertexAttrib2dvARB(table, marshal_VertexAttrib2dvARB);
+   SET_VertexAttrib2fARB(table, marshal_VertexAttrib2fARB);
+   SET_VertexAttrib2fvARB(table, marshal_VertexAttrib2fvARB);
+   SET_VertexAttrib2sARB(table, marshal_VertexAttrib2sARB);
+   SET_VertexAttrib2svARB(table, marshal_VertexAttrib2svARB);
+   SET_VertexAttrib3dARB(table, marshal_VertexAttrib3dARB);
+   SET_VertexAttrib3dvARB(table, marshal_VertexAttrib3dvARB);
+   SET_VertexAttrib3fARB(table, marshal_VertexAttrib3fARB);
+   SET_VertexAttrib3fvARB(table, marshal_VertexAttrib3fvARB);
+   SET_VertexAttrib3sARB(table, marshal_VertexAttrib3sARB);
+   SET_VertexAttrib3svARB(table, marshal_VertexAttrib3svARB);
+   SET_VertexAttrib4dARB(table, marshal_VertexAttrib4dARB);
+   SET_VertexAttrib4dvARB(table, marshal_VertexAttrib4dvARB);
+   SET_VertexAttrib4fARB(table, marshal_VertexAttrib4fARB);
+   SET_VertexAttrib4fvARB(table, marshal_VertexAttrib4fvARB);
+   SET_VertexAttrib4sARB(table, marshal_VertexAttrib4sARB);
+   SET_VertexAttrib4svARB(table, marshal_VertexAttrib4svARB);
+   SET_VertexAttrib4NubARB(table, marshal_VertexAttrib4NubARB);
+   SET_VertexAttrib4NubvARB(table, marshal_VertexAttrib4NubvARB);
+   SET_VertexAttribs1dvNV(table, marshal_VertexAttribs1dvNV);
+   SET_VertexAttribs1fvNV(table, marshal_VertexAttribs1fvNV);
+   SET_VertexAttribs1svNV(table, marshal_VertexAttribs1svNV);
+   SET_VertexAttribs2dvNV(table, marshal_VertexAttribs2dvNV);
+   SET_VertexAttribs2fvNV(table, marshal_VertexAttribs2fvNV);
+   SET_VertexAttribs2svNV(table, marshal_VertexAttribs2svNV);
+   SET_VertexAttribs3dvNV(table, marshal_VertexAttribs3dvNV);
+   SET_VertexAttribs3fvNV(table, marshal_VertexAttribs3fvNV);
+   SET_VertexAttribs3svNV(table, marshal_VertexAttribs3svNV);
+   SET_VertexAttribs4dvNV(table, marshal_VertexAttribs4dvNV);
+   SET_VertexAttribs4fvNV(table, marshal_VertexAttribs4fvNV);
+   SET_VertexAttribs4svNV(table, marshal_VertexAttribs4svNV);
+   SET_VertexAttribs4ubvNV(table, marshal_VertexAttribs4ubvNV);
+   SET_PointParameteriNV(table, marshal_PointParameteriNV);
+   SET_PointParameterivNV(table, marshal_PointParameterivNV);
+   SET_MultiDrawArraysEXT(table, marshal_MultiDrawArraysEXT);
+   SET_MultiDrawElementsEXT(table, marshal_MultiDrawElementsEXT);
+   SET_ActiveStencilFaceEXT(table, marshal_ActiveStencilFaceEXT);
+   SET_DeleteFencesNV(table, marshal_DeleteFencesNV);
+   SET_GenFencesNV(table, marshal_GenFencesNV);
+   SET_IsFenceNV(table, marshal_IsFenceNV);
+   SET_TestFenceNV(table, marshal_TestFenceNV);
+   SET_GetFenceivNV(table, marshal_GetFenceivNV);
+   SET_FinishFenceNV(table, marshal_FinishFenceNV);
+   SET_SetFenceNV(table, marshal_SetFenceNV);
+   SET_VertexAttrib4bvARB(table, marshal_VertexAttrib4bvARB);
+   SET_VertexAttrib4ivARB(table, marshal_VertexAttrib4ivARB);
+   SET_VertexAttrib4ubvARB(table, marshal_VertexAttrib4ubvARB);
+   SET_VertexAttrib4usvARB(table, marshal_VertexAttrib4usvARB);
+   SET_VertexAttrib4uivARB(table, marshal_VertexAttrib4uivARB);
+   SET_VertexAttrib4NbvARB(table, marshal_VertexAttrib4NbvARB);
+   SET_VertexAttrib4NsvARB(table, marshal_VertexAttrib4NsvARB);
+   SET_VertexAttrib4NivARB(table, marshal_VertexAttrib4NivARB);
+   SET_VertexAttrib4NusvARB(table, marshal_VertexAttrib4NusvARB);
+   SET_VertexAttrib4NuivARB(table, marshal_VertexAttrib4NuivARB);
+   SET_VertexAttribPointerARB(table, marshal_VertexAttribPointerARB);
+   SET_EnableVertexAttribArrayARB(table, marshal_EnableVertexAttribArrayARB);
+   SET_DisableVertexAttribArrayARB(table, marshal_DisableVertexAttribArrayARB);
+   SET_ProgramStringARB(table, marshal_ProgramStringARB);
+   SET_ProgramEnvParameter4dARB(table, marshal_ProgramEnvParameter4dARB);
+   SET_ProgramEnvParameter4dvARB(table, marshal_ProgramEnvParameter4dvARB);
+   SET_ProgramEnvParameter4fARB(table, marshal_ProgramEnvParameter4fARB);
+   SET_ProgramEnvParameter4fvARB(table, marshal_ProgramEnvParameter4fvARB);
+   SET_ProgramLocalParameter4dARB(table, marshal_ProgramLocalParameter4dARB);
+   SET_ProgramLocalParameter4dvARB(table, marshal_ProgramLocalParameter4dvARB);
+   SET_ProgramLocalParameter4fARB(table, marshal_ProgramLocalParameter4fARB);
+   SET_ProgramLocalParameter4fvARB(table, marshal_ProgramLocalParameter4fvARB);
+   SET_GetProgramEnvParameterdvARB(table, marshal_GetProgramEnvParameterdvARB);
+   SET_GetProgramEnvParameterfvARB(table, marshal_GetProgramEnvParameterfvARB);
+   SET_GetProgramLocalParameterdvARB(table, marshal_GetProgramLocalParameterdvARB);
+   SET_GetProgramLocalParameterfvARB(table, marshal_GetProgramLocalParameterfvARB);
+   SET_GetProgramivARB(table, marshal_GetProgramivARB);
+   SET_GetProgramStringARB(table, marshal_GetProgramStringARB);
+   SET_ProgramNamedParameter4fNV(table, marshal_ProgramNamedParameter4fNV);
+   SET_ProgramNamedParameter4dNV(table, marshal_ProgramNamedParameter4dNV);
+   SET_ProgramNamedParameter4fvNV(table, marshal_ProgramNamedParameter4fvNV);
+   SET_ProgramNamedParameter4dvNV(table, marshal_ProgramNamedParameter4dvNV);
+   SET_GetProgramNamedParameterfvNV(table, marshal_GetProgramNamedParameterfvNV);
+   SET_GetProgramNamedParameterdvNV(table, marshal_GetProgramNamedParameterdvNV);
+   SET_BindBufferARB(table, marshal_BindBufferARB);
+   SET_BufferDataARB(table, marshal_BufferDataARB);
+   SET_BufferSubDataARB(table, marshal_BufferSubDataARB);
+   SET_DeleteBuffersARB(table, marshal_DeleteBuffersARB);
+   SET_GenBuffersARB(table, marshal_GenBuffersARB);
+   SET_GetBufferParameterivARB(table, marshal_GetBufferParameterivARB);
+   SET_GetBufferPointervARB(table, marshal_GetBufferPointervARB);
+   SET_GetBufferSubDataARB(table, marshal_GetBufferSubDataARB);
+   SET_IsBufferARB(table, marshal_IsBufferARB);
+   SET_MapBufferARB(table, marshal_MapBufferARB);
+   SET_UnmapBufferARB(table, marshal_UnmapBufferARB);
+   SET_DepthBoundsEXT(table, marshal_DepthBoundsEXT);
+   SET_GenQueriesARB(table, marshal_GenQueriesARB);
+   SET_DeleteQueriesARB(table, marshal_DeleteQueriesARB);
+   SET_IsQueryARB(table, marshal_IsQueryARB);
+   SET_BeginQueryARB(table, marshal_BeginQueryARB);
+   SET_EndQueryARB(table, marshal_EndQueryARB);
+   SET_GetQueryivARB(table, marshal_GetQueryivARB);
+   SET_GetQueryObjectivARB(table, marshal_GetQueryObjectivARB);
+   SET_GetQueryObjectuivARB(table, marshal_GetQueryObjectuivARB);
+   SET_MultiModeDrawArraysIBM(table, marshal_MultiModeDrawArraysIBM);
+   SET_MultiModeDrawElementsIBM(table, marshal_MultiModeDrawElementsIBM);
+   SET_BlendEquationSeparateEXT(table, marshal_BlendEquationSeparateEXT);
+   SET_DeleteObjectARB(table, marshal_DeleteObjectARB);
+   SET_GetHandleARB(table, marshal_GetHandleARB);
+   SET_DetachObjectARB(table, marshal_DetachObjectARB);
+   SET_CreateShaderObjectARB(table, marshal_CreateShaderObjectARB);
+   SET_ShaderSourceARB(table, marshal_ShaderSourceARB);
+   SET_CompileShaderARB(table, marshal_CompileShaderARB);
+   SET_CreateProgramObjectARB(table, marshal_CreateProgramObjectARB);
+   SET_AttachObjectARB(table, marshal_AttachObjectARB);
+   SET_LinkProgramARB(table, marshal_LinkProgramARB);
+   SET_UseProgramObjectARB(table, marshal_UseProgramObjectARB);
+   SET_ValidateProgramARB(table, marshal_ValidateProgramARB);
+   SET_Uniform1fARB(table, marshal_Uniform1fARB);
+   SET_Uniform2fARB(table, marshal_Uniform2fARB);
+   SET_Uniform3fARB(table, marshal_Uniform3fARB);
+   SET_Uniform4fARB(table, marshal_Uniform4fARB);
+   SET_Uniform1iARB(table, marshal_Uniform1iARB);
+   SET_Uniform2iARB(table, marshal_Uniform2iARB);
+   SET_Uniform3iARB(table, marshal_Uniform3iARB);
+   SET_Uniform4iARB(table, marshal_Uniform4iARB);
+   SET_Uniform1fvARB(table, marshal_Uniform1fvARB);
+   SET_Uniform2fvARB(table, marshal_Uniform2fvARB);
+   SET_Uniform3fvARB(table, marshal_Uniform3fvARB);
+   SET_Uniform4fvARB(table, marshal_Uniform4fvARB);
+   SET_Uniform1ivARB(table, marshal_Uniform1ivARB);
+   SET_Uniform2ivARB(table, marshal_Uniform2ivARB);
+   SET_Uniform3ivARB(table, marshal_Uniform3ivARB);
+   SET_Uniform4ivARB(table, marshal_Uniform4ivARB);
+   SET_UniformMatrix2fvARB(table, marshal_UniformMatrix2fvARB);
+   SET_UniformMatrix3fvARB(table, marshal_UniformMatrix3fvARB);
+   SET_UniformMatrix4fvARB(table, marshal_UniformMatrix4fvARB);
+   SET_GetObjectParameterfvARB(table, marshal_GetObjectParameterfvARB);
+   SET_GetObjectParameterivARB(table, marshal_GetObjectParameterivARB);
+   SET_GetInfoLogARB(table, marshal_GetInfoLogARB);
+   SET_GetAttachedObjectsARB(table, marshal_GetAttachedObjectsARB);
+   SET_GetUniformLocationARB(table, marshal_GetUniformLocationARB);
+   SET_GetActiveUniformARB(table, marshal_GetActiveUniformARB);
+   SET_GetUniformfvARB(table, marshal_GetUniformfvARB);
+   SET_GetUniformivARB(table, marshal_GetUniformivARB);
+   SET_GetShaderSourceARB(table, marshal_GetShaderSourceARB);
+   SET_BindAttribLocationARB(table, marshal_BindAttribLocationARB);
+   SET_GetActiveAttribARB(table, marshal_GetActiveAttribARB);
+   SET_GetAttribLocationARB(table, marshal_GetAttribLocationARB);
+   SET_GetVertexAttribdvNV(table, marshal_GetVertexAttribdvNV);
+   SET_GetVertexAttribfvNV(table, marshal_GetVertexAttribfvNV);
+   SET_GetVertexAttribivNV(table, marshal_GetVertexAttribivNV);
+   SET_VertexAttrib1dNV(table, marshal_VertexAttrib1dNV);
+   SET_VertexAttrib1dvNV(table, marshal_VertexAttrib1dvNV);
+   SET_VertexAttrib1fNV(table, marshal_VertexAttrib1fNV);
+   SET_VertexAttrib1fvNV(table, marshal_VertexAttrib1fvNV);
+   SET_VertexAttrib1sNV(table, marshal_VertexAttrib1sNV);
+   SET_VertexAttrib1svNV(table, marshal_VertexAttrib1svNV);
+   SET_VertexAttrib2dNV(table, marshal_VertexAttrib2dNV);
+   SET_VertexAttrib2dvNV(table, marshal_VertexAttrib2dvNV);
+   SET_VertexAttrib2fNV(table, marshal_VertexAttrib2fNV);
+   SET_VertexAttrib2fvNV(table, marshal_VertexAttrib2fvNV);
+   SET_VertexAttrib2sNV(table, marshal_VertexAttrib2sNV);
+   SET_VertexAttrib2svNV(table, marshal_VertexAttrib2svNV);
+   SET_VertexAttrib3dNV(table, marshal_VertexAttrib3dNV);
+   SET_VertexAttrib3dvNV(table, marshal_VertexAttrib3dvNV);
+   SET_VertexAttrib3fNV(table, marshal_VertexAttrib3fNV);
+   SET_VertexAttrib3fvNV(table, marshal_VertexAttrib3fvNV);
+   SET_VertexAttrib3sNV(table, marshal_VertexAttrib3sNV);
+   SET_VertexAttrib3svNV(table, marshal_VertexAttrib3svNV);
+   SET_VertexAttrib4dNV(table, marshal_VertexAttrib4dNV);
+   SET_VertexAttrib4dvNV(table, marshal_VertexAttrib4dvNV);
+   SET_VertexAttrib4fNV(table, marshal_VertexAttrib4fNV);
+   SET_VertexAttrib4fvNV(table, marshal_VertexAttrib4fvNV);
+   SET_VertexAttrib4sNV(table, marshal_VertexAttrib4sNV);
+   SET_VertexAttrib4svNV(table, marshal_VertexAttrib4svNV);
+   SET_VertexAttrib4ubNV(table, marshal_VertexAttrib4ubNV);
+   SET_VertexAttrib4ubvNV(table, marshal_VertexAttrib4ubvNV);
+   SET_GenFragmentShadersATI(table, marshal_GenFragmentShadersATI);
+   SET_BindFragmentShaderATI(table, marshal_BindFragmentShaderATI);
+   SET_DeleteFragmentShaderATI(table, marshal_DeleteFragmentShaderATI);
+   SET_BeginFragmentShaderATI(table, marshal_BeginFragmentShaderATI);
+   SET_EndFragmentShaderATI(table, marshal_EndFragmentShaderATI);
+   SET_PassTexCoordATI(table, marshal_PassTexCoordATI);
+   SET_SampleMapATI(table, marshal_SampleMapATI);
+   SET_ColorFragmentOp1ATI(table, marshal_ColorFragmentOp1ATI);
+   SET_ColorFragmentOp2ATI(table, marshal_ColorFragmentOp2ATI);
+   SET_ColorFragmentOp3ATI(table, marshal_ColorFragmentOp3ATI);
+   SET_AlphaFragmentOp1ATI(table, marshal_AlphaFragmentOp1ATI);
+   SET_AlphaFragmentOp2ATI(table, marshal_AlphaFragmentOp2ATI);
+   SET_AlphaFragmentOp3ATI(table, marshal_AlphaFragmentOp3ATI);
+   SET_SetFragmentShaderConstantATI(table, marshal_SetFragmentShaderConstantATI);
+   SET_IsRenderbufferEXT(table, marshal_IsRenderbufferEXT);
+   SET_BindRenderbufferEXT(table, marshal_BindRenderbufferEXT);
+   SET_DeleteRenderbuffersEXT(table, marshal_DeleteRenderbuffersEXT);
+   SET_GenRenderbuffersEXT(table, marshal_GenRenderbuffersEXT);
+   SET_RenderbufferStorageEXT(table, marshal_RenderbufferStorageEXT);
+   SET_GetRenderbufferParameterivEXT(table, marshal_GetRenderbufferParameterivEXT);
+   SET_IsFramebufferEXT(table, marshal_IsFramebufferEXT);
+   SET_BindFramebufferEXT(table, marshal_BindFramebufferEXT);
+   SET_DeleteFramebuffersEXT(table, marshal_DeleteFramebuffersEXT);
+   SET_GenFramebuffersEXT(table, marshal_GenFramebuffersEXT);
+   SET_CheckFramebufferStatusEXT(table, marshal_CheckFramebufferStatusEXT);
+   SET_FramebufferTexture1DEXT(table, marshal_FramebufferTexture1DEXT);
+   SET_FramebufferTexture2DEXT(table, marshal_FramebufferTexture2DEXT);
+   SET_FramebufferTexture3DEXT(table, marshal_FramebufferTexture3DEXT);
+   SET_FramebufferRenderbufferEXT(table, marshal_FramebufferRenderbufferEXT);
+   SET_GetFramebufferAttachmentParameterivEXT(table, marshal_GetFramebufferAttachmentParameterivEXT);
+   SET_GenerateMipmapEXT(table, marshal_GenerateMipmapEXT);
+   SET_StencilFuncSeparate(table, marshal_StencilFuncSeparate);
+   SET_StencilOpSeparate(table, marshal_StencilOpSeparate);
+   SET_StencilMaskSeparate(table, marshal_StencilMaskSeparate);
+}
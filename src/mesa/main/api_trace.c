@@ -0,0 +1,1022 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/**
+ * \file api_trace.c
+ * Recording of the GL call stream into a file, for progs/trace/glreplay.
+ *
+ * With MESA_TRACE=<file> in the environment, the contexts the drivers
+ * create (see _mesa_trace_init()) dispatch to the tracing table while
+ * they are current.  Its functions, generated into api_trace_tmp.h by
+ * glapi/gl_trace.py, append the call and its parameters to the file and
+ * then call the real function.  Client memory read by the call is stored
+ * with it: images according to the unpack state, the used elements of
+ * the client vertex arrays before each draw, and so on.  Mapped buffer
+ * objects are stored when they are unmapped.  The file format is
+ * described in gl_trace.py.
+ *
+ * Calls are serialized by one mutex, held while the real function runs,
+ * so the trace of several threads is still in execution order.  GL calls
+ * Mesa makes to itself through the dispatch table while the mutex is
+ * held (loopback and array element functions) aren't recorded.
+ */
+
+
+#include "glheader.h"
+#include "api_marshal.h"
+#include "api_trace.h"
+#include "bufferobj.h"
+#include "context.h"
+#include "dispatch.h"
+#include "eval.h"
+#include "glapi.h"
+#include "glthread.h"
+#include "image.h"
+#include "imports.h"
+#include "macros.h"
+#include "mtypes.h"
+
+
+/* the record layout and the call names */
+#include "api_trace_tmp.h"
+
+
+#define TRACE_BUFFER_SIZE  (64 * 1024)  /**< file writes, in bytes */
+#define MAX_TRACE_CONTEXTS 64
+#define NO_RECORD          (~0U)
+
+
+/** Traced contexts; TraceId is the index plus one */
+static struct {
+   GLcontext *ctx;
+   GLsizei Width, Height;    /**< size of the drawable */
+} TraceContexts[MAX_TRACE_CONTEXTS];
+
+static FILE *TraceFile = NULL;
+static GLboolean TraceFailed = GL_FALSE;
+static struct _glapi_table *TraceTable = NULL;
+
+/* The mutex protects everything below.  TraceOwner is the thread which
+ * holds it, while TraceBusy is set.
+ */
+_glthread_DECLARE_STATIC_MUTEX(TraceMutex);
+static GLboolean TraceBusy = GL_FALSE;
+static unsigned long TraceOwner = 0;
+
+static GLcontext *TraceCurrent = NULL;   /**< context of the last record */
+
+static GLubyte *TraceBuffer = NULL;      /**< records not written yet */
+static GLuint TraceBufferSize = 0;
+static GLuint TraceUsed = 0;
+static GLuint TraceRecordStart = NO_RECORD;
+static GLboolean TraceFlush = GL_FALSE;
+
+
+/**
+ * Stop tracing after an error.  The records written so far stay usable.
+ */
+static void
+trace_fail( const char *why )
+{
+   fprintf(stderr, "Mesa: tracing stopped, %s\n", why);
+   TraceFailed = GL_TRUE;
+}
+
+
+static GLboolean
+trace_reserve( GLuint bytes )
+{
+   if (TraceFailed)
+      return GL_FALSE;
+   if (TraceUsed + bytes > TraceBufferSize) {
+      GLuint size = MAX2(TraceBufferSize, TRACE_BUFFER_SIZE);
+      GLubyte *buffer;
+      while (size < TraceUsed + bytes)
+         size *= 2;
+      buffer = (GLubyte *) _mesa_realloc(TraceBuffer, TraceBufferSize, size);
+      if (!buffer) {
+         trace_fail("out of memory");
+         return GL_FALSE;
+      }
+      TraceBuffer = buffer;
+      TraceBufferSize = size;
+   }
+   return GL_TRUE;
+}
+
+
+static void
+trace_write( const void *data, GLuint bytes )
+{
+   if (trace_reserve(bytes)) {
+      MEMCPY(TraceBuffer + TraceUsed, data, bytes);
+      TraceUsed += bytes;
+   }
+}
+
+
+/**
+ * Pad to a multiple of 8 bytes.  The buffer always starts at such an
+ * offset into the file.
+ */
+static void
+trace_pad( void )
+{
+   if (trace_reserve(8)) {
+      while (TraceUsed & 7)
+         TraceBuffer[TraceUsed++] = 0;
+   }
+}
+
+
+static void
+trace_end_record( void )
+{
+   if (TraceRecordStart != NO_RECORD) {
+      trace_pad();
+      if (!TraceFailed) {
+         struct trace_record *rec =
+            (struct trace_record *) (TraceBuffer + TraceRecordStart);
+         rec->size = TraceUsed - TraceRecordStart - sizeof(*rec);
+      }
+      TraceRecordStart = NO_RECORD;
+   }
+}
+
+
+static void
+trace_record( GLuint id )
+{
+   struct trace_record rec;
+
+   trace_end_record();
+   rec.id = (GLushort) id;
+   rec.pad = 0;
+   rec.size = 0;
+   TraceRecordStart = TraceUsed;
+   trace_write(&rec, sizeof(rec));
+}
+
+
+/**
+ * Store the client memory a pointer parameter points to.
+ */
+static void
+trace_array( const void *ptr, GLuint bytes )
+{
+   if (!ptr || bytes == TRACE_RAW) {
+      const trace_uint64 value = (trace_uint64) (size_t) ptr;
+      bytes = TRACE_RAW;
+      trace_write(&bytes, sizeof(bytes));
+      trace_pad();
+      trace_write(&value, sizeof(value));
+   }
+   else {
+      trace_write(&bytes, sizeof(bytes));
+      trace_pad();
+      trace_write(ptr, bytes);
+   }
+}
+
+
+/**
+ * Store the size of the memory an output parameter points to.
+ */
+static void
+trace_output( const void *ptr, GLuint bytes )
+{
+   if (!ptr || bytes == TRACE_RAW)
+      trace_array(ptr, TRACE_RAW);
+   else
+      trace_write(&bytes, sizeof(bytes));
+}
+
+
+/**
+ * Write the buffer to the file when the mutex is released.
+ */
+static void
+trace_flush( void )
+{
+   TraceFlush = GL_TRUE;
+}
+
+
+static void
+trace_write_file( void )
+{
+   if (TraceUsed > 0 && !TraceFailed) {
+      if (fwrite(TraceBuffer, 1, TraceUsed, TraceFile) != TraceUsed)
+         trace_fail("can't write the trace file");
+   }
+   if (TraceFlush && !TraceFailed)
+      fflush(TraceFile);
+   TraceUsed = 0;
+   TraceFlush = GL_FALSE;
+
+   /* don't keep the memory of a big image around */
+   if (TraceBufferSize > 4 * TRACE_BUFFER_SIZE) {
+      _mesa_free(TraceBuffer);
+      TraceBuffer = NULL;
+      TraceBufferSize = 0;
+   }
+}
+
+
+/**
+ * Record which context the following records are for, and the size of
+ * its drawable.
+ */
+static void
+trace_context( GLcontext *ctx )
+{
+   const GLuint id = ctx->TraceId;
+   const GLuint rgb = ctx->Visual.rgbMode;
+   const GLuint width = TraceContexts[id - 1].Width;
+   const GLuint height = TraceContexts[id - 1].Height;
+
+   trace_record(TRACE_CONTEXT);
+   trace_write(&id, sizeof(id));
+   trace_write(&rgb, sizeof(rgb));
+   trace_write(&ctx->Visual.depthBits, sizeof(GLint));
+   trace_write(&ctx->Visual.stencilBits, sizeof(GLint));
+   trace_write(&ctx->Visual.accumRedBits, sizeof(GLint));
+   trace_write(&width, sizeof(width));
+   trace_write(&height, sizeof(height));
+   trace_end_record();
+   TraceCurrent = ctx;
+}
+
+
+/**
+ * Is the mutex held by this thread?
+ */
+static INLINE GLboolean
+trace_owned( void )
+{
+   return TraceBusy && TraceOwner == _glthread_GetID();
+}
+
+
+/**
+ * Take the mutex before recording a call.
+ * Return:  GL_FALSE if the call must not be recorded: Mesa is calling
+ *          itself while executing a recorded call, or tracing failed.
+ */
+static GLboolean
+trace_lock( GLcontext *ctx )
+{
+   const GLframebuffer *fb = ctx->WinSysDrawBuffer;
+
+   if (!ctx->TraceId || trace_owned())
+      return GL_FALSE;
+
+   _glthread_LOCK_MUTEX(TraceMutex);
+   if (TraceFailed) {
+      _glthread_UNLOCK_MUTEX(TraceMutex);
+      return GL_FALSE;
+   }
+   TraceOwner = _glthread_GetID();
+   TraceBusy = GL_TRUE;
+
+   /* window-system drawables may be resized at any time */
+   if (fb && !fb->Tiled) {
+      GLsizei *size = &TraceContexts[ctx->TraceId - 1].Width;
+      if (size[0] != (GLsizei) fb->Width || size[1] != (GLsizei) fb->Height) {
+         TraceContexts[ctx->TraceId - 1].Width = fb->Width;
+         TraceContexts[ctx->TraceId - 1].Height = fb->Height;
+         TraceCurrent = NULL;
+      }
+   }
+   if (ctx != TraceCurrent)
+      trace_context(ctx);
+   return GL_TRUE;
+}
+
+
+static void
+trace_unlock( void )
+{
+   trace_end_record();
+   if (TraceUsed >= TRACE_BUFFER_SIZE || TraceFlush)
+      trace_write_file();
+   TraceBusy = GL_FALSE;
+   _glthread_UNLOCK_MUTEX(TraceMutex);
+}
+
+
+/**
+ * glNewList, glEndList, glCallList(s) set the dispatch table of the
+ * current thread to ctx->CurrentDispatch, and so do glFlush and glFinish
+ * when OSMesa starts recording the next tiled frame.
+ */
+static void
+trace_restore_dispatch( GLcontext *ctx )
+{
+   if (ctx->TraceId && _glapi_get_dispatch() != TraceTable)
+      _glapi_set_dispatch(TraceTable);
+}
+
+
+/*
+ * Byte counts of the pointer parameters, used by api_trace_tmp.h.
+ */
+
+static GLuint
+count_bytes( GLint count, GLuint size )
+{
+   return count > 0 ? count * size : 0;
+}
+
+
+static GLuint
+image_bytes( const struct gl_pixelstore_attrib *packing, GLuint dims,
+             GLsizei width, GLsizei height, GLsizei depth,
+             GLenum format, GLenum type, const GLvoid *pixels )
+{
+   GLint rowBytes;
+   const GLubyte *last;
+
+   if (!pixels || packing->BufferObj->Name)
+      return TRACE_RAW;  /* offset into a pixel buffer object */
+   if (width <= 0 || height <= 0 || depth <= 0)
+      return 0;
+
+   if (type == GL_BITMAP) {
+      rowBytes = (width + packing->SkipPixels % 8 + 7) / 8;
+   }
+   else {
+      const GLint bpp = _mesa_bytes_per_pixel(format, type);
+      if (bpp <= 0)
+         return 0;
+      rowBytes = width * bpp;
+   }
+
+   last = (const GLubyte *) _mesa_image_address(dims, packing, pixels,
+                                                width, height, format, type,
+                                                depth - 1, height - 1, 0);
+   if (!last)
+      return 0;
+   return (GLuint) (last - (const GLubyte *) pixels) + rowBytes;
+}
+
+
+static GLuint
+compressed_bytes( GLcontext *ctx, GLsizei imageSize, const GLvoid *data )
+{
+   if (!data || ctx->Unpack.BufferObj->Name)
+      return TRACE_RAW;
+   return count_bytes(imageSize, 1);
+}
+
+
+static GLuint
+buffer_bytes( GLsizeiptrARB size, const GLvoid *data )
+{
+   if (!data)
+      return TRACE_RAW;
+   return size > 0 ? (GLuint) size : 0;
+}
+
+
+static GLuint
+list_bytes( GLsizei n, GLenum type )
+{
+   switch (type) {
+   case GL_BYTE:
+   case GL_UNSIGNED_BYTE:
+      return count_bytes(n, 1);
+   case GL_SHORT:
+   case GL_UNSIGNED_SHORT:
+   case GL_2_BYTES:
+      return count_bytes(n, 2);
+   case GL_3_BYTES:
+      return count_bytes(n, 3);
+   case GL_INT:
+   case GL_UNSIGNED_INT:
+   case GL_FLOAT:
+   case GL_4_BYTES:
+      return count_bytes(n, 4);
+   default:
+      return 0;
+   }
+}
+
+
+static GLuint
+index_size( GLenum type )
+{
+   switch (type) {
+   case GL_UNSIGNED_BYTE:
+      return sizeof(GLubyte);
+   case GL_UNSIGNED_SHORT:
+      return sizeof(GLushort);
+   case GL_UNSIGNED_INT:
+      return sizeof(GLuint);
+   default:
+      return 0;
+   }
+}
+
+
+static GLuint
+element_bytes( GLcontext *ctx, GLsizei count, GLenum type,
+               const GLvoid *indices )
+{
+   if (ctx->Array.ElementArrayBufferObj->Name)
+      return TRACE_RAW;
+   (void) indices;
+   return count_bytes(count, index_size(type));
+}
+
+
+static GLuint
+map1_bytes( GLenum target, GLint stride, GLint order, GLuint size )
+{
+   const GLint k = _mesa_evaluator_components(target);
+   if (k == 0 || stride < k || order < 1)
+      return 0;
+   return ((order - 1) * stride + k) * size;
+}
+
+
+static GLuint
+map2_bytes( GLenum target, GLint ustride, GLint uorder,
+            GLint vstride, GLint vorder, GLuint size )
+{
+   const GLint k = _mesa_evaluator_components(target);
+   if (k == 0 || ustride < k || vstride < k || uorder < 1 || vorder < 1)
+      return 0;
+   return ((uorder - 1) * ustride + (vorder - 1) * vstride + k) * size;
+}
+
+
+static GLuint
+color_table_parameter_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_COLOR_TABLE_SCALE_SGI:
+   case GL_COLOR_TABLE_BIAS_SGI:
+      return 4;
+   default:
+      return 0;
+   }
+}
+
+
+static GLuint
+convolution_parameter_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_CONVOLUTION_BORDER_COLOR:
+   case GL_CONVOLUTION_FILTER_SCALE:
+   case GL_CONVOLUTION_FILTER_BIAS:
+      return 4;
+   case GL_CONVOLUTION_BORDER_MODE:
+      return 1;
+   default:
+      return 0;
+   }
+}
+
+
+static GLuint
+point_parameter_count( GLenum pname )
+{
+   return pname == GL_DISTANCE_ATTENUATION_EXT ? 3 : 1;
+}
+
+
+static GLuint
+combiner_parameter_count( GLenum pname )
+{
+   switch (pname) {
+   case GL_CONSTANT_COLOR0_NV:
+   case GL_CONSTANT_COLOR1_NV:
+      return 4;
+   default:
+      return 1;
+   }
+}
+
+
+
+/*
+ * Vertex arrays.  Mesa's array state is recorded whenever a glXPointer
+ * function changes it; each draw call first records the elements it
+ * reads from client memory.  The replayer keeps one buffer per array
+ * slot, so its pointers never change in glBegin/glEnd.
+ */
+
+struct trace_array_state {
+   struct trace_array_pointer slot[TRACE_ARRAY_SLOTS];
+};
+
+
+static struct gl_client_array *
+get_client_array( GLcontext *ctx, GLuint slot )
+{
+   switch (slot) {
+   case TRACE_ARRAY_VERTEX:
+      return &ctx->Array.Vertex;
+   case TRACE_ARRAY_NORMAL:
+      return &ctx->Array.Normal;
+   case TRACE_ARRAY_COLOR:
+      return &ctx->Array.Color;
+   case TRACE_ARRAY_SECONDARY_COLOR:
+      return &ctx->Array.SecondaryColor;
+   case TRACE_ARRAY_FOG_COORD:
+      return &ctx->Array.FogCoord;
+   case TRACE_ARRAY_INDEX:
+      return &ctx->Array.Index;
+   case TRACE_ARRAY_EDGE_FLAG:
+      return &ctx->Array.EdgeFlag;
+   default:
+      if (slot >= TRACE_ARRAY_TEX_COORD &&
+          slot < TRACE_ARRAY_TEX_COORD + MAX_TEXTURE_COORD_UNITS)
+         return &ctx->Array.TexCoord[slot - TRACE_ARRAY_TEX_COORD];
+      if (slot >= TRACE_ARRAY_ATTRIB &&
+          slot < TRACE_ARRAY_ATTRIB + VERT_ATTRIB_MAX)
+         return &ctx->Array.VertexAttrib[slot - TRACE_ARRAY_ATTRIB];
+      return NULL;
+   }
+}
+
+
+static INLINE GLboolean
+is_client_array( const struct gl_client_array *array )
+{
+   return array->Enabled && array->Ptr &&
+          (!array->BufferObj || array->BufferObj->Name == 0);
+}
+
+
+static void
+trace_save_arrays( GLcontext *ctx, struct trace_array_state *state )
+{
+   GLuint i;
+
+   _mesa_bzero(state, sizeof(*state));
+   for (i = 0; i < TRACE_ARRAY_SLOTS; i++) {
+      const struct gl_client_array *array = get_client_array(ctx, i);
+      struct trace_array_pointer *p = &state->slot[i];
+      if (!array)
+         continue;
+      p->slot = i;
+      p->enabled = array->Enabled ? 1 : 0;
+      p->size = array->Size;
+      p->type = array->Type;
+      p->stride = array->StrideB;
+      p->normalized = array->Normalized;
+      p->buffer = array->BufferObj ? array->BufferObj->Name : 0;
+      p->pointer = (trace_uint64) (size_t) array->Ptr;
+   }
+}
+
+
+/**
+ * Record the arrays a glXPointer function has changed.  The replayer
+ * only uses the pointer of arrays in buffer objects.
+ */
+static void
+trace_arrays_changed( GLcontext *ctx, const struct trace_array_state *before )
+{
+   struct trace_array_state after;
+   GLuint i;
+
+   trace_save_arrays(ctx, &after);
+   for (i = 0; i < TRACE_ARRAY_SLOTS; i++) {
+      struct trace_array_pointer *p = &after.slot[i];
+      if (memcmp(p, &before->slot[i], sizeof(*p)) != 0) {
+         p->client_unit = ctx->Array.ActiveTexture;
+         trace_record(TRACE_ARRAY_POINTER);
+         trace_write(p, sizeof(*p));
+      }
+   }
+}
+
+
+/**
+ * Record elements [start, end) of the enabled client arrays.
+ */
+static void
+trace_client_arrays( GLcontext *ctx, GLint start, GLint end )
+{
+   GLuint i;
+
+   if (start < 0 || end <= start)
+      return;
+
+   for (i = 0; i < TRACE_ARRAY_SLOTS; i++) {
+      const struct gl_client_array *array = get_client_array(ctx, i);
+      GLint elemBytes;
+      GLuint offset;
+      if (!array || !is_client_array(array))
+         continue;
+      elemBytes = array->Size * _mesa_sizeof_type(array->Type);
+      if (elemBytes <= 0)
+         continue;
+      offset = start * array->StrideB;
+      trace_record(TRACE_ARRAY_DATA);
+      trace_write(&i, sizeof(i));
+      trace_write(&offset, sizeof(offset));
+      trace_array(array->Ptr + offset,
+                  (end - start - 1) * array->StrideB + elemBytes);
+   }
+}
+
+
+static GLboolean
+has_client_arrays( GLcontext *ctx )
+{
+   GLuint i;
+   for (i = 0; i < TRACE_ARRAY_SLOTS; i++) {
+      const struct gl_client_array *array = get_client_array(ctx, i);
+      if (array && is_client_array(array))
+         return GL_TRUE;
+   }
+   return GL_FALSE;
+}
+
+
+/**
+ * Record the elements of the client arrays glDrawElements reads.
+ */
+static void
+trace_element_arrays( GLcontext *ctx, GLsizei count, GLenum type,
+                      const GLvoid *indices )
+{
+   struct gl_buffer_object *bufObj = ctx->Array.ElementArrayBufferObj;
+   const GLuint size = index_size(type);
+   const GLubyte *p = (const GLubyte *) indices;
+   GLuint min = ~0U, max = 0;
+   GLint i;
+
+   if (count <= 0 || size == 0 || !has_client_arrays(ctx))
+      return;
+
+   if (bufObj->Name) {
+      const size_t offset = (const GLubyte *) indices - (const GLubyte *) 0;
+      _mesa_wait_buffer_object(bufObj);
+      if (!bufObj->Data || offset + count * size > (size_t) bufObj->Size)
+         return;
+      p = bufObj->Data + offset;
+   }
+   else if (!p) {
+      return;
+   }
+
+   for (i = 0; i < count; i++) {
+      GLuint k;
+      if (size == 1)
+         k = p[i];
+      else if (size == 2)
+         k = ((const GLushort *) p)[i];
+      else
+         k = ((const GLuint *) p)[i];
+      if (k < min)
+         min = k;
+      if (k > max)
+         max = k;
+   }
+   trace_client_arrays(ctx, min, max + 1);
+}
+
+
+static void
+trace_multi_arrays( GLcontext *ctx, const GLint *first,
+                    const GLsizei *count, GLsizei primcount )
+{
+   GLint start = 0, end = 0;
+   GLsizei i;
+
+   for (i = 0; i < primcount; i++) {
+      if (count[i] <= 0)
+         continue;
+      if (start == end || first[i] < start)
+         start = first[i];
+      if (first[i] + count[i] > end)
+         end = first[i] + count[i];
+   }
+   trace_client_arrays(ctx, start, end);
+}
+
+
+/*
+ * Functions with parameters gl_trace.py can't handle.
+ */
+
+static struct gl_buffer_object *
+get_buffer( GLcontext *ctx, GLenum target )
+{
+   switch (target) {
+   case GL_ARRAY_BUFFER_ARB:
+      return ctx->Array.ArrayBufferObj;
+   case GL_ELEMENT_ARRAY_BUFFER_ARB:
+      return ctx->Array.ElementArrayBufferObj;
+   case GL_PIXEL_PACK_BUFFER_EXT:
+      return ctx->Pack.BufferObj;
+   case GL_PIXEL_UNPACK_BUFFER_EXT:
+      return ctx->Unpack.BufferObj;
+   default:
+      return NULL;
+   }
+}
+
+
+/**
+ * Unmapping records the contents of the buffer, if it was mapped for
+ * writing.
+ */
+static GLboolean GLAPIENTRY
+trace_UnmapBufferARB( GLenum target )
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+
+   if (trace_lock(ctx)) {
+      const struct gl_buffer_object *bufObj = get_buffer(ctx, target);
+      trace_record(TRACE_CALL_UnmapBufferARB);
+      trace_write(&target, sizeof(target));
+      if (bufObj && bufObj->Name && bufObj->Pointer &&
+          bufObj->Access != GL_READ_ONLY_ARB)
+         trace_array(bufObj->Pointer, (GLuint) bufObj->Size);
+      else
+         trace_array(NULL, TRACE_RAW);
+      ret = CALL_UnmapBufferARB(ctx->CurrentDispatch, (target));
+      trace_unlock();
+   }
+   else {
+      ret = CALL_UnmapBufferARB(ctx->CurrentDispatch, (target));
+   }
+   return ret;
+}
+
+
+/**
+ * The strings are recorded one after the other, after their number.
+ */
+static void GLAPIENTRY
+trace_ShaderSourceARB( GLhandleARB shaderObj, GLsizei count,
+                       const GLcharARB **string, const GLint *length )
+{
+   GET_CURRENT_CONTEXT(ctx);
+
+   if (trace_lock(ctx)) {
+      const GLuint numStrings = (string && count > 0) ? count : 0;
+      GLuint i;
+      trace_record(TRACE_CALL_ShaderSourceARB);
+      trace_write(&shaderObj, sizeof(shaderObj));
+      trace_write(&count, sizeof(count));
+      trace_write(&numStrings, sizeof(numStrings));
+      for (i = 0; i < numStrings; i++) {
+         if (!string[i])
+            trace_array(NULL, TRACE_RAW);
+         else if (length && length[i] >= 0)
+            trace_array(string[i], length[i]);
+         else
+            trace_array(string[i], (GLuint) _mesa_strlen(string[i]));
+      }
+      CALL_ShaderSourceARB(ctx->CurrentDispatch,
+                           (shaderObj, count, string, length));
+      trace_unlock();
+   }
+   else {
+      CALL_ShaderSourceARB(ctx->CurrentDispatch,
+                           (shaderObj, count, string, length));
+   }
+}
+
+
+/**
+ * Functions whose client memory gl_trace.py doesn't know how to record
+ * still work, but aren't in the trace.  Warn once about each.
+ */
+static void
+trace_unsupported( GLcontext *ctx, GLuint id )
+{
+   static GLubyte warned[(NUM_TRACE_CALL + 7) / 8];
+
+   (void) ctx;
+   if (!(warned[id / 8] & (1 << (id % 8)))) {
+      warned[id / 8] |= 1 << (id % 8);
+      fprintf(stderr, "Mesa: gl%s is not traced\n", trace_call_names[id]);
+   }
+}
+
+
+#define TRACE_FUNCTIONS
+#include "api_trace_tmp.h"
+
+
+static int
+trace_nop( void )
+{
+   _mesa_problem(NULL, "User called no-op dispatch function (an unsupported extension function?)");
+   return 0;
+}
+
+
+/**
+ * Write the records which are still buffered when the program exits.
+ */
+static void
+trace_exit( void )
+{
+   _glthread_LOCK_MUTEX(TraceMutex);
+   if (TraceFile) {
+      trace_end_record();
+      TraceFlush = GL_TRUE;
+      trace_write_file();
+   }
+   _glthread_UNLOCK_MUTEX(TraceMutex);
+}
+
+
+/**
+ * Create the file and the tracing table, the first time a context is
+ * traced.  Called with the mutex held.
+ */
+static GLboolean
+open_trace( const char *path )
+{
+   const GLuint numEntries =
+      MAX2(_glapi_get_dispatch_table_size(),
+           sizeof(struct _glapi_table) / sizeof(_glapi_proc));
+   const GLuint byteOrder = TRACE_BYTE_ORDER;
+   const GLuint numNames = NUM_TRACE_CALL;
+   _glapi_proc *entry;
+   GLuint i;
+
+   entry = (_glapi_proc *) _mesa_malloc(numEntries * sizeof(_glapi_proc));
+   if (!entry) {
+      trace_fail("out of memory");
+      return GL_FALSE;
+   }
+   for (i = 0; i < numEntries; i++)
+      entry[i] = (_glapi_proc) trace_nop;
+   init_trace_table((struct _glapi_table *) entry);
+
+   TraceFile = fopen(path, "wb");
+   if (!TraceFile) {
+      _mesa_free(entry);
+      trace_fail("can't create the trace file");
+      return GL_FALSE;
+   }
+
+   /* the header: the names of the calls, so that the replayer doesn't
+    * depend on the order of the dispatch table
+    */
+   trace_write(TRACE_MAGIC, 8);
+   trace_write(&byteOrder, sizeof(byteOrder));
+   trace_write(&numNames, sizeof(numNames));
+   for (i = 0; i < NUM_TRACE_CALL; i++) {
+      const GLushort len = (GLushort) _mesa_strlen(trace_call_names[i]);
+      trace_write(&len, sizeof(len));
+      trace_write(trace_call_names[i], len);
+   }
+   trace_pad();
+
+   TraceTable = (struct _glapi_table *) entry;
+   atexit(trace_exit);
+   return !TraceFailed;
+}
+
+
+/**
+ * Trace the context if MESA_TRACE names a file.  Drivers call this
+ * for the contexts they create for the application, before they're
+ * first made current.
+ * Return:  GL_TRUE if the context is traced.
+ */
+GLboolean
+_mesa_trace_init( GLcontext *ctx )
+{
+   const char *path = _mesa_getenv("MESA_TRACE");
+   GLuint i;
+
+   if (!path || !path[0])
+      return GL_FALSE;
+
+   _glthread_LOCK_MUTEX(TraceMutex);
+   if (!TraceFile && !TraceFailed)
+      open_trace(path);
+   if (TraceFailed) {
+      _glthread_UNLOCK_MUTEX(TraceMutex);
+      return GL_FALSE;
+   }
+   for (i = 0; i < MAX_TRACE_CONTEXTS; i++) {
+      if (!TraceContexts[i].ctx) {
+         TraceContexts[i].ctx = ctx;
+         TraceContexts[i].Width = 0;
+         TraceContexts[i].Height = 0;
+         ctx->TraceId = i + 1;
+         break;
+      }
+   }
+   _glthread_UNLOCK_MUTEX(TraceMutex);
+
+   if (!ctx->TraceId) {
+      fprintf(stderr, "Mesa: too many contexts to trace\n");
+      return GL_FALSE;
+   }
+   return GL_TRUE;
+}
+
+
+/**
+ * Record the end of the context.
+ */
+void
+_mesa_trace_destroy( GLcontext *ctx )
+{
+   const GLuint id = ctx->TraceId;
+   const GLboolean owned = trace_owned();
+
+   if (!id)
+      return;
+
+   if (!owned)
+      _glthread_LOCK_MUTEX(TraceMutex);
+   trace_record(TRACE_DESTROY);
+   trace_write(&id, sizeof(id));
+   trace_flush();
+   if (TraceCurrent == ctx)
+      TraceCurrent = NULL;
+   TraceContexts[id - 1].ctx = NULL;
+   ctx->TraceId = 0;
+   if (!owned) {
+      trace_end_record();
+      trace_write_file();
+      _glthread_UNLOCK_MUTEX(TraceMutex);
+   }
+}
+
+
+/**
+ * Switch the calling thread to the tracing table if the context is
+ * traced.  Called by _mesa_make_current() and by drivers which bind
+ * ctx->CurrentDispatch themselves.  The drivers also pass the size of
+ * the drawable if the framebuffer is only a tile of it; otherwise width
+ * and height are 0.
+ */
+void
+_mesa_trace_make_current( GLcontext *ctx, GLsizei width, GLsizei height )
+{
+   const GLuint id = ctx->TraceId;
+
+   if (!id)
+      return;
+
+   if (width > 0 && height > 0) {
+      const GLboolean owned = trace_owned();
+      if (!owned)
+         _glthread_LOCK_MUTEX(TraceMutex);
+      if (TraceContexts[id - 1].Width != width ||
+          TraceContexts[id - 1].Height != height) {
+         TraceContexts[id - 1].Width = width;
+         TraceContexts[id - 1].Height = height;
+         TraceCurrent = NULL;
+      }
+      if (!owned)
+         _glthread_UNLOCK_MUTEX(TraceMutex);
+   }
+
+   _glapi_set_dispatch(TraceTable);
+}
+
+
+/**
+ * Record the end of a frame.  Called by _mesa_notifySwapBuffers().
+ */
+void
+_mesa_trace_swap( GLcontext *ctx )
+{
+   if (!trace_lock(ctx))
+      return;
+   trace_record(TRACE_SWAP);
+   trace_flush();
+   trace_unlock();
+}
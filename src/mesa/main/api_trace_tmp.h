@@ -0,0 +1,14631 @@
+/* DO NOT EDIT - This file generated automatically by gl_trace.py script */
+
+/*
+ * This file is only included by api_trace.c.  It has a trace_X
+ * function for each of the 816 dispatch table slots; 640 of them
+ * are recorded.
+ *
+ * It is included twice: first for the record layout and the call
+ * names, then with TRACE_FUNCTIONS defined for the functions.
+ */
+
+#ifndef TRACE_FUNCTIONS
+
+#define TRACE_MAGIC       "MESATRC1"
+#define TRACE_BYTE_ORDER  0x01020304
+#define TRACE_RAW         0xffffffffU  /**< byte count of a pointer value */
+
+#define TRACE_CONTEXT            0xfff0  /**< context id, rgb, depth, stencil, accum bits, width, height */
+#define TRACE_DESTROY            0xfff1  /**< context id */
+#define TRACE_SWAP               0xfff2  /**< end of frame */
+#define TRACE_ARRAY_POINTER      0xfff3  /**< struct trace_array_pointer */
+#define TRACE_ARRAY_DATA         0xfff4  /**< slot, offset, elements */
+
+#define TRACE_ARRAY_VERTEX           0
+#define TRACE_ARRAY_NORMAL           1
+#define TRACE_ARRAY_COLOR            2
+#define TRACE_ARRAY_SECONDARY_COLOR  3
+#define TRACE_ARRAY_FOG_COORD        4
+#define TRACE_ARRAY_INDEX            5
+#define TRACE_ARRAY_EDGE_FLAG        6
+#define TRACE_ARRAY_TEX_COORD        8
+#define TRACE_ARRAY_ATTRIB           16
+#define TRACE_ARRAY_SLOTS            32
+
+#if defined(_MSC_VER)
+typedef unsigned __int64 trace_uint64;
+#else
+typedef unsigned long long trace_uint64;
+#endif
+
+struct trace_record {
+   GLushort id;         /**< enum trace_call_id or TRACE_x */
+   GLushort pad;
+   GLuint size;         /**< bytes after this header */
+};
+
+struct trace_array_pointer {
+   GLuint slot;         /**< TRACE_ARRAY_x */
+   GLuint enabled;
+   GLint size;
+   GLenum type;
+   GLint stride;        /**< in bytes, never 0 */
+   GLuint normalized;
+   GLuint client_unit;  /**< glClientActiveTexture unit */
+   GLuint buffer;       /**< buffer object name, or 0 */
+   trace_uint64 pointer; /**< offset into the buffer object */
+};
+
+enum trace_call_id {
+   TRACE_CALL_NewList,
+   TRACE_CALL_EndList,
+   TRACE_CALL_CallList,
+   TRACE_CALL_CallLists,
+   TRACE_CALL_DeleteLists,
+   TRACE_CALL_GenLists,
+   TRACE_CALL_ListBase,
+   TRACE_CALL_Begin,
+   TRACE_CALL_Bitmap,
+   TRACE_CALL_Color3b,
+   TRACE_CALL_Color3bv,
+   TRACE_CALL_Color3d,
+   TRACE_CALL_Color3dv,
+   TRACE_CALL_Color3f,
+   TRACE_CALL_Color3fv,
+   TRACE_CALL_Color3i,
+   TRACE_CALL_Color3iv,
+   TRACE_CALL_Color3s,
+   TRACE_CALL_Color3sv,
+   TRACE_CALL_Color3ub,
+   TRACE_CALL_Color3ubv,
+   TRACE_CALL_Color3ui,
+   TRACE_CALL_Color3uiv,
+   TRACE_CALL_Color3us,
+   TRACE_CALL_Color3usv,
+   TRACE_CALL_Color4b,
+   TRACE_CALL_Color4bv,
+   TRACE_CALL_Color4d,
+   TRACE_CALL_Color4dv,
+   TRACE_CALL_Color4f,
+   TRACE_CALL_Color4fv,
+   TRACE_CALL_Color4i,
+   TRACE_CALL_Color4iv,
+   TRACE_CALL_Color4s,
+   TRACE_CALL_Color4sv,
+   TRACE_CALL_Color4ub,
+   TRACE_CALL_Color4ubv,
+   TRACE_CALL_Color4ui,
+   TRACE_CALL_Color4uiv,
+   TRACE_CALL_Color4us,
+   TRACE_CALL_Color4usv,
+   TRACE_CALL_EdgeFlag,
+   TRACE_CALL_EdgeFlagv,
+   TRACE_CALL_End,
+   TRACE_CALL_Indexd,
+   TRACE_CALL_Indexdv,
+   TRACE_CALL_Indexf,
+   TRACE_CALL_Indexfv,
+   TRACE_CALL_Indexi,
+   TRACE_CALL_Indexiv,
+   TRACE_CALL_Indexs,
+   TRACE_CALL_Indexsv,
+   TRACE_CALL_Normal3b,
+   TRACE_CALL_Normal3bv,
+   TRACE_CALL_Normal3d,
+   TRACE_CALL_Normal3dv,
+   TRACE_CALL_Normal3f,
+   TRACE_CALL_Normal3fv,
+   TRACE_CALL_Normal3i,
+   TRACE_CALL_Normal3iv,
+   TRACE_CALL_Normal3s,
+   TRACE_CALL_Normal3sv,
+   TRACE_CALL_RasterPos2d,
+   TRACE_CALL_RasterPos2dv,
+   TRACE_CALL_RasterPos2f,
+   TRACE_CALL_RasterPos2fv,
+   TRACE_CALL_RasterPos2i,
+   TRACE_CALL_RasterPos2iv,
+   TRACE_CALL_RasterPos2s,
+   TRACE_CALL_RasterPos2sv,
+   TRACE_CALL_RasterPos3d,
+   TRACE_CALL_RasterPos3dv,
+   TRACE_CALL_RasterPos3f,
+   TRACE_CALL_RasterPos3fv,
+   TRACE_CALL_RasterPos3i,
+   TRACE_CALL_RasterPos3iv,
+   TRACE_CALL_RasterPos3s,
+   TRACE_CALL_RasterPos3sv,
+   TRACE_CALL_RasterPos4d,
+   TRACE_CALL_RasterPos4dv,
+   TRACE_CALL_RasterPos4f,
+   TRACE_CALL_RasterPos4fv,
+   TRACE_CALL_RasterPos4i,
+   TRACE_CALL_RasterPos4iv,
+   TRACE_CALL_RasterPos4s,
+   TRACE_CALL_RasterPos4sv,
+   TRACE_CALL_Rectd,
+   TRACE_CALL_Rectdv,
+   TRACE_CALL_Rectf,
+   TRACE_CALL_Rectfv,
+   TRACE_CALL_Recti,
+   TRACE_CALL_Rectiv,
+   TRACE_CALL_Rects,
+   TRACE_CALL_Rectsv,
+   TRACE_CALL_TexCoord1d,
+   TRACE_CALL_TexCoord1dv,
+   TRACE_CALL_TexCoord1f,
+   TRACE_CALL_TexCoord1fv,
+   TRACE_CALL_TexCoord1i,
+   TRACE_CALL_TexCoord1iv,
+   TRACE_CALL_TexCoord1s,
+   TRACE_CALL_TexCoord1sv,
+   TRACE_CALL_TexCoord2d,
+   TRACE_CALL_TexCoord2dv,
+   TRACE_CALL_TexCoord2f,
+   TRACE_CALL_TexCoord2fv,
+   TRACE_CALL_TexCoord2i,
+   TRACE_CALL_TexCoord2iv,
+   TRACE_CALL_TexCoord2s,
+   TRACE_CALL_TexCoord2sv,
+   TRACE_CALL_TexCoord3d,
+   TRACE_CALL_TexCoord3dv,
+   TRACE_CALL_TexCoord3f,
+   TRACE_CALL_TexCoord3fv,
+   TRACE_CALL_TexCoord3i,
+   TRACE_CALL_TexCoord3iv,
+   TRACE_CALL_TexCoord3s,
+   TRACE_CALL_TexCoord3sv,
+   TRACE_CALL_TexCoord4d,
+   TRACE_CALL_TexCoord4dv,
+   TRACE_CALL_TexCoord4f,
+   TRACE_CALL_TexCoord4fv,
+   TRACE_CALL_TexCoord4i,
+   TRACE_CALL_TexCoord4iv,
+   TRACE_CALL_TexCoord4s,
+   TRACE_CALL_TexCoord4sv,
+   TRACE_CALL_Vertex2d,
+   TRACE_CALL_Vertex2dv,
+   TRACE_CALL_Vertex2f,
+   TRACE_CALL_Vertex2fv,
+   TRACE_CALL_Vertex2i,
+   TRACE_CALL_Vertex2iv,
+   TRACE_CALL_Vertex2s,
+   TRACE_CALL_Vertex2sv,
+   TRACE_CALL_Vertex3d,
+   TRACE_CALL_Vertex3dv,
+   TRACE_CALL_Vertex3f,
+   TRACE_CALL_Vertex3fv,
+   TRACE_CALL_Vertex3i,
+   TRACE_CALL_Vertex3iv,
+   TRACE_CALL_Vertex3s,
+   TRACE_CALL_Vertex3sv,
+   TRACE_CALL_Vertex4d,
+   TRACE_CALL_Vertex4dv,
+   TRACE_CALL_Vertex4f,
+   TRACE_CALL_Vertex4fv,
+   TRACE_CALL_Vertex4i,
+   TRACE_CALL_Vertex4iv,
+   TRACE_CALL_Vertex4s,
+   TRACE_CALL_Vertex4sv,
+   TRACE_CALL_ClipPlane,
+   TRACE_CALL_ColorMaterial,
+   TRACE_CALL_CullFace,
+   TRACE_CALL_Fogf,
+   TRACE_CALL_Fogfv,
+   TRACE_CALL_Fogi,
+   TRACE_CALL_Fogiv,
+   TRACE_CALL_FrontFace,
+   TRACE_CALL_Hint,
+   TRACE_CALL_Lightf,
+   TRACE_CALL_Lightfv,
+   TRACE_CALL_Lighti,
+   TRACE_CALL_Lightiv,
+   TRACE_CALL_LightModelf,
+   TRACE_CALL_LightModelfv,
+   TRACE_CALL_LightModeli,
+   TRACE_CALL_LightModeliv,
+   TRACE_CALL_LineStipple,
+   TRACE_CALL_LineWidth,
+   TRACE_CALL_Materialf,
+   TRACE_CALL_Materialfv,
+   TRACE_CALL_Materiali,
+   TRACE_CALL_Materialiv,
+   TRACE_CALL_PointSize,
+   TRACE_CALL_PolygonMode,
+   TRACE_CALL_PolygonStipple,
+   TRACE_CALL_Scissor,
+   TRACE_CALL_ShadeModel,
+   TRACE_CALL_TexParameterf,
+   TRACE_CALL_TexParameterfv,
+   TRACE_CALL_TexParameteri,
+   TRACE_CALL_TexParameteriv,
+   TRACE_CALL_TexImage1D,
+   TRACE_CALL_TexImage2D,
+   TRACE_CALL_TexEnvf,
+   TRACE_CALL_TexEnvfv,
+   TRACE_CALL_TexEnvi,
+   TRACE_CALL_TexEnviv,
+   TRACE_CALL_TexGend,
+   TRACE_CALL_TexGendv,
+   TRACE_CALL_TexGenf,
+   TRACE_CALL_TexGenfv,
+   TRACE_CALL_TexGeni,
+   TRACE_CALL_TexGeniv,
+   TRACE_CALL_FeedbackBuffer,
+   TRACE_CALL_SelectBuffer,
+   TRACE_CALL_RenderMode,
+   TRACE_CALL_InitNames,
+   TRACE_CALL_LoadName,
+   TRACE_CALL_PassThrough,
+   TRACE_CALL_PopName,
+   TRACE_CALL_PushName,
+   TRACE_CALL_DrawBuffer,
+   TRACE_CALL_Clear,
+   TRACE_CALL_ClearAccum,
+   TRACE_CALL_ClearIndex,
+   TRACE_CALL_ClearColor,
+   TRACE_CALL_ClearStencil,
+   TRACE_CALL_ClearDepth,
+   TRACE_CALL_StencilMask,
+   TRACE_CALL_ColorMask,
+   TRACE_CALL_DepthMask,
+   TRACE_CALL_IndexMask,
+   TRACE_CALL_Accum,
+   TRACE_CALL_Disable,
+   TRACE_CALL_Enable,
+   TRACE_CALL_Finish,
+   TRACE_CALL_Flush,
+   TRACE_CALL_PopAttrib,
+   TRACE_CALL_PushAttrib,
+   TRACE_CALL_Map1d,
+   TRACE_CALL_Map1f,
+   TRACE_CALL_Map2d,
+   TRACE_CALL_Map2f,
+   TRACE_CALL_MapGrid1d,
+   TRACE_CALL_MapGrid1f,
+   TRACE_CALL_MapGrid2d,
+   TRACE_CALL_MapGrid2f,
+   TRACE_CALL_EvalCoord1d,
+   TRACE_CALL_EvalCoord1dv,
+   TRACE_CALL_EvalCoord1f,
+   TRACE_CALL_EvalCoord1fv,
+   TRACE_CALL_EvalCoord2d,
+   TRACE_CALL_EvalCoord2dv,
+   TRACE_CALL_EvalCoord2f,
+   TRACE_CALL_EvalCoord2fv,
+   TRACE_CALL_EvalMesh1,
+   TRACE_CALL_EvalPoint1,
+   TRACE_CALL_EvalMesh2,
+   TRACE_CALL_EvalPoint2,
+   TRACE_CALL_AlphaFunc,
+   TRACE_CALL_BlendFunc,
+   TRACE_CALL_LogicOp,
+   TRACE_CALL_StencilFunc,
+   TRACE_CALL_StencilOp,
+   TRACE_CALL_DepthFunc,
+   TRACE_CALL_PixelZoom,
+   TRACE_CALL_PixelTransferf,
+   TRACE_CALL_PixelTransferi,
+   TRACE_CALL_PixelStoref,
+   TRACE_CALL_PixelStorei,
+   TRACE_CALL_PixelMapfv,
+   TRACE_CALL_PixelMapuiv,
+   TRACE_CALL_PixelMapusv,
+   TRACE_CALL_ReadBuffer,
+   TRACE_CALL_CopyPixels,
+   TRACE_CALL_ReadPixels,
+   TRACE_CALL_DrawPixels,
+   TRACE_CALL_GetBooleanv,
+   TRACE_CALL_GetClipPlane,
+   TRACE_CALL_GetDoublev,
+   TRACE_CALL_GetError,
+   TRACE_CALL_GetFloatv,
+   TRACE_CALL_GetIntegerv,
+   TRACE_CALL_GetLightfv,
+   TRACE_CALL_GetLightiv,
+   TRACE_CALL_GetMapdv,
+   TRACE_CALL_GetMapfv,
+   TRACE_CALL_GetMapiv,
+   TRACE_CALL_GetMaterialfv,
+   TRACE_CALL_GetMaterialiv,
+   TRACE_CALL_GetPixelMapfv,
+   TRACE_CALL_GetPixelMapuiv,
+   TRACE_CALL_GetPixelMapusv,
+   TRACE_CALL_GetPolygonStipple,
+   TRACE_CALL_GetString,
+   TRACE_CALL_GetTexEnvfv,
+   TRACE_CALL_GetTexEnviv,
+   TRACE_CALL_GetTexGendv,
+   TRACE_CALL_GetTexGenfv,
+   TRACE_CALL_GetTexGeniv,
+   TRACE_CALL_GetTexImage,
+   TRACE_CALL_GetTexParameterfv,
+   TRACE_CALL_GetTexParameteriv,
+   TRACE_CALL_GetTexLevelParameterfv,
+   TRACE_CALL_GetTexLevelParameteriv,
+   TRACE_CALL_IsEnabled,
+   TRACE_CALL_IsList,
+   TRACE_CALL_DepthRange,
+   TRACE_CALL_Frustum,
+   TRACE_CALL_LoadIdentity,
+   TRACE_CALL_LoadMatrixf,
+   TRACE_CALL_LoadMatrixd,
+   TRACE_CALL_MatrixMode,
+   TRACE_CALL_MultMatrixf,
+   TRACE_CALL_MultMatrixd,
+   TRACE_CALL_Ortho,
+   TRACE_CALL_PopMatrix,
+   TRACE_CALL_PushMatrix,
+   TRACE_CALL_Rotated,
+   TRACE_CALL_Rotatef,
+   TRACE_CALL_Scaled,
+   TRACE_CALL_Scalef,
+   TRACE_CALL_Translated,
+   TRACE_CALL_Translatef,
+   TRACE_CALL_Viewport,
+   TRACE_CALL_ArrayElement,
+   TRACE_CALL_BindTexture,
+   TRACE_CALL_ColorPointer,
+   TRACE_CALL_DisableClientState,
+   TRACE_CALL_DrawArrays,
+   TRACE_CALL_DrawElements,
+   TRACE_CALL_EdgeFlagPointer,
+   TRACE_CALL_EnableClientState,
+   TRACE_CALL_IndexPointer,
+   TRACE_CALL_Indexub,
+   TRACE_CALL_Indexubv,
+   TRACE_CALL_InterleavedArrays,
+   TRACE_CALL_NormalPointer,
+   TRACE_CALL_PolygonOffset,
+   TRACE_CALL_TexCoordPointer,
+   TRACE_CALL_VertexPointer,
+   TRACE_CALL_AreTexturesResident,
+   TRACE_CALL_CopyTexImage1D,
+   TRACE_CALL_CopyTexImage2D,
+   TRACE_CALL_CopyTexSubImage1D,
+   TRACE_CALL_CopyTexSubImage2D,
+   TRACE_CALL_DeleteTextures,
+   TRACE_CALL_GenTextures,
+   TRACE_CALL_GetPointerv,
+   TRACE_CALL_IsTexture,
+   TRACE_CALL_PrioritizeTextures,
+   TRACE_CALL_TexSubImage1D,
+   TRACE_CALL_TexSubImage2D,
+   TRACE_CALL_PopClientAttrib,
+   TRACE_CALL_PushClientAttrib,
+   TRACE_CALL_BlendColor,
+   TRACE_CALL_BlendEquation,
+   TRACE_CALL_DrawRangeElements,
+   TRACE_CALL_ColorTable,
+   TRACE_CALL_ColorTableParameterfv,
+   TRACE_CALL_ColorTableParameteriv,
+   TRACE_CALL_CopyColorTable,
+   TRACE_CALL_GetColorTable,
+   TRACE_CALL_GetColorTableParameterfv,
+   TRACE_CALL_GetColorTableParameteriv,
+   TRACE_CALL_ColorSubTable,
+   TRACE_CALL_CopyColorSubTable,
+   TRACE_CALL_ConvolutionFilter1D,
+   TRACE_CALL_ConvolutionFilter2D,
+   TRACE_CALL_ConvolutionParameterf,
+   TRACE_CALL_ConvolutionParameterfv,
+   TRACE_CALL_ConvolutionParameteri,
+   TRACE_CALL_ConvolutionParameteriv,
+   TRACE_CALL_CopyConvolutionFilter1D,
+   TRACE_CALL_CopyConvolutionFilter2D,
+   TRACE_CALL_GetConvolutionFilter,
+   TRACE_CALL_GetConvolutionParameterfv,
+   TRACE_CALL_GetConvolutionParameteriv,
+   TRACE_CALL_GetSeparableFilter,
+   TRACE_CALL_SeparableFilter2D,
+   TRACE_CALL_GetHistogram,
+   TRACE_CALL_GetHistogramParameterfv,
+   TRACE_CALL_GetHistogramParameteriv,
+   TRACE_CALL_GetMinmax,
+   TRACE_CALL_GetMinmaxParameterfv,
+   TRACE_CALL_GetMinmaxParameteriv,
+   TRACE_CALL_Histogram,
+   TRACE_CALL_Minmax,
+   TRACE_CALL_ResetHistogram,
+   TRACE_CALL_ResetMinmax,
+   TRACE_CALL_TexImage3D,
+   TRACE_CALL_TexSubImage3D,
+   TRACE_CALL_CopyTexSubImage3D,
+   TRACE_CALL_ActiveTextureARB,
+   TRACE_CALL_ClientActiveTextureARB,
+   TRACE_CALL_MultiTexCoord1dARB,
+   TRACE_CALL_MultiTexCoord1dvARB,
+   TRACE_CALL_MultiTexCoord1fARB,
+   TRACE_CALL_MultiTexCoord1fvARB,
+   TRACE_CALL_MultiTexCoord1iARB,
+   TRACE_CALL_MultiTexCoord1ivARB,
+   TRACE_CALL_MultiTexCoord1sARB,
+   TRACE_CALL_MultiTexCoord1svARB,
+   TRACE_CALL_MultiTexCoord2dARB,
+   TRACE_CALL_MultiTexCoord2dvARB,
+   TRACE_CALL_MultiTexCoord2fARB,
+   TRACE_CALL_MultiTexCoord2fvARB,
+   TRACE_CALL_MultiTexCoord2iARB,
+   TRACE_CALL_MultiTexCoord2ivARB,
+   TRACE_CALL_MultiTexCoord2sARB,
+   TRACE_CALL_MultiTexCoord2svARB,
+   TRACE_CALL_MultiTexCoord3dARB,
+   TRACE_CALL_MultiTexCoord3dvARB,
+   TRACE_CALL_MultiTexCoord3fARB,
+   TRACE_CALL_MultiTexCoord3fvARB,
+   TRACE_CALL_MultiTexCoord3iARB,
+   TRACE_CALL_MultiTexCoord3ivARB,
+   TRACE_CALL_MultiTexCoord3sARB,
+   TRACE_CALL_MultiTexCoord3svARB,
+   TRACE_CALL_MultiTexCoord4dARB,
+   TRACE_CALL_MultiTexCoord4dvARB,
+   TRACE_CALL_MultiTexCoord4fARB,
+   TRACE_CALL_MultiTexCoord4fvARB,
+   TRACE_CALL_MultiTexCoord4iARB,
+   TRACE_CALL_MultiTexCoord4ivARB,
+   TRACE_CALL_MultiTexCoord4sARB,
+   TRACE_CALL_MultiTexCoord4svARB,
+   TRACE_CALL_LoadTransposeMatrixfARB,
+   TRACE_CALL_LoadTransposeMatrixdARB,
+   TRACE_CALL_MultTransposeMatrixfARB,
+   TRACE_CALL_MultTransposeMatrixdARB,
+   TRACE_CALL_SampleCoverageARB,
+   TRACE_CALL_DrawBuffersARB,
+   TRACE_CALL_PolygonOffsetEXT,
+   TRACE_CALL_GetTexFilterFuncSGIS,
+   TRACE_CALL_TexFilterFuncSGIS,
+   TRACE_CALL_GetHistogramEXT,
+   TRACE_CALL_GetHistogramParameterfvEXT,
+   TRACE_CALL_GetHistogramParameterivEXT,
+   TRACE_CALL_GetMinmaxEXT,
+   TRACE_CALL_GetMinmaxParameterfvEXT,
+   TRACE_CALL_GetMinmaxParameterivEXT,
+   TRACE_CALL_GetConvolutionFilterEXT,
+   TRACE_CALL_GetConvolutionParameterfvEXT,
+   TRACE_CALL_GetConvolutionParameterivEXT,
+   TRACE_CALL_GetSeparableFilterEXT,
+   TRACE_CALL_GetColorTableSGI,
+   TRACE_CALL_GetColorTableParameterfvSGI,
+   TRACE_CALL_GetColorTableParameterivSGI,
+   TRACE_CALL_PixelTexGenSGIX,
+   TRACE_CALL_PixelTexGenParameteriSGIS,
+   TRACE_CALL_PixelTexGenParameterivSGIS,
+   TRACE_CALL_PixelTexGenParameterfSGIS,
+   TRACE_CALL_PixelTexGenParameterfvSGIS,
+   TRACE_CALL_GetPixelTexGenParameterivSGIS,
+   TRACE_CALL_GetPixelTexGenParameterfvSGIS,
+   TRACE_CALL_TexImage4DSGIS,
+   TRACE_CALL_TexSubImage4DSGIS,
+   TRACE_CALL_AreTexturesResidentEXT,
+   TRACE_CALL_GenTexturesEXT,
+   TRACE_CALL_IsTextureEXT,
+   TRACE_CALL_DetailTexFuncSGIS,
+   TRACE_CALL_GetDetailTexFuncSGIS,
+   TRACE_CALL_SharpenTexFuncSGIS,
+   TRACE_CALL_GetSharpenTexFuncSGIS,
+   TRACE_CALL_SampleMaskSGIS,
+   TRACE_CALL_SamplePatternSGIS,
+   TRACE_CALL_ColorPointerEXT,
+   TRACE_CALL_EdgeFlagPointerEXT,
+   TRACE_CALL_IndexPointerEXT,
+   TRACE_CALL_NormalPointerEXT,
+   TRACE_CALL_TexCoordPointerEXT,
+   TRACE_CALL_VertexPointerEXT,
+   TRACE_CALL_SpriteParameterfSGIX,
+   TRACE_CALL_SpriteParameterfvSGIX,
+   TRACE_CALL_SpriteParameteriSGIX,
+   TRACE_CALL_SpriteParameterivSGIX,
+   TRACE_CALL_PointParameterfEXT,
+   TRACE_CALL_PointParameterfvEXT,
+   TRACE_CALL_GetInstrumentsSGIX,
+   TRACE_CALL_InstrumentsBufferSGIX,
+   TRACE_CALL_PollInstrumentsSGIX,
+   TRACE_CALL_ReadInstrumentsSGIX,
+   TRACE_CALL_StartInstrumentsSGIX,
+   TRACE_CALL_StopInstrumentsSGIX,
+   TRACE_CALL_FrameZoomSGIX,
+   TRACE_CALL_TagSampleBufferSGIX,
+   TRACE_CALL_ReferencePlaneSGIX,
+   TRACE_CALL_FlushRasterSGIX,
+   TRACE_CALL_GetListParameterfvSGIX,
+   TRACE_CALL_GetListParameterivSGIX,
+   TRACE_CALL_ListParameterfSGIX,
+   TRACE_CALL_ListParameterfvSGIX,
+   TRACE_CALL_ListParameteriSGIX,
+   TRACE_CALL_ListParameterivSGIX,
+   TRACE_CALL_FragmentColorMaterialSGIX,
+   TRACE_CALL_FragmentLightfSGIX,
+   TRACE_CALL_FragmentLightfvSGIX,
+   TRACE_CALL_FragmentLightiSGIX,
+   TRACE_CALL_FragmentLightivSGIX,
+   TRACE_CALL_FragmentLightModelfSGIX,
+   TRACE_CALL_FragmentLightModelfvSGIX,
+   TRACE_CALL_FragmentLightModeliSGIX,
+   TRACE_CALL_FragmentLightModelivSGIX,
+   TRACE_CALL_FragmentMaterialfSGIX,
+   TRACE_CALL_FragmentMaterialfvSGIX,
+   TRACE_CALL_FragmentMaterialiSGIX,
+   TRACE_CALL_FragmentMaterialivSGIX,
+   TRACE_CALL_GetFragmentLightfvSGIX,
+   TRACE_CALL_GetFragmentLightivSGIX,
+   TRACE_CALL_GetFragmentMaterialfvSGIX,
+   TRACE_CALL_GetFragmentMaterialivSGIX,
+   TRACE_CALL_LightEnviSGIX,
+   TRACE_CALL_VertexWeightfEXT,
+   TRACE_CALL_VertexWeightfvEXT,
+   TRACE_CALL_VertexWeightPointerEXT,
+   TRACE_CALL_FlushVertexArrayRangeNV,
+   TRACE_CALL_VertexArrayRangeNV,
+   TRACE_CALL_CombinerParameterfvNV,
+   TRACE_CALL_CombinerParameterfNV,
+   TRACE_CALL_CombinerParameterivNV,
+   TRACE_CALL_CombinerParameteriNV,
+   TRACE_CALL_CombinerInputNV,
+   TRACE_CALL_CombinerOutputNV,
+   TRACE_CALL_FinalCombinerInputNV,
+   TRACE_CALL_GetCombinerInputParameterfvNV,
+   TRACE_CALL_GetCombinerInputParameterivNV,
+   TRACE_CALL_GetCombinerOutputParameterfvNV,
+   TRACE_CALL_GetCombinerOutputParameterivNV,
+   TRACE_CALL_GetFinalCombinerInputParameterfvNV,
+   TRACE_CALL_GetFinalCombinerInputParameterivNV,
+   TRACE_CALL_ResizeBuffersMESA,
+   TRACE_CALL_WindowPos2dMESA,
+   TRACE_CALL_WindowPos2dvMESA,
+   TRACE_CALL_WindowPos2fMESA,
+   TRACE_CALL_WindowPos2fvMESA,
+   TRACE_CALL_WindowPos2iMESA,
+   TRACE_CALL_WindowPos2ivMESA,
+   TRACE_CALL_WindowPos2sMESA,
+   TRACE_CALL_WindowPos2svMESA,
+   TRACE_CALL_WindowPos3dMESA,
+   TRACE_CALL_WindowPos3dvMESA,
+   TRACE_CALL_WindowPos3fMESA,
+   TRACE_CALL_WindowPos3fvMESA,
+   TRACE_CALL_WindowPos3iMESA,
+   TRACE_CALL_WindowPos3ivMESA,
+   TRACE_CALL_WindowPos3sMESA,
+   TRACE_CALL_WindowPos3svMESA,
+   TRACE_CALL_WindowPos4dMESA,
+   TRACE_CALL_WindowPos4dvMESA,
+   TRACE_CALL_WindowPos4fMESA,
+   TRACE_CALL_WindowPos4fvMESA,
+   TRACE_CALL_WindowPos4iMESA,
+   TRACE_CALL_WindowPos4ivMESA,
+   TRACE_CALL_WindowPos4sMESA,
+   TRACE_CALL_WindowPos4svMESA,
+   TRACE_CALL_BlendFuncSeparateEXT,
+   TRACE_CALL_IndexMaterialEXT,
+   TRACE_CALL_IndexFuncEXT,
+   TRACE_CALL_LockArraysEXT,
+   TRACE_CALL_UnlockArraysEXT,
+   TRACE_CALL_CullParameterdvEXT,
+   TRACE_CALL_CullParameterfvEXT,
+   TRACE_CALL_HintPGI,
+   TRACE_CALL_FogCoordfEXT,
+   TRACE_CALL_FogCoordfvEXT,
+   TRACE_CALL_FogCoorddEXT,
+   TRACE_CALL_FogCoorddvEXT,
+   TRACE_CALL_FogCoordPointerEXT,
+   TRACE_CALL_GetColorTableEXT,
+   TRACE_CALL_GetColorTableParameterivEXT,
+   TRACE_CALL_GetColorTableParameterfvEXT,
+   TRACE_CALL_TbufferMask3DFX,
+   TRACE_CALL_CompressedTexImage3DARB,
+   TRACE_CALL_CompressedTexImage2DARB,
+   TRACE_CALL_CompressedTexImage1DARB,
+   TRACE_CALL_CompressedTexSubImage3DARB,
+   TRACE_CALL_CompressedTexSubImage2DARB,
+   TRACE_CALL_CompressedTexSubImage1DARB,
+   TRACE_CALL_GetCompressedTexImageARB,
+   TRACE_CALL_SecondaryColor3bEXT,
+   TRACE_CALL_SecondaryColor3bvEXT,
+   TRACE_CALL_SecondaryColor3dEXT,
+   TRACE_CALL_SecondaryColor3dvEXT,
+   TRACE_CALL_SecondaryColor3fEXT,
+   TRACE_CALL_SecondaryColor3fvEXT,
+   TRACE_CALL_SecondaryColor3iEXT,
+   TRACE_CALL_SecondaryColor3ivEXT,
+   TRACE_CALL_SecondaryColor3sEXT,
+   TRACE_CALL_SecondaryColor3svEXT,
+   TRACE_CALL_SecondaryColor3ubEXT,
+   TRACE_CALL_SecondaryColor3ubvEXT,
+   TRACE_CALL_SecondaryColor3uiEXT,
+   TRACE_CALL_SecondaryColor3uivEXT,
+   TRACE_CALL_SecondaryColor3usEXT,
+   TRACE_CALL_SecondaryColor3usvEXT,
+   TRACE_CALL_SecondaryColorPointerEXT,
+   TRACE_CALL_AreProgramsResidentNV,
+   TRACE_CALL_BindProgramNV,
+   TRACE_CALL_DeleteProgramsNV,
+   TRACE_CALL_ExecuteProgramNV,
+   TRACE_CALL_GenProgramsNV,
+   TRACE_CALL_GetProgramParameterdvNV,
+   TRACE_CALL_GetProgramParameterfvNV,
+   TRACE_CALL_GetProgramivNV,
+   TRACE_CALL_GetProgramStringNV,
+   TRACE_CALL_GetTrackMatrixivNV,
+   TRACE_CALL_GetVertexAttribdvARB,
+   TRACE_CALL_GetVertexAttribfvARB,
+   TRACE_CALL_GetVertexAttribivARB,
+   TRACE_CALL_GetVertexAttribPointervNV,
+   TRACE_CALL_IsProgramNV,
+   TRACE_CALL_LoadProgramNV,
+   TRACE_CALL_ProgramParameter4dNV,
+   TRACE_CALL_ProgramParameter4dvNV,
+   TRACE_CALL_ProgramParameter4fNV,
+   TRACE_CALL_ProgramParameter4fvNV,
+   TRACE_CALL_ProgramParameters4dvNV,
+   TRACE_CALL_ProgramParameters4fvNV,
+   TRACE_CALL_RequestResidentProgramsNV,
+   TRACE_CALL_TrackMatrixNV,
+   TRACE_CALL_VertexAttribPointerNV,
+   TRACE_CALL_VertexAttrib1dARB,
+   TRACE_CALL_VertexAttrib1dvARB,
+   TRACE_CALL_VertexAttrib1fARB,
+   TRACE_CALL_VertexAttrib1fvARB,
+   TRACE_CALL_VertexAttrib1sARB,
+   TRACE_CALL_VertexAttrib1svARB,
+   TRACE_CALL_VertexAttrib2dARB,
+   TRACE_CALL_VertexAttrib2dvARB,
+   TRACE_CALL_VertexAttrib2fARB,
+   TRACE_CALL_VertexAttrib2fvARB,
+   TRACE_CALL_VertexAttrib2sARB,
+   TRACE_CALL_VertexAttrib2svARB,
+   TRACE_CALL_VertexAttrib3dARB,
+   TRACE_CALL_VertexAttrib3dvARB,
+   TRACE_CALL_VertexAttrib3fARB,
+   TRACE_CALL_VertexAttrib3fvARB,
+   TRACE_CALL_VertexAttrib3sARB,
+   TRACE_CALL_VertexAttrib3svARB,
+   TRACE_CALL_VertexAttrib4dARB,
+   TRACE_CALL_VertexAttrib4dvARB,
+   TRACE_CALL_VertexAttrib4fARB,
+   TRACE_CALL_VertexAttrib4fvARB,
+   TRACE_CALL_VertexAttrib4sARB,
+   TRACE_CALL_VertexAttrib4svARB,
+   TRACE_CALL_VertexAttrib4NubARB,
+   TRACE_CALL_VertexAttrib4NubvARB,
+   TRACE_CALL_VertexAttribs1dvNV,
+   TRACE_CALL_VertexAttribs1fvNV,
+   TRACE_CALL_VertexAttribs1svNV,
+   TRACE_CALL_VertexAttribs2dvNV,
+   TRACE_CALL_VertexAttribs2fvNV,
+   TRACE_CALL_VertexAttribs2svNV,
+   TRACE_CALL_VertexAttribs3dvNV,
+   TRACE_CALL_VertexAttribs3fvNV,
+   TRACE_CALL_VertexAttribs3svNV,
+   TRACE_CALL_VertexAttribs4dvNV,
+   TRACE_CALL_VertexAttribs4fvNV,
+   TRACE_CALL_VertexAttribs4svNV,
+   TRACE_CALL_VertexAttribs4ubvNV,
+   TRACE_CALL_PointParameteriNV,
+   TRACE_CALL_PointParameterivNV,
+   TRACE_CALL_MultiDrawArraysEXT,
+   TRACE_CALL_MultiDrawElementsEXT,
+   TRACE_CALL_ActiveStencilFaceEXT,
+   TRACE_CALL_DeleteFencesNV,
+   TRACE_CALL_GenFencesNV,
+   TRACE_CALL_IsFenceNV,
+   TRACE_CALL_TestFenceNV,
+   TRACE_CALL_GetFenceivNV,
+   TRACE_CALL_FinishFenceNV,
+   TRACE_CALL_SetFenceNV,
+   TRACE_CALL_VertexAttrib4bvARB,
+   TRACE_CALL_VertexAttrib4ivARB,
+   TRACE_CALL_VertexAttrib4ubvARB,
+   TRACE_CALL_VertexAttrib4usvARB,
+   TRACE_CALL_VertexAttrib4uivARB,
+   TRACE_CALL_VertexAttrib4NbvARB,
+   TRACE_CALL_VertexAttrib4NsvARB,
+   TRACE_CALL_VertexAttrib4NivARB,
+   TRACE_CALL_VertexAttrib4NusvARB,
+   TRACE_CALL_VertexAttrib4NuivARB,
+   TRACE_CALL_VertexAttribPointerARB,
+   TRACE_CALL_EnableVertexAttribArrayARB,
+   TRACE_CALL_DisableVertexAttribArrayARB,
+   TRACE_CALL_ProgramStringARB,
+   TRACE_CALL_ProgramEnvParameter4dARB,
+   TRACE_CALL_ProgramEnvParameter4dvARB,
+   TRACE_CALL_ProgramEnvParameter4fARB,
+   TRACE_CALL_ProgramEnvParameter4fvARB,
+   TRACE_CALL_ProgramLocalParameter4dARB,
+   TRACE_CALL_ProgramLocalParameter4dvARB,
+   TRACE_CALL_ProgramLocalParameter4fARB,
+   TRACE_CALL_ProgramLocalParameter4fvARB,
+   TRACE_CALL_GetProgramEnvParameterdvARB,
+   TRACE_CALL_GetProgramEnvParameterfvARB,
+   TRACE_CALL_GetProgramLocalParameterdvARB,
+   TRACE_CALL_GetProgramLocalParameterfvARB,
+   TRACE_CALL_GetProgramivARB,
+   TRACE_CALL_GetProgramStringARB,
+   TRACE_CALL_ProgramNamedParameter4fNV,
+   TRACE_CALL_ProgramNamedParameter4dNV,
+   TRACE_CALL_ProgramNamedParameter4fvNV,
+   TRACE_CALL_ProgramNamedParameter4dvNV,
+   TRACE_CALL_GetProgramNamedParameterfvNV,
+   TRACE_CALL_GetProgramNamedParameterdvNV,
+   TRACE_CALL_BindBufferARB,
+   TRACE_CALL_BufferDataARB,
+   TRACE_CALL_BufferSubDataARB,
+   TRACE_CALL_DeleteBuffersARB,
+   TRACE_CALL_GenBuffersARB,
+   TRACE_CALL_GetBufferParameterivARB,
+   TRACE_CALL_GetBufferPointervARB,
+   TRACE_CALL_GetBufferSubDataARB,
+   TRACE_CALL_IsBufferARB,
+   TRACE_CALL_MapBufferARB,
+   TRACE_CALL_UnmapBufferARB,
+   TRACE_CALL_DepthBoundsEXT,
+   TRACE_CALL_GenQueriesARB,
+   TRACE_CALL_DeleteQueriesARB,
+   TRACE_CALL_IsQueryARB,
+   TRACE_CALL_BeginQueryARB,
+   TRACE_CALL_EndQueryARB,
+   TRACE_CALL_GetQueryivARB,
+   TRACE_CALL_GetQueryObjectivARB,
+   TRACE_CALL_GetQueryObjectuivARB,
+   TRACE_CALL_MultiModeDrawArraysIBM,
+   TRACE_CALL_MultiModeDrawElementsIBM,
+   TRACE_CALL_BlendEquationSeparateEXT,
+   TRACE_CALL_DeleteObjectARB,
+   TRACE_CALL_GetHandleARB,
+   TRACE_CALL_DetachObjectARB,
+   TRACE_CALL_CreateShaderObjectARB,
+   TRACE_CALL_ShaderSourceARB,
+   TRACE_CALL_CompileShaderARB,
+   TRACE_CALL_CreateProgramObjectARB,
+   TRACE_CALL_AttachObjectARB,
+   TRACE_CALL_LinkProgramARB,
+   TRACE_CALL_UseProgramObjectARB,
+   TRACE_CALL_ValidateProgramARB,
+   TRACE_CALL_Uniform1fARB,
+   TRACE_CALL_Uniform2fARB,
+   TRACE_CALL_Uniform3fARB,
+   TRACE_CALL_Uniform4fARB,
+   TRACE_CALL_Uniform1iARB,
+   TRACE_CALL_Uniform2iARB,
+   TRACE_CALL_Uniform3iARB,
+   TRACE_CALL_Uniform4iARB,
+   TRACE_CALL_Uniform1fvARB,
+   TRACE_CALL_Uniform2fvARB,
+   TRACE_CALL_Uniform3fvARB,
+   TRACE_CALL_Uniform4fvARB,
+   TRACE_CALL_Uniform1ivARB,
+   TRACE_CALL_Uniform2ivARB,
+   TRACE_CALL_Uniform3ivARB,
+   TRACE_CALL_Uniform4ivARB,
+   TRACE_CALL_UniformMatrix2fvARB,
+   TRACE_CALL_UniformMatrix3fvARB,
+   TRACE_CALL_UniformMatrix4fvARB,
+   TRACE_CALL_GetObjectParameterfvARB,
+   TRACE_CALL_GetObjectParameterivARB,
+   TRACE_CALL_GetInfoLogARB,
+   TRACE_CALL_GetAttachedObjectsARB,
+   TRACE_CALL_GetUniformLocationARB,
+   TRACE_CALL_GetActiveUniformARB,
+   TRACE_CALL_GetUniformfvARB,
+   TRACE_CALL_GetUniformivARB,
+   TRACE_CALL_GetShaderSourceARB,
+   TRACE_CALL_BindAttribLocationARB,
+   TRACE_CALL_GetActiveAttribARB,
+   TRACE_CALL_GetAttribLocationARB,
+   TRACE_CALL_GetVertexAttribdvNV,
+   TRACE_CALL_GetVertexAttribfvNV,
+   TRACE_CALL_GetVertexAttribivNV,
+   TRACE_CALL_VertexAttrib1dNV,
+   TRACE_CALL_VertexAttrib1dvNV,
+   TRACE_CALL_VertexAttrib1fNV,
+   TRACE_CALL_VertexAttrib1fvNV,
+   TRACE_CALL_VertexAttrib1sNV,
+   TRACE_CALL_VertexAttrib1svNV,
+   TRACE_CALL_VertexAttrib2dNV,
+   TRACE_CALL_VertexAttrib2dvNV,
+   TRACE_CALL_VertexAttrib2fNV,
+   TRACE_CALL_VertexAttrib2fvNV,
+   TRACE_CALL_VertexAttrib2sNV,
+   TRACE_CALL_VertexAttrib2svNV,
+   TRACE_CALL_VertexAttrib3dNV,
+   TRACE_CALL_VertexAttrib3dvNV,
+   TRACE_CALL_VertexAttrib3fNV,
+   TRACE_CALL_VertexAttrib3fvNV,
+   TRACE_CALL_VertexAttrib3sNV,
+   TRACE_CALL_VertexAttrib3svNV,
+   TRACE_CALL_VertexAttrib4dNV,
+   TRACE_CALL_VertexAttrib4dvNV,
+   TRACE_CALL_VertexAttrib4fNV,
+   TRACE_CALL_VertexAttrib4fvNV,
+   TRACE_CALL_VertexAttrib4sNV,
+   TRACE_CALL_VertexAttrib4svNV,
+   TRACE_CALL_VertexAttrib4ubNV,
+   TRACE_CALL_VertexAttrib4ubvNV,
+   TRACE_CALL_GenFragmentShadersATI,
+   TRACE_CALL_BindFragmentShaderATI,
+   TRACE_CALL_DeleteFragmentShaderATI,
+   TRACE_CALL_BeginFragmentShaderATI,
+   TRACE_CALL_EndFragmentShaderATI,
+   TRACE_CALL_PassTexCoordATI,
+   TRACE_CALL_SampleMapATI,
+   TRACE_CALL_ColorFragmentOp1ATI,
+   TRACE_CALL_ColorFragmentOp2ATI,
+   TRACE_CALL_ColorFragmentOp3ATI,
+   TRACE_CALL_AlphaFragmentOp1ATI,
+   TRACE_CALL_AlphaFragmentOp2ATI,
+   TRACE_CALL_AlphaFragmentOp3ATI,
+   TRACE_CALL_SetFragmentShaderConstantATI,
+   TRACE_CALL_IsRenderbufferEXT,
+   TRACE_CALL_BindRenderbufferEXT,
+   TRACE_CALL_DeleteRenderbuffersEXT,
+   TRACE_CALL_GenRenderbuffersEXT,
+   TRACE_CALL_RenderbufferStorageEXT,
+   TRACE_CALL_GetRenderbufferParameterivEXT,
+   TRACE_CALL_IsFramebufferEXT,
+   TRACE_CALL_BindFramebufferEXT,
+   TRACE_CALL_DeleteFramebuffersEXT,
+   TRACE_CALL_GenFramebuffersEXT,
+   TRACE_CALL_CheckFramebufferStatusEXT,
+   TRACE_CALL_FramebufferTexture1DEXT,
+   TRACE_CALL_FramebufferTexture2DEXT,
+   TRACE_CALL_FramebufferTexture3DEXT,
+   TRACE_CALL_FramebufferRenderbufferEXT,
+   TRACE_CALL_GetFramebufferAttachmentParameterivEXT,
+   TRACE_CALL_GenerateMipmapEXT,
+   TRACE_CALL_StencilFuncSeparate,
+   TRACE_CALL_StencilOpSeparate,
+   TRACE_CALL_StencilMaskSeparate,
+   NUM_TRACE_CALL
+};
+
+static const char * const trace_call_names[NUM_TRACE_CALL] = {
+   "NewList",
+   "EndList",
+   "CallList",
+   "CallLists",
+   "DeleteLists",
+   "GenLists",
+   "ListBase",
+   "Begin",
+   "Bitmap",
+   "Color3b",
+   "Color3bv",
+   "Color3d",
+   "Color3dv",
+   "Color3f",
+   "Color3fv",
+   "Color3i",
+   "Color3iv",
+   "Color3s",
+   "Color3sv",
+   "Color3ub",
+   "Color3ubv",
+   "Color3ui",
+   "Color3uiv",
+   "Color3us",
+   "Color3usv",
+   "Color4b",
+   "Color4bv",
+   "Color4d",
+   "Color4dv",
+   "Color4f",
+   "Color4fv",
+   "Color4i",
+   "Color4iv",
+   "Color4s",
+   "Color4sv",
+   "Color4ub",
+   "Color4ubv",
+   "Color4ui",
+   "Color4uiv",
+   "Color4us",
+   "Color4usv",
+   "EdgeFlag",
+   "EdgeFlagv",
+   "End",
+   "Indexd",
+   "Indexdv",
+   "Indexf",
+   "Indexfv",
+   "Indexi",
+   "Indexiv",
+   "Indexs",
+   "Indexsv",
+   "Normal3b",
+   "Normal3bv",
+   "Normal3d",
+   "Normal3dv",
+   "Normal3f",
+   "Normal3fv",
+   "Normal3i",
+   "Normal3iv",
+   "Normal3s",
+   "Normal3sv",
+   "RasterPos2d",
+   "RasterPos2dv",
+   "RasterPos2f",
+   "RasterPos2fv",
+   "RasterPos2i",
+   "RasterPos2iv",
+   "RasterPos2s",
+   "RasterPos2sv",
+   "RasterPos3d",
+   "RasterPos3dv",
+   "RasterPos3f",
+   "RasterPos3fv",
+   "RasterPos3i",
+   "RasterPos3iv",
+   "RasterPos3s",
+   "RasterPos3sv",
+   "RasterPos4d",
+   "RasterPos4dv",
+   "RasterPos4f",
+   "RasterPos4fv",
+   "RasterPos4i",
+   "RasterPos4iv",
+   "RasterPos4s",
+   "RasterPos4sv",
+   "Rectd",
+   "Rectdv",
+   "Rectf",
+   "Rectfv",
+   "Recti",
+   "Rectiv",
+   "Rects",
+   "Rectsv",
+   "TexCoord1d",
+   "TexCoord1dv",
+   "TexCoord1f",
+   "TexCoord1fv",
+   "TexCoord1i",
+   "TexCoord1iv",
+   "TexCoord1s",
+   "TexCoord1sv",
+   "TexCoord2d",
+   "TexCoord2dv",
+   "TexCoord2f",
+   "TexCoord2fv",
+   "TexCoord2i",
+   "TexCoord2iv",
+   "TexCoord2s",
+   "TexCoord2sv",
+   "TexCoord3d",
+   "TexCoord3dv",
+   "TexCoord3f",
+   "TexCoord3fv",
+   "TexCoord3i",
+   "TexCoord3iv",
+   "TexCoord3s",
+   "TexCoord3sv",
+   "TexCoord4d",
+   "TexCoord4dv",
+   "TexCoord4f",
+   "TexCoord4fv",
+   "TexCoord4i",
+   "TexCoord4iv",
+   "TexCoord4s",
+   "TexCoord4sv",
+   "Vertex2d",
+   "Vertex2dv",
+   "Vertex2f",
+   "Vertex2fv",
+   "Vertex2i",
+   "Vertex2iv",
+   "Vertex2s",
+   "Vertex2sv",
+   "Vertex3d",
+   "Vertex3dv",
+   "Vertex3f",
+   "Vertex3fv",
+   "Vertex3i",
+   "Vertex3iv",
+   "Vertex3s",
+   "Vertex3sv",
+   "Vertex4d",
+   "Vertex4dv",
+   "Vertex4f",
+   "Vertex4fv",
+   "Vertex4i",
+   "Vertex4iv",
+   "Vertex4s",
+   "Vertex4sv",
+   "ClipPlane",
+   "ColorMaterial",
+   "CullFace",
+   "Fogf",
+   "Fogfv",
+   "Fogi",
+   "Fogiv",
+   "FrontFace",
+   "Hint",
+   "Lightf",
+   "Lightfv",
+   "Lighti",
+   "Lightiv",
+   "LightModelf",
+   "LightModelfv",
+   "LightModeli",
+   "LightModeliv",
+   "LineStipple",
+   "LineWidth",
+   "Materialf",
+   "Materialfv",
+   "Materiali",
+   "Materialiv",
+   "PointSize",
+   "PolygonMode",
+   "PolygonStipple",
+   "Scissor",
+   "ShadeModel",
+   "TexParameterf",
+   "TexParameterfv",
+   "TexParameteri",
+   "TexParameteriv",
+   "TexImage1D",
+   "TexImage2D",
+   "TexEnvf",
+   "TexEnvfv",
+   "TexEnvi",
+   "TexEnviv",
+   "TexGend",
+   "TexGendv",
+   "TexGenf",
+   "TexGenfv",
+   "TexGeni",
+   "TexGeniv",
+   "FeedbackBuffer",
+   "SelectBuffer",
+   "RenderMode",
+   "InitNames",
+   "LoadName",
+   "PassThrough",
+   "PopName",
+   "PushName",
+   "DrawBuffer",
+   "Clear",
+   "ClearAccum",
+   "ClearIndex",
+   "ClearColor",
+   "ClearStencil",
+   "ClearDepth",
+   "StencilMask",
+   "ColorMask",
+   "DepthMask",
+   "IndexMask",
+   "Accum",
+   "Disable",
+   "Enable",
+   "Finish",
+   "Flush",
+   "PopAttrib",
+   "PushAttrib",
+   "Map1d",
+   "Map1f",
+   "Map2d",
+   "Map2f",
+   "MapGrid1d",
+   "MapGrid1f",
+   "MapGrid2d",
+   "MapGrid2f",
+   "EvalCoord1d",
+   "EvalCoord1dv",
+   "EvalCoord1f",
+   "EvalCoord1fv",
+   "EvalCoord2d",
+   "EvalCoord2dv",
+   "EvalCoord2f",
+   "EvalCoord2fv",
+   "EvalMesh1",
+   "EvalPoint1",
+   "EvalMesh2",
+   "EvalPoint2",
+   "AlphaFunc",
+   "BlendFunc",
+   "LogicOp",
+   "StencilFunc",
+   "StencilOp",
+   "DepthFunc",
+   "PixelZoom",
+   "PixelTransferf",
+   "PixelTransferi",
+   "PixelStoref",
+   "PixelStorei",
+   "PixelMapfv",
+   "PixelMapuiv",
+   "PixelMapusv",
+   "ReadBuffer",
+   "CopyPixels",
+   "ReadPixels",
+   "DrawPixels",
+   "GetBooleanv",
+   "GetClipPlane",
+   "GetDoublev",
+   "GetError",
+   "GetFloatv",
+   "GetIntegerv",
+   "GetLightfv",
+   "GetLightiv",
+   "GetMapdv",
+   "GetMapfv",
+   "GetMapiv",
+   "GetMaterialfv",
+   "GetMaterialiv",
+   "GetPixelMapfv",
+   "GetPixelMapuiv",
+   "GetPixelMapusv",
+   "GetPolygonStipple",
+   "GetString",
+   "GetTexEnvfv",
+   "GetTexEnviv",
+   "GetTexGendv",
+   "GetTexGenfv",
+   "GetTexGeniv",
+   "GetTexImage",
+   "GetTexParameterfv",
+   "GetTexParameteriv",
+   "GetTexLevelParameterfv",
+   "GetTexLevelParameteriv",
+   "IsEnabled",
+   "IsList",
+   "DepthRange",
+   "Frustum",
+   "LoadIdentity",
+   "LoadMatrixf",
+   "LoadMatrixd",
+   "MatrixMode",
+   "MultMatrixf",
+   "MultMatrixd",
+   "Ortho",
+   "PopMatrix",
+   "PushMatrix",
+   "Rotated",
+   "Rotatef",
+   "Scaled",
+   "Scalef",
+   "Translated",
+   "Translatef",
+   "Viewport",
+   "ArrayElement",
+   "BindTexture",
+   "ColorPointer",
+   "DisableClientState",
+   "DrawArrays",
+   "DrawElements",
+   "EdgeFlagPointer",
+   "EnableClientState",
+   "IndexPointer",
+   "Indexub",
+   "Indexubv",
+   "InterleavedArrays",
+   "NormalPointer",
+   "PolygonOffset",
+   "TexCoordPointer",
+   "VertexPointer",
+   "AreTexturesResident",
+   "CopyTexImage1D",
+   "CopyTexImage2D",
+   "CopyTexSubImage1D",
+   "CopyTexSubImage2D",
+   "DeleteTextures",
+   "GenTextures",
+   "GetPointerv",
+   "IsTexture",
+   "PrioritizeTextures",
+   "TexSubImage1D",
+   "TexSubImage2D",
+   "PopClientAttrib",
+   "PushClientAttrib",
+   "BlendColor",
+   "BlendEquation",
+   "DrawRangeElements",
+   "ColorTable",
+   "ColorTableParameterfv",
+   "ColorTableParameteriv",
+   "CopyColorTable",
+   "GetColorTable",
+   "GetColorTableParameterfv",
+   "GetColorTableParameteriv",
+   "ColorSubTable",
+   "CopyColorSubTable",
+   "ConvolutionFilter1D",
+   "ConvolutionFilter2D",
+   "ConvolutionParameterf",
+   "ConvolutionParameterfv",
+   "ConvolutionParameteri",
+   "ConvolutionParameteriv",
+   "CopyConvolutionFilter1D",
+   "CopyConvolutionFilter2D",
+   "GetConvolutionFilter",
+   "GetConvolutionParameterfv",
+   "GetConvolutionParameteriv",
+   "GetSeparableFilter",
+   "SeparableFilter2D",
+   "GetHistogram",
+   "GetHistogramParameterfv",
+   "GetHistogramParameteriv",
+   "GetMinmax",
+   "GetMinmaxParameterfv",
+   "GetMinmaxParameteriv",
+   "Histogram",
+   "Minmax",
+   "ResetHistogram",
+   "ResetMinmax",
+   "TexImage3D",
+   "TexSubImage3D",
+   "CopyTexSubImage3D",
+   "ActiveTextureARB",
+   "ClientActiveTextureARB",
+   "MultiTexCoord1dARB",
+   "MultiTexCoord1dvARB",
+   "MultiTexCoord1fARB",
+   "MultiTexCoord1fvARB",
+   "MultiTexCoord1iARB",
+   "MultiTexCoord1ivARB",
+   "MultiTexCoord1sARB",
+   "MultiTexCoord1svARB",
+   "MultiTexCoord2dARB",
+   "MultiTexCoord2dvARB",
+   "MultiTexCoord2fARB",
+   "MultiTexCoord2fvARB",
+   "MultiTexCoord2iARB",
+   "MultiTexCoord2ivARB",
+   "MultiTexCoord2sARB",
+   "MultiTexCoord2svARB",
+   "MultiTexCoord3dARB",
+   "MultiTexCoord3dvARB",
+   "MultiTexCoord3fARB",
+   "MultiTexCoord3fvARB",
+   "MultiTexCoord3iARB",
+   "MultiTexCoord3ivARB",
+   "MultiTexCoord3sARB",
+   "MultiTexCoord3svARB",
+   "MultiTexCoord4dARB",
+   "MultiTexCoord4dvARB",
+   "MultiTexCoord4fARB",
+   "MultiTexCoord4fvARB",
+   "MultiTexCoord4iARB",
+   "MultiTexCoord4ivARB",
+   "MultiTexCoord4sARB",
+   "MultiTexCoord4svARB",
+   "LoadTransposeMatrixfARB",
+   "LoadTransposeMatrixdARB",
+   "MultTransposeMatrixfARB",
+   "MultTransposeMatrixdARB",
+   "SampleCoverageARB",
+   "DrawBuffersARB",
+   "PolygonOffsetEXT",
+   "GetTexFilterFuncSGIS",
+   "TexFilterFuncSGIS",
+   "GetHistogramEXT",
+   "GetHistogramParameterfvEXT",
+   "GetHistogramParameterivEXT",
+   "GetMinmaxEXT",
+   "GetMinmaxParameterfvEXT",
+   "GetMinmaxParameterivEXT",
+   "GetConvolutionFilterEXT",
+   "GetConvolutionParameterfvEXT",
+   "GetConvolutionParameterivEXT",
+   "GetSeparableFilterEXT",
+   "GetColorTableSGI",
+   "GetColorTableParameterfvSGI",
+   "GetColorTableParameterivSGI",
+   "PixelTexGenSGIX",
+   "PixelTexGenParameteriSGIS",
+   "PixelTexGenParameterivSGIS",
+   "PixelTexGenParameterfSGIS",
+   "PixelTexGenParameterfvSGIS",
+   "GetPixelTexGenParameterivSGIS",
+   "GetPixelTexGenParameterfvSGIS",
+   "TexImage4DSGIS",
+   "TexSubImage4DSGIS",
+   "AreTexturesResidentEXT",
+   "GenTexturesEXT",
+   "IsTextureEXT",
+   "DetailTexFuncSGIS",
+   "GetDetailTexFuncSGIS",
+   "SharpenTexFuncSGIS",
+   "GetSharpenTexFuncSGIS",
+   "SampleMaskSGIS",
+   "SamplePatternSGIS",
+   "ColorPointerEXT",
+   "EdgeFlagPointerEXT",
+   "IndexPointerEXT",
+   "NormalPointerEXT",
+   "TexCoordPointerEXT",
+   "VertexPointerEXT",
+   "SpriteParameterfSGIX",
+   "SpriteParameterfvSGIX",
+   "SpriteParameteriSGIX",
+   "SpriteParameterivSGIX",
+   "PointParameterfEXT",
+   "PointParameterfvEXT",
+   "GetInstrumentsSGIX",
+   "InstrumentsBufferSGIX",
+   "PollInstrumentsSGIX",
+   "ReadInstrumentsSGIX",
+   "StartInstrumentsSGIX",
+   "StopInstrumentsSGIX",
+   "FrameZoomSGIX",
+   "TagSampleBufferSGIX",
+   "ReferencePlaneSGIX",
+   "FlushRasterSGIX",
+   "GetListParameterfvSGIX",
+   "GetListParameterivSGIX",
+   "ListParameterfSGIX",
+   "ListParameterfvSGIX",
+   "ListParameteriSGIX",
+   "ListParameterivSGIX",
+   "FragmentColorMaterialSGIX",
+   "FragmentLightfSGIX",
+   "FragmentLightfvSGIX",
+   "FragmentLightiSGIX",
+   "FragmentLightivSGIX",
+   "FragmentLightModelfSGIX",
+   "FragmentLightModelfvSGIX",
+   "FragmentLightModeliSGIX",
+   "FragmentLightModelivSGIX",
+   "FragmentMaterialfSGIX",
+   "FragmentMaterialfvSGIX",
+   "FragmentMaterialiSGIX",
+   "FragmentMaterialivSGIX",
+   "GetFragmentLightfvSGIX",
+   "GetFragmentLightivSGIX",
+   "GetFragmentMaterialfvSGIX",
+   "GetFragmentMaterialivSGIX",
+   "LightEnviSGIX",
+   "VertexWeightfEXT",
+   "VertexWeightfvEXT",
+   "VertexWeightPointerEXT",
+   "FlushVertexArrayRangeNV",
+   "VertexArrayRangeNV",
+   "CombinerParameterfvNV",
+   "CombinerParameterfNV",
+   "CombinerParameterivNV",
+   "CombinerParameteriNV",
+   "CombinerInputNV",
+   "CombinerOutputNV",
+   "FinalCombinerInputNV",
+   "GetCombinerInputParameterfvNV",
+   "GetCombinerInputParameterivNV",
+   "GetCombinerOutputParameterfvNV",
+   "GetCombinerOutputParameterivNV",
+   "GetFinalCombinerInputParameterfvNV",
+   "GetFinalCombinerInputParameterivNV",
+   "ResizeBuffersMESA",
+   "WindowPos2dMESA",
+   "WindowPos2dvMESA",
+   "WindowPos2fMESA",
+   "WindowPos2fvMESA",
+   "WindowPos2iMESA",
+   "WindowPos2ivMESA",
+   "WindowPos2sMESA",
+   "WindowPos2svMESA",
+   "WindowPos3dMESA",
+   "WindowPos3dvMESA",
+   "WindowPos3fMESA",
+   "WindowPos3fvMESA",
+   "WindowPos3iMESA",
+   "WindowPos3ivMESA",
+   "WindowPos3sMESA",
+   "WindowPos3svMESA",
+   "WindowPos4dMESA",
+   "WindowPos4dvMESA",
+   "WindowPos4fMESA",
+   "WindowPos4fvMESA",
+   "WindowPos4iMESA",
+   "WindowPos4ivMESA",
+   "WindowPos4sMESA",
+   "WindowPos4svMESA",
+   "BlendFuncSeparateEXT",
+   "IndexMaterialEXT",
+   "IndexFuncEXT",
+   "LockArraysEXT",
+   "UnlockArraysEXT",
+   "CullParameterdvEXT",
+   "CullParameterfvEXT",
+   "HintPGI",
+   "FogCoordfEXT",
+   "FogCoordfvEXT",
+   "FogCoorddEXT",
+   "FogCoorddvEXT",
+   "FogCoordPointerEXT",
+   "GetColorTableEXT",
+   "GetColorTableParameterivEXT",
+   "GetColorTableParameterfvEXT",
+   "TbufferMask3DFX",
+   "CompressedTexImage3DARB",
+   "CompressedTexImage2DARB",
+   "CompressedTexImage1DARB",
+   "CompressedTexSubImage3DARB",
+   "CompressedTexSubImage2DARB",
+   "CompressedTexSubImage1DARB",
+   "GetCompressedTexImageARB",
+   "SecondaryColor3bEXT",
+   "SecondaryColor3bvEXT",
+   "SecondaryColor3dEXT",
+   "SecondaryColor3dvEXT",
+   "SecondaryColor3fEXT",
+   "SecondaryColor3fvEXT",
+   "SecondaryColor3iEXT",
+   "SecondaryColor3ivEXT",
+   "SecondaryColor3sEXT",
+   "SecondaryColor3svEXT",
+   "SecondaryColor3ubEXT",
+   "SecondaryColor3ubvEXT",
+   "SecondaryColor3uiEXT",
+   "SecondaryColor3uivEXT",
+   "SecondaryColor3usEXT",
+   "SecondaryColor3usvEXT",
+   "SecondaryColorPointerEXT",
+   "AreProgramsResidentNV",
+   "BindProgramNV",
+   "DeleteProgramsNV",
+   "ExecuteProgramNV",
+   "GenProgramsNV",
+   "GetProgramParameterdvNV",
+   "GetProgramParameterfvNV",
+   "GetProgramivNV",
+   "GetProgramStringNV",
+   "GetTrackMatrixivNV",
+   "GetVertexAttribdvARB",
+   "GetVertexAttribfvARB",
+   "GetVertexAttribivARB",
+   "GetVertexAttribPointervNV",
+   "IsProgramNV",
+   "LoadProgramNV",
+   "ProgramParameter4dNV",
+   "ProgramParameter4dvNV",
+   "ProgramParameter4fNV",
+   "ProgramParameter4fvNV",
+   "ProgramParameters4dvNV",
+   "ProgramParameters4fvNV",
+   "RequestResidentProgramsNV",
+   "TrackMatrixNV",
+   "VertexAttribPointerNV",
+   "VertexAttrib1dARB",
+   "VertexAttrib1dvARB",
+   "VertexAttrib1fARB",
+   "VertexAttrib1fvARB",
+   "VertexAttrib1sARB",
+   "VertexAttrib1svARB",
+   "VertexAttrib2dARB",
+   "VertexAttrib2dvARB",
+   "VertexAttrib2fARB",
+   "VertexAttrib2fvARB",
+   "VertexAttrib2sARB",
+   "VertexAttrib2svARB",
+   "VertexAttrib3dARB",
+   "VertexAttrib3dvARB",
+   "VertexAttrib3fARB",
+   "VertexAttrib3fvARB",
+   "VertexAttrib3sARB",
+   "VertexAttrib3svARB",
+   "VertexAttrib4dARB",
+   "VertexAttrib4dvARB",
+   "VertexAttrib4fARB",
+   "VertexAttrib4fvARB",
+   "VertexAttrib4sARB",
+   "VertexAttrib4svARB",
+   "VertexAttrib4NubARB",
+   "VertexAttrib4NubvARB",
+   "VertexAttribs1dvNV",
+   "VertexAttribs1fvNV",
+   "VertexAttribs1svNV",
+   "VertexAttribs2dvNV",
+   "VertexAttribs2fvNV",
+   "VertexAttribs2svNV",
+   "VertexAttribs3dvNV",
+   "VertexAttribs3fvNV",
+   "VertexAttribs3svNV",
+   "VertexAttribs4dvNV",
+   "VertexAttribs4fvNV",
+   "VertexAttribs4svNV",
+   "VertexAttribs4ubvNV",
+   "PointParameteriNV",
+   "PointParameterivNV",
+   "MultiDrawArraysEXT",
+   "MultiDrawElementsEXT",
+   "ActiveStencilFaceEXT",
+   "DeleteFencesNV",
+   "GenFencesNV",
+   "IsFenceNV",
+   "TestFenceNV",
+   "GetFenceivNV",
+   "FinishFenceNV",
+   "SetFenceNV",
+   "VertexAttrib4bvARB",
+   "VertexAttrib4ivARB",
+   "VertexAttrib4ubvARB",
+   "VertexAttrib4usvARB",
+   "VertexAttrib4uivARB",
+   "VertexAttrib4NbvARB",
+   "VertexAttrib4NsvARB",
+   "VertexAttrib4NivARB",
+   "VertexAttrib4NusvARB",
+   "VertexAttrib4NuivARB",
+   "VertexAttribPointerARB",
+   "EnableVertexAttribArrayARB",
+   "DisableVertexAttribArrayARB",
+   "ProgramStringARB",
+   "ProgramEnvParameter4dARB",
+   "ProgramEnvParameter4dvARB",
+   "ProgramEnvParameter4fARB",
+   "ProgramEnvParameter4fvARB",
+   "ProgramLocalParameter4dARB",
+   "ProgramLocalParameter4dvARB",
+   "ProgramLocalParameter4fARB",
+   "ProgramLocalParameter4fvARB",
+   "GetProgramEnvParameterdvARB",
+   "GetProgramEnvParameterfvARB",
+   "GetProgramLocalParameterdvARB",
+   "GetProgramLocalParameterfvARB",
+   "GetProgramivARB",
+   "GetProgramStringARB",
+   "ProgramNamedParameter4fNV",
+   "ProgramNamedParameter4dNV",
+   "ProgramNamedParameter4fvNV",
+   "ProgramNamedParameter4dvNV",
+   "GetProgramNamedParameterfvNV",
+   "GetProgramNamedParameterdvNV",
+   "BindBufferARB",
+   "BufferDataARB",
+   "BufferSubDataARB",
+   "DeleteBuffersARB",
+   "GenBuffersARB",
+   "GetBufferParameterivARB",
+   "GetBufferPointervARB",
+   "GetBufferSubDataARB",
+   "IsBufferARB",
+   "MapBufferARB",
+   "UnmapBufferARB",
+   "DepthBoundsEXT",
+   "GenQueriesARB",
+   "DeleteQueriesARB",
+   "IsQueryARB",
+   "BeginQueryARB",
+   "EndQueryARB",
+   "GetQueryivARB",
+   "GetQueryObjectivARB",
+   "GetQueryObjectuivARB",
+   "MultiModeDrawArraysIBM",
+   "MultiModeDrawElementsIBM",
+   "BlendEquationSeparateEXT",
+   "DeleteObjectARB",
+   "GetHandleARB",
+   "DetachObjectARB",
+   "CreateShaderObjectARB",
+   "ShaderSourceARB",
+   "CompileShaderARB",
+   "CreateProgramObjectARB",
+   "AttachObjectARB",
+   "LinkProgramARB",
+   "UseProgramObjectARB",
+   "ValidateProgramARB",
+   "Uniform1fARB",
+   "Uniform2fARB",
+   "Uniform3fARB",
+   "Uniform4fARB",
+   "Uniform1iARB",
+   "Uniform2iARB",
+   "Uniform3iARB",
+   "Uniform4iARB",
+   "Uniform1fvARB",
+   "Uniform2fvARB",
+   "Uniform3fvARB",
+   "Uniform4fvARB",
+   "Uniform1ivARB",
+   "Uniform2ivARB",
+   "Uniform3ivARB",
+   "Uniform4ivARB",
+   "UniformMatrix2fvARB",
+   "UniformMatrix3fvARB",
+   "UniformMatrix4fvARB",
+   "GetObjectParameterfvARB",
+   "GetObjectParameterivARB",
+   "GetInfoLogARB",
+   "GetAttachedObjectsARB",
+   "GetUniformLocationARB",
+   "GetActiveUniformARB",
+   "GetUniformfvARB",
+   "GetUniformivARB",
+   "GetShaderSourceARB",
+   "BindAttribLocationARB",
+   "GetActiveAttribARB",
+   "GetAttribLocationARB",
+   "GetVertexAttribdvNV",
+   "GetVertexAttribfvNV",
+   "GetVertexAttribivNV",
+   "VertexAttrib1dNV",
+   "VertexAttrib1dvNV",
+   "VertexAttrib1fNV",
+   "VertexAttrib1fvNV",
+   "VertexAttrib1sNV",
+   "VertexAttrib1svNV",
+   "VertexAttrib2dNV",
+   "VertexAttrib2dvNV",
+   "VertexAttrib2fNV",
+   "VertexAttrib2fvNV",
+   "VertexAttrib2sNV",
+   "VertexAttrib2svNV",
+   "VertexAttrib3dNV",
+   "VertexAttrib3dvNV",
+   "VertexAttrib3fNV",
+   "VertexAttrib3fvNV",
+   "VertexAttrib3sNV",
+   "VertexAttrib3svNV",
+   "VertexAttrib4dNV",
+   "VertexAttrib4dvNV",
+   "VertexAttrib4fNV",
+   "VertexAttrib4fvNV",
+   "VertexAttrib4sNV",
+   "VertexAttrib4svNV",
+   "VertexAttrib4ubNV",
+   "VertexAttrib4ubvNV",
+   "GenFragmentShadersATI",
+   "BindFragmentShaderATI",
+   "DeleteFragmentShaderATI",
+   "BeginFragmentShaderATI",
+   "EndFragmentShaderATI",
+   "PassTexCoordATI",
+   "SampleMapATI",
+   "ColorFragmentOp1ATI",
+   "ColorFragmentOp2ATI",
+   "ColorFragmentOp3ATI",
+   "AlphaFragmentOp1ATI",
+   "AlphaFragmentOp2ATI",
+   "AlphaFragmentOp3ATI",
+   "SetFragmentShaderConstantATI",
+   "IsRenderbufferEXT",
+   "BindRenderbufferEXT",
+   "DeleteRenderbuffersEXT",
+   "GenRenderbuffersEXT",
+   "RenderbufferStorageEXT",
+   "GetRenderbufferParameterivEXT",
+   "IsFramebufferEXT",
+   "BindFramebufferEXT",
+   "DeleteFramebuffersEXT",
+   "GenFramebuffersEXT",
+   "CheckFramebufferStatusEXT",
+   "FramebufferTexture1DEXT",
+   "FramebufferTexture2DEXT",
+   "FramebufferTexture3DEXT",
+   "FramebufferRenderbufferEXT",
+   "GetFramebufferAttachmentParameterivEXT",
+   "GenerateMipmapEXT",
+   "StencilFuncSeparate",
+   "StencilOpSeparate",
+   "StencilMaskSeparate",
+};
+
+#else /* TRACE_FUNCTIONS */
+
+static void GLAPIENTRY
+trace_NewList(GLuint list, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_NewList);
+      trace_write(&list, sizeof(list));
+      trace_write(&mode, sizeof(mode));
+      CALL_NewList(ctx->CurrentDispatch, (list, mode));
+      trace_restore_dispatch(ctx);
+      trace_unlock();
+   }
+   else {
+      CALL_NewList(ctx->CurrentDispatch, (list, mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_EndList(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EndList);
+      CALL_EndList(ctx->CurrentDispatch, ());
+      trace_restore_dispatch(ctx);
+      trace_unlock();
+   }
+   else {
+      CALL_EndList(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_CallList(GLuint list)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CallList);
+      trace_write(&list, sizeof(list));
+      CALL_CallList(ctx->CurrentDispatch, (list));
+      trace_restore_dispatch(ctx);
+      trace_unlock();
+   }
+   else {
+      CALL_CallList(ctx->CurrentDispatch, (list));
+   }
+}
+
+static void GLAPIENTRY
+trace_CallLists(GLsizei n, GLenum type, const GLvoid * lists)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CallLists);
+      trace_write(&n, sizeof(n));
+      trace_write(&type, sizeof(type));
+      trace_array(lists, list_bytes(n, type));
+      CALL_CallLists(ctx->CurrentDispatch, (n, type, lists));
+      trace_restore_dispatch(ctx);
+      trace_unlock();
+   }
+   else {
+      CALL_CallLists(ctx->CurrentDispatch, (n, type, lists));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteLists(GLuint list, GLsizei range)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteLists);
+      trace_write(&list, sizeof(list));
+      trace_write(&range, sizeof(range));
+      CALL_DeleteLists(ctx->CurrentDispatch, (list, range));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteLists(ctx->CurrentDispatch, (list, range));
+   }
+}
+
+static GLuint GLAPIENTRY
+trace_GenLists(GLsizei range)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLuint ret;
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenLists);
+      trace_write(&range, sizeof(range));
+      ret = CALL_GenLists(ctx->CurrentDispatch, (range));
+      trace_unlock();
+   }
+   else {
+      ret = CALL_GenLists(ctx->CurrentDispatch, (range));
+   }
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_ListBase(GLuint base)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ListBase);
+      trace_write(&base, sizeof(base));
+      CALL_ListBase(ctx->CurrentDispatch, (base));
+      trace_unlock();
+   }
+   else {
+      CALL_ListBase(ctx->CurrentDispatch, (base));
+   }
+}
+
+static void GLAPIENTRY
+trace_Begin(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Begin);
+      trace_write(&mode, sizeof(mode));
+      CALL_Begin(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      CALL_Begin(ctx->CurrentDispatch, (mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_Bitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte * bitmap)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Bitmap);
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&xorig, sizeof(xorig));
+      trace_write(&yorig, sizeof(yorig));
+      trace_write(&xmove, sizeof(xmove));
+      trace_write(&ymove, sizeof(ymove));
+      trace_array(bitmap, image_bytes(&ctx->Unpack, 2, width, height, 1, GL_COLOR_INDEX, GL_BITMAP, bitmap));
+      CALL_Bitmap(ctx->CurrentDispatch, (width, height, xorig, yorig, xmove, ymove, bitmap));
+      trace_unlock();
+   }
+   else {
+      CALL_Bitmap(ctx->CurrentDispatch, (width, height, xorig, yorig, xmove, ymove, bitmap));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3b(GLbyte red, GLbyte green, GLbyte blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3b);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_Color3b(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3b(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3bv(const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3bv);
+      trace_array(v, 3 * sizeof(GLbyte));
+      CALL_Color3bv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3bv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3d(GLdouble red, GLdouble green, GLdouble blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3d);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_Color3d(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3d(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3dv);
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_Color3dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3f(GLfloat red, GLfloat green, GLfloat blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3f);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_Color3f(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3f(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3fv);
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_Color3fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3i(GLint red, GLint green, GLint blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3i);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_Color3i(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3i(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3iv);
+      trace_array(v, 3 * sizeof(GLint));
+      CALL_Color3iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3s(GLshort red, GLshort green, GLshort blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3s);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_Color3s(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3s(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3sv);
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_Color3sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3ub(GLubyte red, GLubyte green, GLubyte blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3ub);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_Color3ub(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3ub(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3ubv(const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3ubv);
+      trace_array(v, 3 * sizeof(GLubyte));
+      CALL_Color3ubv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3ubv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3ui(GLuint red, GLuint green, GLuint blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3ui);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_Color3ui(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3ui(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3uiv(const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3uiv);
+      trace_array(v, 3 * sizeof(GLuint));
+      CALL_Color3uiv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3uiv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3us(GLushort red, GLushort green, GLushort blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3us);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_Color3us(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3us(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color3usv(const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color3usv);
+      trace_array(v, 3 * sizeof(GLushort));
+      CALL_Color3usv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color3usv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4b);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_Color4b(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4b(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4bv(const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4bv);
+      trace_array(v, 4 * sizeof(GLbyte));
+      CALL_Color4bv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4bv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4d);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_Color4d(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4d(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4dv);
+      trace_array(v, 4 * sizeof(GLdouble));
+      CALL_Color4dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4f);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_Color4f(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4f(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4fv);
+      trace_array(v, 4 * sizeof(GLfloat));
+      CALL_Color4fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4i(GLint red, GLint green, GLint blue, GLint alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4i);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_Color4i(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4i(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4iv);
+      trace_array(v, 4 * sizeof(GLint));
+      CALL_Color4iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4s(GLshort red, GLshort green, GLshort blue, GLshort alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4s);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_Color4s(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4s(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4sv);
+      trace_array(v, 4 * sizeof(GLshort));
+      CALL_Color4sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4ub);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_Color4ub(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4ub(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4ubv(const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4ubv);
+      trace_array(v, 4 * sizeof(GLubyte));
+      CALL_Color4ubv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4ubv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4ui);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_Color4ui(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4ui(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4uiv(const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4uiv);
+      trace_array(v, 4 * sizeof(GLuint));
+      CALL_Color4uiv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4uiv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4us(GLushort red, GLushort green, GLushort blue, GLushort alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4us);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_Color4us(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4us(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_Color4usv(const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Color4usv);
+      trace_array(v, 4 * sizeof(GLushort));
+      CALL_Color4usv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Color4usv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_EdgeFlag(GLboolean flag)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EdgeFlag);
+      trace_write(&flag, sizeof(flag));
+      CALL_EdgeFlag(ctx->CurrentDispatch, (flag));
+      trace_unlock();
+   }
+   else {
+      CALL_EdgeFlag(ctx->CurrentDispatch, (flag));
+   }
+}
+
+static void GLAPIENTRY
+trace_EdgeFlagv(const GLboolean * flag)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EdgeFlagv);
+      trace_array(flag, 1 * sizeof(GLboolean));
+      CALL_EdgeFlagv(ctx->CurrentDispatch, (flag));
+      trace_unlock();
+   }
+   else {
+      CALL_EdgeFlagv(ctx->CurrentDispatch, (flag));
+   }
+}
+
+static void GLAPIENTRY
+trace_End(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_End);
+      CALL_End(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_End(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexd(GLdouble c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexd);
+      trace_write(&c, sizeof(c));
+      CALL_Indexd(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexd(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexdv(const GLdouble * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexdv);
+      trace_array(c, 1 * sizeof(GLdouble));
+      CALL_Indexdv(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexdv(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexf(GLfloat c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexf);
+      trace_write(&c, sizeof(c));
+      CALL_Indexf(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexf(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexfv(const GLfloat * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexfv);
+      trace_array(c, 1 * sizeof(GLfloat));
+      CALL_Indexfv(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexfv(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexi(GLint c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexi);
+      trace_write(&c, sizeof(c));
+      CALL_Indexi(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexi(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexiv(const GLint * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexiv);
+      trace_array(c, 1 * sizeof(GLint));
+      CALL_Indexiv(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexiv(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexs(GLshort c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexs);
+      trace_write(&c, sizeof(c));
+      CALL_Indexs(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexs(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexsv(const GLshort * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexsv);
+      trace_array(c, 1 * sizeof(GLshort));
+      CALL_Indexsv(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexsv(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3b(GLbyte nx, GLbyte ny, GLbyte nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3b);
+      trace_write(&nx, sizeof(nx));
+      trace_write(&ny, sizeof(ny));
+      trace_write(&nz, sizeof(nz));
+      CALL_Normal3b(ctx->CurrentDispatch, (nx, ny, nz));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3b(ctx->CurrentDispatch, (nx, ny, nz));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3bv(const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3bv);
+      trace_array(v, 3 * sizeof(GLbyte));
+      CALL_Normal3bv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3bv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3d(GLdouble nx, GLdouble ny, GLdouble nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3d);
+      trace_write(&nx, sizeof(nx));
+      trace_write(&ny, sizeof(ny));
+      trace_write(&nz, sizeof(nz));
+      CALL_Normal3d(ctx->CurrentDispatch, (nx, ny, nz));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3d(ctx->CurrentDispatch, (nx, ny, nz));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3dv);
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_Normal3dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3f);
+      trace_write(&nx, sizeof(nx));
+      trace_write(&ny, sizeof(ny));
+      trace_write(&nz, sizeof(nz));
+      CALL_Normal3f(ctx->CurrentDispatch, (nx, ny, nz));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3f(ctx->CurrentDispatch, (nx, ny, nz));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3fv);
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_Normal3fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3i(GLint nx, GLint ny, GLint nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3i);
+      trace_write(&nx, sizeof(nx));
+      trace_write(&ny, sizeof(ny));
+      trace_write(&nz, sizeof(nz));
+      CALL_Normal3i(ctx->CurrentDispatch, (nx, ny, nz));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3i(ctx->CurrentDispatch, (nx, ny, nz));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3iv);
+      trace_array(v, 3 * sizeof(GLint));
+      CALL_Normal3iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3s(GLshort nx, GLshort ny, GLshort nz)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3s);
+      trace_write(&nx, sizeof(nx));
+      trace_write(&ny, sizeof(ny));
+      trace_write(&nz, sizeof(nz));
+      CALL_Normal3s(ctx->CurrentDispatch, (nx, ny, nz));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3s(ctx->CurrentDispatch, (nx, ny, nz));
+   }
+}
+
+static void GLAPIENTRY
+trace_Normal3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Normal3sv);
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_Normal3sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Normal3sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos2d(GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos2d);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_RasterPos2d(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos2d(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos2dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos2dv);
+      trace_array(v, 2 * sizeof(GLdouble));
+      CALL_RasterPos2dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos2dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos2f(GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos2f);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_RasterPos2f(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos2f(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos2fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos2fv);
+      trace_array(v, 2 * sizeof(GLfloat));
+      CALL_RasterPos2fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos2fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos2i(GLint x, GLint y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos2i);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_RasterPos2i(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos2i(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos2iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos2iv);
+      trace_array(v, 2 * sizeof(GLint));
+      CALL_RasterPos2iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos2iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos2s(GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos2s);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_RasterPos2s(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos2s(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos2sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos2sv);
+      trace_array(v, 2 * sizeof(GLshort));
+      CALL_RasterPos2sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos2sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos3d(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos3d);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_RasterPos3d(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos3d(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos3dv);
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_RasterPos3dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos3dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos3f(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos3f);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_RasterPos3f(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos3f(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos3fv);
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_RasterPos3fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos3fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos3i(GLint x, GLint y, GLint z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos3i);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_RasterPos3i(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos3i(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos3iv);
+      trace_array(v, 3 * sizeof(GLint));
+      CALL_RasterPos3iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos3iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos3s(GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos3s);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_RasterPos3s(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos3s(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos3sv);
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_RasterPos3sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos3sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos4d);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_RasterPos4d(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos4d(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos4dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos4dv);
+      trace_array(v, 4 * sizeof(GLdouble));
+      CALL_RasterPos4dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos4dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos4f);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_RasterPos4f(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos4f(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos4fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos4fv);
+      trace_array(v, 4 * sizeof(GLfloat));
+      CALL_RasterPos4fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos4fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos4i(GLint x, GLint y, GLint z, GLint w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos4i);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_RasterPos4i(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos4i(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos4iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos4iv);
+      trace_array(v, 4 * sizeof(GLint));
+      CALL_RasterPos4iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos4iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos4s);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_RasterPos4s(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos4s(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_RasterPos4sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RasterPos4sv);
+      trace_array(v, 4 * sizeof(GLshort));
+      CALL_RasterPos4sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_RasterPos4sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Rectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Rectd);
+      trace_write(&x1, sizeof(x1));
+      trace_write(&y1, sizeof(y1));
+      trace_write(&x2, sizeof(x2));
+      trace_write(&y2, sizeof(y2));
+      CALL_Rectd(ctx->CurrentDispatch, (x1, y1, x2, y2));
+      trace_unlock();
+   }
+   else {
+      CALL_Rectd(ctx->CurrentDispatch, (x1, y1, x2, y2));
+   }
+}
+
+static void GLAPIENTRY
+trace_Rectdv(const GLdouble * v1, const GLdouble * v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Rectdv);
+      trace_array(v1, 2 * sizeof(GLdouble));
+      trace_array(v2, 2 * sizeof(GLdouble));
+      CALL_Rectdv(ctx->CurrentDispatch, (v1, v2));
+      trace_unlock();
+   }
+   else {
+      CALL_Rectdv(ctx->CurrentDispatch, (v1, v2));
+   }
+}
+
+static void GLAPIENTRY
+trace_Rectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Rectf);
+      trace_write(&x1, sizeof(x1));
+      trace_write(&y1, sizeof(y1));
+      trace_write(&x2, sizeof(x2));
+      trace_write(&y2, sizeof(y2));
+      CALL_Rectf(ctx->CurrentDispatch, (x1, y1, x2, y2));
+      trace_unlock();
+   }
+   else {
+      CALL_Rectf(ctx->CurrentDispatch, (x1, y1, x2, y2));
+   }
+}
+
+static void GLAPIENTRY
+trace_Rectfv(const GLfloat * v1, const GLfloat * v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Rectfv);
+      trace_array(v1, 2 * sizeof(GLfloat));
+      trace_array(v2, 2 * sizeof(GLfloat));
+      CALL_Rectfv(ctx->CurrentDispatch, (v1, v2));
+      trace_unlock();
+   }
+   else {
+      CALL_Rectfv(ctx->CurrentDispatch, (v1, v2));
+   }
+}
+
+static void GLAPIENTRY
+trace_Recti(GLint x1, GLint y1, GLint x2, GLint y2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Recti);
+      trace_write(&x1, sizeof(x1));
+      trace_write(&y1, sizeof(y1));
+      trace_write(&x2, sizeof(x2));
+      trace_write(&y2, sizeof(y2));
+      CALL_Recti(ctx->CurrentDispatch, (x1, y1, x2, y2));
+      trace_unlock();
+   }
+   else {
+      CALL_Recti(ctx->CurrentDispatch, (x1, y1, x2, y2));
+   }
+}
+
+static void GLAPIENTRY
+trace_Rectiv(const GLint * v1, const GLint * v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Rectiv);
+      trace_array(v1, 2 * sizeof(GLint));
+      trace_array(v2, 2 * sizeof(GLint));
+      CALL_Rectiv(ctx->CurrentDispatch, (v1, v2));
+      trace_unlock();
+   }
+   else {
+      CALL_Rectiv(ctx->CurrentDispatch, (v1, v2));
+   }
+}
+
+static void GLAPIENTRY
+trace_Rects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Rects);
+      trace_write(&x1, sizeof(x1));
+      trace_write(&y1, sizeof(y1));
+      trace_write(&x2, sizeof(x2));
+      trace_write(&y2, sizeof(y2));
+      CALL_Rects(ctx->CurrentDispatch, (x1, y1, x2, y2));
+      trace_unlock();
+   }
+   else {
+      CALL_Rects(ctx->CurrentDispatch, (x1, y1, x2, y2));
+   }
+}
+
+static void GLAPIENTRY
+trace_Rectsv(const GLshort * v1, const GLshort * v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Rectsv);
+      trace_array(v1, 2 * sizeof(GLshort));
+      trace_array(v2, 2 * sizeof(GLshort));
+      CALL_Rectsv(ctx->CurrentDispatch, (v1, v2));
+      trace_unlock();
+   }
+   else {
+      CALL_Rectsv(ctx->CurrentDispatch, (v1, v2));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord1d(GLdouble s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord1d);
+      trace_write(&s, sizeof(s));
+      CALL_TexCoord1d(ctx->CurrentDispatch, (s));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord1d(ctx->CurrentDispatch, (s));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord1dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord1dv);
+      trace_array(v, 1 * sizeof(GLdouble));
+      CALL_TexCoord1dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord1dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord1f(GLfloat s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord1f);
+      trace_write(&s, sizeof(s));
+      CALL_TexCoord1f(ctx->CurrentDispatch, (s));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord1f(ctx->CurrentDispatch, (s));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord1fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord1fv);
+      trace_array(v, 1 * sizeof(GLfloat));
+      CALL_TexCoord1fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord1fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord1i(GLint s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord1i);
+      trace_write(&s, sizeof(s));
+      CALL_TexCoord1i(ctx->CurrentDispatch, (s));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord1i(ctx->CurrentDispatch, (s));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord1iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord1iv);
+      trace_array(v, 1 * sizeof(GLint));
+      CALL_TexCoord1iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord1iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord1s(GLshort s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord1s);
+      trace_write(&s, sizeof(s));
+      CALL_TexCoord1s(ctx->CurrentDispatch, (s));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord1s(ctx->CurrentDispatch, (s));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord1sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord1sv);
+      trace_array(v, 1 * sizeof(GLshort));
+      CALL_TexCoord1sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord1sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord2d(GLdouble s, GLdouble t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord2d);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      CALL_TexCoord2d(ctx->CurrentDispatch, (s, t));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord2d(ctx->CurrentDispatch, (s, t));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord2dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord2dv);
+      trace_array(v, 2 * sizeof(GLdouble));
+      CALL_TexCoord2dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord2dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord2f(GLfloat s, GLfloat t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord2f);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      CALL_TexCoord2f(ctx->CurrentDispatch, (s, t));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord2f(ctx->CurrentDispatch, (s, t));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord2fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord2fv);
+      trace_array(v, 2 * sizeof(GLfloat));
+      CALL_TexCoord2fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord2fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord2i(GLint s, GLint t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord2i);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      CALL_TexCoord2i(ctx->CurrentDispatch, (s, t));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord2i(ctx->CurrentDispatch, (s, t));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord2iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord2iv);
+      trace_array(v, 2 * sizeof(GLint));
+      CALL_TexCoord2iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord2iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord2s(GLshort s, GLshort t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord2s);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      CALL_TexCoord2s(ctx->CurrentDispatch, (s, t));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord2s(ctx->CurrentDispatch, (s, t));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord2sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord2sv);
+      trace_array(v, 2 * sizeof(GLshort));
+      CALL_TexCoord2sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord2sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord3d(GLdouble s, GLdouble t, GLdouble r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord3d);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      CALL_TexCoord3d(ctx->CurrentDispatch, (s, t, r));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord3d(ctx->CurrentDispatch, (s, t, r));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord3dv);
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_TexCoord3dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord3dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord3f(GLfloat s, GLfloat t, GLfloat r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord3f);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      CALL_TexCoord3f(ctx->CurrentDispatch, (s, t, r));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord3f(ctx->CurrentDispatch, (s, t, r));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord3fv);
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_TexCoord3fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord3fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord3i(GLint s, GLint t, GLint r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord3i);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      CALL_TexCoord3i(ctx->CurrentDispatch, (s, t, r));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord3i(ctx->CurrentDispatch, (s, t, r));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord3iv);
+      trace_array(v, 3 * sizeof(GLint));
+      CALL_TexCoord3iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord3iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord3s(GLshort s, GLshort t, GLshort r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord3s);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      CALL_TexCoord3s(ctx->CurrentDispatch, (s, t, r));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord3s(ctx->CurrentDispatch, (s, t, r));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord3sv);
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_TexCoord3sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord3sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord4d);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      trace_write(&q, sizeof(q));
+      CALL_TexCoord4d(ctx->CurrentDispatch, (s, t, r, q));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord4d(ctx->CurrentDispatch, (s, t, r, q));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord4dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord4dv);
+      trace_array(v, 4 * sizeof(GLdouble));
+      CALL_TexCoord4dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord4dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord4f);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      trace_write(&q, sizeof(q));
+      CALL_TexCoord4f(ctx->CurrentDispatch, (s, t, r, q));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord4f(ctx->CurrentDispatch, (s, t, r, q));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord4fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord4fv);
+      trace_array(v, 4 * sizeof(GLfloat));
+      CALL_TexCoord4fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord4fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord4i(GLint s, GLint t, GLint r, GLint q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord4i);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      trace_write(&q, sizeof(q));
+      CALL_TexCoord4i(ctx->CurrentDispatch, (s, t, r, q));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord4i(ctx->CurrentDispatch, (s, t, r, q));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord4iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord4iv);
+      trace_array(v, 4 * sizeof(GLint));
+      CALL_TexCoord4iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord4iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord4s);
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      trace_write(&q, sizeof(q));
+      CALL_TexCoord4s(ctx->CurrentDispatch, (s, t, r, q));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord4s(ctx->CurrentDispatch, (s, t, r, q));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoord4sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexCoord4sv);
+      trace_array(v, 4 * sizeof(GLshort));
+      CALL_TexCoord4sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoord4sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex2d(GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex2d);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_Vertex2d(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex2d(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex2dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex2dv);
+      trace_array(v, 2 * sizeof(GLdouble));
+      CALL_Vertex2dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex2dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex2f(GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex2f);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_Vertex2f(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex2f(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex2fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex2fv);
+      trace_array(v, 2 * sizeof(GLfloat));
+      CALL_Vertex2fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex2fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex2i(GLint x, GLint y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex2i);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_Vertex2i(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex2i(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex2iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex2iv);
+      trace_array(v, 2 * sizeof(GLint));
+      CALL_Vertex2iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex2iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex2s(GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex2s);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_Vertex2s(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex2s(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex2sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex2sv);
+      trace_array(v, 2 * sizeof(GLshort));
+      CALL_Vertex2sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex2sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex3d(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex3d);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Vertex3d(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex3d(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex3dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex3dv);
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_Vertex3dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex3dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex3f(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex3f);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Vertex3f(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex3f(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex3fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex3fv);
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_Vertex3fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex3fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex3i(GLint x, GLint y, GLint z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex3i);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Vertex3i(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex3i(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex3iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex3iv);
+      trace_array(v, 3 * sizeof(GLint));
+      CALL_Vertex3iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex3iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex3s(GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex3s);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Vertex3s(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex3s(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex3sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex3sv);
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_Vertex3sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex3sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex4d);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_Vertex4d(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex4d(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex4dv(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex4dv);
+      trace_array(v, 4 * sizeof(GLdouble));
+      CALL_Vertex4dv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex4dv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex4f);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_Vertex4f(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex4f(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex4fv(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex4fv);
+      trace_array(v, 4 * sizeof(GLfloat));
+      CALL_Vertex4fv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex4fv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex4i(GLint x, GLint y, GLint z, GLint w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex4i);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_Vertex4i(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex4i(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex4iv(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex4iv);
+      trace_array(v, 4 * sizeof(GLint));
+      CALL_Vertex4iv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex4iv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex4s);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_Vertex4s(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex4s(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_Vertex4sv(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Vertex4sv);
+      trace_array(v, 4 * sizeof(GLshort));
+      CALL_Vertex4sv(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_Vertex4sv(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_ClipPlane(GLenum plane, const GLdouble * equation)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ClipPlane);
+      trace_write(&plane, sizeof(plane));
+      trace_array(equation, 4 * sizeof(GLdouble));
+      CALL_ClipPlane(ctx->CurrentDispatch, (plane, equation));
+      trace_unlock();
+   }
+   else {
+      CALL_ClipPlane(ctx->CurrentDispatch, (plane, equation));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorMaterial(GLenum face, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ColorMaterial);
+      trace_write(&face, sizeof(face));
+      trace_write(&mode, sizeof(mode));
+      CALL_ColorMaterial(ctx->CurrentDispatch, (face, mode));
+      trace_unlock();
+   }
+   else {
+      CALL_ColorMaterial(ctx->CurrentDispatch, (face, mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_CullFace(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CullFace);
+      trace_write(&mode, sizeof(mode));
+      CALL_CullFace(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      CALL_CullFace(ctx->CurrentDispatch, (mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_Fogf(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Fogf);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_Fogf(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_Fogf(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_Fogfv(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Fogfv);
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_fog_count(pname) * sizeof(GLfloat));
+      CALL_Fogfv(ctx->CurrentDispatch, (pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_Fogfv(ctx->CurrentDispatch, (pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_Fogi(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Fogi);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_Fogi(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_Fogi(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_Fogiv(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Fogiv);
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_fog_count(pname) * sizeof(GLint));
+      CALL_Fogiv(ctx->CurrentDispatch, (pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_Fogiv(ctx->CurrentDispatch, (pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_FrontFace(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FrontFace);
+      trace_write(&mode, sizeof(mode));
+      CALL_FrontFace(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      CALL_FrontFace(ctx->CurrentDispatch, (mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_Hint(GLenum target, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Hint);
+      trace_write(&target, sizeof(target));
+      trace_write(&mode, sizeof(mode));
+      CALL_Hint(ctx->CurrentDispatch, (target, mode));
+      trace_unlock();
+   }
+   else {
+      CALL_Hint(ctx->CurrentDispatch, (target, mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_Lightf(GLenum light, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Lightf);
+      trace_write(&light, sizeof(light));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_Lightf(ctx->CurrentDispatch, (light, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_Lightf(ctx->CurrentDispatch, (light, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_Lightfv(GLenum light, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Lightfv);
+      trace_write(&light, sizeof(light));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_light_count(pname) * sizeof(GLfloat));
+      CALL_Lightfv(ctx->CurrentDispatch, (light, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_Lightfv(ctx->CurrentDispatch, (light, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_Lighti(GLenum light, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Lighti);
+      trace_write(&light, sizeof(light));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_Lighti(ctx->CurrentDispatch, (light, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_Lighti(ctx->CurrentDispatch, (light, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_Lightiv(GLenum light, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Lightiv);
+      trace_write(&light, sizeof(light));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_light_count(pname) * sizeof(GLint));
+      CALL_Lightiv(ctx->CurrentDispatch, (light, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_Lightiv(ctx->CurrentDispatch, (light, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_LightModelf(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LightModelf);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_LightModelf(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_LightModelf(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_LightModelfv(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LightModelfv);
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_light_model_count(pname) * sizeof(GLfloat));
+      CALL_LightModelfv(ctx->CurrentDispatch, (pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_LightModelfv(ctx->CurrentDispatch, (pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_LightModeli(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LightModeli);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_LightModeli(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_LightModeli(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_LightModeliv(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LightModeliv);
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_light_model_count(pname) * sizeof(GLint));
+      CALL_LightModeliv(ctx->CurrentDispatch, (pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_LightModeliv(ctx->CurrentDispatch, (pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_LineStipple(GLint factor, GLushort pattern)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LineStipple);
+      trace_write(&factor, sizeof(factor));
+      trace_write(&pattern, sizeof(pattern));
+      CALL_LineStipple(ctx->CurrentDispatch, (factor, pattern));
+      trace_unlock();
+   }
+   else {
+      CALL_LineStipple(ctx->CurrentDispatch, (factor, pattern));
+   }
+}
+
+static void GLAPIENTRY
+trace_LineWidth(GLfloat width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LineWidth);
+      trace_write(&width, sizeof(width));
+      CALL_LineWidth(ctx->CurrentDispatch, (width));
+      trace_unlock();
+   }
+   else {
+      CALL_LineWidth(ctx->CurrentDispatch, (width));
+   }
+}
+
+static void GLAPIENTRY
+trace_Materialf(GLenum face, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Materialf);
+      trace_write(&face, sizeof(face));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_Materialf(ctx->CurrentDispatch, (face, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_Materialf(ctx->CurrentDispatch, (face, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_Materialfv(GLenum face, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Materialfv);
+      trace_write(&face, sizeof(face));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_material_count(pname) * sizeof(GLfloat));
+      CALL_Materialfv(ctx->CurrentDispatch, (face, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_Materialfv(ctx->CurrentDispatch, (face, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_Materiali(GLenum face, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Materiali);
+      trace_write(&face, sizeof(face));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_Materiali(ctx->CurrentDispatch, (face, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_Materiali(ctx->CurrentDispatch, (face, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_Materialiv(GLenum face, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Materialiv);
+      trace_write(&face, sizeof(face));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_material_count(pname) * sizeof(GLint));
+      CALL_Materialiv(ctx->CurrentDispatch, (face, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_Materialiv(ctx->CurrentDispatch, (face, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_PointSize(GLfloat size)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PointSize);
+      trace_write(&size, sizeof(size));
+      CALL_PointSize(ctx->CurrentDispatch, (size));
+      trace_unlock();
+   }
+   else {
+      CALL_PointSize(ctx->CurrentDispatch, (size));
+   }
+}
+
+static void GLAPIENTRY
+trace_PolygonMode(GLenum face, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PolygonMode);
+      trace_write(&face, sizeof(face));
+      trace_write(&mode, sizeof(mode));
+      CALL_PolygonMode(ctx->CurrentDispatch, (face, mode));
+      trace_unlock();
+   }
+   else {
+      CALL_PolygonMode(ctx->CurrentDispatch, (face, mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_PolygonStipple(const GLubyte * mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PolygonStipple);
+      trace_array(mask, image_bytes(&ctx->Unpack, 2, 32, 32, 1, GL_COLOR_INDEX, GL_BITMAP, mask));
+      CALL_PolygonStipple(ctx->CurrentDispatch, (mask));
+      trace_unlock();
+   }
+   else {
+      CALL_PolygonStipple(ctx->CurrentDispatch, (mask));
+   }
+}
+
+static void GLAPIENTRY
+trace_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Scissor);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      CALL_Scissor(ctx->CurrentDispatch, (x, y, width, height));
+      trace_unlock();
+   }
+   else {
+      CALL_Scissor(ctx->CurrentDispatch, (x, y, width, height));
+   }
+}
+
+static void GLAPIENTRY
+trace_ShadeModel(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ShadeModel);
+      trace_write(&mode, sizeof(mode));
+      CALL_ShadeModel(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      CALL_ShadeModel(ctx->CurrentDispatch, (mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexParameterf(GLenum target, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexParameterf);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_TexParameterf(ctx->CurrentDispatch, (target, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_TexParameterf(ctx->CurrentDispatch, (target, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexParameterfv);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_tex_parameter_count(pname) * sizeof(GLfloat));
+      CALL_TexParameterfv(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_TexParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexParameteri(GLenum target, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexParameteri);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_TexParameteri(ctx->CurrentDispatch, (target, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_TexParameteri(ctx->CurrentDispatch, (target, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexParameteriv);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_tex_parameter_count(pname) * sizeof(GLint));
+      CALL_TexParameteriv(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_TexParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexImage1D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&border, sizeof(border));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(pixels, image_bytes(&ctx->Unpack, 1, width, 1, 1, format, type, pixels));
+      CALL_TexImage1D(ctx->CurrentDispatch, (target, level, internalformat, width, border, format, type, pixels));
+      trace_unlock();
+   }
+   else {
+      CALL_TexImage1D(ctx->CurrentDispatch, (target, level, internalformat, width, border, format, type, pixels));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexImage2D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&border, sizeof(border));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(pixels, image_bytes(&ctx->Unpack, 2, width, height, 1, format, type, pixels));
+      CALL_TexImage2D(ctx->CurrentDispatch, (target, level, internalformat, width, height, border, format, type, pixels));
+      trace_unlock();
+   }
+   else {
+      CALL_TexImage2D(ctx->CurrentDispatch, (target, level, internalformat, width, height, border, format, type, pixels));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexEnvf(GLenum target, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexEnvf);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_TexEnvf(ctx->CurrentDispatch, (target, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_TexEnvf(ctx->CurrentDispatch, (target, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexEnvfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexEnvfv);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_tex_env_count(pname) * sizeof(GLfloat));
+      CALL_TexEnvfv(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_TexEnvfv(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexEnvi(GLenum target, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexEnvi);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_TexEnvi(ctx->CurrentDispatch, (target, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_TexEnvi(ctx->CurrentDispatch, (target, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexEnviv(GLenum target, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexEnviv);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_tex_env_count(pname) * sizeof(GLint));
+      CALL_TexEnviv(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_TexEnviv(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexGend(GLenum coord, GLenum pname, GLdouble param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexGend);
+      trace_write(&coord, sizeof(coord));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_TexGend(ctx->CurrentDispatch, (coord, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_TexGend(ctx->CurrentDispatch, (coord, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexGendv(GLenum coord, GLenum pname, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexGendv);
+      trace_write(&coord, sizeof(coord));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_tex_gen_count(pname) * sizeof(GLdouble));
+      CALL_TexGendv(ctx->CurrentDispatch, (coord, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_TexGendv(ctx->CurrentDispatch, (coord, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexGenf(GLenum coord, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexGenf);
+      trace_write(&coord, sizeof(coord));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_TexGenf(ctx->CurrentDispatch, (coord, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_TexGenf(ctx->CurrentDispatch, (coord, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexGenfv(GLenum coord, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexGenfv);
+      trace_write(&coord, sizeof(coord));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_tex_gen_count(pname) * sizeof(GLfloat));
+      CALL_TexGenfv(ctx->CurrentDispatch, (coord, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_TexGenfv(ctx->CurrentDispatch, (coord, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexGeni(GLenum coord, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexGeni);
+      trace_write(&coord, sizeof(coord));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_TexGeni(ctx->CurrentDispatch, (coord, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_TexGeni(ctx->CurrentDispatch, (coord, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexGeniv(GLenum coord, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexGeniv);
+      trace_write(&coord, sizeof(coord));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, _mesa_tex_gen_count(pname) * sizeof(GLint));
+      CALL_TexGeniv(ctx->CurrentDispatch, (coord, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_TexGeniv(ctx->CurrentDispatch, (coord, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_FeedbackBuffer(GLsizei size, GLenum type, GLfloat * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FeedbackBuffer);
+      trace_write(&size, sizeof(size));
+      trace_write(&type, sizeof(type));
+      trace_output(buffer, count_bytes(size, sizeof(GLfloat)));
+      CALL_FeedbackBuffer(ctx->CurrentDispatch, (size, type, buffer));
+      trace_unlock();
+   }
+   else {
+      CALL_FeedbackBuffer(ctx->CurrentDispatch, (size, type, buffer));
+   }
+}
+
+static void GLAPIENTRY
+trace_SelectBuffer(GLsizei size, GLuint * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SelectBuffer);
+      trace_write(&size, sizeof(size));
+      trace_output(buffer, count_bytes(size, sizeof(GLuint)));
+      CALL_SelectBuffer(ctx->CurrentDispatch, (size, buffer));
+      trace_unlock();
+   }
+   else {
+      CALL_SelectBuffer(ctx->CurrentDispatch, (size, buffer));
+   }
+}
+
+static GLint GLAPIENTRY
+trace_RenderMode(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RenderMode);
+      trace_write(&mode, sizeof(mode));
+      ret = CALL_RenderMode(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      ret = CALL_RenderMode(ctx->CurrentDispatch, (mode));
+   }
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_InitNames(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_InitNames);
+      CALL_InitNames(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_InitNames(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_LoadName(GLuint name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LoadName);
+      trace_write(&name, sizeof(name));
+      CALL_LoadName(ctx->CurrentDispatch, (name));
+      trace_unlock();
+   }
+   else {
+      CALL_LoadName(ctx->CurrentDispatch, (name));
+   }
+}
+
+static void GLAPIENTRY
+trace_PassThrough(GLfloat token)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PassThrough);
+      trace_write(&token, sizeof(token));
+      CALL_PassThrough(ctx->CurrentDispatch, (token));
+      trace_unlock();
+   }
+   else {
+      CALL_PassThrough(ctx->CurrentDispatch, (token));
+   }
+}
+
+static void GLAPIENTRY
+trace_PopName(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PopName);
+      CALL_PopName(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_PopName(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_PushName(GLuint name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PushName);
+      trace_write(&name, sizeof(name));
+      CALL_PushName(ctx->CurrentDispatch, (name));
+      trace_unlock();
+   }
+   else {
+      CALL_PushName(ctx->CurrentDispatch, (name));
+   }
+}
+
+static void GLAPIENTRY
+trace_DrawBuffer(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DrawBuffer);
+      trace_write(&mode, sizeof(mode));
+      CALL_DrawBuffer(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      CALL_DrawBuffer(ctx->CurrentDispatch, (mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_Clear(GLbitfield mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Clear);
+      trace_write(&mask, sizeof(mask));
+      CALL_Clear(ctx->CurrentDispatch, (mask));
+      trace_unlock();
+   }
+   else {
+      CALL_Clear(ctx->CurrentDispatch, (mask));
+   }
+}
+
+static void GLAPIENTRY
+trace_ClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ClearAccum);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_ClearAccum(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_ClearAccum(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_ClearIndex(GLfloat c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ClearIndex);
+      trace_write(&c, sizeof(c));
+      CALL_ClearIndex(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_ClearIndex(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_ClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ClearColor);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_ClearColor(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_ClearColor(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_ClearStencil(GLint s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ClearStencil);
+      trace_write(&s, sizeof(s));
+      CALL_ClearStencil(ctx->CurrentDispatch, (s));
+      trace_unlock();
+   }
+   else {
+      CALL_ClearStencil(ctx->CurrentDispatch, (s));
+   }
+}
+
+static void GLAPIENTRY
+trace_ClearDepth(GLclampd depth)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ClearDepth);
+      trace_write(&depth, sizeof(depth));
+      CALL_ClearDepth(ctx->CurrentDispatch, (depth));
+      trace_unlock();
+   }
+   else {
+      CALL_ClearDepth(ctx->CurrentDispatch, (depth));
+   }
+}
+
+static void GLAPIENTRY
+trace_StencilMask(GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_StencilMask);
+      trace_write(&mask, sizeof(mask));
+      CALL_StencilMask(ctx->CurrentDispatch, (mask));
+      trace_unlock();
+   }
+   else {
+      CALL_StencilMask(ctx->CurrentDispatch, (mask));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ColorMask);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_ColorMask(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_ColorMask(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_DepthMask(GLboolean flag)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DepthMask);
+      trace_write(&flag, sizeof(flag));
+      CALL_DepthMask(ctx->CurrentDispatch, (flag));
+      trace_unlock();
+   }
+   else {
+      CALL_DepthMask(ctx->CurrentDispatch, (flag));
+   }
+}
+
+static void GLAPIENTRY
+trace_IndexMask(GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_IndexMask);
+      trace_write(&mask, sizeof(mask));
+      CALL_IndexMask(ctx->CurrentDispatch, (mask));
+      trace_unlock();
+   }
+   else {
+      CALL_IndexMask(ctx->CurrentDispatch, (mask));
+   }
+}
+
+static void GLAPIENTRY
+trace_Accum(GLenum op, GLfloat value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Accum);
+      trace_write(&op, sizeof(op));
+      trace_write(&value, sizeof(value));
+      CALL_Accum(ctx->CurrentDispatch, (op, value));
+      trace_unlock();
+   }
+   else {
+      CALL_Accum(ctx->CurrentDispatch, (op, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_Disable(GLenum cap)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Disable);
+      trace_write(&cap, sizeof(cap));
+      CALL_Disable(ctx->CurrentDispatch, (cap));
+      trace_unlock();
+   }
+   else {
+      CALL_Disable(ctx->CurrentDispatch, (cap));
+   }
+}
+
+static void GLAPIENTRY
+trace_Enable(GLenum cap)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Enable);
+      trace_write(&cap, sizeof(cap));
+      CALL_Enable(ctx->CurrentDispatch, (cap));
+      trace_unlock();
+   }
+   else {
+      CALL_Enable(ctx->CurrentDispatch, (cap));
+   }
+}
+
+static void GLAPIENTRY
+trace_Finish(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Finish);
+      CALL_Finish(ctx->CurrentDispatch, ());
+      trace_restore_dispatch(ctx);
+      trace_flush();
+      trace_unlock();
+   }
+   else {
+      CALL_Finish(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_Flush(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Flush);
+      CALL_Flush(ctx->CurrentDispatch, ());
+      trace_restore_dispatch(ctx);
+      trace_unlock();
+   }
+   else {
+      CALL_Flush(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_PopAttrib(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PopAttrib);
+      CALL_PopAttrib(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_PopAttrib(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_PushAttrib(GLbitfield mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PushAttrib);
+      trace_write(&mask, sizeof(mask));
+      CALL_PushAttrib(ctx->CurrentDispatch, (mask));
+      trace_unlock();
+   }
+   else {
+      CALL_PushAttrib(ctx->CurrentDispatch, (mask));
+   }
+}
+
+static void GLAPIENTRY
+trace_Map1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Map1d);
+      trace_write(&target, sizeof(target));
+      trace_write(&u1, sizeof(u1));
+      trace_write(&u2, sizeof(u2));
+      trace_write(&stride, sizeof(stride));
+      trace_write(&order, sizeof(order));
+      trace_array(points, map1_bytes(target, stride, order, sizeof(GLdouble)));
+      CALL_Map1d(ctx->CurrentDispatch, (target, u1, u2, stride, order, points));
+      trace_unlock();
+   }
+   else {
+      CALL_Map1d(ctx->CurrentDispatch, (target, u1, u2, stride, order, points));
+   }
+}
+
+static void GLAPIENTRY
+trace_Map1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Map1f);
+      trace_write(&target, sizeof(target));
+      trace_write(&u1, sizeof(u1));
+      trace_write(&u2, sizeof(u2));
+      trace_write(&stride, sizeof(stride));
+      trace_write(&order, sizeof(order));
+      trace_array(points, map1_bytes(target, stride, order, sizeof(GLfloat)));
+      CALL_Map1f(ctx->CurrentDispatch, (target, u1, u2, stride, order, points));
+      trace_unlock();
+   }
+   else {
+      CALL_Map1f(ctx->CurrentDispatch, (target, u1, u2, stride, order, points));
+   }
+}
+
+static void GLAPIENTRY
+trace_Map2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Map2d);
+      trace_write(&target, sizeof(target));
+      trace_write(&u1, sizeof(u1));
+      trace_write(&u2, sizeof(u2));
+      trace_write(&ustride, sizeof(ustride));
+      trace_write(&uorder, sizeof(uorder));
+      trace_write(&v1, sizeof(v1));
+      trace_write(&v2, sizeof(v2));
+      trace_write(&vstride, sizeof(vstride));
+      trace_write(&vorder, sizeof(vorder));
+      trace_array(points, map2_bytes(target, ustride, uorder, vstride, vorder, sizeof(GLdouble)));
+      CALL_Map2d(ctx->CurrentDispatch, (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points));
+      trace_unlock();
+   }
+   else {
+      CALL_Map2d(ctx->CurrentDispatch, (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points));
+   }
+}
+
+static void GLAPIENTRY
+trace_Map2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Map2f);
+      trace_write(&target, sizeof(target));
+      trace_write(&u1, sizeof(u1));
+      trace_write(&u2, sizeof(u2));
+      trace_write(&ustride, sizeof(ustride));
+      trace_write(&uorder, sizeof(uorder));
+      trace_write(&v1, sizeof(v1));
+      trace_write(&v2, sizeof(v2));
+      trace_write(&vstride, sizeof(vstride));
+      trace_write(&vorder, sizeof(vorder));
+      trace_array(points, map2_bytes(target, ustride, uorder, vstride, vorder, sizeof(GLfloat)));
+      CALL_Map2f(ctx->CurrentDispatch, (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points));
+      trace_unlock();
+   }
+   else {
+      CALL_Map2f(ctx->CurrentDispatch, (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points));
+   }
+}
+
+static void GLAPIENTRY
+trace_MapGrid1d(GLint un, GLdouble u1, GLdouble u2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MapGrid1d);
+      trace_write(&un, sizeof(un));
+      trace_write(&u1, sizeof(u1));
+      trace_write(&u2, sizeof(u2));
+      CALL_MapGrid1d(ctx->CurrentDispatch, (un, u1, u2));
+      trace_unlock();
+   }
+   else {
+      CALL_MapGrid1d(ctx->CurrentDispatch, (un, u1, u2));
+   }
+}
+
+static void GLAPIENTRY
+trace_MapGrid1f(GLint un, GLfloat u1, GLfloat u2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MapGrid1f);
+      trace_write(&un, sizeof(un));
+      trace_write(&u1, sizeof(u1));
+      trace_write(&u2, sizeof(u2));
+      CALL_MapGrid1f(ctx->CurrentDispatch, (un, u1, u2));
+      trace_unlock();
+   }
+   else {
+      CALL_MapGrid1f(ctx->CurrentDispatch, (un, u1, u2));
+   }
+}
+
+static void GLAPIENTRY
+trace_MapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MapGrid2d);
+      trace_write(&un, sizeof(un));
+      trace_write(&u1, sizeof(u1));
+      trace_write(&u2, sizeof(u2));
+      trace_write(&vn, sizeof(vn));
+      trace_write(&v1, sizeof(v1));
+      trace_write(&v2, sizeof(v2));
+      CALL_MapGrid2d(ctx->CurrentDispatch, (un, u1, u2, vn, v1, v2));
+      trace_unlock();
+   }
+   else {
+      CALL_MapGrid2d(ctx->CurrentDispatch, (un, u1, u2, vn, v1, v2));
+   }
+}
+
+static void GLAPIENTRY
+trace_MapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MapGrid2f);
+      trace_write(&un, sizeof(un));
+      trace_write(&u1, sizeof(u1));
+      trace_write(&u2, sizeof(u2));
+      trace_write(&vn, sizeof(vn));
+      trace_write(&v1, sizeof(v1));
+      trace_write(&v2, sizeof(v2));
+      CALL_MapGrid2f(ctx->CurrentDispatch, (un, u1, u2, vn, v1, v2));
+      trace_unlock();
+   }
+   else {
+      CALL_MapGrid2f(ctx->CurrentDispatch, (un, u1, u2, vn, v1, v2));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalCoord1d(GLdouble u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalCoord1d);
+      trace_write(&u, sizeof(u));
+      CALL_EvalCoord1d(ctx->CurrentDispatch, (u));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalCoord1d(ctx->CurrentDispatch, (u));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalCoord1dv(const GLdouble * u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalCoord1dv);
+      trace_array(u, 1 * sizeof(GLdouble));
+      CALL_EvalCoord1dv(ctx->CurrentDispatch, (u));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalCoord1dv(ctx->CurrentDispatch, (u));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalCoord1f(GLfloat u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalCoord1f);
+      trace_write(&u, sizeof(u));
+      CALL_EvalCoord1f(ctx->CurrentDispatch, (u));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalCoord1f(ctx->CurrentDispatch, (u));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalCoord1fv(const GLfloat * u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalCoord1fv);
+      trace_array(u, 1 * sizeof(GLfloat));
+      CALL_EvalCoord1fv(ctx->CurrentDispatch, (u));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalCoord1fv(ctx->CurrentDispatch, (u));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalCoord2d(GLdouble u, GLdouble v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalCoord2d);
+      trace_write(&u, sizeof(u));
+      trace_write(&v, sizeof(v));
+      CALL_EvalCoord2d(ctx->CurrentDispatch, (u, v));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalCoord2d(ctx->CurrentDispatch, (u, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalCoord2dv(const GLdouble * u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalCoord2dv);
+      trace_array(u, 2 * sizeof(GLdouble));
+      CALL_EvalCoord2dv(ctx->CurrentDispatch, (u));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalCoord2dv(ctx->CurrentDispatch, (u));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalCoord2f(GLfloat u, GLfloat v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalCoord2f);
+      trace_write(&u, sizeof(u));
+      trace_write(&v, sizeof(v));
+      CALL_EvalCoord2f(ctx->CurrentDispatch, (u, v));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalCoord2f(ctx->CurrentDispatch, (u, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalCoord2fv(const GLfloat * u)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalCoord2fv);
+      trace_array(u, 2 * sizeof(GLfloat));
+      CALL_EvalCoord2fv(ctx->CurrentDispatch, (u));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalCoord2fv(ctx->CurrentDispatch, (u));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalMesh1(GLenum mode, GLint i1, GLint i2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalMesh1);
+      trace_write(&mode, sizeof(mode));
+      trace_write(&i1, sizeof(i1));
+      trace_write(&i2, sizeof(i2));
+      CALL_EvalMesh1(ctx->CurrentDispatch, (mode, i1, i2));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalMesh1(ctx->CurrentDispatch, (mode, i1, i2));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalPoint1(GLint i)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalPoint1);
+      trace_write(&i, sizeof(i));
+      CALL_EvalPoint1(ctx->CurrentDispatch, (i));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalPoint1(ctx->CurrentDispatch, (i));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalMesh2);
+      trace_write(&mode, sizeof(mode));
+      trace_write(&i1, sizeof(i1));
+      trace_write(&i2, sizeof(i2));
+      trace_write(&j1, sizeof(j1));
+      trace_write(&j2, sizeof(j2));
+      CALL_EvalMesh2(ctx->CurrentDispatch, (mode, i1, i2, j1, j2));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalMesh2(ctx->CurrentDispatch, (mode, i1, i2, j1, j2));
+   }
+}
+
+static void GLAPIENTRY
+trace_EvalPoint2(GLint i, GLint j)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EvalPoint2);
+      trace_write(&i, sizeof(i));
+      trace_write(&j, sizeof(j));
+      CALL_EvalPoint2(ctx->CurrentDispatch, (i, j));
+      trace_unlock();
+   }
+   else {
+      CALL_EvalPoint2(ctx->CurrentDispatch, (i, j));
+   }
+}
+
+static void GLAPIENTRY
+trace_AlphaFunc(GLenum func, GLclampf ref)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_AlphaFunc);
+      trace_write(&func, sizeof(func));
+      trace_write(&ref, sizeof(ref));
+      CALL_AlphaFunc(ctx->CurrentDispatch, (func, ref));
+      trace_unlock();
+   }
+   else {
+      CALL_AlphaFunc(ctx->CurrentDispatch, (func, ref));
+   }
+}
+
+static void GLAPIENTRY
+trace_BlendFunc(GLenum sfactor, GLenum dfactor)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BlendFunc);
+      trace_write(&sfactor, sizeof(sfactor));
+      trace_write(&dfactor, sizeof(dfactor));
+      CALL_BlendFunc(ctx->CurrentDispatch, (sfactor, dfactor));
+      trace_unlock();
+   }
+   else {
+      CALL_BlendFunc(ctx->CurrentDispatch, (sfactor, dfactor));
+   }
+}
+
+static void GLAPIENTRY
+trace_LogicOp(GLenum opcode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LogicOp);
+      trace_write(&opcode, sizeof(opcode));
+      CALL_LogicOp(ctx->CurrentDispatch, (opcode));
+      trace_unlock();
+   }
+   else {
+      CALL_LogicOp(ctx->CurrentDispatch, (opcode));
+   }
+}
+
+static void GLAPIENTRY
+trace_StencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_StencilFunc);
+      trace_write(&func, sizeof(func));
+      trace_write(&ref, sizeof(ref));
+      trace_write(&mask, sizeof(mask));
+      CALL_StencilFunc(ctx->CurrentDispatch, (func, ref, mask));
+      trace_unlock();
+   }
+   else {
+      CALL_StencilFunc(ctx->CurrentDispatch, (func, ref, mask));
+   }
+}
+
+static void GLAPIENTRY
+trace_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_StencilOp);
+      trace_write(&fail, sizeof(fail));
+      trace_write(&zfail, sizeof(zfail));
+      trace_write(&zpass, sizeof(zpass));
+      CALL_StencilOp(ctx->CurrentDispatch, (fail, zfail, zpass));
+      trace_unlock();
+   }
+   else {
+      CALL_StencilOp(ctx->CurrentDispatch, (fail, zfail, zpass));
+   }
+}
+
+static void GLAPIENTRY
+trace_DepthFunc(GLenum func)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DepthFunc);
+      trace_write(&func, sizeof(func));
+      CALL_DepthFunc(ctx->CurrentDispatch, (func));
+      trace_unlock();
+   }
+   else {
+      CALL_DepthFunc(ctx->CurrentDispatch, (func));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelZoom(GLfloat xfactor, GLfloat yfactor)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelZoom);
+      trace_write(&xfactor, sizeof(xfactor));
+      trace_write(&yfactor, sizeof(yfactor));
+      CALL_PixelZoom(ctx->CurrentDispatch, (xfactor, yfactor));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelZoom(ctx->CurrentDispatch, (xfactor, yfactor));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelTransferf(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelTransferf);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_PixelTransferf(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelTransferf(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelTransferi(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelTransferi);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_PixelTransferi(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelTransferi(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelStoref(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelStoref);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_PixelStoref(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelStoref(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelStorei(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelStorei);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_PixelStorei(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelStorei(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelMapfv(GLenum map, GLsizei mapsize, const GLfloat * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelMapfv);
+      trace_write(&map, sizeof(map));
+      trace_write(&mapsize, sizeof(mapsize));
+      trace_array(values, count_bytes(mapsize, sizeof(GLfloat)));
+      CALL_PixelMapfv(ctx->CurrentDispatch, (map, mapsize, values));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelMapfv(ctx->CurrentDispatch, (map, mapsize, values));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelMapuiv(GLenum map, GLsizei mapsize, const GLuint * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelMapuiv);
+      trace_write(&map, sizeof(map));
+      trace_write(&mapsize, sizeof(mapsize));
+      trace_array(values, count_bytes(mapsize, sizeof(GLuint)));
+      CALL_PixelMapuiv(ctx->CurrentDispatch, (map, mapsize, values));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelMapuiv(ctx->CurrentDispatch, (map, mapsize, values));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelMapusv(GLenum map, GLsizei mapsize, const GLushort * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelMapusv);
+      trace_write(&map, sizeof(map));
+      trace_write(&mapsize, sizeof(mapsize));
+      trace_array(values, count_bytes(mapsize, sizeof(GLushort)));
+      CALL_PixelMapusv(ctx->CurrentDispatch, (map, mapsize, values));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelMapusv(ctx->CurrentDispatch, (map, mapsize, values));
+   }
+}
+
+static void GLAPIENTRY
+trace_ReadBuffer(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ReadBuffer);
+      trace_write(&mode, sizeof(mode));
+      CALL_ReadBuffer(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      CALL_ReadBuffer(ctx->CurrentDispatch, (mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_CopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyPixels);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&type, sizeof(type));
+      CALL_CopyPixels(ctx->CurrentDispatch, (x, y, width, height, type));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyPixels(ctx->CurrentDispatch, (x, y, width, height, type));
+   }
+}
+
+static void GLAPIENTRY
+trace_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ReadPixels);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_output(pixels, image_bytes(&ctx->Pack, 2, width, height, 1, format, type, pixels));
+      CALL_ReadPixels(ctx->CurrentDispatch, (x, y, width, height, format, type, pixels));
+      trace_unlock();
+   }
+   else {
+      CALL_ReadPixels(ctx->CurrentDispatch, (x, y, width, height, format, type, pixels));
+   }
+}
+
+static void GLAPIENTRY
+trace_DrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DrawPixels);
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(pixels, image_bytes(&ctx->Unpack, 2, width, height, 1, format, type, pixels));
+      CALL_DrawPixels(ctx->CurrentDispatch, (width, height, format, type, pixels));
+      trace_unlock();
+   }
+   else {
+      CALL_DrawPixels(ctx->CurrentDispatch, (width, height, format, type, pixels));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetBooleanv(GLenum pname, GLboolean * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetBooleanv(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetClipPlane(GLenum plane, GLdouble * equation)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetClipPlane(ctx->CurrentDispatch, (plane, equation));
+}
+
+static void GLAPIENTRY
+trace_GetDoublev(GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetDoublev(ctx->CurrentDispatch, (pname, params));
+}
+
+static GLenum GLAPIENTRY
+trace_GetError(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLenum ret;
+   ret = CALL_GetError(ctx->CurrentDispatch, ());
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_GetFloatv(GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetFloatv(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetIntegerv(GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetIntegerv(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetLightfv(GLenum light, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetLightfv(ctx->CurrentDispatch, (light, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetLightiv(GLenum light, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetLightiv(ctx->CurrentDispatch, (light, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetMapdv(GLenum target, GLenum query, GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMapdv(ctx->CurrentDispatch, (target, query, v));
+}
+
+static void GLAPIENTRY
+trace_GetMapfv(GLenum target, GLenum query, GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMapfv(ctx->CurrentDispatch, (target, query, v));
+}
+
+static void GLAPIENTRY
+trace_GetMapiv(GLenum target, GLenum query, GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMapiv(ctx->CurrentDispatch, (target, query, v));
+}
+
+static void GLAPIENTRY
+trace_GetMaterialfv(GLenum face, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMaterialfv(ctx->CurrentDispatch, (face, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetMaterialiv(GLenum face, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMaterialiv(ctx->CurrentDispatch, (face, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetPixelMapfv(GLenum map, GLfloat * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetPixelMapfv(ctx->CurrentDispatch, (map, values));
+}
+
+static void GLAPIENTRY
+trace_GetPixelMapuiv(GLenum map, GLuint * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetPixelMapuiv(ctx->CurrentDispatch, (map, values));
+}
+
+static void GLAPIENTRY
+trace_GetPixelMapusv(GLenum map, GLushort * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetPixelMapusv(ctx->CurrentDispatch, (map, values));
+}
+
+static void GLAPIENTRY
+trace_GetPolygonStipple(GLubyte * mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetPolygonStipple(ctx->CurrentDispatch, (mask));
+}
+
+static const GLubyte * GLAPIENTRY
+trace_GetString(GLenum name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   const GLubyte * ret;
+   ret = CALL_GetString(ctx->CurrentDispatch, (name));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_GetTexEnvfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexEnvfv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetTexEnviv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexEnviv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetTexGendv(GLenum coord, GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexGendv(ctx->CurrentDispatch, (coord, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetTexGenfv(GLenum coord, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexGenfv(ctx->CurrentDispatch, (coord, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetTexGeniv(GLenum coord, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexGeniv(ctx->CurrentDispatch, (coord, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexImage(ctx->CurrentDispatch, (target, level, format, type, pixels));
+}
+
+static void GLAPIENTRY
+trace_GetTexParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexParameterfv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetTexParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexParameteriv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexLevelParameterfv(ctx->CurrentDispatch, (target, level, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexLevelParameteriv(ctx->CurrentDispatch, (target, level, pname, params));
+}
+
+static GLboolean GLAPIENTRY
+trace_IsEnabled(GLenum cap)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsEnabled(ctx->CurrentDispatch, (cap));
+   return ret;
+}
+
+static GLboolean GLAPIENTRY
+trace_IsList(GLuint list)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsList(ctx->CurrentDispatch, (list));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_DepthRange(GLclampd zNear, GLclampd zFar)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DepthRange);
+      trace_write(&zNear, sizeof(zNear));
+      trace_write(&zFar, sizeof(zFar));
+      CALL_DepthRange(ctx->CurrentDispatch, (zNear, zFar));
+      trace_unlock();
+   }
+   else {
+      CALL_DepthRange(ctx->CurrentDispatch, (zNear, zFar));
+   }
+}
+
+static void GLAPIENTRY
+trace_Frustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Frustum);
+      trace_write(&left, sizeof(left));
+      trace_write(&right, sizeof(right));
+      trace_write(&bottom, sizeof(bottom));
+      trace_write(&top, sizeof(top));
+      trace_write(&zNear, sizeof(zNear));
+      trace_write(&zFar, sizeof(zFar));
+      CALL_Frustum(ctx->CurrentDispatch, (left, right, bottom, top, zNear, zFar));
+      trace_unlock();
+   }
+   else {
+      CALL_Frustum(ctx->CurrentDispatch, (left, right, bottom, top, zNear, zFar));
+   }
+}
+
+static void GLAPIENTRY
+trace_LoadIdentity(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LoadIdentity);
+      CALL_LoadIdentity(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_LoadIdentity(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_LoadMatrixf(const GLfloat * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LoadMatrixf);
+      trace_array(m, 16 * sizeof(GLfloat));
+      CALL_LoadMatrixf(ctx->CurrentDispatch, (m));
+      trace_unlock();
+   }
+   else {
+      CALL_LoadMatrixf(ctx->CurrentDispatch, (m));
+   }
+}
+
+static void GLAPIENTRY
+trace_LoadMatrixd(const GLdouble * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LoadMatrixd);
+      trace_array(m, 16 * sizeof(GLdouble));
+      CALL_LoadMatrixd(ctx->CurrentDispatch, (m));
+      trace_unlock();
+   }
+   else {
+      CALL_LoadMatrixd(ctx->CurrentDispatch, (m));
+   }
+}
+
+static void GLAPIENTRY
+trace_MatrixMode(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MatrixMode);
+      trace_write(&mode, sizeof(mode));
+      CALL_MatrixMode(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      CALL_MatrixMode(ctx->CurrentDispatch, (mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultMatrixf(const GLfloat * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultMatrixf);
+      trace_array(m, 16 * sizeof(GLfloat));
+      CALL_MultMatrixf(ctx->CurrentDispatch, (m));
+      trace_unlock();
+   }
+   else {
+      CALL_MultMatrixf(ctx->CurrentDispatch, (m));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultMatrixd(const GLdouble * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultMatrixd);
+      trace_array(m, 16 * sizeof(GLdouble));
+      CALL_MultMatrixd(ctx->CurrentDispatch, (m));
+      trace_unlock();
+   }
+   else {
+      CALL_MultMatrixd(ctx->CurrentDispatch, (m));
+   }
+}
+
+static void GLAPIENTRY
+trace_Ortho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Ortho);
+      trace_write(&left, sizeof(left));
+      trace_write(&right, sizeof(right));
+      trace_write(&bottom, sizeof(bottom));
+      trace_write(&top, sizeof(top));
+      trace_write(&zNear, sizeof(zNear));
+      trace_write(&zFar, sizeof(zFar));
+      CALL_Ortho(ctx->CurrentDispatch, (left, right, bottom, top, zNear, zFar));
+      trace_unlock();
+   }
+   else {
+      CALL_Ortho(ctx->CurrentDispatch, (left, right, bottom, top, zNear, zFar));
+   }
+}
+
+static void GLAPIENTRY
+trace_PopMatrix(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PopMatrix);
+      CALL_PopMatrix(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_PopMatrix(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_PushMatrix(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PushMatrix);
+      CALL_PushMatrix(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_PushMatrix(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_Rotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Rotated);
+      trace_write(&angle, sizeof(angle));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Rotated(ctx->CurrentDispatch, (angle, x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Rotated(ctx->CurrentDispatch, (angle, x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Rotatef);
+      trace_write(&angle, sizeof(angle));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Rotatef(ctx->CurrentDispatch, (angle, x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Rotatef(ctx->CurrentDispatch, (angle, x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Scaled(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Scaled);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Scaled(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Scaled(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Scalef(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Scalef);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Scalef(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Scalef(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Translated(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Translated);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Translated(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Translated(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Translatef(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Translatef);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_Translatef(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_Translatef(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Viewport);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      CALL_Viewport(ctx->CurrentDispatch, (x, y, width, height));
+      trace_unlock();
+   }
+   else {
+      CALL_Viewport(ctx->CurrentDispatch, (x, y, width, height));
+   }
+}
+
+static void GLAPIENTRY
+trace_ArrayElement(GLint i)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_client_arrays(ctx, i, i + 1);
+      trace_record(TRACE_CALL_ArrayElement);
+      trace_write(&i, sizeof(i));
+      CALL_ArrayElement(ctx->CurrentDispatch, (i));
+      trace_unlock();
+   }
+   else {
+      CALL_ArrayElement(ctx->CurrentDispatch, (i));
+   }
+}
+
+static void GLAPIENTRY
+trace_BindTexture(GLenum target, GLuint texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BindTexture);
+      trace_write(&target, sizeof(target));
+      trace_write(&texture, sizeof(texture));
+      CALL_BindTexture(ctx->CurrentDispatch, (target, texture));
+      trace_unlock();
+   }
+   else {
+      CALL_BindTexture(ctx->CurrentDispatch, (target, texture));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_ColorPointer(ctx->CurrentDispatch, (size, type, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_ColorPointer(ctx->CurrentDispatch, (size, type, stride, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_DisableClientState(GLenum array)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DisableClientState);
+      trace_write(&array, sizeof(array));
+      CALL_DisableClientState(ctx->CurrentDispatch, (array));
+      trace_unlock();
+   }
+   else {
+      CALL_DisableClientState(ctx->CurrentDispatch, (array));
+   }
+}
+
+static void GLAPIENTRY
+trace_DrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_client_arrays(ctx, first, first + count);
+      trace_record(TRACE_CALL_DrawArrays);
+      trace_write(&mode, sizeof(mode));
+      trace_write(&first, sizeof(first));
+      trace_write(&count, sizeof(count));
+      CALL_DrawArrays(ctx->CurrentDispatch, (mode, first, count));
+      trace_unlock();
+   }
+   else {
+      CALL_DrawArrays(ctx->CurrentDispatch, (mode, first, count));
+   }
+}
+
+static void GLAPIENTRY
+trace_DrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid * indices)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_element_arrays(ctx, count, type, indices);
+      trace_record(TRACE_CALL_DrawElements);
+      trace_write(&mode, sizeof(mode));
+      trace_write(&count, sizeof(count));
+      trace_write(&type, sizeof(type));
+      trace_array(indices, element_bytes(ctx, count, type, indices));
+      CALL_DrawElements(ctx->CurrentDispatch, (mode, count, type, indices));
+      trace_unlock();
+   }
+   else {
+      CALL_DrawElements(ctx->CurrentDispatch, (mode, count, type, indices));
+   }
+}
+
+static void GLAPIENTRY
+trace_EdgeFlagPointer(GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_EdgeFlagPointer(ctx->CurrentDispatch, (stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_EdgeFlagPointer(ctx->CurrentDispatch, (stride, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_EnableClientState(GLenum array)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EnableClientState);
+      trace_write(&array, sizeof(array));
+      CALL_EnableClientState(ctx->CurrentDispatch, (array));
+      trace_unlock();
+   }
+   else {
+      CALL_EnableClientState(ctx->CurrentDispatch, (array));
+   }
+}
+
+static void GLAPIENTRY
+trace_IndexPointer(GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_IndexPointer(ctx->CurrentDispatch, (type, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_IndexPointer(ctx->CurrentDispatch, (type, stride, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexub(GLubyte c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexub);
+      trace_write(&c, sizeof(c));
+      CALL_Indexub(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexub(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_Indexubv(const GLubyte * c)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Indexubv);
+      trace_array(c, 1 * sizeof(GLubyte));
+      CALL_Indexubv(ctx->CurrentDispatch, (c));
+      trace_unlock();
+   }
+   else {
+      CALL_Indexubv(ctx->CurrentDispatch, (c));
+   }
+}
+
+static void GLAPIENTRY
+trace_InterleavedArrays(GLenum format, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_InterleavedArrays(ctx->CurrentDispatch, (format, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_InterleavedArrays(ctx->CurrentDispatch, (format, stride, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_NormalPointer(GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_NormalPointer(ctx->CurrentDispatch, (type, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_NormalPointer(ctx->CurrentDispatch, (type, stride, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_PolygonOffset(GLfloat factor, GLfloat units)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PolygonOffset);
+      trace_write(&factor, sizeof(factor));
+      trace_write(&units, sizeof(units));
+      CALL_PolygonOffset(ctx->CurrentDispatch, (factor, units));
+      trace_unlock();
+   }
+   else {
+      CALL_PolygonOffset(ctx->CurrentDispatch, (factor, units));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_TexCoordPointer(ctx->CurrentDispatch, (size, type, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoordPointer(ctx->CurrentDispatch, (size, type, stride, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_VertexPointer(ctx->CurrentDispatch, (size, type, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_VertexPointer(ctx->CurrentDispatch, (size, type, stride, pointer));
+   }
+}
+
+static GLboolean GLAPIENTRY
+trace_AreTexturesResident(GLsizei n, const GLuint * textures, GLboolean * residences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_AreTexturesResident(ctx->CurrentDispatch, (n, textures, residences));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyTexImage1D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      trace_write(&border, sizeof(border));
+      CALL_CopyTexImage1D(ctx->CurrentDispatch, (target, level, internalformat, x, y, width, border));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyTexImage1D(ctx->CurrentDispatch, (target, level, internalformat, x, y, width, border));
+   }
+}
+
+static void GLAPIENTRY
+trace_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyTexImage2D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&border, sizeof(border));
+      CALL_CopyTexImage2D(ctx->CurrentDispatch, (target, level, internalformat, x, y, width, height, border));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyTexImage2D(ctx->CurrentDispatch, (target, level, internalformat, x, y, width, height, border));
+   }
+}
+
+static void GLAPIENTRY
+trace_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyTexSubImage1D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&xoffset, sizeof(xoffset));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      CALL_CopyTexSubImage1D(ctx->CurrentDispatch, (target, level, xoffset, x, y, width));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyTexSubImage1D(ctx->CurrentDispatch, (target, level, xoffset, x, y, width));
+   }
+}
+
+static void GLAPIENTRY
+trace_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyTexSubImage2D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&xoffset, sizeof(xoffset));
+      trace_write(&yoffset, sizeof(yoffset));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      CALL_CopyTexSubImage2D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, x, y, width, height));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyTexSubImage2D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, x, y, width, height));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteTextures(GLsizei n, const GLuint * textures)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteTextures);
+      trace_write(&n, sizeof(n));
+      trace_array(textures, count_bytes(n, sizeof(GLuint)));
+      CALL_DeleteTextures(ctx->CurrentDispatch, (n, textures));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteTextures(ctx->CurrentDispatch, (n, textures));
+   }
+}
+
+static void GLAPIENTRY
+trace_GenTextures(GLsizei n, GLuint * textures)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenTextures);
+      trace_write(&n, sizeof(n));
+      trace_output(textures, count_bytes(n, sizeof(GLuint)));
+      CALL_GenTextures(ctx->CurrentDispatch, (n, textures));
+      trace_unlock();
+   }
+   else {
+      CALL_GenTextures(ctx->CurrentDispatch, (n, textures));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetPointerv(GLenum pname, GLvoid ** params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetPointerv(ctx->CurrentDispatch, (pname, params));
+}
+
+static GLboolean GLAPIENTRY
+trace_IsTexture(GLuint texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsTexture(ctx->CurrentDispatch, (texture));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_PrioritizeTextures(GLsizei n, const GLuint * textures, const GLclampf * priorities)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PrioritizeTextures);
+      trace_write(&n, sizeof(n));
+      trace_array(textures, count_bytes(n, sizeof(GLuint)));
+      trace_array(priorities, count_bytes(n, sizeof(GLclampf)));
+      CALL_PrioritizeTextures(ctx->CurrentDispatch, (n, textures, priorities));
+      trace_unlock();
+   }
+   else {
+      CALL_PrioritizeTextures(ctx->CurrentDispatch, (n, textures, priorities));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexSubImage1D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&xoffset, sizeof(xoffset));
+      trace_write(&width, sizeof(width));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(pixels, image_bytes(&ctx->Unpack, 1, width, 1, 1, format, type, pixels));
+      CALL_TexSubImage1D(ctx->CurrentDispatch, (target, level, xoffset, width, format, type, pixels));
+      trace_unlock();
+   }
+   else {
+      CALL_TexSubImage1D(ctx->CurrentDispatch, (target, level, xoffset, width, format, type, pixels));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexSubImage2D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&xoffset, sizeof(xoffset));
+      trace_write(&yoffset, sizeof(yoffset));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(pixels, image_bytes(&ctx->Unpack, 2, width, height, 1, format, type, pixels));
+      CALL_TexSubImage2D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, width, height, format, type, pixels));
+      trace_unlock();
+   }
+   else {
+      CALL_TexSubImage2D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, width, height, format, type, pixels));
+   }
+}
+
+static void GLAPIENTRY
+trace_PopClientAttrib(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PopClientAttrib);
+      CALL_PopClientAttrib(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_PopClientAttrib(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_PushClientAttrib(GLbitfield mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PushClientAttrib);
+      trace_write(&mask, sizeof(mask));
+      CALL_PushClientAttrib(ctx->CurrentDispatch, (mask));
+      trace_unlock();
+   }
+   else {
+      CALL_PushClientAttrib(ctx->CurrentDispatch, (mask));
+   }
+}
+
+static void GLAPIENTRY
+trace_BlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BlendColor);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      trace_write(&alpha, sizeof(alpha));
+      CALL_BlendColor(ctx->CurrentDispatch, (red, green, blue, alpha));
+      trace_unlock();
+   }
+   else {
+      CALL_BlendColor(ctx->CurrentDispatch, (red, green, blue, alpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_BlendEquation(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BlendEquation);
+      trace_write(&mode, sizeof(mode));
+      CALL_BlendEquation(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      CALL_BlendEquation(ctx->CurrentDispatch, (mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid * indices)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_client_arrays(ctx, start, end + 1);
+      trace_record(TRACE_CALL_DrawRangeElements);
+      trace_write(&mode, sizeof(mode));
+      trace_write(&start, sizeof(start));
+      trace_write(&end, sizeof(end));
+      trace_write(&count, sizeof(count));
+      trace_write(&type, sizeof(type));
+      trace_array(indices, element_bytes(ctx, count, type, indices));
+      CALL_DrawRangeElements(ctx->CurrentDispatch, (mode, start, end, count, type, indices));
+      trace_unlock();
+   }
+   else {
+      CALL_DrawRangeElements(ctx->CurrentDispatch, (mode, start, end, count, type, indices));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorTable(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * table)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ColorTable);
+      trace_write(&target, sizeof(target));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(table, image_bytes(&ctx->Unpack, 1, width, 1, 1, format, type, table));
+      CALL_ColorTable(ctx->CurrentDispatch, (target, internalformat, width, format, type, table));
+      trace_unlock();
+   }
+   else {
+      CALL_ColorTable(ctx->CurrentDispatch, (target, internalformat, width, format, type, table));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorTableParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ColorTableParameterfv);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, color_table_parameter_count(pname) * sizeof(GLfloat));
+      CALL_ColorTableParameterfv(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ColorTableParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorTableParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ColorTableParameteriv);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, color_table_parameter_count(pname) * sizeof(GLint));
+      CALL_ColorTableParameteriv(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ColorTableParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_CopyColorTable(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyColorTable);
+      trace_write(&target, sizeof(target));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      CALL_CopyColorTable(ctx->CurrentDispatch, (target, internalformat, x, y, width));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyColorTable(ctx->CurrentDispatch, (target, internalformat, x, y, width));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetColorTable(GLenum target, GLenum format, GLenum type, GLvoid * table)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetColorTable(ctx->CurrentDispatch, (target, format, type, table));
+}
+
+static void GLAPIENTRY
+trace_GetColorTableParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetColorTableParameterfv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetColorTableParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetColorTableParameteriv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_ColorSubTable(GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ColorSubTable);
+      trace_write(&target, sizeof(target));
+      trace_write(&start, sizeof(start));
+      trace_write(&count, sizeof(count));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(data, image_bytes(&ctx->Unpack, 1, count, 1, 1, format, type, data));
+      CALL_ColorSubTable(ctx->CurrentDispatch, (target, start, count, format, type, data));
+      trace_unlock();
+   }
+   else {
+      CALL_ColorSubTable(ctx->CurrentDispatch, (target, start, count, format, type, data));
+   }
+}
+
+static void GLAPIENTRY
+trace_CopyColorSubTable(GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyColorSubTable);
+      trace_write(&target, sizeof(target));
+      trace_write(&start, sizeof(start));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      CALL_CopyColorSubTable(ctx->CurrentDispatch, (target, start, x, y, width));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyColorSubTable(ctx->CurrentDispatch, (target, start, x, y, width));
+   }
+}
+
+static void GLAPIENTRY
+trace_ConvolutionFilter1D(GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const GLvoid * image)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ConvolutionFilter1D);
+      trace_write(&target, sizeof(target));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(image, image_bytes(&ctx->Unpack, 1, width, 1, 1, format, type, image));
+      CALL_ConvolutionFilter1D(ctx->CurrentDispatch, (target, internalformat, width, format, type, image));
+      trace_unlock();
+   }
+   else {
+      CALL_ConvolutionFilter1D(ctx->CurrentDispatch, (target, internalformat, width, format, type, image));
+   }
+}
+
+static void GLAPIENTRY
+trace_ConvolutionFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * image)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ConvolutionFilter2D);
+      trace_write(&target, sizeof(target));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(image, image_bytes(&ctx->Unpack, 2, width, height, 1, format, type, image));
+      CALL_ConvolutionFilter2D(ctx->CurrentDispatch, (target, internalformat, width, height, format, type, image));
+      trace_unlock();
+   }
+   else {
+      CALL_ConvolutionFilter2D(ctx->CurrentDispatch, (target, internalformat, width, height, format, type, image));
+   }
+}
+
+static void GLAPIENTRY
+trace_ConvolutionParameterf(GLenum target, GLenum pname, GLfloat params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ConvolutionParameterf);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&params, sizeof(params));
+      CALL_ConvolutionParameterf(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ConvolutionParameterf(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ConvolutionParameterfv(GLenum target, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ConvolutionParameterfv);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, convolution_parameter_count(pname) * sizeof(GLfloat));
+      CALL_ConvolutionParameterfv(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ConvolutionParameterfv(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ConvolutionParameteri(GLenum target, GLenum pname, GLint params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ConvolutionParameteri);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&params, sizeof(params));
+      CALL_ConvolutionParameteri(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ConvolutionParameteri(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ConvolutionParameteriv(GLenum target, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ConvolutionParameteriv);
+      trace_write(&target, sizeof(target));
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, convolution_parameter_count(pname) * sizeof(GLint));
+      CALL_ConvolutionParameteriv(ctx->CurrentDispatch, (target, pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ConvolutionParameteriv(ctx->CurrentDispatch, (target, pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_CopyConvolutionFilter1D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyConvolutionFilter1D);
+      trace_write(&target, sizeof(target));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      CALL_CopyConvolutionFilter1D(ctx->CurrentDispatch, (target, internalformat, x, y, width));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyConvolutionFilter1D(ctx->CurrentDispatch, (target, internalformat, x, y, width));
+   }
+}
+
+static void GLAPIENTRY
+trace_CopyConvolutionFilter2D(GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyConvolutionFilter2D);
+      trace_write(&target, sizeof(target));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      CALL_CopyConvolutionFilter2D(ctx->CurrentDispatch, (target, internalformat, x, y, width, height));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyConvolutionFilter2D(ctx->CurrentDispatch, (target, internalformat, x, y, width, height));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetConvolutionFilter(GLenum target, GLenum format, GLenum type, GLvoid * image)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetConvolutionFilter(ctx->CurrentDispatch, (target, format, type, image));
+}
+
+static void GLAPIENTRY
+trace_GetConvolutionParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetConvolutionParameterfv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetConvolutionParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetConvolutionParameteriv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetSeparableFilter(GLenum target, GLenum format, GLenum type, GLvoid * row, GLvoid * column, GLvoid * span)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetSeparableFilter(ctx->CurrentDispatch, (target, format, type, row, column, span));
+}
+
+static void GLAPIENTRY
+trace_SeparableFilter2D(GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * row, const GLvoid * column)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SeparableFilter2D);
+      trace_write(&target, sizeof(target));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(row, image_bytes(&ctx->Unpack, 1, width, 1, 1, format, type, row));
+      trace_array(column, image_bytes(&ctx->Unpack, 1, height, 1, 1, format, type, column));
+      CALL_SeparableFilter2D(ctx->CurrentDispatch, (target, internalformat, width, height, format, type, row, column));
+      trace_unlock();
+   }
+   else {
+      CALL_SeparableFilter2D(ctx->CurrentDispatch, (target, internalformat, width, height, format, type, row, column));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetHistogram(ctx->CurrentDispatch, (target, reset, format, type, values));
+}
+
+static void GLAPIENTRY
+trace_GetHistogramParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetHistogramParameterfv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetHistogramParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetHistogramParameteriv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMinmax(ctx->CurrentDispatch, (target, reset, format, type, values));
+}
+
+static void GLAPIENTRY
+trace_GetMinmaxParameterfv(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMinmaxParameterfv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetMinmaxParameteriv(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMinmaxParameteriv(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_Histogram(GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Histogram);
+      trace_write(&target, sizeof(target));
+      trace_write(&width, sizeof(width));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&sink, sizeof(sink));
+      CALL_Histogram(ctx->CurrentDispatch, (target, width, internalformat, sink));
+      trace_unlock();
+   }
+   else {
+      CALL_Histogram(ctx->CurrentDispatch, (target, width, internalformat, sink));
+   }
+}
+
+static void GLAPIENTRY
+trace_Minmax(GLenum target, GLenum internalformat, GLboolean sink)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Minmax);
+      trace_write(&target, sizeof(target));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&sink, sizeof(sink));
+      CALL_Minmax(ctx->CurrentDispatch, (target, internalformat, sink));
+      trace_unlock();
+   }
+   else {
+      CALL_Minmax(ctx->CurrentDispatch, (target, internalformat, sink));
+   }
+}
+
+static void GLAPIENTRY
+trace_ResetHistogram(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ResetHistogram);
+      trace_write(&target, sizeof(target));
+      CALL_ResetHistogram(ctx->CurrentDispatch, (target));
+      trace_unlock();
+   }
+   else {
+      CALL_ResetHistogram(ctx->CurrentDispatch, (target));
+   }
+}
+
+static void GLAPIENTRY
+trace_ResetMinmax(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ResetMinmax);
+      trace_write(&target, sizeof(target));
+      CALL_ResetMinmax(ctx->CurrentDispatch, (target));
+      trace_unlock();
+   }
+   else {
+      CALL_ResetMinmax(ctx->CurrentDispatch, (target));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexImage3D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&depth, sizeof(depth));
+      trace_write(&border, sizeof(border));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(pixels, image_bytes(&ctx->Unpack, 3, width, height, depth, format, type, pixels));
+      CALL_TexImage3D(ctx->CurrentDispatch, (target, level, internalformat, width, height, depth, border, format, type, pixels));
+      trace_unlock();
+   }
+   else {
+      CALL_TexImage3D(ctx->CurrentDispatch, (target, level, internalformat, width, height, depth, border, format, type, pixels));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexSubImage3D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&xoffset, sizeof(xoffset));
+      trace_write(&yoffset, sizeof(yoffset));
+      trace_write(&zoffset, sizeof(zoffset));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&depth, sizeof(depth));
+      trace_write(&format, sizeof(format));
+      trace_write(&type, sizeof(type));
+      trace_array(pixels, image_bytes(&ctx->Unpack, 3, width, height, depth, format, type, pixels));
+      CALL_TexSubImage3D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels));
+      trace_unlock();
+   }
+   else {
+      CALL_TexSubImage3D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels));
+   }
+}
+
+static void GLAPIENTRY
+trace_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CopyTexSubImage3D);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&xoffset, sizeof(xoffset));
+      trace_write(&yoffset, sizeof(yoffset));
+      trace_write(&zoffset, sizeof(zoffset));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      CALL_CopyTexSubImage3D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, x, y, width, height));
+      trace_unlock();
+   }
+   else {
+      CALL_CopyTexSubImage3D(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, x, y, width, height));
+   }
+}
+
+static void GLAPIENTRY
+trace_ActiveTextureARB(GLenum texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ActiveTextureARB);
+      trace_write(&texture, sizeof(texture));
+      CALL_ActiveTextureARB(ctx->CurrentDispatch, (texture));
+      trace_unlock();
+   }
+   else {
+      CALL_ActiveTextureARB(ctx->CurrentDispatch, (texture));
+   }
+}
+
+static void GLAPIENTRY
+trace_ClientActiveTextureARB(GLenum texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ClientActiveTextureARB);
+      trace_write(&texture, sizeof(texture));
+      CALL_ClientActiveTextureARB(ctx->CurrentDispatch, (texture));
+      trace_unlock();
+   }
+   else {
+      CALL_ClientActiveTextureARB(ctx->CurrentDispatch, (texture));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord1dARB(GLenum target, GLdouble s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord1dARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      CALL_MultiTexCoord1dARB(ctx->CurrentDispatch, (target, s));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord1dARB(ctx->CurrentDispatch, (target, s));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord1dvARB(GLenum target, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord1dvARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 1 * sizeof(GLdouble));
+      CALL_MultiTexCoord1dvARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord1dvARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord1fARB(GLenum target, GLfloat s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord1fARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      CALL_MultiTexCoord1fARB(ctx->CurrentDispatch, (target, s));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord1fARB(ctx->CurrentDispatch, (target, s));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord1fvARB(GLenum target, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord1fvARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 1 * sizeof(GLfloat));
+      CALL_MultiTexCoord1fvARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord1fvARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord1iARB(GLenum target, GLint s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord1iARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      CALL_MultiTexCoord1iARB(ctx->CurrentDispatch, (target, s));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord1iARB(ctx->CurrentDispatch, (target, s));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord1ivARB(GLenum target, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord1ivARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 1 * sizeof(GLint));
+      CALL_MultiTexCoord1ivARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord1ivARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord1sARB(GLenum target, GLshort s)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord1sARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      CALL_MultiTexCoord1sARB(ctx->CurrentDispatch, (target, s));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord1sARB(ctx->CurrentDispatch, (target, s));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord1svARB(GLenum target, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord1svARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 1 * sizeof(GLshort));
+      CALL_MultiTexCoord1svARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord1svARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord2dARB(GLenum target, GLdouble s, GLdouble t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord2dARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      CALL_MultiTexCoord2dARB(ctx->CurrentDispatch, (target, s, t));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord2dARB(ctx->CurrentDispatch, (target, s, t));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord2dvARB(GLenum target, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord2dvARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 2 * sizeof(GLdouble));
+      CALL_MultiTexCoord2dvARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord2dvARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord2fARB(GLenum target, GLfloat s, GLfloat t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord2fARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      CALL_MultiTexCoord2fARB(ctx->CurrentDispatch, (target, s, t));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord2fARB(ctx->CurrentDispatch, (target, s, t));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord2fvARB(GLenum target, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord2fvARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 2 * sizeof(GLfloat));
+      CALL_MultiTexCoord2fvARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord2fvARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord2iARB(GLenum target, GLint s, GLint t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord2iARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      CALL_MultiTexCoord2iARB(ctx->CurrentDispatch, (target, s, t));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord2iARB(ctx->CurrentDispatch, (target, s, t));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord2ivARB(GLenum target, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord2ivARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 2 * sizeof(GLint));
+      CALL_MultiTexCoord2ivARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord2ivARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord2sARB(GLenum target, GLshort s, GLshort t)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord2sARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      CALL_MultiTexCoord2sARB(ctx->CurrentDispatch, (target, s, t));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord2sARB(ctx->CurrentDispatch, (target, s, t));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord2svARB(GLenum target, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord2svARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 2 * sizeof(GLshort));
+      CALL_MultiTexCoord2svARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord2svARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord3dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord3dARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      CALL_MultiTexCoord3dARB(ctx->CurrentDispatch, (target, s, t, r));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord3dARB(ctx->CurrentDispatch, (target, s, t, r));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord3dvARB(GLenum target, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord3dvARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_MultiTexCoord3dvARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord3dvARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord3fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord3fARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      CALL_MultiTexCoord3fARB(ctx->CurrentDispatch, (target, s, t, r));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord3fARB(ctx->CurrentDispatch, (target, s, t, r));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord3fvARB(GLenum target, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord3fvARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_MultiTexCoord3fvARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord3fvARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord3iARB(GLenum target, GLint s, GLint t, GLint r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord3iARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      CALL_MultiTexCoord3iARB(ctx->CurrentDispatch, (target, s, t, r));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord3iARB(ctx->CurrentDispatch, (target, s, t, r));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord3ivARB(GLenum target, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord3ivARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 3 * sizeof(GLint));
+      CALL_MultiTexCoord3ivARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord3ivARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord3sARB(GLenum target, GLshort s, GLshort t, GLshort r)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord3sARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      CALL_MultiTexCoord3sARB(ctx->CurrentDispatch, (target, s, t, r));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord3sARB(ctx->CurrentDispatch, (target, s, t, r));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord3svARB(GLenum target, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord3svARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_MultiTexCoord3svARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord3svARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord4dARB(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord4dARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      trace_write(&q, sizeof(q));
+      CALL_MultiTexCoord4dARB(ctx->CurrentDispatch, (target, s, t, r, q));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord4dARB(ctx->CurrentDispatch, (target, s, t, r, q));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord4dvARB(GLenum target, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord4dvARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 4 * sizeof(GLdouble));
+      CALL_MultiTexCoord4dvARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord4dvARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord4fARB(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord4fARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      trace_write(&q, sizeof(q));
+      CALL_MultiTexCoord4fARB(ctx->CurrentDispatch, (target, s, t, r, q));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord4fARB(ctx->CurrentDispatch, (target, s, t, r, q));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord4fvARB(GLenum target, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord4fvARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 4 * sizeof(GLfloat));
+      CALL_MultiTexCoord4fvARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord4fvARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord4iARB(GLenum target, GLint s, GLint t, GLint r, GLint q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord4iARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      trace_write(&q, sizeof(q));
+      CALL_MultiTexCoord4iARB(ctx->CurrentDispatch, (target, s, t, r, q));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord4iARB(ctx->CurrentDispatch, (target, s, t, r, q));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord4ivARB(GLenum target, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord4ivARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 4 * sizeof(GLint));
+      CALL_MultiTexCoord4ivARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord4ivARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord4sARB(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord4sARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&s, sizeof(s));
+      trace_write(&t, sizeof(t));
+      trace_write(&r, sizeof(r));
+      trace_write(&q, sizeof(q));
+      CALL_MultiTexCoord4sARB(ctx->CurrentDispatch, (target, s, t, r, q));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord4sARB(ctx->CurrentDispatch, (target, s, t, r, q));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiTexCoord4svARB(GLenum target, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultiTexCoord4svARB);
+      trace_write(&target, sizeof(target));
+      trace_array(v, 4 * sizeof(GLshort));
+      CALL_MultiTexCoord4svARB(ctx->CurrentDispatch, (target, v));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiTexCoord4svARB(ctx->CurrentDispatch, (target, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_LoadTransposeMatrixfARB(const GLfloat * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LoadTransposeMatrixfARB);
+      trace_array(m, 16 * sizeof(GLfloat));
+      CALL_LoadTransposeMatrixfARB(ctx->CurrentDispatch, (m));
+      trace_unlock();
+   }
+   else {
+      CALL_LoadTransposeMatrixfARB(ctx->CurrentDispatch, (m));
+   }
+}
+
+static void GLAPIENTRY
+trace_LoadTransposeMatrixdARB(const GLdouble * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LoadTransposeMatrixdARB);
+      trace_array(m, 16 * sizeof(GLdouble));
+      CALL_LoadTransposeMatrixdARB(ctx->CurrentDispatch, (m));
+      trace_unlock();
+   }
+   else {
+      CALL_LoadTransposeMatrixdARB(ctx->CurrentDispatch, (m));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultTransposeMatrixfARB(const GLfloat * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultTransposeMatrixfARB);
+      trace_array(m, 16 * sizeof(GLfloat));
+      CALL_MultTransposeMatrixfARB(ctx->CurrentDispatch, (m));
+      trace_unlock();
+   }
+   else {
+      CALL_MultTransposeMatrixfARB(ctx->CurrentDispatch, (m));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultTransposeMatrixdARB(const GLdouble * m)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MultTransposeMatrixdARB);
+      trace_array(m, 16 * sizeof(GLdouble));
+      CALL_MultTransposeMatrixdARB(ctx->CurrentDispatch, (m));
+      trace_unlock();
+   }
+   else {
+      CALL_MultTransposeMatrixdARB(ctx->CurrentDispatch, (m));
+   }
+}
+
+static void GLAPIENTRY
+trace_SampleCoverageARB(GLclampf value, GLboolean invert)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SampleCoverageARB);
+      trace_write(&value, sizeof(value));
+      trace_write(&invert, sizeof(invert));
+      CALL_SampleCoverageARB(ctx->CurrentDispatch, (value, invert));
+      trace_unlock();
+   }
+   else {
+      CALL_SampleCoverageARB(ctx->CurrentDispatch, (value, invert));
+   }
+}
+
+static void GLAPIENTRY
+trace_DrawBuffersARB(GLsizei n, const GLenum * bufs)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DrawBuffersARB);
+      trace_write(&n, sizeof(n));
+      trace_array(bufs, count_bytes(n, sizeof(GLenum)));
+      CALL_DrawBuffersARB(ctx->CurrentDispatch, (n, bufs));
+      trace_unlock();
+   }
+   else {
+      CALL_DrawBuffersARB(ctx->CurrentDispatch, (n, bufs));
+   }
+}
+
+static void GLAPIENTRY
+trace_PolygonOffsetEXT(GLfloat factor, GLfloat bias)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PolygonOffsetEXT);
+      trace_write(&factor, sizeof(factor));
+      trace_write(&bias, sizeof(bias));
+      CALL_PolygonOffsetEXT(ctx->CurrentDispatch, (factor, bias));
+      trace_unlock();
+   }
+   else {
+      CALL_PolygonOffsetEXT(ctx->CurrentDispatch, (factor, bias));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetTexFilterFuncSGIS(GLenum target, GLenum filter, GLfloat * weights)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTexFilterFuncSGIS(ctx->CurrentDispatch, (target, filter, weights));
+}
+
+static void GLAPIENTRY
+trace_TexFilterFuncSGIS(GLenum target, GLenum filter, GLsizei n, const GLfloat * weights)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TexFilterFuncSGIS);
+      trace_write(&target, sizeof(target));
+      trace_write(&filter, sizeof(filter));
+      trace_write(&n, sizeof(n));
+      trace_array(weights, count_bytes(n, sizeof(GLfloat)));
+      CALL_TexFilterFuncSGIS(ctx->CurrentDispatch, (target, filter, n, weights));
+      trace_unlock();
+   }
+   else {
+      CALL_TexFilterFuncSGIS(ctx->CurrentDispatch, (target, filter, n, weights));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetHistogramEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetHistogramEXT(ctx->CurrentDispatch, (target, reset, format, type, values));
+}
+
+static void GLAPIENTRY
+trace_GetHistogramParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetHistogramParameterfvEXT(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetHistogramParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetHistogramParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetMinmaxEXT(GLenum target, GLboolean reset, GLenum format, GLenum type, GLvoid * values)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMinmaxEXT(ctx->CurrentDispatch, (target, reset, format, type, values));
+}
+
+static void GLAPIENTRY
+trace_GetMinmaxParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMinmaxParameterfvEXT(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetMinmaxParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetMinmaxParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetConvolutionFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid * image)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetConvolutionFilterEXT(ctx->CurrentDispatch, (target, format, type, image));
+}
+
+static void GLAPIENTRY
+trace_GetConvolutionParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetConvolutionParameterfvEXT(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetConvolutionParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetConvolutionParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetSeparableFilterEXT(GLenum target, GLenum format, GLenum type, GLvoid * row, GLvoid * column, GLvoid * span)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetSeparableFilterEXT(ctx->CurrentDispatch, (target, format, type, row, column, span));
+}
+
+static void GLAPIENTRY
+trace_GetColorTableSGI(GLenum target, GLenum format, GLenum type, GLvoid * table)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetColorTableSGI(ctx->CurrentDispatch, (target, format, type, table));
+}
+
+static void GLAPIENTRY
+trace_GetColorTableParameterfvSGI(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetColorTableParameterfvSGI(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetColorTableParameterivSGI(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetColorTableParameterivSGI(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_PixelTexGenSGIX(GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelTexGenSGIX);
+      trace_write(&mode, sizeof(mode));
+      CALL_PixelTexGenSGIX(ctx->CurrentDispatch, (mode));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelTexGenSGIX(ctx->CurrentDispatch, (mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelTexGenParameteriSGIS(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelTexGenParameteriSGIS);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_PixelTexGenParameteriSGIS(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelTexGenParameteriSGIS(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelTexGenParameterivSGIS(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_PixelTexGenParameterivSGIS);
+   CALL_PixelTexGenParameterivSGIS(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_PixelTexGenParameterfSGIS(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PixelTexGenParameterfSGIS);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_PixelTexGenParameterfSGIS(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_PixelTexGenParameterfSGIS(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_PixelTexGenParameterfvSGIS(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_PixelTexGenParameterfvSGIS);
+   CALL_PixelTexGenParameterfvSGIS(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetPixelTexGenParameterivSGIS(GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetPixelTexGenParameterivSGIS(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetPixelTexGenParameterfvSGIS(GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetPixelTexGenParameterfvSGIS(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_TexImage4DSGIS(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLint border, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_TexImage4DSGIS);
+   CALL_TexImage4DSGIS(ctx->CurrentDispatch, (target, level, internalformat, width, height, depth, size4d, border, format, type, pixels));
+}
+
+static void GLAPIENTRY
+trace_TexSubImage4DSGIS(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei size4d, GLenum format, GLenum type, const GLvoid * pixels)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_TexSubImage4DSGIS);
+   CALL_TexSubImage4DSGIS(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, size4d, format, type, pixels));
+}
+
+static GLboolean GLAPIENTRY
+trace_AreTexturesResidentEXT(GLsizei n, const GLuint * textures, GLboolean * residences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_AreTexturesResidentEXT(ctx->CurrentDispatch, (n, textures, residences));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_GenTexturesEXT(GLsizei n, GLuint * textures)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenTexturesEXT);
+      trace_write(&n, sizeof(n));
+      trace_output(textures, count_bytes(n, sizeof(GLuint)));
+      CALL_GenTexturesEXT(ctx->CurrentDispatch, (n, textures));
+      trace_unlock();
+   }
+   else {
+      CALL_GenTexturesEXT(ctx->CurrentDispatch, (n, textures));
+   }
+}
+
+static GLboolean GLAPIENTRY
+trace_IsTextureEXT(GLuint texture)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsTextureEXT(ctx->CurrentDispatch, (texture));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_DetailTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DetailTexFuncSGIS);
+      trace_write(&target, sizeof(target));
+      trace_write(&n, sizeof(n));
+      trace_array(points, count_bytes(2 * n, sizeof(GLfloat)));
+      CALL_DetailTexFuncSGIS(ctx->CurrentDispatch, (target, n, points));
+      trace_unlock();
+   }
+   else {
+      CALL_DetailTexFuncSGIS(ctx->CurrentDispatch, (target, n, points));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetDetailTexFuncSGIS(GLenum target, GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetDetailTexFuncSGIS(ctx->CurrentDispatch, (target, points));
+}
+
+static void GLAPIENTRY
+trace_SharpenTexFuncSGIS(GLenum target, GLsizei n, const GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SharpenTexFuncSGIS);
+      trace_write(&target, sizeof(target));
+      trace_write(&n, sizeof(n));
+      trace_array(points, count_bytes(2 * n, sizeof(GLfloat)));
+      CALL_SharpenTexFuncSGIS(ctx->CurrentDispatch, (target, n, points));
+      trace_unlock();
+   }
+   else {
+      CALL_SharpenTexFuncSGIS(ctx->CurrentDispatch, (target, n, points));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetSharpenTexFuncSGIS(GLenum target, GLfloat * points)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetSharpenTexFuncSGIS(ctx->CurrentDispatch, (target, points));
+}
+
+static void GLAPIENTRY
+trace_SampleMaskSGIS(GLclampf value, GLboolean invert)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SampleMaskSGIS);
+      trace_write(&value, sizeof(value));
+      trace_write(&invert, sizeof(invert));
+      CALL_SampleMaskSGIS(ctx->CurrentDispatch, (value, invert));
+      trace_unlock();
+   }
+   else {
+      CALL_SampleMaskSGIS(ctx->CurrentDispatch, (value, invert));
+   }
+}
+
+static void GLAPIENTRY
+trace_SamplePatternSGIS(GLenum pattern)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SamplePatternSGIS);
+      trace_write(&pattern, sizeof(pattern));
+      CALL_SamplePatternSGIS(ctx->CurrentDispatch, (pattern));
+      trace_unlock();
+   }
+   else {
+      CALL_SamplePatternSGIS(ctx->CurrentDispatch, (pattern));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_ColorPointerEXT(ctx->CurrentDispatch, (size, type, stride, count, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_ColorPointerEXT(ctx->CurrentDispatch, (size, type, stride, count, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_EdgeFlagPointerEXT(GLsizei stride, GLsizei count, const GLboolean * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_EdgeFlagPointerEXT(ctx->CurrentDispatch, (stride, count, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_EdgeFlagPointerEXT(ctx->CurrentDispatch, (stride, count, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_IndexPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_IndexPointerEXT(ctx->CurrentDispatch, (type, stride, count, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_IndexPointerEXT(ctx->CurrentDispatch, (type, stride, count, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_NormalPointerEXT(GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_NormalPointerEXT(ctx->CurrentDispatch, (type, stride, count, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_NormalPointerEXT(ctx->CurrentDispatch, (type, stride, count, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_TexCoordPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_TexCoordPointerEXT(ctx->CurrentDispatch, (size, type, stride, count, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_TexCoordPointerEXT(ctx->CurrentDispatch, (size, type, stride, count, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexPointerEXT(GLint size, GLenum type, GLsizei stride, GLsizei count, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_VertexPointerEXT(ctx->CurrentDispatch, (size, type, stride, count, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_VertexPointerEXT(ctx->CurrentDispatch, (size, type, stride, count, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_SpriteParameterfSGIX(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SpriteParameterfSGIX);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_SpriteParameterfSGIX(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_SpriteParameterfSGIX(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_SpriteParameterfvSGIX(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_SpriteParameterfvSGIX);
+   CALL_SpriteParameterfvSGIX(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_SpriteParameteriSGIX(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SpriteParameteriSGIX);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_SpriteParameteriSGIX(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_SpriteParameteriSGIX(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_SpriteParameterivSGIX(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_SpriteParameterivSGIX);
+   CALL_SpriteParameterivSGIX(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_PointParameterfEXT(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PointParameterfEXT);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_PointParameterfEXT(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_PointParameterfEXT(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_PointParameterfvEXT(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PointParameterfvEXT);
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, point_parameter_count(pname) * sizeof(GLfloat));
+      CALL_PointParameterfvEXT(ctx->CurrentDispatch, (pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_PointParameterfvEXT(ctx->CurrentDispatch, (pname, params));
+   }
+}
+
+static GLint GLAPIENTRY
+trace_GetInstrumentsSGIX(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   ret = CALL_GetInstrumentsSGIX(ctx->CurrentDispatch, ());
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_InstrumentsBufferSGIX(GLsizei size, GLint * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_InstrumentsBufferSGIX);
+   CALL_InstrumentsBufferSGIX(ctx->CurrentDispatch, (size, buffer));
+}
+
+static GLint GLAPIENTRY
+trace_PollInstrumentsSGIX(GLint * marker_p)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   ret = CALL_PollInstrumentsSGIX(ctx->CurrentDispatch, (marker_p));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_ReadInstrumentsSGIX(GLint marker)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ReadInstrumentsSGIX);
+      trace_write(&marker, sizeof(marker));
+      CALL_ReadInstrumentsSGIX(ctx->CurrentDispatch, (marker));
+      trace_unlock();
+   }
+   else {
+      CALL_ReadInstrumentsSGIX(ctx->CurrentDispatch, (marker));
+   }
+}
+
+static void GLAPIENTRY
+trace_StartInstrumentsSGIX(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_StartInstrumentsSGIX);
+      CALL_StartInstrumentsSGIX(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_StartInstrumentsSGIX(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_StopInstrumentsSGIX(GLint marker)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_StopInstrumentsSGIX);
+      trace_write(&marker, sizeof(marker));
+      CALL_StopInstrumentsSGIX(ctx->CurrentDispatch, (marker));
+      trace_unlock();
+   }
+   else {
+      CALL_StopInstrumentsSGIX(ctx->CurrentDispatch, (marker));
+   }
+}
+
+static void GLAPIENTRY
+trace_FrameZoomSGIX(GLint factor)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FrameZoomSGIX);
+      trace_write(&factor, sizeof(factor));
+      CALL_FrameZoomSGIX(ctx->CurrentDispatch, (factor));
+      trace_unlock();
+   }
+   else {
+      CALL_FrameZoomSGIX(ctx->CurrentDispatch, (factor));
+   }
+}
+
+static void GLAPIENTRY
+trace_TagSampleBufferSGIX(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TagSampleBufferSGIX);
+      CALL_TagSampleBufferSGIX(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_TagSampleBufferSGIX(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_ReferencePlaneSGIX(const GLdouble * equation)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_ReferencePlaneSGIX);
+   CALL_ReferencePlaneSGIX(ctx->CurrentDispatch, (equation));
+}
+
+static void GLAPIENTRY
+trace_FlushRasterSGIX(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FlushRasterSGIX);
+      CALL_FlushRasterSGIX(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_FlushRasterSGIX(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_GetListParameterfvSGIX(GLuint list, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetListParameterfvSGIX(ctx->CurrentDispatch, (list, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetListParameterivSGIX(GLuint list, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetListParameterivSGIX(ctx->CurrentDispatch, (list, pname, params));
+}
+
+static void GLAPIENTRY
+trace_ListParameterfSGIX(GLuint list, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ListParameterfSGIX);
+      trace_write(&list, sizeof(list));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_ListParameterfSGIX(ctx->CurrentDispatch, (list, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_ListParameterfSGIX(ctx->CurrentDispatch, (list, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_ListParameterfvSGIX(GLuint list, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_ListParameterfvSGIX);
+   CALL_ListParameterfvSGIX(ctx->CurrentDispatch, (list, pname, params));
+}
+
+static void GLAPIENTRY
+trace_ListParameteriSGIX(GLuint list, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ListParameteriSGIX);
+      trace_write(&list, sizeof(list));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_ListParameteriSGIX(ctx->CurrentDispatch, (list, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_ListParameteriSGIX(ctx->CurrentDispatch, (list, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_ListParameterivSGIX(GLuint list, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_ListParameterivSGIX);
+   CALL_ListParameterivSGIX(ctx->CurrentDispatch, (list, pname, params));
+}
+
+static void GLAPIENTRY
+trace_FragmentColorMaterialSGIX(GLenum face, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FragmentColorMaterialSGIX);
+      trace_write(&face, sizeof(face));
+      trace_write(&mode, sizeof(mode));
+      CALL_FragmentColorMaterialSGIX(ctx->CurrentDispatch, (face, mode));
+      trace_unlock();
+   }
+   else {
+      CALL_FragmentColorMaterialSGIX(ctx->CurrentDispatch, (face, mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_FragmentLightfSGIX(GLenum light, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FragmentLightfSGIX);
+      trace_write(&light, sizeof(light));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_FragmentLightfSGIX(ctx->CurrentDispatch, (light, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_FragmentLightfSGIX(ctx->CurrentDispatch, (light, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_FragmentLightfvSGIX(GLenum light, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_FragmentLightfvSGIX);
+   CALL_FragmentLightfvSGIX(ctx->CurrentDispatch, (light, pname, params));
+}
+
+static void GLAPIENTRY
+trace_FragmentLightiSGIX(GLenum light, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FragmentLightiSGIX);
+      trace_write(&light, sizeof(light));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_FragmentLightiSGIX(ctx->CurrentDispatch, (light, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_FragmentLightiSGIX(ctx->CurrentDispatch, (light, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_FragmentLightivSGIX(GLenum light, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_FragmentLightivSGIX);
+   CALL_FragmentLightivSGIX(ctx->CurrentDispatch, (light, pname, params));
+}
+
+static void GLAPIENTRY
+trace_FragmentLightModelfSGIX(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FragmentLightModelfSGIX);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_FragmentLightModelfSGIX(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_FragmentLightModelfSGIX(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_FragmentLightModelfvSGIX(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_FragmentLightModelfvSGIX);
+   CALL_FragmentLightModelfvSGIX(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_FragmentLightModeliSGIX(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FragmentLightModeliSGIX);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_FragmentLightModeliSGIX(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_FragmentLightModeliSGIX(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_FragmentLightModelivSGIX(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_FragmentLightModelivSGIX);
+   CALL_FragmentLightModelivSGIX(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_FragmentMaterialfSGIX(GLenum face, GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FragmentMaterialfSGIX);
+      trace_write(&face, sizeof(face));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_FragmentMaterialfSGIX(ctx->CurrentDispatch, (face, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_FragmentMaterialfSGIX(ctx->CurrentDispatch, (face, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_FragmentMaterialfvSGIX(GLenum face, GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_FragmentMaterialfvSGIX);
+   CALL_FragmentMaterialfvSGIX(ctx->CurrentDispatch, (face, pname, params));
+}
+
+static void GLAPIENTRY
+trace_FragmentMaterialiSGIX(GLenum face, GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FragmentMaterialiSGIX);
+      trace_write(&face, sizeof(face));
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_FragmentMaterialiSGIX(ctx->CurrentDispatch, (face, pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_FragmentMaterialiSGIX(ctx->CurrentDispatch, (face, pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_FragmentMaterialivSGIX(GLenum face, GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_FragmentMaterialivSGIX);
+   CALL_FragmentMaterialivSGIX(ctx->CurrentDispatch, (face, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetFragmentLightfvSGIX(GLenum light, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetFragmentLightfvSGIX(ctx->CurrentDispatch, (light, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetFragmentLightivSGIX(GLenum light, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetFragmentLightivSGIX(ctx->CurrentDispatch, (light, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetFragmentMaterialfvSGIX(GLenum face, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetFragmentMaterialfvSGIX(ctx->CurrentDispatch, (face, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetFragmentMaterialivSGIX(GLenum face, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetFragmentMaterialivSGIX(ctx->CurrentDispatch, (face, pname, params));
+}
+
+static void GLAPIENTRY
+trace_LightEnviSGIX(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LightEnviSGIX);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_LightEnviSGIX(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_LightEnviSGIX(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexWeightfEXT(GLfloat weight)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexWeightfEXT);
+      trace_write(&weight, sizeof(weight));
+      CALL_VertexWeightfEXT(ctx->CurrentDispatch, (weight));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexWeightfEXT(ctx->CurrentDispatch, (weight));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexWeightfvEXT(const GLfloat * weight)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexWeightfvEXT);
+      trace_array(weight, sizeof(GLfloat));
+      CALL_VertexWeightfvEXT(ctx->CurrentDispatch, (weight));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexWeightfvEXT(ctx->CurrentDispatch, (weight));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexWeightPointerEXT(GLsizei size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_VertexWeightPointerEXT);
+   CALL_VertexWeightPointerEXT(ctx->CurrentDispatch, (size, type, stride, pointer));
+}
+
+static void GLAPIENTRY
+trace_FlushVertexArrayRangeNV(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FlushVertexArrayRangeNV);
+      CALL_FlushVertexArrayRangeNV(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_FlushVertexArrayRangeNV(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexArrayRangeNV(GLsizei length, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_VertexArrayRangeNV);
+   CALL_VertexArrayRangeNV(ctx->CurrentDispatch, (length, pointer));
+}
+
+static void GLAPIENTRY
+trace_CombinerParameterfvNV(GLenum pname, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CombinerParameterfvNV);
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, combiner_parameter_count(pname) * sizeof(GLfloat));
+      CALL_CombinerParameterfvNV(ctx->CurrentDispatch, (pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_CombinerParameterfvNV(ctx->CurrentDispatch, (pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_CombinerParameterfNV(GLenum pname, GLfloat param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CombinerParameterfNV);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_CombinerParameterfNV(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_CombinerParameterfNV(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_CombinerParameterivNV(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CombinerParameterivNV);
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, combiner_parameter_count(pname) * sizeof(GLint));
+      CALL_CombinerParameterivNV(ctx->CurrentDispatch, (pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_CombinerParameterivNV(ctx->CurrentDispatch, (pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_CombinerParameteriNV(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CombinerParameteriNV);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_CombinerParameteriNV(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_CombinerParameteriNV(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_CombinerInputNV(GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CombinerInputNV);
+      trace_write(&stage, sizeof(stage));
+      trace_write(&portion, sizeof(portion));
+      trace_write(&variable, sizeof(variable));
+      trace_write(&input, sizeof(input));
+      trace_write(&mapping, sizeof(mapping));
+      trace_write(&componentUsage, sizeof(componentUsage));
+      CALL_CombinerInputNV(ctx->CurrentDispatch, (stage, portion, variable, input, mapping, componentUsage));
+      trace_unlock();
+   }
+   else {
+      CALL_CombinerInputNV(ctx->CurrentDispatch, (stage, portion, variable, input, mapping, componentUsage));
+   }
+}
+
+static void GLAPIENTRY
+trace_CombinerOutputNV(GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CombinerOutputNV);
+      trace_write(&stage, sizeof(stage));
+      trace_write(&portion, sizeof(portion));
+      trace_write(&abOutput, sizeof(abOutput));
+      trace_write(&cdOutput, sizeof(cdOutput));
+      trace_write(&sumOutput, sizeof(sumOutput));
+      trace_write(&scale, sizeof(scale));
+      trace_write(&bias, sizeof(bias));
+      trace_write(&abDotProduct, sizeof(abDotProduct));
+      trace_write(&cdDotProduct, sizeof(cdDotProduct));
+      trace_write(&muxSum, sizeof(muxSum));
+      CALL_CombinerOutputNV(ctx->CurrentDispatch, (stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum));
+      trace_unlock();
+   }
+   else {
+      CALL_CombinerOutputNV(ctx->CurrentDispatch, (stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum));
+   }
+}
+
+static void GLAPIENTRY
+trace_FinalCombinerInputNV(GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FinalCombinerInputNV);
+      trace_write(&variable, sizeof(variable));
+      trace_write(&input, sizeof(input));
+      trace_write(&mapping, sizeof(mapping));
+      trace_write(&componentUsage, sizeof(componentUsage));
+      CALL_FinalCombinerInputNV(ctx->CurrentDispatch, (variable, input, mapping, componentUsage));
+      trace_unlock();
+   }
+   else {
+      CALL_FinalCombinerInputNV(ctx->CurrentDispatch, (variable, input, mapping, componentUsage));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetCombinerInputParameterfvNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetCombinerInputParameterfvNV(ctx->CurrentDispatch, (stage, portion, variable, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetCombinerInputParameterivNV(GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetCombinerInputParameterivNV(ctx->CurrentDispatch, (stage, portion, variable, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetCombinerOutputParameterfvNV(GLenum stage, GLenum portion, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetCombinerOutputParameterfvNV(ctx->CurrentDispatch, (stage, portion, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetCombinerOutputParameterivNV(GLenum stage, GLenum portion, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetCombinerOutputParameterivNV(ctx->CurrentDispatch, (stage, portion, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetFinalCombinerInputParameterfvNV(GLenum variable, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetFinalCombinerInputParameterfvNV(ctx->CurrentDispatch, (variable, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetFinalCombinerInputParameterivNV(GLenum variable, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetFinalCombinerInputParameterivNV(ctx->CurrentDispatch, (variable, pname, params));
+}
+
+static void GLAPIENTRY
+trace_ResizeBuffersMESA(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ResizeBuffersMESA);
+      CALL_ResizeBuffersMESA(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_ResizeBuffersMESA(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos2dMESA(GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos2dMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_WindowPos2dMESA(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos2dMESA(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos2dvMESA(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos2dvMESA);
+      trace_array(v, 2 * sizeof(GLdouble));
+      CALL_WindowPos2dvMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos2dvMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos2fMESA(GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos2fMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_WindowPos2fMESA(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos2fMESA(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos2fvMESA(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos2fvMESA);
+      trace_array(v, 2 * sizeof(GLfloat));
+      CALL_WindowPos2fvMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos2fvMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos2iMESA(GLint x, GLint y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos2iMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_WindowPos2iMESA(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos2iMESA(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos2ivMESA(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos2ivMESA);
+      trace_array(v, 2 * sizeof(GLint));
+      CALL_WindowPos2ivMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos2ivMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos2sMESA(GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos2sMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_WindowPos2sMESA(ctx->CurrentDispatch, (x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos2sMESA(ctx->CurrentDispatch, (x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos2svMESA(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos2svMESA);
+      trace_array(v, 2 * sizeof(GLshort));
+      CALL_WindowPos2svMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos2svMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos3dMESA(GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos3dMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_WindowPos3dMESA(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos3dMESA(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos3dvMESA(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos3dvMESA);
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_WindowPos3dvMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos3dvMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos3fMESA(GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos3fMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_WindowPos3fMESA(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos3fMESA(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos3fvMESA(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos3fvMESA);
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_WindowPos3fvMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos3fvMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos3iMESA(GLint x, GLint y, GLint z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos3iMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_WindowPos3iMESA(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos3iMESA(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos3ivMESA(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos3ivMESA);
+      trace_array(v, 3 * sizeof(GLint));
+      CALL_WindowPos3ivMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos3ivMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos3sMESA(GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos3sMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_WindowPos3sMESA(ctx->CurrentDispatch, (x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos3sMESA(ctx->CurrentDispatch, (x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos3svMESA(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos3svMESA);
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_WindowPos3svMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos3svMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos4dMESA(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos4dMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_WindowPos4dMESA(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos4dMESA(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos4dvMESA(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos4dvMESA);
+      trace_array(v, 4 * sizeof(GLdouble));
+      CALL_WindowPos4dvMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos4dvMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos4fMESA(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos4fMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_WindowPos4fMESA(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos4fMESA(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos4fvMESA(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos4fvMESA);
+      trace_array(v, 4 * sizeof(GLfloat));
+      CALL_WindowPos4fvMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos4fvMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos4iMESA(GLint x, GLint y, GLint z, GLint w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos4iMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_WindowPos4iMESA(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos4iMESA(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos4ivMESA(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos4ivMESA);
+      trace_array(v, 4 * sizeof(GLint));
+      CALL_WindowPos4ivMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos4ivMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos4sMESA(GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos4sMESA);
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_WindowPos4sMESA(ctx->CurrentDispatch, (x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos4sMESA(ctx->CurrentDispatch, (x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_WindowPos4svMESA(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_WindowPos4svMESA);
+      trace_array(v, 4 * sizeof(GLshort));
+      CALL_WindowPos4svMESA(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_WindowPos4svMESA(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_BlendFuncSeparateEXT(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BlendFuncSeparateEXT);
+      trace_write(&sfactorRGB, sizeof(sfactorRGB));
+      trace_write(&dfactorRGB, sizeof(dfactorRGB));
+      trace_write(&sfactorAlpha, sizeof(sfactorAlpha));
+      trace_write(&dfactorAlpha, sizeof(dfactorAlpha));
+      CALL_BlendFuncSeparateEXT(ctx->CurrentDispatch, (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha));
+      trace_unlock();
+   }
+   else {
+      CALL_BlendFuncSeparateEXT(ctx->CurrentDispatch, (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha));
+   }
+}
+
+static void GLAPIENTRY
+trace_IndexMaterialEXT(GLenum face, GLenum mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_IndexMaterialEXT);
+      trace_write(&face, sizeof(face));
+      trace_write(&mode, sizeof(mode));
+      CALL_IndexMaterialEXT(ctx->CurrentDispatch, (face, mode));
+      trace_unlock();
+   }
+   else {
+      CALL_IndexMaterialEXT(ctx->CurrentDispatch, (face, mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_IndexFuncEXT(GLenum func, GLclampf ref)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_IndexFuncEXT);
+      trace_write(&func, sizeof(func));
+      trace_write(&ref, sizeof(ref));
+      CALL_IndexFuncEXT(ctx->CurrentDispatch, (func, ref));
+      trace_unlock();
+   }
+   else {
+      CALL_IndexFuncEXT(ctx->CurrentDispatch, (func, ref));
+   }
+}
+
+static void GLAPIENTRY
+trace_LockArraysEXT(GLint first, GLsizei count)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LockArraysEXT);
+      trace_write(&first, sizeof(first));
+      trace_write(&count, sizeof(count));
+      CALL_LockArraysEXT(ctx->CurrentDispatch, (first, count));
+      trace_unlock();
+   }
+   else {
+      CALL_LockArraysEXT(ctx->CurrentDispatch, (first, count));
+   }
+}
+
+static void GLAPIENTRY
+trace_UnlockArraysEXT(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_UnlockArraysEXT);
+      CALL_UnlockArraysEXT(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_UnlockArraysEXT(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_CullParameterdvEXT(GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_CullParameterdvEXT);
+   CALL_CullParameterdvEXT(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_CullParameterfvEXT(GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_CullParameterfvEXT);
+   CALL_CullParameterfvEXT(ctx->CurrentDispatch, (pname, params));
+}
+
+static void GLAPIENTRY
+trace_HintPGI(GLenum target, GLint mode)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_HintPGI);
+      trace_write(&target, sizeof(target));
+      trace_write(&mode, sizeof(mode));
+      CALL_HintPGI(ctx->CurrentDispatch, (target, mode));
+      trace_unlock();
+   }
+   else {
+      CALL_HintPGI(ctx->CurrentDispatch, (target, mode));
+   }
+}
+
+static void GLAPIENTRY
+trace_FogCoordfEXT(GLfloat coord)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FogCoordfEXT);
+      trace_write(&coord, sizeof(coord));
+      CALL_FogCoordfEXT(ctx->CurrentDispatch, (coord));
+      trace_unlock();
+   }
+   else {
+      CALL_FogCoordfEXT(ctx->CurrentDispatch, (coord));
+   }
+}
+
+static void GLAPIENTRY
+trace_FogCoordfvEXT(const GLfloat * coord)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FogCoordfvEXT);
+      trace_array(coord, 1 * sizeof(GLfloat));
+      CALL_FogCoordfvEXT(ctx->CurrentDispatch, (coord));
+      trace_unlock();
+   }
+   else {
+      CALL_FogCoordfvEXT(ctx->CurrentDispatch, (coord));
+   }
+}
+
+static void GLAPIENTRY
+trace_FogCoorddEXT(GLdouble coord)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FogCoorddEXT);
+      trace_write(&coord, sizeof(coord));
+      CALL_FogCoorddEXT(ctx->CurrentDispatch, (coord));
+      trace_unlock();
+   }
+   else {
+      CALL_FogCoorddEXT(ctx->CurrentDispatch, (coord));
+   }
+}
+
+static void GLAPIENTRY
+trace_FogCoorddvEXT(const GLdouble * coord)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FogCoorddvEXT);
+      trace_array(coord, 1 * sizeof(GLdouble));
+      CALL_FogCoorddvEXT(ctx->CurrentDispatch, (coord));
+      trace_unlock();
+   }
+   else {
+      CALL_FogCoorddvEXT(ctx->CurrentDispatch, (coord));
+   }
+}
+
+static void GLAPIENTRY
+trace_FogCoordPointerEXT(GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_FogCoordPointerEXT(ctx->CurrentDispatch, (type, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_FogCoordPointerEXT(ctx->CurrentDispatch, (type, stride, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetColorTableEXT(GLenum target, GLenum format, GLenum type, GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetColorTableEXT(ctx->CurrentDispatch, (target, format, type, data));
+}
+
+static void GLAPIENTRY
+trace_GetColorTableParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetColorTableParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetColorTableParameterfvEXT(GLenum target, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetColorTableParameterfvEXT(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_TbufferMask3DFX(GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TbufferMask3DFX);
+      trace_write(&mask, sizeof(mask));
+      CALL_TbufferMask3DFX(ctx->CurrentDispatch, (mask));
+      trace_unlock();
+   }
+   else {
+      CALL_TbufferMask3DFX(ctx->CurrentDispatch, (mask));
+   }
+}
+
+static void GLAPIENTRY
+trace_CompressedTexImage3DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CompressedTexImage3DARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&depth, sizeof(depth));
+      trace_write(&border, sizeof(border));
+      trace_write(&imageSize, sizeof(imageSize));
+      trace_array(data, compressed_bytes(ctx, imageSize, data));
+      CALL_CompressedTexImage3DARB(ctx->CurrentDispatch, (target, level, internalformat, width, height, depth, border, imageSize, data));
+      trace_unlock();
+   }
+   else {
+      CALL_CompressedTexImage3DARB(ctx->CurrentDispatch, (target, level, internalformat, width, height, depth, border, imageSize, data));
+   }
+}
+
+static void GLAPIENTRY
+trace_CompressedTexImage2DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CompressedTexImage2DARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&border, sizeof(border));
+      trace_write(&imageSize, sizeof(imageSize));
+      trace_array(data, compressed_bytes(ctx, imageSize, data));
+      CALL_CompressedTexImage2DARB(ctx->CurrentDispatch, (target, level, internalformat, width, height, border, imageSize, data));
+      trace_unlock();
+   }
+   else {
+      CALL_CompressedTexImage2DARB(ctx->CurrentDispatch, (target, level, internalformat, width, height, border, imageSize, data));
+   }
+}
+
+static void GLAPIENTRY
+trace_CompressedTexImage1DARB(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CompressedTexImage1DARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&border, sizeof(border));
+      trace_write(&imageSize, sizeof(imageSize));
+      trace_array(data, compressed_bytes(ctx, imageSize, data));
+      CALL_CompressedTexImage1DARB(ctx->CurrentDispatch, (target, level, internalformat, width, border, imageSize, data));
+      trace_unlock();
+   }
+   else {
+      CALL_CompressedTexImage1DARB(ctx->CurrentDispatch, (target, level, internalformat, width, border, imageSize, data));
+   }
+}
+
+static void GLAPIENTRY
+trace_CompressedTexSubImage3DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CompressedTexSubImage3DARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&xoffset, sizeof(xoffset));
+      trace_write(&yoffset, sizeof(yoffset));
+      trace_write(&zoffset, sizeof(zoffset));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&depth, sizeof(depth));
+      trace_write(&format, sizeof(format));
+      trace_write(&imageSize, sizeof(imageSize));
+      trace_array(data, compressed_bytes(ctx, imageSize, data));
+      CALL_CompressedTexSubImage3DARB(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data));
+      trace_unlock();
+   }
+   else {
+      CALL_CompressedTexSubImage3DARB(ctx->CurrentDispatch, (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data));
+   }
+}
+
+static void GLAPIENTRY
+trace_CompressedTexSubImage2DARB(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CompressedTexSubImage2DARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&xoffset, sizeof(xoffset));
+      trace_write(&yoffset, sizeof(yoffset));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      trace_write(&format, sizeof(format));
+      trace_write(&imageSize, sizeof(imageSize));
+      trace_array(data, compressed_bytes(ctx, imageSize, data));
+      CALL_CompressedTexSubImage2DARB(ctx->CurrentDispatch, (target, level, xoffset, yoffset, width, height, format, imageSize, data));
+      trace_unlock();
+   }
+   else {
+      CALL_CompressedTexSubImage2DARB(ctx->CurrentDispatch, (target, level, xoffset, yoffset, width, height, format, imageSize, data));
+   }
+}
+
+static void GLAPIENTRY
+trace_CompressedTexSubImage1DARB(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CompressedTexSubImage1DARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&level, sizeof(level));
+      trace_write(&xoffset, sizeof(xoffset));
+      trace_write(&width, sizeof(width));
+      trace_write(&format, sizeof(format));
+      trace_write(&imageSize, sizeof(imageSize));
+      trace_array(data, compressed_bytes(ctx, imageSize, data));
+      CALL_CompressedTexSubImage1DARB(ctx->CurrentDispatch, (target, level, xoffset, width, format, imageSize, data));
+      trace_unlock();
+   }
+   else {
+      CALL_CompressedTexSubImage1DARB(ctx->CurrentDispatch, (target, level, xoffset, width, format, imageSize, data));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetCompressedTexImageARB(GLenum target, GLint level, GLvoid * img)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetCompressedTexImageARB(ctx->CurrentDispatch, (target, level, img));
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3bEXT(GLbyte red, GLbyte green, GLbyte blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3bEXT);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_SecondaryColor3bEXT(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3bEXT(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3bvEXT(const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3bvEXT);
+      trace_array(v, 3 * sizeof(GLbyte));
+      CALL_SecondaryColor3bvEXT(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3bvEXT(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3dEXT(GLdouble red, GLdouble green, GLdouble blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3dEXT);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_SecondaryColor3dEXT(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3dEXT(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3dvEXT(const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3dvEXT);
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_SecondaryColor3dvEXT(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3dvEXT(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3fEXT(GLfloat red, GLfloat green, GLfloat blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3fEXT);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_SecondaryColor3fEXT(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3fEXT(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3fvEXT(const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3fvEXT);
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_SecondaryColor3fvEXT(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3fvEXT(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3iEXT(GLint red, GLint green, GLint blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3iEXT);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_SecondaryColor3iEXT(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3iEXT(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3ivEXT(const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3ivEXT);
+      trace_array(v, 3 * sizeof(GLint));
+      CALL_SecondaryColor3ivEXT(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3ivEXT(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3sEXT(GLshort red, GLshort green, GLshort blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3sEXT);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_SecondaryColor3sEXT(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3sEXT(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3svEXT(const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3svEXT);
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_SecondaryColor3svEXT(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3svEXT(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3ubEXT(GLubyte red, GLubyte green, GLubyte blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3ubEXT);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_SecondaryColor3ubEXT(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3ubEXT(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3ubvEXT(const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3ubvEXT);
+      trace_array(v, 3 * sizeof(GLubyte));
+      CALL_SecondaryColor3ubvEXT(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3ubvEXT(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3uiEXT(GLuint red, GLuint green, GLuint blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3uiEXT);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_SecondaryColor3uiEXT(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3uiEXT(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3uivEXT(const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3uivEXT);
+      trace_array(v, 3 * sizeof(GLuint));
+      CALL_SecondaryColor3uivEXT(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3uivEXT(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3usEXT(GLushort red, GLushort green, GLushort blue)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3usEXT);
+      trace_write(&red, sizeof(red));
+      trace_write(&green, sizeof(green));
+      trace_write(&blue, sizeof(blue));
+      CALL_SecondaryColor3usEXT(ctx->CurrentDispatch, (red, green, blue));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3usEXT(ctx->CurrentDispatch, (red, green, blue));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColor3usvEXT(const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SecondaryColor3usvEXT);
+      trace_array(v, 3 * sizeof(GLushort));
+      CALL_SecondaryColor3usvEXT(ctx->CurrentDispatch, (v));
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColor3usvEXT(ctx->CurrentDispatch, (v));
+   }
+}
+
+static void GLAPIENTRY
+trace_SecondaryColorPointerEXT(GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_SecondaryColorPointerEXT(ctx->CurrentDispatch, (size, type, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_SecondaryColorPointerEXT(ctx->CurrentDispatch, (size, type, stride, pointer));
+   }
+}
+
+static GLboolean GLAPIENTRY
+trace_AreProgramsResidentNV(GLsizei n, const GLuint * ids, GLboolean * residences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_AreProgramsResidentNV(ctx->CurrentDispatch, (n, ids, residences));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_BindProgramNV(GLenum target, GLuint program)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BindProgramNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&program, sizeof(program));
+      CALL_BindProgramNV(ctx->CurrentDispatch, (target, program));
+      trace_unlock();
+   }
+   else {
+      CALL_BindProgramNV(ctx->CurrentDispatch, (target, program));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteProgramsNV(GLsizei n, const GLuint * programs)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteProgramsNV);
+      trace_write(&n, sizeof(n));
+      trace_array(programs, count_bytes(n, sizeof(GLuint)));
+      CALL_DeleteProgramsNV(ctx->CurrentDispatch, (n, programs));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteProgramsNV(ctx->CurrentDispatch, (n, programs));
+   }
+}
+
+static void GLAPIENTRY
+trace_ExecuteProgramNV(GLenum target, GLuint id, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ExecuteProgramNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&id, sizeof(id));
+      trace_array(params, 4 * sizeof(GLfloat));
+      CALL_ExecuteProgramNV(ctx->CurrentDispatch, (target, id, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ExecuteProgramNV(ctx->CurrentDispatch, (target, id, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_GenProgramsNV(GLsizei n, GLuint * programs)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenProgramsNV);
+      trace_write(&n, sizeof(n));
+      trace_output(programs, count_bytes(n, sizeof(GLuint)));
+      CALL_GenProgramsNV(ctx->CurrentDispatch, (n, programs));
+      trace_unlock();
+   }
+   else {
+      CALL_GenProgramsNV(ctx->CurrentDispatch, (n, programs));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetProgramParameterdvNV(GLenum target, GLuint index, GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramParameterdvNV(ctx->CurrentDispatch, (target, index, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetProgramParameterfvNV(GLenum target, GLuint index, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramParameterfvNV(ctx->CurrentDispatch, (target, index, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetProgramivNV(GLuint id, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramivNV(ctx->CurrentDispatch, (id, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetProgramStringNV(GLuint id, GLenum pname, GLubyte * program)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramStringNV(ctx->CurrentDispatch, (id, pname, program));
+}
+
+static void GLAPIENTRY
+trace_GetTrackMatrixivNV(GLenum target, GLuint address, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetTrackMatrixivNV(ctx->CurrentDispatch, (target, address, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetVertexAttribdvARB(GLuint index, GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetVertexAttribdvARB(ctx->CurrentDispatch, (index, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetVertexAttribfvARB(GLuint index, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetVertexAttribfvARB(ctx->CurrentDispatch, (index, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetVertexAttribivARB(GLuint index, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetVertexAttribivARB(ctx->CurrentDispatch, (index, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetVertexAttribPointervNV(GLuint index, GLenum pname, GLvoid ** params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetVertexAttribPointervNV(ctx->CurrentDispatch, (index, pname, params));
+}
+
+static GLboolean GLAPIENTRY
+trace_IsProgramNV(GLuint program)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsProgramNV(ctx->CurrentDispatch, (program));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_LoadProgramNV(GLenum target, GLuint id, GLsizei len, const GLubyte * program)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LoadProgramNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&id, sizeof(id));
+      trace_write(&len, sizeof(len));
+      trace_array(program, count_bytes(len, 1));
+      CALL_LoadProgramNV(ctx->CurrentDispatch, (target, id, len, program));
+      trace_unlock();
+   }
+   else {
+      CALL_LoadProgramNV(ctx->CurrentDispatch, (target, id, len, program));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramParameter4dNV(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramParameter4dNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_ProgramParameter4dNV(ctx->CurrentDispatch, (target, index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramParameter4dNV(ctx->CurrentDispatch, (target, index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramParameter4dvNV(GLenum target, GLuint index, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramParameter4dvNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_array(params, 4 * sizeof(GLdouble));
+      CALL_ProgramParameter4dvNV(ctx->CurrentDispatch, (target, index, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramParameter4dvNV(ctx->CurrentDispatch, (target, index, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramParameter4fNV(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramParameter4fNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_ProgramParameter4fNV(ctx->CurrentDispatch, (target, index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramParameter4fNV(ctx->CurrentDispatch, (target, index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramParameter4fvNV(GLenum target, GLuint index, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramParameter4fvNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_array(params, 4 * sizeof(GLfloat));
+      CALL_ProgramParameter4fvNV(ctx->CurrentDispatch, (target, index, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramParameter4fvNV(ctx->CurrentDispatch, (target, index, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramParameters4dvNV(GLenum target, GLuint index, GLuint num, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramParameters4dvNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_write(&num, sizeof(num));
+      trace_array(params, count_bytes(4 * num, sizeof(GLdouble)));
+      CALL_ProgramParameters4dvNV(ctx->CurrentDispatch, (target, index, num, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramParameters4dvNV(ctx->CurrentDispatch, (target, index, num, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramParameters4fvNV(GLenum target, GLuint index, GLuint num, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramParameters4fvNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_write(&num, sizeof(num));
+      trace_array(params, count_bytes(4 * num, sizeof(GLfloat)));
+      CALL_ProgramParameters4fvNV(ctx->CurrentDispatch, (target, index, num, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramParameters4fvNV(ctx->CurrentDispatch, (target, index, num, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_RequestResidentProgramsNV(GLsizei n, const GLuint * ids)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RequestResidentProgramsNV);
+      trace_write(&n, sizeof(n));
+      trace_array(ids, count_bytes(n, sizeof(GLuint)));
+      CALL_RequestResidentProgramsNV(ctx->CurrentDispatch, (n, ids));
+      trace_unlock();
+   }
+   else {
+      CALL_RequestResidentProgramsNV(ctx->CurrentDispatch, (n, ids));
+   }
+}
+
+static void GLAPIENTRY
+trace_TrackMatrixNV(GLenum target, GLuint address, GLenum matrix, GLenum transform)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_TrackMatrixNV);
+      trace_write(&target, sizeof(target));
+      trace_write(&address, sizeof(address));
+      trace_write(&matrix, sizeof(matrix));
+      trace_write(&transform, sizeof(transform));
+      CALL_TrackMatrixNV(ctx->CurrentDispatch, (target, address, matrix, transform));
+      trace_unlock();
+   }
+   else {
+      CALL_TrackMatrixNV(ctx->CurrentDispatch, (target, address, matrix, transform));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribPointerNV(GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_VertexAttribPointerNV(ctx->CurrentDispatch, (index, size, type, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribPointerNV(ctx->CurrentDispatch, (index, size, type, stride, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1dARB(GLuint index, GLdouble x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1dARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      CALL_VertexAttrib1dARB(ctx->CurrentDispatch, (index, x));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1dARB(ctx->CurrentDispatch, (index, x));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1dvARB(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1dvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 1 * sizeof(GLdouble));
+      CALL_VertexAttrib1dvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1dvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1fARB(GLuint index, GLfloat x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1fARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      CALL_VertexAttrib1fARB(ctx->CurrentDispatch, (index, x));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1fARB(ctx->CurrentDispatch, (index, x));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1fvARB(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1fvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 1 * sizeof(GLfloat));
+      CALL_VertexAttrib1fvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1fvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1sARB(GLuint index, GLshort x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1sARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      CALL_VertexAttrib1sARB(ctx->CurrentDispatch, (index, x));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1sARB(ctx->CurrentDispatch, (index, x));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1svARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1svARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 1 * sizeof(GLshort));
+      CALL_VertexAttrib1svARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1svARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2dARB(GLuint index, GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2dARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_VertexAttrib2dARB(ctx->CurrentDispatch, (index, x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2dARB(ctx->CurrentDispatch, (index, x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2dvARB(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2dvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 2 * sizeof(GLdouble));
+      CALL_VertexAttrib2dvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2dvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2fARB(GLuint index, GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2fARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_VertexAttrib2fARB(ctx->CurrentDispatch, (index, x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2fARB(ctx->CurrentDispatch, (index, x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2fvARB(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2fvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 2 * sizeof(GLfloat));
+      CALL_VertexAttrib2fvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2fvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2sARB(GLuint index, GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2sARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_VertexAttrib2sARB(ctx->CurrentDispatch, (index, x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2sARB(ctx->CurrentDispatch, (index, x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2svARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2svARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 2 * sizeof(GLshort));
+      CALL_VertexAttrib2svARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2svARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3dARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_VertexAttrib3dARB(ctx->CurrentDispatch, (index, x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3dARB(ctx->CurrentDispatch, (index, x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3dvARB(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3dvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_VertexAttrib3dvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3dvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3fARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_VertexAttrib3fARB(ctx->CurrentDispatch, (index, x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3fARB(ctx->CurrentDispatch, (index, x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3fvARB(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3fvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_VertexAttrib3fvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3fvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3sARB(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3sARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_VertexAttrib3sARB(ctx->CurrentDispatch, (index, x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3sARB(ctx->CurrentDispatch, (index, x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3svARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3svARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_VertexAttrib3svARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3svARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4dARB(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4dARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_VertexAttrib4dARB(ctx->CurrentDispatch, (index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4dARB(ctx->CurrentDispatch, (index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4dvARB(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4dvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLdouble));
+      CALL_VertexAttrib4dvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4dvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4fARB(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4fARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_VertexAttrib4fARB(ctx->CurrentDispatch, (index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4fARB(ctx->CurrentDispatch, (index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4fvARB(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4fvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLfloat));
+      CALL_VertexAttrib4fvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4fvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4sARB(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4sARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_VertexAttrib4sARB(ctx->CurrentDispatch, (index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4sARB(ctx->CurrentDispatch, (index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4svARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4svARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLshort));
+      CALL_VertexAttrib4svARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4svARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4NubARB(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4NubARB);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_VertexAttrib4NubARB(ctx->CurrentDispatch, (index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4NubARB(ctx->CurrentDispatch, (index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4NubvARB(GLuint index, const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4NubvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLubyte));
+      CALL_VertexAttrib4NubvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4NubvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs1dvNV(GLuint index, GLsizei n, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs1dvNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(1 * n, sizeof(GLdouble)));
+      CALL_VertexAttribs1dvNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs1dvNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs1fvNV(GLuint index, GLsizei n, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs1fvNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(1 * n, sizeof(GLfloat)));
+      CALL_VertexAttribs1fvNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs1fvNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs1svNV(GLuint index, GLsizei n, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs1svNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(1 * n, sizeof(GLshort)));
+      CALL_VertexAttribs1svNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs1svNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs2dvNV(GLuint index, GLsizei n, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs2dvNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(2 * n, sizeof(GLdouble)));
+      CALL_VertexAttribs2dvNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs2dvNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs2fvNV(GLuint index, GLsizei n, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs2fvNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(2 * n, sizeof(GLfloat)));
+      CALL_VertexAttribs2fvNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs2fvNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs2svNV(GLuint index, GLsizei n, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs2svNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(2 * n, sizeof(GLshort)));
+      CALL_VertexAttribs2svNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs2svNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs3dvNV(GLuint index, GLsizei n, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs3dvNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(3 * n, sizeof(GLdouble)));
+      CALL_VertexAttribs3dvNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs3dvNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs3fvNV(GLuint index, GLsizei n, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs3fvNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(3 * n, sizeof(GLfloat)));
+      CALL_VertexAttribs3fvNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs3fvNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs3svNV(GLuint index, GLsizei n, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs3svNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(3 * n, sizeof(GLshort)));
+      CALL_VertexAttribs3svNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs3svNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs4dvNV(GLuint index, GLsizei n, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs4dvNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(4 * n, sizeof(GLdouble)));
+      CALL_VertexAttribs4dvNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs4dvNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs4fvNV(GLuint index, GLsizei n, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs4fvNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(4 * n, sizeof(GLfloat)));
+      CALL_VertexAttribs4fvNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs4fvNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs4svNV(GLuint index, GLsizei n, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs4svNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(4 * n, sizeof(GLshort)));
+      CALL_VertexAttribs4svNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs4svNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribs4ubvNV(GLuint index, GLsizei n, const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttribs4ubvNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&n, sizeof(n));
+      trace_array(v, count_bytes(4 * n, sizeof(GLubyte)));
+      CALL_VertexAttribs4ubvNV(ctx->CurrentDispatch, (index, n, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribs4ubvNV(ctx->CurrentDispatch, (index, n, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_PointParameteriNV(GLenum pname, GLint param)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PointParameteriNV);
+      trace_write(&pname, sizeof(pname));
+      trace_write(&param, sizeof(param));
+      CALL_PointParameteriNV(ctx->CurrentDispatch, (pname, param));
+      trace_unlock();
+   }
+   else {
+      CALL_PointParameteriNV(ctx->CurrentDispatch, (pname, param));
+   }
+}
+
+static void GLAPIENTRY
+trace_PointParameterivNV(GLenum pname, const GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PointParameterivNV);
+      trace_write(&pname, sizeof(pname));
+      trace_array(params, point_parameter_count(pname) * sizeof(GLint));
+      CALL_PointParameterivNV(ctx->CurrentDispatch, (pname, params));
+      trace_unlock();
+   }
+   else {
+      CALL_PointParameterivNV(ctx->CurrentDispatch, (pname, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiDrawArraysEXT(GLenum mode, GLint * first, GLsizei * count, GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_multi_arrays(ctx, first, count, primcount);
+      trace_record(TRACE_CALL_MultiDrawArraysEXT);
+      trace_write(&mode, sizeof(mode));
+      trace_array(first, count_bytes(primcount, sizeof(GLint)));
+      trace_array(count, count_bytes(primcount, sizeof(GLsizei)));
+      trace_write(&primcount, sizeof(primcount));
+      CALL_MultiDrawArraysEXT(ctx->CurrentDispatch, (mode, first, count, primcount));
+      trace_unlock();
+   }
+   else {
+      CALL_MultiDrawArraysEXT(ctx->CurrentDispatch, (mode, first, count, primcount));
+   }
+}
+
+static void GLAPIENTRY
+trace_MultiDrawElementsEXT(GLenum mode, const GLsizei * count, GLenum type, const GLvoid ** indices, GLsizei primcount)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_MultiDrawElementsEXT);
+   CALL_MultiDrawElementsEXT(ctx->CurrentDispatch, (mode, count, type, indices, primcount));
+}
+
+static void GLAPIENTRY
+trace_ActiveStencilFaceEXT(GLenum face)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ActiveStencilFaceEXT);
+      trace_write(&face, sizeof(face));
+      CALL_ActiveStencilFaceEXT(ctx->CurrentDispatch, (face));
+      trace_unlock();
+   }
+   else {
+      CALL_ActiveStencilFaceEXT(ctx->CurrentDispatch, (face));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteFencesNV(GLsizei n, const GLuint * fences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteFencesNV);
+      trace_write(&n, sizeof(n));
+      trace_array(fences, count_bytes(n, sizeof(GLuint)));
+      CALL_DeleteFencesNV(ctx->CurrentDispatch, (n, fences));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteFencesNV(ctx->CurrentDispatch, (n, fences));
+   }
+}
+
+static void GLAPIENTRY
+trace_GenFencesNV(GLsizei n, GLuint * fences)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenFencesNV);
+      trace_write(&n, sizeof(n));
+      trace_output(fences, count_bytes(n, sizeof(GLuint)));
+      CALL_GenFencesNV(ctx->CurrentDispatch, (n, fences));
+      trace_unlock();
+   }
+   else {
+      CALL_GenFencesNV(ctx->CurrentDispatch, (n, fences));
+   }
+}
+
+static GLboolean GLAPIENTRY
+trace_IsFenceNV(GLuint fence)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsFenceNV(ctx->CurrentDispatch, (fence));
+   return ret;
+}
+
+static GLboolean GLAPIENTRY
+trace_TestFenceNV(GLuint fence)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_TestFenceNV(ctx->CurrentDispatch, (fence));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_GetFenceivNV(GLuint fence, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetFenceivNV(ctx->CurrentDispatch, (fence, pname, params));
+}
+
+static void GLAPIENTRY
+trace_FinishFenceNV(GLuint fence)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FinishFenceNV);
+      trace_write(&fence, sizeof(fence));
+      CALL_FinishFenceNV(ctx->CurrentDispatch, (fence));
+      trace_unlock();
+   }
+   else {
+      CALL_FinishFenceNV(ctx->CurrentDispatch, (fence));
+   }
+}
+
+static void GLAPIENTRY
+trace_SetFenceNV(GLuint fence, GLenum condition)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SetFenceNV);
+      trace_write(&fence, sizeof(fence));
+      trace_write(&condition, sizeof(condition));
+      CALL_SetFenceNV(ctx->CurrentDispatch, (fence, condition));
+      trace_unlock();
+   }
+   else {
+      CALL_SetFenceNV(ctx->CurrentDispatch, (fence, condition));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4bvARB(GLuint index, const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4bvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLbyte));
+      CALL_VertexAttrib4bvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4bvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4ivARB(GLuint index, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4ivARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLint));
+      CALL_VertexAttrib4ivARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4ivARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4ubvARB(GLuint index, const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4ubvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLubyte));
+      CALL_VertexAttrib4ubvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4ubvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4usvARB(GLuint index, const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4usvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLushort));
+      CALL_VertexAttrib4usvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4usvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4uivARB(GLuint index, const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4uivARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLuint));
+      CALL_VertexAttrib4uivARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4uivARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4NbvARB(GLuint index, const GLbyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4NbvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLbyte));
+      CALL_VertexAttrib4NbvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4NbvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4NsvARB(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4NsvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLshort));
+      CALL_VertexAttrib4NsvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4NsvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4NivARB(GLuint index, const GLint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4NivARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLint));
+      CALL_VertexAttrib4NivARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4NivARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4NusvARB(GLuint index, const GLushort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4NusvARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLushort));
+      CALL_VertexAttrib4NusvARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4NusvARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4NuivARB(GLuint index, const GLuint * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4NuivARB);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLuint));
+      CALL_VertexAttrib4NuivARB(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4NuivARB(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttribPointerARB(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid * pointer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      struct trace_array_state before;
+      trace_save_arrays(ctx, &before);
+      CALL_VertexAttribPointerARB(ctx->CurrentDispatch, (index, size, type, normalized, stride, pointer));
+      trace_arrays_changed(ctx, &before);
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttribPointerARB(ctx->CurrentDispatch, (index, size, type, normalized, stride, pointer));
+   }
+}
+
+static void GLAPIENTRY
+trace_EnableVertexAttribArrayARB(GLuint index)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EnableVertexAttribArrayARB);
+      trace_write(&index, sizeof(index));
+      CALL_EnableVertexAttribArrayARB(ctx->CurrentDispatch, (index));
+      trace_unlock();
+   }
+   else {
+      CALL_EnableVertexAttribArrayARB(ctx->CurrentDispatch, (index));
+   }
+}
+
+static void GLAPIENTRY
+trace_DisableVertexAttribArrayARB(GLuint index)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DisableVertexAttribArrayARB);
+      trace_write(&index, sizeof(index));
+      CALL_DisableVertexAttribArrayARB(ctx->CurrentDispatch, (index));
+      trace_unlock();
+   }
+   else {
+      CALL_DisableVertexAttribArrayARB(ctx->CurrentDispatch, (index));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramStringARB(GLenum target, GLenum format, GLsizei len, const GLvoid * string)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramStringARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&format, sizeof(format));
+      trace_write(&len, sizeof(len));
+      trace_array(string, count_bytes(len, 1));
+      CALL_ProgramStringARB(ctx->CurrentDispatch, (target, format, len, string));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramStringARB(ctx->CurrentDispatch, (target, format, len, string));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramEnvParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramEnvParameter4dARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_ProgramEnvParameter4dARB(ctx->CurrentDispatch, (target, index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramEnvParameter4dARB(ctx->CurrentDispatch, (target, index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramEnvParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramEnvParameter4dvARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_array(params, 4 * sizeof(GLdouble));
+      CALL_ProgramEnvParameter4dvARB(ctx->CurrentDispatch, (target, index, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramEnvParameter4dvARB(ctx->CurrentDispatch, (target, index, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramEnvParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramEnvParameter4fARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_ProgramEnvParameter4fARB(ctx->CurrentDispatch, (target, index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramEnvParameter4fARB(ctx->CurrentDispatch, (target, index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramEnvParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramEnvParameter4fvARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_array(params, 4 * sizeof(GLfloat));
+      CALL_ProgramEnvParameter4fvARB(ctx->CurrentDispatch, (target, index, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramEnvParameter4fvARB(ctx->CurrentDispatch, (target, index, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramLocalParameter4dARB(GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramLocalParameter4dARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_ProgramLocalParameter4dARB(ctx->CurrentDispatch, (target, index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramLocalParameter4dARB(ctx->CurrentDispatch, (target, index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramLocalParameter4dvARB(GLenum target, GLuint index, const GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramLocalParameter4dvARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_array(params, 4 * sizeof(GLdouble));
+      CALL_ProgramLocalParameter4dvARB(ctx->CurrentDispatch, (target, index, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramLocalParameter4dvARB(ctx->CurrentDispatch, (target, index, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramLocalParameter4fARB(GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramLocalParameter4fARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_ProgramLocalParameter4fARB(ctx->CurrentDispatch, (target, index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramLocalParameter4fARB(ctx->CurrentDispatch, (target, index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramLocalParameter4fvARB(GLenum target, GLuint index, const GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramLocalParameter4fvARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&index, sizeof(index));
+      trace_array(params, 4 * sizeof(GLfloat));
+      CALL_ProgramLocalParameter4fvARB(ctx->CurrentDispatch, (target, index, params));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramLocalParameter4fvARB(ctx->CurrentDispatch, (target, index, params));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetProgramEnvParameterdvARB(GLenum target, GLuint index, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramEnvParameterdvARB(ctx->CurrentDispatch, (target, index, params));
+}
+
+static void GLAPIENTRY
+trace_GetProgramEnvParameterfvARB(GLenum target, GLuint index, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramEnvParameterfvARB(ctx->CurrentDispatch, (target, index, params));
+}
+
+static void GLAPIENTRY
+trace_GetProgramLocalParameterdvARB(GLenum target, GLuint index, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramLocalParameterdvARB(ctx->CurrentDispatch, (target, index, params));
+}
+
+static void GLAPIENTRY
+trace_GetProgramLocalParameterfvARB(GLenum target, GLuint index, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramLocalParameterfvARB(ctx->CurrentDispatch, (target, index, params));
+}
+
+static void GLAPIENTRY
+trace_GetProgramivARB(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramivARB(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetProgramStringARB(GLenum target, GLenum pname, GLvoid * string)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramStringARB(ctx->CurrentDispatch, (target, pname, string));
+}
+
+static void GLAPIENTRY
+trace_ProgramNamedParameter4fNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramNamedParameter4fNV);
+      trace_write(&id, sizeof(id));
+      trace_write(&len, sizeof(len));
+      trace_array(name, count_bytes(len, 1));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_ProgramNamedParameter4fNV(ctx->CurrentDispatch, (id, len, name, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramNamedParameter4fNV(ctx->CurrentDispatch, (id, len, name, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramNamedParameter4dNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramNamedParameter4dNV);
+      trace_write(&id, sizeof(id));
+      trace_write(&len, sizeof(len));
+      trace_array(name, count_bytes(len, 1));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_ProgramNamedParameter4dNV(ctx->CurrentDispatch, (id, len, name, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramNamedParameter4dNV(ctx->CurrentDispatch, (id, len, name, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramNamedParameter4fvNV(GLuint id, GLsizei len, const GLubyte * name, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramNamedParameter4fvNV);
+      trace_write(&id, sizeof(id));
+      trace_write(&len, sizeof(len));
+      trace_array(name, count_bytes(len, 1));
+      trace_array(v, 4 * sizeof(GLfloat));
+      CALL_ProgramNamedParameter4fvNV(ctx->CurrentDispatch, (id, len, name, v));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramNamedParameter4fvNV(ctx->CurrentDispatch, (id, len, name, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_ProgramNamedParameter4dvNV(GLuint id, GLsizei len, const GLubyte * name, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ProgramNamedParameter4dvNV);
+      trace_write(&id, sizeof(id));
+      trace_write(&len, sizeof(len));
+      trace_array(name, count_bytes(len, 1));
+      trace_array(v, 4 * sizeof(GLdouble));
+      CALL_ProgramNamedParameter4dvNV(ctx->CurrentDispatch, (id, len, name, v));
+      trace_unlock();
+   }
+   else {
+      CALL_ProgramNamedParameter4dvNV(ctx->CurrentDispatch, (id, len, name, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetProgramNamedParameterfvNV(GLuint id, GLsizei len, const GLubyte * name, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramNamedParameterfvNV(ctx->CurrentDispatch, (id, len, name, params));
+}
+
+static void GLAPIENTRY
+trace_GetProgramNamedParameterdvNV(GLuint id, GLsizei len, const GLubyte * name, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetProgramNamedParameterdvNV(ctx->CurrentDispatch, (id, len, name, params));
+}
+
+static void GLAPIENTRY
+trace_BindBufferARB(GLenum target, GLuint buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BindBufferARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&buffer, sizeof(buffer));
+      CALL_BindBufferARB(ctx->CurrentDispatch, (target, buffer));
+      trace_unlock();
+   }
+   else {
+      CALL_BindBufferARB(ctx->CurrentDispatch, (target, buffer));
+   }
+}
+
+static void GLAPIENTRY
+trace_BufferDataARB(GLenum target, GLsizeiptrARB size, const GLvoid * data, GLenum usage)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BufferDataARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&size, sizeof(size));
+      trace_array(data, buffer_bytes(size, data));
+      trace_write(&usage, sizeof(usage));
+      CALL_BufferDataARB(ctx->CurrentDispatch, (target, size, data, usage));
+      trace_unlock();
+   }
+   else {
+      CALL_BufferDataARB(ctx->CurrentDispatch, (target, size, data, usage));
+   }
+}
+
+static void GLAPIENTRY
+trace_BufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, const GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BufferSubDataARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&offset, sizeof(offset));
+      trace_write(&size, sizeof(size));
+      trace_array(data, buffer_bytes(size, data));
+      CALL_BufferSubDataARB(ctx->CurrentDispatch, (target, offset, size, data));
+      trace_unlock();
+   }
+   else {
+      CALL_BufferSubDataARB(ctx->CurrentDispatch, (target, offset, size, data));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteBuffersARB(GLsizei n, const GLuint * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteBuffersARB);
+      trace_write(&n, sizeof(n));
+      trace_array(buffer, count_bytes(n, sizeof(GLuint)));
+      CALL_DeleteBuffersARB(ctx->CurrentDispatch, (n, buffer));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteBuffersARB(ctx->CurrentDispatch, (n, buffer));
+   }
+}
+
+static void GLAPIENTRY
+trace_GenBuffersARB(GLsizei n, GLuint * buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenBuffersARB);
+      trace_write(&n, sizeof(n));
+      trace_output(buffer, count_bytes(n, sizeof(GLuint)));
+      CALL_GenBuffersARB(ctx->CurrentDispatch, (n, buffer));
+      trace_unlock();
+   }
+   else {
+      CALL_GenBuffersARB(ctx->CurrentDispatch, (n, buffer));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetBufferParameterivARB(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetBufferParameterivARB(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetBufferPointervARB(GLenum target, GLenum pname, GLvoid ** params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetBufferPointervARB(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetBufferSubDataARB(GLenum target, GLintptrARB offset, GLsizeiptrARB size, GLvoid * data)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetBufferSubDataARB(ctx->CurrentDispatch, (target, offset, size, data));
+}
+
+static GLboolean GLAPIENTRY
+trace_IsBufferARB(GLuint buffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsBufferARB(ctx->CurrentDispatch, (buffer));
+   return ret;
+}
+
+static GLvoid * GLAPIENTRY
+trace_MapBufferARB(GLenum target, GLenum access)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLvoid * ret;
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_MapBufferARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&access, sizeof(access));
+      ret = CALL_MapBufferARB(ctx->CurrentDispatch, (target, access));
+      trace_unlock();
+   }
+   else {
+      ret = CALL_MapBufferARB(ctx->CurrentDispatch, (target, access));
+   }
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_DepthBoundsEXT(GLclampd zmin, GLclampd zmax)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DepthBoundsEXT);
+      trace_write(&zmin, sizeof(zmin));
+      trace_write(&zmax, sizeof(zmax));
+      CALL_DepthBoundsEXT(ctx->CurrentDispatch, (zmin, zmax));
+      trace_unlock();
+   }
+   else {
+      CALL_DepthBoundsEXT(ctx->CurrentDispatch, (zmin, zmax));
+   }
+}
+
+static void GLAPIENTRY
+trace_GenQueriesARB(GLsizei n, GLuint * ids)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenQueriesARB);
+      trace_write(&n, sizeof(n));
+      trace_output(ids, count_bytes(n, sizeof(GLuint)));
+      CALL_GenQueriesARB(ctx->CurrentDispatch, (n, ids));
+      trace_unlock();
+   }
+   else {
+      CALL_GenQueriesARB(ctx->CurrentDispatch, (n, ids));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteQueriesARB(GLsizei n, const GLuint * ids)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteQueriesARB);
+      trace_write(&n, sizeof(n));
+      trace_array(ids, count_bytes(n, sizeof(GLuint)));
+      CALL_DeleteQueriesARB(ctx->CurrentDispatch, (n, ids));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteQueriesARB(ctx->CurrentDispatch, (n, ids));
+   }
+}
+
+static GLboolean GLAPIENTRY
+trace_IsQueryARB(GLuint id)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsQueryARB(ctx->CurrentDispatch, (id));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_BeginQueryARB(GLenum target, GLuint id)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BeginQueryARB);
+      trace_write(&target, sizeof(target));
+      trace_write(&id, sizeof(id));
+      CALL_BeginQueryARB(ctx->CurrentDispatch, (target, id));
+      trace_unlock();
+   }
+   else {
+      CALL_BeginQueryARB(ctx->CurrentDispatch, (target, id));
+   }
+}
+
+static void GLAPIENTRY
+trace_EndQueryARB(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EndQueryARB);
+      trace_write(&target, sizeof(target));
+      CALL_EndQueryARB(ctx->CurrentDispatch, (target));
+      trace_unlock();
+   }
+   else {
+      CALL_EndQueryARB(ctx->CurrentDispatch, (target));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetQueryivARB(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetQueryivARB(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetQueryObjectivARB(GLuint id, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetQueryObjectivARB(ctx->CurrentDispatch, (id, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetQueryObjectuivARB(GLuint id, GLenum pname, GLuint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetQueryObjectuivARB(ctx->CurrentDispatch, (id, pname, params));
+}
+
+static void GLAPIENTRY
+trace_MultiModeDrawArraysIBM(const GLenum * mode, const GLint * first, const GLsizei * count, GLsizei primcount, GLint modestride)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_MultiModeDrawArraysIBM);
+   CALL_MultiModeDrawArraysIBM(ctx->CurrentDispatch, (mode, first, count, primcount, modestride));
+}
+
+static void GLAPIENTRY
+trace_MultiModeDrawElementsIBM(const GLenum * mode, const GLsizei * count, GLenum type, const GLvoid * const * indices, GLsizei primcount, GLint modestride)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   trace_unsupported(ctx, TRACE_CALL_MultiModeDrawElementsIBM);
+   CALL_MultiModeDrawElementsIBM(ctx->CurrentDispatch, (mode, count, type, indices, primcount, modestride));
+}
+
+static void GLAPIENTRY
+trace_BlendEquationSeparateEXT(GLenum modeRGB, GLenum modeA)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BlendEquationSeparateEXT);
+      trace_write(&modeRGB, sizeof(modeRGB));
+      trace_write(&modeA, sizeof(modeA));
+      CALL_BlendEquationSeparateEXT(ctx->CurrentDispatch, (modeRGB, modeA));
+      trace_unlock();
+   }
+   else {
+      CALL_BlendEquationSeparateEXT(ctx->CurrentDispatch, (modeRGB, modeA));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteObjectARB(GLhandleARB obj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteObjectARB);
+      trace_write(&obj, sizeof(obj));
+      CALL_DeleteObjectARB(ctx->CurrentDispatch, (obj));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteObjectARB(ctx->CurrentDispatch, (obj));
+   }
+}
+
+static GLhandleARB GLAPIENTRY
+trace_GetHandleARB(GLenum pname)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLhandleARB ret;
+   ret = CALL_GetHandleARB(ctx->CurrentDispatch, (pname));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_DetachObjectARB(GLhandleARB containerObj, GLhandleARB attachedObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DetachObjectARB);
+      trace_write(&containerObj, sizeof(containerObj));
+      trace_write(&attachedObj, sizeof(attachedObj));
+      CALL_DetachObjectARB(ctx->CurrentDispatch, (containerObj, attachedObj));
+      trace_unlock();
+   }
+   else {
+      CALL_DetachObjectARB(ctx->CurrentDispatch, (containerObj, attachedObj));
+   }
+}
+
+static GLhandleARB GLAPIENTRY
+trace_CreateShaderObjectARB(GLenum shaderType)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLhandleARB ret;
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CreateShaderObjectARB);
+      trace_write(&shaderType, sizeof(shaderType));
+      ret = CALL_CreateShaderObjectARB(ctx->CurrentDispatch, (shaderType));
+      trace_unlock();
+   }
+   else {
+      ret = CALL_CreateShaderObjectARB(ctx->CurrentDispatch, (shaderType));
+   }
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_CompileShaderARB(GLhandleARB shaderObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CompileShaderARB);
+      trace_write(&shaderObj, sizeof(shaderObj));
+      CALL_CompileShaderARB(ctx->CurrentDispatch, (shaderObj));
+      trace_unlock();
+   }
+   else {
+      CALL_CompileShaderARB(ctx->CurrentDispatch, (shaderObj));
+   }
+}
+
+static GLhandleARB GLAPIENTRY
+trace_CreateProgramObjectARB(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLhandleARB ret;
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_CreateProgramObjectARB);
+      ret = CALL_CreateProgramObjectARB(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      ret = CALL_CreateProgramObjectARB(ctx->CurrentDispatch, ());
+   }
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_AttachObjectARB(GLhandleARB containerObj, GLhandleARB obj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_AttachObjectARB);
+      trace_write(&containerObj, sizeof(containerObj));
+      trace_write(&obj, sizeof(obj));
+      CALL_AttachObjectARB(ctx->CurrentDispatch, (containerObj, obj));
+      trace_unlock();
+   }
+   else {
+      CALL_AttachObjectARB(ctx->CurrentDispatch, (containerObj, obj));
+   }
+}
+
+static void GLAPIENTRY
+trace_LinkProgramARB(GLhandleARB programObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_LinkProgramARB);
+      trace_write(&programObj, sizeof(programObj));
+      CALL_LinkProgramARB(ctx->CurrentDispatch, (programObj));
+      trace_unlock();
+   }
+   else {
+      CALL_LinkProgramARB(ctx->CurrentDispatch, (programObj));
+   }
+}
+
+static void GLAPIENTRY
+trace_UseProgramObjectARB(GLhandleARB programObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_UseProgramObjectARB);
+      trace_write(&programObj, sizeof(programObj));
+      CALL_UseProgramObjectARB(ctx->CurrentDispatch, (programObj));
+      trace_unlock();
+   }
+   else {
+      CALL_UseProgramObjectARB(ctx->CurrentDispatch, (programObj));
+   }
+}
+
+static void GLAPIENTRY
+trace_ValidateProgramARB(GLhandleARB programObj)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ValidateProgramARB);
+      trace_write(&programObj, sizeof(programObj));
+      CALL_ValidateProgramARB(ctx->CurrentDispatch, (programObj));
+      trace_unlock();
+   }
+   else {
+      CALL_ValidateProgramARB(ctx->CurrentDispatch, (programObj));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform1fARB(GLint location, GLfloat v0)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform1fARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&v0, sizeof(v0));
+      CALL_Uniform1fARB(ctx->CurrentDispatch, (location, v0));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform1fARB(ctx->CurrentDispatch, (location, v0));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform2fARB(GLint location, GLfloat v0, GLfloat v1)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform2fARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&v0, sizeof(v0));
+      trace_write(&v1, sizeof(v1));
+      CALL_Uniform2fARB(ctx->CurrentDispatch, (location, v0, v1));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform2fARB(ctx->CurrentDispatch, (location, v0, v1));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform3fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform3fARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&v0, sizeof(v0));
+      trace_write(&v1, sizeof(v1));
+      trace_write(&v2, sizeof(v2));
+      CALL_Uniform3fARB(ctx->CurrentDispatch, (location, v0, v1, v2));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform3fARB(ctx->CurrentDispatch, (location, v0, v1, v2));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform4fARB(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform4fARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&v0, sizeof(v0));
+      trace_write(&v1, sizeof(v1));
+      trace_write(&v2, sizeof(v2));
+      trace_write(&v3, sizeof(v3));
+      CALL_Uniform4fARB(ctx->CurrentDispatch, (location, v0, v1, v2, v3));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform4fARB(ctx->CurrentDispatch, (location, v0, v1, v2, v3));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform1iARB(GLint location, GLint v0)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform1iARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&v0, sizeof(v0));
+      CALL_Uniform1iARB(ctx->CurrentDispatch, (location, v0));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform1iARB(ctx->CurrentDispatch, (location, v0));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform2iARB(GLint location, GLint v0, GLint v1)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform2iARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&v0, sizeof(v0));
+      trace_write(&v1, sizeof(v1));
+      CALL_Uniform2iARB(ctx->CurrentDispatch, (location, v0, v1));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform2iARB(ctx->CurrentDispatch, (location, v0, v1));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform3iARB(GLint location, GLint v0, GLint v1, GLint v2)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform3iARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&v0, sizeof(v0));
+      trace_write(&v1, sizeof(v1));
+      trace_write(&v2, sizeof(v2));
+      CALL_Uniform3iARB(ctx->CurrentDispatch, (location, v0, v1, v2));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform3iARB(ctx->CurrentDispatch, (location, v0, v1, v2));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform4iARB(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform4iARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&v0, sizeof(v0));
+      trace_write(&v1, sizeof(v1));
+      trace_write(&v2, sizeof(v2));
+      trace_write(&v3, sizeof(v3));
+      CALL_Uniform4iARB(ctx->CurrentDispatch, (location, v0, v1, v2, v3));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform4iARB(ctx->CurrentDispatch, (location, v0, v1, v2, v3));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform1fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform1fvARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_array(value, count_bytes(1 * count, sizeof(GLfloat)));
+      CALL_Uniform1fvARB(ctx->CurrentDispatch, (location, count, value));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform1fvARB(ctx->CurrentDispatch, (location, count, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform2fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform2fvARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_array(value, count_bytes(2 * count, sizeof(GLfloat)));
+      CALL_Uniform2fvARB(ctx->CurrentDispatch, (location, count, value));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform2fvARB(ctx->CurrentDispatch, (location, count, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform3fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform3fvARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_array(value, count_bytes(3 * count, sizeof(GLfloat)));
+      CALL_Uniform3fvARB(ctx->CurrentDispatch, (location, count, value));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform3fvARB(ctx->CurrentDispatch, (location, count, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform4fvARB(GLint location, GLsizei count, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform4fvARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_array(value, count_bytes(4 * count, sizeof(GLfloat)));
+      CALL_Uniform4fvARB(ctx->CurrentDispatch, (location, count, value));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform4fvARB(ctx->CurrentDispatch, (location, count, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform1ivARB(GLint location, GLsizei count, const GLint * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform1ivARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_array(value, count_bytes(1 * count, sizeof(GLint)));
+      CALL_Uniform1ivARB(ctx->CurrentDispatch, (location, count, value));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform1ivARB(ctx->CurrentDispatch, (location, count, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform2ivARB(GLint location, GLsizei count, const GLint * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform2ivARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_array(value, count_bytes(2 * count, sizeof(GLint)));
+      CALL_Uniform2ivARB(ctx->CurrentDispatch, (location, count, value));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform2ivARB(ctx->CurrentDispatch, (location, count, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform3ivARB(GLint location, GLsizei count, const GLint * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform3ivARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_array(value, count_bytes(3 * count, sizeof(GLint)));
+      CALL_Uniform3ivARB(ctx->CurrentDispatch, (location, count, value));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform3ivARB(ctx->CurrentDispatch, (location, count, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_Uniform4ivARB(GLint location, GLsizei count, const GLint * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_Uniform4ivARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_array(value, count_bytes(4 * count, sizeof(GLint)));
+      CALL_Uniform4ivARB(ctx->CurrentDispatch, (location, count, value));
+      trace_unlock();
+   }
+   else {
+      CALL_Uniform4ivARB(ctx->CurrentDispatch, (location, count, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_UniformMatrix2fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_UniformMatrix2fvARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_write(&transpose, sizeof(transpose));
+      trace_array(value, count_bytes(4 * count, sizeof(GLfloat)));
+      CALL_UniformMatrix2fvARB(ctx->CurrentDispatch, (location, count, transpose, value));
+      trace_unlock();
+   }
+   else {
+      CALL_UniformMatrix2fvARB(ctx->CurrentDispatch, (location, count, transpose, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_UniformMatrix3fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_UniformMatrix3fvARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_write(&transpose, sizeof(transpose));
+      trace_array(value, count_bytes(9 * count, sizeof(GLfloat)));
+      CALL_UniformMatrix3fvARB(ctx->CurrentDispatch, (location, count, transpose, value));
+      trace_unlock();
+   }
+   else {
+      CALL_UniformMatrix3fvARB(ctx->CurrentDispatch, (location, count, transpose, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_UniformMatrix4fvARB(GLint location, GLsizei count, GLboolean transpose, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_UniformMatrix4fvARB);
+      trace_write(&location, sizeof(location));
+      trace_write(&count, sizeof(count));
+      trace_write(&transpose, sizeof(transpose));
+      trace_array(value, count_bytes(16 * count, sizeof(GLfloat)));
+      CALL_UniformMatrix4fvARB(ctx->CurrentDispatch, (location, count, transpose, value));
+      trace_unlock();
+   }
+   else {
+      CALL_UniformMatrix4fvARB(ctx->CurrentDispatch, (location, count, transpose, value));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetObjectParameterfvARB(GLhandleARB obj, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetObjectParameterfvARB(ctx->CurrentDispatch, (obj, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetObjectParameterivARB(GLhandleARB obj, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetObjectParameterivARB(ctx->CurrentDispatch, (obj, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetInfoLogARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * infoLog)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetInfoLogARB(ctx->CurrentDispatch, (obj, maxLength, length, infoLog));
+}
+
+static void GLAPIENTRY
+trace_GetAttachedObjectsARB(GLhandleARB containerObj, GLsizei maxLength, GLsizei * length, GLhandleARB * infoLog)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetAttachedObjectsARB(ctx->CurrentDispatch, (containerObj, maxLength, length, infoLog));
+}
+
+static GLint GLAPIENTRY
+trace_GetUniformLocationARB(GLhandleARB programObj, const GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   ret = CALL_GetUniformLocationARB(ctx->CurrentDispatch, (programObj, name));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_GetActiveUniformARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetActiveUniformARB(ctx->CurrentDispatch, (programObj, index, maxLength, length, size, type, name));
+}
+
+static void GLAPIENTRY
+trace_GetUniformfvARB(GLhandleARB programObj, GLint location, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetUniformfvARB(ctx->CurrentDispatch, (programObj, location, params));
+}
+
+static void GLAPIENTRY
+trace_GetUniformivARB(GLhandleARB programObj, GLint location, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetUniformivARB(ctx->CurrentDispatch, (programObj, location, params));
+}
+
+static void GLAPIENTRY
+trace_GetShaderSourceARB(GLhandleARB obj, GLsizei maxLength, GLsizei * length, GLcharARB * source)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetShaderSourceARB(ctx->CurrentDispatch, (obj, maxLength, length, source));
+}
+
+static void GLAPIENTRY
+trace_BindAttribLocationARB(GLhandleARB programObj, GLuint index, const GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BindAttribLocationARB);
+      trace_write(&programObj, sizeof(programObj));
+      trace_write(&index, sizeof(index));
+      trace_array(name, (GLuint) _mesa_strlen((const char *) name) + 1);
+      CALL_BindAttribLocationARB(ctx->CurrentDispatch, (programObj, index, name));
+      trace_unlock();
+   }
+   else {
+      CALL_BindAttribLocationARB(ctx->CurrentDispatch, (programObj, index, name));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetActiveAttribARB(GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei * length, GLint * size, GLenum * type, GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetActiveAttribARB(ctx->CurrentDispatch, (programObj, index, maxLength, length, size, type, name));
+}
+
+static GLint GLAPIENTRY
+trace_GetAttribLocationARB(GLhandleARB programObj, const GLcharARB * name)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLint ret;
+   ret = CALL_GetAttribLocationARB(ctx->CurrentDispatch, (programObj, name));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_GetVertexAttribdvNV(GLuint index, GLenum pname, GLdouble * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetVertexAttribdvNV(ctx->CurrentDispatch, (index, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetVertexAttribfvNV(GLuint index, GLenum pname, GLfloat * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetVertexAttribfvNV(ctx->CurrentDispatch, (index, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GetVertexAttribivNV(GLuint index, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetVertexAttribivNV(ctx->CurrentDispatch, (index, pname, params));
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1dNV(GLuint index, GLdouble x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1dNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      CALL_VertexAttrib1dNV(ctx->CurrentDispatch, (index, x));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1dNV(ctx->CurrentDispatch, (index, x));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1dvNV(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1dvNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 1 * sizeof(GLdouble));
+      CALL_VertexAttrib1dvNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1dvNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1fNV(GLuint index, GLfloat x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1fNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      CALL_VertexAttrib1fNV(ctx->CurrentDispatch, (index, x));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1fNV(ctx->CurrentDispatch, (index, x));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1fvNV(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1fvNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 1 * sizeof(GLfloat));
+      CALL_VertexAttrib1fvNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1fvNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1sNV(GLuint index, GLshort x)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1sNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      CALL_VertexAttrib1sNV(ctx->CurrentDispatch, (index, x));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1sNV(ctx->CurrentDispatch, (index, x));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib1svNV(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib1svNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 1 * sizeof(GLshort));
+      CALL_VertexAttrib1svNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib1svNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2dNV(GLuint index, GLdouble x, GLdouble y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2dNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_VertexAttrib2dNV(ctx->CurrentDispatch, (index, x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2dNV(ctx->CurrentDispatch, (index, x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2dvNV(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2dvNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 2 * sizeof(GLdouble));
+      CALL_VertexAttrib2dvNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2dvNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2fNV(GLuint index, GLfloat x, GLfloat y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2fNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_VertexAttrib2fNV(ctx->CurrentDispatch, (index, x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2fNV(ctx->CurrentDispatch, (index, x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2fvNV(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2fvNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 2 * sizeof(GLfloat));
+      CALL_VertexAttrib2fvNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2fvNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2sNV(GLuint index, GLshort x, GLshort y)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2sNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      CALL_VertexAttrib2sNV(ctx->CurrentDispatch, (index, x, y));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2sNV(ctx->CurrentDispatch, (index, x, y));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib2svNV(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib2svNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 2 * sizeof(GLshort));
+      CALL_VertexAttrib2svNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib2svNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3dNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_VertexAttrib3dNV(ctx->CurrentDispatch, (index, x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3dNV(ctx->CurrentDispatch, (index, x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3dvNV(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3dvNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 3 * sizeof(GLdouble));
+      CALL_VertexAttrib3dvNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3dvNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3fNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_VertexAttrib3fNV(ctx->CurrentDispatch, (index, x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3fNV(ctx->CurrentDispatch, (index, x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3fvNV(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3fvNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 3 * sizeof(GLfloat));
+      CALL_VertexAttrib3fvNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3fvNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3sNV(GLuint index, GLshort x, GLshort y, GLshort z)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3sNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      CALL_VertexAttrib3sNV(ctx->CurrentDispatch, (index, x, y, z));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3sNV(ctx->CurrentDispatch, (index, x, y, z));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib3svNV(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib3svNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 3 * sizeof(GLshort));
+      CALL_VertexAttrib3svNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib3svNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4dNV(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4dNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_VertexAttrib4dNV(ctx->CurrentDispatch, (index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4dNV(ctx->CurrentDispatch, (index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4dvNV(GLuint index, const GLdouble * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4dvNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLdouble));
+      CALL_VertexAttrib4dvNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4dvNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4fNV(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4fNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_VertexAttrib4fNV(ctx->CurrentDispatch, (index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4fNV(ctx->CurrentDispatch, (index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4fvNV(GLuint index, const GLfloat * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4fvNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLfloat));
+      CALL_VertexAttrib4fvNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4fvNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4sNV(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4sNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_VertexAttrib4sNV(ctx->CurrentDispatch, (index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4sNV(ctx->CurrentDispatch, (index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4svNV(GLuint index, const GLshort * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4svNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLshort));
+      CALL_VertexAttrib4svNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4svNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4ubNV(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4ubNV);
+      trace_write(&index, sizeof(index));
+      trace_write(&x, sizeof(x));
+      trace_write(&y, sizeof(y));
+      trace_write(&z, sizeof(z));
+      trace_write(&w, sizeof(w));
+      CALL_VertexAttrib4ubNV(ctx->CurrentDispatch, (index, x, y, z, w));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4ubNV(ctx->CurrentDispatch, (index, x, y, z, w));
+   }
+}
+
+static void GLAPIENTRY
+trace_VertexAttrib4ubvNV(GLuint index, const GLubyte * v)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_VertexAttrib4ubvNV);
+      trace_write(&index, sizeof(index));
+      trace_array(v, 4 * sizeof(GLubyte));
+      CALL_VertexAttrib4ubvNV(ctx->CurrentDispatch, (index, v));
+      trace_unlock();
+   }
+   else {
+      CALL_VertexAttrib4ubvNV(ctx->CurrentDispatch, (index, v));
+   }
+}
+
+static GLuint GLAPIENTRY
+trace_GenFragmentShadersATI(GLuint range)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLuint ret;
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenFragmentShadersATI);
+      trace_write(&range, sizeof(range));
+      ret = CALL_GenFragmentShadersATI(ctx->CurrentDispatch, (range));
+      trace_unlock();
+   }
+   else {
+      ret = CALL_GenFragmentShadersATI(ctx->CurrentDispatch, (range));
+   }
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_BindFragmentShaderATI(GLuint id)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BindFragmentShaderATI);
+      trace_write(&id, sizeof(id));
+      CALL_BindFragmentShaderATI(ctx->CurrentDispatch, (id));
+      trace_unlock();
+   }
+   else {
+      CALL_BindFragmentShaderATI(ctx->CurrentDispatch, (id));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteFragmentShaderATI(GLuint id)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteFragmentShaderATI);
+      trace_write(&id, sizeof(id));
+      CALL_DeleteFragmentShaderATI(ctx->CurrentDispatch, (id));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteFragmentShaderATI(ctx->CurrentDispatch, (id));
+   }
+}
+
+static void GLAPIENTRY
+trace_BeginFragmentShaderATI(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BeginFragmentShaderATI);
+      CALL_BeginFragmentShaderATI(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_BeginFragmentShaderATI(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_EndFragmentShaderATI(void)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_EndFragmentShaderATI);
+      CALL_EndFragmentShaderATI(ctx->CurrentDispatch, ());
+      trace_unlock();
+   }
+   else {
+      CALL_EndFragmentShaderATI(ctx->CurrentDispatch, ());
+   }
+}
+
+static void GLAPIENTRY
+trace_PassTexCoordATI(GLuint dst, GLuint coord, GLenum swizzle)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_PassTexCoordATI);
+      trace_write(&dst, sizeof(dst));
+      trace_write(&coord, sizeof(coord));
+      trace_write(&swizzle, sizeof(swizzle));
+      CALL_PassTexCoordATI(ctx->CurrentDispatch, (dst, coord, swizzle));
+      trace_unlock();
+   }
+   else {
+      CALL_PassTexCoordATI(ctx->CurrentDispatch, (dst, coord, swizzle));
+   }
+}
+
+static void GLAPIENTRY
+trace_SampleMapATI(GLuint dst, GLuint interp, GLenum swizzle)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SampleMapATI);
+      trace_write(&dst, sizeof(dst));
+      trace_write(&interp, sizeof(interp));
+      trace_write(&swizzle, sizeof(swizzle));
+      CALL_SampleMapATI(ctx->CurrentDispatch, (dst, interp, swizzle));
+      trace_unlock();
+   }
+   else {
+      CALL_SampleMapATI(ctx->CurrentDispatch, (dst, interp, swizzle));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ColorFragmentOp1ATI);
+      trace_write(&op, sizeof(op));
+      trace_write(&dst, sizeof(dst));
+      trace_write(&dstMask, sizeof(dstMask));
+      trace_write(&dstMod, sizeof(dstMod));
+      trace_write(&arg1, sizeof(arg1));
+      trace_write(&arg1Rep, sizeof(arg1Rep));
+      trace_write(&arg1Mod, sizeof(arg1Mod));
+      CALL_ColorFragmentOp1ATI(ctx->CurrentDispatch, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod));
+      trace_unlock();
+   }
+   else {
+      CALL_ColorFragmentOp1ATI(ctx->CurrentDispatch, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ColorFragmentOp2ATI);
+      trace_write(&op, sizeof(op));
+      trace_write(&dst, sizeof(dst));
+      trace_write(&dstMask, sizeof(dstMask));
+      trace_write(&dstMod, sizeof(dstMod));
+      trace_write(&arg1, sizeof(arg1));
+      trace_write(&arg1Rep, sizeof(arg1Rep));
+      trace_write(&arg1Mod, sizeof(arg1Mod));
+      trace_write(&arg2, sizeof(arg2));
+      trace_write(&arg2Rep, sizeof(arg2Rep));
+      trace_write(&arg2Mod, sizeof(arg2Mod));
+      CALL_ColorFragmentOp2ATI(ctx->CurrentDispatch, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod));
+      trace_unlock();
+   }
+   else {
+      CALL_ColorFragmentOp2ATI(ctx->CurrentDispatch, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod));
+   }
+}
+
+static void GLAPIENTRY
+trace_ColorFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_ColorFragmentOp3ATI);
+      trace_write(&op, sizeof(op));
+      trace_write(&dst, sizeof(dst));
+      trace_write(&dstMask, sizeof(dstMask));
+      trace_write(&dstMod, sizeof(dstMod));
+      trace_write(&arg1, sizeof(arg1));
+      trace_write(&arg1Rep, sizeof(arg1Rep));
+      trace_write(&arg1Mod, sizeof(arg1Mod));
+      trace_write(&arg2, sizeof(arg2));
+      trace_write(&arg2Rep, sizeof(arg2Rep));
+      trace_write(&arg2Mod, sizeof(arg2Mod));
+      trace_write(&arg3, sizeof(arg3));
+      trace_write(&arg3Rep, sizeof(arg3Rep));
+      trace_write(&arg3Mod, sizeof(arg3Mod));
+      CALL_ColorFragmentOp3ATI(ctx->CurrentDispatch, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod));
+      trace_unlock();
+   }
+   else {
+      CALL_ColorFragmentOp3ATI(ctx->CurrentDispatch, (op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod));
+   }
+}
+
+static void GLAPIENTRY
+trace_AlphaFragmentOp1ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_AlphaFragmentOp1ATI);
+      trace_write(&op, sizeof(op));
+      trace_write(&dst, sizeof(dst));
+      trace_write(&dstMod, sizeof(dstMod));
+      trace_write(&arg1, sizeof(arg1));
+      trace_write(&arg1Rep, sizeof(arg1Rep));
+      trace_write(&arg1Mod, sizeof(arg1Mod));
+      CALL_AlphaFragmentOp1ATI(ctx->CurrentDispatch, (op, dst, dstMod, arg1, arg1Rep, arg1Mod));
+      trace_unlock();
+   }
+   else {
+      CALL_AlphaFragmentOp1ATI(ctx->CurrentDispatch, (op, dst, dstMod, arg1, arg1Rep, arg1Mod));
+   }
+}
+
+static void GLAPIENTRY
+trace_AlphaFragmentOp2ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_AlphaFragmentOp2ATI);
+      trace_write(&op, sizeof(op));
+      trace_write(&dst, sizeof(dst));
+      trace_write(&dstMod, sizeof(dstMod));
+      trace_write(&arg1, sizeof(arg1));
+      trace_write(&arg1Rep, sizeof(arg1Rep));
+      trace_write(&arg1Mod, sizeof(arg1Mod));
+      trace_write(&arg2, sizeof(arg2));
+      trace_write(&arg2Rep, sizeof(arg2Rep));
+      trace_write(&arg2Mod, sizeof(arg2Mod));
+      CALL_AlphaFragmentOp2ATI(ctx->CurrentDispatch, (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod));
+      trace_unlock();
+   }
+   else {
+      CALL_AlphaFragmentOp2ATI(ctx->CurrentDispatch, (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod));
+   }
+}
+
+static void GLAPIENTRY
+trace_AlphaFragmentOp3ATI(GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_AlphaFragmentOp3ATI);
+      trace_write(&op, sizeof(op));
+      trace_write(&dst, sizeof(dst));
+      trace_write(&dstMod, sizeof(dstMod));
+      trace_write(&arg1, sizeof(arg1));
+      trace_write(&arg1Rep, sizeof(arg1Rep));
+      trace_write(&arg1Mod, sizeof(arg1Mod));
+      trace_write(&arg2, sizeof(arg2));
+      trace_write(&arg2Rep, sizeof(arg2Rep));
+      trace_write(&arg2Mod, sizeof(arg2Mod));
+      trace_write(&arg3, sizeof(arg3));
+      trace_write(&arg3Rep, sizeof(arg3Rep));
+      trace_write(&arg3Mod, sizeof(arg3Mod));
+      CALL_AlphaFragmentOp3ATI(ctx->CurrentDispatch, (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod));
+      trace_unlock();
+   }
+   else {
+      CALL_AlphaFragmentOp3ATI(ctx->CurrentDispatch, (op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod));
+   }
+}
+
+static void GLAPIENTRY
+trace_SetFragmentShaderConstantATI(GLuint dst, const GLfloat * value)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_SetFragmentShaderConstantATI);
+      trace_write(&dst, sizeof(dst));
+      trace_array(value, 4 * sizeof(GLfloat));
+      CALL_SetFragmentShaderConstantATI(ctx->CurrentDispatch, (dst, value));
+      trace_unlock();
+   }
+   else {
+      CALL_SetFragmentShaderConstantATI(ctx->CurrentDispatch, (dst, value));
+   }
+}
+
+static GLboolean GLAPIENTRY
+trace_IsRenderbufferEXT(GLuint renderbuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsRenderbufferEXT(ctx->CurrentDispatch, (renderbuffer));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_BindRenderbufferEXT(GLenum target, GLuint renderbuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BindRenderbufferEXT);
+      trace_write(&target, sizeof(target));
+      trace_write(&renderbuffer, sizeof(renderbuffer));
+      CALL_BindRenderbufferEXT(ctx->CurrentDispatch, (target, renderbuffer));
+      trace_unlock();
+   }
+   else {
+      CALL_BindRenderbufferEXT(ctx->CurrentDispatch, (target, renderbuffer));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteRenderbuffersEXT(GLsizei n, const GLuint * renderbuffers)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteRenderbuffersEXT);
+      trace_write(&n, sizeof(n));
+      trace_array(renderbuffers, count_bytes(n, sizeof(GLuint)));
+      CALL_DeleteRenderbuffersEXT(ctx->CurrentDispatch, (n, renderbuffers));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteRenderbuffersEXT(ctx->CurrentDispatch, (n, renderbuffers));
+   }
+}
+
+static void GLAPIENTRY
+trace_GenRenderbuffersEXT(GLsizei n, GLuint * renderbuffers)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenRenderbuffersEXT);
+      trace_write(&n, sizeof(n));
+      trace_output(renderbuffers, count_bytes(n, sizeof(GLuint)));
+      CALL_GenRenderbuffersEXT(ctx->CurrentDispatch, (n, renderbuffers));
+      trace_unlock();
+   }
+   else {
+      CALL_GenRenderbuffersEXT(ctx->CurrentDispatch, (n, renderbuffers));
+   }
+}
+
+static void GLAPIENTRY
+trace_RenderbufferStorageEXT(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_RenderbufferStorageEXT);
+      trace_write(&target, sizeof(target));
+      trace_write(&internalformat, sizeof(internalformat));
+      trace_write(&width, sizeof(width));
+      trace_write(&height, sizeof(height));
+      CALL_RenderbufferStorageEXT(ctx->CurrentDispatch, (target, internalformat, width, height));
+      trace_unlock();
+   }
+   else {
+      CALL_RenderbufferStorageEXT(ctx->CurrentDispatch, (target, internalformat, width, height));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetRenderbufferParameterivEXT(GLenum target, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetRenderbufferParameterivEXT(ctx->CurrentDispatch, (target, pname, params));
+}
+
+static GLboolean GLAPIENTRY
+trace_IsFramebufferEXT(GLuint framebuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLboolean ret;
+   ret = CALL_IsFramebufferEXT(ctx->CurrentDispatch, (framebuffer));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_BindFramebufferEXT(GLenum target, GLuint framebuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_BindFramebufferEXT);
+      trace_write(&target, sizeof(target));
+      trace_write(&framebuffer, sizeof(framebuffer));
+      CALL_BindFramebufferEXT(ctx->CurrentDispatch, (target, framebuffer));
+      trace_unlock();
+   }
+   else {
+      CALL_BindFramebufferEXT(ctx->CurrentDispatch, (target, framebuffer));
+   }
+}
+
+static void GLAPIENTRY
+trace_DeleteFramebuffersEXT(GLsizei n, const GLuint * framebuffers)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_DeleteFramebuffersEXT);
+      trace_write(&n, sizeof(n));
+      trace_array(framebuffers, count_bytes(n, sizeof(GLuint)));
+      CALL_DeleteFramebuffersEXT(ctx->CurrentDispatch, (n, framebuffers));
+      trace_unlock();
+   }
+   else {
+      CALL_DeleteFramebuffersEXT(ctx->CurrentDispatch, (n, framebuffers));
+   }
+}
+
+static void GLAPIENTRY
+trace_GenFramebuffersEXT(GLsizei n, GLuint * framebuffers)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenFramebuffersEXT);
+      trace_write(&n, sizeof(n));
+      trace_output(framebuffers, count_bytes(n, sizeof(GLuint)));
+      CALL_GenFramebuffersEXT(ctx->CurrentDispatch, (n, framebuffers));
+      trace_unlock();
+   }
+   else {
+      CALL_GenFramebuffersEXT(ctx->CurrentDispatch, (n, framebuffers));
+   }
+}
+
+static GLenum GLAPIENTRY
+trace_CheckFramebufferStatusEXT(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   GLenum ret;
+   ret = CALL_CheckFramebufferStatusEXT(ctx->CurrentDispatch, (target));
+   return ret;
+}
+
+static void GLAPIENTRY
+trace_FramebufferTexture1DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FramebufferTexture1DEXT);
+      trace_write(&target, sizeof(target));
+      trace_write(&attachment, sizeof(attachment));
+      trace_write(&textarget, sizeof(textarget));
+      trace_write(&texture, sizeof(texture));
+      trace_write(&level, sizeof(level));
+      CALL_FramebufferTexture1DEXT(ctx->CurrentDispatch, (target, attachment, textarget, texture, level));
+      trace_unlock();
+   }
+   else {
+      CALL_FramebufferTexture1DEXT(ctx->CurrentDispatch, (target, attachment, textarget, texture, level));
+   }
+}
+
+static void GLAPIENTRY
+trace_FramebufferTexture2DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FramebufferTexture2DEXT);
+      trace_write(&target, sizeof(target));
+      trace_write(&attachment, sizeof(attachment));
+      trace_write(&textarget, sizeof(textarget));
+      trace_write(&texture, sizeof(texture));
+      trace_write(&level, sizeof(level));
+      CALL_FramebufferTexture2DEXT(ctx->CurrentDispatch, (target, attachment, textarget, texture, level));
+      trace_unlock();
+   }
+   else {
+      CALL_FramebufferTexture2DEXT(ctx->CurrentDispatch, (target, attachment, textarget, texture, level));
+   }
+}
+
+static void GLAPIENTRY
+trace_FramebufferTexture3DEXT(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FramebufferTexture3DEXT);
+      trace_write(&target, sizeof(target));
+      trace_write(&attachment, sizeof(attachment));
+      trace_write(&textarget, sizeof(textarget));
+      trace_write(&texture, sizeof(texture));
+      trace_write(&level, sizeof(level));
+      trace_write(&zoffset, sizeof(zoffset));
+      CALL_FramebufferTexture3DEXT(ctx->CurrentDispatch, (target, attachment, textarget, texture, level, zoffset));
+      trace_unlock();
+   }
+   else {
+      CALL_FramebufferTexture3DEXT(ctx->CurrentDispatch, (target, attachment, textarget, texture, level, zoffset));
+   }
+}
+
+static void GLAPIENTRY
+trace_FramebufferRenderbufferEXT(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_FramebufferRenderbufferEXT);
+      trace_write(&target, sizeof(target));
+      trace_write(&attachment, sizeof(attachment));
+      trace_write(&renderbuffertarget, sizeof(renderbuffertarget));
+      trace_write(&renderbuffer, sizeof(renderbuffer));
+      CALL_FramebufferRenderbufferEXT(ctx->CurrentDispatch, (target, attachment, renderbuffertarget, renderbuffer));
+      trace_unlock();
+   }
+   else {
+      CALL_FramebufferRenderbufferEXT(ctx->CurrentDispatch, (target, attachment, renderbuffertarget, renderbuffer));
+   }
+}
+
+static void GLAPIENTRY
+trace_GetFramebufferAttachmentParameterivEXT(GLenum target, GLenum attachment, GLenum pname, GLint * params)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   CALL_GetFramebufferAttachmentParameterivEXT(ctx->CurrentDispatch, (target, attachment, pname, params));
+}
+
+static void GLAPIENTRY
+trace_GenerateMipmapEXT(GLenum target)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_GenerateMipmapEXT);
+      trace_write(&target, sizeof(target));
+      CALL_GenerateMipmapEXT(ctx->CurrentDispatch, (target));
+      trace_unlock();
+   }
+   else {
+      CALL_GenerateMipmapEXT(ctx->CurrentDispatch, (target));
+   }
+}
+
+static void GLAPIENTRY
+trace_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_StencilFuncSeparate);
+      trace_write(&face, sizeof(face));
+      trace_write(&func, sizeof(func));
+      trace_write(&ref, sizeof(ref));
+      trace_write(&mask, sizeof(mask));
+      CALL_StencilFuncSeparate(ctx->CurrentDispatch, (face, func, ref, mask));
+      trace_unlock();
+   }
+   else {
+      CALL_StencilFuncSeparate(ctx->CurrentDispatch, (face, func, ref, mask));
+   }
+}
+
+static void GLAPIENTRY
+trace_StencilOpSeparate(GLenum face, GLenum fail, GLenum zfail, GLenum zpass)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_StencilOpSeparate);
+      trace_write(&face, sizeof(face));
+      trace_write(&fail, sizeof(fail));
+      trace_write(&zfail, sizeof(zfail));
+      trace_write(&zpass, sizeof(zpass));
+      CALL_StencilOpSeparate(ctx->CurrentDispatch, (face, fail, zfail, zpass));
+      trace_unlock();
+   }
+   else {
+      CALL_StencilOpSeparate(ctx->CurrentDispatch, (face, fail, zfail, zpass));
+   }
+}
+
+static void GLAPIENTRY
+trace_StencilMaskSeparate(GLenum face, GLuint mask)
+{
+   GET_CURRENT_CONTEXT(ctx);
+   if (trace_lock(ctx)) {
+      trace_record(TRACE_CALL_StencilMaskSeparate);
+      trace_write(&face, sizeof(face));
+      trace_write(&mask, sizeof(mask));
+      CALL_StencilMaskSeparate(ctx->CurrentDispatch, (face, mask));
+      trace_unlock();
+   }
+   else {
+      CALL_StencilMaskSeparate(ctx->CurrentDispatch, (face, mask));
+   }
+}
+
+
+static void
+init_trace_table(struct _glapi_table *table)
+{
+   SET_NewList(table, trace_NewList);
+   SET_EndList(table, trace_EndList);
+   SET_CallList(table, trace_CallList);
+   SET_CallLists(table, trace_CallLists);
+   SET_DeleteLists(table, trace_DeleteLists);
+   SET_GenLists(table, trace_GenLists);
+   SET_ListBase(table, trace_ListBase);
+   SET_Begin(table, trace_Begin);
+   SET_Bitmap(table, trace_Bitmap);
+   SET_Color3b(table, trace_Color3b);
+   SET_Color3bv(table, trace_Color3bv);
+   SET_Color3d(table, trace_Color3d);
+   SET_Color3dv(table, trace_Color3dv);
+   SET_Color3f(table, trace_Color3f);
+   SET_Color3fv(table, trace_Color3fv);
+   SET_Color3i(table, trace_Color3i);
+   SET_Color3iv(table, trace_Color3iv);
+   SET_Color3s(table, trace_Color3s);
+   SET_Color3sv(table, trace_Color3sv);
+   SET_Color3ub(table, trace_Color3ub);
+   SET_Color3ubv(table, trace_Color3ubv);
+   SET_Color3ui(table, trace_Color3ui);
+   SET_Color3uiv(table, trace_Color3uiv);
+   SET_Color3us(table, trace_Color3us);
+   SET_Color3usv(table, trace_Color3usv);
+   SET_Color4b(table, trace_Color4b);
+   SET_Color4bv(table, trace_Color4bv);
+   SET_Color4d(table, trace_Color4d);
+   SET_Color4dv(table, trace_Color4dv);
+   SET_Color4f(table, trace_Color4f);
+   SET_Color4fv(table, trace_Color4fv);
+   SET_Color4i(table, trace_Color4i);
+   SET_Color4iv(table, trace_Color4iv);
+   SET_Color4s(table, trace_Color4s);
+   SET_Color4sv(table, trace_Color4sv);
+   SET_Color4ub(table, trace_Color4ub);
+   SET_Color4ubv(table, trace_Color4ubv);
+   SET_Color4ui(table, trace_Color4ui);
+   SET_Color4uiv(table, trace_Color4uiv);
+   SET_Color4us(table, trace_Color4us);
+   SET_Color4usv(table, trace_Color4usv);
+   SET_EdgeFlag(table, trace_EdgeFlag);
+   SET_EdgeFlagv(table, trace_EdgeFlagv);
+   SET_End(table, trace_End);
+   SET_Indexd(table, trace_Indexd);
+   SET_Indexdv(table, trace_Indexdv);
+   SET_Indexf(table, trace_Indexf);
+   SET_Indexfv(table, trace_Indexfv);
+   SET_Indexi(table, trace_Indexi);
+   SET_Indexiv(table, trace_Indexiv);
+   SET_Indexs(table, trace_Indexs);
+   SET_Indexsv(table, trace_Indexsv);
+   SET_Normal3b(table, trace_Normal3b);
+   SET_Normal3bv(table, trace_Normal3bv);
+   SET_Normal3d(table, trace_Normal3d);
+   SET_Normal3dv(table, trace_Normal3dv);
+   SET_Normal3f(table, trace_Normal3f);
+   SET_Normal3fv(table, trace_Normal3fv);
+   SET_Normal3i(table, trace_Normal3i);
+   SET_Normal3iv(table, trace_Normal3iv);
+   SET_Normal3s(table, trace_Normal3s);
+   SET_Normal3sv(table, trace_Normal3sv);
+   SET_RasterPos2d(table, trace_RasterPos2d);
+   SET_RasterPos2dv(table, trace_RasterPos2dv);
+   SET_RasterPos2f(table, trace_RasterPos2f);
+   SET_RasterPos2fv(table, trace_RasterPos2fv);
+   SET_RasterPos2i(table, trace_RasterPos2i);
+   SET_RasterPos2iv(table, trace_RasterPos2iv);
+   SET_RasterPos2s(table, trace_RasterPos2s);
+   SET_RasterPos2sv(table, trace_RasterPos2sv);
+   SET_RasterPos3d(table, trace_RasterPos3d);
+   SET_RasterPos3dv(table, trace_RasterPos3dv);
+   SET_RasterPos3f(table, trace_RasterPos3f);
+   SET_RasterPos3fv(table, trace_RasterPos3fv);
+   SET_RasterPos3i(table, trace_RasterPos3i);
+   SET_RasterPos3iv(table, trace_RasterPos3iv);
+   SET_RasterPos3s(table, trace_RasterPos3s);
+   SET_RasterPos3sv(table, trace_RasterPos3sv);
+   SET_RasterPos4d(table, trace_RasterPos4d);
+   SET_RasterPos4dv(table, trace_RasterPos4dv);
+   SET_RasterPos4f(table, trace_RasterPos4f);
+   SET_RasterPos4fv(table, trace_RasterPos4fv);
+   SET_RasterPos4i(table, trace_RasterPos4i);
+   SET_RasterPos4iv(table, trace_RasterPos4iv);
+   SET_RasterPos4s(table, trace_RasterPos4s);
+   SET_RasterPos4sv(table, trace_RasterPos4sv);
+   SET_Rectd(table, trace_Rectd);
+   SET_Rectdv(table, trace_Rectdv);
+   SET_Rectf(table, trace_Rectf);
+   SET_Rectfv(table, trace_Rectfv);
+   SET_Recti(table, trace_Recti);
+   SET_Rectiv(table, trace_Rectiv);
+   SET_Rects(table, trace_Rects);
+   SET_Rectsv(table, trace_Rectsv);
+   SET_TexCoord1d(table, trace_TexCoord1d);
+   SET_TexCoord1dv(table, trace_TexCoord1dv);
+   SET_TexCoord1f(table, trace_TexCoord1f);
+   SET_TexCoord1fv(table, trace_TexCoord1fv);
+   SET_TexCoord1i(table, trace_TexCoord1i);
+   SET_TexCoord1iv(table, trace_TexCoord1iv);
+   SET_TexCoord1s(table, trace_TexCoord1s);
+   SET_TexCoord1sv(table, trace_TexCoord1sv);
+   SET_TexCoord2d(table, trace_TexCoord2d);
+   SET_TexCoord2dv(table, trace_TexCoord2dv);
+   SET_TexCoord2f(table, trace_TexCoord2f);
+   SET_TexCoord2fv(table, trace_TexCoord2fv);
+   SET_TexCoord2i(table, trace_TexCoord2i);
+   SET_TexCoord2iv(table, trace_TexCoord2iv);
+   SET_TexCoord2s(table, trace_TexCoord2s);
+   SET_TexCoord2sv(table, trace_TexCoord2sv);
+   SET_TexCoord3d(table, trace_TexCoord3d);
+   SET_TexCoord3dv(table, trace_TexCoord3dv);
+   SET_TexCoord3f(table, trace_TexCoord3f);
+   SET_TexCoord3fv(table, trace_TexCoord3fv);
+   SET_TexCoord3i(table, trace_TexCoord3i);
+   SET_TexCoord3iv(table, trace_TexCoord3iv);
+   SET_TexCoord3s(table, trace_TexCoord3s);
+   SET_TexCoord3sv(table, trace_TexCoord3sv);
+   SET_TexCoord4d(table, trace_TexCoord4d);
+   SET_TexCoord4dv(table, trace_TexCoord4dv);
+   SET_TexCoord4f(table, trace_TexCoord4f);
+   SET_TexCoord4fv(table, trace_TexCoord4fv);
+   SET_TexCoord4i(table, trace_TexCoord4i);
+   SET_TexCoord4iv(table, trace_TexCoord4iv);
+   SET_TexCoord4s(table, trace_TexCoord4s);
+   SET_TexCoord4sv(table, trace_TexCoord4sv);
+   SET_Vertex2d(table, trace_Vertex2d);
+   SET_Vertex2dv(table, trace_Vertex2dv);
+   SET_Vertex2f(table, trace_Vertex2f);
+   SET_Vertex2fv(table, trace_Vertex2fv);
+   SET_Vertex2i(table, trace_Vertex2i);
+   SET_Vertex2iv(table, trace_Vertex2iv);
+   SET_Vertex2s(table, trace_Vertex2s);
+   SET_Vertex2sv(table, trace_Vertex2sv);
+   SET_Vertex3d(table, trace_Vertex3d);
+   SET_Vertex3dv(table, trace_Vertex3dv);
+   SET_Vertex3f(table, trace_Vertex3f);
+   SET_Vertex3fv(table, trace_Vertex3fv);
+   SET_Vertex3i(table, trace_Vertex3i);
+   SET_Vertex3iv(table, trace_Vertex3iv);
+   SET_Vertex3s(table, trace_Vertex3s);
+   SET_Vertex3sv(table, trace_Vertex3sv);
+   SET_Vertex4d(table, trace_Vertex4d);
+   SET_Vertex4dv(table, trace_Vertex4dv);
+   SET_Vertex4f(table, trace_Vertex4f);
+   SET_Vertex4fv(table, trace_Vertex4fv);
+   SET_Vertex4i(table, trace_Vertex4i);
+   SET_Vertex4iv(table, trace_Vertex4iv);
+   SET_Vertex4s(table, trace_Vertex4s);
+   SET_Vertex4sv(table, trace_Vertex4sv);
+   SET_ClipPlane(table, trace_ClipPlane);
+   SET_ColorMaterial(table, trace_ColorMaterial);
+   SET_CullFace(table, trace_CullFace);
+   SET_Fogf(table, trace_Fogf);
+   SET_Fogfv(table, trace_Fogfv);
+   SET_Fogi(table, trace_Fogi);
+   SET_Fogiv(table, trace_Fogiv);
+   SET_FrontFace(table, trace_FrontFace);
+   SET_Hint(table, trace_Hint);
+   SET_Lightf(table, trace_Lightf);
+   SET_Lightfv(table, trace_Lightfv);
+   SET_Lighti(table, trace_Lighti);
+   SET_Lightiv(table, trace_Lightiv);
+   SET_LightModelf(table, trace_LightModelf);
+   SET_LightModelfv(table, trace_LightModelfv);
+   SET_LightModeli(table, trace_LightModeli);
+   SET_LightModeliv(table, trace_LightModeliv);
+   SET_LineStipple(table, trace_LineStipple);
+   SET_LineWidth(table, trace_LineWidth);
+   SET_Materialf(table, trace_Materialf);
+   SET_Materialfv(table, trace_Materialfv);
+   SET_Materiali(table, trace_Materiali);
+   SET_Materialiv(table, trace_Materialiv);
+   SET_PointSize(table, trace_PointSize);
+   SET_PolygonMode(table, trace_PolygonMode);
+   SET_PolygonStipple(table, trace_PolygonStipple);
+   SET_Scissor(table, trace_Scissor);
+   SET_ShadeModel(table, trace_ShadeModel);
+   SET_TexParameterf(table, trace_TexParameterf);
+   SET_TexParameterfv(table, trace_TexParameterfv);
+   SET_TexParameteri(table, trace_TexParameteri);
+   SET_TexParameteriv(table, trace_TexParameteriv);
+   SET_TexImage1D(table, trace_TexImage1D);
+   SET_TexImage2D(table, trace_TexImage2D);
+   SET_TexEnvf(table, trace_TexEnvf);
+   SET_TexEnvfv(table, trace_TexEnvfv);
+   SET_TexEnvi(table, trace_TexEnvi);
+   SET_TexEnviv(table, trace_TexEnviv);
+   SET_TexGend(table, trace_TexGend);
+   SET_TexGendv(table, trace_TexGendv);
+   SET_TexGenf(table, trace_TexGenf);
+   SET_TexGenfv(table, trace_TexGenfv);
+   SET_TexGeni(table, trace_TexGeni);
+   SET_TexGeniv(table, trace_TexGeniv);
+   SET_FeedbackBuffer(table, trace_FeedbackBuffer);
+   SET_SelectBuffer(table, trace_SelectBuffer);
+   SET_RenderMode(table, trace_RenderMode);
+   SET_InitNames(table, trace_InitNames);
+   SET_LoadName(table, trace_LoadName);
+   SET_PassThrough(table, trace_PassThrough);
+   SET_PopName(table, trace_PopName);
+   SET_PushName(table, trace_PushName);
+   SET_DrawBuffer(table, trace_DrawBuffer);
+   SET_Clear(table, trace_Clear);
+   SET_ClearAccum(table, trace_ClearAccum);
+   SET_ClearIndex(table, trace_ClearIndex);
+   SET_ClearColor(table, trace_ClearColor);
+   SET_ClearStencil(table, trace_ClearStencil);
+   SET_ClearDepth(table, trace_ClearDepth);
+   SET_StencilMask(table, trace_StencilMask);
+   SET_ColorMask(table, trace_ColorMask);
+   SET_DepthMask(table, trace_DepthMask);
+   SET_IndexMask(table, trace_IndexMask);
+   SET_Accum(table, trace_Accum);
+   SET_Disable(table, trace_Disable);
+   SET_Enable(table, trace_Enable);
+   SET_Finish(table, trace_Finish);
+   SET_Flush(table, trace_Flush);
+   SET_PopAttrib(table, trace_PopAttrib);
+   SET_PushAttrib(table, trace_PushAttrib);
+   SET_Map1d(table, trace_Map1d);
+   SET_Map1f(table, trace_Map1f);
+   SET_Map2d(table, trace_Map2d);
+   SET_Map2f(table, trace_Map2f);
+   SET_MapGrid1d(table, trace_MapGrid1d);
+   SET_MapGrid1f(table, trace_MapGrid1f);
+   SET_MapGrid2d(table, trace_MapGrid2d);
+   SET_MapGrid2f(table, trace_MapGrid2f);
+   SET_EvalCoord1d(table, trace_EvalCoord1d);
+   SET_EvalCoord1dv(table, trace_EvalCoord1dv);
+   SET_EvalCoord1f(table, trace_EvalCoord1f);
+   SET_EvalCoord1fv(table, trace_EvalCoord1fv);
+   SET_EvalCoord2d(table, trace_EvalCoord2d);
+   SET_EvalCoord2dv(table, trace_EvalCoord2dv);
+   SET_EvalCoord2f(table, trace_EvalCoord2f);
+   SET_EvalCoord2fv(table, trace_EvalCoord2fv);
+   SET_EvalMesh1(table, trace_EvalMesh1);
+   SET_EvalPoint1(table, trace_EvalPoint1);
+   SET_EvalMesh2(table, trace_EvalMesh2);
+   SET_EvalPoint2(table, trace_EvalPoint2);
+   SET_AlphaFunc(table, trace_AlphaFunc);
+   SET_BlendFunc(table, trace_BlendFunc);
+   SET_LogicOp(table, trace_LogicOp);
+   SET_StencilFunc(table, trace_StencilFunc);
+   SET_StencilOp(table, trace_StencilOp);
+   SET_DepthFunc(table, trace_DepthFunc);
+   SET_PixelZoom(table, trace_PixelZoom);
+   SET_PixelTransferf(table, trace_PixelTransferf);
+   SET_PixelTransferi(table, trace_PixelTransferi);
+   SET_PixelStoref(table, trace_PixelStoref);
+   SET_PixelStorei(table, trace_PixelStorei);
+   SET_PixelMapfv(table, trace_PixelMapfv);
+   SET_PixelMapuiv(table, trace_PixelMapuiv);
+   SET_PixelMapusv(table, trace_PixelMapusv);
+   SET_ReadBuffer(table, trace_ReadBuffer);
+   SET_CopyPixels(table, trace_CopyPixels);
+   SET_ReadPixels(table, trace_ReadPixels);
+   SET_DrawPixels(table, trace_DrawPixels);
+   SET_GetBooleanv(table, trace_GetBooleanv);
+   SET_GetClipPlane(table, trace_GetClipPlane);
+   SET_GetDoublev(table, trace_GetDoublev);
+   SET_GetError(table, trace_GetError);
+   SET_GetFloatv(table, trace_GetFloatv);
+   SET_GetIntegerv(table, trace_GetIntegerv);
+   SET_GetLightfv(table, trace_GetLightfv);
+   SET_GetLightiv(table, trace_GetLightiv);
+   SET_GetMapdv(table, trace_GetMapdv);
+   SET_GetMapfv(table, trace_GetMapfv);
+   SET_GetMapiv(table, trace_GetMapiv);
+   SET_GetMaterialfv(table, trace_GetMaterialfv);
+   SET_GetMaterialiv(table, trace_GetMaterialiv);
+   SET_GetPixelMapfv(table, trace_GetPixelMapfv);
+   SET_GetPixelMapuiv(table, trace_GetPixelMapuiv);
+   SET_GetPixelMapusv(table, trace_GetPixelMapusv);
+   SET_GetPolygonStipple(table, trace_GetPolygonStipple);
+   SET_GetString(table, trace_GetString);
+   SET_GetTexEnvfv(table, trace_GetTexEnvfv);
+   SET_GetTexEnviv(table, trace_GetTexEnviv);
+   SET_GetTexGendv(table, trace_GetTexGendv);
+   SET_GetTexGenfv(table, trace_GetTexGenfv);
+   SET_GetTexGeniv(table, trace_GetTexGeniv);
+   SET_GetTexImage(table, trace_GetTexImage);
+   SET_GetTexParameterfv(table, trace_GetTexParameterfv);
+   SET_GetTexParameteriv(table, trace_GetTexParameteriv);
+   SET_GetTexLevelParameterfv(table, trace_GetTexLevelParameterfv);
+   SET_GetTexLevelParameteriv(table, trace_GetTexLevelParameteriv);
+   SET_IsEnabled(table, trace_IsEnabled);
+   SET_IsList(table, trace_IsList);
+   SET_DepthRange(table, trace_DepthRange);
+   SET_Frustum(table, trace_Frustum);
+   SET_LoadIdentity(table, trace_LoadIdentity);
+   SET_LoadMatrixf(table, trace_LoadMatrixf);
+   SET_LoadMatrixd(table, trace_LoadMatrixd);
+   SET_MatrixMode(table, trace_MatrixMode);
+   SET_MultMatrixf(table, trace_MultMatrixf);
+   SET_MultMatrixd(table, trace_MultMatrixd);
+   SET_Ortho(table, trace_Ortho);
+   SET_PopMatrix(table, trace_PopMatrix);
+   SET_PushMatrix(table, trace_PushMatrix);
+   SET_Rotated(table, trace_Rotated);
+   SET_Rotatef(table, trace_Rotatef);
+   SET_Scaled(table, trace_Scaled);
+   SET_Scalef(table, trace_Scalef);
+   SET_Translated(table, trace_Translated);
+   SET_Translatef(table, trace_Translatef);
+   SET_Viewport(table, trace_Viewport);
+   SET_ArrayElement(table, trace_ArrayElement);
+   SET_BindTexture(table, trace_BindTexture);
+   SET_ColorPointer(table, trace_ColorPointer);
+   SET_DisableClientState(table, trace_DisableClientState);
+   SET_DrawArrays(table, trace_DrawArrays);
+   SET_DrawElements(table, trace_DrawElements);
+   SET_EdgeFlagPointer(table, trace_EdgeFlagPointer);
+   SET_EnableClientState(table, trace_EnableClientState);
+   SET_IndexPointer(table, trace_IndexPointer);
+   SET_Indexub(table, trace_Indexub);
+   SET_Indexubv(table, trace_Indexubv);
+   SET_InterleavedArrays(table, trace_InterleavedArrays);
+   SET_NormalPointer(table, trace_NormalPointer);
+   SET_PolygonOffset(table, trace_PolygonOffset);
+   SET_TexCoordPointer(table, trace_TexCoordPointer);
+   SET_VertexPointer(table, trace_VertexPointer);
+   SET_AreTexturesResident(table, trace_AreTexturesResident);
+   SET_CopyTexImage1D(table, trace_CopyTexImage1D);
+   SET_CopyTexImage2D(table, trace_CopyTexImage2D);
+   SET_CopyTexSubImage1D(table, trace_CopyTexSubImage1D);
+   SET_CopyTexSubImage2D(table, trace_CopyTexSubImage2D);
+   SET_DeleteTextures(table, trace_DeleteTextures);
+   SET_GenTextures(table, trace_GenTextures);
+   SET_GetPointerv(table, trace_GetPointerv);
+   SET_IsTexture(table, trace_IsTexture);
+   SET_PrioritizeTextures(table, trace_PrioritizeTextures);
+   SET_TexSubImage1D(table, trace_TexSubImage1D);
+   SET_TexSubImage2D(table, trace_TexSubImage2D);
+   SET_PopClientAttrib(table, trace_PopClientAttrib);
+   SET_PushClientAttrib(table, trace_PushClientAttrib);
+   SET_BlendColor(table, trace_BlendColor);
+   SET_BlendEquation(table, trace_BlendEquation);
+   SET_DrawRangeElements(table, trace_DrawRangeElements);
+   SET_ColorTable(table, trace_ColorTable);
+   SET_ColorTableParameterfv(table, trace_ColorTableParameterfv);
+   SET_ColorTableParameteriv(table, trace_ColorTableParameteriv);
+   SET_CopyColorTable(table, trace_CopyColorTable);
+   SET_GetColorTable(table, trace_GetColorTable);
+   SET_GetColorTableParameterfv(table, trace_GetColorTableParameterfv);
+   SET_GetColorTableParameteriv(table, trace_GetColorTableParameteriv);
+   SET_ColorSubTable(table, trace_ColorSubTable);
+   SET_CopyColorSubTable(table, trace_CopyColorSubTable);
+   SET_ConvolutionFilter1D(table, trace_ConvolutionFilter1D);
+   SET_ConvolutionFilter2D(table, trace_ConvolutionFilter2D);
+   SET_ConvolutionParameterf(table, trace_ConvolutionParameterf);
+   SET_ConvolutionParameterfv(table, trace_ConvolutionParameterfv);
+   SET_ConvolutionParameteri(table, trace_ConvolutionParameteri);
+   SET_ConvolutionParameteriv(table, trace_ConvolutionParameteriv);
+   SET_CopyConvolutionFilter1D(table, trace_CopyConvolutionFilter1D);
+   SET_CopyConvolutionFilter2D(table, trace_CopyConvolutionFilter2D);
+   SET_GetConvolutionFilter(table, trace_GetConvolutionFilter);
+   SET_GetConvolutionParameterfv(table, trace_GetConvolutionParameterfv);
+   SET_GetConvolutionParameteriv(table, trace_GetConvolutionParameteriv);
+   SET_GetSeparableFilter(table, trace_GetSeparableFilter);
+   SET_SeparableFilter2D(table, trace_SeparableFilter2D);
+   SET_GetHistogram(table, trace_GetHistogram);
+   SET_GetHistogramParameterfv(table, trace_GetHistogramParameterfv);
+   SET_GetHistogramParameteriv(table, trace_GetHistogramParameteriv);
+   SET_GetMinmax(table, trace_GetMinmax);
+   SET_GetMinmaxParameterfv(table, trace_GetMinmaxParameterfv);
+   SET_GetMinmaxParameteriv(table, trace_GetMinmaxParameteriv);
+   SET_Histogram(table, trace_Histogram);
+   SET_Minmax(table, trace_Minmax);
+   SET_ResetHistogram(table, trace_ResetHistogram);
+   SET_ResetMinmax(table, trace_ResetMinmax);
+   SET_TexImage3D(table, trace_TexImage3D);
+   SET_TexSubImage3D(table, trace_TexSubImage3D);
+   SET_CopyTexSubImage3D(table, trace_CopyTexSubImage3D);
+   SET_ActiveTextureARB(table, trace_ActiveTextureARB);
+   SET_ClientActiveTextureARB(table, trace_ClientActiveTextureARB);
+   SET_MultiTexCoord1dARB(table, trace_MultiTexCoord1dARB);
+   SET_MultiTexCoord1dvARB(table, trace_MultiTexCoord1dvARB);
+   SET_MultiTexCoord1fARB(table, trace_MultiTexCoord1fARB);
+   SET_MultiTexCoord1fvARB(table, trace_MultiTexCoord1fvARB);
+   SET_MultiTexCoord1iARB(table, trace_MultiTexCoord1iARB);
+   SET_MultiTexCoord1ivARB(table, trace_MultiTexCoord1ivARB);
+   SET_MultiTexCoord1sARB(table, trace_MultiTexCoord1sARB);
+   SET_MultiTexCoord1svARB(table, trace_MultiTexCoord1svARB);
+   SET_MultiTexCoord2dARB(table, trace_MultiTexCoord2dARB);
+   SET_MultiTexCoord2dvARB(table, trace_MultiTexCoord2dvARB);
+   SET_MultiTexCoord2fARB(table, trace_MultiTexCoord2fARB);
+   SET_MultiTexCoord2fvARB(table, trace_MultiTexCoord2fvARB);
+   SET_MultiTexCoord2iARB(table, trace_MultiTexCoord2iARB);
+   SET_MultiTexCoord2ivARB(table, trace_MultiTexCoord2ivARB);
+   SET_MultiTexCoord2sARB(table, trace_MultiTexCoord2sARB);
+   SET_MultiTexCoord2svARB(table, trace_MultiTexCoord2svARB);
+   SET_MultiTexCoord3dARB(table, trace_MultiTexCoord3dARB);
+   SET_MultiTexCoord3dvARB(table, trace_MultiTexCoord3dvARB);
+   SET_MultiTexCoord3fARB(table, trace_MultiTexCoord3fARB);
+   SET_MultiTexCoord3fvARB(table, trace_MultiTexCoord3fvARB);
+   SET_MultiTexCoord3iARB(table, trace_MultiTexCoord3iARB);
+   SET_MultiTexCoord3ivARB(table, trace_MultiTexCoord3ivARB);
+   SET_MultiTexCoord3sARB(table, trace_MultiTexCoord3sARB);
+   SET_MultiTexCoord3svARB(table, trace_MultiTexCoord3svARB);
+   SET_MultiTexCoord4dARB(table, trace_MultiTexCoord4dARB);
+   SET_MultiTexCoord4dvARB(table, trace_MultiTexCoord4dvARB);
+   SET_MultiTexCoord4fARB(table, trace_MultiTexCoord4fARB);
+   SET_MultiTexCoord4fvARB(table, trace_MultiTexCoord4fvARB);
+   SET_MultiTexCoord4iARB(table, trace_MultiTexCoord4iARB);
+   SET_MultiTexCoord4ivARB(table, trace_MultiTexCoord4ivARB);
+   SET_MultiTexCoord4sARB(table, trace_MultiTexCoord4sARB);
+   SET_MultiTexCoord4svARB(table, trace_MultiTexCoord4svARB);
+   SET_LoadTransposeMatrixfARB(table, trace_LoadTransposeMatrixfARB);
+   SET_LoadTransposeMatrixdARB(table, trace_LoadTransposeMatrixdARB);
+   SET_MultTransposeMatrixfARB(table, trace_MultTransposeMatrixfARB);
+   SET_MultTransposeMatrixdARB(table, trace_MultTransposeMatrixdARB);
+   SET_SampleCoverageARB(table, trace_SampleCoverageARB);
+   SET_DrawBuffersARB(table, trace_DrawBuffersARB);
+   SET_PolygonOffsetEXT(table, trace_PolygonOffsetEXT);
+   SET_GetTexFilterFuncSGIS(table, trace_GetTexFilterFuncSGIS);
+   SET_TexFilterFuncSGIS(table, trace_TexFilterFuncSGIS);
+   SET_GetHistogramEXT(table, trace_GetHistogramEXT);
+   SET_GetHistogramParameterfvEXT(table, trace_GetHistogramParameterfvEXT);
+   SET_GetHistogramParameterivEXT(table, trace_GetHistogramParameterivEXT);
+   SET_GetMinmaxEXT(table, trace_GetMinmaxEXT);
+   SET_GetMinmaxParameterfvEXT(table, trace_GetMinmaxParameterfvEXT);
+   SET_GetMinmaxParameterivEXT(table, trace_GetMinmaxParameterivEXT);
+   SET_GetConvolutionFilterEXT(table, trace_GetConvolutionFilterEXT);
+   SET_GetConvolutionParameterfvEXT(table, trace_GetConvolutionParameterfvEXT);
+   SET_GetConvolutionParameterivEXT(table, trace_GetConvolutionParameterivEXT);
+   SET_GetSeparableFilterEXT(table, trace_GetSeparableFilterEXT);
+   SET_GetColorTableSGI(table, trace_GetColorTableSGI);
+   SET_GetColorTableParameterfvSGI(table, trace_GetColorTableParameterfvSGI);
+   SET_GetColorTableParameterivSGI(table, trace_GetColorTableParameterivSGI);
+   SET_PixelTexGenSGIX(table, trace_PixelTexGenSGIX);
+   SET_PixelTexGenParameteriSGIS(table, trace_PixelTexGenParameteriSGIS);
+   SET_PixelTexGenParameterivSGIS(table, trace_PixelTexGenParameterivSGIS);
+   SET_PixelTexGenParameterfSGIS(table, trace_PixelTexGenParameterfSGIS);
+   SET_PixelTexGenParameterfvSGIS(table, trace_PixelTexGenParameterfvSGIS);
+   SET_GetPixelTexGenParameterivSGIS(table, trace_GetPixelTexGenParameterivSGIS);
+   SET_GetPixelTexGenParameterfvSGIS(table, trace_GetPixelTexGenParameterfvSGIS);
+   SET_TexImage4DSGIS(table, trace_TexImage4DSGIS);
+   SET_TexSubImage4DSGIS(table, trace_TexSubImage4DSGIS);
+   SET_AreTexturesResidentEXT(table, trace_AreTexturesResidentEXT);
+   SET_GenTexturesEXT(table, trace_GenTexturesEXT);
+   SET_IsTextureEXT(table, trace_IsTextureEXT);
+   SET_DetailTexFuncSGIS(table, trace_DetailTexFuncSGIS);
+   SET_GetDetailTexFuncSGIS(table, trace_GetDetailTexFuncSGIS);
+   SET_SharpenTexFuncSGIS(table, trace_SharpenTexFuncSGIS);
+   SET_GetSharpenTexFuncSGIS(table, trace_GetSharpenTexFuncSGIS);
+   SET_SampleMaskSGIS(table, trace_SampleMaskSGIS);
+   SET_SamplePatternSGIS(table, trace_SamplePatternSGIS);
+   SET_ColorPointerEXT(table, trace_ColorPointerEXT);
+   SET_EdgeFlagPointerEXT(table, trace_EdgeFlagPointerEXT);
+   SET_IndexPointerEXT(table, trace_IndexPointerEXT);
+   SET_NormalPointerEXT(table, trace_NormalPointerEXT);
+   SET_TexCoordPointerEXT(table, trace_TexCoordPointerEXT);
+   SET_VertexPointerEXT(table, trace_VertexPointerEXT);
+   SET_SpriteParameterfSGIX(table, trace_SpriteParameterfSGIX);
+   SET_SpriteParameterfvSGIX(table, trace_SpriteParameterfvSGIX);
+   SET_SpriteParameteriSGIX(table, trace_SpriteParameteriSGIX);
+   SET_SpriteParameterivSGIX(table, trace_SpriteParameterivSGIX);
+   SET_PointParameterfEXT(table, trace_PointParameterfEXT);
+   SET_PointParameterfvEXT(table, trace_PointParameterfvEXT);
+   SET_GetInstrumentsSGIX(table, trace_GetInstrumentsSGIX);
+   SET_InstrumentsBufferSGIX(table, trace_InstrumentsBufferSGIX);
+   SET_PollInstrumentsSGIX(table, trace_PollInstrumentsSGIX);
+   SET_ReadInstrumentsSGIX(table, trace_ReadInstrumentsSGIX);
+   SET_StartInstrumentsSGIX(table, trace_StartInstrumentsSGIX);
+   SET_StopInstrumentsSGIX(table, trace_StopInstrumentsSGIX);
+   SET_FrameZoomSGIX(table, trace_FrameZoomSGIX);
+   SET_TagSampleBufferSGIX(table, trace_TagSampleBufferSGIX);
+   SET_ReferencePlaneSGIX(table, trace_ReferencePlaneSGIX);
+   SET_FlushRasterSGIX(table, trace_FlushRasterSGIX);
+   SET_GetListParameterfvSGIX(table, trace_GetListParameterfvSGIX);
+   SET_GetListParameterivSGIX(table, trace_GetListParameterivSGIX);
+   SET_ListParameterfSGIX(table, trace_ListParameterfSGIX);
+   SET_ListParameterfvSGIX(table, trace_ListParameterfvSGIX);
+   SET_ListParameteriSGIX(table, trace_ListParameteriSGIX);
+   SET_ListParameterivSGIX(table, trace_ListParameterivSGIX);
+   SET_FragmentColorMaterialSGIX(table, trace_FragmentColorMaterialSGIX);
+   SET_FragmentLightfSGIX(table, trace_FragmentLightfSGIX);
+   SET_FragmentLightfvSGIX(table, trace_FragmentLightfvSGIX);
+   SET_FragmentLightiSGIX(table, trace_FragmentLightiSGIX);
+   SET_FragmentLightivSGIX(table, trace_FragmentLightivSGIX);
+   SET_FragmentLightModelfSGIX(table, trace_FragmentLightModelfSGIX);
+   SET_FragmentLightModelfvSGIX(table, trace_FragmentLightModelfvSGIX);
+   SET_FragmentLightModeliSGIX(table, trace_FragmentLightModeliSGIX);
+   SET_FragmentLightModelivSGIX(table, trace_FragmentLightModelivSGIX);
+   SET_FragmentMaterialfSGIX(table, trace_FragmentMaterialfSGIX);
+   SET_FragmentMaterialfvSGIX(table, trace_FragmentMaterialfvSGIX);
+   SET_FragmentMaterialiSGIX(table, trace_FragmentMaterialiSGIX);
+   SET_FragmentMaterialivSGIX(table, trace_FragmentMaterialivSGIX);
+   SET_GetFragmentLightfvSGIX(table, trace_GetFragmentLightfvSGIX);
+   SET_GetFragmentLightivSGIX(table, trace_GetFragmentLightivSGIX);
+   SET_GetFragmentMaterialfvSGIX(table, trace_GetFragmentMaterialfvSGIX);
+   SET_GetFragmentMaterialivSGIX(table, trace_GetFragmentMaterialivSGIX);
+   SET_LightEnviSGIX(table, trace_LightEnviSGIX);
+   SET_VertexWeightfEXT(table, trace_VertexWeightfEXT);
+   SET_VertexWeightfvEXT(table, trace_VertexWeightfvEXT);
+   SET_VertexWeightPointerEXT(table, trace_VertexWeightPointerEXT);
+   SET_FlushVertexArrayRangeNV(table, trace_FlushVertexArrayRangeNV);
+   SET_VertexArrayRangeNV(table, trace_VertexArrayRangeNV);
+   SET_CombinerParameterfvNV(table, trace_CombinerParameterfvNV);
+   SET_CombinerParameterfNV(table, trace_CombinerParameterfNV);
+   SET_CombinerParameterivNV(table, trace_CombinerParameterivNV);
+   SET_CombinerParameteriNV(table, trace_CombinerParameteriNV);
+   SET_CombinerInputNV(table, trace_CombinerInputNV);
+   SET_CombinerOutputNV(table, trace_CombinerOutputNV);
+   SET_FinalCombinerInputNV(table, trace_FinalCombinerInputNV);
+   SET_GetCombinerInputParameterfvNV(table, trace_GetCombinerInputParameterfvNV);
+   SET_GetCombinerInputParameterivNV(table, trace_GetCombinerInputParameterivNV);
+   SET_GetCombinerOutputParameterfvNV(table, trace_GetCombinerOutputParameterfvNV);
+   SET_GetCombinerOutputParameterivNV(table, trace_GetCombinerOutputParameterivNV);
+   SET_GetFinalCombinerInputParameterfvNV(table, trace_GetFinalCombinerInputParameterfvNV);
+   SET_GetFinalCombinerInputParameterivNV(table, trace_GetFinalCombinerInputParameterivNV);
+   SET_ResizeBuffersMESA(table, trace_ResizeBuffersMESA);
+   SET_WindowPos2dMESA(table, trace_WindowPos2dMESA);
+   SET_WindowPos2dvMESA(table, trace_WindowPos2dvMESA);
+   SET_WindowPos2fMESA(table, trace_WindowPos2fMESA);
+   SET_WindowPos2fvMESA(table, trace_WindowPos2fvMESA);
+   SET_WindowPos2iMESA(table, trace_WindowPos2iMESA);
+   SET_WindowPos2ivMESA(table, trace_WindowPos2ivMESA);
+   SET_WindowPos2sMESA(table, trace_WindowPos2sMESA);
+   SET_WindowPos2svMESA(table, trace_WindowPos2svMESA);
+   SET_WindowPos3dMESA(table, trace_WindowPos3dMESA);
+   SET_WindowPos3dvMESA(table, trace_WindowPos3dvMESA);
+   SET_WindowPos3fMESA(table, trace_WindowPos3fMESA);
+   SET_WindowPos3fvMESA(table, trace_WindowPos3fvMESA);
+   SET_WindowPos3iMESA(table, trace_WindowPos3iMESA);
+   SET_WindowPos3ivMESA(table, trace_WindowPos3ivMESA);
+   SET_WindowPos3sMESA(table, trace_WindowPos3sMESA);
+   SET_WindowPos3svMESA(table, trace_WindowPos3svMESA);
+   SET_WindowPos4dMESA(table, trace_WindowPos4dMESA);
+   SET_WindowPos4dvMESA(table, trace_WindowPos4dvMESA);
+   SET_WindowPos4fMESA(table, trace_WindowPos4fMESA);
+   SET_WindowPos4fvMESA(table, trace_WindowPos4fvMESA);
+   SET_WindowPos4iMESA(table, trace_WindowPos4iMESA);
+   SET_WindowPos4ivMESA(table, trace_WindowPos4ivMESA);
+   SET_WindowPos4sMESA(table, trace_WindowPos4sMESA);
+   SET_WindowPos4svMESA(table, trace_WindowPos4svMESA);
+   SET_BlendFuncSeparateEXT(table, trace_BlendFuncSeparateEXT);
+   SET_IndexMaterialEXT(table, trace_IndexMaterialEXT);
+   SET_IndexFuncEXT(table, trace_IndexFuncEXT);
+   SET_LockArraysEXT(table, trace_LockArraysEXT);
+   SET_UnlockArraysEXT(table, trace_UnlockArraysEXT);
+   SET_CullParameterdvEXT(table, trace_CullParameterdvEXT);
+   SET_CullParameterfvEXT(table, trace_CullParameterfvEXT);
+   SET_HintPGI(table, trace_HintPGI);
+   SET_FogCoordfEXT(table, trace_FogCoordfEXT);
+   SET_FogCoordfvEXT(table, trace_FogCoordfvEXT);
+   SET_FogCoorddEXT(table, trace_FogCoorddEXT);
+   SET_FogCoorddvEXT(table, trace_FogCoorddvEXT);
+   SET_FogCoordPointerEXT(table, trace_FogCoordPointerEXT);
+   SET_GetColorTableEXT(table, trace_GetColorTableEXT);
+   SET_GetColorTableParameterivEXT(table, trace_GetColorTableParameterivEXT);
+   SET_GetColorTableParameterfvEXT(table, trace_GetColorTableParameterfvEXT);
+   SET_TbufferMask3DFX(table, trace_TbufferMask3DFX);
+   SET_CompressedTexImage3DARB(table, trace_CompressedTexImage3DARB);
+   SET_CompressedTexImage2DARB(table, trace_CompressedTexImage2DARB);
+   SET_CompressedTexImage1DARB(table, trace_CompressedTexImage1DARB);
+   SET_CompressedTexSubImage3DARB(table, trace_CompressedTexSubImage3DARB);
+   SET_CompressedTexSubImage2DARB(table, trace_CompressedTexSubImage2DARB);
+   SET_CompressedTexSubImage1DARB(table, trace_CompressedTexSubImage1DARB);
+   SET_GetCompressedTexImageARB(table, trace_GetCompressedTexImageARB);
+   SET_SecondaryColor3bEXT(table, trace_SecondaryColor3bEXT);
+   SET_SecondaryColor3bvEXT(table, trace_SecondaryColor3bvEXT);
+   SET_SecondaryColor3dEXT(table, trace_SecondaryColor3dEXT);
+   SET_SecondaryColor3dvEXT(table, trace_SecondaryColor3dvEXT);
+   SET_SecondaryColor3fEXT(table, trace_SecondaryColor3fEXT);
+   SET_SecondaryColor3fvEXT(table, trace_SecondaryColor3fvEXT);
+   SET_SecondaryColor3iEXT(table, trace_SecondaryColor3iEXT);
+   SET_SecondaryColor3ivEXT(table, trace_SecondaryColor3ivEXT);
+   SET_SecondaryColor3sEXT(table, trace_SecondaryColor3sEXT);
+   SET_SecondaryColor3svEXT(table, trace_SecondaryColor3svEXT);
+   SET_SecondaryColor3ubEXT(table, trace_SecondaryColor3ubEXT);
+   SET_SecondaryColor3ubvEXT(table, trace_SecondaryColor3ubvEXT);
+   SET_SecondaryColor3uiEXT(table, trace_SecondaryColor3uiEXT);
+   SET_SecondaryColor3uivEXT(table, trace_SecondaryColor3uivEXT);
+   SET_SecondaryColor3usEXT(table, trace_SecondaryColor3usEXT);
+   SET_SecondaryColor3usvEXT(table, trace_SecondaryColor3usvEXT);
+   SET_SecondaryColorPointerEXT(table, trace_SecondaryColorPointerEXT);
+   SET_AreProgramsResidentNV(table, trace_AreProgramsResidentNV);
+   SET_BindProgramNV(table, trace_BindProgramNV);
+   SET_DeleteProgramsNV(table, trace_DeleteProgramsNV);
+   SET_ExecuteProgramNV(table, trace_ExecuteProgramNV);
+   SET_GenProgramsNV(table, trace_GenProgramsNV);
+   SET_GetProgramParameterdvNV(table, trace_GetProgramParameterdvNV);
+   SET_GetProgramParameterfvNV(table, trace_GetProgramParameterfvNV);
+   SET_GetProgramivNV(table, trace_GetProgramivNV);
+   SET_GetProgramStringNV(table, trace_GetProgramStringNV);
+   SET_GetTrackMatrixivNV(table, trace_GetTrackMatrixivNV);
+   SET_GetVertexAttribdvARB(table, trace_GetVertexAttribdvARB);
+   SET_GetVertexAttribfvARB(table, trace_GetVertexAttribfvARB);
+   SET_GetVertexAttribivARB(table, trace_GetVertexAttribivARB);
+   SET_GetVertexAttribPointervNV(table, trace_GetVertexAttribPointervNV);
+   SET_IsProgramNV(table, trace_IsProgramNV);
+   SET_LoadProgramNV(table, trace_LoadProgramNV);
+   SET_ProgramParameter4dNV(table, trace_ProgramParameter4dNV);
+   SET_ProgramParameter4dvNV(table, trace_ProgramParameter4dvNV);
+   SET_ProgramParameter4fNV(table, trace_ProgramParameter4fNV);
+   SET_ProgramParameter4fvNV(table, trace_ProgramParameter4fvNV);
+   SET_ProgramParameters4dvNV(table, trace_ProgramParameters4dvNV);
+   SET_ProgramParameters4fvNV(table, trace_ProgramParameters4fvNV);
+   SET_RequestResidentProgramsNV(table, trace_RequestResidentProgramsNV);
+   SET_TrackMatrixNV(table, trace_TrackMatrixNV);
+   SET_VertexAttribPointerNV(table, trace_VertexAttribPointerNV);
+   SET_VertexAttrib1dARB(table, trace_VertexAttrib1dARB);
+   SET_VertexAttrib1dvARB(table, trace_VertexAttrib1dvARB);
+   SET_VertexAttrib1fARB(table, trace_VertexAttrib1fARB);
+   SET_VertexAttrib1fvARB(table, trace_VertexAttrib1fvARB);
+   SET_VertexAttrib1sARB(table, trace_VertexAttrib1sARB);
+   SET_VertexAttrib1svARB(table, trace_VertexAttrib1svARB);
+   SET_VertexAttrib2dARB(table, trace_VertexAttrib2dARB);
+   SET_VertexAttrib2dvARB(table, trace_VertexAttrib2dvARB);
+   SET_VertexAttrib2fARB(table, trace_VertexAttrib2fARB);
+   SET_VertexAttrib2fvARB(table, trace_VertexAttrib2fvARB);
+   SET_VertexAttrib2sARB(table, trace_VertexAttrib2sARB);
+   SET_VertexAttrib2svARB(table, trace_VertexAttrib2svARB);
+   SET_VertexAttrib3dARB(table, trace_VertexAttrib3dARB);
+   SET_VertexAttrib3dvARB(table, trace_VertexAttrib3dvARB);
+   SET_VertexAttrib3fARB(table, trace_VertexAttrib3fARB);
+   SET_VertexAttrib3fvARB(table, trace_VertexAttrib3fvARB);
+   SET_VertexAttrib3sARB(table, trace_VertexAttrib3sARB);
+   SET_VertexAttrib3svARB(table, trace_VertexAttrib3svARB);
+   SET_VertexAttrib4dARB(table, trace_VertexAttrib4dARB);
+   SET_VertexAttrib4dvARB(table, trace_VertexAttrib4dvARB);
+   SET_VertexAttrib4fARB(table, trace_VertexAttrib4fARB);
+   SET_VertexAttrib4fvARB(table, trace_VertexAttrib4fvARB);
+   SET_VertexAttrib4sARB(table, trace_VertexAttrib4sARB);
+   SET_VertexAttrib4svARB(table, trace_VertexAttrib4svARB);
+   SET_VertexAttrib4NubARB(table, trace_VertexAttrib4NubARB);
+   SET_VertexAttrib4NubvARB(table, trace_VertexAttrib4NubvARB);
+   SET_VertexAttribs1dvNV(table, trace_VertexAttribs1dvNV);
+   SET_VertexAttribs1fvNV(table, trace_VertexAttribs1fvNV);
+   SET_VertexAttribs1svNV(table, trace_VertexAttribs1svNV);
+   SET_VertexAttribs2dvNV(table, trace_VertexAttribs2dvNV);
+   SET_VertexAttribs2fvNV(table, trace_VertexAttribs2fvNV);
+   SET_VertexAttribs2svNV(table, trace_VertexAttribs2svNV);
+   SET_VertexAttribs3dvNV(table, trace_VertexAttribs3dvNV);
+   SET_VertexAttribs3fvNV(table, trace_VertexAttribs3fvNV);
+   SET_VertexAttribs3svNV(table, trace_VertexAttribs3svNV);
+   SET_VertexAttribs4dvNV(table, trace_VertexAttribs4dvNV);
+   SET_VertexAttribs4fvNV(table, trace_VertexAttribs4fvNV);
+   SET_VertexAttribs4svNV(table, trace_VertexAttribs4svNV);
+   SET_VertexAttribs4ubvNV(table, trace_VertexAttribs4ubvNV);
+   SET_PointParameteriNV(table, trace_PointParameteriNV);
+   SET_PointParameterivNV(table, trace_PointParameterivNV);
+   SET_MultiDrawArraysEXT(table, trace_MultiDrawArraysEXT);
+   SET_MultiDrawElementsEXT(table, trace_MultiDrawElementsEXT);
+   SET_ActiveStencilFaceEXT(table, trace_ActiveStencilFaceEXT);
+   SET_DeleteFencesNV(table, trace_DeleteFencesNV);
+   SET_GenFencesNV(table, trace_GenFencesNV);
+   SET_IsFenceNV(table, trace_IsFenceNV);
+   SET_TestFenceNV(table, trace_TestFenceNV);
+   SET_GetFenceivNV(table, trace_GetFenceivNV);
+   SET_FinishFenceNV(table, trace_FinishFenceNV);
+   SET_SetFenceNV(table, trace_SetFenceNV);
+   SET_VertexAttrib4bvARB(table, trace_VertexAttrib4bvARB);
+   SET_VertexAttrib4ivARB(table, trace_VertexAttrib4ivARB);
+   SET_VertexAttrib4ubvARB(table, trace_VertexAttrib4ubvARB);
+   SET_VertexAttrib4usvARB(table, trace_VertexAttrib4usvARB);
+   SET_VertexAttrib4uivARB(table, trace_VertexAttrib4uivARB);
+   SET_VertexAttrib4NbvARB(table, trace_VertexAttrib4NbvARB);
+   SET_VertexAttrib4NsvARB(table, trace_VertexAttrib4NsvARB);
+   SET_VertexAttrib4NivARB(table, trace_VertexAttrib4NivARB);
+   SET_VertexAttrib4NusvARB(table, trace_VertexAttrib4NusvARB);
+   SET_VertexAttrib4NuivARB(table, trace_VertexAttrib4NuivARB);
+   SET_VertexAttribPointerARB(table, trace_VertexAttribPointerARB);
+   SET_EnableVertexAttribArrayARB(table, trace_EnableVertexAttribArrayARB);
+   SET_DisableVertexAttribArrayARB(table, trace_DisableVertexAttribArrayARB);
+   SET_ProgramStringARB(table, trace_ProgramStringARB);
+   SET_ProgramEnvParameter4dARB(table, trace_ProgramEnvParameter4dARB);
+   SET_ProgramEnvParameter4dvARB(table, trace_ProgramEnvParameter4dvARB);
+   SET_ProgramEnvParameter4fARB(table, trace_ProgramEnvParameter4fARB);
+   SET_ProgramEnvParameter4fvARB(table, trace_ProgramEnvParameter4fvARB);
+   SET_ProgramLocalParameter4dARB(table, trace_ProgramLocalParameter4dARB);
+   SET_ProgramLocalParameter4dvARB(table, trace_ProgramLocalParameter4dvARB);
+   SET_ProgramLocalParameter4fARB(table, trace_ProgramLocalParameter4fARB);
+   SET_ProgramLocalParameter4fvARB(table, trace_ProgramLocalParameter4fvARB);
+   SET_GetProgramEnvParameterdvARB(table, trace_GetProgramEnvParameterdvARB);
+   SET_GetProgramEnvParameterfvARB(table, trace_GetProgramEnvParameterfvARB);
+   SET_GetProgramLocalParameterdvARB(table, trace_GetProgramLocalParameterdvARB);
+   SET_GetProgramLocalParameterfvARB(table, trace_GetProgramLocalParameterfvARB);
+   SET_GetProgramivARB(table, trace_GetProgramivARB);
+   SET_GetProgramStringARB(table, trace_GetProgramStringARB);
+   SET_ProgramNamedParameter4fNV(table, trace_ProgramNamedParameter4fNV);
+   SET_ProgramNamedParameter4dNV(table, trace_ProgramNamedParameter4dNV);
+   SET_ProgramNamedParameter4fvNV(table, trace_ProgramNamedParameter4fvNV);
+   SET_ProgramNamedParameter4dvNV(table, trace_ProgramNamedParameter4dvNV);
+   SET_GetProgramNamedParameterfvNV(table, trace_GetProgramNamedParameterfvNV);
+   SET_GetProgramNamedParameterdvNV(table, trace_GetProgramNamedParameterdvNV);
+   SET_BindBufferARB(table, trace_BindBufferARB);
+   SET_BufferDataARB(table, trace_BufferDataARB);
+   SET_BufferSubDataARB(table, trace_BufferSubDataARB);
+   SET_DeleteBuffersARB(table, trace_DeleteBuffersARB);
+   SET_GenBuffersARB(table, trace_GenBuffersARB);
+   SET_GetBufferParameterivARB(table, trace_GetBufferParameterivARB);
+   SET_GetBufferPointervARB(table, trace_GetBufferPointervARB);
+   SET_GetBufferSubDataARB(table, trace_GetBufferSubDataARB);
+   SET_IsBufferARB(table, trace_IsBufferARB);
+   SET_MapBufferARB(table, trace_MapBufferARB);
+   SET_UnmapBufferARB(table, trace_UnmapBufferARB);
+   SET_DepthBoundsEXT(table, trace_DepthBoundsEXT);
+   SET_GenQueriesARB(table, trace_GenQueriesARB);
+   SET_DeleteQueriesARB(table, trace_DeleteQueriesARB);
+   SET_IsQueryARB(table, trace_IsQueryARB);
+   SET_BeginQueryARB(table, trace_BeginQueryARB);
+   SET_EndQueryARB(table, trace_EndQueryARB);
+   SET_GetQueryivARB(table, trace_GetQueryivARB);
+   SET_GetQueryObjectivARB(table, trace_GetQueryObjectivARB);
+   SET_GetQueryObjectuivARB(table, trace_GetQueryObjectuivARB);
+   SET_MultiModeDrawArraysIBM(table, trace_MultiModeDrawArraysIBM);
+   SET_MultiModeDrawElementsIBM(table, trace_MultiModeDrawElementsIBM);
+   SET_BlendEquationSeparateEXT(table, trace_BlendEquationSeparateEXT);
+   SET_DeleteObjectARB(table, trace_DeleteObjectARB);
+   SET_GetHandleARB(table, trace_GetHandleARB);
+   SET_DetachObjectARB(table, trace_DetachObjectARB);
+   SET_CreateShaderObjectARB(table, trace_CreateShaderObjectARB);
+   SET_ShaderSourceARB(table, trace_ShaderSourceARB);
+   SET_CompileShaderARB(table, trace_CompileShaderARB);
+   SET_CreateProgramObjectARB(table, trace_CreateProgramObjectARB);
+   SET_AttachObjectARB(table, trace_AttachObjectARB);
+   SET_LinkProgramARB(table, trace_LinkProgramARB);
+   SET_UseProgramObjectARB(table, trace_UseProgramObjectARB);
+   SET_ValidateProgramARB(table, trace_ValidateProgramARB);
+   SET_Uniform1fARB(table, trace_Uniform1fARB);
+   SET_Uniform2fARB(table, trace_Uniform2fARB);
+   SET_Uniform3fARB(table, trace_Uniform3fARB);
+   SET_Uniform4fARB(table, trace_Uniform4fARB);
+   SET_Uniform1iARB(table, trace_Uniform1iARB);
+   SET_Uniform2iARB(table, trace_Uniform2iARB);
+   SET_Uniform3iARB(table, trace_Uniform3iARB);
+   SET_Uniform4iARB(table, trace_Uniform4iARB);
+   SET_Uniform1fvARB(table, trace_Uniform1fvARB);
+   SET_Uniform2fvARB(table, trace_Uniform2fvARB);
+   SET_Uniform3fvARB(table, trace_Uniform3fvARB);
+   SET_Uniform4fvARB(table, trace_Uniform4fvARB);
+   SET_Uniform1ivARB(table, trace_Uniform1ivARB);
+   SET_Uniform2ivARB(table, trace_Uniform2ivARB);
+   SET_Uniform3ivARB(table, trace_Uniform3ivARB);
+   SET_Uniform4ivARB(table, trace_Uniform4ivARB);
+   SET_UniformMatrix2fvARB(table, trace_UniformMatrix2fvARB);
+   SET_UniformMatrix3fvARB(table, trace_UniformMatrix3fvARB);
+   SET_UniformMatrix4fvARB(table, trace_UniformMatrix4fvARB);
+   SET_GetObjectParameterfvARB(table, trace_GetObjectParameterfvARB);
+   SET_GetObjectParameterivARB(table, trace_GetObjectParameterivARB);
+   SET_GetInfoLogARB(table, trace_GetInfoLogARB);
+   SET_GetAttachedObjectsARB(table, trace_GetAttachedObjectsARB);
+   SET_GetUniformLocationARB(table, trace_GetUniformLocationARB);
+   SET_GetActiveUniformARB(table, trace_GetActiveUniformARB);
+   SET_GetUniformfvARB(table, trace_GetUniformfvARB);
+   SET_GetUniformivARB(table, trace_GetUniformivARB);
+   SET_GetShaderSourceARB(table, trace_GetShaderSourceARB);
+   SET_BindAttribLocationARB(table, trace_BindAttribLocationARB);
+   SET_GetActiveAttribARB(table, trace_GetActiveAttribARB);
+   SET_GetAttribLocationARB(table, trace_GetAttribLocationARB);
+   SET_GetVertexAttribdvNV(table, trace_GetVertexAttribdvNV);
+   SET_GetVertexAttribfvNV(table, trace_GetVertexAttribfvNV);
+   SET_GetVertexAttribivNV(table, trace_GetVertexAttribivNV);
+   SET_VertexAttrib1dNV(table, trace_VertexAttrib1dNV);
+   SET_VertexAttrib1dvNV(table, trace_VertexAttrib1dvNV);
+   SET_VertexAttrib1fNV(table, trace_VertexAttrib1fNV);
+   SET_VertexAttrib1fvNV(table, trace_VertexAttrib1fvNV);
+   SET_VertexAttrib1sNV(table, trace_VertexAttrib1sNV);
+   SET_VertexAttrib1svNV(table, trace_VertexAttrib1svNV);
+   SET_VertexAttrib2dNV(table, trace_VertexAttrib2dNV);
+   SET_VertexAttrib2dvNV(table, trace_VertexAttrib2dvNV);
+   SET_VertexAttrib2fNV(table, trace_VertexAttrib2fNV);
+   SET_VertexAttrib2fvNV(table, trace_VertexAttrib2fvNV);
+   SET_VertexAttrib2sNV(table, trace_VertexAttrib2sNV);
+   SET_VertexAttrib2svNV(table, trace_VertexAttrib2svNV);
+   SET_VertexAttrib3dNV(table, trace_VertexAttrib3dNV);
+   SET_VertexAttrib3dvNV(table, trace_VertexAttrib3dvNV);
+   SET_VertexAttrib3fNV(table, trace_VertexAttrib3fNV);
+   SET_VertexAttrib3fvNV(table, trace_VertexAttrib3fvNV);
+   SET_VertexAttrib3sNV(table, trace_VertexAttrib3sNV);
+   SET_VertexAttrib3svNV(table, trace_VertexAttrib3svNV);
+   SET_VertexAttrib4dNV(table, trace_VertexAttrib4dNV);
+   SET_VertexAttrib4dvNV(table, trace_VertexAttrib4dvNV);
+   SET_VertexAttrib4fNV(table, trace_VertexAttrib4fNV);
+   SET_VertexAttrib4fvNV(table, trace_VertexAttrib4fvNV);
+   SET_VertexAttrib4sNV(table, trace_VertexAttrib4sNV);
+   SET_VertexAttrib4svNV(table, trace_VertexAttrib4svNV);
+   SET_VertexAttrib4ubNV(table, trace_VertexAttrib4ubNV);
+   SET_VertexAttrib4ubvNV(table, trace_VertexAttrib4ubvNV);
+   SET_GenFragmentShadersATI(table, trace_GenFragmentShadersATI);
+   SET_BindFragmentShaderATI(table, trace_BindFragmentShaderATI);
+   SET_DeleteFragmentShaderATI(table, trace_DeleteFragmentShaderATI);
+   SET_BeginFragmentShaderATI(table, trace_BeginFragmentShaderATI);
+   SET_EndFragmentShaderATI(table, trace_EndFragmentShaderATI);
+   SET_PassTexCoordATI(table, trace_PassTexCoordATI);
+   SET_SampleMapATI(table, trace_SampleMapATI);
+   SET_ColorFragmentOp1ATI(table, trace_ColorFragmentOp1ATI);
+   SET_ColorFragmentOp2ATI(table, trace_ColorFragmentOp2ATI);
+   SET_ColorFragmentOp3ATI(table, trace_ColorFragmentOp3ATI);
+   SET_AlphaFragmentOp1ATI(table, trace_AlphaFragmentOp1ATI);
+   SET_AlphaFragmentOp2ATI(table, trace_AlphaFragmentOp2ATI);
+   SET_AlphaFragmentOp3ATI(table, trace_AlphaFragmentOp3ATI);
+   SET_SetFragmentShaderConstantATI(table, trace_SetFragmentShaderConstantATI);
+   SET_IsRenderbufferEXT(table, trace_IsRenderbufferEXT);
+   SET_BindRenderbufferEXT(table, trace_BindRenderbufferEXT);
+   SET_DeleteRenderbuffersEXT(table, trace_DeleteRenderbuffersEXT);
+   SET_GenRenderbuffersEXT(table, trace_GenRenderbuffersEXT);
+   SET_RenderbufferStorageEXT(table, trace_RenderbufferStorageEXT);
+   SET_GetRenderbufferParameterivEXT(table, trace_GetRenderbufferParameterivEXT);
+   SET_IsFramebufferEXT(table, trace_IsFramebufferEXT);
+   SET_BindFramebufferEXT(table, trace_BindFramebufferEXT);
+   SET_DeleteFramebuffersEXT(table, trace_DeleteFramebuffersEXT);
+   SET_GenFramebuffersEXT(table, trace_GenFramebuffersEXT);
+   SET_CheckFramebufferStatusEXT(table, trace_CheckFramebufferStatusEXT);
+   SET_FramebufferTexture1DEXT(table, trace_FramebufferTexture1DEXT);
+   SET_FramebufferTexture2DEXT(table, trace_FramebufferTexture2DEXT);
+   SET_FramebufferTexture3DEXT(table, trace_FramebufferTexture3DEXT);
+   SET_FramebufferRenderbufferEXT(table, trace_FramebufferRenderbufferEXT);
+   SET_GetFramebufferAttachmentParameterivEXT(table, trace_GetFramebufferAttachmentParameterivEXT);
+   SET_GenerateMipmapEXT(table, trace_GenerateMipmapEXT);
+   SET_StencilFuncSeparate(table, trace_StencilFuncSeparate);
+   SET_StencilOpSeparate(table, trace_StencilOpSeparate);
+   SET_StencilMaskSeparate(table, trace_StencilMaskSeparate);
+}
+
+#endif /* TRACE_FUNCTIONS */
@@ -24,6 +24,7 @@
 
 #include "glheader.h"
 #include "api_validate.h"
+#include "bufferobj.h"
 #include "context.h"
 #include "imports.h"
 #include "mtypes.h"
@@ -59,6 +60,9 @@ _mesa_validate_DrawElements(GLcontext *ctx,
    if (ctx->NewState)
       _mesa_update_state(ctx);
 
+   /* the arrays may be in buffers which glReadPixels is still writing */
+   _mesa_wait_array_buffers(ctx, GL_TRUE);
+
    /* Always need vertex positions */
    if (!ctx->Array.Vertex.Enabled
        && !(ctx->VertexProgram._Enabled && ctx->Array.VertexAttrib[0].Enabled))
@@ -165,6 +169,8 @@ _mesa_validate_DrawRangeElements(GLcontext *ctx, GLenum mode,
    if (ctx->NewState)
       _mesa_update_state(ctx);
 
+   _mesa_wait_array_buffers(ctx, GL_TRUE);
+
    /* Always need vertex positions */
    if (!ctx->Array.Vertex.Enabled
        && !(ctx->VertexProgram._Enabled && ctx->Array.VertexAttrib[0].Enabled))
@@ -225,6 +231,8 @@ _mesa_validate_DrawArrays(GLcontext *ctx,
    if (ctx->NewState)
       _mesa_update_state(ctx);
 
+   _mesa_wait_array_buffers(ctx, GL_FALSE);
+
    /* Always need vertex positions */
    if (!ctx->Array.Vertex.Enabled && !ctx->Array.VertexAttrib[0].Enabled)
       return GL_FALSE;
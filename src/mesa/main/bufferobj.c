@@ -38,6 +38,204 @@
 #include "bufferobj.h"
 
 
+/**
+ * Deferred buffer writes.
+ *
+ * Some operations which write into a buffer object, such as glReadPixels
+ * into a pixel pack buffer, can capture their input quickly but need more
+ * time to produce the buffer contents.  They may hand that second half to
+ * _mesa_defer_buffer_write(), which runs it on a helper thread (when the
+ * platform has WORKER_THREADS) and returns at once.  Every path which
+ * reads, writes, reallocates or frees the buffer's Data must call
+ * _mesa_wait_buffer_object() first.  The fallback Driver functions in this
+ * file do so, and the draw validation in api_validate.c waits for the
+ * vertex and element buffers.  Jobs run one at a time and in order, so
+ * writes from successive operations can't overtake each other.
+ *
+ * PendingWrites is only accessed with DeferredMutex held.  WritesQueued
+ * is set when a job is queued and cleared once PendingWrites is zero, both
+ * also under DeferredMutex.  The wait reads it without the mutex to skip
+ * buffers with nothing queued; a job queued by another thread which that
+ * read misses isn't ordered with the caller's commands anyway.
+ */
+
+#ifdef WORKER_THREADS
+
+struct deferred_write {
+   struct deferred_write *next;
+   struct gl_buffer_object *bufObj;
+   void (*func)( void *data );
+   void *data;
+};
+
+_glthread_DECLARE_STATIC_MUTEX(DeferredMutex);
+static _glthread_Cond DeferredJobReady;  /**< signalled when a job is queued */
+static _glthread_Cond DeferredJobDone;   /**< broadcast when a job completes */
+static _glthread_Thread DeferredThread;
+static struct deferred_write *DeferredHead = NULL, *DeferredTail = NULL;
+static GLuint DeferredQueued = 0;        /**< queued or running jobs */
+static GLboolean DeferredStarted = GL_FALSE;
+
+
+static void *
+deferred_write_thread( void *unused )
+{
+   (void) unused;
+
+   _glthread_LOCK_MUTEX(DeferredMutex);
+   for (;;) {
+      struct deferred_write *job;
+
+      while (!DeferredHead)
+         _glthread_WAIT_COND(DeferredJobReady, DeferredMutex);
+
+      job = DeferredHead;
+      _glthread_UNLOCK_MUTEX(DeferredMutex);
+
+      job->func(job->data);
+
+      _glthread_LOCK_MUTEX(DeferredMutex);
+      DeferredHead = job->next;
+      if (!DeferredHead)
+         DeferredTail = NULL;
+      job->bufObj->PendingWrites--;
+      DeferredQueued--;
+      _glthread_BROADCAST_COND(DeferredJobDone);
+      _mesa_free(job);
+   }
+   return NULL;
+}
+
+#endif /* WORKER_THREADS */
+
+
+/**
+ * Run func(data) to update the contents of bufObj, possibly on another
+ * thread.  The caller must not touch bufObj->Data afterwards, and func
+ * must not use any GL state which the application could change in the
+ * meantime.
+ */
+void
+_mesa_defer_buffer_write( struct gl_buffer_object *bufObj,
+                          void (*func)( void *data ), void *data )
+{
+#ifdef WORKER_THREADS
+   struct deferred_write *job = MALLOC_STRUCT(deferred_write);
+
+   _glthread_LOCK_MUTEX(DeferredMutex);
+   if (job && !DeferredStarted) {
+      _glthread_INIT_COND(DeferredJobReady);
+      _glthread_INIT_COND(DeferredJobDone);
+      DeferredStarted = _glthread_CREATE_THREAD(DeferredThread,
+                                                deferred_write_thread, NULL);
+   }
+   if (job && DeferredStarted) {
+      job->next = NULL;
+      job->bufObj = bufObj;
+      job->func = func;
+      job->data = data;
+      if (DeferredTail)
+         DeferredTail->next = job;
+      else
+         DeferredHead = job;
+      DeferredTail = job;
+      bufObj->PendingWrites++;
+      bufObj->WritesQueued = GL_TRUE;
+      DeferredQueued++;
+      _glthread_SIGNAL_COND(DeferredJobReady);
+      _glthread_UNLOCK_MUTEX(DeferredMutex);
+      return;
+   }
+   _glthread_UNLOCK_MUTEX(DeferredMutex);
+   if (job)
+      _mesa_free(job);
+   /* couldn't queue it, wait for earlier jobs and do it here */
+   _mesa_wait_buffer_object(bufObj);
+#endif
+   (void) bufObj;
+   func(data);
+}
+
+
+/**
+ * Wait until all deferred writes to the buffer object have completed.
+ */
+void
+_mesa_wait_buffer_object( struct gl_buffer_object *bufObj )
+{
+#ifdef WORKER_THREADS
+   if (!bufObj->WritesQueued)
+      return;
+   _glthread_LOCK_MUTEX(DeferredMutex);
+   while (bufObj->PendingWrites)
+      _glthread_WAIT_COND(DeferredJobDone, DeferredMutex);
+   bufObj->WritesQueued = GL_FALSE;
+   _glthread_UNLOCK_MUTEX(DeferredMutex);
+#else
+   (void) bufObj;
+#endif
+}
+
+
+/**
+ * Wait for the deferred writes to the buffer objects of the enabled vertex
+ * arrays, and to the element array buffer if \p elements is set.  Called
+ * before drawing, since the array code reads their Data directly.
+ */
+void
+_mesa_wait_array_buffers( GLcontext *ctx, GLboolean elements )
+{
+#ifdef WORKER_THREADS
+   struct gl_array_attrib *array = &ctx->Array;
+   GLuint i;
+
+   if (array->Vertex.Enabled)
+      _mesa_wait_buffer_object(array->Vertex.BufferObj);
+   if (array->Normal.Enabled)
+      _mesa_wait_buffer_object(array->Normal.BufferObj);
+   if (array->Color.Enabled)
+      _mesa_wait_buffer_object(array->Color.BufferObj);
+   if (array->SecondaryColor.Enabled)
+      _mesa_wait_buffer_object(array->SecondaryColor.BufferObj);
+   if (array->FogCoord.Enabled)
+      _mesa_wait_buffer_object(array->FogCoord.BufferObj);
+   if (array->Index.Enabled)
+      _mesa_wait_buffer_object(array->Index.BufferObj);
+   if (array->EdgeFlag.Enabled)
+      _mesa_wait_buffer_object(array->EdgeFlag.BufferObj);
+   for (i = 0; i < MAX_TEXTURE_COORD_UNITS; i++) {
+      if (array->TexCoord[i].Enabled)
+         _mesa_wait_buffer_object(array->TexCoord[i].BufferObj);
+   }
+   for (i = 0; i < VERT_ATTRIB_MAX; i++) {
+      if (array->VertexAttrib[i].Enabled)
+         _mesa_wait_buffer_object(array->VertexAttrib[i].BufferObj);
+   }
+   if (elements)
+      _mesa_wait_buffer_object(array->ElementArrayBufferObj);
+#else
+   (void) ctx;
+   (void) elements;
+#endif
+}
+
+
+/**
+ * Wait until all deferred buffer writes have completed.  Called before
+ * a context goes away, since jobs may refer to it.
+ */
+void
+_mesa_finish_buffer_writes( void )
+{
+#ifdef WORKER_THREADS
+   _glthread_LOCK_MUTEX(DeferredMutex);
+   while (DeferredQueued)
+      _glthread_WAIT_COND(DeferredJobDone, DeferredMutex);
+   _glthread_UNLOCK_MUTEX(DeferredMutex);
+#endif
+}
+
+
 /**
  * Get the buffer object bound to the specified target in a GL context.
  *
@@ -163,6 +361,7 @@ _mesa_delete_buffer_object( GLcontext *ctx, struct gl_buffer_object *bufObj )
 {
    (void) ctx;
 
+   _mesa_wait_buffer_object(bufObj);
    if (bufObj->Data)
       _mesa_free(bufObj->Data);
    _mesa_free(bufObj);
@@ -241,6 +440,7 @@ _mesa_buffer_data( GLcontext *ctx, GLenum target, GLsizeiptrARB size,
 
    (void) ctx; (void) target;
 
+   _mesa_wait_buffer_object(bufObj);
    new_data = _mesa_realloc( bufObj->Data, bufObj->Size, size );
    if (new_data) {
       bufObj->Data = (GLubyte *) new_data;
@@ -279,6 +479,7 @@ _mesa_buffer_subdata( GLcontext *ctx, GLenum target, GLintptrARB offset,
 {
    (void) ctx; (void) target;
 
+   _mesa_wait_buffer_object(bufObj);
    if (bufObj->Data && ((GLuint) (size + offset) <= bufObj->Size)) {
       _mesa_memcpy( (GLubyte *) bufObj->Data + offset, data, size );
    }
@@ -310,6 +511,7 @@ _mesa_buffer_get_subdata( GLcontext *ctx, GLenum target, GLintptrARB offset,
 {
    (void) ctx; (void) target;
 
+   _mesa_wait_buffer_object(bufObj);
    if (bufObj->Data && ((GLsizeiptrARB) (size + offset) <= bufObj->Size)) {
       _mesa_memcpy( data, (GLubyte *) bufObj->Data + offset, size );
    }
@@ -345,6 +547,7 @@ _mesa_buffer_map( GLcontext *ctx, GLenum target, GLenum access,
       /* already mapped! */
       return NULL;
    }
+   _mesa_wait_buffer_object(bufObj);
    bufObj->Pointer = bufObj->Data;
    return bufObj->Pointer;
 }
@@ -77,6 +77,19 @@ extern GLboolean
 _mesa_buffer_unmap( GLcontext *ctx, GLenum target,
                     struct gl_buffer_object * bufObj );
 
+extern void
+_mesa_defer_buffer_write( struct gl_buffer_object *bufObj,
+                          void (*func)( void *data ), void *data );
+
+extern void
+_mesa_wait_buffer_object( struct gl_buffer_object *bufObj );
+
+extern void
+_mesa_wait_array_buffers( GLcontext *ctx, GLboolean elements );
+
+extern void
+_mesa_finish_buffer_writes( void );
+
 extern GLboolean
 _mesa_validate_pbo_access(GLuint dimensions,
                           const struct gl_pixelstore_attrib *pack,
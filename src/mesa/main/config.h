@@ -133,6 +133,9 @@
 /** Maximum viewport/image height */
 #define MAX_HEIGHT 4096
 
+/** Maximum number of rectangles tracked in a framebuffer's damage list */
+#define MAX_DAMAGE_RECTS 16
+
 /** Maxmimum size for CVA.  May be overridden by the drivers.  */
 #define MAX_ARRAY_LOCK_SIZE 3000
 
@@ -194,6 +197,8 @@
 #define MAX_PROGRAM_LOCAL_PARAMS 128 /* KW: power of two */
 #define MAX_PROGRAM_MATRICES 8
 #define MAX_PROGRAM_MATRIX_STACK_DEPTH 4
+/** Default number of generated texenv / fixed-function programs kept */
+#define MAX_PROGRAM_CACHE_ITEMS 64
 /*@}*/
 
 /** For GL_ARB_fragment_shader */
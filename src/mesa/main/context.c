@@ -79,6 +79,8 @@
 #include "glheader.h"
 #include "imports.h"
 #include "accum.h"
+#include "api_marshal.h"
+#include "api_trace.h"
 #include "attrib.h"
 #include "blend.h"
 #include "buffers.h"
@@ -328,6 +330,7 @@ void
 _mesa_notifySwapBuffers(__GLcontext *gc)
 {
    FLUSH_VERTICES( gc, 0 );
+   _mesa_trace_swap( gc );
 }
 
 /** No-op */
@@ -985,6 +988,7 @@ _mesa_init_constants( GLcontext *ctx )
 
    ctx->Const.MaxProgramMatrices = MAX_PROGRAM_MATRICES;
    ctx->Const.MaxProgramMatrixStackDepth = MAX_PROGRAM_MATRIX_STACK_DEPTH;
+   ctx->Const.MaxProgramCacheItems = MAX_PROGRAM_CACHE_ITEMS;
 
    /* If we're running in the X server, do bounds checking to prevent
     * segfaults and server crashes!
@@ -1091,24 +1095,41 @@ generic_nop(void)
 
 
 /**
- * Allocate and initialize a new dispatch table.
+ * Number of entries in a dispatch table.
  */
-static struct _glapi_table *
-alloc_dispatch_table(void)
+static GLint
+dispatch_table_size(void)
 {
    /* Find the larger of Mesa's dispatch table and libGL's dispatch table.
     * In practice, this'll be the same for stand-alone Mesa.  But for DRI
     * Mesa we do this to accomodate different versions of libGL and various
     * DRI drivers.
     */
-   GLint numEntries = MAX2(_glapi_get_dispatch_table_size(),
-                           sizeof(struct _glapi_table) / sizeof(_glapi_proc));
+   return MAX2(_glapi_get_dispatch_table_size(),
+               sizeof(struct _glapi_table) / sizeof(_glapi_proc));
+}
+
+
+/**
+ * Allocate and initialize a new dispatch table.
+ *
+ * \param source  a table of \p sourceEntries entries to copy from, or NULL.
+ *                Entries it doesn't have are set to the no-op function.
+ */
+static struct _glapi_table *
+alloc_dispatch_table(const struct _glapi_table *source, GLint sourceEntries)
+{
+   GLint numEntries = dispatch_table_size();
    struct _glapi_table *table =
       (struct _glapi_table *) _mesa_malloc(numEntries * sizeof(_glapi_proc));
    if (table) {
       _glapi_proc *entry = (_glapi_proc *) table;
-      GLint i;
-      for (i = 0; i < numEntries; i++) {
+      GLint i = 0;
+      if (source) {
+         i = MIN2(numEntries, sourceEntries);
+         _mesa_memcpy(entry, source, i * sizeof(_glapi_proc));
+      }
+      for (; i < numEntries; i++) {
          entry[i] = (_glapi_proc) generic_nop;
       }
    }
@@ -1116,6 +1137,52 @@ alloc_dispatch_table(void)
 }
 
 
+/**
+ * The tables built by _mesa_init_exec_table() and _mesa_init_dlist_table()
+ * don't depend on the context.  They're built once, for the first context,
+ * and copied into every context after that.  They live until exit.
+ */
+static struct _glapi_table *ExecTemplate = NULL;
+static struct _glapi_table *SaveTemplate = NULL;
+static GLint TemplateEntries = 0;
+
+
+/**
+ * Build the template dispatch tables if that hasn't been done yet.
+ *
+ * \return GL_FALSE if out of memory.
+ */
+static GLboolean
+init_dispatch_templates(void)
+{
+   GLboolean ok;
+
+   _glthread_LOCK_MUTEX(OneTimeLock);
+   if (!ExecTemplate) {
+      struct _glapi_table *exec = alloc_dispatch_table(NULL, 0);
+      struct _glapi_table *save = alloc_dispatch_table(NULL, 0);
+      if (exec && save) {
+         _mesa_init_exec_table(exec);
+#if _HAVE_FULL_GL
+         _mesa_init_dlist_table(save);
+#endif
+         TemplateEntries = dispatch_table_size();
+         SaveTemplate = save;
+         ExecTemplate = exec;
+      }
+      else {
+         if (exec)
+            _mesa_free(exec);
+         if (save)
+            _mesa_free(save);
+      }
+   }
+   ok = (ExecTemplate != NULL);
+   _glthread_UNLOCK_MUTEX(OneTimeLock);
+   return ok;
+}
+
+
 /**
  * Initialize a GLcontext struct (rendering context).
  *
@@ -1198,17 +1265,20 @@ _mesa_initialize_context( GLcontext *ctx,
    }
 
    /* setup the API dispatch tables */
-   ctx->Exec = alloc_dispatch_table();
-   ctx->Save = alloc_dispatch_table();
+   if (init_dispatch_templates()) {
+      ctx->Exec = alloc_dispatch_table(ExecTemplate, TemplateEntries);
+      ctx->Save = alloc_dispatch_table(SaveTemplate, TemplateEntries);
+   }
    if (!ctx->Exec || !ctx->Save) {
       free_shared_state(ctx, ctx->Shared);
       if (ctx->Exec)
          _mesa_free(ctx->Exec);
+      if (ctx->Save)
+         _mesa_free(ctx->Save);
+      return GL_FALSE;
    }
-   _mesa_init_exec_table(ctx->Exec);
    ctx->CurrentDispatch = ctx->Exec;
 #if _HAVE_FULL_GL
-   _mesa_init_dlist_table(ctx->Save);
    _mesa_install_save_vtxfmt( ctx, &ctx->ListState.ListVtxfmt );
    /* Neutral tnl module stuff */
    _mesa_init_exec_vtxfmt( ctx ); 
@@ -1218,6 +1288,9 @@ _mesa_initialize_context( GLcontext *ctx,
 
    ctx->_MaintainTexEnvProgram = (_mesa_getenv("MESA_TEX_PROG") != NULL);
    ctx->_MaintainTnlProgram = (_mesa_getenv("MESA_TNL_PROG") != NULL);
+   if (_mesa_getenv("MESA_PROGRAM_CACHE_ITEMS"))
+      ctx->Const.MaxProgramCacheItems =
+         _mesa_atoi(_mesa_getenv("MESA_PROGRAM_CACHE_ITEMS"));
 
    return GL_TRUE;
 }
@@ -1279,6 +1352,15 @@ _mesa_free_context_data( GLcontext *ctx )
       _mesa_make_current(NULL, NULL, NULL);
    }
 
+   /* execute any recorded commands and stop the worker thread */
+   _mesa_marshal_destroy( ctx );
+   _mesa_trace_destroy( ctx );
+
+#if FEATURE_ARB_vertex_buffer_object
+   /* deferred buffer writes may still refer to this context */
+   _mesa_finish_buffer_writes();
+#endif
+
    _mesa_free_lighting_data( ctx );
    _mesa_free_eval_data( ctx );
    _mesa_free_texture_data( ctx );
@@ -1344,6 +1426,10 @@ _mesa_destroy_context( GLcontext *ctx )
 void
 _mesa_copy_context( const GLcontext *src, GLcontext *dst, GLuint mask )
 {
+   /* let worker threads finish changing the state */
+   _mesa_marshal_finish((GLcontext *) src);
+   _mesa_marshal_finish(dst);
+
    if (mask & GL_ACCUM_BUFFER_BIT) {
       /* OK to memcpy */
       dst->Accum = src->Accum;
@@ -1378,7 +1464,7 @@ _mesa_copy_context( const GLcontext *src, GLcontext *dst, GLuint mask )
    if (mask & GL_LIGHTING_BIT) {
       GLuint i;
       /* begin with memcpy */
-      MEMCPY( &dst->Light, &src->Light, sizeof(struct gl_light) );
+      MEMCPY( &dst->Light, &src->Light, sizeof(struct gl_light_attrib) );
       /* fixup linked lists to prevent pointer insanity */
       make_empty_list( &(dst->Light.EnabledList) );
       for (i = 0; i < MAX_LIGHTS; i++) {
@@ -1528,6 +1614,16 @@ _mesa_make_current( GLcontext *newCtx, GLframebuffer *drawBuffer,
          return;
    }
 
+   /* Commands recorded for a worker thread must be executed while the
+    * context is still bound to the old buffers.
+    */
+   {
+      GET_CURRENT_CONTEXT(oldCtx);
+      _mesa_marshal_finish(oldCtx);
+      if (newCtx != oldCtx)
+         _mesa_marshal_finish(newCtx);
+   }
+
 #if !defined(IN_DRI_DRIVER)
    /* We call this function periodically (just here for now) in
     * order to detect when multithreading has begun.  In a DRI driver, this
@@ -1611,6 +1707,14 @@ _mesa_make_current( GLcontext *newCtx, GLframebuffer *drawBuffer,
 	 }
 	 newCtx->FirstTimeCurrent = GL_FALSE;
       }
+
+      /* From now on, record this thread's commands for the worker, or
+       * into the trace file
+       */
+      if (newCtx->Marshal)
+         _mesa_marshal_make_current(newCtx);
+      if (newCtx->TraceId)
+         _mesa_trace_make_current(newCtx, 0, 0);
    }
 }
 
@@ -1095,6 +1095,206 @@ convolve_1d_replicate(GLint srcWidth, const GLfloat src[][4],
 }
 
 
+/*
+ * Accumulate one row of a convolution:
+ *    dest[i] += src[i + n] * filter[n]   for n in [0, filterWidth)
+ * There are no border tests in here; the inner loop walks contiguous
+ * memory so that the compiler can keep all four components in SIMD
+ * registers.  Callers pad the source (see pad_image()) when needed.
+ */
+static void
+accumulate_row(GLint width, const GLfloat src[][4],
+               GLint filterWidth, const GLfloat filter[][4],
+               GLfloat dest[][4])
+{
+   GLint i, n;
+
+   for (n = 0; n < filterWidth; n++) {
+      const GLfloat fr = filter[n][RCOMP];
+      const GLfloat fg = filter[n][GCOMP];
+      const GLfloat fb = filter[n][BCOMP];
+      const GLfloat fa = filter[n][ACOMP];
+      const GLfloat (*s)[4] = src + n;
+      for (i = 0; i < width; i++) {
+         dest[i][RCOMP] += s[i][RCOMP] * fr;
+         dest[i][GCOMP] += s[i][GCOMP] * fg;
+         dest[i][BCOMP] += s[i][BCOMP] * fb;
+         dest[i][ACOMP] += s[i][ACOMP] * fa;
+      }
+   }
+}
+
+
+/*
+ * A band of rows of a convolution with no border handling: rows
+ * [first, last) of dest are computed from rows [first, last + filterHeight
+ * - 1) of src.  The passes of a separable convolution are jobs with a
+ * filter height or width of one.
+ */
+struct convolve_job {
+   GLint srcWidth, dstWidth;
+   const GLfloat (*src)[4];
+   GLint filterWidth, filterHeight;
+   const GLfloat (*filter)[4];
+   GLfloat (*dest)[4];
+};
+
+
+static void
+convolve_rows(const struct convolve_job *job, GLint first, GLint last)
+{
+   GLint j, m;
+
+   for (j = first; j < last; j++) {
+      GLfloat (*dstRow)[4] = job->dest + j * job->dstWidth;
+      _mesa_bzero(dstRow, job->dstWidth * 4 * sizeof(GLfloat));
+      for (m = 0; m < job->filterHeight; m++) {
+         accumulate_row(job->dstWidth, job->src + (j + m) * job->srcWidth,
+                        job->filterWidth, job->filter + m * job->filterWidth,
+                        dstRow);
+      }
+   }
+}
+
+
+#ifdef WORKER_THREADS
+
+#include <unistd.h>
+
+#define MAX_CONVOLVE_THREADS 8
+
+/** Multiply-adds below which a job isn't worth handing to the workers */
+#define MIN_THREADED_WORK (1 << 20)
+
+/*
+ * Big jobs are split into bands of rows which a pool of worker threads and
+ * the calling thread take in turn.  The workers are started the first
+ * time a job is big enough, and then wait for the next job.  The pool runs
+ * one job at a time; a job which comes along while it's busy, such as one
+ * from another context's thread, is done by its caller alone.
+ *
+ * All the variables below are only accessed with ConvolveMutex held.
+ */
+_glthread_DECLARE_STATIC_MUTEX(ConvolveMutex);
+static _glthread_Cond ConvolveBandsReady; /**< broadcast when a job is posted */
+static _glthread_Cond ConvolveJobDone;    /**< signalled by the last band */
+static GLint ConvolveThreads = 0;   /**< workers + 1, 0 until initialized */
+static GLboolean ConvolveBusy = GL_FALSE;
+static const struct convolve_job *ConvolveJob;
+static GLint ConvolveRows;
+static GLint ConvolveBands = 0;     /**< bands of the current job */
+static GLint ConvolveNextBand = 0;  /**< first band nobody has taken yet */
+static GLint ConvolveBandsLeft = 0; /**< bands not completed yet */
+
+
+/*
+ * Take the next band of the current job and compute it.  Called and
+ * returns with ConvolveMutex held.
+ */
+static void
+convolve_next_band(void)
+{
+   const struct convolve_job *job = ConvolveJob;
+   const GLint band = ConvolveNextBand++;
+   const GLint first = ConvolveRows * band / ConvolveBands;
+   const GLint last = ConvolveRows * (band + 1) / ConvolveBands;
+
+   _glthread_UNLOCK_MUTEX(ConvolveMutex);
+   convolve_rows(job, first, last);
+   _glthread_LOCK_MUTEX(ConvolveMutex);
+
+   if (--ConvolveBandsLeft == 0)
+      _glthread_SIGNAL_COND(ConvolveJobDone);
+}
+
+
+static void *
+convolve_worker_thread(void *unused)
+{
+   (void) unused;
+
+   _glthread_LOCK_MUTEX(ConvolveMutex);
+   for (;;) {
+      while (ConvolveNextBand >= ConvolveBands)
+         _glthread_WAIT_COND(ConvolveBandsReady, ConvolveMutex);
+      convolve_next_band();
+   }
+   return NULL;
+}
+
+
+/*
+ * Start the worker threads, one fewer than MESA_CONVOLVE_THREADS or the
+ * number of processors.  Called with ConvolveMutex held.
+ */
+static void
+convolve_init_threads(void)
+{
+   const char *env = _mesa_getenv("MESA_CONVOLVE_THREADS");
+   GLint n = 1, i;
+
+   if (env)
+      n = _mesa_atoi(env);
+#ifdef _SC_NPROCESSORS_ONLN
+   else
+      n = (GLint) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+   n = CLAMP(n, 1, MAX_CONVOLVE_THREADS);
+
+   _glthread_INIT_COND(ConvolveBandsReady);
+   _glthread_INIT_COND(ConvolveJobDone);
+   for (i = 1; i < n; i++) {
+      _glthread_Thread thread;
+      if (!_glthread_CREATE_THREAD(thread, convolve_worker_thread, NULL))
+         break;
+   }
+   ConvolveThreads = i;
+}
+
+#endif /* WORKER_THREADS */
+
+
+/*
+ * Compute rows [0, rows) of a job, on the worker threads too if it's big
+ * enough.
+ */
+static void
+run_convolve_job(const struct convolve_job *job, GLint rows)
+{
+#ifdef WORKER_THREADS
+   const GLdouble work = (GLdouble) rows * job->dstWidth *
+      job->filterWidth * job->filterHeight;
+
+   if (work >= MIN_THREADED_WORK && rows >= 32) {
+      _glthread_LOCK_MUTEX(ConvolveMutex);
+      if (ConvolveThreads == 0)
+         convolve_init_threads();
+      if (ConvolveThreads > 1 && !ConvolveBusy) {
+         ConvolveBusy = GL_TRUE;
+         ConvolveJob = job;
+         ConvolveRows = rows;
+         ConvolveBands = MIN2(ConvolveThreads, rows / 16);
+         ConvolveNextBand = 0;
+         ConvolveBandsLeft = ConvolveBands;
+         _glthread_BROADCAST_COND(ConvolveBandsReady);
+
+         while (ConvolveNextBand < ConvolveBands)
+            convolve_next_band();
+         while (ConvolveBandsLeft)
+            _glthread_WAIT_COND(ConvolveJobDone, ConvolveMutex);
+
+         ConvolveBands = ConvolveNextBand = 0;
+         ConvolveBusy = GL_FALSE;
+         _glthread_UNLOCK_MUTEX(ConvolveMutex);
+         return;
+      }
+      _glthread_UNLOCK_MUTEX(ConvolveMutex);
+   }
+#endif
+   convolve_rows(job, 0, rows);
+}
+
+
 static void
 convolve_2d_reduce(GLint srcWidth, GLint srcHeight,
                    const GLfloat src[][4],
@@ -1102,8 +1302,8 @@ convolve_2d_reduce(GLint srcWidth, GLint srcHeight,
                    const GLfloat filter[][4],
                    GLfloat dest[][4])
 {
+   struct convolve_job job;
    GLint dstWidth, dstHeight;
-   GLint i, j, n, m;
 
    if (filterWidth >= 1)
       dstWidth = srcWidth - (filterWidth - 1);
@@ -1118,31 +1318,21 @@ convolve_2d_reduce(GLint srcWidth, GLint srcHeight,
    if (dstWidth <= 0 || dstHeight <= 0)
       return;
 
-   for (j = 0; j < dstHeight; j++) {
-      for (i = 0; i < dstWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
-         for (m = 0; m < filterHeight; m++) {
-            for (n = 0; n < filterWidth; n++) {
-               const GLint k = (j + m) * srcWidth + i + n;
-               const GLint f = m * filterWidth + n;
-               sumR += src[k][RCOMP] * filter[f][RCOMP];
-               sumG += src[k][GCOMP] * filter[f][GCOMP];
-               sumB += src[k][BCOMP] * filter[f][BCOMP];
-               sumA += src[k][ACOMP] * filter[f][ACOMP];
-            }
-         }
-         dest[j * dstWidth + i][RCOMP] = sumR;
-         dest[j * dstWidth + i][GCOMP] = sumG;
-         dest[j * dstWidth + i][BCOMP] = sumB;
-         dest[j * dstWidth + i][ACOMP] = sumA;
-      }
-   }
+   job.srcWidth = srcWidth;
+   job.dstWidth = dstWidth;
+   job.src = src;
+   job.filterWidth = filterWidth;
+   job.filterHeight = filterHeight;
+   job.filter = filter;
+   job.dest = dest;
+   run_convolve_job(&job, dstHeight);
 }
 
 
+/*
+ * The following two functions are only used when there's not enough
+ * memory for a padded copy of the source image (see pad_image()).
+ */
 static void
 convolve_2d_constant(GLint srcWidth, GLint srcHeight,
                      const GLfloat src[][4],
@@ -1238,6 +1428,92 @@ convolve_2d_replicate(GLint srcWidth, GLint srcHeight,
 }
 
 
+/*
+ * Expand a separable filter into the equivalent 2D filter.
+ */
+static void
+expand_sep_filter(GLint filterWidth, GLint filterHeight,
+                  const GLfloat rowFilt[][4], const GLfloat colFilt[][4],
+                  GLfloat filter[][4])
+{
+   GLint n, m;
+   for (m = 0; m < filterHeight; m++) {
+      for (n = 0; n < filterWidth; n++) {
+         const GLint f = m * filterWidth + n;
+         filter[f][RCOMP] = rowFilt[n][RCOMP] * colFilt[m][RCOMP];
+         filter[f][GCOMP] = rowFilt[n][GCOMP] * colFilt[m][GCOMP];
+         filter[f][BCOMP] = rowFilt[n][BCOMP] * colFilt[m][BCOMP];
+         filter[f][ACOMP] = rowFilt[n][ACOMP] * colFilt[m][ACOMP];
+      }
+   }
+}
+
+
+/*
+ * If each component of the 2D filter is the outer product of a column
+ * vector and a row vector (i.e. the filter has rank one), compute those
+ * vectors and return GL_TRUE.  Box, tent and gaussian blurs all fall in
+ * this category and can then go through the separable path, which costs
+ * O(filterWidth + filterHeight) per pixel instead of
+ * O(filterWidth * filterHeight).
+ */
+static GLboolean
+factor_2d_filter(GLint filterWidth, GLint filterHeight,
+                 const GLfloat filter[][4],
+                 GLfloat rowFilt[][4], GLfloat colFilt[][4])
+{
+   GLuint c;
+   GLint n, m;
+
+   for (c = 0; c < 4; c++) {
+      GLfloat maxAbs = 0.0F, pivot;
+      GLint pm = 0, pn = 0;
+
+      /* pick the largest element as pivot for best accuracy */
+      for (m = 0; m < filterHeight; m++) {
+         for (n = 0; n < filterWidth; n++) {
+            const GLfloat a = FABSF(filter[m * filterWidth + n][c]);
+            if (a > maxAbs) {
+               maxAbs = a;
+               pm = m;
+               pn = n;
+            }
+         }
+      }
+
+      if (maxAbs == 0.0F) {
+         /* all zero */
+         for (n = 0; n < filterWidth; n++)
+            rowFilt[n][c] = 0.0F;
+         for (m = 0; m < filterHeight; m++)
+            colFilt[m][c] = 0.0F;
+         continue;
+      }
+
+      pivot = filter[pm * filterWidth + pn][c];
+      for (n = 0; n < filterWidth; n++)
+         rowFilt[n][c] = filter[pm * filterWidth + n][c];
+      for (m = 0; m < filterHeight; m++)
+         colFilt[m][c] = filter[m * filterWidth + pn][c] / pivot;
+
+      for (m = 0; m < filterHeight; m++) {
+         for (n = 0; n < filterWidth; n++) {
+            const GLfloat f = filter[m * filterWidth + n][c];
+            if (FABSF(f - colFilt[m][c] * rowFilt[n][c]) > maxAbs * 1.0e-6F)
+               return GL_FALSE;
+         }
+      }
+   }
+
+   return GL_TRUE;
+}
+
+
+/*
+ * Separable convolution in two passes: the rows are convolved with the
+ * row filter into a temporary image, which is then convolved with the
+ * column filter.
+ */
 static void
 convolve_sep_reduce(GLint srcWidth, GLint srcHeight,
                     const GLfloat src[][4],
@@ -1246,8 +1522,9 @@ convolve_sep_reduce(GLint srcWidth, GLint srcHeight,
                     const GLfloat colFilt[][4],
                     GLfloat dest[][4])
 {
+   struct convolve_job job;
    GLint dstWidth, dstHeight;
-   GLint i, j, n, m;
+   GLfloat (*tmp)[4];
 
    if (filterWidth >= 1)
       dstWidth = srcWidth - (filterWidth - 1);
@@ -1262,122 +1539,183 @@ convolve_sep_reduce(GLint srcWidth, GLint srcHeight,
    if (dstWidth <= 0 || dstHeight <= 0)
       return;
 
-   for (j = 0; j < dstHeight; j++) {
-      for (i = 0; i < dstWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
-         for (m = 0; m < filterHeight; m++) {
-            for (n = 0; n < filterWidth; n++) {
-               GLint k = (j + m) * srcWidth + i + n;
-               sumR += src[k][RCOMP] * rowFilt[n][RCOMP] * colFilt[m][RCOMP];
-               sumG += src[k][GCOMP] * rowFilt[n][GCOMP] * colFilt[m][GCOMP];
-               sumB += src[k][BCOMP] * rowFilt[n][BCOMP] * colFilt[m][BCOMP];
-               sumA += src[k][ACOMP] * rowFilt[n][ACOMP] * colFilt[m][ACOMP];
-            }
-         }
-         dest[j * dstWidth + i][RCOMP] = sumR;
-         dest[j * dstWidth + i][GCOMP] = sumG;
-         dest[j * dstWidth + i][BCOMP] = sumB;
-         dest[j * dstWidth + i][ACOMP] = sumA;
-      }
+   tmp = (GLfloat (*)[4])
+      _mesa_malloc(dstWidth * srcHeight * 4 * sizeof(GLfloat));
+   if (!tmp) {
+      /* do it the slow way */
+      GLfloat filter[MAX_CONVOLUTION_WIDTH * MAX_CONVOLUTION_HEIGHT][4];
+      expand_sep_filter(filterWidth, filterHeight, rowFilt, colFilt, filter);
+      convolve_2d_reduce(srcWidth, srcHeight, src,
+                         filterWidth, filterHeight,
+                         (const GLfloat (*)[4]) filter, dest);
+      return;
    }
+
+   /* horizontal pass */
+   job.srcWidth = srcWidth;
+   job.dstWidth = dstWidth;
+   job.src = src;
+   job.filterWidth = filterWidth;
+   job.filterHeight = 1;
+   job.filter = rowFilt;
+   job.dest = tmp;
+   run_convolve_job(&job, srcHeight);
+
+   /* vertical pass: a column tap is a one-element row filter */
+   job.srcWidth = dstWidth;
+   job.src = (const GLfloat (*)[4]) tmp;
+   job.filterWidth = 1;
+   job.filterHeight = filterHeight;
+   job.filter = colFilt;
+   job.dest = dest;
+   run_convolve_job(&job, dstHeight);
+
+   _mesa_free(tmp);
 }
 
 
-static void
-convolve_sep_constant(GLint srcWidth, GLint srcHeight,
-                      const GLfloat src[][4],
-                      GLint filterWidth, GLint filterHeight,
-                      const GLfloat rowFilt[][4],
-                      const GLfloat colFilt[][4],
-                      GLfloat dest[][4],
-                      const GLfloat borderColor[4])
+/*
+ * Return a copy of the source image surrounded by the border pixels which
+ * GL_CONSTANT_BORDER or GL_REPLICATE_BORDER imply for a filter of the
+ * given size.  Convolving the padded image with the GL_REDUCE functions
+ * yields an image of the original size, without any per-pixel border
+ * tests.  Return NULL if out of memory.
+ */
+static GLfloat *
+pad_image(GLint srcWidth, GLint srcHeight, const GLfloat src[][4],
+          GLint filterWidth, GLint filterHeight,
+          GLenum borderMode, const GLfloat borderColor[4])
 {
    const GLint halfFilterWidth = filterWidth / 2;
    const GLint halfFilterHeight = filterHeight / 2;
-   GLint i, j, n, m;
-
-   for (j = 0; j < srcHeight; j++) {
-      for (i = 0; i < srcWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
-         for (m = 0; m < filterHeight; m++) {
-            for (n = 0; n < filterWidth; n++) {
-               const GLint is = i + n - halfFilterWidth;
-               const GLint js = j + m - halfFilterHeight;
-               if (is < 0 || is >= srcWidth ||
-                   js < 0 || js >= srcHeight) {
-                  sumR += borderColor[RCOMP] * rowFilt[n][RCOMP] * colFilt[m][RCOMP];
-                  sumG += borderColor[GCOMP] * rowFilt[n][GCOMP] * colFilt[m][GCOMP];
-                  sumB += borderColor[BCOMP] * rowFilt[n][BCOMP] * colFilt[m][BCOMP];
-                  sumA += borderColor[ACOMP] * rowFilt[n][ACOMP] * colFilt[m][ACOMP];
-               }
-               else {
-                  GLint k = js * srcWidth + is;
-                  sumR += src[k][RCOMP] * rowFilt[n][RCOMP] * colFilt[m][RCOMP];
-                  sumG += src[k][GCOMP] * rowFilt[n][GCOMP] * colFilt[m][GCOMP];
-                  sumB += src[k][BCOMP] * rowFilt[n][BCOMP] * colFilt[m][BCOMP];
-                  sumA += src[k][ACOMP] * rowFilt[n][ACOMP] * colFilt[m][ACOMP];
-               }
-
+   const GLint padWidth = srcWidth + MAX2(filterWidth, 1) - 1;
+   const GLint padHeight = srcHeight + MAX2(filterHeight, 1) - 1;
+   GLfloat (*padded)[4];
+   GLint i, j;
+
+   padded = (GLfloat (*)[4])
+      _mesa_malloc(padWidth * padHeight * 4 * sizeof(GLfloat));
+   if (!padded)
+      return NULL;
+
+   for (j = 0; j < padHeight; j++) {
+      GLfloat (*dst)[4] = padded + j * padWidth;
+      GLint js = j - halfFilterHeight;
+      if (js < 0 || js >= srcHeight) {
+         if (borderMode == GL_CONSTANT_BORDER) {
+            for (i = 0; i < padWidth; i++) {
+               COPY_4V(dst[i], borderColor);
             }
+            continue;
          }
-         dest[j * srcWidth + i][RCOMP] = sumR;
-         dest[j * srcWidth + i][GCOMP] = sumG;
-         dest[j * srcWidth + i][BCOMP] = sumB;
-         dest[j * srcWidth + i][ACOMP] = sumA;
+         js = CLAMP(js, 0, srcHeight - 1);
+      }
+      for (i = 0; i < padWidth; i++) {
+         GLint is = i - halfFilterWidth;
+         if (is < 0 || is >= srcWidth) {
+            if (borderMode == GL_CONSTANT_BORDER) {
+               COPY_4V(dst[i], borderColor);
+               continue;
+            }
+            is = CLAMP(is, 0, srcWidth - 1);
+         }
+         COPY_4V(dst[i], src[js * srcWidth + is]);
       }
    }
+
+   return (GLfloat *) padded;
 }
 
 
+/*
+ * Common code for 2D convolution with any border mode.
+ */
 static void
-convolve_sep_replicate(GLint srcWidth, GLint srcHeight,
-                       const GLfloat src[][4],
-                       GLint filterWidth, GLint filterHeight,
-                       const GLfloat rowFilt[][4],
-                       const GLfloat colFilt[][4],
-                       GLfloat dest[][4])
+convolve_2d(GLsizei *width, GLsizei *height, const GLfloat src[][4],
+            GLint filterWidth, GLint filterHeight, const GLfloat filter[][4],
+            GLfloat dest[][4], GLenum borderMode, const GLfloat borderColor[4])
 {
-   const GLint halfFilterWidth = filterWidth / 2;
-   const GLint halfFilterHeight = filterHeight / 2;
-   GLint i, j, n, m;
+   switch (borderMode) {
+      case GL_REDUCE:
+         convolve_2d_reduce(*width, *height, src,
+                            filterWidth, filterHeight, filter, dest);
+         *width = *width - (MAX2(filterWidth, 1) - 1);
+         *height = *height - (MAX2(filterHeight, 1) - 1);
+         break;
+      case GL_CONSTANT_BORDER:
+      case GL_REPLICATE_BORDER:
+         {
+            GLfloat *padded = pad_image(*width, *height, src,
+                                        filterWidth, filterHeight,
+                                        borderMode, borderColor);
+            if (padded) {
+               convolve_2d_reduce(*width + MAX2(filterWidth, 1) - 1,
+                                  *height + MAX2(filterHeight, 1) - 1,
+                                  (const GLfloat (*)[4]) padded,
+                                  filterWidth, filterHeight, filter, dest);
+               _mesa_free(padded);
+            }
+            else if (borderMode == GL_CONSTANT_BORDER) {
+               convolve_2d_constant(*width, *height, src,
+                                    filterWidth, filterHeight, filter,
+                                    dest, borderColor);
+            }
+            else {
+               convolve_2d_replicate(*width, *height, src,
+                                     filterWidth, filterHeight, filter,
+                                     dest);
+            }
+         }
+         break;
+      default:
+         ;
+   }
+}
 
-   for (j = 0; j < srcHeight; j++) {
-      for (i = 0; i < srcWidth; i++) {
-         GLfloat sumR = 0.0;
-         GLfloat sumG = 0.0;
-         GLfloat sumB = 0.0;
-         GLfloat sumA = 0.0;
-         for (m = 0; m < filterHeight; m++) {
-            for (n = 0; n < filterWidth; n++) {
-               GLint is = i + n - halfFilterWidth;
-               GLint js = j + m - halfFilterHeight;
-               GLint k;
-               if (is < 0)
-                  is = 0;
-               else if (is >= srcWidth)
-                  is = srcWidth - 1;
-               if (js < 0)
-                  js = 0;
-               else if (js >= srcHeight)
-                  js = srcHeight - 1;
-               k = js * srcWidth + is;
-               sumR += src[k][RCOMP] * rowFilt[n][RCOMP] * colFilt[m][RCOMP];
-               sumG += src[k][GCOMP] * rowFilt[n][GCOMP] * colFilt[m][GCOMP];
-               sumB += src[k][BCOMP] * rowFilt[n][BCOMP] * colFilt[m][BCOMP];
-               sumA += src[k][ACOMP] * rowFilt[n][ACOMP] * colFilt[m][ACOMP];
+
+/*
+ * Common code for separable convolution with any border mode.
+ */
+static void
+convolve_sep(GLsizei *width, GLsizei *height, const GLfloat src[][4],
+             GLint filterWidth, GLint filterHeight,
+             const GLfloat rowFilt[][4], const GLfloat colFilt[][4],
+             GLfloat dest[][4], GLenum borderMode,
+             const GLfloat borderColor[4])
+{
+   switch (borderMode) {
+      case GL_REDUCE:
+         convolve_sep_reduce(*width, *height, src, filterWidth, filterHeight,
+                             rowFilt, colFilt, dest);
+         *width = *width - (MAX2(filterWidth, 1) - 1);
+         *height = *height - (MAX2(filterHeight, 1) - 1);
+         break;
+      case GL_CONSTANT_BORDER:
+      case GL_REPLICATE_BORDER:
+         {
+            GLfloat *padded = pad_image(*width, *height, src,
+                                        filterWidth, filterHeight,
+                                        borderMode, borderColor);
+            if (padded) {
+               convolve_sep_reduce(*width + MAX2(filterWidth, 1) - 1,
+                                   *height + MAX2(filterHeight, 1) - 1,
+                                   (const GLfloat (*)[4]) padded,
+                                   filterWidth, filterHeight,
+                                   rowFilt, colFilt, dest);
+               _mesa_free(padded);
+            }
+            else {
+               GLfloat filter[MAX_CONVOLUTION_WIDTH * MAX_CONVOLUTION_HEIGHT][4];
+               expand_sep_filter(filterWidth, filterHeight,
+                                 rowFilt, colFilt, filter);
+               convolve_2d(width, height, src, filterWidth, filterHeight,
+                           (const GLfloat (*)[4]) filter, dest,
+                           borderMode, borderColor);
             }
          }
-         dest[j * srcWidth + i][RCOMP] = sumR;
-         dest[j * srcWidth + i][GCOMP] = sumG;
-         dest[j * srcWidth + i][BCOMP] = sumB;
-         dest[j * srcWidth + i][ACOMP] = sumA;
-      }
+         break;
+      default:
+         ;
    }
 }
 
@@ -1418,37 +1756,29 @@ void
 _mesa_convolve_2d_image(const GLcontext *ctx, GLsizei *width, GLsizei *height,
                         const GLfloat *srcImage, GLfloat *dstImage)
 {
-   switch (ctx->Pixel.ConvolutionBorderMode[1]) {
-      case GL_REDUCE:
-         convolve_2d_reduce(*width, *height,
-                            (const GLfloat (*)[4]) srcImage,
-                            ctx->Convolution2D.Width,
-                            ctx->Convolution2D.Height,
-                            (const GLfloat (*)[4]) ctx->Convolution2D.Filter,
-                            (GLfloat (*)[4]) dstImage);
-         *width = *width - (MAX2(ctx->Convolution2D.Width, 1) - 1);
-         *height = *height - (MAX2(ctx->Convolution2D.Height, 1) - 1);
-         break;
-      case GL_CONSTANT_BORDER:
-         convolve_2d_constant(*width, *height,
-                              (const GLfloat (*)[4]) srcImage,
-                              ctx->Convolution2D.Width,
-                              ctx->Convolution2D.Height,
-                              (const GLfloat (*)[4]) ctx->Convolution2D.Filter,
-                              (GLfloat (*)[4]) dstImage,
-                              ctx->Pixel.ConvolutionBorderColor[1]);
-         break;
-      case GL_REPLICATE_BORDER:
-         convolve_2d_replicate(*width, *height,
-                               (const GLfloat (*)[4]) srcImage,
-                               ctx->Convolution2D.Width,
-                               ctx->Convolution2D.Height,
-                               (const GLfloat (*)[4])ctx->Convolution2D.Filter,
-                               (GLfloat (*)[4]) dstImage);
-         break;
-      default:
-         ;
-      }
+   const GLint filterWidth = ctx->Convolution2D.Width;
+   const GLint filterHeight = ctx->Convolution2D.Height;
+   const GLfloat (*filter)[4] = (const GLfloat (*)[4]) ctx->Convolution2D.Filter;
+   GLfloat rowFilt[MAX_CONVOLUTION_WIDTH][4];
+   GLfloat colFilt[MAX_CONVOLUTION_HEIGHT][4];
+
+   if (filterWidth > 1 && filterHeight > 1 &&
+       factor_2d_filter(filterWidth, filterHeight, filter, rowFilt, colFilt)) {
+      convolve_sep(width, height, (const GLfloat (*)[4]) srcImage,
+                   filterWidth, filterHeight,
+                   (const GLfloat (*)[4]) rowFilt,
+                   (const GLfloat (*)[4]) colFilt,
+                   (GLfloat (*)[4]) dstImage,
+                   ctx->Pixel.ConvolutionBorderMode[1],
+                   ctx->Pixel.ConvolutionBorderColor[1]);
+   }
+   else {
+      convolve_2d(width, height, (const GLfloat (*)[4]) srcImage,
+                  filterWidth, filterHeight, filter,
+                  (GLfloat (*)[4]) dstImage,
+                  ctx->Pixel.ConvolutionBorderMode[1],
+                  ctx->Pixel.ConvolutionBorderColor[1]);
+   }
 }
 
 
@@ -1460,40 +1790,13 @@ _mesa_convolve_sep_image(const GLcontext *ctx,
    const GLfloat *rowFilter = ctx->Separable2D.Filter;
    const GLfloat *colFilter = rowFilter + 4 * MAX_CONVOLUTION_WIDTH;
 
-   switch (ctx->Pixel.ConvolutionBorderMode[2]) {
-      case GL_REDUCE:
-         convolve_sep_reduce(*width, *height,
-                             (const GLfloat (*)[4]) srcImage,
-                             ctx->Separable2D.Width,
-                             ctx->Separable2D.Height,
-                             (const GLfloat (*)[4]) rowFilter,
-                             (const GLfloat (*)[4]) colFilter,
-                             (GLfloat (*)[4]) dstImage);
-         *width = *width - (MAX2(ctx->Separable2D.Width, 1) - 1);
-         *height = *height - (MAX2(ctx->Separable2D.Height, 1) - 1);
-         break;
-      case GL_CONSTANT_BORDER:
-         convolve_sep_constant(*width, *height,
-                               (const GLfloat (*)[4]) srcImage,
-                               ctx->Separable2D.Width,
-                               ctx->Separable2D.Height,
-                               (const GLfloat (*)[4]) rowFilter,
-                               (const GLfloat (*)[4]) colFilter,
-                               (GLfloat (*)[4]) dstImage,
-                               ctx->Pixel.ConvolutionBorderColor[2]);
-         break;
-      case GL_REPLICATE_BORDER:
-         convolve_sep_replicate(*width, *height,
-                                (const GLfloat (*)[4]) srcImage,
-                                ctx->Separable2D.Width,
-                                ctx->Separable2D.Height,
-                                (const GLfloat (*)[4]) rowFilter,
-                                (const GLfloat (*)[4]) colFilter,
-                                (GLfloat (*)[4]) dstImage);
-         break;
-      default:
-         ;
-   }
+   convolve_sep(width, height, (const GLfloat (*)[4]) srcImage,
+                ctx->Separable2D.Width, ctx->Separable2D.Height,
+                (const GLfloat (*)[4]) rowFilter,
+                (const GLfloat (*)[4]) colFilter,
+                (GLfloat (*)[4]) dstImage,
+                ctx->Pixel.ConvolutionBorderMode[2],
+                ctx->Pixel.ConvolutionBorderColor[2]);
 }
 
 
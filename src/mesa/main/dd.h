@@ -33,6 +33,7 @@
 
 /* THIS FILE ONLY INCLUDED BY mtypes.h !!!!! */
 
+struct gl_glyph;
 struct gl_pixelstore_attrib;
 struct mesa_display_list;
 
@@ -169,6 +170,15 @@ struct dd_function_table {
 		   GLint x, GLint y, GLsizei width, GLsizei height,
 		   const struct gl_pixelstore_attrib *unpack,
 		   const GLubyte *bitmap );
+
+   /**
+    * Draw a run of glyphs, i.e. display lists holding nothing but one
+    * glBitmap, called by glCallLists.  The raster position has already
+    * been advanced past all of them and each glyph carries its window
+    * position.  Optional: if NULL each list is executed through Bitmap().
+    */
+   void (*DrawGlyphs)( GLcontext *ctx, GLuint count,
+                       const struct gl_glyph *glyphs );
    /*@}*/
 
    
@@ -471,6 +471,7 @@ void _mesa_destroy_list( GLcontext *ctx, GLuint list )
 	    break;
 	 case OPCODE_BITMAP:
 	    FREE( n[7].data );
+	    FREE( n[8].data );
 	    n += InstSize[n[0].opcode];
 	    break;
          case OPCODE_COLOR_TABLE:
@@ -659,7 +660,7 @@ _mesa_init_lists( void )
       InstSize[OPCODE_ACCUM] = 3;
       InstSize[OPCODE_ALPHA_FUNC] = 3;
       InstSize[OPCODE_BIND_TEXTURE] = 3;
-      InstSize[OPCODE_BITMAP] = 8;
+      InstSize[OPCODE_BITMAP] = 9;
       InstSize[OPCODE_BLEND_COLOR] = 5;
       InstSize[OPCODE_BLEND_EQUATION] = 2;
       InstSize[OPCODE_BLEND_EQUATION_SEPARATE] = 3;
@@ -1008,7 +1009,7 @@ static void GLAPIENTRY save_Bitmap( GLsizei width, GLsizei height,
    GLvoid *image = _mesa_unpack_bitmap( width, height, pixels, &ctx->Unpack );
    Node *n;
    ASSERT_OUTSIDE_SAVE_BEGIN_END_AND_FLUSH(ctx);
-   n = ALLOC_INSTRUCTION( ctx, OPCODE_BITMAP, 7 );
+   n = ALLOC_INSTRUCTION( ctx, OPCODE_BITMAP, 8 );
    if (n) {
       n[1].i = (GLint) width;
       n[2].i = (GLint) height;
@@ -1017,6 +1018,7 @@ static void GLAPIENTRY save_Bitmap( GLsizei width, GLsizei height,
       n[5].f = xmove;
       n[6].f = ymove;
       n[7].data = image;
+      n[8].data = NULL;  /* gl_bitmap_runs, built by execute_glyph_lists */
    }
    else if (image) {
       FREE(image);
@@ -6540,6 +6542,121 @@ execute_list( GLcontext *ctx, GLuint list )
 
 
 
+/*
+ * Helper for _mesa_list_changes_shared_state().  *listBase is the list
+ * base in effect, updated by the list; *baseKnown is cleared where the
+ * list base can no longer be followed.
+ */
+static GLboolean
+list_changes_shared_state( GLcontext *ctx, GLuint list, GLuint depth,
+                           GLuint *listBase, GLboolean *baseKnown )
+{
+   struct mesa_display_list *dlist;
+   Node *n;
+
+   if (depth == MAX_LIST_NESTING)
+      return GL_FALSE;
+
+   dlist = (struct mesa_display_list *)
+      _mesa_HashLookup(ctx->Shared->DisplayList, list);
+   if (!dlist)
+      return GL_FALSE;
+
+   n = dlist->node;
+   for (;;) {
+      GLint i = (GLint) n[0].opcode - (GLint) OPCODE_EXT_0;
+      if (i >= 0 && i < (GLint) ctx->ListExt.NumOpcodes) {
+         /* driver-extended opcodes only draw */
+         n += ctx->ListExt.Opcode[i].Size;
+         continue;
+      }
+
+      switch (n[0].opcode) {
+      /* commands storing into texture or program objects */
+      case OPCODE_TEX_IMAGE1D:
+      case OPCODE_TEX_IMAGE2D:
+      case OPCODE_TEX_IMAGE3D:
+      case OPCODE_TEX_SUB_IMAGE1D:
+      case OPCODE_TEX_SUB_IMAGE2D:
+      case OPCODE_TEX_SUB_IMAGE3D:
+      case OPCODE_COPY_TEX_IMAGE1D:
+      case OPCODE_COPY_TEX_IMAGE2D:
+      case OPCODE_COPY_TEX_SUB_IMAGE1D:
+      case OPCODE_COPY_TEX_SUB_IMAGE2D:
+      case OPCODE_COPY_TEX_SUB_IMAGE3D:
+      case OPCODE_COMPRESSED_TEX_IMAGE_1D:
+      case OPCODE_COMPRESSED_TEX_IMAGE_2D:
+      case OPCODE_COMPRESSED_TEX_IMAGE_3D:
+      case OPCODE_COMPRESSED_TEX_SUB_IMAGE_1D:
+      case OPCODE_COMPRESSED_TEX_SUB_IMAGE_2D:
+      case OPCODE_COMPRESSED_TEX_SUB_IMAGE_3D:
+      case OPCODE_TEXPARAMETER:
+      case OPCODE_PRIORITIZE_TEXTURE:
+      case OPCODE_COLOR_TABLE:
+      case OPCODE_COLOR_SUB_TABLE:
+      case OPCODE_COPY_COLOR_TABLE:
+      case OPCODE_COPY_COLOR_SUB_TABLE:
+      case OPCODE_COLOR_TABLE_PARAMETER_FV:
+      case OPCODE_COLOR_TABLE_PARAMETER_IV:
+      case OPCODE_LOAD_PROGRAM_NV:
+      case OPCODE_REQUEST_RESIDENT_PROGRAMS_NV:
+      case OPCODE_PROGRAM_STRING_ARB:
+      case OPCODE_PROGRAM_LOCAL_PARAMETER_ARB:
+      case OPCODE_PROGRAM_NAMED_PARAMETER_NV:
+      /* program bindings don't lock the reference counts */
+      case OPCODE_BIND_PROGRAM_NV:
+      case OPCODE_BIND_FRAGMENT_SHADER_ATI:
+         return GL_TRUE;
+      case OPCODE_LIST_BASE:
+         *listBase = n[1].ui;
+         *baseKnown = GL_TRUE;
+         break;
+      case OPCODE_POP_ATTRIB:
+         /* may restore an earlier list base */
+         *baseKnown = GL_FALSE;
+         break;
+      case OPCODE_CALL_LIST:
+         if (list_changes_shared_state(ctx, n[1].ui, depth + 1,
+                                       listBase, baseKnown))
+            return GL_TRUE;
+         break;
+      case OPCODE_CALL_LIST_OFFSET:
+         if (!*baseKnown ||
+             list_changes_shared_state(ctx, *listBase + n[1].ui, depth + 1,
+                                       listBase, baseKnown))
+            return GL_TRUE;
+         break;
+      case OPCODE_CONTINUE:
+         n = (Node *) n[1].next;
+         continue;
+      case OPCODE_END_OF_LIST:
+         return GL_FALSE;
+      default:
+         break;
+      }
+      n += InstSize[n[0].opcode];
+   }
+}
+
+
+/**
+ * Check whether executing a display list may change objects shared
+ * between contexts: texture images and parameters, color tables and
+ * programs.  Such a list must not be executed by several contexts sharing
+ * those objects at the same time.  The lists it calls are checked too.
+ *
+ * \param list  the display list.
+ * \param listBase  the list base (glListBase) when the list is called.
+ */
+GLboolean
+_mesa_list_changes_shared_state( GLcontext *ctx, GLuint list,
+                                 GLuint listBase )
+{
+   GLboolean baseKnown = GL_TRUE;
+   return list_changes_shared_state(ctx, list, 0, &listBase, &baseKnown);
+}
+
+
 /*
  * Test if a display list number is valid.
  */
@@ -6758,6 +6875,166 @@ _mesa_CallList( GLuint list )
 
 
 
+/*
+ * Rasterize a display-listed bitmap image (MSB first, rows padded to a
+ * byte, as stored by save_Bitmap) into horizontal runs of set pixels.
+ */
+static struct gl_bitmap_runs *
+build_bitmap_runs( GLsizei width, GLsizei height, const GLubyte *image )
+{
+   const GLint rowBytes = (width + 7) / 8;
+   struct gl_bitmap_runs *runs = NULL;
+   GLuint numRuns = 0;
+   GLint pass, row, col;
+
+   for (pass = 0; pass < 2; pass++) {
+      /* first pass counts the runs, the second stores them */
+      if (pass == 1) {
+         runs = (struct gl_bitmap_runs *)
+            MALLOC(sizeof(struct gl_bitmap_runs)
+                   + (height + 1) * sizeof(GLuint)
+                   + numRuns * 2 * sizeof(GLushort));
+         if (!runs)
+            return NULL;
+         runs->Width = width;
+         runs->Height = height;
+         runs->RowStart = (GLuint *) (runs + 1);
+         runs->Runs = (GLushort (*)[2]) (runs->RowStart + height + 1);
+         numRuns = 0;
+      }
+      for (row = 0; row < height; row++) {
+         const GLubyte *src = image + row * rowBytes;
+         if (pass == 1)
+            runs->RowStart[row] = numRuns;
+         col = 0;
+         while (col < width) {
+            GLint start;
+            /* skip clear pixels, a byte at a time where possible */
+            while (col < width && !(src[col >> 3] & (128 >> (col & 7)))) {
+               if ((col & 7) == 0 && src[col >> 3] == 0)
+                  col += 8;
+               else
+                  col++;
+            }
+            if (col >= width)
+               break;
+            start = col;
+            while (col < width && (src[col >> 3] & (128 >> (col & 7))))
+               col++;
+            if (pass == 1) {
+               runs->Runs[numRuns][0] = (GLushort) start;
+               runs->Runs[numRuns][1] = (GLushort) (col - start);
+            }
+            numRuns++;
+         }
+      }
+   }
+   runs->RowStart[height] = numRuns;
+   return runs;
+}
+
+
+/*
+ * Return the OPCODE_BITMAP node of display list LIST if the list is a
+ * glyph, i.e. holds that one command and nothing else, as built by
+ * glXUseXFont and similar font loaders.
+ */
+static Node *
+glyph_list_node( GLcontext *ctx, GLuint list )
+{
+   struct mesa_display_list *dlist;
+   Node *n;
+
+   if (list == 0)
+      return NULL;
+   dlist = (struct mesa_display_list *)
+      _mesa_HashLookup(ctx->Shared->DisplayList, list);
+   if (!dlist || !dlist->node)
+      return NULL;
+   n = dlist->node;
+   if (n[0].opcode != OPCODE_BITMAP
+       || n[InstSize[OPCODE_BITMAP]].opcode != OPCODE_END_OF_LIST
+       || n[1].i > MAX_WIDTH || n[2].i > MAX_HEIGHT)
+      return NULL;
+   return n;
+}
+
+
+#define MAX_GLYPH_BATCH 256
+
+/*
+ * Draw the glyph lists starting at element FIRST of a glCallLists array
+ * with as few Driver.DrawGlyphs calls as possible, doing what
+ * _mesa_Bitmap would do for each of them.  Stops at the first list that
+ * isn't a glyph and returns the number of lists consumed; 0 if there
+ * were none or the current state needs the regular path (which then
+ * also raises any errors).
+ */
+static GLsizei
+execute_glyph_lists( GLcontext *ctx, GLsizei n, GLenum type,
+                     const GLvoid *lists, GLsizei first )
+{
+   struct gl_glyph glyphs[MAX_GLYPH_BATCH];
+   GLuint count = 0;
+   GLsizei i;
+
+   if (ctx->Driver.CurrentExecPrimitive != PRIM_OUTSIDE_BEGIN_END
+       || ctx->RenderMode != GL_RENDER
+       || !ctx->Current.RasterPosValid
+       || (ctx->FragmentProgram.Enabled && !ctx->FragmentProgram._Enabled))
+      return 0;
+
+   if (!glyph_list_node(ctx, ctx->List.ListBase
+                             + translate_id(first, type, lists)))
+      return 0;
+
+   FLUSH_VERTICES(ctx, 0);
+   if (ctx->NewState)
+      _mesa_update_state(ctx);
+   if (ctx->DrawBuffer->_Status != GL_FRAMEBUFFER_COMPLETE_EXT)
+      return 0;
+
+   for (i = first; i < n; i++) {
+      Node *node = glyph_list_node(ctx, ctx->List.ListBase
+                                        + translate_id(i, type, lists));
+      if (!node)
+         break;
+
+      if (node[1].i > 0 && node[2].i > 0 && node[7].data) {
+         if (!node[8].data) {
+            /* lists may be shared with contexts in other threads */
+            _glthread_LOCK_MUTEX(ctx->Shared->Mutex);
+            if (!node[8].data)
+               node[8].data = build_bitmap_runs(node[1].i, node[2].i,
+                                                (const GLubyte *) node[7].data);
+            _glthread_UNLOCK_MUTEX(ctx->Shared->Mutex);
+            if (!node[8].data)
+               break;  /* out of memory, let Bitmap() draw it */
+         }
+         if (count == MAX_GLYPH_BATCH) {
+            ctx->Driver.DrawGlyphs(ctx, count, glyphs);
+            count = 0;
+         }
+         /* Truncate, to match _mesa_Bitmap */
+         glyphs[count].X = IFLOOR(ctx->Current.RasterPos[0] - node[3].f);
+         glyphs[count].Y = IFLOOR(ctx->Current.RasterPos[1] - node[4].f);
+         glyphs[count].Runs = (const struct gl_bitmap_runs *) node[8].data;
+         count++;
+      }
+
+      ctx->Current.RasterPos[0] += node[5].f;
+      ctx->Current.RasterPos[1] += node[6].f;
+   }
+
+   if (i > first)
+      ctx->OcclusionResult = GL_TRUE;
+   if (count)
+      ctx->Driver.DrawGlyphs(ctx, count, glyphs);
+
+   return i - first;
+}
+
+
 /*
  * Execute glCallLists:  call multiple display lists.
  */
@@ -6797,6 +7074,14 @@ _mesa_CallLists( GLsizei n, GLenum type, const GLvoid *lists )
    ctx->CompileFlag = GL_FALSE;
 
    for (i=0;i<n;i++) {
+      if (ctx->Driver.DrawGlyphs) {
+         /* runs of font glyphs are drawn as one batch */
+         GLsizei count = execute_glyph_lists( ctx, n, type, lists, i );
+         if (count > 0) {
+            i += count - 1;
+            continue;
+         }
+      }
       list = translate_id( i, type, lists );
       execute_list( ctx, ctx->List.ListBase + list );
    }
@@ -42,6 +42,9 @@ extern void _mesa_init_lists( void );
 
 extern void _mesa_destroy_list( GLcontext *ctx, GLuint list );
 
+extern GLboolean _mesa_list_changes_shared_state( GLcontext *ctx, GLuint list,
+                                                  GLuint listBase );
+
 extern void GLAPIENTRY _mesa_CallList( GLuint list );
 
 extern void GLAPIENTRY _mesa_CallLists( GLsizei n, GLenum type, const GLvoid *lists );
@@ -89,6 +92,9 @@ extern void _mesa_save_vtxfmt_init( GLvertexformat *vfmt );
 /** No-op */
 #define _mesa_destroy_list(c,l) ((void)0)
 
+/** No display lists */
+#define _mesa_list_changes_shared_state(c,l,b) GL_FALSE
+
 /** No-op */
 #define _mesa_init_dlist_table(t,ts) ((void)0)
 
@@ -37,6 +37,7 @@
 #include "fbobject.h"
 #include "framebuffer.h"
 #include "renderbuffer.h"
+#include "texrender.h"
 
 
 
@@ -374,17 +375,22 @@ _mesa_update_draw_buffer_bounds(GLcontext *ctx)
    buffer->_Ymax = buffer->Height;
 
    if (ctx->Scissor.Enabled) {
-      if (ctx->Scissor.X > buffer->_Xmin) {
-	 buffer->_Xmin = ctx->Scissor.X;
+      /* the scissor box is in the coordinates of the whole drawable */
+      const GLint x = buffer->Tiled ? ctx->Scissor.X - buffer->TileX
+                                    : ctx->Scissor.X;
+      const GLint y = buffer->Tiled ? ctx->Scissor.Y - buffer->TileY
+                                    : ctx->Scissor.Y;
+      if (x > buffer->_Xmin) {
+	 buffer->_Xmin = x;
       }
-      if (ctx->Scissor.Y > buffer->_Ymin) {
-	 buffer->_Ymin = ctx->Scissor.Y;
+      if (y > buffer->_Ymin) {
+	 buffer->_Ymin = y;
       }
-      if (ctx->Scissor.X + ctx->Scissor.Width < buffer->_Xmax) {
-	 buffer->_Xmax = ctx->Scissor.X + ctx->Scissor.Width;
+      if (x + ctx->Scissor.Width < buffer->_Xmax) {
+	 buffer->_Xmax = x + ctx->Scissor.Width;
       }
-      if (ctx->Scissor.Y + ctx->Scissor.Height < buffer->_Ymax) {
-	 buffer->_Ymax = ctx->Scissor.Y + ctx->Scissor.Height;
+      if (y + ctx->Scissor.Height < buffer->_Ymax) {
+	 buffer->_Ymax = y + ctx->Scissor.Height;
       }
       /* finally, check for empty region */
       if (buffer->_Xmin > buffer->_Xmax) {
@@ -483,6 +489,7 @@ _mesa_update_framebuffer(GLcontext *ctx)
 
    /* Completeness only matters for user-created framebuffers */
    if (fb->Name != 0) {
+      _mesa_update_texture_renderbuffers(ctx, fb);
       _mesa_test_framebuffer_completeness(ctx, fb);
       _mesa_update_framebuffer_visual(fb);
    }
@@ -38,32 +38,31 @@
 
 /*
  * Update the min/max values from an array of fragment colors.
+ * The span is reduced into locals first and merged into the context
+ * state once at the end, so the compiler can keep the running min/max
+ * in registers.
  */
 void
 _mesa_update_minmax(GLcontext *ctx, GLuint n, const GLfloat rgba[][4])
 {
-   GLuint i;
+   GLfloat min[4], max[4];
+   GLuint i, c;
+
+   COPY_4V(min, ctx->MinMax.Min);
+   COPY_4V(max, ctx->MinMax.Max);
+
    for (i = 0; i < n; i++) {
-      /* update mins */
-      if (rgba[i][RCOMP] < ctx->MinMax.Min[RCOMP])
-         ctx->MinMax.Min[RCOMP] = rgba[i][RCOMP];
-      if (rgba[i][GCOMP] < ctx->MinMax.Min[GCOMP])
-         ctx->MinMax.Min[GCOMP] = rgba[i][GCOMP];
-      if (rgba[i][BCOMP] < ctx->MinMax.Min[BCOMP])
-         ctx->MinMax.Min[BCOMP] = rgba[i][BCOMP];
-      if (rgba[i][ACOMP] < ctx->MinMax.Min[ACOMP])
-         ctx->MinMax.Min[ACOMP] = rgba[i][ACOMP];
-
-      /* update maxs */
-      if (rgba[i][RCOMP] > ctx->MinMax.Max[RCOMP])
-         ctx->MinMax.Max[RCOMP] = rgba[i][RCOMP];
-      if (rgba[i][GCOMP] > ctx->MinMax.Max[GCOMP])
-         ctx->MinMax.Max[GCOMP] = rgba[i][GCOMP];
-      if (rgba[i][BCOMP] > ctx->MinMax.Max[BCOMP])
-         ctx->MinMax.Max[BCOMP] = rgba[i][BCOMP];
-      if (rgba[i][ACOMP] > ctx->MinMax.Max[ACOMP])
-         ctx->MinMax.Max[ACOMP] = rgba[i][ACOMP];
+      for (c = 0; c < 4; c++) {
+         const GLfloat v = rgba[i][c];
+         if (v < min[c])
+            min[c] = v;
+         if (v > max[c])
+            max[c] = v;
+      }
    }
+
+   COPY_4V(ctx->MinMax.Min, min);
+   COPY_4V(ctx->MinMax.Max, max);
 }
 
 
@@ -74,7 +73,8 @@ void
 _mesa_update_histogram(GLcontext *ctx, GLuint n, const GLfloat rgba[][4])
 {
    const GLint max = ctx->Histogram.Width - 1;
-   GLfloat w = (GLfloat) max;
+   const GLfloat w = (GLfloat) max;
+   GLuint (*count)[4] = ctx->Histogram.Count;
    GLuint i;
 
    if (ctx->Histogram.Width == 0)
@@ -89,10 +89,10 @@ _mesa_update_histogram(GLcontext *ctx, GLuint n, const GLfloat rgba[][4])
       gi = CLAMP(gi, 0, max);
       bi = CLAMP(bi, 0, max);
       ai = CLAMP(ai, 0, max);
-      ctx->Histogram.Count[ri][RCOMP]++;
-      ctx->Histogram.Count[gi][GCOMP]++;
-      ctx->Histogram.Count[bi][BCOMP]++;
-      ctx->Histogram.Count[ai][ACOMP]++;
+      count[ri][RCOMP]++;
+      count[gi][GCOMP]++;
+      count[bi][BCOMP]++;
+      count[ai][ACOMP]++;
    }
 }
 
@@ -180,11 +180,13 @@ _mesa_align_calloc(size_t bytes, unsigned long alignment)
  * or _mesa_align_calloc().
  * \param ptr pointer to the memory to be freed.
  * The actual address to free is stored in the word immediately before the
- * address the client sees.
+ * address the client sees.  As with free(), NULL is ignored.
  */
 void
 _mesa_align_free(void *ptr)
 {
+   if (!ptr)
+      return;
 #if 0
    _mesa_free( (void *)(*(unsigned long *)((unsigned long)ptr - sizeof(void *))) );
 #else
@@ -220,6 +222,19 @@ _mesa_memcpy(void *dest, const void *src, size_t n)
 #endif
 }
 
+/** memmove wrapper */
+void *
+_mesa_memmove(void *dest, const void *src, size_t n)
+{
+#if defined(XFree86LOADER) && defined(IN_MODULE)
+   return xf86memmove(dest, src, n);
+#elif defined(SUNOS4)
+   return memmove((char *) dest, (char *) src, (int) n);
+#else
+   return memmove(dest, src, n);
+#endif
+}
+
 /** Wrapper around either memset() or xf86memset() */
 void
 _mesa_memset( void *dst, int val, size_t n )
@@ -85,6 +85,8 @@ extern "C" {
 
 /** Copy \p BYTES bytes from \p SRC into \p DST */
 #define MEMCPY( DST, SRC, BYTES)   _mesa_memcpy(DST, SRC, BYTES)
+/** Copy \p BYTES bytes from \p SRC into \p DST; the regions may overlap */
+#define MEMMOVE( DST, SRC, BYTES)  _mesa_memmove(DST, SRC, BYTES)
 /** Set \p N bytes in \p DST to \p VAL */
 #define MEMSET( DST, VAL, N )      _mesa_memset(DST, VAL, N)
 
@@ -676,6 +678,9 @@ _mesa_realloc( void *oldBuffer, size_t oldSize, size_t newSize );
 extern void *
 _mesa_memcpy( void *dest, const void *src, size_t n );
 
+extern void *
+_mesa_memmove( void *dest, const void *src, size_t n );
+
 extern void
 _mesa_memset( void *dst, int val, size_t n );
 
@@ -31,6 +31,7 @@
 #include "macros.h"
 #include "simple_list.h"
 #include "mtypes.h"
+#include "program.h"
 #include "math/m_matrix.h"
 
 
@@ -553,6 +554,9 @@ _mesa_update_material( GLcontext *ctx, GLuint bitmask )
    if (!bitmask)
       return;
 
+   /* the program STATE parameters track materials as _NEW_LIGHT */
+   _mesa_program_state_changed(ctx, _NEW_LIGHT);
+
    /* update material ambience */
    if (bitmask & MAT_BIT_FRONT_AMBIENT) {
       foreach (light, list) {
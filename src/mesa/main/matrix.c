@@ -245,6 +245,10 @@ _mesa_PushMatrix( void )
       }
       return;
    }
+   if (!_mesa_alloc_matrix_stack(stack, stack->Depth + 1)) {
+      _mesa_error(ctx, GL_OUT_OF_MEMORY, "glPushMatrix");
+      return;
+   }
    _math_matrix_copy( &stack->Stack[stack->Depth + 1],
                       &stack->Stack[stack->Depth] );
    stack->Depth++;
@@ -756,6 +760,68 @@ void _mesa_update_modelview_project( GLcontext *ctx, GLuint new_state )
    calculate_model_project_matrix(ctx);
 }
 
+
+/**
+ * Update the viewport state for a draw buffer which is one tile of a
+ * larger drawable.
+ *
+ * \param ctx GL context.
+ *
+ * The window mapping is offset by the tile's position, so that window
+ * coordinates are relative to the tile and are those of the whole
+ * drawable otherwise.  Where the viewport reaches further than
+ * MAX_WIDTH pixels around the tile, clip-space planes
+ * (gl_viewport_attrib::_TilePlane) bound the geometry to a guard band
+ * around the tile, so that spans and lines stay within the rasterizer's
+ * limits.  Geometry inside the guard band isn't clipped, and is drawn
+ * exactly as into the whole drawable.  Going back to an untiled draw
+ * buffer restores the plain mapping.
+ */
+void
+_mesa_update_viewport_tile( GLcontext *ctx )
+{
+   const struct gl_framebuffer *fb = ctx->DrawBuffer;
+   struct gl_viewport_attrib *vp = &ctx->Viewport;
+   GLfloat *m = vp->_WindowMap.m;
+
+   if (fb && fb->Tiled) {
+      const GLint x = vp->X - fb->TileX, y = vp->Y - fb->TileY;
+      const GLint gx = MAX2((MAX_WIDTH - 2 - (GLint) fb->Width) / 2, 0);
+      const GLint gy = MAX2((MAX_WIDTH - 2 - (GLint) fb->Height) / 2, 0);
+
+      m[MAT_TX] = m[MAT_SX] + x;
+      m[MAT_TY] = m[MAT_SY] + y;
+      vp->_Tiled = GL_TRUE;
+
+      /* window x >= -gx, x <= width + gx, and the same for y */
+      vp->_TilePlanesEnabled = 0;
+      if (x < -gx) {
+         ASSIGN_4V(vp->_TilePlane[0], m[MAT_SX], 0.0F, 0.0F, m[MAT_TX] + gx);
+         vp->_TilePlanesEnabled |= 0x1;
+      }
+      if (x + vp->Width > (GLint) fb->Width + gx) {
+         ASSIGN_4V(vp->_TilePlane[1], -m[MAT_SX], 0.0F, 0.0F,
+                   (GLfloat) (fb->Width + gx) - m[MAT_TX]);
+         vp->_TilePlanesEnabled |= 0x2;
+      }
+      if (y < -gy) {
+         ASSIGN_4V(vp->_TilePlane[2], 0.0F, m[MAT_SY], 0.0F, m[MAT_TY] + gy);
+         vp->_TilePlanesEnabled |= 0x4;
+      }
+      if (y + vp->Height > (GLint) fb->Height + gy) {
+         ASSIGN_4V(vp->_TilePlane[3], 0.0F, -m[MAT_SY], 0.0F,
+                   (GLfloat) (fb->Height + gy) - m[MAT_TY]);
+         vp->_TilePlanesEnabled |= 0x8;
+      }
+   }
+   else if (vp->_Tiled) {
+      m[MAT_TX] = m[MAT_SX] + vp->X;
+      m[MAT_TY] = m[MAT_SY] + vp->Y;
+      vp->_Tiled = GL_FALSE;
+      vp->_TilePlanesEnabled = 0;
+   }
+}
+
 /*@}*/
 
 
@@ -771,28 +837,53 @@ void _mesa_update_modelview_project( GLcontext *ctx, GLuint new_state )
  * \param maxDepth maximum stack depth.
  * \param dirtyFlag dirty flag.
  * 
- * Allocates an array of \p maxDepth elements for the matrix stack and calls
- * _math_matrix_ctr() and _math_matrix_alloc_inv() for each element to
- * initialize it.
+ * Allocates an array of \p maxDepth elements for the matrix stack but
+ * only initializes the bottom one.  The others are set up by
+ * _mesa_alloc_matrix_stack() when the stack first grows that deep; most
+ * contexts never push most of their stacks.
  */
 static void
 init_matrix_stack( struct matrix_stack *stack,
                    GLuint maxDepth, GLuint dirtyFlag )
 {
-   GLuint i;
-
    stack->Depth = 0;
    stack->MaxDepth = maxDepth;
    stack->DirtyFlag = dirtyFlag;
    /* The stack */
    stack->Stack = (GLmatrix *) CALLOC(maxDepth * sizeof(GLmatrix));
-   for (i = 0; i < maxDepth; i++) {
-      _math_matrix_ctr(&stack->Stack[i]);
-      _math_matrix_alloc_inv(&stack->Stack[i]);
-   }
+   _mesa_alloc_matrix_stack(stack, 0);
    stack->Top = stack->Stack;
 }
 
+
+/**
+ * Make sure the matrix stack elements up to \p depth are initialized.
+ *
+ * \param stack matrix stack.
+ * \param depth deepest element needed, less than the stack's MaxDepth.
+ *
+ * \return GL_FALSE if out of memory.
+ */
+GLboolean
+_mesa_alloc_matrix_stack( struct matrix_stack *stack, GLuint depth )
+{
+   GLuint i;
+
+   ASSERT(depth < stack->MaxDepth);
+   for (i = 0; i <= depth; i++) {
+      GLmatrix *m = &stack->Stack[i];
+      if (!m->m) {
+         _math_matrix_ctr(m);
+         _math_matrix_alloc_inv(m);
+         if (!m->m || !m->inv) {
+            _math_matrix_dtr(m);
+            return GL_FALSE;
+         }
+      }
+   }
+   return GL_TRUE;
+}
+
 /**
  * Free matrix stack.
  * 
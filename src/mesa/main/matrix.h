@@ -121,11 +121,17 @@ _mesa_init_viewport( GLcontext *ctx );
 extern void
 _mesa_free_matrix_data( GLcontext *ctx );
 
+extern GLboolean
+_mesa_alloc_matrix_stack( struct matrix_stack *stack, GLuint depth );
+
 extern void 
 _mesa_free_viewport_data( GLcontext *ctx );
 
 extern void 
 _mesa_update_modelview_project( GLcontext *ctx, GLuint newstate );
 
+extern void
+_mesa_update_viewport_tile( GLcontext *ctx );
+
 
 #endif
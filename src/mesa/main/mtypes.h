@@ -131,10 +131,12 @@ typedef int GLfixed;
  */
 /*@{*/
 struct _mesa_HashTable;
+struct gl_marshal_context;
 struct gl_pixelstore_attrib;
 struct gl_texture_format;
 struct gl_texture_image;
 struct gl_texture_object;
+struct program_cache;
 typedef struct __GLcontextRec GLcontext;
 typedef struct __GLcontextModesRec GLvisual;
 typedef struct gl_framebuffer GLframebuffer;
@@ -1433,13 +1435,6 @@ struct gl_texture_unit
    GLboolean ColorTableEnabled;
 };
 
-struct texenvprog_cache {
-   GLuint hash;
-   void *key;
-   void *data;
-   struct texenvprog_cache *next;
-};
-
 /**
  * Texture attribute group (GL_TEXTURE_BIT).
  */
@@ -1470,7 +1465,7 @@ struct gl_texture_attrib
    struct gl_color_table Palette;
    
    /** Cached texenv fragment programs */
-   struct texenvprog_cache *env_fp_cache;
+   struct program_cache *env_fp_cache;
 };
 
 
@@ -1502,6 +1497,9 @@ struct gl_viewport_attrib
    GLsizei Width, Height;	/**< size */
    GLfloat Near, Far;		/**< Depth buffer range */
    GLmatrix _WindowMap;		/**< Mapping transformation as a matrix. */
+   GLboolean _Tiled;		/**< Is _WindowMap offset to a tile? */
+   GLuint _TilePlanesEnabled;	/**< Bitmask of _TilePlane */
+   GLfloat _TilePlane[4][4];	/**< Clip-space planes around the tile */
 };
 
 
@@ -1529,6 +1527,8 @@ struct gl_buffer_object
    GLsizeiptrARB Size;       /**< Size of storage in bytes */
    GLubyte *Data;            /**< Location of storage either in RAM or VRAM. */
    GLboolean OnCard;         /**< Is buffer in VRAM? (hardware drivers) */
+   GLuint PendingWrites;     /**< Queued writes to Data, see bufferobj.c */
+   GLboolean WritesQueued;   /**< Writes queued and not waited for yet */
 };
 
 
@@ -1552,6 +1552,31 @@ struct gl_pixelstore_attrib
 };
 
 
+/**
+ * A display-listed glBitmap image rasterized into horizontal runs of set
+ * pixels.  Built the first time the list is drawn as a glyph by
+ * glCallLists and kept with the list.  The runs of row \c y are
+ * Runs[RowStart[y]] through Runs[RowStart[y+1] - 1]; each is a
+ * {first column, length} pair.
+ */
+struct gl_bitmap_runs
+{
+   GLsizei Width, Height;
+   GLuint *RowStart;         /**< Height + 1 entries */
+   GLushort (*Runs)[2];
+};
+
+
+/**
+ * One glyph of a batch passed to dd_function_table::DrawGlyphs.
+ */
+struct gl_glyph
+{
+   GLint X, Y;               /**< window position of the lower-left corner */
+   const struct gl_bitmap_runs *Runs;
+};
+
+
 #define CA_CLIENT_DATA     0x1	/**< Data not allocated by mesa */
 
 
@@ -1823,6 +1848,11 @@ struct gl_program_state
 {
    GLint ErrorPos;                       /* GL_PROGRAM_ERROR_POSITION_NV */
    const char *ErrorString;              /* GL_PROGRAM_ERROR_STRING_NV */
+
+   /** Change tracking for program STATE parameters */
+   GLuint _ContextId;                    /**< nonzero, unique per context */
+   GLuint _StateSerial;                  /**< bumped by each state update */
+   GLuint _GroupSerial[32];              /**< last _StateSerial per _NEW_ bit */
 };
 
 
@@ -2167,6 +2197,24 @@ struct gl_framebuffer
 
    GLuint Width, Height;	/**< size of frame buffer in pixels */
 
+   /** \name  Tiled rendering: a window system framebuffer may be just one
+    * tile of a larger drawable, whose window coordinates put the tile's
+    * lower-left pixel at (TileX, TileY). */
+   /*@{*/
+   GLboolean Tiled;
+   GLint TileX, TileY;
+   /*@}*/
+
+   /** \name  Damage tracking: when enabled, the window regions drawn since
+    * the last swap, so the driver can present just those.  Each rectangle
+    * is {x0, y0, x1, y1} with exclusive upper bounds. */
+   /*@{*/
+   GLboolean DamageEnabled;
+   GLboolean DamageAll;		/**< Whole buffer is damaged */
+   GLuint NumDamageRects;
+   GLint DamageRects[MAX_DAMAGE_RECTS][4];
+   /*@}*/
+
    /** \name  Drawing bounds (Intersection of buffer size and scissor box) */
    /*@{*/
    GLint _Xmin, _Xmax;  /**< inclusive */
@@ -2261,6 +2309,7 @@ struct gl_constants
    /* vertex or fragment program */
    GLuint MaxProgramMatrices;
    GLuint MaxProgramMatrixStackDepth;
+   GLuint MaxProgramCacheItems;  /**< per generated-program cache, 0 = no limit */
    /* vertex array / buffer object bounds checking */
    GLboolean CheckArrayBounds;
    /* GL_ARB_draw_buffers */
@@ -2692,6 +2741,10 @@ struct __GLcontextRec
    struct _glapi_table *Save;	/**< Display list save functions */
    struct _glapi_table *Exec;	/**< Execute functions */
    struct _glapi_table *CurrentDispatch;  /**< == Save or Exec !! */
+   /** Calls recorded for a worker thread, or NULL (see api_marshal.c) */
+   struct gl_marshal_context *Marshal;
+   /** Non-zero if the calls are recorded (see api_trace.c) */
+   GLuint TraceId;
    /*@}*/
 
    GLvisual Visual;
@@ -726,6 +726,11 @@ window_pos3f(GLfloat x, GLfloat y, GLfloat z)
    /* set raster position */
    ctx->Current.RasterPos[0] = x;
    ctx->Current.RasterPos[1] = y;
+   if (ctx->DrawBuffer->Tiled) {
+      /* relative to the tile being drawn */
+      ctx->Current.RasterPos[0] -= (GLfloat) ctx->DrawBuffer->TileX;
+      ctx->Current.RasterPos[1] -= (GLfloat) ctx->DrawBuffer->TileY;
+   }
    ctx->Current.RasterPos[2] = z2;
    ctx->Current.RasterPos[3] = 1.0F;
 
@@ -890,22 +890,16 @@ put_mono_values_ushort4(GLcontext *ctx, struct gl_renderbuffer *rb,
 
 
 /**
- * This is a software fallback for the gl_renderbuffer->AllocStorage
- * function.
- * Device drivers will typically override this function for the buffers
- * which it manages (typically color buffers, Z and stencil).
- * Other buffers (like software accumulation and aux buffers) which the driver
- * doesn't manage can be handled with this function.
- *
- * This one multi-purpose function can allocate stencil, depth, accum, color
- * or color-index buffers!
- *
- * This function also plugs in the appropriate GetPointer, Get/PutRow and
- * Get/PutValues functions.
+ * Plug in the GetPointer, Get/PutRow and Get/PutValues functions for
+ * a software renderbuffer of the given internal format.  Storage is not
+ * allocated; rb->Data must point to width * height pixels, tightly packed.
+ * This lets memory owned by someone else (a texture image, for example)
+ * be accessed as an ordinary software renderbuffer.
+ * \return  bytes per pixel, or 0 if the format isn't supported
  */
-static GLboolean
-soft_renderbuffer_storage(GLcontext *ctx, struct gl_renderbuffer *rb,
-                          GLenum internalFormat, GLuint width, GLuint height)
+GLuint
+_mesa_set_renderbuffer_accessors(struct gl_renderbuffer *rb,
+                                 GLenum internalFormat)
 {
    GLuint pixelSize;
 
@@ -1097,8 +1091,7 @@ soft_renderbuffer_storage(GLcontext *ctx, struct gl_renderbuffer *rb,
       pixelSize = sizeof(GLuint);
       break;
    default:
-      _mesa_problem(ctx, "Bad internalFormat in soft_renderbuffer_storage");
-      return GL_FALSE;
+      return 0;
    }
 
    ASSERT(rb->DataType);
@@ -1111,6 +1104,35 @@ soft_renderbuffer_storage(GLcontext *ctx, struct gl_renderbuffer *rb,
    ASSERT(rb->PutMonoValues);
    ASSERT(rb->ComponentSizes[0] > 0);
 
+   return pixelSize;
+}
+
+
+/**
+ * This is a software fallback for the gl_renderbuffer->AllocStorage
+ * function.
+ * Device drivers will typically override this function for the buffers
+ * which it manages (typically color buffers, Z and stencil).
+ * Other buffers (like software accumulation and aux buffers) which the driver
+ * doesn't manage can be handled with this function.
+ *
+ * This one multi-purpose function can allocate stencil, depth, accum, color
+ * or color-index buffers!
+ *
+ * This function also plugs in the appropriate GetPointer, Get/PutRow and
+ * Get/PutValues functions.
+ */
+static GLboolean
+soft_renderbuffer_storage(GLcontext *ctx, struct gl_renderbuffer *rb,
+                          GLenum internalFormat, GLuint width, GLuint height)
+{
+   GLuint pixelSize = _mesa_set_renderbuffer_accessors(rb, internalFormat);
+
+   if (!pixelSize) {
+      _mesa_problem(ctx, "Bad internalFormat in soft_renderbuffer_storage");
+      return GL_FALSE;
+   }
+
    /* free old buffer storage */
    if (rb->Data)
       _mesa_free(rb->Data);
@@ -40,6 +40,10 @@ _mesa_delete_renderbuffer(struct gl_renderbuffer *rb);
 extern struct gl_renderbuffer *
 _mesa_new_soft_renderbuffer(GLcontext *ctx, GLuint name);
 
+extern GLuint
+_mesa_set_renderbuffer_accessors(struct gl_renderbuffer *rb,
+                                 GLenum internalFormat);
+
 
 extern GLboolean
 _mesa_add_color_renderbuffers(GLcontext *ctx, struct gl_framebuffer *fb,
@@ -951,6 +951,26 @@ update_program(GLcontext *ctx)
 }
 
 
+/**
+ * Does the bound draw framebuffer render into a texture?  Its attachments
+ * then have to be checked again when textures change.
+ */
+static GLboolean
+draw_buffer_has_texture( const GLcontext *ctx )
+{
+   const struct gl_framebuffer *fb = ctx->DrawBuffer;
+   GLuint i;
+
+   if (!fb || fb->Name == 0)
+      return GL_FALSE;
+   for (i = 0; i < BUFFER_COUNT; i++) {
+      if (fb->Attachment[i].Type == GL_TEXTURE)
+         return GL_TRUE;
+   }
+   return GL_FALSE;
+}
+
+
 /**
  * If __GLcontextRec::NewState is non-zero then this function \b must be called
  * before rendering any primitive.  Basically, function pointers and
@@ -981,12 +1001,17 @@ _mesa_update_state( GLcontext *ctx )
    if (new_state & (_NEW_PROGRAM|_NEW_TEXTURE|_NEW_TEXTURE_MATRIX))
       _mesa_update_texture( ctx, new_state );
 
-   if (new_state & (_NEW_BUFFERS | _NEW_COLOR | _NEW_PIXEL))
+   /* texture changes may affect render-to-texture attachments */
+   if ((new_state & (_NEW_BUFFERS | _NEW_COLOR | _NEW_PIXEL)) ||
+       ((new_state & _NEW_TEXTURE) && draw_buffer_has_texture(ctx)))
       _mesa_update_framebuffer(ctx);
 
    if (new_state & (_NEW_SCISSOR | _NEW_BUFFERS | _NEW_VIEWPORT))
       _mesa_update_draw_buffer_bounds( ctx );
 
+   if (new_state & (_NEW_BUFFERS | _NEW_VIEWPORT))
+      _mesa_update_viewport_tile( ctx );
+
    if (new_state & _NEW_POINT)
       _mesa_update_point( ctx );
 
@@ -1033,6 +1058,12 @@ _mesa_update_state( GLcontext *ctx )
     */
    new_state = ctx->NewState;
    ctx->NewState = 0;
+
+   /* Do this after the derived state above is up to date, so that program
+    * STATE parameters fetched from here on see the new values.
+    */
+   _mesa_program_state_changed(ctx, new_state);
+
    ctx->Driver.UpdateState(ctx, new_state);
    ctx->Array.NewState = 0;
 }
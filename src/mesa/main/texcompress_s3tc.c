@@ -74,13 +74,21 @@ dxtCompressTexFuncExt ext_tx_compress_dxtn = NULL;
 
 void *dxtlibhandle = NULL;
 
+#if USE_EXTERNAL_DXTN_LIB
+/* The library is looked for once per process, not once per context: when
+ * it isn't installed, each attempt searches the whole library path.
+ */
+static GLboolean dxtlibTried = GL_FALSE;
+#endif
+
 void
 _mesa_init_texture_s3tc( GLcontext *ctx )
 {
    /* called during context initialization */
    ctx->Mesa_DXTn = GL_FALSE;
 #if USE_EXTERNAL_DXTN_LIB
-   if (!dxtlibhandle) {
+   if (!dxtlibTried) {
+      dxtlibTried = GL_TRUE;
       dxtlibhandle = dlopen (DXTN_EXT, RTLD_LAZY | RTLD_GLOBAL);
       if (!dxtlibhandle) {
 	 _mesa_warning(ctx, "couldn't open " DXTN_EXT ", software DXTn "
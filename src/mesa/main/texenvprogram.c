@@ -33,6 +33,7 @@
 #include "shader/program.h"
 #include "shader/nvfragprog.h"
 #include "shader/arbfragparse.h"
+#include "shader/progcache.h"
 
 
 #define DISASSEM (MESA_VERBOSE & VERBOSE_DISASSEM)
@@ -977,6 +978,15 @@ static void create_new_program(struct state_key *key, GLcontext *ctx,
    GLuint unit;
    struct ureg cf, out;
 
+   if (_mesa_program_cache_load(ctx, GL_FRAGMENT_PROGRAM_ARB,
+                                PROGRAM_CACHE_STATE,
+                                key, sizeof(*key), &program->Base)) {
+      if (ctx->Driver.ProgramStringNotify)
+	 ctx->Driver.ProgramStringNotify( ctx, GL_FRAGMENT_PROGRAM_ARB, 
+					  &program->Base );
+      return;
+   }
+
    _mesa_memset(&p, 0, sizeof(p));
    p.ctx = ctx;
    p.state = key;
@@ -1062,6 +1072,10 @@ static void create_new_program(struct state_key *key, GLcontext *ctx,
    if (p.program->NumAluInstructions > ctx->Const.MaxFragmentProgramAluInstructions)
       program_error(&p, "Exceeded max ALU instructions");
 
+   if (!p.error)
+      _mesa_program_cache_store(ctx, GL_FRAGMENT_PROGRAM_ARB,
+                                PROGRAM_CACHE_STATE,
+                                key, sizeof(*key), &p.program->Base);
 
    /* Notify driver the fragment program has (actually) changed.
     */
@@ -1080,64 +1094,32 @@ static void create_new_program(struct state_key *key, GLcontext *ctx,
 
 }
 
-static void *search_cache( struct texenvprog_cache *cache,
-			   GLuint hash,
-			   const void *key,
-			   GLuint keysize)
-{
-   struct texenvprog_cache *c;
-
-   for (c = cache; c; c = c->next) {
-      if (c->hash == hash && memcmp(c->key, key, keysize) == 0)
-	 return c->data;
-   }
-
-   return NULL;
-}
-
-static void cache_item( struct texenvprog_cache **cache,
-			GLuint hash,
-			void *key,
-			void *data )
-{
-   struct texenvprog_cache *c = MALLOC(sizeof(*c));
-   c->hash = hash;
-   c->key = key;
-   c->data = data;
-   c->next = *cache;
-   *cache = c;
-}
-
-static GLuint hash_key( struct state_key *key )
-{
-   GLuint *ikey = (GLuint *)key;
-   GLuint hash = 0, i;
-
-   /* I'm sure this can be improved on, but speed is important:
-    */
-   for (i = 0; i < sizeof(*key)/sizeof(GLuint); i++)
-      hash ^= ikey[i];
-
-   return hash;
-}
-
 void _mesa_UpdateTexEnvProgram( GLcontext *ctx )
 {
    struct state_key *key;
-   GLuint hash;
 	
    if (ctx->FragmentProgram._Enabled)
       return;
+
+   if (!ctx->Texture.env_fp_cache) {
+      ctx->Texture.env_fp_cache =
+	 _mesa_new_program_cache(ctx->Const.MaxProgramCacheItems,
+				 ctx->Driver.DeleteProgram);
+      if (!ctx->Texture.env_fp_cache) {
+	 _mesa_error(ctx, GL_OUT_OF_MEMORY, "texenv program cache");
+	 return;
+      }
+   }
 	
    key = make_state_key(ctx);
-   hash = hash_key(key);
 
    ctx->FragmentProgram._Current = ctx->_TexEnvProgram =
       (struct fragment_program *)
-      search_cache(ctx->Texture.env_fp_cache, hash, key, sizeof(*key));
+      _mesa_search_program_cache(ctx->Texture.env_fp_cache,
+				 key, sizeof(*key));
 	
    if (!ctx->_TexEnvProgram) {
-      if (0) _mesa_printf("Building new texenv proggy for key %x\n", hash);
+      if (0) _mesa_printf("Building new texenv proggy\n");
 		
       ctx->FragmentProgram._Current = ctx->_TexEnvProgram = 
 	 (struct fragment_program *) 
@@ -1145,23 +1127,22 @@ void _mesa_UpdateTexEnvProgram( GLcontext *ctx )
 		
       create_new_program(key, ctx, ctx->_TexEnvProgram);
 
-      cache_item(&ctx->Texture.env_fp_cache, hash, key, ctx->_TexEnvProgram);
-   } else {
-      FREE(key);
-      if (0) _mesa_printf("Found existing texenv program for key %x\n", hash);
+      _mesa_insert_program_cache(ctx, ctx->Texture.env_fp_cache,
+				 key, sizeof(*key),
+				 &ctx->_TexEnvProgram->Base);
    }
-	
+
+   FREE(key);
 }
 
 void _mesa_TexEnvProgramCacheDestroy( GLcontext *ctx )
 {
-   struct texenvprog_cache *a, *tmp;
-
-   for (a = ctx->Texture.env_fp_cache; a; a = tmp) {
-      tmp = a->next;
-      FREE(a->key);
-      FREE(a->data);
-      FREE(a);
+   if (ctx->Texture.env_fp_cache) {
+      _mesa_delete_program_cache(ctx, ctx->Texture.env_fp_cache, "texenv");
+      ctx->Texture.env_fp_cache = NULL;
+      if (ctx->FragmentProgram._Current == ctx->_TexEnvProgram)
+	 ctx->FragmentProgram._Current = NULL;
+      ctx->_TexEnvProgram = NULL;
    }
 }
 
@@ -771,6 +771,7 @@ _mesa_BindTexture(GLenum target, GLuint texName)
    struct gl_texture_unit *texUnit = &ctx->Texture.Unit[unit];
    struct gl_texture_object *oldTexObj;
    struct gl_texture_object *newTexObj = NULL;
+   GLboolean deleteOld;
    ASSERT_OUTSIDE_BEGIN_END(ctx);
 
    if (MESA_VERBOSE & (VERBOSE_API | VERBOSE_TEXTURE))
@@ -896,8 +897,10 @@ _mesa_BindTexture(GLenum target, GLuint texName)
       newTexObj->Target = target;
    }
 
-   /* XXX all RefCount accesses should be protected by a mutex. */
+   /* contexts sharing the texture may bind it at the same time */
+   _glthread_LOCK_MUTEX(ctx->Shared->Mutex);
    newTexObj->RefCount++;
+   _glthread_UNLOCK_MUTEX(ctx->Shared->Mutex);
 
    /* do the actual binding, but first flush outstanding vertices:
     */
@@ -932,10 +935,12 @@ _mesa_BindTexture(GLenum target, GLuint texName)
    /* Decrement the reference count on the old texture and check if it's
     * time to delete it.
     */
-   /* XXX all RefCount accesses should be protected by a mutex. */
+   _glthread_LOCK_MUTEX(ctx->Shared->Mutex);
    oldTexObj->RefCount--;
    ASSERT(oldTexObj->RefCount >= 0);
-   if (oldTexObj->RefCount == 0)
+   deleteOld = (oldTexObj->RefCount == 0);
+   _glthread_UNLOCK_MUTEX(ctx->Shared->Mutex);
+   if (deleteOld)
    {
       ASSERT(oldTexObj->Name != 0);
       ASSERT(ctx->Driver.DeleteTexture);
@@ -1,6 +1,7 @@
 
 #include "context.h"
 #include "fbobject.h"
+#include "texformat.h"
 #include "texrender.h"
 #include "renderbuffer.h"
 
@@ -23,6 +24,13 @@ struct texture_renderbuffer
 
 
 
+static void *
+texture_get_pointer(GLcontext *ctx, struct gl_renderbuffer *rb,
+                    GLint x, GLint y)
+{
+   return NULL;
+}
+
 static void
 texture_get_row(GLcontext *ctx, struct gl_renderbuffer *rb, GLuint count,
                 GLint x, GLint y, void *values)
@@ -129,30 +137,50 @@ delete_texture_wrapper(struct gl_renderbuffer *rb)
 
 
 /**
- * If a render buffer attachment specifies a texture image, we'll use
- * this function to make a gl_renderbuffer wrapper around the texture image.
- * This allows other parts of Mesa to access the texture image as if it
- * was a renderbuffer.
+ * If the texture image is stored exactly like a software renderbuffer
+ * of some format, return that format.  Rendering to such an image is done
+ * with the regular renderbuffer functions working on the texture's memory
+ * instead of fetching/storing one texel at a time.
+ * \return  renderbuffer internal format, or GL_NONE
  */
-static void
-wrap_texture(GLcontext *ctx, struct gl_renderbuffer_attachment *att)
+static GLenum
+direct_renderbuffer_format(const struct gl_texture_image *texImage)
 {
-   struct texture_renderbuffer *trb;
-   const GLuint name = 0;
+   if (!texImage->Data || texImage->RowStride != texImage->Width)
+      return GL_NONE;
+
+   switch (texImage->TexFormat->MesaFormat) {
+#if CHAN_BITS == 8
+   case MESA_FORMAT_RGBA:
+#ifdef MESA_LITTLE_ENDIAN
+   case MESA_FORMAT_RGBA8888_REV:
+#else
+   case MESA_FORMAT_RGBA8888:
+#endif
+      return GL_RGBA8;
+#endif
+   case MESA_FORMAT_DEPTH_COMPONENT16:
+      return GL_DEPTH_COMPONENT16;
+   default:
+      return GL_NONE;
+   }
+}
 
-   ASSERT(att->Type == GL_TEXTURE);
-   ASSERT(att->Renderbuffer == NULL);
-   /*
-   ASSERT(att->Complete);
-   */
 
-   trb = CALLOC_STRUCT(texture_renderbuffer);
-   if (!trb) {
-      _mesa_error(ctx, GL_OUT_OF_MEMORY, "wrap_texture");
-      return;
-   }
+/**
+ * (Re)initialize the renderbuffer wrapper for the texture image currently
+ * named by the attachment.  This must be redone whenever the texture image
+ * is respecified since its size, format and storage may have changed.
+ */
+static void
+update_wrapper(GLcontext *ctx, struct gl_renderbuffer_attachment *att)
+{
+   struct texture_renderbuffer *trb
+      = (struct texture_renderbuffer *) att->Renderbuffer;
+   GLenum directFormat;
 
-   _mesa_init_renderbuffer(&trb->Base, name);
+   (void) ctx;
+   ASSERT(trb);
 
    trb->TexImage = att->Texture->Image[att->CubeMapFace][att->TextureLevel];
    assert(trb->TexImage);
@@ -172,22 +200,41 @@ wrap_texture(GLcontext *ctx, struct gl_renderbuffer_attachment *att)
           trb->Base._BaseFormat == GL_RGBA ||
           trb->Base._BaseFormat == GL_DEPTH_COMPONENT);
 #endif
+
+   /* no sizes left over from the other path; depth goes in [0] */
+   trb->Base.ComponentSizes[0] = 0;
+   trb->Base.ComponentSizes[1] = 0;
+   trb->Base.ComponentSizes[2] = 0;
+   trb->Base.ComponentSizes[3] = 0;
+
+   directFormat = direct_renderbuffer_format(trb->TexImage);
+   if (directFormat != GL_NONE) {
+      /* point straight at the texel memory of the selected 3D slice */
+      trb->Base.Data = (GLubyte *) trb->TexImage->Data
+         + trb->Zoffset * trb->TexImage->Width * trb->TexImage->Height
+         * trb->TexImage->TexFormat->TexelBytes;
+      trb->Base.PutRowRGB = NULL;
+      _mesa_set_renderbuffer_accessors(&trb->Base, directFormat);
+      /* override the renderbuffer format's sizes with the texture's */
+      if (trb->Base._BaseFormat == GL_DEPTH_COMPONENT)
+         trb->Base.ComponentSizes[0] = trb->TexImage->TexFormat->DepthBits;
+      return;
+   }
+
    trb->Base.DataType = GL_UNSIGNED_BYTE;  /* XXX fix! */
    trb->Base.Data = trb->TexImage->Data;
 
+   trb->Base.GetPointer = texture_get_pointer;
    trb->Base.GetRow = texture_get_row;
    trb->Base.GetValues = texture_get_values;
    trb->Base.PutRow = texture_put_row;
+   trb->Base.PutRowRGB = NULL;
    trb->Base.PutMonoRow = texture_put_mono_row;
    trb->Base.PutValues = texture_put_values;
    trb->Base.PutMonoValues = texture_put_mono_values;
 
-   trb->Base.Delete = delete_texture_wrapper;
-   trb->Base.AllocStorage = NULL; /* illegal! */
-
-   /* XXX fix these */
    if (trb->Base._BaseFormat == GL_DEPTH_COMPONENT) {
-      trb->Base.ComponentSizes[3] = trb->TexImage->TexFormat->DepthBits;
+      trb->Base.ComponentSizes[0] = trb->TexImage->TexFormat->DepthBits;
    }
    else {
       trb->Base.ComponentSizes[0] = trb->TexImage->TexFormat->RedBits;
@@ -195,8 +242,62 @@ wrap_texture(GLcontext *ctx, struct gl_renderbuffer_attachment *att)
       trb->Base.ComponentSizes[2] = trb->TexImage->TexFormat->BlueBits;
       trb->Base.ComponentSizes[3] = trb->TexImage->TexFormat->AlphaBits;
    }
+}
+
+
+/**
+ * If a render buffer attachment specifies a texture image, we'll use
+ * this function to make a gl_renderbuffer wrapper around the texture image.
+ * This allows other parts of Mesa to access the texture image as if it
+ * was a renderbuffer.
+ */
+static void
+wrap_texture(GLcontext *ctx, struct gl_renderbuffer_attachment *att)
+{
+   struct texture_renderbuffer *trb;
+   const GLuint name = 0;
+
+   ASSERT(att->Type == GL_TEXTURE);
+   ASSERT(att->Renderbuffer == NULL);
+   /*
+   ASSERT(att->Complete);
+   */
+
+   trb = CALLOC_STRUCT(texture_renderbuffer);
+   if (!trb) {
+      _mesa_error(ctx, GL_OUT_OF_MEMORY, "wrap_texture");
+      return;
+   }
+
+   _mesa_init_renderbuffer(&trb->Base, name);
+
+   trb->Base.Delete = delete_texture_wrapper;
+   trb->Base.AllocStorage = NULL; /* illegal! */
 
    att->Renderbuffer = &(trb->Base);
+
+   update_wrapper(ctx, att);
+}
+
+
+/**
+ * Called when the state of a user-created framebuffer is updated.
+ * The texture images we're rendering into may have been respecified since
+ * they were attached, so refresh our renderbuffer wrappers.  Attachments
+ * made by a driver's own RenderbufferTexture function are left alone.
+ */
+void
+_mesa_update_texture_renderbuffers(GLcontext *ctx, struct gl_framebuffer *fb)
+{
+   GLuint i;
+
+   for (i = 0; i < BUFFER_COUNT; i++) {
+      struct gl_renderbuffer_attachment *att = fb->Attachment + i;
+      if (att->Type == GL_TEXTURE && att->Renderbuffer &&
+          att->Renderbuffer->Delete == delete_texture_wrapper) {
+         update_wrapper(ctx, att);
+      }
+   }
 }
 
 
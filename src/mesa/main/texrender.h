@@ -8,5 +8,8 @@ _mesa_renderbuffer_texture(GLcontext *ctx,
                            struct gl_texture_object *texObj,
                            GLenum texTarget, GLuint level, GLuint zoffset);
 
+extern void
+_mesa_update_texture_renderbuffers(GLcontext *ctx, struct gl_framebuffer *fb);
+
 
 #endif /* TEXRENDER_H */
@@ -38,6 +38,7 @@
 #include "program.h"
 #include "arbprogparse.h"
 #include "arbfragparse.h"
+#include "progcache.h"
 
 void
 _mesa_debug_fp_inst(GLint num, struct fp_instruction *fp)
@@ -188,6 +189,20 @@ _mesa_parse_arb_fragment_program(GLcontext * ctx, GLenum target,
    struct arb_program ap;
    (void) target;
 
+   if (_mesa_program_cache_load(ctx, GL_FRAGMENT_PROGRAM_ARB,
+                                PROGRAM_CACHE_TEXT, str, len,
+                                &program->Base)) {
+      _mesa_set_program_error(ctx, -1, NULL);
+      if (program->Base.String)
+         _mesa_free(program->Base.String);
+      program->Base.String = (GLubyte *) _mesa_malloc(len + 1);
+      if (program->Base.String) {
+         _mesa_memcpy(program->Base.String, str, len);
+         program->Base.String[len] = '\0';
+      }
+      return;
+   }
+
    /* set the program target before parsing */
    ap.Base.Target = GL_FRAGMENT_PROGRAM_ARB;
 
@@ -226,4 +241,9 @@ _mesa_parse_arb_fragment_program(GLcontext * ctx, GLenum target,
 #endif
 
    program->Instructions   = ap.FPInstructions;
+
+   if (ctx->Program.ErrorPos == -1)
+      _mesa_program_cache_store(ctx, GL_FRAGMENT_PROGRAM_ARB,
+                                PROGRAM_CACHE_TEXT, str, len,
+                                &program->Base);
 }
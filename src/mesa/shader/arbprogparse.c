@@ -3911,69 +3911,76 @@ static int enable_ext (GLcontext *ctx, grammar id, const byte *name, const byte
 }
 
 /**
- * This kicks everything off.
- *
- * \param ctx - The GL Context
- * \param str - The program string
- * \param len - The program string length
- * \param program - The arb_program struct to return all the parsed info in
- * \return GL_TRUE on sucess, GL_FALSE on error
+ * The ARB program grammar is loaded (and its own syntax checked against
+ * the core grammar) the first time a program is parsed and kept for the
+ * life of the process instead of being rebuilt for every program string.
+ * It is only used with the grammar lock held, since its registers and the
+ * grammar error state are shared by all threads.
  */
-GLboolean
-_mesa_parse_arb_program (GLcontext * ctx, const GLubyte * str, GLsizei len,
-                         struct arb_program * program)
+static grammar arbprogram_syn_id = 0;
+
+/**
+ * Grammar registers that follow the extensions supported by the context.
+ */
+static const char *arbprogram_ext_regs[] = {
+   "vertex_blend",
+   "matrix_palette",
+   "point_parameters",
+   "secondary_color",
+   "fog_coord",
+   "texture_rectangle",
+   "fragment_program_shadow",
+   "draw_buffers"
+};
+
+/**
+ * Return the ARB program grammar, loading it on first use.
+ * Called with the grammar lock held.
+ * \return the grammar id or 0 on error
+ */
+static grammar
+get_arb_program_grammar (GLcontext * ctx)
 {
-   GLint a, err, error_pos;
-   char error_msg[300];
+   grammar grammar_syn_id;
+   GLint err, error_pos;
    GLuint parsed_len;
-   struct var_cache *vc_head;
-   grammar arbprogram_syn_id;
-   GLubyte *parsed, *inst;
-   GLubyte *strz = NULL;
-   static int arbprogram_syn_is_ok = 0;		/* XXX temporary */
+   byte *parsed;
+   char error_msg[300];
 
-   /* Reset error state */
-   _mesa_set_program_error(ctx, -1, NULL);
+   if (arbprogram_syn_id != 0)
+      return arbprogram_syn_id;
 
 #if DEBUG_PARSING
    fprintf (stderr, "Loading grammar text!\n");
 #endif
 
    /* check if the arb_grammar_text (arbprogram.syn) is syntactically correct */
-   if (!arbprogram_syn_is_ok) {
-      grammar grammar_syn_id;
-      GLint err;
-      GLuint parsed_len;
-      byte *parsed;
-
-      grammar_syn_id = grammar_load_from_text ((byte *) core_grammar_text);
-      if (grammar_syn_id == 0) {
-         grammar_get_last_error ((byte *) error_msg, 300, &error_pos);
-         _mesa_set_program_error (ctx, error_pos, error_msg);
-         _mesa_error (ctx, GL_INVALID_OPERATION,
-                      "Error loading grammar rule set");
-         return GL_FALSE;
-      }
-
-      err = grammar_check (grammar_syn_id, (byte *) arb_grammar_text, &parsed, &parsed_len);
+   grammar_syn_id = grammar_load_from_text ((byte *) core_grammar_text);
+   if (grammar_syn_id == 0) {
+      grammar_get_last_error ((byte *) error_msg, 300, &error_pos);
+      _mesa_set_program_error (ctx, error_pos, error_msg);
+      _mesa_error (ctx, GL_INVALID_OPERATION,
+                   "Error loading grammar rule set");
+      return 0;
+   }
 
-      /* NOTE: we can't destroy grammar_syn_id right here because
-       * grammar_destroy() can reset the last error
-       */
-      if (err == 0) {
-         grammar_get_last_error ((byte *) error_msg, 300, &error_pos);
-         _mesa_set_program_error (ctx, error_pos, error_msg);
-         _mesa_error (ctx, GL_INVALID_OPERATION, "Error loading grammar rule set");
+   err = grammar_check (grammar_syn_id, (byte *) arb_grammar_text, &parsed, &parsed_len);
 
-         grammar_destroy (grammar_syn_id);
-         return GL_FALSE;
-      }
+   /* NOTE: we can't destroy grammar_syn_id right here because
+    * grammar_destroy() can reset the last error
+    */
+   if (err == 0) {
+      grammar_get_last_error ((byte *) error_msg, 300, &error_pos);
+      _mesa_set_program_error (ctx, error_pos, error_msg);
+      _mesa_error (ctx, GL_INVALID_OPERATION, "Error loading grammar rule set");
 
       grammar_destroy (grammar_syn_id);
-
-      arbprogram_syn_is_ok = 1;
+      return 0;
    }
 
+   grammar_alloc_free (parsed);
+   grammar_destroy (grammar_syn_id);
+
    /* create the grammar object */
    arbprogram_syn_id = grammar_load_from_text ((byte *) arb_grammar_text);
    if (arbprogram_syn_id == 0) {
@@ -3981,45 +3988,115 @@ _mesa_parse_arb_program (GLcontext * ctx, const GLubyte * str, GLsizei len,
       _mesa_set_program_error (ctx, error_pos, error_msg);
       _mesa_error (ctx, GL_INVALID_OPERATION,
                    "Error loading grammer rule set");
-      return GL_FALSE;
+      return 0;
    }
 
+   return arbprogram_syn_id;
+}
+
+/**
+ * Check the program string against the ARB program grammar.
+ * Called with the grammar lock held.
+ * \return GL_TRUE and the grammar production on success, GL_FALSE on error
+ */
+static GLboolean
+check_arb_program_syntax (GLcontext * ctx, GLenum target, const GLubyte * strz,
+                          GLubyte ** parsed, GLuint * parsed_len)
+{
+   grammar id;
+   GLint error_pos;
+   GLuint i;
+   char error_msg[300];
+
+   id = get_arb_program_grammar (ctx);
+   if (id == 0)
+      return GL_FALSE;
+
    /* Set program_target register value */
-   if (set_reg8 (ctx, arbprogram_syn_id, (byte *) "program_target",
-      program->Base.Target == GL_FRAGMENT_PROGRAM_ARB ? 0x10 : 0x20)) {
-      grammar_destroy (arbprogram_syn_id);
+   if (set_reg8 (ctx, id, (byte *) "program_target",
+      target == GL_FRAGMENT_PROGRAM_ARB ? 0x10 : 0x20))
       return GL_FALSE;
-   }
+
+   /* Clear extension registers a previous parse may have enabled */
+   for (i = 0; i < sizeof (arbprogram_ext_regs) / sizeof (arbprogram_ext_regs[0]); i++)
+      if (set_reg8 (ctx, id, (byte *) arbprogram_ext_regs[i], 0x00))
+         return GL_FALSE;
 
    /* Enable all active extensions */
-   if (enable_ext (ctx, arbprogram_syn_id,
+   if (enable_ext (ctx, id,
           (byte *) "vertex_blend", (byte *) "GL_ARB_vertex_blend") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "vertex_blend", (byte *) "GL_EXT_vertex_weighting") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "matrix_palette", (byte *) "GL_ARB_matrix_palette") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "point_parameters", (byte *) "GL_ARB_point_parameters") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "point_parameters", (byte *) "GL_EXT_point_parameters") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "secondary_color", (byte *) "GL_EXT_secondary_color") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "fog_coord", (byte *) "GL_EXT_fog_coord") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "texture_rectangle", (byte *) "GL_ARB_texture_rectangle") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "texture_rectangle", (byte *) "GL_EXT_texture_rectangle") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "texture_rectangle", (byte *) "GL_NV_texture_rectangle") ||
-       enable_ext (ctx, arbprogram_syn_id,
+       enable_ext (ctx, id,
           (byte *) "fragment_program_shadow", (byte *) "GL_ARB_fragment_program_shadow") ||
-       enable_ext (ctx, arbprogram_syn_id,
-          (byte *) "draw_buffers", (byte *) "GL_ARB_draw_buffers")) {
-      grammar_destroy (arbprogram_syn_id);
+       enable_ext (ctx, id,
+          (byte *) "draw_buffers", (byte *) "GL_ARB_draw_buffers"))
+      return GL_FALSE;
+
+#if DEBUG_PARSING
+   printf ("Checking Grammar!\n");
+#endif
+   /* do a fast check on program string - initial production buffer is 4K */
+   if (!grammar_fast_check (id, strz, parsed, parsed_len, 0x1000)) {
+      /* Syntax parse error */
+      grammar_get_last_error ((GLubyte *) error_msg, 300, &error_pos);
+      _mesa_set_program_error (ctx, error_pos, error_msg);
+      _mesa_error (ctx, GL_INVALID_OPERATION, "glProgramStringARB(syntax error)");
+
+      /* useful for debugging */
+      if (0) {
+         int line, col;
+         char *s;
+         printf("Program: %s\n", (char *) strz);
+         printf("Error Pos: %d\n", ctx->Program.ErrorPos);
+         s = (char *) _mesa_find_line_column(strz, strz+ctx->Program.ErrorPos, &line, &col);
+         printf("line %d col %d: %s\n", line, col, s);
+      }
       return GL_FALSE;
    }
 
+   return GL_TRUE;
+}
+
+/**
+ * This kicks everything off.
+ *
+ * \param ctx - The GL Context
+ * \param str - The program string
+ * \param len - The program string length
+ * \param program - The arb_program struct to return all the parsed info in
+ * \return GL_TRUE on sucess, GL_FALSE on error
+ */
+GLboolean
+_mesa_parse_arb_program (GLcontext * ctx, const GLubyte * str, GLsizei len,
+                         struct arb_program * program)
+{
+   GLint a, err;
+   GLuint parsed_len;
+   struct var_cache *vc_head;
+   GLubyte *parsed, *inst;
+   GLubyte *strz = NULL;
+   GLboolean ok;
+
+   /* Reset error state */
+   _mesa_set_program_error(ctx, -1, NULL);
+
    /* check for NULL character occurences */
    {
       int i;
@@ -4027,8 +4104,6 @@ _mesa_parse_arb_program (GLcontext * ctx, const GLubyte * str, GLsizei len,
          if (str[i] == '\0') {
             _mesa_set_program_error (ctx, i, "invalid character");
             _mesa_error (ctx, GL_INVALID_OPERATION, "Lexical Error");
-
-            grammar_destroy (arbprogram_syn_id);
             return GL_FALSE;
          }
    }
@@ -4042,38 +4117,16 @@ _mesa_parse_arb_program (GLcontext * ctx, const GLubyte * str, GLsizei len,
    _mesa_memcpy (strz, str, len);
    strz[len] = '\0';
 
-#if DEBUG_PARSING
-   printf ("Checking Grammar!\n");
-#endif
-   /* do a fast check on program string - initial production buffer is 4K */
-   err = grammar_fast_check (arbprogram_syn_id, strz, &parsed, &parsed_len, 0x1000);
+   grammar_lock ();
+   ok = check_arb_program_syntax (ctx, program->Base.Target, strz,
+                                  &parsed, &parsed_len);
+   grammar_unlock ();
 
-   /* Syntax parse error */
-   if (err == 0) {
+   if (!ok) {
       _mesa_free (strz);
-      grammar_get_last_error ((GLubyte *) error_msg, 300, &error_pos);
-      _mesa_set_program_error (ctx, error_pos, error_msg);
-      _mesa_error (ctx, GL_INVALID_OPERATION, "glProgramStringARB(syntax error)");
-
-      /* useful for debugging */
-      if (0) {
-         int line, col;
-         char *s;
-         printf("Program: %s\n", (char *) strz);
-         printf("Error Pos: %d\n", ctx->Program.ErrorPos);
-         s = (char *) _mesa_find_line_column(strz, strz+ctx->Program.ErrorPos, &line, &col);
-         printf("line %d col %d: %s\n", line, col, s);
-      }
-
-      grammar_destroy (arbprogram_syn_id);
-      return 1;
+      return GL_FALSE;
    }
 
-#if DEBUG_PARSING
-   printf ("Destroying grammer dict [parse retval: %d]\n", err);
-#endif
-   grammar_destroy (arbprogram_syn_id);
-
    /* Initialize the arb_program struct */
    program->Base.String = strz;
    program->Base.NumInstructions =
@@ -41,6 +41,7 @@
 #include "nvprogram.h"
 #include "nvvertparse.h"
 #include "nvvertprog.h"
+#include "progcache.h"
 
 #include "arbprogparse.h"
 
@@ -170,6 +171,20 @@ _mesa_parse_arb_vertex_program(GLcontext * ctx, GLenum target,
    struct arb_program ap;
    (void) target;
 
+   if (_mesa_program_cache_load(ctx, GL_VERTEX_PROGRAM_ARB,
+                                PROGRAM_CACHE_TEXT, str, len,
+                                &program->Base)) {
+      _mesa_set_program_error(ctx, -1, NULL);
+      if (program->Base.String)
+         _mesa_free(program->Base.String);
+      program->Base.String = (GLubyte *) _mesa_malloc(len + 1);
+      if (program->Base.String) {
+         _mesa_memcpy(program->Base.String, str, len);
+         program->Base.String[len] = '\0';
+      }
+      return;
+   }
+
    /* set the program target before parsing */
    ap.Base.Target = GL_VERTEX_PROGRAM_ARB;
 
@@ -204,4 +219,9 @@ _mesa_parse_arb_vertex_program(GLcontext * ctx, GLenum target,
    _mesa_debug_vp_inst(ap.Base.NumInstructions, ap.VPInstructions);
 #endif
 
+   if (ctx->Program.ErrorPos == -1)
+      _mesa_program_cache_store(ctx, GL_VERTEX_PROGRAM_ARB,
+                                PROGRAM_CACHE_TEXT, str, len,
+                                &program->Base);
+
 }
@@ -210,6 +210,8 @@ _mesa_BeginFragmentShaderATI(void)
 {
    GET_CURRENT_CONTEXT(ctx);
 
+   FLUSH_VERTICES(ctx, _NEW_PROGRAM);
+
    /* malloc the instructions here - not sure if the best place but its
       a start */
    ctx->ATIFragmentShader.Current->Instructions =
@@ -230,6 +232,8 @@ _mesa_EndFragmentShaderATI(void)
    GLint i;
 #endif
 
+   FLUSH_VERTICES(ctx, _NEW_PROGRAM);
+
    ctx->ATIFragmentShader.Compiling = 0;
    ctx->ATIFragmentShader.Current->NumPasses = ctx->ATIFragmentShader.Current->cur_pass;
    ctx->ATIFragmentShader.Current->cur_pass=0;
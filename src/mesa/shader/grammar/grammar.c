@@ -326,11 +326,6 @@ static void *mem_alloc (size_t size)
     return ptr;
 }
 
-static void *mem_copy (void *dst, const void *src, size_t size)
-{
-    return grammar_memory_copy (dst, src, size);
-}
-
 static void mem_free (void **ptr)
 {
     grammar_alloc_free (*ptr);
@@ -474,9 +469,20 @@ typedef struct regbyte_ctx_
     struct regbyte_ctx_ *m_prev;
 } regbyte_ctx;
 
-static void regbyte_ctx_create (regbyte_ctx **re)
+/*
+    regbyte_ctx entries are pushed and popped very often while matching, so released entries
+    are kept in a per-grammar free list (the pool) and reused instead of going back to the heap
+*/
+static void regbyte_ctx_create (regbyte_ctx **re, regbyte_ctx **pool)
 {
-    *re = (regbyte_ctx *) mem_alloc (sizeof (regbyte_ctx));
+    if (*pool != NULL)
+    {
+        *re = *pool;
+        *pool = (**pool).m_prev;
+    }
+    else
+        *re = (regbyte_ctx *) mem_alloc (sizeof (regbyte_ctx));
+
     if (*re)
     {
         (**re).m_regbyte = NULL;
@@ -484,11 +490,23 @@ static void regbyte_ctx_create (regbyte_ctx **re)
     }
 }
 
-static void regbyte_ctx_destroy (regbyte_ctx **re)
+static void regbyte_ctx_destroy (regbyte_ctx **re, regbyte_ctx **pool)
 {
     if (*re)
     {
-        mem_free ((void **) re);
+        (**re).m_prev = *pool;
+        *pool = *re;
+        *re = NULL;
+    }
+}
+
+static void regbyte_ctx_pool_destroy (regbyte_ctx **pool)
+{
+    while (*pool != NULL)
+    {
+        regbyte_ctx *next = (**pool).m_prev;
+        mem_free ((void **) pool);
+        *pool = next;
     }
 }
 
@@ -582,13 +600,21 @@ static unsigned int emit_size (emit *_E)
     return n;
 }
 
-static int emit_push (emit *_E, byte *_P, byte c, unsigned int _Pos, regbyte_ctx **_Ctx)
+/*
+    executes the emit chain: output bytes are written at _P, unless _P is NULL (used while
+    filtering strings, whose production is thrown away), and register loads are pushed on the
+    regbyte_ctx stack
+*/
+static int emit_push (emit *_E, byte *_P, byte c, unsigned int _Pos, regbyte_ctx **_Ctx,
+    regbyte_ctx **_Pool)
 {
     while (_E != NULL)
     {
         if (_E->m_emit_dest == ed_output)
         {
-            if (_E->m_emit_type == et_byte)
+            if (_P == NULL)
+                ;
+            else if (_E->m_emit_type == et_byte)
                 *_P++ = _E->m_byte;
             else if (_E->m_emit_type == et_stream)
                 *_P++ = c;
@@ -603,7 +629,7 @@ static int emit_push (emit *_E, byte *_P, byte c, unsigned int _Pos, regbyte_ctx
         else
         {
             regbyte_ctx *new_rbc;
-            regbyte_ctx_create (&new_rbc);
+            regbyte_ctx_create (&new_rbc, _Pool);
             if (new_rbc == NULL)
                 return 1;
 
@@ -742,6 +768,9 @@ typedef struct spec_
     emit *m_emits;
     error *m_errtext;
     cond *m_cond;
+    unsigned int m_string_len;      /* st_string */
+    unsigned int m_emit_size;       /* output bytes produced by m_emits */
+    byte m_first[32];               /* bitmap of characters the specifier can start with */
     struct spec_ *next;
 } spec;
 
@@ -758,6 +787,8 @@ static void spec_create (spec **sp)
         (**sp).m_emits = NULL;
         (**sp).m_errtext = NULL;
         (**sp).m_cond = NULL;
+        (**sp).m_string_len = 0;
+        (**sp).m_emit_size = 0;
         (**sp).next = NULL;
     }
 }
@@ -796,6 +827,8 @@ typedef struct rule_
     spec *m_specs;
     struct rule_ *next;
     int m_referenced;
+    int m_can_raise;                /* an .error construct is reachable from the rule */
+    byte m_first[32];               /* bitmap of characters the rule can start with */
 } rule;
 
 static void rule_create (rule **ru)
@@ -807,6 +840,7 @@ static void rule_create (rule **ru)
         (**ru).m_specs = NULL;
         (**ru).next = NULL;
         (**ru).m_referenced = 0;
+        (**ru).m_can_raise = 0;
     }
 }
 
@@ -843,6 +877,13 @@ typedef struct dict_
     map_byte *m_regbytes;
     grammar m_id;
     struct dict_ *next;
+
+    /* scratch state of the check in progress */
+    unsigned int *m_memo;           /* string filter results, indexed by text position */
+    unsigned int m_memo_size;       /* number of entries allocated in m_memo */
+    const byte *m_memo_text;        /* text m_memo refers to */
+    unsigned int m_memo_len;        /* length of m_memo_text */
+    regbyte_ctx *m_regbyte_pool;    /* free regbyte_ctx entries */
 } dict;
 
 static void dict_create (dict **di)
@@ -856,6 +897,11 @@ static void dict_create (dict **di)
         (**di).m_regbytes = NULL;
         (**di).m_id = next_valid_grammar_id ();
         (**di).next = NULL;
+        (**di).m_memo = NULL;
+        (**di).m_memo_size = 0;
+        (**di).m_memo_text = NULL;
+        (**di).m_memo_len = 0;
+        (**di).m_regbyte_pool = NULL;
     }
 }
 
@@ -865,6 +911,8 @@ static void dict_destroy (dict **di)
     {
         rule_destroy (&(**di).m_rulez);
         map_byte_destroy (&(**di).m_regbytes);
+        mem_free ((void **) &(**di).m_memo);
+        regbyte_ctx_pool_destroy (&(**di).m_regbyte_pool);
         mem_free ((void **) di);
     }
 }
@@ -889,99 +937,6 @@ static void dict_find (dict **di, grammar key, dict **data)
 
 static dict *g_dicts = NULL;
 
-/*
-    byte array typedef
-*/
-typedef struct barray_
-{
-    byte *data;
-    unsigned int len;
-} barray;
-
-static void barray_create (barray **ba)
-{
-    *ba = (barray *) mem_alloc (sizeof (barray));
-    if (*ba)
-    {
-        (**ba).data = NULL;
-        (**ba).len = 0;
-    }
-}
-
-static void barray_destroy (barray **ba)
-{
-    if (*ba)
-    {
-        mem_free ((void **) &(**ba).data);
-        mem_free ((void **) ba);
-    }
-}
-
-/*
-    reallocates byte array to requested size,
-    returns 0 on success,
-    returns 1 otherwise
-*/
-static int barray_resize (barray **ba, unsigned int nlen)
-{
-    byte *new_pointer;
-
-    if (nlen == 0)
-    {
-        mem_free ((void **) &(**ba).data);
-        (**ba).data = NULL;
-        (**ba).len = 0;
-
-        return 0;
-    }
-    else
-    {
-        new_pointer = (byte *) mem_realloc ((**ba).data, (**ba).len * sizeof (byte),
-            nlen * sizeof (byte));
-        if (new_pointer)
-        {
-            (**ba).data = new_pointer;
-            (**ba).len = nlen;
-
-            return 0;
-        }
-    }
-
-    return 1;
-}
-
-/*
-    adds byte array pointed by *nb to the end of array pointed by *ba,
-    returns 0 on success,
-    returns 1 otherwise
-*/
-static int barray_append (barray **ba, barray **nb)
-{
-    const unsigned int len = (**ba).len;
-
-    if (barray_resize (ba, (**ba).len + (**nb).len))
-        return 1;
-
-    mem_copy ((**ba).data + len, (**nb).data, (**nb).len);
-
-    return 0;
-}
-
-/*
-    adds emit chain pointed by em to the end of array pointed by *ba,
-    returns 0 on success,
-    returns 1 otherwise
-*/
-static int barray_push (barray **ba, emit *em, byte c, unsigned int pos, regbyte_ctx **rbc)
-{
-    unsigned int count = emit_size (em);
-
-    if (barray_resize (ba, (**ba).len + count))
-        return 1;
-
-    return emit_push (em, (**ba).data + ((**ba).len - count), c, pos, rbc);
-}
-
 /*
     byte pool typedef
 */
@@ -2224,6 +2179,152 @@ static int update_dependencies (dict *di, map_rule *mapr, byte **syntax_symbol,
     return 0;
 }
 
+/*
+    merges the first set src into dst, returns nonzero if dst has changed
+*/
+static int first_set_merge (byte *dst, const byte *src)
+{
+    int i, changed = 0;
+
+    for (i = 0; i < 32; i++)
+        if ((dst[i] | src[i]) != dst[i])
+        {
+            dst[i] |= src[i];
+            changed = 1;
+        }
+
+    return changed;
+}
+
+static void first_set_fill (byte *set, byte value)
+{
+    int i;
+
+    for (i = 0; i < 32; i++)
+        set[i] = value;
+}
+
+static void first_set_add (byte *set, unsigned int c)
+{
+    set[c >> 3] |= (byte) (1 << (c & 7));
+}
+
+/*
+    Compiles the grammar for matching. Every rule and specifier gets the set of characters
+    it can start with, so fast_match can drop a specifier (or a whole .or rule) by looking at
+    a single character instead of descending into it. The sets are conservative: whenever a
+    specifier may match the empty string or raise an error, its set holds all characters,
+    so skipping a specifier never changes the production or the error reported.
+*/
+static void compute_first_sets (dict *di)
+{
+    rule *ru;
+    spec *sp;
+    int changed;
+
+    for (ru = di->m_rulez; ru != NULL; ru = ru->next)
+    {
+        first_set_fill (ru->m_first, 0);
+        ru->m_can_raise = 0;
+
+        for (sp = ru->m_specs; sp != NULL; sp = sp->next)
+        {
+            first_set_fill (sp->m_first, 0);
+            sp->m_emit_size = sp->m_emits ? emit_size (sp->m_emits) : 0;
+            if (sp->m_spec_type == st_string)
+                sp->m_string_len = str_length (sp->m_string);
+        }
+    }
+
+    /* find the rules that can raise an error */
+    do
+    {
+        changed = 0;
+        for (ru = di->m_rulez; ru != NULL; ru = ru->next)
+        {
+            if (ru->m_can_raise)
+                continue;
+
+            for (sp = ru->m_specs; sp != NULL; sp = sp->next)
+                if (sp->m_errtext != NULL ||
+                    ((sp->m_spec_type == st_identifier || sp->m_spec_type == st_identifier_loop) &&
+                    sp->m_rule->m_can_raise) ||
+                    (sp->m_spec_type == st_string && di->m_string && di->m_string->m_can_raise))
+                {
+                    ru->m_can_raise = 1;
+                    changed = 1;
+                    break;
+                }
+        }
+    }
+    while (changed);
+
+    /* grow the first sets until they no longer change */
+    do
+    {
+        changed = 0;
+        for (ru = di->m_rulez; ru != NULL; ru = ru->next)
+        {
+            byte rule_set[32];
+
+            first_set_fill (rule_set, 0);
+
+            for (sp = ru->m_specs; sp != NULL; sp = sp->next)
+            {
+                byte set[32];
+                unsigned int c;
+
+                first_set_fill (set, 0);
+
+                switch (sp->m_spec_type)
+                {
+                case st_identifier:
+                    first_set_merge (set, sp->m_rule->m_first);
+                    break;
+                case st_string:
+                    if (sp->m_string_len == 0 || (di->m_string && di->m_string->m_can_raise))
+                        first_set_fill (set, 0xff);
+                    else
+                        first_set_add (set, sp->m_string[0]);
+                    break;
+                case st_byte:
+                    first_set_add (set, sp->m_byte[0]);
+                    break;
+                case st_byte_range:
+                    for (c = sp->m_byte[0]; c <= sp->m_byte[1]; c++)
+                        first_set_add (set, c);
+                    break;
+                case st_false:
+                    break;
+                case st_true:
+                case st_debug:
+                case st_identifier_loop:
+                    first_set_fill (set, 0xff);
+                    break;
+                }
+
+                if (first_set_merge (sp->m_first, set))
+                    changed = 1;
+
+                /* a sequence starts with its first specifier, unless its failure is an error */
+                if (ru->m_oper == op_or)
+                    first_set_merge (rule_set, sp->m_first);
+                else if (sp == ru->m_specs)
+                {
+                    if (sp->m_errtext != NULL)
+                        first_set_fill (rule_set, 0xff);
+                    else
+                        first_set_merge (rule_set, sp->m_first);
+                }
+            }
+
+            if (first_set_merge (ru->m_first, rule_set))
+                changed = 1;
+        }
+    }
+    while (changed);
+}
+
 static int satisfies_condition (cond *co, regbyte_ctx *ctx)
 {
     byte values[2];
@@ -2254,12 +2355,12 @@ static int satisfies_condition (cond *co, regbyte_ctx *ctx)
     return 0;
 }
 
-static void free_regbyte_ctx_stack (regbyte_ctx *top, regbyte_ctx *limit)
+static void free_regbyte_ctx_stack (dict *di, regbyte_ctx *top, regbyte_ctx *limit)
 {
     while (top != limit)
     {
         regbyte_ctx *rbc = top->m_prev;
-        regbyte_ctx_destroy (&top);
+        regbyte_ctx_destroy (&top, &di->m_regbyte_pool);
         top = rbc;
     }
 }
@@ -2274,242 +2375,69 @@ typedef enum match_result_
 } match_result;
 
 /*
-    This function does the main job. It parses the text and generates output data.
+    returns the last character matched, used by the "emit $" construct; a specifier may match
+    an empty string at the very beginning of the text, so take care not to index before it
 */
-static match_result match (dict *di, const byte *text, unsigned int *index, rule *ru, barray **ba,
-    int filtering_string, regbyte_ctx **rbc)
+static byte last_matched_char (const byte *text, unsigned int ind)
 {
-    unsigned int ind = *index;
-    match_result status = mr_not_matched;
-    spec *sp = ru->m_specs;
-    regbyte_ctx *ctx = *rbc;
-
-    /* for every specifier in the rule */
-    while (sp)
-    {
-        unsigned int i, len, save_ind = ind;
-        barray *array = NULL;
-
-        if (satisfies_condition (sp->m_cond, ctx))
-        {
-            switch (sp->m_spec_type)
-            {
-            case st_identifier:
-                barray_create (&array);
-                if (array == NULL)
-                {
-                    free_regbyte_ctx_stack (ctx, *rbc);
-                    return mr_internal_error;
-                }
-
-                status = match (di, text, &ind, sp->m_rule, &array, filtering_string, &ctx);
-
-                if (status == mr_internal_error)
-                {
-                    free_regbyte_ctx_stack (ctx, *rbc);
-                    barray_destroy (&array);
-                    return mr_internal_error;
-                }
-                break;
-            case st_string:
-                len = str_length (sp->m_string);
-
-                /* prefilter the stream */
-                if (!filtering_string && di->m_string)
-                {
-                    barray *ba;
-                    unsigned int filter_index = 0;
-                    match_result result;
-                    regbyte_ctx *null_ctx = NULL;
-
-                    barray_create (&ba);
-                    if (ba == NULL)
-                    {
-                        free_regbyte_ctx_stack (ctx, *rbc);
-                        return mr_internal_error;
-                    }
-
-                    result = match (di, text + ind, &filter_index, di->m_string, &ba, 1, &null_ctx);
-
-                    if (result == mr_internal_error)
-                    {
-                        free_regbyte_ctx_stack (ctx, *rbc);
-                        barray_destroy (&ba);
-                        return mr_internal_error;
-                    }
-
-                    if (result != mr_matched)
-                    {
-                        barray_destroy (&ba);
-                        status = mr_not_matched;
-                        break;
-                    }
-
-                    barray_destroy (&ba);
-
-                    if (filter_index != len || !str_equal_n (sp->m_string, text + ind, len))
-                    {
-                        status = mr_not_matched;
-                        break;
-                    }
-
-                    status = mr_matched;
-                    ind += len;
-                }
-                else
-                {
-                    status = mr_matched;
-                    for (i = 0; status == mr_matched && i < len; i++)
-                        if (text[ind + i] != sp->m_string[i])
-                            status = mr_not_matched;
-
-                    if (status == mr_matched)
-                        ind += len;
-                }
-                break;
-            case st_byte:
-                status = text[ind] == *sp->m_byte ? mr_matched : mr_not_matched;
-                if (status == mr_matched)
-                    ind++;
-                break;
-            case st_byte_range:
-                status = (text[ind] >= sp->m_byte[0] && text[ind] <= sp->m_byte[1]) ?
-                    mr_matched : mr_not_matched;
-                if (status == mr_matched)
-                    ind++;
-                break;
-            case st_true:
-                status = mr_matched;
-                break;
-            case st_false:
-                status = mr_not_matched;
-                break;
-            case st_debug:
-                status = ru->m_oper == op_and ? mr_matched : mr_not_matched;
-                break;
-            case st_identifier_loop:
-                barray_create (&array);
-                if (array == NULL)
-                {
-                    free_regbyte_ctx_stack (ctx, *rbc);
-                    return mr_internal_error;
-                }
-
-                status = mr_dont_emit;
-                for (;;)
-                {
-                    match_result result;
-
-                    save_ind = ind;
-                    result = match (di, text, &ind, sp->m_rule, &array, filtering_string, &ctx);
-
-                    if (result == mr_error_raised)
-                    {
-                        status = result;
-                        break;
-                    }
-                    else if (result == mr_matched)
-                    {
-                        if (barray_push (ba, sp->m_emits, text[ind - 1], save_ind, &ctx) ||
-                            barray_append (ba, &array))
-                        {
-                            free_regbyte_ctx_stack (ctx, *rbc);
-                            barray_destroy (&array);
-                            return mr_internal_error;
-                        }
-                        barray_destroy (&array);
-                        barray_create (&array);
-                        if (array == NULL)
-                        {
-                            free_regbyte_ctx_stack (ctx, *rbc);
-                            return mr_internal_error;
-                        }
-                    }
-                    else if (result == mr_internal_error)
-                    {
-                        free_regbyte_ctx_stack (ctx, *rbc);
-                        barray_destroy (&array);
-                        return mr_internal_error;
-                    }
-                    else
-                        break;
-                }
-                break;
-            }
-        }
-        else
-        {
-            status = mr_not_matched;
-        }
-
-        if (status == mr_error_raised)
-        {
-            free_regbyte_ctx_stack (ctx, *rbc);
-            barray_destroy (&array);
-
-            return mr_error_raised;
-        }
+    return ind ? text[ind - 1] : '\0';
+}
 
-        if (ru->m_oper == op_and && status != mr_matched && status != mr_dont_emit)
-        {
-            free_regbyte_ctx_stack (ctx, *rbc);
-            barray_destroy (&array);
+static match_result fast_match (dict *di, const byte *text, unsigned int *index, rule *ru, int *_PP, bytepool *_BP,
+    int filtering_string, regbyte_ctx **rbc);
 
-            if (sp->m_errtext)
-            {
-                set_last_error (sp->m_errtext->m_text, error_get_token (sp->m_errtext, di, text,
-                    ind), ind);
+/*
+    runs the string lexer rule at the given text position and returns the length of the token
+    it matches; the same token is examined by every string specifier tried at the position,
+    so the results are memoized for the text being checked
 
-                return mr_error_raised;
-            }
+    returns mr_matched, mr_not_matched or mr_internal_error
+*/
+static match_result string_filter (dict *di, const byte *text, unsigned int *len, bytepool *_BP)
+{
+    unsigned int *memo = NULL;
+    unsigned int filter_index = 0;
+    match_result result;
+    regbyte_ctx *null_ctx = NULL;
 
-            return mr_not_matched;
-        }
+    if (di->m_memo_text != NULL && text >= di->m_memo_text &&
+        (unsigned int) (text - di->m_memo_text) <= di->m_memo_len)
+    {
+        memo = &di->m_memo[text - di->m_memo_text];
 
-        if (status == mr_matched)
+        /* 0 - not examined yet, 1 - not matched, 2 + n - a token of length n matched */
+        if (*memo != 0)
         {
-            if (sp->m_emits)
-                if (barray_push (ba, sp->m_emits, text[ind - 1], save_ind, &ctx))
-                {
-                    free_regbyte_ctx_stack (ctx, *rbc);
-                    barray_destroy (&array);
-                    return mr_internal_error;
-                }
-
-            if (array)
-                if (barray_append (ba, &array))
-                {
-                    free_regbyte_ctx_stack (ctx, *rbc);
-                    barray_destroy (&array);
-                    return mr_internal_error;
-                }
+            *len = *memo - 2;
+            return *memo == 1 ? mr_not_matched : mr_matched;
         }
+    }
 
-        barray_destroy (&array);
+    result = fast_match (di, text, &filter_index, di->m_string, NULL, _BP, 1, &null_ctx);
+    free_regbyte_ctx_stack (di, null_ctx, NULL);
 
-        /* if the rule operator is a logical or, we pick up the first matching specifier */
-        if (ru->m_oper == op_or && (status == mr_matched || status == mr_dont_emit))
-        {
-            *index = ind;
-            *rbc = ctx;
-            return mr_matched;
-        }
+    if (result == mr_internal_error)
+        return mr_internal_error;
 
-        sp = sp->next;
-    }
+    /* an error raised by the lexer is reported once, so from now on it is just a mismatch */
+    if (result != mr_matched)
+        result = mr_not_matched;
 
-    /* everything went fine - all specifiers match up */
-    if (ru->m_oper == op_and && (status == mr_matched || status == mr_dont_emit))
-    {
-        *index = ind;
-        *rbc = ctx;
-        return mr_matched;
-    }
+    if (memo != NULL)
+        *memo = result == mr_matched ? filter_index + 2 : 1;
 
-    free_regbyte_ctx_stack (ctx, *rbc);
-    return mr_not_matched;
+    *len = filter_index;
+    return result;
 }
 
+/*
+    tests if the character is a member of the given first set
+*/
+#define FIRST_SET_HAS(set, c) ((set)[(c) >> 3] & (1 << ((c) & 7)))
+
+/*
+    This function does the main job. It parses the text and generates output data.
+*/
 static match_result fast_match (dict *di, const byte *text, unsigned int *index, rule *ru, int *_PP, bytepool *_BP,
     int filtering_string, regbyte_ctx **rbc)
 {
@@ -2520,19 +2448,24 @@ static match_result fast_match (dict *di, const byte *text, unsigned int *index,
     spec *sp = ru->m_specs;
     regbyte_ctx *ctx = *rbc;
 
+    /* none of the specifiers can start with the current character */
+    if (!FIRST_SET_HAS (ru->m_first, text[ind]))
+        return mr_not_matched;
+
     /* for every specifier in the rule */
     while (sp)
     {
         unsigned int i, len, save_ind = ind;
 
-        _P2 = _P + (sp->m_emits ? emit_size (sp->m_emits) : 0);
-        if (bytepool_reserve (_BP, _P2))
+        /* the production of filtered strings is thrown away, so it needs no room */
+        _P2 = _P + sp->m_emit_size;
+        if (!filtering_string && bytepool_reserve (_BP, _P2))
         {
-            free_regbyte_ctx_stack (ctx, *rbc);
+            free_regbyte_ctx_stack (di, ctx, *rbc);
             return mr_internal_error;
         }
 
-        if (satisfies_condition (sp->m_cond, ctx))
+        if (FIRST_SET_HAS (sp->m_first, text[ind]) && satisfies_condition (sp->m_cond, ctx))
         {
             switch (sp->m_spec_type)
             {
@@ -2541,25 +2474,24 @@ static match_result fast_match (dict *di, const byte *text, unsigned int *index,
 
                 if (status == mr_internal_error)
                 {
-                    free_regbyte_ctx_stack (ctx, *rbc);
+                    free_regbyte_ctx_stack (di, ctx, *rbc);
                     return mr_internal_error;
                 }
                 break;
             case st_string:
-                len = str_length (sp->m_string);
+                len = sp->m_string_len;
 
                 /* prefilter the stream */
                 if (!filtering_string && di->m_string)
                 {
-                    unsigned int filter_index = 0;
+                    unsigned int filter_len;
                     match_result result;
-                    regbyte_ctx *null_ctx = NULL;
 
-                    result = fast_match (di, text + ind, &filter_index, di->m_string, NULL, _BP, 1, &null_ctx);
+                    result = string_filter (di, text + ind, &filter_len, _BP);
 
                     if (result == mr_internal_error)
                     {
-                        free_regbyte_ctx_stack (ctx, *rbc);
+                        free_regbyte_ctx_stack (di, ctx, *rbc);
                         return mr_internal_error;
                     }
 
@@ -2569,7 +2501,7 @@ static match_result fast_match (dict *di, const byte *text, unsigned int *index,
                         break;
                     }
 
-                    if (filter_index != len || !str_equal_n (sp->m_string, text + ind, len))
+                    if (filter_len != len || !str_equal_n (sp->m_string, text + ind, len))
                     {
                         status = mr_not_matched;
                         break;
@@ -2629,25 +2561,26 @@ static match_result fast_match (dict *di, const byte *text, unsigned int *index,
                         {
                             if (sp->m_emits != NULL)
                             {
-                                if (emit_push (sp->m_emits, _BP->_F + _P, text[ind - 1], save_ind, &ctx))
+                                if (emit_push (sp->m_emits, _BP->_F + _P, last_matched_char (text, ind), save_ind, &ctx,
+                                    &di->m_regbyte_pool))
                                 {
-                                    free_regbyte_ctx_stack (ctx, *rbc);
+                                    free_regbyte_ctx_stack (di, ctx, *rbc);
                                     return mr_internal_error;
                                 }
                             }
 
                             _P = _P2;
-                            _P2 += sp->m_emits ? emit_size (sp->m_emits) : 0;
+                            _P2 += sp->m_emit_size;
                             if (bytepool_reserve (_BP, _P2))
                             {
-                                free_regbyte_ctx_stack (ctx, *rbc);
+                                free_regbyte_ctx_stack (di, ctx, *rbc);
                                 return mr_internal_error;
                             }
                         }
                     }
                     else if (result == mr_internal_error)
                     {
-                        free_regbyte_ctx_stack (ctx, *rbc);
+                        free_regbyte_ctx_stack (di, ctx, *rbc);
                         return mr_internal_error;
                     }
                     else
@@ -2663,14 +2596,14 @@ static match_result fast_match (dict *di, const byte *text, unsigned int *index,
 
         if (status == mr_error_raised)
         {
-            free_regbyte_ctx_stack (ctx, *rbc);
+            free_regbyte_ctx_stack (di, ctx, *rbc);
 
             return mr_error_raised;
         }
 
         if (ru->m_oper == op_and && status != mr_matched && status != mr_dont_emit)
         {
-            free_regbyte_ctx_stack (ctx, *rbc);
+            free_regbyte_ctx_stack (di, ctx, *rbc);
 
             if (sp->m_errtext)
             {
@@ -2686,9 +2619,10 @@ static match_result fast_match (dict *di, const byte *text, unsigned int *index,
         if (status == mr_matched)
         {
             if (sp->m_emits != NULL)
-                if (emit_push (sp->m_emits, _BP->_F + _P, text[ind - 1], save_ind, &ctx))
+                if (emit_push (sp->m_emits, filtering_string ? NULL : _BP->_F + _P, last_matched_char (text, ind),
+                    save_ind, &ctx, &di->m_regbyte_pool))
                 {
-                    free_regbyte_ctx_stack (ctx, *rbc);
+                    free_regbyte_ctx_stack (di, ctx, *rbc);
                     return mr_internal_error;
                 }
 
@@ -2718,7 +2652,7 @@ static match_result fast_match (dict *di, const byte *text, unsigned int *index,
         return mr_matched;
     }
 
-    free_regbyte_ctx_stack (ctx, *rbc);
+    free_regbyte_ctx_stack (di, ctx, *rbc);
     return mr_not_matched;
 }
 
@@ -2728,14 +2662,16 @@ static byte *error_get_token (error *er, dict *di, const byte *text, unsigned in
 
     if (er->m_token)
     {
-        barray *ba;
+        bytepool *bp;
         unsigned int filter_index = 0;
         regbyte_ctx *ctx = NULL;
+        int _P = 0;
 
-        barray_create (&ba);
-        if (ba != NULL)
+        /* the production is not needed, only the length of the matched token */
+        bytepool_create (&bp, 0x100);
+        if (bp != NULL)
         {
-            if (match (di, text + ind, &filter_index, er->m_token, &ba, 0, &ctx) == mr_matched &&
+            if (fast_match (di, text + ind, &filter_index, er->m_token, &_P, bp, 0, &ctx) == mr_matched &&
                 filter_index)
             {
                 str = (byte *) mem_alloc (filter_index + 1);
@@ -2745,7 +2681,8 @@ static byte *error_get_token (error *er, dict *di, const byte *text, unsigned in
                     str[filter_index] = '\0';
                 }
             }
-            barray_destroy (&ba);
+            free_regbyte_ctx_stack (di, ctx, NULL);
+            bytepool_destroy (&bp);
         }
     }
 
@@ -2949,6 +2886,8 @@ grammar grammar_load_from_text (const byte *text)
         return 0;
     }
 
+    compute_first_sets (g->di);
+
     dict_append (&g_dicts, g->di);
     id = g->di->m_id;
     g->di = NULL;
@@ -2983,14 +2922,47 @@ int grammar_set_reg8 (grammar id, const byte *name, byte value)
     return 1;
 }
 
+/*
+    prepares the string filter memo for a check of the given text,
+    returns 0 on success,
+    returns 1 otherwise
+*/
+static int dict_memo_reset (dict *di, const byte *text)
+{
+    unsigned int i, len = str_length (text);
+
+    /* the matcher may look at the terminating zero too */
+    if (di->m_memo_size < len + 1)
+    {
+        mem_free ((void **) &di->m_memo);
+        di->m_memo_size = 0;
+
+        di->m_memo = (unsigned int *) mem_alloc ((len + 1) * sizeof (unsigned int));
+        if (di->m_memo == NULL)
+            return 1;
+        di->m_memo_size = len + 1;
+    }
+
+    for (i = 0; i <= len; i++)
+        di->m_memo[i] = 0;
+
+    di->m_memo_text = text;
+    di->m_memo_len = len;
+    return 0;
+}
+
 /*
     internal checking function used by both grammar_check and grammar_fast_check functions
 */
 static int _grammar_check (grammar id, const byte *text, byte **prod, unsigned int *size,
-    unsigned int estimate_prod_size, int use_fast_path)
+    unsigned int estimate_prod_size)
 {
     dict *di = NULL;
     unsigned int index = 0;
+    regbyte_ctx *rbc = NULL;
+    bytepool *bp = NULL;
+    int _P = 0;
+    match_result result;
 
     clear_last_error ();
 
@@ -3004,72 +2976,45 @@ static int _grammar_check (grammar id, const byte *text, byte **prod, unsigned i
     *prod = NULL;
     *size = 0;
 
-    if (use_fast_path)
-    {
-        regbyte_ctx *rbc = NULL;
-        bytepool *bp = NULL;
-        int _P = 0;
+    if (dict_memo_reset (di, text))
+        return 0;
 
-        bytepool_create (&bp, estimate_prod_size);
-        if (bp == NULL)
-            return 0;
+    bytepool_create (&bp, estimate_prod_size);
+    if (bp == NULL)
+        return 0;
 
-        if (fast_match (di, text, &index, di->m_syntax, &_P, bp, 0, &rbc) != mr_matched)
-        {
-            bytepool_destroy (&bp);
-            free_regbyte_ctx_stack (rbc, NULL);
-            return 0;
-        }
+    result = fast_match (di, text, &index, di->m_syntax, &_P, bp, 0, &rbc);
 
-        free_regbyte_ctx_stack (rbc, NULL);
+    free_regbyte_ctx_stack (di, rbc, NULL);
+    di->m_memo_text = NULL;
 
-        *prod = bp->_F;
-        *size = _P;
-        bp->_F = NULL;
+    if (result != mr_matched)
+    {
         bytepool_destroy (&bp);
+        return 0;
     }
-    else
-    {
-        regbyte_ctx *rbc = NULL;
-        barray *ba = NULL;
-
-        barray_create (&ba);
-        if (ba == NULL)
-            return 0;
-
-        if (match (di, text, &index, di->m_syntax, &ba, 0, &rbc) != mr_matched)
-        {
-            barray_destroy (&ba);
-            free_regbyte_ctx_stack (rbc, NULL);
-            return 0;
-        }
 
-        free_regbyte_ctx_stack (rbc, NULL);
-
-        *prod = (byte *) mem_alloc (ba->len * sizeof (byte));
-        if (*prod == NULL)
-        {
-            barray_destroy (&ba);
-            return 0;
-        }
-
-        mem_copy (*prod, ba->data, ba->len * sizeof (byte));
-        *size = ba->len;
-        barray_destroy (&ba);
-    }
+    *prod = bp->_F;
+    *size = _P;
+    bp->_F = NULL;
+    bytepool_destroy (&bp);
 
     return 1;
 }
 
+/*
+    both entry points share the same matcher; grammar_check just has no production size
+    estimate to start with
+*/
 int grammar_check (grammar id, const byte *text, byte **prod, unsigned int *size)
 {
-    return _grammar_check (id, text, prod, size, 0, 0);
+    return _grammar_check (id, text, prod, size, 0x1000);
 }
 
 int grammar_fast_check (grammar id, const byte *text, byte **prod, unsigned int *size,
     unsigned int estimate_prod_size)
 {
-    return _grammar_check (id, text, prod, size, estimate_prod_size, 1);
+    return _grammar_check (id, text, prod, size, estimate_prod_size ? estimate_prod_size : 0x1000);
 }
 
 int grammar_destroy (grammar id)
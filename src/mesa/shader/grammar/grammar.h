@@ -61,8 +61,6 @@ grammar grammar_load_from_text (const byte *text);
 int grammar_set_reg8 (grammar id, const byte *name, byte value);
 
 /*
-    this function is obsolete, use only for debugging purposes
-
     checks if a null-terminated <text> matches given grammar <id>
     returns 0 on error (call grammar_get_last_error to retrieve the error text)
     returns 1 on success, the <prod> points to newly allocated buffer with production and <size>
@@ -72,8 +70,7 @@ int grammar_set_reg8 (grammar id, const byte *name, byte value);
 int grammar_check (grammar id, const byte *text, byte **prod, unsigned int *size);
 
 /*
-    does the same what grammar_check does but much more (approx. 4 times) faster
-    use this function instead of grammar_check
+    does the same what grammar_check does
     <estimate_prod_size> is a hint - the initial production buffer size will be of this size,
     but if more room is needed it will be safely resized; set it to 0x1000 or so
 */
@@ -95,6 +92,16 @@ int grammar_destroy (grammar id);
 */
 void grammar_get_last_error (byte *text, unsigned int size, int *pos);
 
+/*
+    serializes use of the grammar engine between threads
+    the grammar objects, their registers and the last error are shared by all callers, so a
+    caller must hold the lock from the first call that sets registers or may set the last error
+    until it has retrieved the production or the error text
+    the lock is not recursive
+*/
+void grammar_lock (void);
+void grammar_unlock (void);
+
 #ifdef __cplusplus
 }
 #endif
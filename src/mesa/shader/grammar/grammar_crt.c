@@ -5,6 +5,17 @@
 #undef GRAMMAR_PORT_BUILD
 
 
+/* this port is single-threaded */
+
+void grammar_lock (void)
+{
+}
+
+void grammar_unlock (void)
+{
+}
+
+
 void grammar_alloc_free (void *ptr)
 {
     free (ptr);
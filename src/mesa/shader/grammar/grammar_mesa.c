@@ -29,12 +29,26 @@
  */
 
 #include "grammar_mesa.h"
+#include "glthread.h"
 
 #define GRAMMAR_PORT_BUILD 1
 #include "grammar.c"
 #undef GRAMMAR_PORT_BUILD
 
 
+_glthread_DECLARE_STATIC_MUTEX(grammar_mutex);
+
+void grammar_lock (void)
+{
+    _glthread_LOCK_MUTEX (grammar_mutex);
+}
+
+void grammar_unlock (void)
+{
+    _glthread_UNLOCK_MUTEX (grammar_mutex);
+}
+
+
 void grammar_alloc_free (void *ptr)
 {
     _mesa_free (ptr);
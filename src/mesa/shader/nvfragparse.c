@@ -47,6 +47,7 @@
 #include "nvfragparse.h"
 #include "nvprogram.h"
 #include "program.h"
+#include "progcache.h"
 
 
 #define INPUT_1V     1
@@ -1512,6 +1513,17 @@ _mesa_parse_nv_fragment_program(GLcontext *ctx, GLenum dstTarget,
       return;
    }
 
+   if (_mesa_program_cache_load(ctx, target, PROGRAM_CACHE_TEXT,
+                                programString, len, &program->Base)) {
+      _mesa_free_parameter_list(parseState.parameters);
+      if (program->Base.String) {
+         FREE(program->Base.String);
+      }
+      program->Base.String = programString;
+      program->Base.Format = GL_PROGRAM_FORMAT_ASCII_ARB;
+      return;
+   }
+
    if (Parse_InstructionSequence(&parseState, instBuffer)) {
       GLuint u;
       /* successful parse! */
@@ -1553,6 +1565,9 @@ _mesa_parse_nv_fragment_program(GLcontext *ctx, GLenum dstTarget,
       /* save program parameters */
       program->Parameters = parseState.parameters;
 
+      _mesa_program_cache_store(ctx, target, PROGRAM_CACHE_TEXT,
+                                programString, len, &program->Base);
+
       /* allocate registers for declared program parameters */
 #if 00
       _mesa_assign_program_registers(&(program->SymbolTable));
@@ -539,6 +539,9 @@ _mesa_LoadProgramNV(GLenum target, GLuint id, GLsizei len,
          _mesa_HashInsert(ctx->Shared->Programs, id, vprog);
       }
       _mesa_parse_nv_vertex_program(ctx, target, program, len, vprog);
+
+      if (ctx->Driver.ProgramStringNotify)
+	 ctx->Driver.ProgramStringNotify( ctx, target, &vprog->Base );
    }
    else if (target == GL_FRAGMENT_PROGRAM_NV
             && ctx->Extensions.NV_fragment_program) {
@@ -553,6 +556,9 @@ _mesa_LoadProgramNV(GLenum target, GLuint id, GLsizei len,
          _mesa_HashInsert(ctx->Shared->Programs, id, fprog);
       }
       _mesa_parse_nv_fragment_program(ctx, target, program, len, fprog);
+
+      if (ctx->Driver.ProgramStringNotify)
+	 ctx->Driver.ProgramStringNotify( ctx, target, &fprog->Base );
    }
    else {
       _mesa_error(ctx, GL_INVALID_ENUM, "glLoadProgramNV(target)");
@@ -47,6 +47,7 @@
 #include "nvvertparse.h"
 #include "nvvertprog.h"
 #include "program.h"
+#include "progcache.h"
 
 
 /**
@@ -1354,6 +1355,15 @@ _mesa_parse_nv_vertex_program(GLcontext *ctx, GLenum dstTarget,
       return;
    }
 
+   if (_mesa_program_cache_load(ctx, target, PROGRAM_CACHE_TEXT,
+                                programString, len, &program->Base)) {
+      if (program->Base.String) {
+         FREE(program->Base.String);
+      }
+      program->Base.String = programString;
+      program->Base.Format = GL_PROGRAM_FORMAT_ASCII_ARB;
+      return;
+   }
 
    if (Parse_Program(&parseState, instBuffer)) {
       /* successful parse! */
@@ -1398,11 +1408,15 @@ _mesa_parse_nv_vertex_program(GLcontext *ctx, GLenum dstTarget,
          FREE(program->Instructions);
       }
       program->Instructions = newInst;
+      program->Base.NumInstructions = parseState.numInst;
       program->InputsRead = parseState.inputsRead;
       program->OutputsWritten = parseState.outputsWritten;
       program->IsPositionInvariant = parseState.isPositionInvariant;
       program->IsNVProgram = GL_TRUE;
 
+      _mesa_program_cache_store(ctx, target, PROGRAM_CACHE_TEXT,
+                                programString, len, &program->Base);
+
 #ifdef DEBUG_foo
       _mesa_printf("--- glLoadProgramNV result ---\n");
       _mesa_print_nv_vertex_program(program);
@@ -0,0 +1,947 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4.2
+ *
+ * Copyright (C) 1999-2006  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file progcache.c
+ * Program caches.
+ *
+ * The in-memory cache maps state keys to the programs generated for
+ * them (texenvprogram.c, t_vp_build.c).  It's a hash table with an LRU
+ * list so that applications cycling through many state combinations
+ * don't accumulate programs without bound.
+ *
+ * Parsing an ARB program goes through the grammar engine and is easily
+ * the most expensive part of glProgramStringARB.  Applications tend to
+ * load the same programs on every run, and the fixed-function program
+ * generators produce the same programs for the same state, so the
+ * compiled results are worth keeping between processes.
+ *
+ * The cache is disabled unless the MESA_PROGRAM_CACHE environment
+ * variable names an existing directory.  Each entry is a file named
+ * after a hash of the caller's key (program text or state key), the
+ * kind of key, the program target, the context limits and extension
+ * string, the Mesa version and CACHE_FORMAT_VERSION.  The file holds the
+ * full key, which is compared on load, so hash collisions simply miss.  Entries are stored in native byte
+ * order and struct layout; they're not meant to be shared between
+ * different builds or machines.
+ */
+
+
+#include "glheader.h"
+#include "extensions.h"
+#include "imports.h"
+#include "macros.h"
+#include "mtypes.h"
+#include "version.h"
+#include "nvfragprog.h"
+#include "nvvertprog.h"
+#include "program.h"
+#include "progcache.h"
+
+#if defined(_WIN32)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+
+#define CACHE_MAGIC 0x3243504d  /* "MPC2" */
+
+#define MAX_CACHE_PATH 1024
+
+#define INITIAL_TABLE_SIZE 16
+
+
+/**
+ * Version of the entry format and of everything which decides what a key
+ * compiles to.  Bump it with any change to the structs below, to the
+ * program parsers (arbprogparse.c, nvvertparse.c, nvfragparse.c) or to
+ * the program generators (texenvprogram.c, t_vp_build.c), so that entries
+ * written by older builds miss.
+ */
+#define CACHE_FORMAT_VERSION 1
+
+
+struct cache_header
+{
+   GLuint Magic;
+   GLuint EnvHash[2];      /**< versions, limits and extensions */
+   GLenum Target;
+   GLuint KeyKind;         /**< enum program_cache_key_kind */
+   GLuint KeySize;
+   GLuint PayloadSize;     /**< bytes following the header */
+   GLuint Checksum;        /**< hash of the payload */
+};
+
+
+/** Fixed-size part of an entry, follows the key */
+struct cache_program_info
+{
+   GLuint NumInstructions;
+   GLuint NumTemporaries;
+   GLuint NumParameters;
+   GLuint NumAttributes;
+   GLuint NumAddressRegs;
+   GLuint NumStoredInstructions;   /**< including the END instruction */
+   GLuint InputsRead;
+   GLuint OutputsWritten;
+   GLuint IsNVProgram;
+   GLuint IsPositionInvariant;
+   GLuint TexturesUsed[MAX_TEXTURE_IMAGE_UNITS];
+   GLuint NumAluInstructions;
+   GLuint NumTexInstructions;
+   GLuint NumTexIndirections;
+   GLenum FogOption;
+   GLuint HasParameters;
+   GLuint NumProgramParameters;
+};
+
+
+/** One program parameter, followed by NameLength bytes of name */
+struct cache_parameter
+{
+   GLuint Type;
+   GLuint StateIndexes[6];
+   GLuint NameLength;      /**< strlen(Name) + 1, or 0 if unnamed */
+   GLfloat Values[4];
+};
+
+
+struct cache_buffer
+{
+   GLubyte *Data;
+   GLuint Size, Capacity;
+   GLboolean OutOfMemory;
+};
+
+
+static void
+buffer_append(struct cache_buffer *buf, const void *data, GLuint size)
+{
+   if (buf->OutOfMemory)
+      return;
+
+   if (buf->Size + size > buf->Capacity) {
+      GLuint newCapacity = buf->Capacity ? buf->Capacity * 2 : 4096;
+      GLubyte *newData;
+      while (newCapacity < buf->Size + size)
+         newCapacity *= 2;
+      newData = (GLubyte *) _mesa_realloc(buf->Data, buf->Capacity,
+                                          newCapacity);
+      if (!newData) {
+         buf->OutOfMemory = GL_TRUE;
+         return;
+      }
+      buf->Data = newData;
+      buf->Capacity = newCapacity;
+   }
+
+   _mesa_memcpy(buf->Data + buf->Size, data, size);
+   buf->Size += size;
+}
+
+
+struct cache_reader
+{
+   const GLubyte *Pos, *End;
+};
+
+
+/**
+ * Return a pointer to the next 'size' bytes of the entry, or NULL if
+ * the entry is truncated.
+ */
+static const GLubyte *
+reader_skip(struct cache_reader *r, GLuint size)
+{
+   const GLubyte *p = r->Pos;
+   if ((GLuint) (r->End - r->Pos) < size)
+      return NULL;
+   r->Pos += size;
+   return p;
+}
+
+
+static GLboolean
+reader_get(struct cache_reader *r, void *dst, GLuint size)
+{
+   const GLubyte *p = reader_skip(r, size);
+   if (!p)
+      return GL_FALSE;
+   _mesa_memcpy(dst, p, size);
+   return GL_TRUE;
+}
+
+
+/**
+ * Two independent 32-bit FNV-style lanes give a 64-bit hash without
+ * needing a 64-bit integer type.
+ */
+static void
+hash_init(GLuint hash[2])
+{
+   hash[0] = 0x811c9dc5;
+   hash[1] = 0x9747b28c;
+}
+
+
+static void
+hash_bytes(GLuint hash[2], const void *data, GLuint size)
+{
+   const GLubyte *p = (const GLubyte *) data;
+   GLuint h0 = hash[0], h1 = hash[1];
+   GLuint i;
+
+   for (i = 0; i < size; i++) {
+      h0 = (h0 ^ p[i]) * 0x01000193;
+      h1 = (h1 + p[i]) * 0x5bd1e995;
+      h1 ^= h1 >> 15;
+   }
+
+   hash[0] = h0;
+   hash[1] = h1;
+}
+
+
+static GLboolean
+is_vertex_target(GLenum target)
+{
+   return target == GL_VERTEX_PROGRAM_ARB ||
+          target == GL_VERTEX_STATE_PROGRAM_NV;
+}
+
+
+static GLboolean
+is_fragment_target(GLenum target)
+{
+   return target == GL_FRAGMENT_PROGRAM_ARB ||
+          target == GL_FRAGMENT_PROGRAM_NV;
+}
+
+
+/**********************************************************************/
+/* In-memory program cache                                            */
+/**********************************************************************/
+
+
+static GLuint
+hash_key(const void *key, GLuint keySize)
+{
+   GLuint hash[2];
+   hash_init(hash);
+   hash_bytes(hash, key, keySize);
+   return hash[0];
+}
+
+
+/**
+ * Create a program cache.
+ * \param maxItems  number of programs to keep, or 0 for no limit
+ * \param deleteProgram  called for programs evicted from the cache or
+ *                       left in it when the cache is deleted
+ */
+struct program_cache *
+_mesa_new_program_cache(GLuint maxItems,
+                        void (*deleteProgram)(GLcontext *, struct program *))
+{
+   struct program_cache *cache = CALLOC_STRUCT(program_cache);
+   if (!cache)
+      return NULL;
+
+   cache->Table = (struct program_cache_item **)
+      _mesa_calloc(INITIAL_TABLE_SIZE * sizeof(struct program_cache_item *));
+   if (!cache->Table) {
+      _mesa_free(cache);
+      return NULL;
+   }
+   cache->TableSize = INITIAL_TABLE_SIZE;
+   cache->MaxItems = maxItems;
+   cache->Delete = deleteProgram;
+   return cache;
+}
+
+
+static void
+lru_unlink(struct program_cache *cache, struct program_cache_item *item)
+{
+   if (item->Newer)
+      item->Newer->Older = item->Older;
+   else
+      cache->Newest = item->Older;
+
+   if (item->Older)
+      item->Older->Newer = item->Newer;
+   else
+      cache->Oldest = item->Newer;
+}
+
+
+static void
+lru_push_newest(struct program_cache *cache, struct program_cache_item *item)
+{
+   item->Newer = NULL;
+   item->Older = cache->Newest;
+   if (cache->Newest)
+      cache->Newest->Newer = item;
+   else
+      cache->Oldest = item;
+   cache->Newest = item;
+}
+
+
+static void
+grow_table(struct program_cache *cache)
+{
+   const GLuint newSize = cache->TableSize * 2;
+   struct program_cache_item **table, *item, *next;
+   GLuint i;
+
+   table = (struct program_cache_item **)
+      _mesa_calloc(newSize * sizeof(struct program_cache_item *));
+   if (!table)
+      return;  /* keep using the smaller table */
+
+   for (i = 0; i < cache->TableSize; i++) {
+      for (item = cache->Table[i]; item; item = next) {
+         const GLuint bucket = item->Hash & (newSize - 1);
+         next = item->Next;
+         item->Next = table[bucket];
+         table[bucket] = item;
+      }
+   }
+
+   _mesa_free(cache->Table);
+   cache->Table = table;
+   cache->TableSize = newSize;
+}
+
+
+static void
+evict_oldest(GLcontext *ctx, struct program_cache *cache)
+{
+   struct program_cache_item *item = cache->Oldest;
+   struct program_cache_item **p = &cache->Table[item->Hash & (cache->TableSize - 1)];
+
+   while (*p != item)
+      p = &(*p)->Next;
+   *p = item->Next;
+
+   lru_unlink(cache, item);
+   cache->NumItems--;
+   cache->Evictions++;
+
+   cache->Delete(ctx, item->Program);
+   _mesa_free(item->Key);
+   _mesa_free(item);
+}
+
+
+/**
+ * Delete a program cache and all the programs in it.
+ * \param name  identifies the cache in the statistics printed when the
+ *              MESA_PROGRAM_CACHE_STATS env var is set
+ */
+void
+_mesa_delete_program_cache(GLcontext *ctx, struct program_cache *cache,
+                           const char *name)
+{
+   struct program_cache_item *item, *older;
+
+   if ((MESA_VERBOSE & VERBOSE_STATE) ||
+       _mesa_getenv("MESA_PROGRAM_CACHE_STATS"))
+      _mesa_debug(ctx, "%s program cache: %u hits, %u misses, "
+                  "%u evictions, %u programs\n", name,
+                  cache->Hits, cache->Misses, cache->Evictions,
+                  cache->NumItems);
+
+   for (item = cache->Newest; item; item = older) {
+      older = item->Older;
+      cache->Delete(ctx, item->Program);
+      _mesa_free(item->Key);
+      _mesa_free(item);
+   }
+
+   _mesa_free(cache->Table);
+   _mesa_free(cache);
+}
+
+
+/**
+ * Look up the program for the given key.  A hit makes the program the
+ * most recently used one.
+ * \return the program, or NULL if not found
+ */
+struct program *
+_mesa_search_program_cache(struct program_cache *cache,
+                           const void *key, GLuint keySize)
+{
+   const GLuint hash = hash_key(key, keySize);
+   struct program_cache_item *item;
+
+   for (item = cache->Table[hash & (cache->TableSize - 1)];
+        item; item = item->Next) {
+      if (item->Hash == hash && item->KeySize == keySize &&
+          memcmp(item->Key, key, keySize) == 0) {
+         if (item != cache->Newest) {
+            lru_unlink(cache, item);
+            lru_push_newest(cache, item);
+         }
+         cache->Hits++;
+         return item->Program;
+      }
+   }
+
+   cache->Misses++;
+   return NULL;
+}
+
+
+/**
+ * Add a program to the cache, evicting the least recently used programs
+ * if the cache is full.  The key is copied.  The cache takes ownership
+ * of the program.
+ */
+void
+_mesa_insert_program_cache(GLcontext *ctx, struct program_cache *cache,
+                           const void *key, GLuint keySize,
+                           struct program *prog)
+{
+   struct program_cache_item *item = CALLOC_STRUCT(program_cache_item);
+   GLuint bucket;
+
+   if (item)
+      item->Key = _mesa_malloc(keySize);
+   if (!item || !item->Key) {
+      /* can't track it; the caller keeps using the program, so leak it
+       * rather than free it from under them
+       */
+      if (item)
+         _mesa_free(item);
+      return;
+   }
+
+   _mesa_memcpy(item->Key, key, keySize);
+   item->KeySize = keySize;
+   item->Hash = hash_key(key, keySize);
+   item->Program = prog;
+
+   bucket = item->Hash & (cache->TableSize - 1);
+   item->Next = cache->Table[bucket];
+   cache->Table[bucket] = item;
+   lru_push_newest(cache, item);
+   cache->NumItems++;
+
+   if (cache->NumItems > cache->TableSize)
+      grow_table(cache);
+
+   if (cache->MaxItems) {
+      while (cache->NumItems > cache->MaxItems && cache->Oldest != item)
+         evict_oldest(ctx, cache);
+   }
+}
+
+
+
+/**********************************************************************/
+/* On-disk program cache                                              */
+/**********************************************************************/
+
+
+/**
+ * Return the cache directory, or NULL if the cache is disabled.
+ */
+static const char *
+cache_directory(void)
+{
+   const char *dir = _mesa_getenv("MESA_PROGRAM_CACHE");
+   if (!dir || !dir[0] || _mesa_strlen(dir) + 32 > MAX_CACHE_PATH)
+      return NULL;
+   return dir;
+}
+
+
+/**
+ * Hash everything besides the caller's key which can change the
+ * compiled program: the Mesa and cache format versions, the layout of
+ * the stored instructions, the implementation limits, the enabled
+ * extensions (the ARB parser enables grammar features from these) and
+ * the target.
+ */
+static GLboolean
+environment_hash(GLcontext *ctx, GLenum target, GLuint hash[2])
+{
+   static const char version[] = MESA_VERSION_STRING;
+   struct gl_constants consts;
+   GLuint build[5];
+
+   if (!ctx->Extensions.String)
+      ctx->Extensions.String = _mesa_make_extension_string(ctx);
+   if (!ctx->Extensions.String)
+      return GL_FALSE;
+
+   build[0] = sizeof(struct vp_instruction);
+   build[1] = sizeof(struct fp_instruction);
+   build[2] = sizeof(void *);
+   build[3] = CHAN_BITS;
+   build[4] = CACHE_FORMAT_VERSION;
+
+   hash_init(hash);
+   hash_bytes(hash, version, sizeof(version));
+   hash_bytes(hash, build, sizeof(build));
+   consts = ctx->Const;
+   consts.MaxProgramCacheItems = 0;  /* doesn't affect the programs */
+   hash_bytes(hash, &consts, sizeof(consts));
+   hash_bytes(hash, ctx->Extensions.String,
+              _mesa_strlen((const char *) ctx->Extensions.String));
+   hash_bytes(hash, &target, sizeof(target));
+   return GL_TRUE;
+}
+
+
+static void
+cache_file_name(const char *dir, const GLuint envHash[2], GLuint kind,
+                const void *key, GLuint keySize, char *path)
+{
+   GLuint hash[2];
+
+   hash[0] = envHash[0];
+   hash[1] = envHash[1];
+   hash_bytes(hash, &kind, sizeof(kind));
+   hash_bytes(hash, key, keySize);
+   _mesa_sprintf(path, "%s/%08x%08x.prog", dir, hash[0], hash[1]);
+}
+
+
+/**
+ * Return the number of instructions up to and including END, or 0 if
+ * the program can't be cached (instructions carrying PRINT strings).
+ */
+static GLuint
+count_instructions(GLenum target, const struct program *prog)
+{
+   GLuint i;
+
+   if (is_vertex_target(target)) {
+      const struct vertex_program *vprog =
+         (const struct vertex_program *) prog;
+      if (!vprog->Instructions)
+         return 0;
+      for (i = 0; ; i++) {
+         if (vprog->Instructions[i].Data)
+            return 0;
+         if (vprog->Instructions[i].Opcode == VP_OPCODE_END)
+            return i + 1;
+      }
+   }
+   else {
+      const struct fragment_program *fprog =
+         (const struct fragment_program *) prog;
+      if (!fprog->Instructions)
+         return 0;
+      for (i = 0; ; i++) {
+         if (fprog->Instructions[i].Data)
+            return 0;
+         if (fprog->Instructions[i].Opcode == FP_OPCODE_END)
+            return i + 1;
+      }
+   }
+}
+
+
+static void
+put_parameters(struct cache_buffer *buf,
+               const struct program_parameter_list *list)
+{
+   GLuint i, j;
+
+   for (i = 0; i < list->NumParameters; i++) {
+      const struct program_parameter *p = list->Parameters + i;
+      struct cache_parameter cp;
+
+      _mesa_bzero(&cp, sizeof(cp));
+      cp.Type = p->Type;
+      for (j = 0; j < 6; j++)
+         cp.StateIndexes[j] = p->StateIndexes[j];
+      cp.NameLength = p->Name ? _mesa_strlen(p->Name) + 1 : 0;
+      COPY_4V(cp.Values, list->ParameterValues[i]);
+
+      buffer_append(buf, &cp, sizeof(cp));
+      if (cp.NameLength)
+         buffer_append(buf, p->Name, cp.NameLength);
+   }
+}
+
+
+static struct program_parameter_list *
+get_parameters(struct cache_reader *r, GLuint count)
+{
+   struct program_parameter_list *list = _mesa_new_parameter_list();
+   GLuint i, j;
+
+   if (!list)
+      return NULL;
+   if (count == 0)
+      return list;
+
+   list->Parameters = (struct program_parameter *)
+      _mesa_calloc(count * sizeof(struct program_parameter));
+   list->ParameterValues = (GLfloat (*)[4])
+      ALIGN_MALLOC(count * 4 * sizeof(GLfloat), 16);
+   list->Size = count;
+   if (!list->Parameters || !list->ParameterValues) {
+      _mesa_free_parameter_list(list);
+      return NULL;
+   }
+
+   for (i = 0; i < count; i++) {
+      struct program_parameter *p = list->Parameters + i;
+      struct cache_parameter cp;
+
+      if (!reader_get(r, &cp, sizeof(cp)))
+         break;
+
+      p->Type = (enum parameter_type) cp.Type;
+      for (j = 0; j < 6; j++)
+         p->StateIndexes[j] = (enum state_index) cp.StateIndexes[j];
+      if (p->Type == STATE) {
+         p->StateFlags = _mesa_program_state_flags(p->StateIndexes);
+         list->StateFlags |= p->StateFlags;
+      }
+      COPY_4V(list->ParameterValues[i], cp.Values);
+
+      if (cp.NameLength) {
+         const GLubyte *name = reader_skip(r, cp.NameLength);
+         char *copy;
+         if (!name || name[cp.NameLength - 1] != 0)
+            break;
+         copy = (char *) _mesa_malloc(cp.NameLength);
+         if (!copy)
+            break;
+         _mesa_memcpy(copy, name, cp.NameLength);
+         p->Name = copy;
+      }
+      list->NumParameters = i + 1;
+   }
+
+   if (list->NumParameters != count) {
+      _mesa_free_parameter_list(list);
+      return NULL;
+   }
+   return list;
+}
+
+
+/**
+ * Look for a cached compilation of a program.
+ *
+ * \param target  the program target, as for glProgramStringARB
+ * \param kind  whether the key is a program string or a state key
+ * \param key  bytes identifying the program
+ * \param prog  program object to fill in on a hit.  Its instructions,
+ *              parameters and counters are replaced; the program string
+ *              is left to the caller.
+ * \return GL_TRUE if the program was found, GL_FALSE otherwise
+ */
+GLboolean
+_mesa_program_cache_load(GLcontext *ctx, GLenum target,
+                         enum program_cache_key_kind kind,
+                         const void *key, GLuint keySize,
+                         struct program *prog)
+{
+   const char *dir = cache_directory();
+   char path[MAX_CACHE_PATH];
+   GLuint envHash[2], checksum[2];
+   struct cache_header header;
+   struct cache_program_info info;
+   struct cache_reader r;
+   struct program_parameter_list *params = NULL;
+   const GLubyte *bytes;
+   GLubyte *data;
+   GLuint instSize;
+   void *inst;
+   long fileSize;
+   FILE *f;
+
+   if (!dir || !(is_vertex_target(target) || is_fragment_target(target)))
+      return GL_FALSE;
+   if (!environment_hash(ctx, target, envHash))
+      return GL_FALSE;
+
+   cache_file_name(dir, envHash, kind, key, keySize, path);
+   f = fopen(path, "rb");
+   if (!f)
+      return GL_FALSE;
+
+   if (fseek(f, 0, SEEK_END) != 0 ||
+       (fileSize = ftell(f)) < (long) sizeof(header) ||
+       fseek(f, 0, SEEK_SET) != 0) {
+      fclose(f);
+      return GL_FALSE;
+   }
+
+   data = (GLubyte *) _mesa_malloc(fileSize);
+   if (!data) {
+      fclose(f);
+      return GL_FALSE;
+   }
+   if (fread(data, 1, fileSize, f) != (size_t) fileSize) {
+      _mesa_free(data);
+      fclose(f);
+      return GL_FALSE;
+   }
+   fclose(f);
+
+   /* validate the entry */
+   _mesa_memcpy(&header, data, sizeof(header));
+   if (header.Magic != CACHE_MAGIC ||
+       header.EnvHash[0] != envHash[0] ||
+       header.EnvHash[1] != envHash[1] ||
+       header.Target != target ||
+       header.KeyKind != (GLuint) kind ||
+       header.KeySize != keySize ||
+       header.PayloadSize != (GLuint) fileSize - sizeof(header)) {
+      _mesa_free(data);
+      return GL_FALSE;
+   }
+
+   hash_init(checksum);
+   hash_bytes(checksum, data + sizeof(header), header.PayloadSize);
+   if (header.Checksum != checksum[0]) {
+      _mesa_free(data);
+      return GL_FALSE;
+   }
+
+   r.Pos = data + sizeof(header);
+   r.End = r.Pos + header.PayloadSize;
+
+   bytes = reader_skip(&r, keySize);
+   if (!bytes || memcmp(bytes, key, keySize) != 0 ||
+       !reader_get(&r, &info, sizeof(info)) ||
+       info.NumStoredInstructions == 0) {
+      _mesa_free(data);
+      return GL_FALSE;
+   }
+
+   /* instructions */
+   instSize = is_vertex_target(target) ? sizeof(struct vp_instruction)
+                                       : sizeof(struct fp_instruction);
+   bytes = reader_skip(&r, info.NumStoredInstructions * instSize);
+   if (!bytes) {
+      _mesa_free(data);
+      return GL_FALSE;
+   }
+   inst = _mesa_malloc(info.NumStoredInstructions * instSize);
+   if (!inst) {
+      _mesa_free(data);
+      return GL_FALSE;
+   }
+   _mesa_memcpy(inst, bytes, info.NumStoredInstructions * instSize);
+
+   /* parameters */
+   if (info.HasParameters) {
+      params = get_parameters(&r, info.NumProgramParameters);
+      if (!params) {
+         _mesa_free(inst);
+         _mesa_free(data);
+         return GL_FALSE;
+      }
+   }
+
+   _mesa_free(data);
+
+   /* install */
+   prog->Target = target;
+   prog->NumInstructions = info.NumInstructions;
+   prog->NumTemporaries = info.NumTemporaries;
+   prog->NumParameters = info.NumParameters;
+   prog->NumAttributes = info.NumAttributes;
+   prog->NumAddressRegs = info.NumAddressRegs;
+
+   if (is_vertex_target(target)) {
+      struct vertex_program *vprog = (struct vertex_program *) prog;
+      if (vprog->Instructions)
+         _mesa_free(vprog->Instructions);
+      vprog->Instructions = (struct vp_instruction *) inst;
+      vprog->IsNVProgram = (GLboolean) info.IsNVProgram;
+      vprog->IsPositionInvariant = (GLboolean) info.IsPositionInvariant;
+      vprog->InputsRead = info.InputsRead;
+      vprog->OutputsWritten = info.OutputsWritten;
+      if (params) {
+         if (vprog->Parameters)
+            _mesa_free_parameter_list(vprog->Parameters);
+         vprog->Parameters = params;
+      }
+   }
+   else {
+      struct fragment_program *fprog = (struct fragment_program *) prog;
+      GLuint i;
+      if (fprog->Instructions)
+         _mesa_free(fprog->Instructions);
+      fprog->Instructions = (struct fp_instruction *) inst;
+      fprog->InputsRead = info.InputsRead;
+      fprog->OutputsWritten = info.OutputsWritten;
+      for (i = 0; i < MAX_TEXTURE_IMAGE_UNITS; i++)
+         fprog->TexturesUsed[i] = info.TexturesUsed[i];
+      fprog->NumAluInstructions = info.NumAluInstructions;
+      fprog->NumTexInstructions = info.NumTexInstructions;
+      fprog->NumTexIndirections = info.NumTexIndirections;
+      fprog->FogOption = info.FogOption;
+      if (params) {
+         if (fprog->Parameters)
+            _mesa_free_parameter_list(fprog->Parameters);
+         fprog->Parameters = params;
+      }
+   }
+
+   return GL_TRUE;
+}
+
+
+/** Numbers the temporary files written by this process */
+_glthread_DECLARE_STATIC_MUTEX(TmpFileMutex);
+static GLuint TmpFileCount = 0;
+
+
+/**
+ * Write a successfully compiled program to the cache.  Failures are
+ * silently ignored; the cache is only an optimization.
+ * \sa _mesa_program_cache_load
+ */
+void
+_mesa_program_cache_store(GLcontext *ctx, GLenum target,
+                          enum program_cache_key_kind kind,
+                          const void *key, GLuint keySize,
+                          const struct program *prog)
+{
+   const char *dir = cache_directory();
+   char path[MAX_CACHE_PATH], tmpPath[MAX_CACHE_PATH + 32];
+   const struct program_parameter_list *params;
+   struct cache_program_info info;
+   struct cache_header header;
+   struct cache_buffer buf;
+   GLuint envHash[2], checksum[2];
+   GLuint instSize, tmpCount;
+   const void *inst;
+   GLboolean ok;
+   FILE *f;
+
+   if (!dir || !(is_vertex_target(target) || is_fragment_target(target)))
+      return;
+
+   _mesa_bzero(&info, sizeof(info));
+   info.NumStoredInstructions = count_instructions(target, prog);
+   if (info.NumStoredInstructions == 0)
+      return;
+
+   if (!environment_hash(ctx, target, envHash))
+      return;
+
+   info.NumInstructions = prog->NumInstructions;
+   info.NumTemporaries = prog->NumTemporaries;
+   info.NumParameters = prog->NumParameters;
+   info.NumAttributes = prog->NumAttributes;
+   info.NumAddressRegs = prog->NumAddressRegs;
+
+   if (is_vertex_target(target)) {
+      const struct vertex_program *vprog =
+         (const struct vertex_program *) prog;
+      info.IsNVProgram = vprog->IsNVProgram;
+      info.IsPositionInvariant = vprog->IsPositionInvariant;
+      info.InputsRead = vprog->InputsRead;
+      info.OutputsWritten = vprog->OutputsWritten;
+      params = vprog->Parameters;
+      inst = vprog->Instructions;
+      instSize = sizeof(struct vp_instruction);
+   }
+   else {
+      const struct fragment_program *fprog =
+         (const struct fragment_program *) prog;
+      GLuint i;
+      info.InputsRead = fprog->InputsRead;
+      info.OutputsWritten = fprog->OutputsWritten;
+      for (i = 0; i < MAX_TEXTURE_IMAGE_UNITS; i++)
+         info.TexturesUsed[i] = fprog->TexturesUsed[i];
+      info.NumAluInstructions = fprog->NumAluInstructions;
+      info.NumTexInstructions = fprog->NumTexInstructions;
+      info.NumTexIndirections = fprog->NumTexIndirections;
+      info.FogOption = fprog->FogOption;
+      params = fprog->Parameters;
+      inst = fprog->Instructions;
+      instSize = sizeof(struct fp_instruction);
+   }
+
+   if (params) {
+      info.HasParameters = GL_TRUE;
+      info.NumProgramParameters = params->NumParameters;
+   }
+
+   /* serialize */
+   _mesa_bzero(&buf, sizeof(buf));
+   buffer_append(&buf, key, keySize);
+   buffer_append(&buf, &info, sizeof(info));
+   buffer_append(&buf, inst, info.NumStoredInstructions * instSize);
+   if (params)
+      put_parameters(&buf, params);
+   if (buf.OutOfMemory) {
+      _mesa_free(buf.Data);
+      return;
+   }
+
+   hash_init(checksum);
+   hash_bytes(checksum, buf.Data, buf.Size);
+
+   _mesa_bzero(&header, sizeof(header));
+   header.Magic = CACHE_MAGIC;
+   header.EnvHash[0] = envHash[0];
+   header.EnvHash[1] = envHash[1];
+   header.Target = target;
+   header.KeyKind = kind;
+   header.KeySize = keySize;
+   header.PayloadSize = buf.Size;
+   header.Checksum = checksum[0];
+
+   /* Write to a temporary file and rename it into place so that other
+    * processes never see a partially written entry.  The process ID and
+    * a per-process counter make the temporary name unique.
+    */
+   cache_file_name(dir, envHash, kind, key, keySize, path);
+   _glthread_LOCK_MUTEX(TmpFileMutex);
+   tmpCount = TmpFileCount++;
+   _glthread_UNLOCK_MUTEX(TmpFileMutex);
+   _mesa_sprintf(tmpPath, "%s.%d.%u.tmp", path, (int) getpid(), tmpCount);
+
+   f = fopen(tmpPath, "wb");
+   if (!f) {
+      _mesa_free(buf.Data);
+      return;
+   }
+   ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+        fwrite(buf.Data, buf.Size, 1, f) == 1;
+   ok = (fclose(f) == 0) && ok;
+   _mesa_free(buf.Data);
+
+   if (!ok || rename(tmpPath, path) != 0)
+      remove(tmpPath);
+}
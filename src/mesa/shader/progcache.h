@@ -0,0 +1,111 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4.2
+ *
+ * Copyright (C) 1999-2006  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file progcache.h
+ * Program caches: a bounded in-memory cache of generated programs keyed
+ * by state, and a persistent on-disk cache of compiled programs.
+ */
+
+
+#ifndef PROGCACHE_H
+#define PROGCACHE_H
+
+#include "mtypes.h"
+
+
+struct program_cache_item
+{
+   GLuint Hash;
+   GLuint KeySize;
+   void *Key;
+   struct program *Program;
+   struct program_cache_item *Next;            /**< hash chain */
+   struct program_cache_item *Older, *Newer;   /**< LRU list */
+};
+
+
+/**
+ * Hash table of programs indexed by an arbitrary key, such as the state
+ * vectors the texenv and fixed-function vertex program generators use.
+ * Once more than MaxItems programs are cached, the least recently used
+ * one is released with the Delete callback.
+ */
+struct program_cache
+{
+   struct program_cache_item **Table;
+   GLuint TableSize;          /**< number of buckets, a power of two */
+   GLuint NumItems;
+   GLuint MaxItems;           /**< 0 means unbounded */
+   struct program_cache_item *Newest, *Oldest;
+   void (*Delete)(GLcontext *ctx, struct program *prog);
+
+   /** Statistics */
+   GLuint Hits, Misses, Evictions;
+};
+
+
+extern struct program_cache *
+_mesa_new_program_cache(GLuint maxItems,
+                        void (*deleteProgram)(GLcontext *, struct program *));
+
+extern void
+_mesa_delete_program_cache(GLcontext *ctx, struct program_cache *cache,
+                           const char *name);
+
+extern struct program *
+_mesa_search_program_cache(struct program_cache *cache,
+                           const void *key, GLuint keySize);
+
+extern void
+_mesa_insert_program_cache(GLcontext *ctx, struct program_cache *cache,
+                           const void *key, GLuint keySize,
+                           struct program *prog);
+
+
+/**
+ * What the key of an on-disk cache entry is.  Entries of different kinds
+ * never match, even if their key bytes happen to be the same.
+ */
+enum program_cache_key_kind
+{
+   PROGRAM_CACHE_TEXT,     /**< program string */
+   PROGRAM_CACHE_STATE     /**< fixed-function state key */
+};
+
+
+extern GLboolean
+_mesa_program_cache_load(GLcontext *ctx, GLenum target,
+                         enum program_cache_key_kind kind,
+                         const void *key, GLuint keySize,
+                         struct program *prog);
+
+extern void
+_mesa_program_cache_store(GLcontext *ctx, GLenum target,
+                          enum program_cache_key_kind kind,
+                          const void *key, GLuint keySize,
+                          const struct program *prog);
+
+
+#endif /* PROGCACHE_H */
@@ -53,17 +53,35 @@
 struct program _mesa_DummyProgram;
 
 
+/** Protects the counter handing out gl_program_state::_ContextId */
+_glthread_DECLARE_STATIC_MUTEX(ContextIdMutex);
+
+
 /**
  * Init context's vertex/fragment program state
  */
 void
 _mesa_init_program(GLcontext *ctx)
 {
+   static GLuint nextContextId = 1;
    GLuint i;
 
    ctx->Program.ErrorPos = -1;
    ctx->Program.ErrorString = _mesa_strdup("");
 
+   /* Parameter lists remember which context their STATE values came from;
+    * give each context a distinct id so a list used by several contexts
+    * (or by a new context at a recycled address) is reloaded in full.
+    */
+   _glthread_LOCK_MUTEX(ContextIdMutex);
+   ctx->Program._ContextId = nextContextId++;
+   if (!nextContextId)
+      nextContextId = 1;
+   _glthread_UNLOCK_MUTEX(ContextIdMutex);
+   ctx->Program._StateSerial = 0;
+   for (i = 0; i < 32; i++)
+      ctx->Program._GroupSerial[i] = 0;
+
 #if FEATURE_NV_vertex_program || FEATURE_ARB_vertex_program
    ctx->VertexProgram.Enabled = GL_FALSE;
    ctx->VertexProgram.PointSizeEnabled = GL_FALSE;
@@ -372,6 +390,8 @@ _mesa_free_parameters(struct program_parameter_list *paramList)
 	 _mesa_free((void *) paramList->Parameters[i].Name);
    }
    paramList->NumParameters = 0;
+   paramList->StateFlags = 0x0;
+   paramList->StateContextId = 0;
 }
 
 
@@ -485,10 +505,18 @@ _mesa_add_state_reference(struct program_parameter_list *paramList,
    GLint a, idx;
 
    idx = add_parameter(paramList, NULL, NULL, STATE);
-	
+   if (idx < 0)
+      return idx;
+
    for (a=0; a<6; a++)
       paramList->Parameters[idx].StateIndexes[a] = (enum state_index) stateTokens[a];
 
+   paramList->Parameters[idx].StateFlags =
+      _mesa_program_state_flags(paramList->Parameters[idx].StateIndexes);
+   paramList->StateFlags |= paramList->Parameters[idx].StateFlags;
+   /* the new entry has no value yet */
+   paramList->StateContextId = 0;
+
    return idx;
 }
 
@@ -928,27 +956,135 @@ _mesa_fetch_state(GLcontext *ctx, const enum state_index state[],
 
 
 /**
- * Loop over all the parameters in a parameter list.  If the parameter
+ * Return the _NEW_* state groups which the value of the given state
+ * reference (as produced by the program parsers) depends on.
+ */
+GLbitfield
+_mesa_program_state_flags(const enum state_index state[])
+{
+   switch (state[0]) {
+   case STATE_MATERIAL:
+   case STATE_LIGHT:
+   case STATE_LIGHTMODEL_AMBIENT:
+   case STATE_LIGHTMODEL_SCENECOLOR:
+   case STATE_LIGHTPROD:
+      return _NEW_LIGHT;
+
+   case STATE_TEXGEN:
+   case STATE_TEXENV_COLOR:
+      return _NEW_TEXTURE;
+
+   case STATE_FOG_COLOR:
+   case STATE_FOG_PARAMS:
+      return _NEW_FOG;
+
+   case STATE_CLIPPLANE:
+      return _NEW_TRANSFORM;
+
+   case STATE_POINT_SIZE:
+   case STATE_POINT_ATTENUATION:
+      return _NEW_POINT;
+
+   case STATE_MATRIX:
+      switch (state[1]) {
+      case STATE_MODELVIEW:
+         return _NEW_MODELVIEW;
+      case STATE_PROJECTION:
+         return _NEW_PROJECTION;
+      case STATE_MVP:
+         return _NEW_MODELVIEW | _NEW_PROJECTION;
+      case STATE_TEXTURE:
+         return _NEW_TEXTURE_MATRIX;
+      case STATE_PROGRAM:
+         return _NEW_TRACK_MATRIX;
+      default:
+         return _NEW_ALL;
+      }
+
+   case STATE_DEPTH_RANGE:
+      return _NEW_VIEWPORT;
+
+   case STATE_FRAGMENT_PROGRAM:
+   case STATE_VERTEX_PROGRAM:
+      return _NEW_PROGRAM;
+
+   case STATE_INTERNAL:
+      if (state[1] == STATE_NORMAL_SCALE)
+         return _NEW_MODELVIEW | _MESA_NEW_NEED_EYE_COORDS | _NEW_TRANSFORM;
+      return _NEW_ALL;
+
+   default:
+      return _NEW_ALL;
+   }
+}
+
+
+/**
+ * Note that the state groups in <newState> have changed, so that STATE
+ * parameters depending on them get reloaded by the next
+ * _mesa_load_state_parameters().  Called from _mesa_update_state(), and
+ * directly by code which changes such state without raising ctx->NewState
+ * (e.g. per-vertex material updates).
+ */
+void
+_mesa_program_state_changed(GLcontext *ctx, GLbitfield newState)
+{
+   const GLuint serial = ++ctx->Program._StateSerial;
+
+   while (newState) {
+      const GLint bit = ffs((int) newState) - 1;
+      ctx->Program._GroupSerial[bit] = serial;
+      newState &= ~(1u << bit);
+   }
+}
+
+
+/**
+ * Loop over the parameters in a parameter list.  If the parameter
  * is a GL state reference, look up the current value of that state
  * variable and put it into the parameter's Value[4] array.
  * This would be called at glBegin time when using a fragment program.
+ *
+ * Only the parameters whose state groups changed since the list was last
+ * loaded from this context are fetched again.
  */
 void
 _mesa_load_state_parameters(GLcontext *ctx,
                             struct program_parameter_list *paramList)
 {
+   GLbitfield dirty;
    GLuint i;
 
    if (!paramList)
       return;
 
+   if (paramList->StateContextId == ctx->Program._ContextId) {
+      GLbitfield flags = paramList->StateFlags;
+      dirty = 0x0;
+      while (flags) {
+         const GLint bit = ffs((int) flags) - 1;
+         if (ctx->Program._GroupSerial[bit] > paramList->StateSerial)
+            dirty |= 1u << bit;
+         flags &= ~(1u << bit);
+      }
+      if (!dirty)
+         return;
+   }
+   else {
+      dirty = _NEW_ALL;
+   }
+
    for (i = 0; i < paramList->NumParameters; i++) {
-      if (paramList->Parameters[i].Type == STATE) {
+      if (paramList->Parameters[i].Type == STATE &&
+          (paramList->Parameters[i].StateFlags & dirty)) {
          _mesa_fetch_state(ctx, 
 			   paramList->Parameters[i].StateIndexes,
                            paramList->ParameterValues[i]);
       }
    }
+
+   paramList->StateContextId = ctx->Program._ContextId;
+   paramList->StateSerial = ctx->Program._StateSerial;
 }
 
 
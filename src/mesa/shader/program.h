@@ -210,6 +210,7 @@ struct program_parameter
    const char *Name;                   /* Null-terminated */
    enum parameter_type Type;
    enum state_index StateIndexes[6];   /* Global state reference */
+   GLbitfield StateFlags;              /* _NEW_* groups the state depends on */
 };
 
 
@@ -219,6 +220,11 @@ struct program_parameter_list
    GLuint NumParameters;
    struct program_parameter *Parameters;
    GLfloat (*ParameterValues)[4];
+
+   /* Bookkeeping for _mesa_load_state_parameters() */
+   GLbitfield StateFlags;       /* union of the STATE parameters' flags */
+   GLuint StateContextId;       /* context the STATE values were loaded from */
+   GLuint StateSerial;          /* that context's state serial at the time */
 };
 
 
@@ -259,6 +265,12 @@ extern GLint
 _mesa_lookup_parameter_index(struct program_parameter_list *paramList,
                              GLsizei nameLen, const char *name);
 
+extern GLbitfield
+_mesa_program_state_flags(const enum state_index state[]);
+
+extern void
+_mesa_program_state_changed(GLcontext *ctx, GLbitfield newState);
+
 extern void
 _mesa_load_state_parameters(GLcontext *ctx,
                             struct program_parameter_list *paramList);
@@ -2270,100 +2270,124 @@ static const byte slang_vertex_builtin_gc_bin[] = {
 #include "library/slang_vertex_builtin_gc_bin.h"
 };
 
-int _slang_compile (const char *source, slang_translation_unit *unit, slang_unit_type type,
+/*
+	The slang grammar and the built-in library are the same for every shader, so they are
+	loaded once per process and shared by all subsequent compiles. There is a separate copy of
+	the built-in library for fragment and vertex shaders, as the grammar differs slightly between
+	them. The built-in units are never modified after they are loaded.
+	The grammar object carries per-compile state (registers, error message), so compiles run
+	with the grammar lock held. The lock also guards the statics below.
+*/
+
+static grammar slang_grammar = 0;
+static slang_translation_unit slang_fragment_builtins[3];
+static slang_translation_unit slang_vertex_builtins[3];
+static int slang_fragment_builtins_loaded = 0;
+static int slang_vertex_builtins_loaded = 0;
+
+static int load_builtins (grammar id, slang_translation_unit *builtin_units, slang_unit_type type,
+	slang_info_log *log)
+{
+	/*if (!compile_binary (slang_core_gc_bin, builtin_units,
+		slang_unit_fragment_builtin, log, NULL))*/
+	if (!compile_with_grammar (id, (const char*) slang_core_gc, builtin_units, slang_unit_fragment_builtin,
+		log, NULL))
+		return 0;
+	if (!compile_binary (slang_common_builtin_gc_bin, builtin_units + 1,
+		slang_unit_fragment_builtin, log, NULL))
+	{
+		slang_translation_unit_destruct (builtin_units);
+		return 0;
+	}
+	if (type == slang_unit_fragment_shader)
+	{
+		if (!compile_binary (slang_fragment_builtin_gc_bin, builtin_units + 2,
+			slang_unit_fragment_builtin, log, NULL))
+		{
+			slang_translation_unit_destruct (builtin_units);
+			slang_translation_unit_destruct (builtin_units + 1);
+			return 0;
+		}
+	}
+	else
+	{
+		if (!compile_binary (slang_vertex_builtin_gc_bin, builtin_units + 2,
+			slang_unit_vertex_builtin, log, NULL))
+		{
+			slang_translation_unit_destruct (builtin_units);
+			slang_translation_unit_destruct (builtin_units + 1);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static int compile_shader (const char *source, slang_translation_unit *unit, slang_unit_type type,
 	slang_info_log *log)
 {
-	grammar id;
-	slang_translation_unit builtin_units[3];
 	slang_translation_unit *builtins = NULL;
 
 	/* load slang grammar */
-	id = grammar_load_from_text ((const byte *) slang_shader_syn);
-	if (id == 0)
+	if (slang_grammar == 0)
 	{
-		char buf[1024];
-		unsigned int pos;
-		grammar_get_last_error ( (unsigned char*) buf, 1024, (int*) &pos);
-		slang_info_log_error (log, buf);
-		return 0;
+		slang_grammar = grammar_load_from_text ((const byte *) slang_shader_syn);
+		if (slang_grammar == 0)
+		{
+			char buf[1024];
+			unsigned int pos;
+			grammar_get_last_error ( (unsigned char*) buf, 1024, (int*) &pos);
+			slang_info_log_error (log, buf);
+			return 0;
+		}
 	}
 
 	/* set shader type - the syntax is slightly different for different shaders */
 	if (type == slang_unit_fragment_shader || type == slang_unit_fragment_builtin)
-		grammar_set_reg8 (id, (const byte *) "shader_type", 1);
+		grammar_set_reg8 (slang_grammar, (const byte *) "shader_type", 1);
 	else
-		grammar_set_reg8 (id, (const byte *) "shader_type", 2);
+		grammar_set_reg8 (slang_grammar, (const byte *) "shader_type", 2);
 
 	/* enable language extensions */
-	grammar_set_reg8 (id, (const byte *) "parsing_builtin", 1);
+	grammar_set_reg8 (slang_grammar, (const byte *) "parsing_builtin", 1);
 
 	/* if parsing user-specified shader, load built-in library */
-	if (type == slang_unit_fragment_shader || type == slang_unit_vertex_shader)
+	if (type == slang_unit_fragment_shader)
 	{
-		/*if (!compile_binary (slang_core_gc_bin, builtin_units,
-			slang_unit_fragment_builtin, log, NULL))*/
-		if (!compile_with_grammar (id, (const char*) slang_core_gc, builtin_units, slang_unit_fragment_builtin,
-			log, NULL))
-		{
-			grammar_destroy (id);
-			return 0;
-		}
-		if (!compile_binary (slang_common_builtin_gc_bin, builtin_units + 1,
-			slang_unit_fragment_builtin, log, NULL))
-		{
-			slang_translation_unit_destruct (builtin_units);
-			grammar_destroy (id);
-			return 0;
-		}
-		if (type == slang_unit_fragment_shader)
+		if (!slang_fragment_builtins_loaded)
 		{
-			if (!compile_binary (slang_fragment_builtin_gc_bin, builtin_units + 2,
-				slang_unit_fragment_builtin, log, NULL))
-			{
-				slang_translation_unit_destruct (builtin_units);
-				slang_translation_unit_destruct (builtin_units + 1);
-				grammar_destroy (id);
+			if (!load_builtins (slang_grammar, slang_fragment_builtins, type, log))
 				return 0;
-			}
+			slang_fragment_builtins_loaded = 1;
 		}
-		else if (type == slang_unit_vertex_shader)
+		builtins = slang_fragment_builtins;
+	}
+	else if (type == slang_unit_vertex_shader)
+	{
+		if (!slang_vertex_builtins_loaded)
 		{
-			if (!compile_binary (slang_vertex_builtin_gc_bin, builtin_units + 2,
-				slang_unit_vertex_builtin, log, NULL))
-			{
-				slang_translation_unit_destruct (builtin_units);
-				slang_translation_unit_destruct (builtin_units + 1);
-				grammar_destroy (id);
+			if (!load_builtins (slang_grammar, slang_vertex_builtins, type, log))
 				return 0;
-			}
+			slang_vertex_builtins_loaded = 1;
 		}
-
-		/* disable language extensions */
-		grammar_set_reg8 (id, (const byte *) "parsing_builtin", 0);
-		builtins = builtin_units;
+		builtins = slang_vertex_builtins;
 	}
 
+	/* disable language extensions */
+	if (builtins != NULL)
+		grammar_set_reg8 (slang_grammar, (const byte *) "parsing_builtin", 0);
+
 	/* compile the actual shader - pass-in built-in library for external shader */
-	if (!compile_with_grammar (id, source, unit, type, log, builtins))
-	{
-		if (type == slang_unit_fragment_shader || type == slang_unit_vertex_shader)
-		{
-			slang_translation_unit_destruct (builtin_units);
-			slang_translation_unit_destruct (builtin_units + 1);
-			slang_translation_unit_destruct (builtin_units + 2);
-		}
-		grammar_destroy (id);
-		return 0;
-	}
+	return compile_with_grammar (slang_grammar, source, unit, type, log, builtins);
+}
 
-	/* destroy built-in library */
-	if (type == slang_unit_fragment_shader || type == slang_unit_vertex_shader)
-	{
-		slang_translation_unit_destruct (builtin_units);
-		slang_translation_unit_destruct (builtin_units + 1);
-		slang_translation_unit_destruct (builtin_units + 2);
-	}
-	grammar_destroy (id);
-	return 1;
+int _slang_compile (const char *source, slang_translation_unit *unit, slang_unit_type type,
+	slang_info_log *log)
+{
+	int success;
+
+	grammar_lock ();
+	success = compile_shader (source, unit, type, log);
+	grammar_unlock ();
+	return success;
 }
 
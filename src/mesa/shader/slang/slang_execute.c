@@ -180,43 +180,115 @@ static void dump (const slang_assembly_file *file)
 	fclose (f);
 }
 
-int _slang_execute (const slang_assembly_file *file)
+/*
+ * All the invocations of a batch run the same instruction stream in lockstep, so the
+ * instruction pointer, stack pointer and base pointer are shared and every instruction
+ * is dispatched once for the whole batch. Lanes only ever touch their own column of the
+ * stack.
+ *
+ * When jump_if_zero disagrees between lanes, the batch is split into contiguous runs of
+ * lanes that take the same branch and each run continues on its own until it reaches the
+ * reconvergence point - the end of the if/else or loop as the assembler lays it out -
+ * with the same stack and base pointer it had at the branch. If every run gets there,
+ * the whole batch continues together; otherwise the runs finish separately. Returns and
+ * leaves whose saved addresses differ between lanes split the batch the same way. Every
+ * split runs fewer lanes than its parent, so the recursion is at most
+ * SLANG_MACHINE_BATCH_SIZE deep.
+ */
+
+typedef struct slang_machine_state_
 {
-	slang_machine mach;
-	FILE *f;
+	GLuint ip;
+	GLuint sp;
+	GLuint bp;
+} slang_machine_state;
 
-	mach.ip = 0;
-	mach.sp = SLANG_MACHINE_STACK_SIZE;
-	mach.bp = 0;
-	mach.kill = 0;
-	mach.exit = 0;
-
-	/* assume 32-bit machine */
-	/* XXX why???, disabling the pointer size assertions here.
-	 * See bug 4021.
-	 */
-	static_assert(sizeof (GLfloat) == 4);
-	/*static_assert(sizeof (GLfloat *) == 4);*/
-	static_assert(sizeof (GLuint) == 4);
-	/*static_assert(sizeof (GLuint *) == 4);*/
+/* execute_lanes results */
+#define BATCH_ERROR 0
+#define BATCH_EXIT 1
+#define BATCH_STOP 2
 
-	dump (file);
+/* byte address to stack slot, wrapped so that bad addresses can not leave the stack */
+#define SLOT(addr) (((addr) >> 2) & (SLANG_MACHINE_STACK_SIZE - 1))
+
+/* stack slots indexed directly must lie above the stack pointer and below the bottom */
+#define CHECK_SLOT(slot) if ((slot) >= SLANG_MACHINE_STACK_SIZE) return BATCH_ERROR
 
-	f = fopen ("~mesa-slang-assembly-execution.txt", "w");
+static int execute_lanes (const slang_assembly_file *, slang_machine *,
+	slang_machine_state, GLuint, GLuint, const slang_machine_state *);
 
-	while (!mach.exit)
+/*
+ * Execute the instruction at st.ip separately for every run of consecutive lanes that
+ * agree on the address held in the given stack slot, then finish those lanes.
+ */
+static int split_on_addr (const slang_assembly_file *file, slang_machine *mach,
+	slang_machine_state st, GLuint first, GLuint last, GLuint slot)
+{
+	const GLuint *addr = mach->stack[slot]._addr;
+	GLuint l = first;
+
+	while (l < last)
 	{
-		slang_assembly *a = file->code + mach.ip;
-		if (f != NULL)
-		{
-			unsigned int i;
-			dump_instruction (f, a, mach.ip);
-			fprintf (f, "\t\tsp=%u bp=%u\n", mach.sp, mach.bp);
-			for (i = mach.sp; i < SLANG_MACHINE_STACK_SIZE; i++)
-				fprintf (f, "\t%.5u\t%6f\t%u\n", i, mach.stack._float[i], mach.stack._addr[i]);
-			fflush (f);
-		}
-		mach.ip++;
+		GLuint end = l + 1;
+
+		while (end < last && addr[end] == addr[l])
+			end++;
+		if (execute_lanes (file, mach, st, l, end, NULL) == BATCH_ERROR)
+			return BATCH_ERROR;
+		l = end;
+	}
+	return BATCH_EXIT;
+}
+
+/*
+ * Return the instruction where both sides of the conditional jump at ip meet again. The
+ * assembler ends the "then" part of an if/else with a forward jump over the "else" part;
+ * for plain ifs and loops the jump target itself is the meeting point.
+ */
+static GLuint reconvergence_point (const slang_assembly_file *file, GLuint ip)
+{
+	const GLuint target = file->code[ip].param[0];
+
+	if (target > ip + 1 && target <= file->count &&
+		file->code[target - 1].type == slang_asm_jump && file->code[target - 1].param[0] > target)
+		return file->code[target - 1].param[0];
+	return target;
+}
+
+static void trace_instruction (FILE *f, const slang_assembly_file *file,
+	const slang_machine *mach, slang_machine_state st, GLuint lane)
+{
+	GLuint i;
+
+	dump_instruction (f, file->code + st.ip, st.ip);
+	fprintf (f, "\t\tsp=%u bp=%u\n", st.sp, st.bp);
+	for (i = st.sp; i < SLANG_MACHINE_STACK_SIZE; i++)
+		fprintf (f, "\t%.5u\t%6f\t%u\n", i, mach->stack[i]._float[lane], mach->stack[i]._addr[lane]);
+	fflush (f);
+}
+
+/*
+ * Run lanes [first, last) from state st until the exit instruction or, if stop is given,
+ * until they all reach the stop state.
+ */
+static int execute_lanes (const slang_assembly_file *file, slang_machine *mach,
+	slang_machine_state st, GLuint first, GLuint last, const slang_machine_state *stop)
+{
+	slang_machine_slot *stack = mach->stack;
+	GLuint l;
+
+	for (;;)
+	{
+		const slang_assembly *a;
+
+		if (stop != NULL && st.ip == stop->ip && st.sp == stop->sp && st.bp == stop->bp)
+			return BATCH_STOP;
+		if (st.ip >= file->count || st.sp > SLANG_MACHINE_STACK_SIZE)
+			return BATCH_ERROR;
+		if (mach->trace != NULL && first == 0)
+			trace_instruction (mach->trace, file, mach, st, first);
+		a = file->code + st.ip;
+		st.ip++;
 
 		switch (a->type)
 		{
@@ -225,128 +297,323 @@ int _slang_execute (const slang_assembly_file *file)
 		case slang_asm_float_copy:
 		case slang_asm_int_copy:
 		case slang_asm_bool_copy:
-			*(mach.stack._floatp[mach.sp + a->param[0] / 4] + a->param[1] / 4) =
-				mach.stack._float[mach.sp];
-			mach.sp++;
+			CHECK_SLOT (st.sp + a->param[0] / 4);
+			CHECK_SLOT (st.sp);
+			{
+				const slang_machine_slot *dst = stack + st.sp + a->param[0] / 4;
+				for (l = first; l < last; l++)
+					stack[SLOT (dst->_addr[l] + a->param[1])]._float[l] = stack[st.sp]._float[l];
+				st.sp++;
+			}
 			break;
 		case slang_asm_float_move:
 		case slang_asm_int_move:
 		case slang_asm_bool_move:
-			mach.stack._float[mach.sp + a->param[0] / 4] =
-				mach.stack._float[mach.sp + (mach.stack._addr[mach.sp] + a->param[1]) / 4];
+			CHECK_SLOT (st.sp + a->param[0] / 4);
+			CHECK_SLOT (st.sp);
+			for (l = first; l < last; l++)
+				stack[st.sp + a->param[0] / 4]._float[l] =
+					stack[SLOT (st.sp * 4 + stack[st.sp]._addr[l] + a->param[1])]._float[l];
 			break;
 		case slang_asm_float_push:
 		case slang_asm_int_push:
 		case slang_asm_bool_push:
-			mach.sp--;
-			mach.stack._float[mach.sp] = a->literal;
+			if (st.sp == 0)
+				return BATCH_ERROR;
+			st.sp--;
+			for (l = first; l < last; l++)
+				stack[st.sp]._float[l] = a->literal;
 			break;
 		case slang_asm_float_deref:
 		case slang_asm_int_deref:
 		case slang_asm_bool_deref:
-			mach.stack._float[mach.sp] = *mach.stack._floatp[mach.sp];
+			CHECK_SLOT (st.sp);
+			for (l = first; l < last; l++)
+				stack[st.sp]._float[l] = stack[SLOT (stack[st.sp]._addr[l])]._float[l];
 			break;
 		case slang_asm_float_add:
-			mach.stack._float[mach.sp + 1] += mach.stack._float[mach.sp];
-			mach.sp++;
+			CHECK_SLOT (st.sp + 1);
+			{
+				GLfloat *dst = stack[st.sp + 1]._float;
+				const GLfloat *src = stack[st.sp]._float;
+				for (l = first; l < last; l++)
+					dst[l] += src[l];
+				st.sp++;
+			}
 			break;
 		case slang_asm_float_multiply:
-			mach.stack._float[mach.sp + 1] *= mach.stack._float[mach.sp];
-			mach.sp++;
+			CHECK_SLOT (st.sp + 1);
+			{
+				GLfloat *dst = stack[st.sp + 1]._float;
+				const GLfloat *src = stack[st.sp]._float;
+				for (l = first; l < last; l++)
+					dst[l] *= src[l];
+				st.sp++;
+			}
 			break;
 		case slang_asm_float_divide:
-			mach.stack._float[mach.sp + 1] /= mach.stack._float[mach.sp];
-			mach.sp++;
+			CHECK_SLOT (st.sp + 1);
+			{
+				GLfloat *dst = stack[st.sp + 1]._float;
+				const GLfloat *src = stack[st.sp]._float;
+				for (l = first; l < last; l++)
+					dst[l] /= src[l];
+				st.sp++;
+			}
 			break;
 		case slang_asm_float_negate:
-			mach.stack._float[mach.sp] = -mach.stack._float[mach.sp];
+			CHECK_SLOT (st.sp);
+			{
+				GLfloat *dst = stack[st.sp]._float;
+				for (l = first; l < last; l++)
+					dst[l] = -dst[l];
+			}
 			break;
 		case slang_asm_float_less:
-			mach.stack._float[mach.sp + 1] =
-				mach.stack._float[mach.sp + 1] < mach.stack._float[mach.sp] ? 1.0f : 0.0f;
-			mach.sp++;
+			CHECK_SLOT (st.sp + 1);
+			{
+				GLfloat *dst = stack[st.sp + 1]._float;
+				const GLfloat *src = stack[st.sp]._float;
+				for (l = first; l < last; l++)
+					dst[l] = dst[l] < src[l] ? 1.0f : 0.0f;
+				st.sp++;
+			}
 			break;
 		case slang_asm_float_equal:
-			mach.sp--;
-			mach.stack._float[mach.sp] = mach.stack._float[mach.sp + 1 + a->param[0] / 4] ==
-				mach.stack._float[mach.sp + 1 + a->param[1] / 4] ? 1.0f : 0.0f;
+			if (st.sp == 0)
+				return BATCH_ERROR;
+			st.sp--;
+			CHECK_SLOT (st.sp + 1 + a->param[0] / 4);
+			CHECK_SLOT (st.sp + 1 + a->param[1] / 4);
+			{
+				const GLfloat *x = stack[st.sp + 1 + a->param[0] / 4]._float;
+				const GLfloat *y = stack[st.sp + 1 + a->param[1] / 4]._float;
+				GLfloat *dst = stack[st.sp]._float;
+				for (l = first; l < last; l++)
+					dst[l] = x[l] == y[l] ? 1.0f : 0.0f;
+			}
 			break;
 		case slang_asm_float_to_int:
-			mach.stack._float[mach.sp] = (GLfloat) (GLint) mach.stack._float[mach.sp];
+			CHECK_SLOT (st.sp);
+			{
+				GLfloat *dst = stack[st.sp]._float;
+				for (l = first; l < last; l++)
+					dst[l] = (GLfloat) (GLint) dst[l];
+			}
 			break;
 		case slang_asm_int_to_float:
 			break;
 		case slang_asm_int_to_addr:
-			mach.stack._addr[mach.sp] = (GLuint) (GLint) mach.stack._float[mach.sp];
+			CHECK_SLOT (st.sp);
+			for (l = first; l < last; l++)
+				stack[st.sp]._addr[l] = (GLuint) (GLint) stack[st.sp]._float[l];
 			break;
 		case slang_asm_addr_copy:
-			*mach.stack._addrp[mach.sp + 1] = mach.stack._addr[mach.sp];
-			mach.sp++;
+			CHECK_SLOT (st.sp + 1);
+			for (l = first; l < last; l++)
+				stack[SLOT (stack[st.sp + 1]._addr[l])]._addr[l] = stack[st.sp]._addr[l];
+			st.sp++;
 			break;
 		case slang_asm_addr_push:
-			mach.sp--;
-			mach.stack._addr[mach.sp] = a->param[0];
+			if (st.sp == 0)
+				return BATCH_ERROR;
+			st.sp--;
+			for (l = first; l < last; l++)
+				stack[st.sp]._addr[l] = a->param[0];
 			break;
 		case slang_asm_addr_deref:
-			mach.stack._addr[mach.sp] = *mach.stack._addrp[mach.sp];
+			CHECK_SLOT (st.sp);
+			for (l = first; l < last; l++)
+				stack[st.sp]._addr[l] = stack[SLOT (stack[st.sp]._addr[l])]._addr[l];
 			break;
 		case slang_asm_addr_add:
-			mach.stack._addr[mach.sp + 1] += mach.stack._addr[mach.sp];
-			mach.sp++;
+			CHECK_SLOT (st.sp + 1);
+			for (l = first; l < last; l++)
+				stack[st.sp + 1]._addr[l] += stack[st.sp]._addr[l];
+			st.sp++;
 			break;
 		case slang_asm_addr_multiply:
-			mach.stack._addr[mach.sp + 1] *= mach.stack._addr[mach.sp];
-			mach.sp++;
+			CHECK_SLOT (st.sp + 1);
+			for (l = first; l < last; l++)
+				stack[st.sp + 1]._addr[l] *= stack[st.sp]._addr[l];
+			st.sp++;
 			break;
 		case slang_asm_jump:
-			mach.ip = a->param[0];
+			st.ip = a->param[0];
 			break;
 		case slang_asm_jump_if_zero:
-			if (mach.stack._float[mach.sp] == 0.0f)
-				mach.ip = a->param[0];
-			mach.sp++;
+			CHECK_SLOT (st.sp);
+			{
+				const GLfloat *cond = stack[st.sp]._float;
+				GLuint zeros = 0;
+
+				st.sp++;
+				for (l = first; l < last; l++)
+					zeros += cond[l] == 0.0f;
+
+				if (zeros == last - first)
+					st.ip = a->param[0];
+				else if (zeros != 0)
+				{
+					slang_machine_state join;
+					GLboolean joined = GL_TRUE;
+
+					join.ip = reconvergence_point (file, st.ip - 1);
+					join.sp = st.sp;
+					join.bp = st.bp;
+
+					/* run each group of agreeing lanes up to the join point */
+					l = first;
+					while (l < last)
+					{
+						const GLboolean zero = cond[l] == 0.0f;
+						slang_machine_state run = st;
+						GLuint end = l + 1;
+						int result;
+
+						while (end < last && (cond[end] == 0.0f) == zero)
+							end++;
+						if (zero)
+							run.ip = a->param[0];
+						result = execute_lanes (file, mach, run, l, end, &join);
+						if (result == BATCH_ERROR)
+							return BATCH_ERROR;
+						if (result == BATCH_EXIT)
+							joined = GL_FALSE;
+						l = end;
+					}
+
+					if (!joined)
+					{
+						/* some lanes left for good - finish the others on their own */
+						l = first;
+						while (l < last)
+						{
+							GLuint end = l + 1;
+
+							while (end < last && (cond[end] == 0.0f) == (cond[l] == 0.0f))
+								end++;
+							if (!mach->exited[l] &&
+								execute_lanes (file, mach, join, l, end, NULL) == BATCH_ERROR)
+								return BATCH_ERROR;
+							l = end;
+						}
+						return BATCH_EXIT;
+					}
+
+					st = join;
+				}
+			}
 			break;
 		case slang_asm_enter:
-			mach.sp--;
-			mach.stack._addr[mach.sp] = mach.bp;
-			mach.bp = mach.sp + a->param[0] / 4;
+			if (st.sp == 0)
+				return BATCH_ERROR;
+			st.sp--;
+			for (l = first; l < last; l++)
+				stack[st.sp]._addr[l] = st.bp;
+			st.bp = st.sp + a->param[0] / 4;
 			break;
 		case slang_asm_leave:
-			mach.bp = mach.stack._addr[mach.sp];
-			mach.sp++;
+			CHECK_SLOT (st.sp);
+			for (l = first + 1; l < last; l++)
+				if (stack[st.sp]._addr[l] != stack[st.sp]._addr[first])
+				{
+					st.ip--;
+					return split_on_addr (file, mach, st, first, last, st.sp);
+				}
+			st.bp = stack[st.sp]._addr[first];
+			st.sp++;
 			break;
 		case slang_asm_local_alloc:
-			mach.sp -= a->param[0] / 4;
+			if (a->param[0] / 4 > st.sp)
+				return BATCH_ERROR;
+			st.sp -= a->param[0] / 4;
 			break;
 		case slang_asm_local_free:
-			mach.sp += a->param[0] / 4;
+			st.sp += a->param[0] / 4;
 			break;
 		case slang_asm_local_addr:
-			mach.sp--;
-			mach.stack._addr[mach.sp] = (GLuint) mach.stack._addr + mach.bp * 4 -
-				(a->param[0] + a->param[1]) + 4;
+			if (st.sp == 0)
+				return BATCH_ERROR;
+			st.sp--;
+			for (l = first; l < last; l++)
+				stack[st.sp]._addr[l] = st.bp * 4 - (a->param[0] + a->param[1]) + 4;
 			break;
 		case slang_asm_call:
-			mach.sp--;
-			mach.stack._addr[mach.sp] = mach.ip;
-			mach.ip = a->param[0];
+			if (st.sp == 0)
+				return BATCH_ERROR;
+			st.sp--;
+			for (l = first; l < last; l++)
+				stack[st.sp]._addr[l] = st.ip;
+			st.ip = a->param[0];
 			break;
 		case slang_asm_return:
-			mach.ip = mach.stack._addr[mach.sp];
-			mach.sp++;
+			CHECK_SLOT (st.sp);
+			for (l = first + 1; l < last; l++)
+				if (stack[st.sp]._addr[l] != stack[st.sp]._addr[first])
+				{
+					st.ip--;
+					return split_on_addr (file, mach, st, first, last, st.sp);
+				}
+			st.ip = stack[st.sp]._addr[first];
+			st.sp++;
 			break;
 		case slang_asm_discard:
-			mach.kill = 1;
+			for (l = first; l < last; l++)
+				mach->kill[l] = 1;
 			break;
 		case slang_asm_exit:
-			mach.exit = 1;
-			break;
+			for (l = first; l < last; l++)
+				mach->exited[l] = 1;
+			return BATCH_EXIT;
+		default:
+			return BATCH_ERROR;
 		}
 	}
+}
 
-	if (f != NULL)
-		fclose (f);
+/*
+ * Run the program for the first count invocations of the machine. The stack is not
+ * cleared, so the caller can place inputs in it beforehand. Returns 0 on malformed code
+ * or stack overflow.
+ */
+int _slang_execute_batch (const slang_assembly_file *file, slang_machine *mach, GLuint count)
+{
+	slang_machine_state st;
+	GLuint l;
 
-	return 0;
+	if (count == 0 || count > SLANG_MACHINE_BATCH_SIZE)
+		return 0;
+
+	mach->count = count;
+	for (l = 0; l < count; l++)
+	{
+		mach->kill[l] = 0;
+		mach->exited[l] = 0;
+	}
+
+	st.ip = 0;
+	st.sp = SLANG_MACHINE_STACK_SIZE;
+	st.bp = 0;
+	return execute_lanes (file, mach, st, 0, count, NULL) != BATCH_ERROR;
 }
 
+int _slang_execute (const slang_assembly_file *file)
+{
+	slang_machine *mach;
+	int result;
+
+	mach = (slang_machine *) slang_alloc_malloc (sizeof (slang_machine));
+	if (mach == NULL)
+		return 0;
+
+	dump (file);
+
+	mach->trace = fopen ("~mesa-slang-assembly-execution.txt", "w");
+	result = _slang_execute_batch (file, mach, 1);
+	if (mach->trace != NULL)
+		fclose (mach->trace);
+
+	slang_alloc_free (mach);
+	return result;
+}
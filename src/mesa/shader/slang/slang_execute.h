@@ -29,26 +29,41 @@
 extern "C" {
 #endif
 
-#define SLANG_MACHINE_STACK_SIZE 1024
+#define SLANG_MACHINE_STACK_SIZE 1024	/* in slots, a power of two */
 
+/*
+ * Number of invocations (vertices or fragments) _slang_execute_batch runs together.
+ */
+#define SLANG_MACHINE_BATCH_SIZE 16
+
+/*
+ * One stack slot of the machine, holding the value of every invocation in
+ * structure-of-arrays form so that arithmetic runs over contiguous lanes.
+ */
+typedef union slang_machine_slot_
+{
+	GLfloat _float[SLANG_MACHINE_BATCH_SIZE];
+	GLuint _addr[SLANG_MACHINE_BATCH_SIZE];
+} slang_machine_slot;
+
+/*
+ * Addresses are byte offsets into the invocation's own stack rather than pointers,
+ * so each lane dereferences its own column. The caller can pass data in and out
+ * through stack slots the program addresses directly.
+ */
 typedef struct slang_machine_
 {
-	GLuint ip;					/* instruction pointer, for flow control */
-	GLuint sp;					/* stack pointer, for stack access */
-	GLuint bp;					/* base pointer, for local variable access */
-	GLuint kill;				/* discard the fragment */
-	GLuint exit;				/* terminate the shader */
-	union stack_
-	{
-		GLfloat _float[SLANG_MACHINE_STACK_SIZE];
-		GLfloat *_floatp[SLANG_MACHINE_STACK_SIZE];
-		GLuint _addr[SLANG_MACHINE_STACK_SIZE];
-		GLuint *_addrp[SLANG_MACHINE_STACK_SIZE];
-	} stack;
+	GLuint count;				/* number of invocations in the batch */
+	GLuint kill[SLANG_MACHINE_BATCH_SIZE];	/* discard the fragment */
+	GLuint exited[SLANG_MACHINE_BATCH_SIZE];	/* invocation has finished */
+	FILE *trace;				/* per-instruction log of the first lane, or NULL */
+	slang_machine_slot stack[SLANG_MACHINE_STACK_SIZE];
 } slang_machine;
 
 int _slang_execute (const slang_assembly_file *);
 
+int _slang_execute_batch (const slang_assembly_file *, slang_machine *, GLuint count);
+
 #ifdef __cplusplus
 }
 #endif
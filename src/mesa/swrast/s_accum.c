@@ -31,6 +31,7 @@
 
 #include "s_accum.h"
 #include "s_context.h"
+#include "s_damage.h"
 #include "s_masking.h"
 #include "s_span.h"
 
@@ -551,6 +552,9 @@ _swrast_Accum( GLcontext *ctx, GLenum op, GLfloat value,
       return;
    }
 
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
+
    RENDER_START(swrast, ctx);
 
    switch (op) {
@@ -573,6 +577,7 @@ _swrast_Accum( GLcontext *ctx, GLenum op, GLfloat value,
          accum_load(ctx, value, xpos, ypos, width, height);
 	 break;
       case GL_RETURN:
+         _swrast_damage_pixels(ctx, xpos, ypos, width, height, GL_FALSE);
          accum_return(ctx, value, xpos, ypos, width, height);
 	 break;
       default:
@@ -24,6 +24,7 @@
 #include "colormac.h"
 #include "context.h"
 #include "atifragshader.h"
+#include "imports.h"
 #include "macros.h"
 #include "program.h"
 
@@ -32,594 +33,825 @@
 #include "s_span.h"
 #include "s_texture.h"
 
-/**
- * Fetch a texel.
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define ATIFS_USE_SSE2
+#endif
+
+struct ati_fs_opcode_st ati_fs_opcodes[] = {
+   {GL_ADD_ATI, 2},
+   {GL_SUB_ATI, 2},
+   {GL_MUL_ATI, 2},
+   {GL_MAD_ATI, 3},
+   {GL_LERP_ATI, 3},
+   {GL_MOV_ATI, 1},
+   {GL_CND_ATI, 3},
+   {GL_CND0_ATI, 3},
+   {GL_DOT2_ADD_ATI, 3},
+   {GL_DOT3_ATI, 2},
+   {GL_DOT4_ATI, 2}
+};
+
+
+
+/*
+ * The shader is translated into a list of atifs_ops when it is bound,
+ * and the list is then run over a span ATIFS_CHUNK fragments at a time.
+ * Registers are kept as structure-of-arrays so that every operation is
+ * a unit-stride loop over the fragments.
  */
+#define ATIFS_CHUNK 64
+
+#define ATIFS_MAX_OPS \
+   (2 * MAX_NUM_PASSES_ATI * MAX_NUM_INSTRUCTIONS_PER_PASS_ATI + 1)
+
+enum atifs_op_kind {
+   ATIFS_OP_SAVE,		/**< start of pass two: save the registers */
+   ATIFS_OP_PASS_TEXCOORD,	/**< dst = texcoord[unit] */
+   ATIFS_OP_PASS_PREV,		/**< dst = first pass register */
+   ATIFS_OP_SWIZZLE,		/**< dst is only swizzled */
+   ATIFS_OP_SAMPLE_TEXCOORD,	/**< dst = texture[unit](texcoord[unit]) */
+   ATIFS_OP_SAMPLE_REG,		/**< dst = texture[reg](reg) */
+   ATIFS_OP_ALU
+};
+
+enum atifs_file {
+   ATIFS_FILE_REG,
+   ATIFS_FILE_INPUT,
+   ATIFS_FILE_CONST,
+   ATIFS_FILE_ONE,
+   ATIFS_FILE_ZERO
+};
+
+struct atifs_src {
+   GLubyte File, Index;
+   GLubyte Swz[4];		/**< channel read for each channel (argRep) */
+   GLuint Mod;
+};
+
+struct atifs_op {
+   GLubyte Kind;
+   GLubyte Dst[2];		/**< per optype for ALU ops */
+   GLubyte Unit;		/**< texcoord/register for pass and sample */
+   GLenum Swizzle;
+   GLenum Opcode[2];
+   GLuint NumArgs[2];
+   GLuint Chans[2];		/**< source channels fetched per optype */
+   GLuint WriteMask;		/**< color channels written */
+   GLuint DstMod[2];
+   struct atifs_src Src[2][3];
+};
+
+struct atifs_span_program {
+   const struct ati_fragment_shader *Shader;
+   struct atifs_op Ops[ATIFS_MAX_OPS];
+   GLuint NumOps;
+   GLboolean UsesInput[2];
+
+   /* per chunk storage */
+   GLfloat Reg[MAX_NUM_FRAGMENT_REGISTERS_ATI][4][ATIFS_CHUNK];
+   GLfloat PrevReg[MAX_NUM_FRAGMENT_REGISTERS_ATI][4][ATIFS_CHUNK];
+   GLfloat Input[2][4][ATIFS_CHUNK];
+   GLfloat Src[2][3][4][ATIFS_CHUNK];
+   GLfloat Dst[4][ATIFS_CHUNK];
+   GLfloat Coords[ATIFS_CHUNK][4];
+   GLfloat Lambda[ATIFS_CHUNK];
+   GLchan Texel[ATIFS_CHUNK][4];
+};
+
+
+static GLuint
+rep_channel(GLuint rep, GLuint chan)
+{
+   switch (rep) {
+   case GL_RED:
+      return 0;
+   case GL_GREEN:
+      return 1;
+   case GL_BLUE:
+      return 2;
+   case GL_ALPHA:
+      return 3;
+   default:
+      return chan;
+   }
+}
+
 static void
-fetch_texel(GLcontext * ctx, const GLfloat texcoord[4], GLfloat lambda,
-	    GLuint unit, GLfloat color[4])
+translate_src(struct atifs_span_program *p,
+	      const struct atifragshader_src_register *reg,
+	      struct atifs_src *src)
 {
-   GLchan rgba[4];
-   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   GLuint index = reg->Index;
+   GLuint i;
 
-   /* XXX use a float-valued TextureSample routine here!!! */
-   swrast->TextureSample[unit] (ctx, unit, ctx->Texture.Unit[unit]._Current,
-				1, (const GLfloat(*)[4]) texcoord,
-				&lambda, &rgba);
-   color[0] = CHAN_TO_FLOAT(rgba[0]);
-   color[1] = CHAN_TO_FLOAT(rgba[1]);
-   color[2] = CHAN_TO_FLOAT(rgba[2]);
-   color[3] = CHAN_TO_FLOAT(rgba[3]);
+   if (index >= GL_REG_0_ATI && index <= GL_REG_5_ATI) {
+      src->File = ATIFS_FILE_REG;
+      src->Index = index - GL_REG_0_ATI;
+   }
+   else if (index >= GL_CON_0_ATI && index <= GL_CON_7_ATI) {
+      src->File = ATIFS_FILE_CONST;
+      src->Index = index - GL_CON_0_ATI;
+   }
+   else if (index == GL_ONE) {
+      src->File = ATIFS_FILE_ONE;
+   }
+   else if (index == GL_PRIMARY_COLOR_EXT) {
+      src->File = ATIFS_FILE_INPUT;
+      src->Index = ATI_FS_INPUT_PRIMARY;
+   }
+   else if (index == GL_SECONDARY_INTERPOLATOR_ATI) {
+      src->File = ATIFS_FILE_INPUT;
+      src->Index = ATI_FS_INPUT_SECONDARY;
+   }
+   else {
+      src->File = ATIFS_FILE_ZERO;
+   }
+
+   if (src->File == ATIFS_FILE_INPUT)
+      p->UsesInput[src->Index] = GL_TRUE;
+
+   for (i = 0; i < 4; i++)
+      src->Swz[i] = rep_channel(reg->argRep, i);
+   src->Mod = reg->argMod;
 }
 
+/**
+ * Translate the shader into p->Ops.  The first-pass registers are saved
+ * at the first pass or sample op which follows an arithmetic op, as
+ * that is where the second pass begins.
+ */
 static void
-apply_swizzle(struct atifs_machine *machine, GLuint reg, GLuint swizzle)
+translate_shader(const struct ati_fragment_shader *shader,
+		 struct atifs_span_program *p)
 {
-   GLfloat s, t, r, q;
+   GLuint pass = 0;
+   GLuint pc, optype, i;
 
-   s = machine->Registers[reg][0];
-   t = machine->Registers[reg][1];
-   r = machine->Registers[reg][2];
-   q = machine->Registers[reg][3];
+   p->Shader = shader;
+   p->NumOps = 0;
+   p->UsesInput[0] = p->UsesInput[1] = GL_FALSE;
+
+   for (pc = 0; pc < shader->Base.NumInstructions &&
+	   p->NumOps < ATIFS_MAX_OPS - 1; pc++) {
+      const struct atifs_instruction *inst = &shader->Instructions[pc];
+      struct atifs_op *op;
+
+      if (inst->Opcode[0] == ATI_FRAGMENT_SHADER_PASS_OP ||
+	  inst->Opcode[0] == ATI_FRAGMENT_SHADER_SAMPLE_OP) {
+	 GLuint tex = inst->SrcReg[0][0].Index;
+
+	 if (pass == 1) {
+	    p->Ops[p->NumOps++].Kind = ATIFS_OP_SAVE;
+	    pass = 2;
+	 }
+
+	 op = &p->Ops[p->NumOps++];
+	 op->Dst[0] = inst->DstReg[0].Index - GL_REG_0_ATI;
+	 op->Swizzle = inst->DstReg[0].Swizzle;
+
+	 if (tex >= GL_TEXTURE0_ARB && tex <= GL_TEXTURE7_ARB) {
+	    op->Unit = tex - GL_TEXTURE0_ARB;
+	    op->Kind = (inst->Opcode[0] == ATI_FRAGMENT_SHADER_PASS_OP) ?
+	       ATIFS_OP_PASS_TEXCOORD : ATIFS_OP_SAMPLE_TEXCOORD;
+	 }
+	 else if (tex >= GL_REG_0_ATI && tex <= GL_REG_5_ATI) {
+	    op->Unit = tex - GL_REG_0_ATI;
+	    if (inst->Opcode[0] == ATI_FRAGMENT_SHADER_SAMPLE_OP)
+	       op->Kind = ATIFS_OP_SAMPLE_REG; /* this is wrong... */
+	    else if (pass == 2)
+	       op->Kind = ATIFS_OP_PASS_PREV;
+	    else
+	       op->Kind = ATIFS_OP_SWIZZLE;
+	 }
+	 else {
+	    op->Kind = ATIFS_OP_SWIZZLE;
+	 }
+	 continue;
+      }
+
+      if (pass == 0)
+	 pass = 1;
+
+      op = &p->Ops[p->NumOps++];
+      op->Kind = ATIFS_OP_ALU;
+
+      /* DOT ops always take their sources from the color op, DOT4
+       * including alpha.
+       */
+      op->Chans[0] = 0x7;
+      op->Chans[1] = 0x8;
+      if (inst->Opcode[0] == GL_DOT4_ATI || inst->Opcode[1] == GL_DOT4_ATI)
+	 op->Chans[0] |= 0x8;
+
+      for (optype = 0; optype < 2; optype++) {
+	 op->Opcode[optype] = inst->Opcode[optype];
+	 op->NumArgs[optype] = op->Opcode[optype] ? inst->ArgCount[optype] : 0;
+	 op->Dst[optype] = inst->DstReg[optype].Index - GL_REG_0_ATI;
+	 op->DstMod[optype] = inst->DstReg[optype].dstMod;
+	 for (i = 0; i < op->NumArgs[optype]; i++)
+	    translate_src(p, &inst->SrcReg[optype][i], &op->Src[optype][i]);
+      }
+
+      op->WriteMask = 0;
+      if (inst->DstReg[0].dstMask) {
+	 if (inst->DstReg[0].dstMask & GL_RED_BIT_ATI)
+	    op->WriteMask |= 0x1;
+	 if (inst->DstReg[0].dstMask & GL_GREEN_BIT_ATI)
+	    op->WriteMask |= 0x2;
+	 if (inst->DstReg[0].dstMask & GL_BLUE_BIT_ATI)
+	    op->WriteMask |= 0x4;
+      }
+      else {
+	 op->WriteMask = 0x7;
+      }
+   }
+}
+
+
+static void
+apply_swizzle(GLfloat (*reg)[ATIFS_CHUNK], GLuint swizzle, GLuint n)
+{
+   GLuint i;
 
    switch (swizzle) {
-   case GL_SWIZZLE_STR_ATI:
-      machine->Registers[reg][0] = s;
-      machine->Registers[reg][1] = t;
-      machine->Registers[reg][2] = r;
-      break;
    case GL_SWIZZLE_STQ_ATI:
-      machine->Registers[reg][0] = s;
-      machine->Registers[reg][1] = t;
-      machine->Registers[reg][2] = q;
+      for (i = 0; i < n; i++)
+	 reg[2][i] = reg[3][i];
       break;
    case GL_SWIZZLE_STR_DR_ATI:
-      machine->Registers[reg][0] = s / r;
-      machine->Registers[reg][1] = t / r;
-      machine->Registers[reg][2] = 1 / r;
+      for (i = 0; i < n; i++) {
+	 const GLfloat r = reg[2][i];
+	 reg[0][i] = reg[0][i] / r;
+	 reg[1][i] = reg[1][i] / r;
+	 reg[2][i] = 1 / r;
+      }
       break;
    case GL_SWIZZLE_STQ_DQ_ATI:
-      machine->Registers[reg][0] = s / q;
-      machine->Registers[reg][1] = t / q;
-      machine->Registers[reg][2] = 1 / q;
+      for (i = 0; i < n; i++) {
+	 const GLfloat q = reg[3][i];
+	 reg[0][i] = reg[0][i] / q;
+	 reg[1][i] = reg[1][i] / q;
+	 reg[2][i] = 1 / q;
+      }
       break;
    }
-   machine->Registers[reg][3] = 0.0;
-}
 
-static void
-apply_src_rep(GLint optype, GLuint rep, GLfloat * val)
-{
-   GLint i;
-   GLint start, end;
-   if (!rep)
-      return;
-
-   start = optype ? 3 : 0;
-   end = optype ? 4 : 3;
-
-   for (i = start; i < end; i++) {
-      switch (rep) {
-      case GL_RED:
-	 val[i] = val[0];
-	 break;
-      case GL_GREEN:
-	 val[i] = val[1];
-	 break;
-      case GL_BLUE:
-	 val[i] = val[2];
-	 break;
-      case GL_ALPHA:
-	 val[i] = val[3];
-	 break;
-      }
-   }
+   for (i = 0; i < n; i++)
+      reg[3][i] = 0.0;
 }
 
-static void
-apply_src_mod(GLint optype, GLuint mod, GLfloat * val)
-{
-   GLint i;
-   GLint start, end;
+#ifdef ATIFS_USE_SSE2
 
-   if (!mod)
-      return;
+/*
+ * SSE2 versions of the per-channel loops.  They handle the first n & ~3
+ * fragments, four at a time, and return how many they did; the scalar
+ * loops finish the rest.  Every operation is done in the same order as
+ * in the scalar code so the results are identical.
+ */
 
-   start = optype ? 3 : 0;
-   end = optype ? 4 : 3;
+static GLuint
+apply_src_mod_sse2(GLuint mod, GLfloat * val, GLuint n)
+{
+   const __m128 one = _mm_set1_ps(1.0F), half = _mm_set1_ps(0.5F);
+   const __m128 sign = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+   GLuint i;
 
-   for (i = start; i < end; i++) {
+   for (i = 0; i + 4 <= n; i += 4) {
+      __m128 v = _mm_loadu_ps(val + i);
       if (mod & GL_COMP_BIT_ATI)
-	 val[i] = 1 - val[i];
-
+	 v = _mm_sub_ps(one, v);
       if (mod & GL_BIAS_BIT_ATI)
-	 val[i] = val[i] - 0.5;
-
+	 v = _mm_sub_ps(v, half);
       if (mod & GL_2X_BIT_ATI)
-	 val[i] = 2 * val[i];
-
+	 v = _mm_add_ps(v, v);
       if (mod & GL_NEGATE_BIT_ATI)
-	 val[i] = -val[i];
+	 v = _mm_xor_ps(v, sign);
+      _mm_storeu_ps(val + i, v);
    }
+   return i;
 }
 
-static void
-apply_dst_mod(GLuint optype, GLuint mod, GLfloat * val)
+/* CLAMP(scale * val, lo, hi), keeping NaNs as CLAMP does */
+static GLuint
+apply_dst_mod_sse2(GLfloat scale, GLfloat lo, GLfloat hi, GLfloat * val,
+		   GLuint n)
 {
-   GLint i;
-   GLint has_sat = mod & GL_SATURATE_BIT_ATI;
-   GLint start, end;
+   const __m128 s = _mm_set1_ps(scale);
+   const __m128 l = _mm_set1_ps(lo), h = _mm_set1_ps(hi);
+   GLuint i;
 
-   mod &= ~GL_SATURATE_BIT_ATI;
+   for (i = 0; i + 4 <= n; i += 4) {
+      __m128 v = _mm_loadu_ps(val + i);
+      if (scale != 1.0F)
+	 v = _mm_mul_ps(s, v);
+      v = _mm_max_ps(l, _mm_min_ps(h, v));
+      _mm_storeu_ps(val + i, v);
+   }
+   return i;
+}
+
+static GLuint
+exec_channel_sse2(GLenum opcode, const GLfloat * a, const GLfloat * b,
+		  const GLfloat * d, GLfloat * dst, GLuint n)
+{
+   const __m128 one = _mm_set1_ps(1.0F), half = _mm_set1_ps(0.5F);
+   const __m128 zero = _mm_setzero_ps();
+   GLuint i;
 
-   start = optype ? 3 : 0;
-   end = optype ? 4 : 3;
+   for (i = 0; i + 4 <= n; i += 4) {
+      const __m128 va = _mm_loadu_ps(a + i);
+      __m128 vb, vd, r, m;
 
-   for (i = start; i < end; i++) {
-      switch (mod) {
-      case GL_2X_BIT_ATI:
-	 val[i] = 2 * val[i];
+      switch (opcode) {
+      case GL_ADD_ATI:
+	 r = _mm_add_ps(va, _mm_loadu_ps(b + i));
 	 break;
-      case GL_4X_BIT_ATI:
-	 val[i] = 4 * val[i];
+      case GL_SUB_ATI:
+	 r = _mm_sub_ps(va, _mm_loadu_ps(b + i));
 	 break;
-      case GL_8X_BIT_ATI:
-	 val[i] = 8 * val[i];
+      case GL_MUL_ATI:
+	 r = _mm_mul_ps(va, _mm_loadu_ps(b + i));
 	 break;
-      case GL_HALF_BIT_ATI:
-	 val[i] = val[i] * 0.5;
+      case GL_MAD_ATI:
+	 r = _mm_add_ps(_mm_mul_ps(va, _mm_loadu_ps(b + i)),
+			_mm_loadu_ps(d + i));
 	 break;
-      case GL_QUARTER_BIT_ATI:
-	 val[i] = val[i] * 0.25;
+      case GL_LERP_ATI:
+	 vb = _mm_loadu_ps(b + i);
+	 vd = _mm_loadu_ps(d + i);
+	 r = _mm_add_ps(_mm_mul_ps(va, vb),
+			_mm_mul_ps(_mm_sub_ps(one, va), vd));
 	 break;
-      case GL_EIGHTH_BIT_ATI:
-	 val[i] = val[i] * 0.125;
+      case GL_CND_ATI:
+      case GL_CND0_ATI:
+	 vb = _mm_loadu_ps(b + i);
+	 vd = _mm_loadu_ps(d + i);
+	 m = (opcode == GL_CND_ATI) ? _mm_cmpgt_ps(vd, half)
+				    : _mm_cmpge_ps(vd, zero);
+	 r = _mm_or_ps(_mm_and_ps(m, va), _mm_andnot_ps(m, vb));
+	 break;
+      default:
+	 r = va;
 	 break;
       }
+      _mm_storeu_ps(dst + i, r);
+   }
+   return i;
+}
+
+static GLuint
+exec_dot_sse2(GLenum opcode, GLfloat (*src)[4][ATIFS_CHUNK], GLfloat * dst,
+	      GLuint n)
+{
+   GLuint i;
 
-      if (has_sat) {
-	 if (val[i] < 0.0)
-	    val[i] = 0;
-	 else if (val[i] > 1.0)
-	    val[i] = 1.0;
+   for (i = 0; i + 4 <= n; i += 4) {
+      __m128 r = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src[0][0] + i),
+				       _mm_loadu_ps(src[1][0] + i)),
+			    _mm_mul_ps(_mm_loadu_ps(src[0][1] + i),
+				       _mm_loadu_ps(src[1][1] + i)));
+      if (opcode == GL_DOT2_ADD_ATI) {
+	 r = _mm_add_ps(r, _mm_loadu_ps(src[2][2] + i));
       }
       else {
-	 if (val[i] < -8.0)
-	    val[i] = -8.0;
-	 else if (val[i] > 8.0)
-	    val[i] = 8.0;
+	 r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(src[0][2] + i),
+				      _mm_loadu_ps(src[1][2] + i)));
+	 if (opcode == GL_DOT4_ATI)
+	    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(src[0][3] + i),
+					 _mm_loadu_ps(src[1][3] + i)));
       }
+      _mm_storeu_ps(dst + i, r);
    }
+   return i;
 }
 
+#endif /* ATIFS_USE_SSE2 */
 
 static void
-write_dst_addr(GLuint optype, GLuint mod, GLuint mask, GLfloat * src,
-	       GLfloat * dst)
+apply_src_mod(GLuint mod, GLfloat * val, GLuint n)
 {
-   GLint i;
-   apply_dst_mod(optype, mod, src);
+   GLuint i, start = 0;
 
-   if (optype == ATI_FRAGMENT_SHADER_COLOR_OP) {
-      if (mask) {
-	 if (mask & GL_RED_BIT_ATI)
-	    dst[0] = src[0];
+#ifdef ATIFS_USE_SSE2
+   start = apply_src_mod_sse2(mod, val, n);
+#endif
 
-	 if (mask & GL_GREEN_BIT_ATI)
-	    dst[1] = src[1];
+   if (mod & GL_COMP_BIT_ATI)
+      for (i = start; i < n; i++)
+	 val[i] = 1 - val[i];
 
-	 if (mask & GL_BLUE_BIT_ATI)
-	    dst[2] = src[2];
-      }
-      else {
-	 for (i = 0; i < 3; i++)
-	    dst[i] = src[i];
-      }
+   if (mod & GL_BIAS_BIT_ATI)
+      for (i = start; i < n; i++)
+	 val[i] = val[i] - 0.5;
+
+   if (mod & GL_2X_BIT_ATI)
+      for (i = start; i < n; i++)
+	 val[i] = 2 * val[i];
+
+   if (mod & GL_NEGATE_BIT_ATI)
+      for (i = start; i < n; i++)
+	 val[i] = -val[i];
+}
+
+static void
+apply_dst_mod(GLuint mod, GLfloat * val, GLuint n)
+{
+   GLfloat scale = 1.0;
+   GLuint i, start = 0;
+
+   switch (mod & ~GL_SATURATE_BIT_ATI) {
+   case GL_2X_BIT_ATI:
+      scale = 2.0;
+      break;
+   case GL_4X_BIT_ATI:
+      scale = 4.0;
+      break;
+   case GL_8X_BIT_ATI:
+      scale = 8.0;
+      break;
+   case GL_HALF_BIT_ATI:
+      scale = 0.5;
+      break;
+   case GL_QUARTER_BIT_ATI:
+      scale = 0.25;
+      break;
+   case GL_EIGHTH_BIT_ATI:
+      scale = 0.125;
+      break;
    }
+
+#ifdef ATIFS_USE_SSE2
+   if (mod & GL_SATURATE_BIT_ATI)
+      start = apply_dst_mod_sse2(scale, 0.0F, 1.0F, val, n);
    else
-      dst[3] = src[3];
+      start = apply_dst_mod_sse2(scale, -8.0F, 8.0F, val, n);
+#endif
+
+   if (scale != 1.0)
+      for (i = start; i < n; i++)
+	 val[i] = scale * val[i];
+
+   if (mod & GL_SATURATE_BIT_ATI) {
+      for (i = start; i < n; i++)
+	 val[i] = CLAMP(val[i], 0.0F, 1.0F);
+   }
+   else {
+      for (i = start; i < n; i++)
+	 val[i] = CLAMP(val[i], -8.0F, 8.0F);
+   }
 }
 
 static void
-finish_pass(struct atifs_machine *machine)
+fetch_src(const struct atifs_span_program *p, const struct atifs_src *src,
+	  GLuint chans, GLfloat (*val)[ATIFS_CHUNK], GLuint n)
 {
-   GLint i;
+   GLuint c, i;
+
+   for (c = 0; c < 4; c++) {
+      const GLuint swz = src->Swz[c];
+      GLfloat *dst = val[c];
+
+      if (!(chans & (1 << c)))
+	 continue;
+
+      switch (src->File) {
+      case ATIFS_FILE_REG:
+	 MEMCPY(dst, p->Reg[src->Index][swz], n * sizeof(GLfloat));
+	 break;
+      case ATIFS_FILE_INPUT:
+	 MEMCPY(dst, p->Input[src->Index][swz], n * sizeof(GLfloat));
+	 break;
+      case ATIFS_FILE_CONST:
+	 for (i = 0; i < n; i++)
+	    dst[i] = p->Shader->Constants[src->Index][swz];
+	 break;
+      case ATIFS_FILE_ONE:
+	 for (i = 0; i < n; i++)
+	    dst[i] = 1.0;
+	 break;
+      default:
+	 for (i = 0; i < n; i++)
+	    dst[i] = 0.0;
+	 break;
+      }
 
-   for (i = 0; i < 6; i++) {
-      COPY_4V(machine->PrevPassRegisters[i], machine->Registers[i]);
+      if (src->Mod)
+	 apply_src_mod(src->Mod, dst, n);
    }
 }
 
 /**
- * Execute the given fragment shader
- * NOTE: we do everything in single-precision floating point; we don't
- * currently observe the single/half/fixed-precision qualifiers.
- * \param ctx - rendering context
- * \param program - the fragment program to execute
- * \param machine - machine state (register file)
- * \param maxInst - max number of instructions to execute
- * \return GL_TRUE if program completed or GL_FALSE if program executed KIL.
+ * One channel of a non-DOT op.
  */
+static void
+exec_channel(GLenum opcode, GLfloat (*src)[4][ATIFS_CHUNK], GLuint c,
+	     GLfloat * dst, GLuint n)
+{
+   const GLfloat *a = src[0][c], *b = src[1][c], *d = src[2][c];
+   GLuint i = 0;
+
+#ifdef ATIFS_USE_SSE2
+   if (opcode != GL_MOV_ATI)
+      i = exec_channel_sse2(opcode, a, b, d, dst, n);
+#endif
+
+   switch (opcode) {
+   case GL_ADD_ATI:
+      for (; i < n; i++)
+	 dst[i] = a[i] + b[i];
+      break;
+   case GL_SUB_ATI:
+      for (; i < n; i++)
+	 dst[i] = a[i] - b[i];
+      break;
+   case GL_MUL_ATI:
+      for (; i < n; i++)
+	 dst[i] = a[i] * b[i];
+      break;
+   case GL_MAD_ATI:
+      for (; i < n; i++)
+	 dst[i] = a[i] * b[i] + d[i];
+      break;
+   case GL_LERP_ATI:
+      for (; i < n; i++)
+	 dst[i] = a[i] * b[i] + (1 - a[i]) * d[i];
+      break;
+   case GL_MOV_ATI:
+      MEMCPY(dst, a, n * sizeof(GLfloat));
+      break;
+   case GL_CND_ATI:
+      for (; i < n; i++)
+	 dst[i] = (d[i] > 0.5) ? a[i] : b[i];
+      break;
+   case GL_CND0_ATI:
+      for (; i < n; i++)
+	 dst[i] = (d[i] >= 0) ? a[i] : b[i];
+      break;
+   }
+}
 
-struct ati_fs_opcode_st ati_fs_opcodes[] = {
-   {GL_ADD_ATI, 2},
-   {GL_SUB_ATI, 2},
-   {GL_MUL_ATI, 2},
-   {GL_MAD_ATI, 3},
-   {GL_LERP_ATI, 3},
-   {GL_MOV_ATI, 1},
-   {GL_CND_ATI, 3},
-   {GL_CND0_ATI, 3},
-   {GL_DOT2_ADD_ATI, 3},
-   {GL_DOT3_ATI, 2},
-   {GL_DOT4_ATI, 2}
-};
+/**
+ * DOT ops, which always use the sources of the color op.
+ */
+static void
+exec_dot(GLenum opcode, GLfloat (*src)[4][ATIFS_CHUNK], GLfloat * dst,
+	 GLuint n)
+{
+   GLuint i = 0;
 
+#ifdef ATIFS_USE_SSE2
+   i = exec_dot_sse2(opcode, src, dst, n);
+#endif
 
+   switch (opcode) {
+   case GL_DOT2_ADD_ATI:
+      for (; i < n; i++)
+	 dst[i] = src[0][0][i] * src[1][0][i] +
+	    src[0][1][i] * src[1][1][i] + src[2][2][i];
+      break;
+   case GL_DOT3_ATI:
+      for (; i < n; i++)
+	 dst[i] = src[0][0][i] * src[1][0][i] +
+	    src[0][1][i] * src[1][1][i] +
+	    src[0][2][i] * src[1][2][i];
+      break;
+   case GL_DOT4_ATI:
+      for (; i < n; i++)
+	 dst[i] = src[0][0][i] * src[1][0][i] +
+	    src[0][1][i] * src[1][1][i] +
+	    src[0][2][i] * src[1][2][i] +
+	    src[0][3][i] * src[1][3][i];
+      break;
+   }
+}
+
+static GLboolean
+is_dot(GLenum opcode)
+{
+   return (opcode == GL_DOT2_ADD_ATI ||
+	   opcode == GL_DOT3_ATI ||
+	   opcode == GL_DOT4_ATI);
+}
 
 static void
-handle_pass_op(struct atifs_machine *machine, struct atifs_instruction *inst,
-	       const struct sw_span *span, GLuint column)
+exec_alu(struct atifs_span_program *p, const struct atifs_op *op, GLuint n)
 {
-   GLuint idx = inst->DstReg[0].Index - GL_REG_0_ATI;
-   GLuint swizzle = inst->DstReg[0].Swizzle;
-   GLuint pass_tex = inst->SrcReg[0][0].Index;
-
-   /* if we get here after passing pass one then we are starting pass two - backup the registers */
-   if (machine->pass == 1) {
-      finish_pass(machine);
-      machine->pass = 2;
+   GLuint optype, i, c;
+
+   /* read all sources before anything is written */
+   for (optype = 0; optype < 2; optype++) {
+      for (i = 0; i < op->NumArgs[optype]; i++)
+	 fetch_src(p, &op->Src[optype][i], op->Chans[optype],
+		   p->Src[optype][i], n);
    }
-   if (pass_tex >= GL_TEXTURE0_ARB && pass_tex <= GL_TEXTURE7_ARB) {
-      pass_tex -= GL_TEXTURE0_ARB;
-      COPY_4V(machine->Registers[idx],
-	      span->array->texcoords[pass_tex][column]);
+
+   /* color then alpha */
+   if (op->Opcode[0]) {
+      if (is_dot(op->Opcode[0])) {
+	 exec_dot(op->Opcode[0], p->Src[0], p->Dst[0], n);
+	 apply_dst_mod(op->DstMod[0], p->Dst[0], n);
+	 MEMCPY(p->Dst[1], p->Dst[0], n * sizeof(GLfloat));
+	 MEMCPY(p->Dst[2], p->Dst[0], n * sizeof(GLfloat));
+      }
+      else {
+	 for (c = 0; c < 3; c++) {
+	    if (op->WriteMask & (1 << c)) {
+	       exec_channel(op->Opcode[0], p->Src[0], c, p->Dst[c], n);
+	       apply_dst_mod(op->DstMod[0], p->Dst[c], n);
+	    }
+	 }
+      }
+   }
+
+   if (op->Opcode[1]) {
+      if (is_dot(op->Opcode[1]))
+	 exec_dot(op->Opcode[1], p->Src[0], p->Dst[3], n);
+      else
+	 exec_channel(op->Opcode[1], p->Src[1], 3, p->Dst[3], n);
+      apply_dst_mod(op->DstMod[1], p->Dst[3], n);
    }
-   else if (pass_tex >= GL_REG_0_ATI && pass_tex <= GL_REG_5_ATI
-	    && machine->pass == 2) {
-      pass_tex -= GL_REG_0_ATI;
-      COPY_4V(machine->Registers[idx], machine->PrevPassRegisters[pass_tex]);
+
+   /* write out the destination registers */
+   if (op->Opcode[0]) {
+      for (c = 0; c < 3; c++) {
+	 if (op->WriteMask & (1 << c))
+	    MEMCPY(p->Reg[op->Dst[0]][c], p->Dst[c], n * sizeof(GLfloat));
+      }
    }
-   apply_swizzle(machine, idx, swizzle);
 
+   if (op->Opcode[1])
+      MEMCPY(p->Reg[op->Dst[1]][3], p->Dst[3], n * sizeof(GLfloat));
 }
 
+/**
+ * Sample texture 'unit' at the given coordinates into register 'reg'.
+ */
 static void
-handle_sample_op(GLcontext * ctx, struct atifs_machine *machine,
-		 struct atifs_instruction *inst, const struct sw_span *span,
-		 GLuint column)
+exec_sample(GLcontext * ctx, struct atifs_span_program *p, GLuint unit,
+	    const GLfloat (*coords)[4], GLuint reg, GLuint n)
 {
-   GLuint idx = inst->DstReg[0].Index - GL_REG_0_ATI;
-   GLuint swizzle = inst->DstReg[0].Swizzle;
-   GLuint sample_tex = inst->SrcReg[0][0].Index;
-
-   /* if we get here after passing pass one then we are starting pass two - backup the registers */
-   if (machine->pass == 1) {
-      finish_pass(machine);
-      machine->pass = 2;
-   }
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   GLuint i;
 
-   if (sample_tex >= GL_TEXTURE0_ARB && sample_tex <= GL_TEXTURE7_ARB) {
-      sample_tex -= GL_TEXTURE0_ARB;
-      fetch_texel(ctx, span->array->texcoords[sample_tex][column], 0.0F,
-		  sample_tex, machine->Registers[idx]);
-   }
-   else if (sample_tex >= GL_REG_0_ATI && sample_tex <= GL_REG_5_ATI) {
-      /* this is wrong... */
-      sample_tex -= GL_REG_0_ATI;
-      fetch_texel(ctx, machine->Registers[sample_tex], 0, sample_tex,
-		  machine->Registers[idx]);
-   }
+   /* XXX use a float-valued TextureSample routine here!!! */
+   swrast->TextureSample[unit] (ctx, unit, ctx->Texture.Unit[unit]._Current,
+				n, coords, p->Lambda, p->Texel);
 
-   apply_swizzle(machine, idx, swizzle);
+   for (i = 0; i < n; i++) {
+      p->Reg[reg][0][i] = CHAN_TO_FLOAT(p->Texel[i][0]);
+      p->Reg[reg][1][i] = CHAN_TO_FLOAT(p->Texel[i][1]);
+      p->Reg[reg][2][i] = CHAN_TO_FLOAT(p->Texel[i][2]);
+      p->Reg[reg][3][i] = CHAN_TO_FLOAT(p->Texel[i][3]);
+   }
 }
 
-#define SETUP_SRC_REG(optype, i, x)	     do {	\
-    if (optype) \
-      src[optype][i][3] = x[3]; \
-    else \
-      COPY_3V(src[optype][i], x); \
-  } while (0)
-
-static GLboolean
-execute_shader(GLcontext * ctx,
-	       const struct ati_fragment_shader *shader, GLuint maxInst,
-	       struct atifs_machine *machine, const struct sw_span *span,
-	       GLuint column)
+/**
+ * Run the shader for fragments [start, start + n) of the span.
+ */
+static void
+exec_chunk(GLcontext * ctx, struct atifs_span_program *p,
+	   struct sw_span *span, GLuint start, GLuint n)
 {
-   GLuint pc;
-   struct atifs_instruction *inst;
-   GLint optype;
-   GLint i;
-   GLint dstreg;
-   GLfloat src[2][3][4];
-   GLfloat zeros[4] = { 0.0, 0.0, 0.0, 0.0 };
-   GLfloat ones[4] = { 1.0, 1.0, 1.0, 1.0 };
-   GLfloat dst[2][4], *dstp;
-
-   for (pc = 0; pc < shader->Base.NumInstructions; pc++) {
-      inst = &shader->Instructions[pc];
-
-      if (inst->Opcode[0] == ATI_FRAGMENT_SHADER_PASS_OP)
-	 handle_pass_op(machine, inst, span, column);
-      else if (inst->Opcode[0] == ATI_FRAGMENT_SHADER_SAMPLE_OP)
-	 handle_sample_op(ctx, machine, inst, span, column);
-      else {
-	 if (machine->pass == 0)
-	    machine->pass = 1;
-
-	 /* setup the source registers for color and alpha ops */
-	 for (optype = 0; optype < 2; optype++) {
-	    for (i = 0; i < inst->ArgCount[optype]; i++) {
-	       GLint index = inst->SrcReg[optype][i].Index;
-
-	       if (index >= GL_REG_0_ATI && index <= GL_REG_5_ATI)
-		  SETUP_SRC_REG(optype, i,
-				machine->Registers[index - GL_REG_0_ATI]);
-	       else if (index >= GL_CON_0_ATI && index <= GL_CON_7_ATI)
-		  SETUP_SRC_REG(optype, i,
-				shader->Constants[index - GL_CON_0_ATI]);
-	       else if (index == GL_ONE)
-		  SETUP_SRC_REG(optype, i, ones);
-	       else if (index == GL_ZERO)
-		  SETUP_SRC_REG(optype, i, zeros);
-	       else if (index == GL_PRIMARY_COLOR_EXT)
-		  SETUP_SRC_REG(optype, i,
-				machine->Inputs[ATI_FS_INPUT_PRIMARY]);
-	       else if (index == GL_SECONDARY_INTERPOLATOR_ATI)
-		  SETUP_SRC_REG(optype, i,
-				machine->Inputs[ATI_FS_INPUT_SECONDARY]);
-
-	       apply_src_rep(optype, inst->SrcReg[optype][i].argRep,
-			     src[optype][i]);
-	       apply_src_mod(optype, inst->SrcReg[optype][i].argMod,
-			     src[optype][i]);
-	    }
-	 }
+   GLuint pc, i, c;
 
-	 /* Execute the operations - color then alpha */
-	 for (optype = 0; optype < 2; optype++) {
-	    if (inst->Opcode[optype]) {
-	       switch (inst->Opcode[optype]) {
-	       case GL_ADD_ATI:
-		  if (!optype)
-		     for (i = 0; i < 3; i++) {
-			dst[optype][i] =
-			   src[optype][0][i] + src[optype][1][i];
-		     }
-		  else
-		     dst[optype][3] = src[optype][0][3] + src[optype][1][3];
-		  break;
-	       case GL_SUB_ATI:
-		  if (!optype)
-		     for (i = 0; i < 3; i++) {
-			dst[optype][i] =
-			   src[optype][0][i] - src[optype][1][i];
-		     }
-		  else
-		     dst[optype][3] = src[optype][0][3] - src[optype][1][3];
-		  break;
-	       case GL_MUL_ATI:
-		  if (!optype)
-		     for (i = 0; i < 3; i++) {
-			dst[optype][i] =
-			   src[optype][0][i] * src[optype][1][i];
-		     }
-		  else
-		     dst[optype][3] = src[optype][0][3] * src[optype][1][3];
-		  break;
-	       case GL_MAD_ATI:
-		  if (!optype)
-		     for (i = 0; i < 3; i++) {
-			dst[optype][i] =
-			   src[optype][0][i] * src[optype][1][i] +
-			   src[optype][2][i];
-		     }
-		  else
-		     dst[optype][3] =
-			src[optype][0][3] * src[optype][1][3] +
-			src[optype][2][3];
-		  break;
-	       case GL_LERP_ATI:
-		  if (!optype)
-		     for (i = 0; i < 3; i++) {
-			dst[optype][i] =
-			   src[optype][0][i] * src[optype][1][i] + (1 -
-								    src
-								    [optype]
-								    [0][i]) *
-			   src[optype][2][i];
-		     }
-		  else
-		     dst[optype][3] =
-			src[optype][0][3] * src[optype][1][3] + (1 -
-								 src[optype]
-								 [0][3]) *
-			src[optype][2][3];
-		  break;
-
-	       case GL_MOV_ATI:
-		  if (!optype)
-		     for (i = 0; i < 3; i++) {
-			dst[optype][i] = src[optype][0][i];
-		     }
-		  else
-		     dst[optype][3] = src[optype][0][3];
-		  break;
-	       case GL_CND_ATI:
-		  if (!optype) {
-		     for (i = 0; i < 3; i++) {
-			dst[optype][i] =
-			   (src[optype][2][i] >
-			    0.5) ? src[optype][0][i] : src[optype][1][i];
-		     }
-		  }
-		  else {
-		     dst[optype][3] =
-			(src[optype][2][3] >
-			 0.5) ? src[optype][0][3] : src[optype][1][3];
-		  }
-		  break;
-
-	       case GL_CND0_ATI:
-		  if (!optype)
-		     for (i = 0; i < 3; i++) {
-			dst[optype][i] =
-			   (src[optype][2][i] >=
-			    0) ? src[optype][0][i] : src[optype][1][i];
-		     }
-		  else {
-		     dst[optype][3] =
-			(src[optype][2][3] >=
-			 0) ? src[optype][0][3] : src[optype][1][3];
-		  }
-		  break;
-	       case GL_DOT2_ADD_ATI:
-		  {
-		     GLfloat result;
-
-		     /* DOT 2 always uses the source from the color op */
-		     result = src[0][0][0] * src[0][1][0] +
-			src[0][0][1] * src[0][1][1] + src[0][2][2];
-		     if (!optype) {
-			for (i = 0; i < 3; i++) {
-			   dst[optype][i] = result;
-			}
-		     }
-		     else
-			dst[optype][3] = result;
-
-		  }
-		  break;
-	       case GL_DOT3_ATI:
-		  {
-		     GLfloat result;
-
-		     /* DOT 3 always uses the source from the color op */
-		     result = src[0][0][0] * src[0][1][0] +
-			src[0][0][1] * src[0][1][1] +
-			src[0][0][2] * src[0][1][2];
-
-		     if (!optype) {
-			for (i = 0; i < 3; i++) {
-			   dst[optype][i] = result;
-			}
-		     }
-		     else
-			dst[optype][3] = result;
-		  }
-		  break;
-	       case GL_DOT4_ATI:
-		  {
-		     GLfloat result;
-
-		     /* DOT 4 always uses the source from the color op */
-		     result = src[optype][0][0] * src[0][1][0] +
-			src[0][0][1] * src[0][1][1] +
-			src[0][0][2] * src[0][1][2] +
-			src[0][0][3] * src[0][1][3];
-		     if (!optype) {
-			for (i = 0; i < 3; i++) {
-			   dst[optype][i] = result;
-			}
-		     }
-		     else
-			dst[optype][3] = result;
-		  }
-		  break;
-
-	       }
-	    }
-	 }
+   _mesa_bzero(p->Reg, sizeof(p->Reg));
 
-	 /* write out the destination registers */
-	 for (optype = 0; optype < 2; optype++) {
-	    if (inst->Opcode[optype]) {
-	       dstreg = inst->DstReg[optype].Index;
-	       dstp = machine->Registers[dstreg - GL_REG_0_ATI];
+   if (p->UsesInput[ATI_FS_INPUT_PRIMARY]) {
+      const GLchan (*rgba)[4] = (const GLchan (*)[4]) span->array->rgba + start;
+      for (c = 0; c < 4; c++)
+	 for (i = 0; i < n; i++)
+	    p->Input[ATI_FS_INPUT_PRIMARY][c][i] = CHAN_TO_FLOAT(rgba[i][c]);
+   }
 
-	       write_dst_addr(optype, inst->DstReg[optype].dstMod,
-			      inst->DstReg[optype].dstMask, dst[optype],
-			      dstp);
-	    }
+   if (p->UsesInput[ATI_FS_INPUT_SECONDARY]) {
+      const GLchan (*spec)[4] = (const GLchan (*)[4]) span->array->spec + start;
+      for (c = 0; c < 4; c++)
+	 for (i = 0; i < n; i++)
+	    p->Input[ATI_FS_INPUT_SECONDARY][c][i] = CHAN_TO_FLOAT(spec[i][c]);
+   }
+
+   for (pc = 0; pc < p->NumOps; pc++) {
+      const struct atifs_op *op = &p->Ops[pc];
+      GLfloat (*dst)[ATIFS_CHUNK] = p->Reg[op->Dst[0]];
+
+      switch (op->Kind) {
+      case ATIFS_OP_SAVE:
+	 MEMCPY(p->PrevReg, p->Reg, sizeof(p->Reg));
+	 break;
+      case ATIFS_OP_PASS_TEXCOORD:
+	 {
+	    const GLfloat (*tc)[4] = (const GLfloat (*)[4])
+	       span->array->texcoords[op->Unit] + start;
+	    for (c = 0; c < 4; c++)
+	       for (i = 0; i < n; i++)
+		  dst[c][i] = tc[i][c];
+	    apply_swizzle(dst, op->Swizzle, n);
 	 }
+	 break;
+      case ATIFS_OP_PASS_PREV:
+	 MEMCPY(dst, p->PrevReg[op->Unit], sizeof(p->PrevReg[0]));
+	 apply_swizzle(dst, op->Swizzle, n);
+	 break;
+      case ATIFS_OP_SWIZZLE:
+	 apply_swizzle(dst, op->Swizzle, n);
+	 break;
+      case ATIFS_OP_SAMPLE_TEXCOORD:
+	 exec_sample(ctx, p, op->Unit,
+		     (const GLfloat (*)[4]) span->array->texcoords[op->Unit]
+		     + start, op->Dst[0], n);
+	 apply_swizzle(dst, op->Swizzle, n);
+	 break;
+      case ATIFS_OP_SAMPLE_REG:
+	 for (c = 0; c < 4; c++)
+	    for (i = 0; i < n; i++)
+	       p->Coords[i][c] = p->Reg[op->Unit][c][i];
+	 exec_sample(ctx, p, op->Unit, (const GLfloat (*)[4]) p->Coords,
+		     op->Dst[0], n);
+	 apply_swizzle(dst, op->Swizzle, n);
+	 break;
+      case ATIFS_OP_ALU:
+	 exec_alu(p, op, n);
+	 break;
+      }
+   }
+
+   for (i = 0; i < n; i++) {
+      if (span->array->mask[start + i]) {
+	 GLchan *rgba = span->array->rgba[start + i];
+	 UNCLAMPED_FLOAT_TO_CHAN(rgba[RCOMP], p->Reg[0][0][i]);
+	 UNCLAMPED_FLOAT_TO_CHAN(rgba[GCOMP], p->Reg[0][1][i]);
+	 UNCLAMPED_FLOAT_TO_CHAN(rgba[BCOMP], p->Reg[0][2][i]);
+	 UNCLAMPED_FLOAT_TO_CHAN(rgba[ACOMP], p->Reg[0][3][i]);
       }
    }
-   return GL_TRUE;
 }
 
-static void
-init_machine(GLcontext * ctx, struct atifs_machine *machine,
-	     const struct ati_fragment_shader *shader,
-	     const struct sw_span *span, GLuint col)
-{
-   GLint i, j;
 
-   for (i = 0; i < 6; i++) {
-      for (j = 0; j < 4; j++)
-	 ctx->ATIFragmentShader.Machine.Registers[i][j] = 0.0;
+/**
+ * Translate the current fragment shader for the span executor.  Called
+ * from _swrast_validate_derived() when program state changes.
+ */
+void
+_swrast_translate_fragment_shader(GLcontext * ctx)
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
 
+   if (!swrast->ATIFragShader) {
+      swrast->ATIFragShader = (struct atifs_span_program *)
+	 ALIGN_MALLOC(sizeof(struct atifs_span_program), 16);
+      if (!swrast->ATIFragShader)
+	 return;
+      _mesa_bzero(swrast->ATIFragShader->Lambda,
+		  sizeof(swrast->ATIFragShader->Lambda));
    }
 
-   ctx->ATIFragmentShader.Machine.Inputs[ATI_FS_INPUT_PRIMARY][0] =
-      CHAN_TO_FLOAT(span->array->rgba[col][0]);
-   ctx->ATIFragmentShader.Machine.Inputs[ATI_FS_INPUT_PRIMARY][1] =
-      CHAN_TO_FLOAT(span->array->rgba[col][1]);
-   ctx->ATIFragmentShader.Machine.Inputs[ATI_FS_INPUT_PRIMARY][2] =
-      CHAN_TO_FLOAT(span->array->rgba[col][2]);
-   ctx->ATIFragmentShader.Machine.Inputs[ATI_FS_INPUT_PRIMARY][3] =
-      CHAN_TO_FLOAT(span->array->rgba[col][3]);
-
-   ctx->ATIFragmentShader.Machine.Inputs[ATI_FS_INPUT_SECONDARY][0] =
-      CHAN_TO_FLOAT(span->array->spec[col][0]);
-   ctx->ATIFragmentShader.Machine.Inputs[ATI_FS_INPUT_SECONDARY][1] =
-      CHAN_TO_FLOAT(span->array->spec[col][1]);
-   ctx->ATIFragmentShader.Machine.Inputs[ATI_FS_INPUT_SECONDARY][2] =
-      CHAN_TO_FLOAT(span->array->spec[col][2]);
-   ctx->ATIFragmentShader.Machine.Inputs[ATI_FS_INPUT_SECONDARY][3] =
-      CHAN_TO_FLOAT(span->array->spec[col][3]);
-
-   ctx->ATIFragmentShader.Machine.pass = 0;
+   translate_shader(ctx->ATIFragmentShader.Current, swrast->ATIFragShader);
 }
 
 
+/**
+ * Bytes held by the translated fragment shader.
+ */
+GLuint
+_swrast_fragment_shader_memory(GLcontext * ctx)
+{
+   return SWRAST_CONTEXT(ctx)->ATIFragShader ?
+      sizeof(struct atifs_span_program) : 0;
+}
+
 
 /**
- * Execute the current fragment program, operating on the given span.
+ * Execute the current fragment shader, operating on the given span.
  */
 void
 _swrast_exec_fragment_shader(GLcontext * ctx, struct sw_span *span)
 {
-   const struct ati_fragment_shader *shader = ctx->ATIFragmentShader.Current;
-   GLuint i;
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct atifs_span_program *p = swrast->ATIFragShader;
+   GLuint start, i;
+
+   if (!p || p->Shader != ctx->ATIFragmentShader.Current) {
+      _swrast_translate_fragment_shader(ctx);
+      p = swrast->ATIFragShader;
+      if (!p)
+	 return;
+   }
 
    ctx->_CurrentProgram = GL_FRAGMENT_SHADER_ATI;
 
-   for (i = 0; i < span->end; i++) {
-      if (span->array->mask[i]) {
-	 init_machine(ctx, &ctx->ATIFragmentShader.Machine,
-		      ctx->ATIFragmentShader.Current, span, i);
-
-	 if (execute_shader(ctx, shader, ~0,
-			    &ctx->ATIFragmentShader.Machine, span, i)) {
-	    span->array->mask[i] = GL_FALSE;
-	 }
+   for (start = 0; start < span->end; start += ATIFS_CHUNK) {
+      const GLuint n = MIN2(ATIFS_CHUNK, span->end - start);
 
-	 {
-	    const GLfloat *colOut =
-	       ctx->ATIFragmentShader.Machine.Registers[0];
-
-	    /*fprintf(stderr,"outputs %f %f %f %f\n", colOut[0], colOut[1], colOut[2], colOut[3]); */
-	    UNCLAMPED_FLOAT_TO_CHAN(span->array->rgba[i][RCOMP], colOut[0]);
-	    UNCLAMPED_FLOAT_TO_CHAN(span->array->rgba[i][GCOMP], colOut[1]);
-	    UNCLAMPED_FLOAT_TO_CHAN(span->array->rgba[i][BCOMP], colOut[2]);
-	    UNCLAMPED_FLOAT_TO_CHAN(span->array->rgba[i][ACOMP], colOut[3]);
-	 }
+      /* skip chunks with no live fragments */
+      for (i = 0; i < n; i++) {
+	 if (span->array->mask[start + i])
+	    break;
       }
 
+      if (i < n)
+	 exec_chunk(ctx, p, span, start, n);
    }
 
-
    ctx->_CurrentProgram = 0;
-
 }
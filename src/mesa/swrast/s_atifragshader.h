@@ -30,8 +30,14 @@
 #include "s_context.h"
 
 
+extern void
+_swrast_translate_fragment_shader( GLcontext *ctx );
+
 extern void
 _swrast_exec_fragment_shader( GLcontext *ctx, struct sw_span *span );
 
+extern GLuint
+_swrast_fragment_shader_memory( GLcontext *ctx );
+
 
 #endif
@@ -35,6 +35,7 @@
 #include "pixel.h"
 
 #include "s_context.h"
+#include "s_damage.h"
 #include "s_span.h"
 
 
@@ -55,6 +56,9 @@ _swrast_Bitmap( GLcontext *ctx, GLint px, GLint py,
 
    ASSERT(ctx->RenderMode == GL_RENDER);
 
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
+
    if (unpack->BufferObj->Name) {
       /* unpack from PBO */
       GLubyte *buf;
@@ -75,6 +79,8 @@ _swrast_Bitmap( GLcontext *ctx, GLint px, GLint py,
       bitmap = ADD_POINTERS(buf, bitmap);
    }
 
+   _swrast_damage_pixels(ctx, px, py, width, height, GL_FALSE);
+
    RENDER_START(swrast,ctx);
 
    if (SWRAST_CONTEXT(ctx)->NewState)
@@ -174,6 +180,177 @@ _swrast_Bitmap( GLcontext *ctx, GLint px, GLint py,
 }
 
 
+/*
+ * Write the glyphs' pixels straight to the color buffer with PutMonoRow.
+ * Only valid when no per-fragment operation other than clipping is
+ * enabled; the color is computed exactly as the span path would.
+ */
+static void
+draw_glyphs_blit( GLcontext *ctx, GLuint count, const struct gl_glyph *glyphs )
+{
+   const struct gl_framebuffer *fb = ctx->DrawBuffer;
+   struct gl_renderbuffer *rb = fb->_ColorDrawBuffers[0][0];
+   GLchan color[4];
+   GLuint i;
+
+   color[RCOMP] = FixedToChan(FloatToFixed(ctx->Current.RasterColor[0] * CHAN_MAXF));
+   color[GCOMP] = FixedToChan(FloatToFixed(ctx->Current.RasterColor[1] * CHAN_MAXF));
+   color[BCOMP] = FixedToChan(FloatToFixed(ctx->Current.RasterColor[2] * CHAN_MAXF));
+   color[ACOMP] = FixedToChan(FloatToFixed(ctx->Current.RasterColor[3] * CHAN_MAXF));
+
+   for (i = 0; i < count; i++) {
+      const struct gl_bitmap_runs *runs = glyphs[i].Runs;
+      const GLint px = glyphs[i].X, py = glyphs[i].Y;
+      const GLint row0 = MAX2(0, fb->_Ymin - py);
+      const GLint row1 = MIN2(runs->Height, fb->_Ymax - py);
+      GLint row;
+      for (row = row0; row < row1; row++) {
+         GLuint r;
+         for (r = runs->RowStart[row]; r < runs->RowStart[row + 1]; r++) {
+            GLint x0 = px + runs->Runs[r][0];
+            GLint x1 = x0 + runs->Runs[r][1];
+            if (x0 < fb->_Xmin)
+               x0 = fb->_Xmin;
+            if (x1 > fb->_Xmax)
+               x1 = fb->_Xmax;
+            if (x0 < x1)
+               rb->PutMonoRow(ctx, rb, x1 - x0, x0, py + row, color, NULL);
+         }
+      }
+   }
+}
+
+
+/*
+ * Write the N fragments gathered in SPAN.  Returns 0, the new count.
+ */
+static GLuint
+flush_glyph_span( GLcontext *ctx, struct sw_span *span, GLuint n )
+{
+   span->end = n;
+   if (ctx->Visual.rgbMode)
+      _swrast_write_rgba_span(ctx, span);
+   else
+      _swrast_write_index_span(ctx, span);
+   return 0;
+}
+
+
+/*
+ * Render a batch of glyphs for glCallLists, see dd_function_table.
+ * Compared to one _swrast_Bitmap call per glyph this sets up rendering
+ * once, works from the lists' cached runs instead of testing every bit,
+ * and fills each fragment span from as many glyphs as fit.
+ */
+void
+_swrast_DrawGlyphs( GLcontext *ctx, GLuint count,
+                    const struct gl_glyph *glyphs )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   GLint bounds[4];   /* x0, y0, x1, y1 of the glyphs in the span */
+   GLuint n = 0;
+   GLuint i;
+   struct sw_span span;
+
+   ASSERT(ctx->RenderMode == GL_RENDER);
+
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
+
+   if (ctx->DrawBuffer->DamageEnabled) {
+      GLint x0 = glyphs[0].X, y0 = glyphs[0].Y, x1 = x0, y1 = y0;
+      for (i = 0; i < count; i++) {
+         x0 = MIN2(x0, glyphs[i].X);
+         y0 = MIN2(y0, glyphs[i].Y);
+         x1 = MAX2(x1, glyphs[i].X + glyphs[i].Runs->Width);
+         y1 = MAX2(y1, glyphs[i].Y + glyphs[i].Runs->Height);
+      }
+      _swrast_damage_pixels(ctx, x0, y0, x1 - x0, y1 - y0, GL_FALSE);
+   }
+
+   RENDER_START(swrast,ctx);
+
+   if (SWRAST_CONTEXT(ctx)->NewState)
+      _swrast_validate_derived( ctx );
+
+   if (ctx->Visual.rgbMode && (swrast->_RasterMask & ~CLIP_BIT) == 0) {
+      draw_glyphs_blit(ctx, count, glyphs);
+      RENDER_FINISH(swrast,ctx);
+      return;
+   }
+
+   /* same fragment attributes as _swrast_Bitmap */
+   INIT_SPAN(span, GL_BITMAP, 0, 0, SPAN_XY);
+
+   if (ctx->Visual.rgbMode) {
+      span.interpMask |= SPAN_RGBA;
+      span.red   = FloatToFixed(ctx->Current.RasterColor[0] * CHAN_MAXF);
+      span.green = FloatToFixed(ctx->Current.RasterColor[1] * CHAN_MAXF);
+      span.blue  = FloatToFixed(ctx->Current.RasterColor[2] * CHAN_MAXF);
+      span.alpha = FloatToFixed(ctx->Current.RasterColor[3] * CHAN_MAXF);
+      span.redStep = span.greenStep = span.blueStep = span.alphaStep = 0;
+   }
+   else {
+      span.interpMask |= SPAN_INDEX;
+      span.index = FloatToFixed(ctx->Current.RasterIndex);
+      span.indexStep = 0;
+   }
+
+   if (ctx->Depth.Test)
+      _swrast_span_default_z(ctx, &span);
+   if (swrast->_FogEnabled)
+      _swrast_span_default_fog(ctx, &span);
+   if (ctx->Texture._EnabledCoordUnits)
+      _swrast_span_default_texcoords(ctx, &span);
+
+   for (i = 0; i < count; i++) {
+      const struct gl_bitmap_runs *runs = glyphs[i].Runs;
+      const GLint px = glyphs[i].X, py = glyphs[i].Y;
+      GLint row;
+
+      /* A glyph overlapping ones already in the span can't share it,
+       * or blending etc. would see the pixels from before both.
+       */
+      if (n > 0 && px < bounds[2] && px + runs->Width > bounds[0]
+          && py < bounds[3] && py + runs->Height > bounds[1])
+         n = flush_glyph_span(ctx, &span, n);
+
+      if (n == 0) {
+         bounds[0] = px;
+         bounds[1] = py;
+         bounds[2] = px + runs->Width;
+         bounds[3] = py + runs->Height;
+      }
+      else {
+         bounds[0] = MIN2(bounds[0], px);
+         bounds[1] = MIN2(bounds[1], py);
+         bounds[2] = MAX2(bounds[2], px + runs->Width);
+         bounds[3] = MAX2(bounds[3], py + runs->Height);
+      }
+
+      for (row = 0; row < runs->Height; row++) {
+         GLuint r;
+         if (n + runs->Width > MAX_WIDTH)
+            n = flush_glyph_span(ctx, &span, n);
+         for (r = runs->RowStart[row]; r < runs->RowStart[row + 1]; r++) {
+            const GLint x = px + runs->Runs[r][0];
+            GLint k;
+            for (k = 0; k < runs->Runs[r][1]; k++) {
+               span.array->x[n] = x + k;
+               span.array->y[n] = py + row;
+               n++;
+            }
+         }
+      }
+   }
+
+   if (n > 0)
+      flush_glyph_span(ctx, &span, n);
+
+   RENDER_FINISH(swrast,ctx);
+}
+
+
 #if 0
 /*
  * XXX this is another way to implement Bitmap.  Use horizontal runs of
@@ -193,6 +370,8 @@ _swrast_Bitmap( GLcontext *ctx, GLint px, GLint py,
    ASSERT(ctx->RenderMode == GL_RENDER);
    ASSERT(bitmap);
 
+   _swrast_damage_pixels(ctx, px, py, width, height, GL_FALSE);
+
    RENDER_START(swrast,ctx);
 
    if (SWRAST_CONTEXT(ctx)->NewState)
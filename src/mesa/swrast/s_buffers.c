@@ -32,6 +32,7 @@
 
 #include "s_accum.h"
 #include "s_context.h"
+#include "s_damage.h"
 #include "s_depth.h"
 #include "s_masking.h"
 #include "s_stencil.h"
@@ -276,7 +277,10 @@ _swrast_Clear(GLcontext *ctx, GLbitfield mask,
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
 
-   (void) all; (void) x; (void) y; (void) width; (void) height;
+   (void) all;
+
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
 
 #ifdef DEBUG_FOO
    {
@@ -301,6 +305,7 @@ _swrast_Clear(GLcontext *ctx, GLbitfield mask,
    /* do software clearing here */
    if (mask) {
       if (mask & ctx->DrawBuffer->_ColorDrawBufferMask[0]) {
+         _swrast_damage_pixels(ctx, x, y, width, height, GL_FALSE);
          clear_color_buffers(ctx);
       }
       if (mask & BUFFER_BIT_DEPTH) {
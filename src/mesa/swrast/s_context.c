@@ -36,8 +36,10 @@
 #include "nvfragprog.h"
 
 #include "swrast.h"
+#include "s_atifragshader.h"
 #include "s_blend.h"
 #include "s_context.h"
+#include "s_damage.h"
 #include "s_lines.h"
 #include "s_points.h"
 #include "s_span.h"
@@ -74,11 +76,17 @@ _swrast_update_rasterflags( GLcontext *ctx )
       if (ctx->Color.IndexLogicOpEnabled)     rasterMask |= LOGIC_OP_BIT;
    }
 
-   if (   ctx->Viewport.X < 0
-       || ctx->Viewport.X + ctx->Viewport.Width > (GLint) ctx->DrawBuffer->Width
-       || ctx->Viewport.Y < 0
-       || ctx->Viewport.Y + ctx->Viewport.Height > (GLint) ctx->DrawBuffer->Height) {
-      rasterMask |= CLIP_BIT;
+   {
+      /* the viewport of a tile is relative to the whole drawable */
+      const GLframebuffer *fb = ctx->DrawBuffer;
+      const GLint x = fb->Tiled ? ctx->Viewport.X - fb->TileX : ctx->Viewport.X;
+      const GLint y = fb->Tiled ? ctx->Viewport.Y - fb->TileY : ctx->Viewport.Y;
+      if (   x < 0
+          || x + ctx->Viewport.Width > (GLint) fb->Width
+          || y < 0
+          || y + ctx->Viewport.Height > (GLint) fb->Height) {
+         rasterMask |= CLIP_BIT;
+      }
    }
 
    if (ctx->Depth.OcclusionTest || ctx->Occlusion.Active)
@@ -171,7 +179,8 @@ _swrast_update_fog_hint( GLcontext *ctx )
 
 
 /**
- * Update the swrast->_AnyTextureCombine flag.
+ * Update the swrast->_AnyTextureCombine flag and recompile the
+ * texture environment span kernels.
  */
 static void
 _swrast_update_texture_env( GLcontext *ctx )
@@ -183,9 +192,10 @@ _swrast_update_texture_env( GLcontext *ctx )
       if (ctx->Texture.Unit[i].EnvMode == GL_COMBINE_EXT ||
           ctx->Texture.Unit[i].EnvMode == GL_COMBINE4_NV) {
          swrast->_AnyTextureCombine = GL_TRUE;
-         return;
+         break;
       }
    }
+   _swrast_choose_texture_env( ctx );
 }
 
 
@@ -232,6 +242,9 @@ _swrast_update_fragment_program( GLcontext *ctx )
       struct fragment_program *program = ctx->FragmentProgram._Current;
       _mesa_load_state_parameters(ctx, program->Parameters);
    }
+   else if (ctx->ATIFragmentShader._Enabled) {
+      _swrast_translate_fragment_shader(ctx);
+   }
 }
 
 
@@ -497,6 +510,13 @@ _swrast_Quad( GLcontext *ctx,
       _swrast_print_vertex( ctx, v2 );
       _swrast_print_vertex( ctx, v3 );
    }
+   if (ctx->DrawBuffer->DamageEnabled) {
+      SWcontext *swrast = SWRAST_CONTEXT(ctx);
+      DAMAGE_BOX_VERTEX(swrast, v0, 0.0F);
+      DAMAGE_BOX_VERTEX(swrast, v1, 0.0F);
+      DAMAGE_BOX_VERTEX(swrast, v2, 0.0F);
+      DAMAGE_BOX_VERTEX(swrast, v3, 0.0F);
+   }
    SWRAST_CONTEXT(ctx)->Triangle( ctx, v0, v1, v3 );
    SWRAST_CONTEXT(ctx)->Triangle( ctx, v1, v2, v3 );
 }
@@ -511,6 +531,12 @@ _swrast_Triangle( GLcontext *ctx, const SWvertex *v0,
       _swrast_print_vertex( ctx, v1 );
       _swrast_print_vertex( ctx, v2 );
    }
+   if (ctx->DrawBuffer->DamageEnabled) {
+      SWcontext *swrast = SWRAST_CONTEXT(ctx);
+      DAMAGE_BOX_VERTEX(swrast, v0, 0.0F);
+      DAMAGE_BOX_VERTEX(swrast, v1, 0.0F);
+      DAMAGE_BOX_VERTEX(swrast, v2, 0.0F);
+   }
    SWRAST_CONTEXT(ctx)->Triangle( ctx, v0, v1, v2 );
 }
 
@@ -522,6 +548,12 @@ _swrast_Line( GLcontext *ctx, const SWvertex *v0, const SWvertex *v1 )
       _swrast_print_vertex( ctx, v0 );
       _swrast_print_vertex( ctx, v1 );
    }
+   if (ctx->DrawBuffer->DamageEnabled) {
+      SWcontext *swrast = SWRAST_CONTEXT(ctx);
+      const GLfloat radius = 0.5F * ctx->Line._Width;
+      DAMAGE_BOX_VERTEX(swrast, v0, radius);
+      DAMAGE_BOX_VERTEX(swrast, v1, radius);
+   }
    SWRAST_CONTEXT(ctx)->Line( ctx, v0, v1 );
 }
 
@@ -532,6 +564,13 @@ _swrast_Point( GLcontext *ctx, const SWvertex *v0 )
       _mesa_debug(ctx, "_swrast_Point\n");
       _swrast_print_vertex( ctx, v0 );
    }
+   if (ctx->DrawBuffer->DamageEnabled) {
+      SWcontext *swrast = SWRAST_CONTEXT(ctx);
+      const GLfloat size =
+         (ctx->Point._Attenuated || ctx->VertexProgram.PointSizeEnabled)
+         ? v0->pointSize : ctx->Point._Size;
+      DAMAGE_BOX_VERTEX(swrast, v0, 0.5F * size);
+   }
    SWRAST_CONTEXT(ctx)->Point( ctx, v0 );
 }
 
@@ -618,30 +657,19 @@ _swrast_CreateContext( GLcontext *ctx )
    for (i = 0; i < MAX_TEXTURE_IMAGE_UNITS; i++)
       swrast->TextureSample[i] = _swrast_validate_texture_sample;
 
-   swrast->SpanArrays = MALLOC_STRUCT(span_arrays);
-   if (!swrast->SpanArrays) {
-      FREE(swrast);
-      return GL_FALSE;
-   }
-
-   /* init point span buffer */
+   /* init point span buffer; the span arrays are allocated by
+    * _swrast_alloc_buffers() when rendering starts.
+    */
    swrast->PointSpan.primitive = GL_POINT;
    swrast->PointSpan.start = 0;
    swrast->PointSpan.end = 0;
    swrast->PointSpan.facing = 0;
-   swrast->PointSpan.array = swrast->SpanArrays;
+
+   DAMAGE_BOX_RESET(swrast);
 
    assert(ctx->Const.MaxTextureUnits > 0);
    assert(ctx->Const.MaxTextureUnits <= MAX_TEXTURE_UNITS);
 
-   swrast->TexelBuffer = (GLchan *) MALLOC(ctx->Const.MaxTextureUnits *
-                                           MAX_WIDTH * 4 * sizeof(GLchan));
-   if (!swrast->TexelBuffer) {
-      FREE(swrast->SpanArrays);
-      FREE(swrast);
-      return GL_FALSE;
-   }
-
    ctx->swrast_context = swrast;
 
    return GL_TRUE;
@@ -656,14 +684,124 @@ _swrast_DestroyContext( GLcontext *ctx )
       _mesa_debug(ctx, "_swrast_DestroyContext\n");
    }
 
-   FREE( swrast->SpanArrays );
-   FREE( swrast->TexelBuffer );
+   if (swrast->SpanArrays)
+      FREE( swrast->SpanArrays );
+   if (swrast->TexelBuffer)
+      FREE( swrast->TexelBuffer );
+   if (swrast->ATIFragShader)
+      ALIGN_FREE( swrast->ATIFragShader );
+   if (swrast->TextureEnv)
+      FREE( swrast->TextureEnv );
    FREE( swrast );
 
    ctx->swrast_context = 0;
 }
 
 
+/*
+ * Stand-ins for swrast->Triangle, Line and Point which drop primitives
+ * while the span arrays can't be allocated.
+ */
+static void
+_swrast_skip_triangle( GLcontext *ctx, const SWvertex *v0,
+                       const SWvertex *v1, const SWvertex *v2 )
+{
+   (void) ctx; (void) v0; (void) v1; (void) v2;
+}
+
+static void
+_swrast_skip_line( GLcontext *ctx, const SWvertex *v0, const SWvertex *v1 )
+{
+   (void) ctx; (void) v0; (void) v1;
+}
+
+static void
+_swrast_skip_point( GLcontext *ctx, const SWvertex *v0 )
+{
+   (void) ctx; (void) v0;
+}
+
+
+/**
+ * Allocate the span arrays and the texel buffer, whichever is missing.
+ * They take about a megabyte and are only used while rendering, so
+ * contexts which are never drawn with don't pay for them.  Called through
+ * SWRAST_ALLOC_BUFFERS and by _swrast_render_start.
+ *
+ * \return GL_FALSE, with GL_OUT_OF_MEMORY recorded, if either buffer
+ * can't be allocated.  The next call tries again.
+ */
+GLboolean
+_swrast_alloc_buffers( GLcontext *ctx )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+
+   if (!swrast->SpanArrays)
+      swrast->SpanArrays = MALLOC_STRUCT(span_arrays);
+   if (!swrast->TexelBuffer)
+      swrast->TexelBuffer = (GLchan *) MALLOC(ctx->Const.MaxTextureUnits *
+                                              MAX_WIDTH * 4 * sizeof(GLchan));
+
+   swrast->PointSpan.array = swrast->SpanArrays;
+
+   if (!swrast->SpanArrays || !swrast->TexelBuffer) {
+      _mesa_error(ctx, GL_OUT_OF_MEMORY, "software rasterizer");
+      return GL_FALSE;
+   }
+   return GL_TRUE;
+}
+
+
+/**
+ * Release the buffers which are only needed while rendering; they are
+ * reallocated when rendering starts again.  Must not be called between
+ * RENDER_START and RENDER_FINISH.
+ */
+void
+_swrast_TrimContext( GLcontext *ctx )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+
+   ASSERT(swrast->PointSpan.end == 0);
+
+   if (swrast->SpanArrays) {
+      FREE( swrast->SpanArrays );
+      swrast->SpanArrays = NULL;
+      swrast->PointSpan.array = NULL;
+   }
+   if (swrast->TexelBuffer) {
+      FREE( swrast->TexelBuffer );
+      swrast->TexelBuffer = NULL;
+   }
+   if (swrast->ATIFragShader) {
+      /* retranslated by _swrast_exec_fragment_shader() */
+      ALIGN_FREE( swrast->ATIFragShader );
+      swrast->ATIFragShader = NULL;
+   }
+}
+
+
+/**
+ * Return the number of bytes of memory allocated by swrast for this
+ * context.
+ */
+GLuint
+_swrast_ContextMemory( GLcontext *ctx )
+{
+   const SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   GLuint bytes = sizeof(SWcontext);
+
+   if (swrast->SpanArrays)
+      bytes += sizeof(struct span_arrays);
+   if (swrast->TexelBuffer)
+      bytes += ctx->Const.MaxTextureUnits * MAX_WIDTH * 4 * sizeof(GLchan);
+   bytes += _swrast_fragment_shader_memory( ctx );
+   bytes += _swrast_texture_env_memory( ctx );
+
+   return bytes;
+}
+
+
 struct swrast_device_driver *
 _swrast_GetDeviceDriverReference( GLcontext *ctx )
 {
@@ -694,6 +832,9 @@ _swrast_render_primitive( GLcontext *ctx, GLenum prim )
    if (swrast->Primitive == GL_POINTS && prim != GL_POINTS) {
       _swrast_flush(ctx);
    }
+   /* keep separate primitives' bounds apart in the damage list */
+   if (ctx->DrawBuffer->DamageEnabled)
+      _swrast_flush_damage_box(ctx);
    swrast->Primitive = prim;
 }
 
@@ -702,6 +843,17 @@ void
 _swrast_render_start( GLcontext *ctx )
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx)) {
+      /* drop the primitives; they are chosen afresh once this succeeds */
+      swrast->Triangle = _swrast_skip_triangle;
+      swrast->Line = _swrast_skip_line;
+      swrast->Point = _swrast_skip_point;
+   }
+   else if (swrast->Triangle == _swrast_skip_triangle) {
+      swrast->Triangle = _swrast_validate_triangle;
+      swrast->Line = _swrast_validate_line;
+      swrast->Point = _swrast_validate_point;
+   }
    if (swrast->Driver.SpanRenderStart)
       swrast->Driver.SpanRenderStart( ctx );
    swrast->PointSpan.end = 0;
@@ -715,6 +867,7 @@ _swrast_render_finish( GLcontext *ctx )
       swrast->Driver.SpanRenderFinish( ctx );
 
    _swrast_flush(ctx);
+   _swrast_flush_damage_box(ctx);
 }
 
 
@@ -297,6 +297,8 @@ typedef struct
    /* Working values:
     */
    GLuint StippleCounter;    /**< Line stipple counter */
+   GLint DamageBox[4];       /**< Bounds of primitives drawn since
+                              * _swrast_render_start, empty if x0 >= x1 */
    GLuint NewState;
    GLuint StateChanges;
    GLenum Primitive;    /* current primitive being drawn (ala glBegin) */
@@ -357,6 +359,12 @@ typedef struct
     */
    GLchan *TexelBuffer;
 
+   /** GL_ATI_fragment_shader translated for the span executor */
+   struct atifs_span_program *ATIFragShader;
+
+   /** Texture environment of the enabled units, compiled to span kernels */
+   struct texenv_program *TextureEnv;
+
 } SWcontext;
 
 
@@ -364,8 +372,21 @@ extern void
 _swrast_validate_derived( GLcontext *ctx );
 
 
+extern GLboolean
+_swrast_alloc_buffers( GLcontext *ctx );
+
+
 #define SWRAST_CONTEXT(ctx) ((SWcontext *)ctx->swrast_context)
 
+/**
+ * Make sure the span arrays and texel buffer exist before rendering.
+ * Evaluates to GL_FALSE, with GL_OUT_OF_MEMORY recorded, when they can't
+ * be allocated; the caller must then skip the operation.
+ */
+#define SWRAST_ALLOC_BUFFERS(SWctx, GLctx)			\
+   (((SWctx)->SpanArrays && (SWctx)->TexelBuffer) ||		\
+    _swrast_alloc_buffers(GLctx))
+
 #define RENDER_START(SWctx, GLctx)			\
    do {							\
       if ((SWctx)->Driver.SpanRenderStart) {		\
@@ -34,6 +34,7 @@
 #include "pixel.h"
 
 #include "s_context.h"
+#include "s_damage.h"
 #include "s_depth.h"
 #include "s_pixeltex.h"
 #include "s_span.h"
@@ -44,10 +45,8 @@
 
 
 /*
- * Determine if there's overlap in an image copy.
- * This test also compensates for the fact that copies are done from
- * bottom to top and overlaps can sometimes be handled correctly
- * without making a temporary image copy.
+ * Determine if there's overlap in an image copy which requires a
+ * temporary copy of the source image.
  */
 static GLboolean
 regions_overlap(GLint srcx, GLint srcy,
@@ -56,19 +55,12 @@ regions_overlap(GLint srcx, GLint srcy,
                 GLfloat zoomX, GLfloat zoomY)
 {
    if (zoomX == 1.0 && zoomY == 1.0) {
-      /* no zoom */
-      if (srcx >= dstx + width || (srcx + width <= dstx)) {
-         return GL_FALSE;
-      }
-      else if (srcy < dsty) { /* this is OK */
-         return GL_FALSE;
-      }
-      else if (srcy > dsty + height) {
-         return GL_FALSE;
-      }
-      else {
-         return GL_TRUE;
-      }
+      /* No zoom: each source row is read completely before the
+       * destination row is written, and rows are copied bottom-to-top or
+       * top-to-bottom so that no source row is overwritten before it's
+       * been read.  So overlap never needs a temporary image.
+       */
+      return GL_FALSE;
    }
    else {
       /* add one pixel of slop when zooming, just to be safe */
@@ -264,6 +256,85 @@ copy_conv_rgba_pixels(GLcontext *ctx, GLint srcx, GLint srcy,
 }
 
 
+/*
+ * Try to do an RGBA glCopyPixels by moving the bytes directly.
+ * This requires no pixel transfer or fragment operations, no zoom, and
+ * source and destination renderbuffers which are directly addressable
+ * with the same layout.  Overlapping regions are handled by the row
+ * order and memmove.
+ * Return:  GL_TRUE if done, GL_FALSE if the general path must be used
+ */
+static GLboolean
+fast_copy_rgba_pixels(GLcontext *ctx, GLint srcx, GLint srcy,
+                      GLint width, GLint height, GLint destx, GLint desty)
+{
+   const struct gl_framebuffer *drawFb = ctx->DrawBuffer;
+   struct gl_renderbuffer *srcRb = ctx->ReadBuffer->_ColorReadBuffer;
+   struct gl_renderbuffer *dstRb = drawFb->_ColorDrawBuffers[0][0];
+   GLuint pixelSize;
+   GLint row, stepy, j;
+
+   if (SWRAST_CONTEXT(ctx)->_RasterMask != 0 ||
+       ctx->_ImageTransferState ||
+       ctx->Pixel.ZoomX != 1.0F || ctx->Pixel.ZoomY != 1.0F ||
+       (ctx->Pixel.PixelTextureEnabled && ctx->Texture._EnabledUnits))
+      return GL_FALSE;
+
+   if (!srcRb || !dstRb ||
+       srcRb->_BaseFormat != dstRb->_BaseFormat ||
+       srcRb->DataType != dstRb->DataType)
+      return GL_FALSE;
+
+   pixelSize = _swrast_direct_pixel_size(ctx, srcRb);
+   if (!pixelSize || pixelSize != _swrast_direct_pixel_size(ctx, dstRb))
+      return GL_FALSE;
+
+   /* pixels outside the source buffer are undefined, let the
+    * general code deal with them
+    */
+   if (srcx < 0 || srcy < 0 ||
+       srcx + width > (GLint) srcRb->Width ||
+       srcy + height > (GLint) srcRb->Height)
+      return GL_FALSE;
+
+   /* clip the destination */
+   if (destx < drawFb->_Xmin) {
+      srcx += drawFb->_Xmin - destx;
+      width -= drawFb->_Xmin - destx;
+      destx = drawFb->_Xmin;
+   }
+   if (destx + width > drawFb->_Xmax)
+      width = drawFb->_Xmax - destx;
+   if (desty < drawFb->_Ymin) {
+      srcy += drawFb->_Ymin - desty;
+      height -= drawFb->_Ymin - desty;
+      desty = drawFb->_Ymin;
+   }
+   if (desty + height > drawFb->_Ymax)
+      height = drawFb->_Ymax - desty;
+   if (width <= 0 || height <= 0)
+      return GL_TRUE;
+
+   /* copy top-down if moving up, else bottom-up */
+   if (srcy < desty) {
+      row = height - 1;
+      stepy = -1;
+   }
+   else {
+      row = 0;
+      stepy = 1;
+   }
+
+   for (j = 0; j < height; j++, row += stepy) {
+      const GLvoid *src = srcRb->GetPointer(ctx, srcRb, srcx, srcy + row);
+      GLvoid *dst = dstRb->GetPointer(ctx, dstRb, destx, desty + row);
+      MEMMOVE(dst, src, width * pixelSize);
+   }
+
+   return GL_TRUE;
+}
+
+
 /*
  * RGBA copypixels
  */
@@ -294,6 +365,9 @@ copy_rgba_pixels(GLcontext *ctx, GLint srcx, GLint srcy,
       return;
    }
 
+   if (fast_copy_rgba_pixels(ctx, srcx, srcy, width, height, destx, desty))
+      return;
+
    /* Determine if copy should be done bottom-to-top or top-to-bottom */
    if (srcy < desty) {
       /* top-down  max-to-min */
@@ -776,11 +850,20 @@ _swrast_CopyPixels( GLcontext *ctx,
 		    GLenum type )
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
+
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
+
    RENDER_START(swrast,ctx);
       
    if (swrast->NewState)
       _swrast_validate_derived( ctx );
 
+   if (type == GL_COLOR)
+      _swrast_damage_pixels(ctx, destx, desty, width, height,
+                            ctx->Pixel.ZoomX != 1.0F ||
+                            ctx->Pixel.ZoomY != 1.0F);
+
    if (type == GL_COLOR && ctx->Visual.rgbMode) {
       copy_rgba_pixels( ctx, srcx, srcy, width, height, destx, desty );
    }
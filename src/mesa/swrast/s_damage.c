@@ -0,0 +1,189 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file swrast/s_damage.c
+ * \brief Track the window regions drawn between buffer swaps.
+ *
+ * A driver that presents its back buffer by copying it to the window
+ * (e.g. XMesa's XImage back buffer) can set gl_framebuffer::DamageEnabled
+ * and then copy only gl_framebuffer::DamageRects on swap.  The list is
+ * kept short by merging rectangles whenever the union doesn't cover more
+ * pixels than the two parts, and by folding into the closest rectangle
+ * once the list is full, so it over-estimates but never misses a pixel.
+ */
+
+#include "glheader.h"
+#include "macros.h"
+
+#include "s_context.h"
+#include "s_damage.h"
+#include "swrast.h"
+
+
+static GLint
+rect_area(const GLint r[4])
+{
+   return (r[2] - r[0]) * (r[3] - r[1]);
+}
+
+
+static void
+rect_union(GLint dst[4], const GLint a[4], const GLint b[4])
+{
+   dst[0] = MIN2(a[0], b[0]);
+   dst[1] = MIN2(a[1], b[1]);
+   dst[2] = MAX2(a[2], b[2]);
+   dst[3] = MAX2(a[3], b[3]);
+}
+
+
+static GLboolean
+rect_contains(const GLint a[4], const GLint b[4])
+{
+   return a[0] <= b[0] && a[1] <= b[1] && a[2] >= b[2] && a[3] >= b[3];
+}
+
+
+/**
+ * Add a window rectangle to the framebuffer's damage list.  The corners
+ * may be given in either order; the upper bounds are exclusive.  Does
+ * nothing unless damage tracking is enabled for the framebuffer.
+ */
+void
+_swrast_add_damage( GLframebuffer *fb, GLint x0, GLint y0,
+                    GLint x1, GLint y1 )
+{
+   GLint r[4], u[4];
+   GLuint i;
+
+   if (!fb->DamageEnabled || fb->DamageAll)
+      return;
+
+   r[0] = CLAMP(MIN2(x0, x1), 0, (GLint) fb->Width);
+   r[1] = CLAMP(MIN2(y0, y1), 0, (GLint) fb->Height);
+   r[2] = CLAMP(MAX2(x0, x1), 0, (GLint) fb->Width);
+   r[3] = CLAMP(MAX2(y0, y1), 0, (GLint) fb->Height);
+   if (r[0] >= r[2] || r[1] >= r[3])
+      return;
+
+   /* merge with every rectangle the union of which is no bigger than the
+    * two apart; a merge can make new candidates, so rescan after each.
+    */
+   i = 0;
+   while (i < fb->NumDamageRects) {
+      GLint *d = fb->DamageRects[i];
+      if (rect_contains(d, r))
+         return;
+      rect_union(u, d, r);
+      if (rect_area(u) <= rect_area(d) + rect_area(r)) {
+         COPY_4V(r, u);
+         fb->NumDamageRects--;
+         COPY_4V(d, fb->DamageRects[fb->NumDamageRects]);
+         i = 0;
+      }
+      else {
+         i++;
+      }
+   }
+
+   if (fb->NumDamageRects == MAX_DAMAGE_RECTS) {
+      /* list is full: fold into the rectangle that grows least */
+      GLint best = 0, bestGrowth = 0x7fffffff;
+      for (i = 0; i < MAX_DAMAGE_RECTS; i++) {
+         GLint growth;
+         rect_union(u, fb->DamageRects[i], r);
+         growth = rect_area(u) - rect_area(fb->DamageRects[i]);
+         if (growth < bestGrowth) {
+            bestGrowth = growth;
+            best = i;
+         }
+      }
+      rect_union(fb->DamageRects[best], fb->DamageRects[best], r);
+      COPY_4V(r, fb->DamageRects[best]);
+   }
+   else {
+      COPY_4V(fb->DamageRects[fb->NumDamageRects], r);
+      fb->NumDamageRects++;
+   }
+
+   if (r[0] == 0 && r[1] == 0 &&
+       r[2] == (GLint) fb->Width && r[3] == (GLint) fb->Height) {
+      fb->DamageAll = GL_TRUE;
+      fb->NumDamageRects = 0;
+   }
+}
+
+
+/**
+ * Forget the damage recorded so far, typically after a swap.
+ */
+void
+_swrast_reset_damage( GLframebuffer *fb )
+{
+   fb->DamageAll = GL_FALSE;
+   fb->NumDamageRects = 0;
+}
+
+
+/**
+ * Move the bounds of the primitives rendered since the last call into
+ * the draw buffer's damage list.
+ */
+void
+_swrast_flush_damage_box( GLcontext *ctx )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   const GLint *box = swrast->DamageBox;
+
+   if (box[0] < box[2] && box[1] < box[3]) {
+      _swrast_add_damage(ctx->DrawBuffer, box[0], box[1], box[2], box[3]);
+      DAMAGE_BOX_RESET(swrast);
+   }
+}
+
+
+/**
+ * Record the destination of an image drawn at (x, y), such as a
+ * glDrawPixels, glCopyPixels or glBitmap, optionally scaled by the
+ * pixel zoom factors.
+ */
+void
+_swrast_damage_pixels( GLcontext *ctx, GLint x, GLint y,
+                       GLsizei width, GLsizei height, GLboolean zoom )
+{
+   if (!ctx->DrawBuffer->DamageEnabled)
+      return;
+
+   if (zoom) {
+      /* one pixel of slack for the zoom rounding */
+      const GLint x1 = x + IROUND(width * ctx->Pixel.ZoomX);
+      const GLint y1 = y + IROUND(height * ctx->Pixel.ZoomY);
+      _swrast_add_damage(ctx->DrawBuffer, MIN2(x, x1) - 1, MIN2(y, y1) - 1,
+                         MAX2(x, x1) + 1, MAX2(y, y1) + 1);
+   }
+   else {
+      _swrast_add_damage(ctx->DrawBuffer, x, y, x + width, y + height);
+   }
+}
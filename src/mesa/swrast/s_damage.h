@@ -0,0 +1,70 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef S_DAMAGE_H
+#define S_DAMAGE_H
+
+
+#include "mtypes.h"
+#include "s_context.h"
+
+
+/**
+ * Empty the running bounding box of the primitives being rendered.
+ */
+#define DAMAGE_BOX_RESET(SWRAST)                                  \
+do {                                                              \
+   (SWRAST)->DamageBox[0] = (SWRAST)->DamageBox[1] = 0x7fffffff;  \
+   (SWRAST)->DamageBox[2] = (SWRAST)->DamageBox[3] = -0x7fffffff; \
+} while (0)
+
+
+/**
+ * Grow the running bounding box to cover vertex V and RADIUS pixels
+ * around it.  The extra pixel on each side absorbs rasterization
+ * rounding.
+ */
+#define DAMAGE_BOX_VERTEX(SWRAST, V, RADIUS)                            \
+do {                                                                    \
+   const GLint dx0 = (GLint) ((V)->win[0] - (RADIUS)) - 1;              \
+   const GLint dy0 = (GLint) ((V)->win[1] - (RADIUS)) - 1;              \
+   const GLint dx1 = (GLint) ((V)->win[0] + (RADIUS)) + 2;              \
+   const GLint dy1 = (GLint) ((V)->win[1] + (RADIUS)) + 2;              \
+   if (dx0 < (SWRAST)->DamageBox[0])  (SWRAST)->DamageBox[0] = dx0;     \
+   if (dy0 < (SWRAST)->DamageBox[1])  (SWRAST)->DamageBox[1] = dy0;     \
+   if (dx1 > (SWRAST)->DamageBox[2])  (SWRAST)->DamageBox[2] = dx1;     \
+   if (dy1 > (SWRAST)->DamageBox[3])  (SWRAST)->DamageBox[3] = dy1;     \
+} while (0)
+
+
+extern void
+_swrast_flush_damage_box( GLcontext *ctx );
+
+extern void
+_swrast_damage_pixels( GLcontext *ctx, GLint x, GLint y,
+                       GLsizei width, GLsizei height, GLboolean zoom );
+
+
+#endif
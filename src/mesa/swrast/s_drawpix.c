@@ -33,6 +33,7 @@
 #include "pixel.h"
 
 #include "s_context.h"
+#include "s_damage.h"
 #include "s_drawpix.h"
 #include "s_pixeltex.h"
 #include "s_span.h"
@@ -40,6 +41,23 @@
 #include "s_zoom.h"
 
 
+/*
+ * Check if the rows of a client image are tightly packed, i.e. the
+ * unpack alignment doesn't introduce padding between rows.
+ */
+static GLboolean
+unpadded_rows(const struct gl_pixelstore_attrib *unpack,
+              GLsizei width, GLenum format, GLenum type)
+{
+   const GLint bytesPerPixel = _mesa_bytes_per_pixel(format, type);
+   const GLint rowLength = unpack->RowLength > 0 ? unpack->RowLength : width;
+
+   if (bytesPerPixel <= 0)
+      return GL_FALSE;
+   return (rowLength * bytesPerPixel) % unpack->Alignment == 0;
+}
+
+
 /*
  * Try to do a fast and simple RGB(a) glDrawPixels.
  * Return:  GL_TRUE if success, GL_FALSE if slow path must be used instead
@@ -73,7 +91,7 @@ fast_draw_pixels(GLcontext *ctx, GLint x, GLint y,
 
    if ((SWRAST_CONTEXT(ctx)->_RasterMask & ~CLIP_BIT) == 0
        && ctx->Texture._EnabledCoordUnits == 0
-       && unpack->Alignment == 1
+       && unpadded_rows(unpack, width, format, type)
        && !unpack->SwapBytes
        && !unpack->LsbFirst) {
 
@@ -164,7 +182,19 @@ fast_draw_pixels(GLcontext *ctx, GLint x, GLint y,
          if (ctx->Visual.rgbMode) {
             GLchan *src = (GLchan *) pixels
                + (skipRows * rowLength + skipPixels) * 4;
-            if (ctx->Pixel.ZoomX==1.0F && ctx->Pixel.ZoomY==1.0F) {
+            if (ctx->Pixel.ZoomX==1.0F && ctx->Pixel.ZoomY==1.0F &&
+                rb->_BaseFormat == GL_RGBA && rb->DataType == CHAN_TYPE &&
+                _swrast_direct_pixel_size(ctx, rb) == 4 * sizeof(GLchan)) {
+               /* no zooming, copy straight into the renderbuffer */
+               GLint row;
+               for (row=0; row<drawHeight; row++) {
+                  GLvoid *dst = rb->GetPointer(ctx, rb, destX, destY);
+                  MEMCPY(dst, src, drawWidth * 4 * sizeof(GLchan));
+                  src += rowLength * 4;
+                  destY++;
+               }
+            }
+            else if (ctx->Pixel.ZoomX==1.0F && ctx->Pixel.ZoomY==1.0F) {
                /* no zooming */
                GLint row;
                for (row=0; row<drawHeight; row++) {
@@ -890,6 +920,9 @@ _swrast_DrawPixels( GLcontext *ctx,
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
 
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
+
    if (swrast->NewState)
       _swrast_validate_derived( ctx );
 
@@ -913,6 +946,11 @@ _swrast_DrawPixels( GLcontext *ctx,
       pixels = ADD_POINTERS(buf, pixels);
    }
 
+   if (format != GL_STENCIL_INDEX && format != GL_DEPTH_COMPONENT)
+      _swrast_damage_pixels(ctx, x, y, width, height,
+                            ctx->Pixel.ZoomX != 1.0F ||
+                            ctx->Pixel.ZoomY != 1.0F);
+
    RENDER_START(swrast,ctx);
 
    switch (format) {
@@ -972,6 +1010,9 @@ _swrast_DrawDepthPixelsMESA( GLcontext *ctx,
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
 
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
+
    if (swrast->NewState)
       _swrast_validate_derived( ctx );
 
@@ -120,6 +120,9 @@ _swrast_CopyConvolutionFilter1D(GLcontext *ctx, GLenum target,
       return;
    }
 
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
+
    /* Select buffer to read from */
    _swrast_use_read_buffer(ctx);
 
@@ -163,6 +166,9 @@ _swrast_CopyConvolutionFilter2D(GLcontext *ctx, GLenum target,
       return;
    }
 
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
+
    /* Select buffer to read from */
    _swrast_use_read_buffer(ctx);
 
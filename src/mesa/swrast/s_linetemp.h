@@ -72,10 +72,10 @@ NAME( GLcontext *ctx, const SWvertex *vert0, const SWvertex *vert1 )
 {
    struct sw_span span;
    GLuint interpFlags = 0;
-   GLint x0 = (GLint) vert0->win[0];
-   GLint x1 = (GLint) vert1->win[0];
-   GLint y0 = (GLint) vert0->win[1];
-   GLint y1 = (GLint) vert1->win[1];
+   GLint x0 = IFLOOR(vert0->win[0]);
+   GLint x1 = IFLOOR(vert1->win[0]);
+   GLint y0 = IFLOOR(vert0->win[1]);
+   GLint y1 = IFLOOR(vert1->win[1]);
    GLint dx, dy;
    GLint numPixels;
    GLint xstep, ystep;
@@ -125,12 +125,18 @@ NAME( GLcontext *ctx, const SWvertex *vert0, const SWvertex *vert1 )
  * may just lie outside the window bounds.  That is, if the legal window
  * coordinates are [0,W-1][0,H-1], it's possible for x==W and/or y==H.
  * This quick and dirty code nudges the endpoints inside the window if
- * necessary.
+ * necessary.  CLIP_HACK_WIDTH and CLIP_HACK_HEIGHT may give a window size
+ * other than the draw buffer's, e.g. that of a whole tiled image.
  */
 #ifdef CLIP_HACK
    {
+#ifdef CLIP_HACK_WIDTH
+      GLint w = CLIP_HACK_WIDTH;
+      GLint h = CLIP_HACK_HEIGHT;
+#else
       GLint w = ctx->DrawBuffer->Width;
       GLint h = ctx->DrawBuffer->Height;
+#endif
       if ((x0==w) | (x1==w)) {
          if ((x0==w) & (x1==w))
            return;
@@ -450,5 +456,7 @@ NAME( GLcontext *ctx, const SWvertex *vert0, const SWvertex *vert1 )
 #undef SETUP_CODE
 #undef PLOT
 #undef CLIP_HACK
+#undef CLIP_HACK_WIDTH
+#undef CLIP_HACK_HEIGHT
 #undef FixedToDepth
 #undef RENDER_SPAN
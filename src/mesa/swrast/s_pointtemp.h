@@ -202,10 +202,10 @@ NAME ( GLcontext *ctx, const SWvertex *vert )
       const GLfloat rmin2 = MAX2(0.0F, rmin * rmin);
       const GLfloat rmax2 = rmax * rmax;
       const GLfloat cscale = 1.0F / (rmax2 - rmin2);
-      const GLint xmin = (GLint) (vert->win[0] - radius);
-      const GLint xmax = (GLint) (vert->win[0] + radius);
-      const GLint ymin = (GLint) (vert->win[1] - radius);
-      const GLint ymax = (GLint) (vert->win[1] + radius);
+      const GLint xmin = IFLOOR(vert->win[0] - radius);
+      const GLint xmax = IFLOOR(vert->win[0] + radius);
+      const GLint ymin = IFLOOR(vert->win[1] - radius);
+      const GLint ymax = IFLOOR(vert->win[1] + radius);
 #else
       /* non-smooth */
       GLint xmin, xmax, ymin, ymax;
@@ -215,16 +215,16 @@ NAME ( GLcontext *ctx, const SWvertex *vert )
       iRadius = iSize / 2;
       if (iSize & 1) {
          /* odd size */
-         xmin = (GLint) (vert->win[0] - iRadius);
-         xmax = (GLint) (vert->win[0] + iRadius);
-         ymin = (GLint) (vert->win[1] - iRadius);
-         ymax = (GLint) (vert->win[1] + iRadius);
+         xmin = IFLOOR(vert->win[0] - iRadius);
+         xmax = IFLOOR(vert->win[0] + iRadius);
+         ymin = IFLOOR(vert->win[1] - iRadius);
+         ymax = IFLOOR(vert->win[1] + iRadius);
       }
       else {
          /* even size */
-         xmin = (GLint) vert->win[0] - iRadius + 1;
+         xmin = IFLOOR(vert->win[0]) - iRadius + 1;
          xmax = xmin + iSize - 1;
-         ymin = (GLint) vert->win[1] - iRadius + 1;
+         ymin = IFLOOR(vert->win[1]) - iRadius + 1;
          ymax = ymin + iSize - 1;
       }
 #endif /*SMOOTH*/
@@ -403,8 +403,8 @@ NAME ( GLcontext *ctx, const SWvertex *vert )
       }
 #endif
 
-      span->array->x[count] = (GLint) vert->win[0];
-      span->array->y[count] = (GLint) vert->win[1];
+      span->array->x[count] = IFLOOR(vert->win[0]);
+      span->array->y[count] = IFLOOR(vert->win[1]);
       span->array->z[count] = (GLint) (vert->win[2] + 0.5F);
       span->end = count + 1;
    }}
@@ -234,6 +234,8 @@ read_stencil_pixels( GLcontext *ctx,
  * Optimized glReadPixels for particular pixel formats:
  *   GL_UNSIGNED_BYTE, GL_RGBA
  * when pixel scaling, biasing and mapping are disabled.
+ * If the renderbuffer stores pixels in the same layout they're copied
+ * directly out of the buffer's memory.
  */
 static GLboolean
 read_fast_rgba_pixels( GLcontext *ctx,
@@ -244,65 +246,55 @@ read_fast_rgba_pixels( GLcontext *ctx,
                        const struct gl_pixelstore_attrib *packing )
 {
    struct gl_renderbuffer *rb = ctx->ReadBuffer->_ColorReadBuffer;
+   GLubyte *dest;
+   GLint stride, row;
+
    /* can't do scale, bias, mapping, etc */
    if (ctx->_ImageTransferState)
        return GL_FALSE;
 
    /* can't do fancy pixel packing */
-   if (packing->Alignment != 1 || packing->SwapBytes || packing->LsbFirst)
+   if (packing->SwapBytes || packing->LsbFirst)
       return GL_FALSE;
 
-   {
-      GLint srcX = x;
-      GLint srcY = y;
-      GLint readWidth = width;           /* actual width read */
-      GLint readHeight = height;         /* actual height read */
-      GLint skipPixels = packing->SkipPixels;
-      GLint skipRows = packing->SkipRows;
-      GLint rowLength;
-
-      if (packing->RowLength > 0)
-         rowLength = packing->RowLength;
-      else
-         rowLength = width;
-
-      /*
-       * Ready to read!
-       * The window region at (destX, destY) of size (readWidth, readHeight)
-       * will be read back.
-       * We'll write pixel data to buffer pointed to by "pixels" but we'll
-       * skip "skipRows" rows and skip "skipPixels" pixels/row.
-       */
 #if CHAN_BITS == 8
-      if (format == GL_RGBA && type == GL_UNSIGNED_BYTE) {
+   if (format != GL_RGBA || type != GL_UNSIGNED_BYTE)
+      return GL_FALSE;
 #elif CHAN_BITS == 16
-      if (format == GL_RGBA && type == GL_UNSIGNED_SHORT) {
+   if (format != GL_RGBA || type != GL_UNSIGNED_SHORT)
+      return GL_FALSE;
 #else
-      if (0) {
+   return GL_FALSE;
 #endif
-         GLchan *dest = (GLchan *) pixels
-                      + (skipRows * rowLength + skipPixels) * 4;
-         GLint row;
-
-         if (packing->Invert) {
-            /* start at top and go down */
-            dest += (readHeight - 1) * rowLength * 4;
-            rowLength = -rowLength;
-         }
 
-         ASSERT(rb->GetRow);
-         for (row=0; row<readHeight; row++) {
-            rb->GetRow(ctx, rb, readWidth, srcX, srcY, dest);
-            dest += rowLength * 4;
-            srcY++;
-         }
-         return GL_TRUE;
+   /*
+    * Ready to read!
+    * The image address and row stride account for the row length,
+    * skip pixels/rows, alignment and inversion.
+    */
+   dest = (GLubyte *) _mesa_image_address2d(packing, pixels, width, height,
+                                            format, type, 0, 0);
+   stride = _mesa_image_row_stride(packing, width, format, type);
+
+   if (rb->_BaseFormat == GL_RGBA && rb->DataType == CHAN_TYPE &&
+       _swrast_direct_pixel_size(ctx, rb) == 4 * sizeof(GLchan)) {
+      /* the renderbuffer's memory layout matches the client's, copy
+       * straight from the buffer
+       */
+      for (row = 0; row < height; row++) {
+         const GLvoid *src = rb->GetPointer(ctx, rb, x, y + row);
+         MEMCPY(dest, src, width * 4 * sizeof(GLchan));
+         dest += stride;
       }
-      else {
-         /* can't do this format/type combination */
-         return GL_FALSE;
+   }
+   else {
+      ASSERT(rb->GetRow);
+      for (row = 0; row < height; row++) {
+         rb->GetRow(ctx, rb, width, x, y + row, dest);
+         dest += stride;
       }
    }
+   return GL_TRUE;
 }
 
 
@@ -491,6 +483,121 @@ read_rgba_pixels( GLcontext *ctx,
 }
 
 
+/**
+ * State for a glReadPixels into a PBO whose packing has been deferred.
+ * Everything the packing needs is copied here so that the application
+ * is free to change GL state while the job waits in the queue.
+ */
+struct deferred_readpix {
+   GLcontext *ctx;
+   struct gl_buffer_object *bufObj;
+   struct gl_pixelstore_attrib packing;
+   GLint width, height;
+   GLenum format, type;
+   const GLvoid *offset;        /**< destination offset in the PBO */
+   GLchan (*rgba)[4];           /**< captured colors, width * height */
+};
+
+
+/**
+ * Called via _mesa_defer_buffer_write() to convert and pack the captured
+ * colors into the PBO.
+ */
+static void
+pack_deferred_readpix( void *data )
+{
+   struct deferred_readpix *job = (struct deferred_readpix *) data;
+   GLubyte *pixels = ADD_POINTERS(job->bufObj->Data, job->offset);
+   GLint row;
+
+   for (row = 0; row < job->height; row++) {
+      GLvoid *dst = _mesa_image_address2d(&job->packing, pixels,
+                                          job->width, job->height,
+                                          job->format, job->type, row, 0);
+      _mesa_pack_rgba_span_chan(job->ctx, job->width,
+                                (CONST GLchan (*)[4]) job->rgba
+                                + row * job->width,
+                                job->format, job->type, dst,
+                                &job->packing, 0x0);
+   }
+
+   _mesa_free(job->rgba);
+   _mesa_free(job);
+}
+
+
+/**
+ * Try to do an RGBA glReadPixels into a PBO asynchronously: the colors
+ * are copied out of the renderbuffer right away, but the conversion and
+ * packing into the buffer object happen in the background.  A later
+ * glMapBufferARB (or anything else that touches the buffer's data) waits
+ * for it.  Only done when the pack doesn't depend on pixel transfer state.
+ * \return GL_TRUE if the read was queued, GL_FALSE if the caller should
+ *         do it the normal way.
+ */
+static GLboolean
+read_rgba_pixels_deferred( GLcontext *ctx,
+                           GLint x, GLint y,
+                           GLsizei width, GLsizei height,
+                           GLenum format, GLenum type, const GLvoid *offset,
+                           const struct gl_pixelstore_attrib *packing )
+{
+   struct gl_renderbuffer *rb = ctx->ReadBuffer->_ColorReadBuffer;
+   struct deferred_readpix *job;
+   GLint row;
+
+   if (!rb ||
+       !ctx->Visual.rgbMode ||
+       ctx->_ImageTransferState ||
+       ctx->Pixel.Convolution2DEnabled ||
+       ctx->Pixel.Separable2DEnabled ||
+       ctx->Visual.redBits < CHAN_BITS ||
+       ctx->Visual.greenBits < CHAN_BITS ||
+       ctx->Visual.blueBits < CHAN_BITS ||
+       width > MAX_WIDTH)
+      return GL_FALSE;
+
+   /* luminance packing depends on the read color clamp state */
+   if (format == GL_LUMINANCE || format == GL_LUMINANCE_ALPHA ||
+       format == GL_INTENSITY ||
+       !_mesa_is_legal_format_and_type(ctx, format, type))
+      return GL_FALSE;
+
+   /* a plain copy isn't worth the trip through the queue */
+   if (format == GL_RGBA && type == CHAN_TYPE)
+      return GL_FALSE;
+
+   job = MALLOC_STRUCT(deferred_readpix);
+   if (!job)
+      return GL_FALSE;
+   job->rgba = (GLchan (*)[4])
+      _mesa_malloc(width * height * 4 * sizeof(GLchan));
+   if (!job->rgba) {
+      _mesa_free(job);
+      return GL_FALSE;
+   }
+
+   _swrast_use_read_buffer(ctx);
+   for (row = 0; row < height; row++) {
+      _swrast_read_rgba_span(ctx, rb, width, x, y + row,
+                             job->rgba + row * width);
+   }
+   _swrast_use_draw_buffer(ctx);
+
+   job->ctx = ctx;
+   job->bufObj = packing->BufferObj;
+   job->packing = *packing;
+   job->width = width;
+   job->height = height;
+   job->format = format;
+   job->type = type;
+   job->offset = offset;
+
+   _mesa_defer_buffer_write(packing->BufferObj, pack_deferred_readpix, job);
+   return GL_TRUE;
+}
+
+
 /**
  * Software fallback routine for ctx->Driver.ReadPixels().
  * We wind up using the swrast->ReadSpan() routines to do the job.
@@ -505,6 +612,9 @@ _swrast_ReadPixels( GLcontext *ctx,
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
    struct gl_pixelstore_attrib clippedPacking;
 
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return;
+
    if (swrast->NewState)
       _swrast_validate_derived( ctx );
 
@@ -529,6 +639,22 @@ _swrast_ReadPixels( GLcontext *ctx,
                      "glReadPixels(invalid PBO access)");
          return;
       }
+      if (clippedPacking.BufferObj->Pointer) {
+         _mesa_error(ctx, GL_INVALID_OPERATION, "glReadPixels(PBO is mapped)");
+         return;
+      }
+      if (format != GL_COLOR_INDEX &&
+          format != GL_STENCIL_INDEX &&
+          format != GL_DEPTH_COMPONENT) {
+         GLboolean queued;
+         RENDER_START(swrast, ctx);
+         queued = read_rgba_pixels_deferred(ctx, x, y, width, height,
+                                            format, type, pixels,
+                                            &clippedPacking);
+         RENDER_FINISH(swrast, ctx);
+         if (queued)
+            return;
+      }
       buf = (GLubyte *) ctx->Driver.MapBuffer(ctx, GL_PIXEL_PACK_BUFFER_EXT,
                                               GL_WRITE_ONLY_ARB,
                                               clippedPacking.BufferObj);
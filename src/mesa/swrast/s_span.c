@@ -182,16 +182,6 @@ interpolate_colors(GLcontext *ctx, struct sw_span *span)
       const GLfloat dg = span->greenStep;
       const GLfloat db = span->blueStep;
       const GLfloat da = span->alphaStep;
-#else
-      GLfixed r = span->red;
-      GLfixed g = span->green;
-      GLfixed b = span->blue;
-      GLfixed a = span->alpha;
-      const GLint dr = span->redStep;
-      const GLint dg = span->greenStep;
-      const GLint db = span->blueStep;
-      const GLint da = span->alphaStep;
-#endif
       for (i = 0; i < n; i++) {
          rgba[i][RCOMP] = FixedToChan(r);
          rgba[i][GCOMP] = FixedToChan(g);
@@ -202,6 +192,28 @@ interpolate_colors(GLcontext *ctx, struct sw_span *span)
          b += db;
          a += da;
       }
+#else
+      const GLfixed r = span->red;
+      const GLfixed g = span->green;
+      const GLfixed b = span->blue;
+      const GLfixed a = span->alpha;
+      const GLint dr = span->redStep;
+      const GLint dg = span->greenStep;
+      const GLint db = span->blueStep;
+      const GLint da = span->alphaStep;
+      /* Don't accumulate the steps here: gcc 12 at -O3 vectorizes the
+       * remainder of that loop with the four accumulators seeded as
+       * {r, g, r, g}, so the last pixels of a span get red and green in
+       * blue and alpha.  progs/tests/spancheck checks for this.
+       */
+      for (i = 0; i < n; i++) {
+         const GLint k = (GLint) i;
+         rgba[i][RCOMP] = FixedToChan(r + k * dr);
+         rgba[i][GCOMP] = FixedToChan(g + k * dg);
+         rgba[i][BCOMP] = FixedToChan(b + k * db);
+         rgba[i][ACOMP] = FixedToChan(a + k * da);
+      }
+#endif
    }
    span->arrayMask |= SPAN_RGBA;
 }
@@ -1419,6 +1431,49 @@ _swrast_read_rgba_span( GLcontext *ctx, struct gl_renderbuffer *rb,
 }
 
 
+/**
+ * If the color renderbuffer's storage can be addressed directly through
+ * gl_renderbuffer::GetPointer, return the size of a pixel in bytes.
+ * Rows of such buffers can be copied with plain memcpy/memmove.
+ * Return 0 if the buffer has to be accessed with Get/PutRow.
+ */
+GLuint
+_swrast_direct_pixel_size( GLcontext *ctx, struct gl_renderbuffer *rb )
+{
+   GLuint comps, bytes;
+
+   if (!rb || !rb->GetPointer(ctx, rb, 0, 0))
+      return 0;
+
+   switch (rb->_BaseFormat) {
+   case GL_RGBA:
+      comps = 4;
+      break;
+   case GL_RGB:
+      comps = 3;
+      break;
+   default:
+      return 0;
+   }
+
+   switch (rb->DataType) {
+   case GL_UNSIGNED_BYTE:
+      bytes = sizeof(GLubyte);
+      break;
+   case GL_UNSIGNED_SHORT:
+      bytes = sizeof(GLushort);
+      break;
+   case GL_FLOAT:
+      bytes = sizeof(GLfloat);
+      break;
+   default:
+      return 0;
+   }
+
+   return comps * bytes;
+}
+
+
 /**
  * Read CI pixels from frame buffer.  Clipping will be done to prevent
  * reading ouside the buffer's boundaries.
@@ -67,6 +67,9 @@ extern void
 _swrast_read_index_span( GLcontext *ctx, struct gl_renderbuffer *rb,
                          GLuint n, GLint x, GLint y, GLuint indx[] );
 
+extern GLuint
+_swrast_direct_pixel_size( GLcontext *ctx, struct gl_renderbuffer *rb );
+
 extern void
 _swrast_get_values(GLcontext *ctx, struct gl_renderbuffer *rb,
                    GLuint count, const GLint x[], const GLint y[],
@@ -0,0 +1,104 @@
+/*
+ * Mesa 3-D graphics library
+ * Version:  6.4
+ *
+ * Copyright (C) 1999-2005  Brian Paul   All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * BRIAN PAUL BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+ * AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*
+ * Template for the texture environment span kernels.
+ *
+ * Define the following macros before including this file:
+ *   NAME        the function name
+ *   TEXENV_OP0  the operation applied for the first texture unit of the
+ *               stage: one of the TEXENV_x names in s_texture.c without
+ *               the prefix, e.g. MODULATE_RGB
+ *   TEXENV_OP1  optional operation for a second texture unit; the two
+ *               units are then applied to each fragment in a single pass
+ *
+ * Operation X expands to TEXENV_X_OP(RGBA, TEXEL, UNIT), where RGBA is
+ * the fragment color to update, TEXEL the unit's texel and UNIT the
+ * unit's struct texenv_unit.  With TEXENV_USE_SSE2, TEXENV_X_SSE2 does
+ * the same on two fragments held in one register as 16-bit components.
+ */
+
+
+#define TEXENV_PASTE_OP(X)      TEXENV_##X##_OP
+#define TEXENV_PASTE_SSE2(X)    TEXENV_##X##_SSE2
+#define TEXENV_APPLY(X)         TEXENV_PASTE_OP(X)
+#define TEXENV_APPLY_SSE2(X)    TEXENV_PASTE_SSE2(X)
+
+
+static void
+NAME(const struct texenv_stage *stage, GLuint n,
+     const GLchan *texelBuffer, GLchan rgba[][4])
+{
+   /* local copies, so the stores to rgba can't alias them */
+   const struct texenv_unit u0 = stage->Unit[0];
+   const GLchan (*texel0)[4] = (const GLchan (*)[4])
+      (texelBuffer + u0.Unit * (n * 4));
+#ifdef TEXENV_OP1
+   const struct texenv_unit u1 = stage->Unit[1];
+   const GLchan (*texel1)[4] = (const GLchan (*)[4])
+      (texelBuffer + u1.Unit * (n * 4));
+#endif
+   GLuint i = 0;
+
+#ifdef TEXENV_USE_SSE2
+   {
+      const __m128i zero = _mm_setzero_si128();
+      for (; i + 4 <= n; i += 4) {
+         const __m128i c = _mm_loadu_si128((const __m128i *) rgba[i]);
+         __m128i c0 = _mm_unpacklo_epi8(c, zero);
+         __m128i c1 = _mm_unpackhi_epi8(c, zero);
+         __m128i t = _mm_loadu_si128((const __m128i *) texel0[i]);
+         __m128i t0 = _mm_unpacklo_epi8(t, zero);
+         __m128i t1 = _mm_unpackhi_epi8(t, zero);
+         TEXENV_APPLY_SSE2(TEXENV_OP0)(c0, t0, u0);
+         TEXENV_APPLY_SSE2(TEXENV_OP0)(c1, t1, u0);
+#ifdef TEXENV_OP1
+         t = _mm_loadu_si128((const __m128i *) texel1[i]);
+         t0 = _mm_unpacklo_epi8(t, zero);
+         t1 = _mm_unpackhi_epi8(t, zero);
+         TEXENV_APPLY_SSE2(TEXENV_OP1)(c0, t0, u1);
+         TEXENV_APPLY_SSE2(TEXENV_OP1)(c1, t1, u1);
+#endif
+         _mm_storeu_si128((__m128i *) rgba[i], _mm_packus_epi16(c0, c1));
+      }
+   }
+#endif
+
+   for (; i < n; i++) {
+      TEXENV_APPLY(TEXENV_OP0)(rgba[i], texel0[i], u0);
+#ifdef TEXENV_OP1
+      TEXENV_APPLY(TEXENV_OP1)(rgba[i], texel1[i], u1);
+#endif
+   }
+}
+
+
+#undef TEXENV_PASTE_OP
+#undef TEXENV_PASTE_SSE2
+#undef TEXENV_APPLY
+#undef TEXENV_APPLY_SSE2
+#undef NAME
+#undef TEXENV_OP0
+#undef TEXENV_OP1
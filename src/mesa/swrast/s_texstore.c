@@ -67,6 +67,9 @@ read_color_image( GLcontext *ctx, GLint x, GLint y,
    GLint stride, i;
    GLchan *image, *dst;
 
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return NULL;
+
    image = (GLchan *) _mesa_malloc(width * height * 4 * sizeof(GLchan));
    if (!image)
       return NULL;
@@ -106,6 +109,9 @@ read_depth_image( GLcontext *ctx, GLint x, GLint y,
    GLfloat *image, *dst;
    GLint i;
 
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return NULL;
+
    image = (GLfloat *) _mesa_malloc(width * height * sizeof(GLfloat));
    if (!image)
       return NULL;
@@ -125,6 +131,134 @@ read_depth_image( GLcontext *ctx, GLint x, GLint y,
 
 
 
+/*
+ * Try to copy a region of the framebuffer straight into the texture
+ * image's memory for glCopyTexSubImage[123]D(), without the temporary
+ * image and the trip through the generic texture store code.
+ * This is possible when no pixel transfer operations are enabled and the
+ * texture format is one which framebuffer spans convert to trivially.
+ * Return:  GL_TRUE if done, GL_FALSE if the general path must be used
+ */
+static GLboolean
+copy_texsubimage_direct( GLcontext *ctx, struct gl_texture_image *texImage,
+                         GLint xoffset, GLint yoffset, GLint zoffset,
+                         GLint x, GLint y, GLsizei width, GLsizei height )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   const struct gl_texture_format *texFormat = texImage->TexFormat;
+   GLint dstRowStride, i, j;
+   GLubyte *dst;
+
+   if (ctx->_ImageTransferState ||
+       !texImage->Data ||
+       texImage->IsCompressed ||
+       texImage->Format != texFormat->BaseFormat ||
+       width > MAX_WIDTH)
+      return GL_FALSE;
+
+   if (!SWRAST_ALLOC_BUFFERS(swrast, ctx))
+      return GL_TRUE;  /* out of memory, nothing to copy */
+
+   dstRowStride = texImage->Width * texFormat->TexelBytes;
+   dst = (GLubyte *) texImage->Data
+       + (zoffset * texImage->Height + yoffset) * dstRowStride
+       + xoffset * texFormat->TexelBytes;
+
+   switch (texFormat->MesaFormat) {
+   case MESA_FORMAT_RGBA:
+   case MESA_FORMAT_RGB:
+#if CHAN_BITS == 8
+   case MESA_FORMAT_ARGB8888:
+#endif
+      {
+         struct gl_renderbuffer *rb = ctx->ReadBuffer->_ColorReadBuffer;
+         GLchan rgba[MAX_WIDTH][4];
+
+         _swrast_use_read_buffer(ctx);
+         RENDER_START(swrast, ctx);
+
+         for (j = 0; j < height; j++) {
+            if (texFormat->MesaFormat == MESA_FORMAT_RGBA) {
+               /* read right into the texture */
+               _swrast_read_rgba_span(ctx, rb, width, x, y + j,
+                                      (GLchan (*)[4]) dst);
+            }
+            else if (texFormat->MesaFormat == MESA_FORMAT_RGB) {
+               GLchan *dstRGB = (GLchan *) dst;
+               _swrast_read_rgba_span(ctx, rb, width, x, y + j, rgba);
+               for (i = 0; i < width; i++) {
+                  dstRGB[i * 3 + 0] = rgba[i][RCOMP];
+                  dstRGB[i * 3 + 1] = rgba[i][GCOMP];
+                  dstRGB[i * 3 + 2] = rgba[i][BCOMP];
+               }
+            }
+#if CHAN_BITS == 8
+            else {
+               GLuint *dstUI = (GLuint *) dst;
+               _swrast_read_rgba_span(ctx, rb, width, x, y + j, rgba);
+               for (i = 0; i < width; i++) {
+                  dstUI[i] = PACK_COLOR_8888(rgba[i][ACOMP], rgba[i][RCOMP],
+                                             rgba[i][GCOMP], rgba[i][BCOMP]);
+               }
+            }
+#endif
+            dst += dstRowStride;
+         }
+
+         RENDER_FINISH(swrast, ctx);
+         _swrast_use_draw_buffer(ctx);
+      }
+      return GL_TRUE;
+   case MESA_FORMAT_DEPTH_COMPONENT16:
+   case MESA_FORMAT_DEPTH_COMPONENT_FLOAT32:
+      {
+         struct gl_renderbuffer *rb
+            = ctx->ReadBuffer->Attachment[BUFFER_DEPTH].Renderbuffer;
+         GLboolean exact;
+
+         if (!rb)
+            return GL_FALSE;
+
+         /* values read from a full 16-bit depth buffer are the texels */
+         exact = texFormat->MesaFormat == MESA_FORMAT_DEPTH_COMPONENT16
+            && rb->DataType == GL_UNSIGNED_SHORT
+            && ctx->ReadBuffer->_DepthMax == 0xffff;
+
+         RENDER_START(swrast, ctx);
+
+         for (j = 0; j < height; j++) {
+            if (exact) {
+               /* same precision, no conversion needed */
+               GLushort *dst16 = (GLushort *) dst;
+               GLuint depth[MAX_WIDTH];
+               _swrast_read_depth_span(ctx, rb, width, x, y + j, depth);
+               for (i = 0; i < width; i++)
+                  dst16[i] = (GLushort) depth[i];
+            }
+            else if (texFormat->MesaFormat == MESA_FORMAT_DEPTH_COMPONENT16) {
+               GLushort *dst16 = (GLushort *) dst;
+               GLfloat depth[MAX_WIDTH];
+               _swrast_read_depth_span_float(ctx, rb, width, x, y + j, depth);
+               for (i = 0; i < width; i++)
+                  dst16[i] = (GLushort) (depth[i] * 65535.0F);
+            }
+            else {
+               _swrast_read_depth_span_float(ctx, rb, width, x, y + j,
+                                             (GLfloat *) dst);
+            }
+            dst += dstRowStride;
+         }
+
+         RENDER_FINISH(swrast, ctx);
+      }
+      return GL_TRUE;
+   default:
+      return GL_FALSE;
+   }
+}
+
+
+
 static GLboolean
 is_depth_format(GLenum format)
 {
@@ -276,7 +410,12 @@ _swrast_copy_texsubimage1d( GLcontext *ctx, GLenum target, GLint level,
 
    ASSERT(ctx->Driver.TexImage1D);
 
-   if (texImage->Format == GL_DEPTH_COMPONENT) {
+   if (ctx->Driver.TexSubImage1D == _mesa_store_texsubimage1d &&
+       copy_texsubimage_direct(ctx, texImage, xoffset, 0, 0,
+                               x, y, width, 1)) {
+      /* done */
+   }
+   else if (texImage->Format == GL_DEPTH_COMPONENT) {
       /* read depth image from framebuffer */
       GLfloat *image = read_depth_image(ctx, x, y, width, 1);
       if (!image) {
@@ -333,7 +472,12 @@ _swrast_copy_texsubimage2d( GLcontext *ctx,
 
    ASSERT(ctx->Driver.TexImage2D);
 
-   if (texImage->Format == GL_DEPTH_COMPONENT) {
+   if (ctx->Driver.TexSubImage2D == _mesa_store_texsubimage2d &&
+       copy_texsubimage_direct(ctx, texImage, xoffset, yoffset, 0,
+                               x, y, width, height)) {
+      /* done */
+   }
+   else if (texImage->Format == GL_DEPTH_COMPONENT) {
       /* read depth image from framebuffer */
       GLfloat *image = read_depth_image(ctx, x, y, width, height);
       if (!image) {
@@ -392,7 +536,12 @@ _swrast_copy_texsubimage3d( GLcontext *ctx,
 
    ASSERT(ctx->Driver.TexImage3D);
 
-   if (texImage->Format == GL_DEPTH_COMPONENT) {
+   if (ctx->Driver.TexSubImage3D == _mesa_store_texsubimage3d &&
+       copy_texsubimage_direct(ctx, texImage, xoffset, yoffset, zoffset,
+                               x, y, width, height)) {
+      /* done */
+   }
+   else if (texImage->Format == GL_DEPTH_COMPONENT) {
       /* read depth image from framebuffer */
       GLfloat *image = read_depth_image(ctx, x, y, width, height);
       if (!image) {
@@ -3868,6 +3868,933 @@ texture_apply( const GLcontext *ctx,
 
 
 
+/**
+ * Texture environment span kernels.
+ *
+ * _swrast_choose_texture_env() compiles the texture environment of all
+ * enabled units into a texenv_program: a list of stages, each applied to
+ * the whole span by one kernel.  For 8-bit GLchan, the classic modes
+ * (for each base format) and the usual GL_COMBINE setups are expanded
+ * from s_texenvtmp.h with the mode and format switches resolved at
+ * compile time.  Where SSE2 is available at compile time the kernels
+ * process four fragments per iteration with 16-bit integer math.  Common
+ * two-unit combinations are fused into a single kernel, so the fragment
+ * colors are read and written once for both units.  Any other unit is a
+ * stage of its own, run by texture_combine() or texture_apply() as
+ * before.
+ */
+
+/** Texture environment operations with a specialized kernel */
+enum {
+   TEXENV_GENERAL,      /**< texture_combine() / texture_apply() */
+   TEXENV_NOP,          /**< leaves the fragment unchanged */
+   TEXENV_REPLACE_A,
+   TEXENV_REPLACE_L,
+   TEXENV_REPLACE_LA,
+   TEXENV_REPLACE_I,
+   TEXENV_REPLACE_RGB,
+   TEXENV_REPLACE_RGBA,
+   TEXENV_MODULATE_A,
+   TEXENV_MODULATE_L,
+   TEXENV_MODULATE_LA,
+   TEXENV_MODULATE_I,
+   TEXENV_MODULATE_RGB,
+   TEXENV_MODULATE_RGBA,
+   TEXENV_DECAL_RGBA,
+   TEXENV_BLEND_L,
+   TEXENV_BLEND_LA,
+   TEXENV_BLEND_I,
+   TEXENV_BLEND_RGB,
+   TEXENV_BLEND_RGBA,
+   TEXENV_ADD_L,
+   TEXENV_ADD_LA,
+   TEXENV_ADD_I,
+   TEXENV_ADD_RGB,
+   TEXENV_ADD_RGBA,
+   TEXENV_COMBINE_MODULATE_TP,  /**< GL_MODULATE of texture and previous */
+   TEXENV_COMBINE_MODULATE_PT,  /**< GL_MODULATE of previous and texture */
+   TEXENV_COMBINE_ADD,          /**< GL_ADD of texture and previous */
+   TEXENV_NUM_OPS
+};
+
+
+/** Compiled environment of one texture unit */
+struct texenv_unit
+{
+   GLuint Unit;            /**< texture unit, selects the texels */
+   GLuint Op;              /**< TEXENV_x */
+   GLint EnvColor[4];      /**< GL_BLEND color */
+   GLuint ShiftRGB;        /**< GL_COMBINE scale shift */
+   GLuint ShiftA;
+};
+
+struct texenv_stage;
+
+typedef void (*texenv_span_func)(const struct texenv_stage *stage, GLuint n,
+                                 const GLchan *texelBuffer, GLchan rgba[][4]);
+
+/** One or two units applied by one kernel */
+struct texenv_stage
+{
+   texenv_span_func Func;   /**< NULL for a TEXENV_GENERAL unit */
+   GLuint NumUnits;
+   struct texenv_unit Unit[2];
+};
+
+struct texenv_program
+{
+   struct texenv_stage Stages[MAX_TEXTURE_UNITS];
+   GLuint NumStages;
+};
+
+
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define TEXENV_USE_SSE2
+#endif
+
+/*
+ * Per-fragment operations.  They compute exactly what texture_apply()
+ * and texture_combine() do for the same state.
+ */
+#define TEXENV_REPLACE_A_OP(C, T, U)				\
+do {								\
+   (C)[ACOMP] = (T)[ACOMP];					\
+} while (0)
+
+#define TEXENV_REPLACE_L_OP(C, T, U)				\
+do {								\
+   const GLchan Lt = (T)[RCOMP];				\
+   (C)[RCOMP] = (C)[GCOMP] = (C)[BCOMP] = Lt;			\
+} while (0)
+
+#define TEXENV_REPLACE_LA_OP(C, T, U)				\
+do {								\
+   const GLchan Lt = (T)[RCOMP];				\
+   (C)[RCOMP] = (C)[GCOMP] = (C)[BCOMP] = Lt;			\
+   (C)[ACOMP] = (T)[ACOMP];					\
+} while (0)
+
+#define TEXENV_REPLACE_I_OP(C, T, U)				\
+do {								\
+   const GLchan It = (T)[RCOMP];				\
+   (C)[RCOMP] = (C)[GCOMP] = (C)[BCOMP] = (C)[ACOMP] = It;	\
+} while (0)
+
+#define TEXENV_REPLACE_RGB_OP(C, T, U)				\
+do {								\
+   (C)[RCOMP] = (T)[RCOMP];					\
+   (C)[GCOMP] = (T)[GCOMP];					\
+   (C)[BCOMP] = (T)[BCOMP];					\
+} while (0)
+
+#define TEXENV_REPLACE_RGBA_OP(C, T, U)				\
+do {								\
+   TEXENV_REPLACE_RGB_OP(C, T, U);				\
+   (C)[ACOMP] = (T)[ACOMP];					\
+} while (0)
+
+#define TEXENV_MODULATE_A_OP(C, T, U)				\
+do {								\
+   (C)[ACOMP] = CHAN_PRODUCT((C)[ACOMP], (T)[ACOMP]);		\
+} while (0)
+
+#define TEXENV_MODULATE_L_OP(C, T, U)				\
+do {								\
+   const GLchan Lt = (T)[RCOMP];				\
+   (C)[RCOMP] = CHAN_PRODUCT((C)[RCOMP], Lt);			\
+   (C)[GCOMP] = CHAN_PRODUCT((C)[GCOMP], Lt);			\
+   (C)[BCOMP] = CHAN_PRODUCT((C)[BCOMP], Lt);			\
+} while (0)
+
+#define TEXENV_MODULATE_LA_OP(C, T, U)				\
+do {								\
+   TEXENV_MODULATE_L_OP(C, T, U);				\
+   TEXENV_MODULATE_A_OP(C, T, U);				\
+} while (0)
+
+#define TEXENV_MODULATE_I_OP(C, T, U)				\
+do {								\
+   const GLchan It = (T)[RCOMP];				\
+   (C)[RCOMP] = CHAN_PRODUCT((C)[RCOMP], It);			\
+   (C)[GCOMP] = CHAN_PRODUCT((C)[GCOMP], It);			\
+   (C)[BCOMP] = CHAN_PRODUCT((C)[BCOMP], It);			\
+   (C)[ACOMP] = CHAN_PRODUCT((C)[ACOMP], It);			\
+} while (0)
+
+#define TEXENV_MODULATE_RGB_OP(C, T, U)				\
+do {								\
+   (C)[RCOMP] = CHAN_PRODUCT((C)[RCOMP], (T)[RCOMP]);		\
+   (C)[GCOMP] = CHAN_PRODUCT((C)[GCOMP], (T)[GCOMP]);		\
+   (C)[BCOMP] = CHAN_PRODUCT((C)[BCOMP], (T)[BCOMP]);		\
+} while (0)
+
+#define TEXENV_MODULATE_RGBA_OP(C, T, U)			\
+do {								\
+   TEXENV_MODULATE_RGB_OP(C, T, U);				\
+   TEXENV_MODULATE_A_OP(C, T, U);				\
+} while (0)
+
+/* Cv = Cf(1-At) + CtAt */
+#define TEXENV_DECAL_RGBA_OP(C, T, U)				\
+do {								\
+   const GLint t = (T)[ACOMP], s = CHAN_MAX - t;		\
+   (C)[RCOMP] = CHAN_PRODUCT((C)[RCOMP], s) + CHAN_PRODUCT((T)[RCOMP], t); \
+   (C)[GCOMP] = CHAN_PRODUCT((C)[GCOMP], s) + CHAN_PRODUCT((T)[GCOMP], t); \
+   (C)[BCOMP] = CHAN_PRODUCT((C)[BCOMP], s) + CHAN_PRODUCT((T)[BCOMP], t); \
+} while (0)
+
+/* Cv = Cf(1-Lt) + CcLt */
+#define TEXENV_BLEND_L_OP(C, T, U)				\
+do {								\
+   const GLchan Lt = (T)[RCOMP], s = CHAN_MAX - Lt;		\
+   (C)[RCOMP] = CHAN_PRODUCT((C)[RCOMP], s) + CHAN_PRODUCT((U).EnvColor[0], Lt); \
+   (C)[GCOMP] = CHAN_PRODUCT((C)[GCOMP], s) + CHAN_PRODUCT((U).EnvColor[1], Lt); \
+   (C)[BCOMP] = CHAN_PRODUCT((C)[BCOMP], s) + CHAN_PRODUCT((U).EnvColor[2], Lt); \
+} while (0)
+
+#define TEXENV_BLEND_LA_OP(C, T, U)				\
+do {								\
+   TEXENV_BLEND_L_OP(C, T, U);					\
+   TEXENV_MODULATE_A_OP(C, T, U);				\
+} while (0)
+
+/* Cv = Cf(1-It) + CcIt, Av = Af(1-It) + AcIt */
+#define TEXENV_BLEND_I_OP(C, T, U)				\
+do {								\
+   const GLchan It = (T)[RCOMP], s = CHAN_MAX - It;		\
+   (C)[RCOMP] = CHAN_PRODUCT((C)[RCOMP], s) + CHAN_PRODUCT((U).EnvColor[0], It); \
+   (C)[GCOMP] = CHAN_PRODUCT((C)[GCOMP], s) + CHAN_PRODUCT((U).EnvColor[1], It); \
+   (C)[BCOMP] = CHAN_PRODUCT((C)[BCOMP], s) + CHAN_PRODUCT((U).EnvColor[2], It); \
+   (C)[ACOMP] = CHAN_PRODUCT((C)[ACOMP], s) + CHAN_PRODUCT((U).EnvColor[3], It); \
+} while (0)
+
+/* Cv = Cf(1-Ct) + CcCt */
+#define TEXENV_BLEND_RGB_OP(C, T, U)				\
+do {								\
+   (C)[RCOMP] = CHAN_PRODUCT((C)[RCOMP], CHAN_MAX - (T)[RCOMP])	\
+              + CHAN_PRODUCT((U).EnvColor[0], (T)[RCOMP]);	\
+   (C)[GCOMP] = CHAN_PRODUCT((C)[GCOMP], CHAN_MAX - (T)[GCOMP])	\
+              + CHAN_PRODUCT((U).EnvColor[1], (T)[GCOMP]);	\
+   (C)[BCOMP] = CHAN_PRODUCT((C)[BCOMP], CHAN_MAX - (T)[BCOMP])	\
+              + CHAN_PRODUCT((U).EnvColor[2], (T)[BCOMP]);	\
+} while (0)
+
+#define TEXENV_BLEND_RGBA_OP(C, T, U)				\
+do {								\
+   TEXENV_BLEND_RGB_OP(C, T, U);				\
+   TEXENV_MODULATE_A_OP(C, T, U);				\
+} while (0)
+
+#define TEXENV_ADD_L_OP(C, T, U)				\
+do {								\
+   const GLuint Lt = (T)[RCOMP];				\
+   const GLuint r = (C)[RCOMP] + Lt;				\
+   const GLuint g = (C)[GCOMP] + Lt;				\
+   const GLuint b = (C)[BCOMP] + Lt;				\
+   (C)[RCOMP] = MIN2(r, CHAN_MAX);				\
+   (C)[GCOMP] = MIN2(g, CHAN_MAX);				\
+   (C)[BCOMP] = MIN2(b, CHAN_MAX);				\
+} while (0)
+
+#define TEXENV_ADD_LA_OP(C, T, U)				\
+do {								\
+   TEXENV_ADD_L_OP(C, T, U);					\
+   TEXENV_MODULATE_A_OP(C, T, U);				\
+} while (0)
+
+#define TEXENV_ADD_I_OP(C, T, U)				\
+do {								\
+   const GLuint It = (T)[RCOMP];				\
+   const GLuint r = (C)[RCOMP] + It;				\
+   const GLuint g = (C)[GCOMP] + It;				\
+   const GLuint b = (C)[BCOMP] + It;				\
+   const GLuint a = (C)[ACOMP] + It;				\
+   (C)[RCOMP] = MIN2(r, CHAN_MAX);				\
+   (C)[GCOMP] = MIN2(g, CHAN_MAX);				\
+   (C)[BCOMP] = MIN2(b, CHAN_MAX);				\
+   (C)[ACOMP] = MIN2(a, CHAN_MAX);				\
+} while (0)
+
+#define TEXENV_ADD_RGB_OP(C, T, U)				\
+do {								\
+   const GLuint r = (C)[RCOMP] + (T)[RCOMP];			\
+   const GLuint g = (C)[GCOMP] + (T)[GCOMP];			\
+   const GLuint b = (C)[BCOMP] + (T)[BCOMP];			\
+   (C)[RCOMP] = MIN2(r, CHAN_MAX);				\
+   (C)[GCOMP] = MIN2(g, CHAN_MAX);				\
+   (C)[BCOMP] = MIN2(b, CHAN_MAX);				\
+} while (0)
+
+#define TEXENV_ADD_RGBA_OP(C, T, U)				\
+do {								\
+   TEXENV_ADD_RGB_OP(C, T, U);					\
+   TEXENV_MODULATE_A_OP(C, T, U);				\
+} while (0)
+
+#define PROD(A,B)   ( (GLuint)(A) * ((GLuint)(B)+1) )
+
+/* GL_COMBINE, GL_MODULATE of arguments A0 and A1, any scale */
+#define TEXENV_COMBINE_MODULATE(C, A0, A1, U)			\
+do {								\
+   const GLuint shiftRGB = CHAN_BITS - (U).ShiftRGB;		\
+   const GLuint shiftA = CHAN_BITS - (U).ShiftA;		\
+   const GLuint r = PROD((A0)[RCOMP], (A1)[RCOMP]) >> shiftRGB;	\
+   const GLuint g = PROD((A0)[GCOMP], (A1)[GCOMP]) >> shiftRGB;	\
+   const GLuint b = PROD((A0)[BCOMP], (A1)[BCOMP]) >> shiftRGB;	\
+   const GLuint a = PROD((A0)[ACOMP], (A1)[ACOMP]) >> shiftA;	\
+   (C)[RCOMP] = (GLchan) MIN2(r, CHAN_MAX);			\
+   (C)[GCOMP] = (GLchan) MIN2(g, CHAN_MAX);			\
+   (C)[BCOMP] = (GLchan) MIN2(b, CHAN_MAX);			\
+   (C)[ACOMP] = (GLchan) MIN2(a, CHAN_MAX);			\
+} while (0)
+
+#define TEXENV_COMBINE_MODULATE_TP_OP(C, T, U)			\
+   TEXENV_COMBINE_MODULATE(C, T, C, U)
+
+#define TEXENV_COMBINE_MODULATE_PT_OP(C, T, U)			\
+   TEXENV_COMBINE_MODULATE(C, C, T, U)
+
+/* GL_COMBINE, GL_ADD of texture and previous, any scale */
+#define TEXENV_COMBINE_ADD_OP(C, T, U)				\
+do {								\
+   const GLint r = ((GLint) (T)[RCOMP] + (GLint) (C)[RCOMP]) << (U).ShiftRGB; \
+   const GLint g = ((GLint) (T)[GCOMP] + (GLint) (C)[GCOMP]) << (U).ShiftRGB; \
+   const GLint b = ((GLint) (T)[BCOMP] + (GLint) (C)[BCOMP]) << (U).ShiftRGB; \
+   const GLint a = ((GLint) (T)[ACOMP] + (GLint) (C)[ACOMP]) << (U).ShiftA; \
+   (C)[RCOMP] = (GLchan) MIN2(r, CHAN_MAX);			\
+   (C)[GCOMP] = (GLchan) MIN2(g, CHAN_MAX);			\
+   (C)[BCOMP] = (GLchan) MIN2(b, CHAN_MAX);			\
+   (C)[ACOMP] = (GLchan) MIN2(a, CHAN_MAX);			\
+} while (0)
+
+
+#ifdef TEXENV_USE_SSE2
+
+/*
+ * The same operations on two fragments at a time, with the components
+ * widened to 16 bits: C and T hold R,G,B,A of two fragments in the low
+ * and high halves.  The results must stay in [0, CHAN_MAX] for the final
+ * pack to bytes.
+ */
+#define TEXENV_ALPHA_MASK  _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0)
+
+/* take alpha from A, red/green/blue from RGB */
+#define TEXENV_MERGE(A, RGB)						\
+   _mm_or_si128(_mm_and_si128(TEXENV_ALPHA_MASK, A),			\
+                _mm_andnot_si128(TEXENV_ALPHA_MASK, RGB))
+
+#define TEXENV_SHUFFLE(T, MASK)						\
+   _mm_shufflehi_epi16(_mm_shufflelo_epi16(T, MASK), MASK)
+
+#define TEXENV_SPLAT_R(T)   TEXENV_SHUFFLE(T, _MM_SHUFFLE(0, 0, 0, 0))
+#define TEXENV_SPLAT_A(T)   TEXENV_SHUFFLE(T, _MM_SHUFFLE(3, 3, 3, 3))
+#define TEXENV_SPLAT_RA(T)  TEXENV_SHUFFLE(T, _MM_SHUFFLE(3, 0, 0, 0))
+
+/* CHAN_PRODUCT(A, B) */
+#define TEXENV_PRODUCT(A, B)						\
+   _mm_srli_epi16(_mm_mullo_epi16(A, _mm_add_epi16(B, _mm_set1_epi16(1))), 8)
+
+/* MIN2(A, CHAN_MAX) */
+#define TEXENV_CLAMP(A)  _mm_min_epi16(A, _mm_set1_epi16(CHAN_MAX))
+
+/* truncation to GLchan, as the scalar code stores GLint sums */
+#define TEXENV_TRUNC(A)  _mm_and_si128(A, _mm_set1_epi16(CHAN_MAX))
+
+/* CHAN_PRODUCT(C, CHAN_MAX - F) + CHAN_PRODUCT(E, F) */
+#define TEXENV_LERP(C, E, F)						\
+   TEXENV_TRUNC(_mm_add_epi16(						\
+      TEXENV_PRODUCT(C, _mm_sub_epi16(_mm_set1_epi16(CHAN_MAX), F)),	\
+      TEXENV_PRODUCT(E, F)))
+
+#define TEXENV_ENV_COLOR(U)						\
+   _mm_set_epi16((short) (U).EnvColor[3], (short) (U).EnvColor[2],	\
+                 (short) (U).EnvColor[1], (short) (U).EnvColor[0],	\
+                 (short) (U).EnvColor[3], (short) (U).EnvColor[2],	\
+                 (short) (U).EnvColor[1], (short) (U).EnvColor[0])
+
+#define TEXENV_REPLACE_A_SSE2(C, T, U)  C = TEXENV_MERGE(T, C)
+#define TEXENV_REPLACE_L_SSE2(C, T, U)  C = TEXENV_MERGE(C, TEXENV_SPLAT_R(T))
+#define TEXENV_REPLACE_LA_SSE2(C, T, U) C = TEXENV_SPLAT_RA(T)
+#define TEXENV_REPLACE_I_SSE2(C, T, U)  C = TEXENV_SPLAT_R(T)
+#define TEXENV_REPLACE_RGB_SSE2(C, T, U) C = TEXENV_MERGE(C, T)
+#define TEXENV_REPLACE_RGBA_SSE2(C, T, U) C = T
+
+#define TEXENV_MODULATE_A_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(TEXENV_PRODUCT(C, T), C)
+#define TEXENV_MODULATE_L_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(C, TEXENV_PRODUCT(C, TEXENV_SPLAT_R(T)))
+#define TEXENV_MODULATE_LA_SSE2(C, T, U)			\
+   C = TEXENV_PRODUCT(C, TEXENV_SPLAT_RA(T))
+#define TEXENV_MODULATE_I_SSE2(C, T, U)				\
+   C = TEXENV_PRODUCT(C, TEXENV_SPLAT_R(T))
+#define TEXENV_MODULATE_RGB_SSE2(C, T, U)			\
+   C = TEXENV_MERGE(C, TEXENV_PRODUCT(C, T))
+#define TEXENV_MODULATE_RGBA_SSE2(C, T, U)			\
+   C = TEXENV_PRODUCT(C, T)
+
+#define TEXENV_DECAL_RGBA_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(C, TEXENV_LERP(C, T, TEXENV_SPLAT_A(T)))
+
+#define TEXENV_BLEND_L_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(C, TEXENV_LERP(C, TEXENV_ENV_COLOR(U), TEXENV_SPLAT_R(T)))
+#define TEXENV_BLEND_LA_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(TEXENV_PRODUCT(C, T),			\
+                    TEXENV_LERP(C, TEXENV_ENV_COLOR(U), TEXENV_SPLAT_R(T)))
+#define TEXENV_BLEND_I_SSE2(C, T, U)				\
+   C = TEXENV_LERP(C, TEXENV_ENV_COLOR(U), TEXENV_SPLAT_R(T))
+#define TEXENV_BLEND_RGB_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(C, TEXENV_LERP(C, TEXENV_ENV_COLOR(U), T))
+#define TEXENV_BLEND_RGBA_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(TEXENV_PRODUCT(C, T),			\
+                    TEXENV_LERP(C, TEXENV_ENV_COLOR(U), T))
+
+#define TEXENV_ADD_L_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(C, TEXENV_CLAMP(_mm_add_epi16(C, TEXENV_SPLAT_R(T))))
+#define TEXENV_ADD_LA_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(TEXENV_PRODUCT(C, T),			\
+                    TEXENV_CLAMP(_mm_add_epi16(C, TEXENV_SPLAT_R(T))))
+#define TEXENV_ADD_I_SSE2(C, T, U)				\
+   C = TEXENV_CLAMP(_mm_add_epi16(C, TEXENV_SPLAT_R(T)))
+#define TEXENV_ADD_RGB_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(C, TEXENV_CLAMP(_mm_add_epi16(C, T)))
+#define TEXENV_ADD_RGBA_SSE2(C, T, U)				\
+   C = TEXENV_MERGE(TEXENV_PRODUCT(C, T), TEXENV_CLAMP(_mm_add_epi16(C, T)))
+
+/* PROD(A0, A1) >> (CHAN_BITS - shift), clamped */
+#define TEXENV_COMBINE_MODULATE_SSE2(C, A0, A1, U)		\
+do {								\
+   const __m128i p = _mm_mullo_epi16(A0, _mm_add_epi16(A1, _mm_set1_epi16(1))); \
+   C = TEXENV_CLAMP(TEXENV_MERGE(					\
+          _mm_srl_epi16(p, _mm_cvtsi32_si128(CHAN_BITS - (U).ShiftA)),	\
+          _mm_srl_epi16(p, _mm_cvtsi32_si128(CHAN_BITS - (U).ShiftRGB)))); \
+} while (0)
+
+#define TEXENV_COMBINE_MODULATE_TP_SSE2(C, T, U)		\
+   TEXENV_COMBINE_MODULATE_SSE2(C, T, C, U)
+#define TEXENV_COMBINE_MODULATE_PT_SSE2(C, T, U)		\
+   TEXENV_COMBINE_MODULATE_SSE2(C, C, T, U)
+
+#define TEXENV_COMBINE_ADD_SSE2(C, T, U)			\
+do {								\
+   const __m128i s = _mm_add_epi16(T, C);			\
+   C = TEXENV_CLAMP(TEXENV_MERGE(					\
+          _mm_sll_epi16(s, _mm_cvtsi32_si128((U).ShiftA)),		\
+          _mm_sll_epi16(s, _mm_cvtsi32_si128((U).ShiftRGB))));	\
+} while (0)
+
+#endif /* TEXENV_USE_SSE2 */
+
+
+/* Single unit kernels */
+#define NAME texenv_replace_a
+#define TEXENV_OP0 REPLACE_A
+#include "s_texenvtmp.h"
+
+#define NAME texenv_replace_l
+#define TEXENV_OP0 REPLACE_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_replace_la
+#define TEXENV_OP0 REPLACE_LA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_replace_i
+#define TEXENV_OP0 REPLACE_I
+#include "s_texenvtmp.h"
+
+#define NAME texenv_replace_rgb
+#define TEXENV_OP0 REPLACE_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_replace_rgba
+#define TEXENV_OP0 REPLACE_RGBA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_a
+#define TEXENV_OP0 MODULATE_A
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_l
+#define TEXENV_OP0 MODULATE_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_la
+#define TEXENV_OP0 MODULATE_LA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_i
+#define TEXENV_OP0 MODULATE_I
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgb
+#define TEXENV_OP0 MODULATE_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgba
+#define TEXENV_OP0 MODULATE_RGBA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_decal_rgba
+#define TEXENV_OP0 DECAL_RGBA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_blend_l
+#define TEXENV_OP0 BLEND_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_blend_la
+#define TEXENV_OP0 BLEND_LA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_blend_i
+#define TEXENV_OP0 BLEND_I
+#include "s_texenvtmp.h"
+
+#define NAME texenv_blend_rgb
+#define TEXENV_OP0 BLEND_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_blend_rgba
+#define TEXENV_OP0 BLEND_RGBA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_add_l
+#define TEXENV_OP0 ADD_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_add_la
+#define TEXENV_OP0 ADD_LA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_add_i
+#define TEXENV_OP0 ADD_I
+#include "s_texenvtmp.h"
+
+#define NAME texenv_add_rgb
+#define TEXENV_OP0 ADD_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_add_rgba
+#define TEXENV_OP0 ADD_RGBA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_combine_modulate_tp
+#define TEXENV_OP0 COMBINE_MODULATE_TP
+#include "s_texenvtmp.h"
+
+#define NAME texenv_combine_modulate_pt
+#define TEXENV_OP0 COMBINE_MODULATE_PT
+#include "s_texenvtmp.h"
+
+#define NAME texenv_combine_add
+#define TEXENV_OP0 COMBINE_ADD
+#include "s_texenvtmp.h"
+
+
+/* Fused kernels for the usual base texture * detail/light map setups */
+#define NAME texenv_modulate_rgb_modulate_rgb
+#define TEXENV_OP0 MODULATE_RGB
+#define TEXENV_OP1 MODULATE_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgb_modulate_rgba
+#define TEXENV_OP0 MODULATE_RGB
+#define TEXENV_OP1 MODULATE_RGBA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgb_modulate_l
+#define TEXENV_OP0 MODULATE_RGB
+#define TEXENV_OP1 MODULATE_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgb_modulate_i
+#define TEXENV_OP0 MODULATE_RGB
+#define TEXENV_OP1 MODULATE_I
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgb_add_l
+#define TEXENV_OP0 MODULATE_RGB
+#define TEXENV_OP1 ADD_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgb_add_rgb
+#define TEXENV_OP0 MODULATE_RGB
+#define TEXENV_OP1 ADD_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgb_decal_rgba
+#define TEXENV_OP0 MODULATE_RGB
+#define TEXENV_OP1 DECAL_RGBA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgba_modulate_rgb
+#define TEXENV_OP0 MODULATE_RGBA
+#define TEXENV_OP1 MODULATE_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgba_modulate_rgba
+#define TEXENV_OP0 MODULATE_RGBA
+#define TEXENV_OP1 MODULATE_RGBA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgba_modulate_l
+#define TEXENV_OP0 MODULATE_RGBA
+#define TEXENV_OP1 MODULATE_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgba_modulate_i
+#define TEXENV_OP0 MODULATE_RGBA
+#define TEXENV_OP1 MODULATE_I
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgba_add_l
+#define TEXENV_OP0 MODULATE_RGBA
+#define TEXENV_OP1 ADD_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgba_add_rgb
+#define TEXENV_OP0 MODULATE_RGBA
+#define TEXENV_OP1 ADD_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_modulate_rgba_decal_rgba
+#define TEXENV_OP0 MODULATE_RGBA
+#define TEXENV_OP1 DECAL_RGBA
+#include "s_texenvtmp.h"
+
+#define NAME texenv_replace_rgb_modulate_rgb
+#define TEXENV_OP0 REPLACE_RGB
+#define TEXENV_OP1 MODULATE_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_replace_rgb_modulate_l
+#define TEXENV_OP0 REPLACE_RGB
+#define TEXENV_OP1 MODULATE_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_replace_rgba_modulate_rgb
+#define TEXENV_OP0 REPLACE_RGBA
+#define TEXENV_OP1 MODULATE_RGB
+#include "s_texenvtmp.h"
+
+#define NAME texenv_replace_rgba_modulate_l
+#define TEXENV_OP0 REPLACE_RGBA
+#define TEXENV_OP1 MODULATE_L
+#include "s_texenvtmp.h"
+
+#define NAME texenv_combine_modulate_tp_combine_modulate_tp
+#define TEXENV_OP0 COMBINE_MODULATE_TP
+#define TEXENV_OP1 COMBINE_MODULATE_TP
+#include "s_texenvtmp.h"
+
+#define NAME texenv_combine_modulate_tp_combine_modulate_pt
+#define TEXENV_OP0 COMBINE_MODULATE_TP
+#define TEXENV_OP1 COMBINE_MODULATE_PT
+#include "s_texenvtmp.h"
+
+#define NAME texenv_combine_modulate_tp_combine_add
+#define TEXENV_OP0 COMBINE_MODULATE_TP
+#define TEXENV_OP1 COMBINE_ADD
+#include "s_texenvtmp.h"
+
+#define NAME texenv_combine_modulate_pt_combine_modulate_pt
+#define TEXENV_OP0 COMBINE_MODULATE_PT
+#define TEXENV_OP1 COMBINE_MODULATE_PT
+#include "s_texenvtmp.h"
+
+#define NAME texenv_combine_modulate_pt_combine_modulate_tp
+#define TEXENV_OP0 COMBINE_MODULATE_PT
+#define TEXENV_OP1 COMBINE_MODULATE_TP
+#include "s_texenvtmp.h"
+
+#undef PROD
+
+
+/** Single unit kernels, indexed by TEXENV_x */
+static const texenv_span_func texenv_funcs[TEXENV_NUM_OPS] = {
+   NULL,
+   NULL,
+   texenv_replace_a,
+   texenv_replace_l,
+   texenv_replace_la,
+   texenv_replace_i,
+   texenv_replace_rgb,
+   texenv_replace_rgba,
+   texenv_modulate_a,
+   texenv_modulate_l,
+   texenv_modulate_la,
+   texenv_modulate_i,
+   texenv_modulate_rgb,
+   texenv_modulate_rgba,
+   texenv_decal_rgba,
+   texenv_blend_l,
+   texenv_blend_la,
+   texenv_blend_i,
+   texenv_blend_rgb,
+   texenv_blend_rgba,
+   texenv_add_l,
+   texenv_add_la,
+   texenv_add_i,
+   texenv_add_rgb,
+   texenv_add_rgba,
+   texenv_combine_modulate_tp,
+   texenv_combine_modulate_pt,
+   texenv_combine_add
+};
+
+/** Fused two unit kernels */
+static const struct {
+   GLubyte Op0, Op1;
+   texenv_span_func Func;
+} texenv_fused_funcs[] = {
+   { TEXENV_MODULATE_RGB, TEXENV_MODULATE_RGB, texenv_modulate_rgb_modulate_rgb },
+   { TEXENV_MODULATE_RGB, TEXENV_MODULATE_RGBA, texenv_modulate_rgb_modulate_rgba },
+   { TEXENV_MODULATE_RGB, TEXENV_MODULATE_L, texenv_modulate_rgb_modulate_l },
+   { TEXENV_MODULATE_RGB, TEXENV_MODULATE_I, texenv_modulate_rgb_modulate_i },
+   { TEXENV_MODULATE_RGB, TEXENV_ADD_L, texenv_modulate_rgb_add_l },
+   { TEXENV_MODULATE_RGB, TEXENV_ADD_RGB, texenv_modulate_rgb_add_rgb },
+   { TEXENV_MODULATE_RGB, TEXENV_DECAL_RGBA, texenv_modulate_rgb_decal_rgba },
+   { TEXENV_MODULATE_RGBA, TEXENV_MODULATE_RGB, texenv_modulate_rgba_modulate_rgb },
+   { TEXENV_MODULATE_RGBA, TEXENV_MODULATE_RGBA, texenv_modulate_rgba_modulate_rgba },
+   { TEXENV_MODULATE_RGBA, TEXENV_MODULATE_L, texenv_modulate_rgba_modulate_l },
+   { TEXENV_MODULATE_RGBA, TEXENV_MODULATE_I, texenv_modulate_rgba_modulate_i },
+   { TEXENV_MODULATE_RGBA, TEXENV_ADD_L, texenv_modulate_rgba_add_l },
+   { TEXENV_MODULATE_RGBA, TEXENV_ADD_RGB, texenv_modulate_rgba_add_rgb },
+   { TEXENV_MODULATE_RGBA, TEXENV_DECAL_RGBA, texenv_modulate_rgba_decal_rgba },
+   { TEXENV_REPLACE_RGB, TEXENV_MODULATE_RGB, texenv_replace_rgb_modulate_rgb },
+   { TEXENV_REPLACE_RGB, TEXENV_MODULATE_L, texenv_replace_rgb_modulate_l },
+   { TEXENV_REPLACE_RGBA, TEXENV_MODULATE_RGB, texenv_replace_rgba_modulate_rgb },
+   { TEXENV_REPLACE_RGBA, TEXENV_MODULATE_L, texenv_replace_rgba_modulate_l },
+   { TEXENV_COMBINE_MODULATE_TP, TEXENV_COMBINE_MODULATE_TP,
+     texenv_combine_modulate_tp_combine_modulate_tp },
+   { TEXENV_COMBINE_MODULATE_TP, TEXENV_COMBINE_MODULATE_PT,
+     texenv_combine_modulate_tp_combine_modulate_pt },
+   { TEXENV_COMBINE_MODULATE_TP, TEXENV_COMBINE_ADD,
+     texenv_combine_modulate_tp_combine_add },
+   { TEXENV_COMBINE_MODULATE_PT, TEXENV_COMBINE_MODULATE_PT,
+     texenv_combine_modulate_pt_combine_modulate_pt },
+   { TEXENV_COMBINE_MODULATE_PT, TEXENV_COMBINE_MODULATE_TP,
+     texenv_combine_modulate_pt_combine_modulate_tp }
+};
+
+
+/**
+ * Return the TEXENV_x operation for a classic texture environment mode
+ * applied to a texture of the given base format.
+ */
+static GLuint
+classify_texenv(GLenum mode, GLenum format)
+{
+   switch (mode) {
+   case GL_REPLACE:
+      switch (format) {
+      case GL_ALPHA:           return TEXENV_REPLACE_A;
+      case GL_LUMINANCE:       return TEXENV_REPLACE_L;
+      case GL_LUMINANCE_ALPHA: return TEXENV_REPLACE_LA;
+      case GL_INTENSITY:       return TEXENV_REPLACE_I;
+      case GL_RGB:             return TEXENV_REPLACE_RGB;
+      case GL_RGBA:            return TEXENV_REPLACE_RGBA;
+      }
+      break;
+   case GL_MODULATE:
+      switch (format) {
+      case GL_ALPHA:           return TEXENV_MODULATE_A;
+      case GL_LUMINANCE:       return TEXENV_MODULATE_L;
+      case GL_LUMINANCE_ALPHA: return TEXENV_MODULATE_LA;
+      case GL_INTENSITY:       return TEXENV_MODULATE_I;
+      case GL_RGB:             return TEXENV_MODULATE_RGB;
+      case GL_RGBA:            return TEXENV_MODULATE_RGBA;
+      }
+      break;
+   case GL_DECAL:
+      switch (format) {
+      case GL_ALPHA:
+      case GL_LUMINANCE:
+      case GL_LUMINANCE_ALPHA:
+      case GL_INTENSITY:       return TEXENV_NOP;  /* undefined */
+      case GL_RGB:             return TEXENV_REPLACE_RGB;
+      case GL_RGBA:            return TEXENV_DECAL_RGBA;
+      }
+      break;
+   case GL_BLEND:
+      switch (format) {
+      case GL_ALPHA:           return TEXENV_MODULATE_A;
+      case GL_LUMINANCE:       return TEXENV_BLEND_L;
+      case GL_LUMINANCE_ALPHA: return TEXENV_BLEND_LA;
+      case GL_INTENSITY:       return TEXENV_BLEND_I;
+      case GL_RGB:             return TEXENV_BLEND_RGB;
+      case GL_RGBA:            return TEXENV_BLEND_RGBA;
+      }
+      break;
+   case GL_ADD:
+      switch (format) {
+      case GL_ALPHA:           return TEXENV_MODULATE_A;
+      case GL_LUMINANCE:       return TEXENV_ADD_L;
+      case GL_LUMINANCE_ALPHA: return TEXENV_ADD_LA;
+      case GL_INTENSITY:       return TEXENV_ADD_I;
+      case GL_RGB:             return TEXENV_ADD_RGB;
+      case GL_RGBA:            return TEXENV_ADD_RGBA;
+      }
+      break;
+   }
+
+   return TEXENV_GENERAL;
+}
+
+
+/**
+ * Return the TEXENV_x operation for a GL_COMBINE state, TEXENV_GENERAL
+ * unless both the RGB and alpha combiners do the same thing with the
+ * unit's own texel and the previous color.
+ */
+static GLuint
+classify_combine(const struct gl_tex_env_combine_state *comb)
+{
+   GLuint j;
+
+   if (comb->ModeRGB != comb->ModeA ||
+       comb->_NumArgsRGB != comb->_NumArgsA)
+      return TEXENV_GENERAL;
+
+   for (j = 0; j < comb->_NumArgsRGB; j++) {
+      if (comb->SourceRGB[j] != comb->SourceA[j] ||
+          (comb->SourceRGB[j] != GL_TEXTURE &&
+           comb->SourceRGB[j] != GL_PREVIOUS) ||
+          comb->OperandRGB[j] != GL_SRC_COLOR ||
+          comb->OperandA[j] != GL_SRC_ALPHA)
+         return TEXENV_GENERAL;
+   }
+
+   switch (comb->ModeRGB) {
+   case GL_REPLACE:
+      if (comb->ScaleShiftRGB != 0 || comb->ScaleShiftA != 0)
+         return TEXENV_GENERAL;
+      return comb->SourceRGB[0] == GL_TEXTURE ? TEXENV_REPLACE_RGBA
+                                              : TEXENV_NOP;
+   case GL_MODULATE:
+      if (comb->SourceRGB[0] == GL_TEXTURE &&
+          comb->SourceRGB[1] == GL_PREVIOUS)
+         return TEXENV_COMBINE_MODULATE_TP;
+      if (comb->SourceRGB[0] == GL_PREVIOUS &&
+          comb->SourceRGB[1] == GL_TEXTURE)
+         return TEXENV_COMBINE_MODULATE_PT;
+      break;
+   case GL_ADD:
+      if (comb->SourceRGB[0] != comb->SourceRGB[1])
+         return TEXENV_COMBINE_ADD;
+      break;
+   }
+
+   return TEXENV_GENERAL;
+}
+
+#endif /* CHAN_TYPE == GL_UNSIGNED_BYTE */
+
+
+/**
+ * Compile the texture environment of the enabled units into
+ * swrast->TextureEnv.  Called from _swrast_update_texture_env() when
+ * texture state changes.
+ */
+void
+_swrast_choose_texture_env( GLcontext *ctx )
+{
+   SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   struct texenv_program *prog = swrast->TextureEnv;
+   GLuint unit;
+
+   if (!prog) {
+      prog = swrast->TextureEnv = CALLOC_STRUCT(texenv_program);
+      if (!prog)
+         return;
+   }
+
+   prog->NumStages = 0;
+
+   for (unit = 0; unit < ctx->Const.MaxTextureUnits; unit++) {
+      const struct gl_texture_unit *texUnit = &ctx->Texture.Unit[unit];
+      struct texenv_unit u;
+
+      if (!texUnit->_ReallyEnabled)
+         continue;
+
+      _mesa_bzero(&u, sizeof(u));
+      u.Unit = unit;
+      u.Op = TEXENV_GENERAL;
+
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+      if (texUnit->_CurrentCombine != &texUnit->_EnvMode) {
+         u.Op = classify_combine(texUnit->_CurrentCombine);
+         u.ShiftRGB = texUnit->_CurrentCombine->ScaleShiftRGB;
+         u.ShiftA = texUnit->_CurrentCombine->ScaleShiftA;
+      }
+      else {
+         /* same format selection as texture_apply() */
+         const struct gl_texture_object *texObj = texUnit->_Current;
+         GLenum format = texObj->Image[0][texObj->BaseLevel]->Format;
+         if (format == GL_COLOR_INDEX || format == GL_YCBCR_MESA)
+            format = GL_RGBA;
+         else if (format == GL_DEPTH_COMPONENT)
+            format = texObj->DepthMode;
+         u.Op = classify_texenv(texUnit->EnvMode, format);
+         u.EnvColor[0] = (GLint) (texUnit->EnvColor[0] * CHAN_MAXF);
+         u.EnvColor[1] = (GLint) (texUnit->EnvColor[1] * CHAN_MAXF);
+         u.EnvColor[2] = (GLint) (texUnit->EnvColor[2] * CHAN_MAXF);
+         u.EnvColor[3] = (GLint) (texUnit->EnvColor[3] * CHAN_MAXF);
+      }
+#endif
+
+      if (u.Op == TEXENV_NOP)
+         continue;
+
+      /* try to fuse with the previous unit */
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+      if (prog->NumStages > 0 && u.Op != TEXENV_GENERAL) {
+         struct texenv_stage *prev = &prog->Stages[prog->NumStages - 1];
+         if (prev->NumUnits == 1 && prev->Func) {
+            GLuint i;
+            for (i = 0; i < Elements(texenv_fused_funcs); i++) {
+               if (texenv_fused_funcs[i].Op0 == prev->Unit[0].Op &&
+                   texenv_fused_funcs[i].Op1 == u.Op) {
+                  prev->Func = texenv_fused_funcs[i].Func;
+                  prev->Unit[1] = u;
+                  prev->NumUnits = 2;
+                  break;
+               }
+            }
+            if (prev->NumUnits == 2)
+               continue;
+         }
+      }
+#endif
+
+      {
+         struct texenv_stage *stage = &prog->Stages[prog->NumStages++];
+#if CHAN_TYPE == GL_UNSIGNED_BYTE
+         stage->Func = texenv_funcs[u.Op];
+#else
+         stage->Func = NULL;
+#endif
+         stage->NumUnits = 1;
+         stage->Unit[0] = u;
+      }
+   }
+}
+
+
+/**
+ * Bytes held by the compiled texture environment.
+ */
+GLuint
+_swrast_texture_env_memory( GLcontext *ctx )
+{
+   return SWRAST_CONTEXT(ctx)->TextureEnv ? sizeof(struct texenv_program) : 0;
+}
+
+
 /**
  * Apply texture mapping to a span of fragments.
  */
@@ -3875,12 +4802,16 @@ void
 _swrast_texture_span( GLcontext *ctx, struct sw_span *span )
 {
    SWcontext *swrast = SWRAST_CONTEXT(ctx);
+   const struct texenv_program *prog = swrast->TextureEnv;
    GLchan primary_rgba[MAX_WIDTH][4];
-   GLuint unit;
+   GLuint unit, stage;
 
    ASSERT(span->end < MAX_WIDTH);
    ASSERT(span->arrayMask & SPAN_TEXTURE);
 
+   if (!prog)
+      return;  /* out of memory when compiling the texture env */
+
    /*
     * Save copy of the incoming fragment colors (the GL_PRIMARY_COLOR)
     */
@@ -3940,8 +4871,14 @@ _swrast_texture_span( GLcontext *ctx, struct sw_span *span )
     * OK, now apply the texture (aka texture combine/blend).
     * We modify the span->color.rgba values.
     */
-   for (unit = 0; unit < ctx->Const.MaxTextureUnits; unit++) {
-      if (ctx->Texture.Unit[unit]._ReallyEnabled) {
+   for (stage = 0; stage < prog->NumStages; stage++) {
+      const struct texenv_stage *st = &prog->Stages[stage];
+      if (st->Func) {
+         /* specialized kernel for one or two units */
+         st->Func(st, span->end, swrast->TexelBuffer, span->array->rgba);
+      }
+      else {
+         const GLuint unit = st->Unit[0].Unit;
          const struct gl_texture_unit *texUnit = &ctx->Texture.Unit[unit];
          if (texUnit->_CurrentCombine != &texUnit->_EnvMode ) {
             texture_combine( ctx, unit, span->end,
@@ -36,6 +36,12 @@ _swrast_choose_texture_sample_func( GLcontext *ctx,
 				    const struct gl_texture_object *tObj );
 
 
+extern void
+_swrast_choose_texture_env( GLcontext *ctx );
+
+extern GLuint
+_swrast_texture_env_memory( GLcontext *ctx );
+
 extern void
 _swrast_texture_span( GLcontext *ctx, struct sw_span *span );
 
@@ -93,6 +93,15 @@ _swrast_CreateContext( GLcontext *ctx );
 extern void
 _swrast_DestroyContext( GLcontext *ctx );
 
+/* Release the buffers which are reallocated when rendering starts, and
+ * report the memory held for a context:
+ */
+extern void
+_swrast_TrimContext( GLcontext *ctx );
+
+extern GLuint
+_swrast_ContextMemory( GLcontext *ctx );
+
 /* Get a (non-const) reference to the device driver struct for swrast.
  */
 extern struct swrast_device_driver *
@@ -105,6 +114,10 @@ _swrast_Bitmap( GLcontext *ctx,
 		const struct gl_pixelstore_attrib *unpack,
 		const GLubyte *bitmap );
 
+extern void
+_swrast_DrawGlyphs( GLcontext *ctx, GLuint count,
+                    const struct gl_glyph *glyphs );
+
 extern void
 _swrast_CopyPixels( GLcontext *ctx,
 		    GLint srcx, GLint srcy,
@@ -182,6 +195,16 @@ _swrast_render_start( GLcontext *ctx );
 extern void
 _swrast_render_finish( GLcontext *ctx );
 
+/* Damage tracking for drivers that copy the back buffer to the window
+ * on swap; see s_damage.c.
+ */
+extern void
+_swrast_add_damage( GLframebuffer *fb, GLint x0, GLint y0,
+                    GLint x1, GLint y1 );
+
+extern void
+_swrast_reset_damage( GLframebuffer *fb );
+
 /* Tell the software rasterizer about core state changes.
  */
 extern void
@@ -41,6 +41,10 @@
  */
 #define _SWSETUP_NEW_RENDERINDEX (_NEW_POLYGON|_NEW_LIGHT|_NEW_PROGRAM)
 
+/* Number of SWvertex in the tnl vertex buffer.
+ */
+#define SWSETUP_VB_SIZE(ctx) ((ctx)->Const.MaxArrayLockSize + 12)
+
 
 GLboolean
 _swsetup_CreateContext( GLcontext *ctx )
@@ -55,9 +59,9 @@ _swsetup_CreateContext( GLcontext *ctx )
    swsetup->NewState = ~0;
    _swsetup_trifuncs_init( ctx );
 
-   _tnl_init_vertices( ctx, ctx->Const.MaxArrayLockSize + 12, 
-		       sizeof(SWvertex) );
-
+   /* The vertex buffer is set up by _swsetup_RenderStart() when it is
+    * first needed.
+    */
 
    return GL_TRUE;
 }
@@ -75,6 +79,34 @@ _swsetup_DestroyContext( GLcontext *ctx )
    _tnl_free_vertices( ctx );
 }
 
+
+/**
+ * Release the vertex buffer; _swsetup_RenderStart() allocates it again.
+ * Not for drivers which keep their own pointer to the tnl vertex buffer.
+ */
+void
+_swsetup_TrimContext( GLcontext *ctx )
+{
+   _tnl_free_vertices( ctx );
+   SWSETUP_CONTEXT(ctx)->verts = NULL;
+}
+
+
+/**
+ * Return the number of bytes of memory allocated by swrast_setup for
+ * this context.
+ */
+GLuint
+_swsetup_ContextMemory( GLcontext *ctx )
+{
+   GLuint bytes = sizeof(SScontext);
+
+   if (TNL_CONTEXT(ctx)->clipspace.vertex_buf)
+      bytes += SWSETUP_VB_SIZE(ctx) * sizeof(SWvertex);
+
+   return bytes;
+}
+
 static void
 _swsetup_RenderPrimitive( GLcontext *ctx, GLenum mode )
 {
@@ -112,6 +144,12 @@ _swsetup_RenderStart( GLcontext *ctx )
 
    swsetup->NewState = 0;
 
+   if (!swsetup->verts) {
+      _tnl_init_vertices( ctx, SWSETUP_VB_SIZE(ctx), sizeof(SWvertex) );
+      swsetup->verts = (SWvertex *) tnl->clipspace.vertex_buf;
+      swsetup->last_index = 0;
+   }
+
    _swrast_render_start( ctx );
 
    /* Important:
@@ -52,6 +52,12 @@ _swsetup_InvalidateState( GLcontext *ctx, GLuint new_state );
 extern void
 _swsetup_Wakeup( GLcontext *ctx );
 
+extern void
+_swsetup_TrimContext( GLcontext *ctx );
+
+extern GLuint
+_swsetup_ContextMemory( GLcontext *ctx );
+
 /* Helper function to translate a hardware vertex (as understood by
  * the tnl/t_vertex.c code) to a swrast vertex.
  */
@@ -97,8 +97,10 @@ _tnl_CreateContext( GLcontext *ctx )
    _tnl_array_init( ctx );
    _tnl_vtx_init( ctx );
 
-   if (ctx->_MaintainTnlProgram) 
+   if (ctx->_MaintainTnlProgram) {
       _tnl_install_pipeline( ctx, _tnl_vp_pipeline );
+      _mesa_allow_light_in_model( ctx, GL_FALSE );
+   }
    else 
       _tnl_install_pipeline( ctx, _tnl_default_pipeline );
 
@@ -152,6 +154,29 @@ _tnl_DestroyContext( GLcontext *ctx )
 }
 
 
+/**
+ * Release the private data of the pipeline stages.  It is reallocated
+ * the next time the pipeline runs.  Must not be called while vertices
+ * are being processed.
+ */
+void
+_tnl_TrimContext( GLcontext *ctx )
+{
+   _tnl_free_pipeline_data( ctx );
+}
+
+
+/**
+ * Return the number of bytes of memory allocated by the tnl module for
+ * this context.
+ */
+GLuint
+_tnl_ContextMemory( GLcontext *ctx )
+{
+   return sizeof(TNLcontext) + _tnl_pipeline_memory( ctx );
+}
+
+
 void
 _tnl_InvalidateState( GLcontext *ctx, GLuint new_state )
 {
@@ -490,6 +490,11 @@ struct tnl_pipeline_stage
     *               GL_FALSE - finished pipeline
     */
    GLboolean (*run)( GLcontext *ctx, struct tnl_pipeline_stage * );
+
+   /* Optional: bytes of private data currently allocated by the stage,
+    * for _tnl_ContextMemory().
+    */
+   GLuint (*memory)( GLcontext *ctx, const struct tnl_pipeline_stage * );
 };
 
 
@@ -506,6 +511,7 @@ struct tnl_pipeline {
 
    struct tnl_pipeline_stage stages[MAX_PIPELINE_STAGES+1];
    GLuint nr_stages;
+   GLboolean created;	/* have the stages allocated their private data? */
 };
 
 struct tnl_clipspace;
@@ -615,14 +621,6 @@ struct tnl_clipspace
 
 
 
-struct tnl_cache {
-   GLuint hash;
-   void *key;
-   void *data;
-   struct tnl_cache *next;
-};
-
-
 struct tnl_device_driver
 {
    /***
@@ -784,7 +782,7 @@ typedef struct
    GLvertexformat exec_vtxfmt;
    GLvertexformat save_vtxfmt;
 
-   struct tnl_cache *vp_cache;
+   struct program_cache *vp_cache;
 
 } TNLcontext;
 
@@ -48,33 +48,91 @@ void _tnl_install_pipeline( GLcontext *ctx,
 
    tnl->pipeline.new_state = ~0;
 
-   /* Create a writeable copy of each stage.
+   /* Create a writeable copy of each stage.  Their private data is
+    * allocated by create_stages() the first time the pipeline runs.
     */
    for (i = 0 ; i < MAX_PIPELINE_STAGES && stages[i] ; i++) {
       struct tnl_pipeline_stage *s = &tnl->pipeline.stages[i];
       MEMCPY(s, stages[i], sizeof(*s));
-      if (s->create)
-	 s->create(ctx, s);
    }
 
    tnl->pipeline.nr_stages = i;
+   tnl->pipeline.created = GL_FALSE;
 }
 
-void _tnl_destroy_pipeline( GLcontext *ctx )
+
+/**
+ * Free the private data of the pipeline stages.  The pipeline stays
+ * installed and recreates it when it next runs.
+ */
+void _tnl_free_pipeline_data( GLcontext *ctx )
 {
    TNLcontext *tnl = TNL_CONTEXT(ctx);
    GLuint i;
 
+   if (!tnl->pipeline.created)
+      return;
+
    for (i = 0 ; i < tnl->pipeline.nr_stages ; i++) {
       struct tnl_pipeline_stage *s = &tnl->pipeline.stages[i];
       if (s->destroy)
 	 s->destroy(s);
    }
 
+   tnl->pipeline.created = GL_FALSE;
+}
+
+void _tnl_destroy_pipeline( GLcontext *ctx )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+
+   _tnl_free_pipeline_data( ctx );
    tnl->pipeline.nr_stages = 0;
 }
 
 
+/**
+ * Bytes of private data currently held by the pipeline stages.
+ */
+GLuint _tnl_pipeline_memory( GLcontext *ctx )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   GLuint i, bytes = 0;
+
+   if (!tnl->pipeline.created)
+      return 0;
+
+   for (i = 0 ; i < tnl->pipeline.nr_stages ; i++) {
+      const struct tnl_pipeline_stage *s = &tnl->pipeline.stages[i];
+      if (s->memory)
+	 bytes += s->memory(ctx, s);
+   }
+
+   return bytes;
+}
+
+
+static GLboolean create_stages( GLcontext *ctx )
+{
+   TNLcontext *tnl = TNL_CONTEXT(ctx);
+   GLuint i;
+
+   for (i = 0 ; i < tnl->pipeline.nr_stages ; i++) {
+      struct tnl_pipeline_stage *s = &tnl->pipeline.stages[i];
+      if (s->create && !s->create(ctx, s)) {
+	 /* the stages not created yet have no private data to free */
+	 tnl->pipeline.created = GL_TRUE;
+	 _tnl_free_pipeline_data( ctx );
+	 return GL_FALSE;
+      }
+   }
+
+   tnl->pipeline.created = GL_TRUE;
+   tnl->pipeline.new_state = ~0;
+   return GL_TRUE;
+}
+
+
 
 static GLuint check_input_changes( GLcontext *ctx )
 {
@@ -127,6 +185,11 @@ void _tnl_run_pipeline( GLcontext *ctx )
    if (!tnl->vb.Count)
       return;
 
+   if (!tnl->pipeline.created && !create_stages( ctx )) {
+      _mesa_error( ctx, GL_OUT_OF_MEMORY, "vertex pipeline" );
+      return;
+   }
+
    /* Check for changed input sizes or change in stride to/from zero
     * (ie const or non-const).
     */
@@ -38,6 +38,10 @@ extern void _tnl_run_pipeline( GLcontext *ctx );
 
 extern void _tnl_destroy_pipeline( GLcontext *ctx );
 
+extern void _tnl_free_pipeline_data( GLcontext *ctx );
+
+extern GLuint _tnl_pipeline_memory( GLcontext *ctx );
+
 extern void _tnl_install_pipeline( GLcontext *ctx,
 				   const struct tnl_pipeline_stage **stages );
 
@@ -56,6 +60,12 @@ extern const struct tnl_pipeline_stage _tnl_arb_vertex_program_stage;
 extern const struct tnl_pipeline_stage _tnl_vertex_program_stage;
 extern const struct tnl_pipeline_stage _tnl_render_stage;
 
+/* Provided by t_vb_vertex.c for the stages computing clip coordinates:
+ */
+extern void _tnl_tile_cliptest( GLcontext *ctx, GLvector4f *clip,
+				GLubyte *clipmask, GLubyte *clipormask,
+				GLubyte *clipandmask );
+
 /* Shorthand to plug in the default pipeline:
  */
 extern const struct tnl_pipeline_stage *_tnl_default_pipeline[];
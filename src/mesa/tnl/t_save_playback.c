@@ -32,6 +32,7 @@
 #include "mtypes.h"
 #include "macros.h"
 #include "light.h"
+#include "program.h"
 #include "state.h"
 #include "t_pipeline.h"
 #include "t_save_api.h"
@@ -129,6 +130,9 @@ static void _playback_copy_to_current( GLcontext *ctx,
    else
       data = node->buffer;
 
+   /* skip the position */
+   data += node->attrsz[_TNL_ATTRIB_POS];
+
    for (i = _TNL_ATTRIB_POS+1 ; i <= _TNL_ATTRIB_INDEX ; i++) {
       if (node->attrsz[i]) {
 	 COPY_CLEAN_4V(tnl->vtx.current[i], node->attrsz[i], data);
@@ -149,6 +153,7 @@ static void _playback_copy_to_current( GLcontext *ctx,
    }
 
    if (node->have_materials) {
+      _mesa_program_state_changed( ctx, _NEW_LIGHT );
       tnl->Driver.NotifyMaterialChange( ctx );
    }
 
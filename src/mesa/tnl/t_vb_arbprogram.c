@@ -37,6 +37,7 @@
 #include "arbprogparse.h"
 #include "light.h"
 #include "program.h"
+#include "nvvertexec.h"
 #include "math/m_matrix.h"
 #include "math/m_translate.h"
 #include "t_context.h"
@@ -45,7 +46,7 @@
 #include "tnl.h"
 
 
-#define DISASSEM 0
+#define DISASSEM (MESA_VERBOSE & VERBOSE_DISASSEM)
 
 /*--------------------------------------------------------------------------- */
 
@@ -405,6 +406,21 @@ static void do_MOV( struct arb_vp_machine *m, union instruction op )
    result[3] = arg0[3];
 }
 
+/* Not an ARB instruction: the optimizer fuses MUL+ADD pairs into
+ * dst = arg0 * arg1 + dst
+ */
+static void do_MAD( struct arb_vp_machine *m, union instruction op )
+{
+   GLfloat *result = m->File[0][op.alu.dst];
+   const GLfloat *arg0 = m->File[op.alu.file0][op.alu.idx0];
+   const GLfloat *arg1 = m->File[op.alu.file1][op.alu.idx1];
+
+   result[0] = arg0[0] * arg1[0] + result[0];
+   result[1] = arg0[1] * arg1[1] + result[1];
+   result[2] = arg0[2] * arg1[2] + result[2];
+   result[3] = arg0[3] * arg1[3] + result[3];
+}
+
 static void do_MUL( struct arb_vp_machine *m, union instruction op )
 {
    GLfloat *result = m->File[0][op.alu.dst];
@@ -433,8 +449,18 @@ static void do_POW( struct arb_vp_machine *m, union instruction op )
 static void do_REL( struct arb_vp_machine *m, union instruction op )
 {
    GLfloat *result = m->File[0][op.alu.dst];
-   GLuint idx = (op.alu.idx0 + (GLint)m->File[0][REG_ADDR][0]) & (MAX_NV_VERTEX_PROGRAM_PARAMS-1);
-   const GLfloat *arg0 = m->File[op.alu.file0][idx];
+   GLint idx = op.alu.idx0 + (GLint)m->File[0][REG_ADDR][0];
+   const GLfloat *arg0;
+
+   /* NV_vertex_program reads zero outside the parameter array:
+    */
+   if (op.alu.file0 == FILE_ENV_PARAM &&
+       (idx < 0 || idx >= MAX_NV_VERTEX_PROGRAM_PARAMS)) {
+      ASSIGN_4V(result, 0, 0, 0, 0);
+      return;
+   }
+
+   arg0 = m->File[op.alu.file0][idx & (MAX_NV_VERTEX_PROGRAM_PARAMS-1)];
 
    result[0] = arg0[0];
    result[1] = arg0[1];
@@ -451,6 +477,31 @@ static void do_RCP( struct arb_vp_machine *m, union instruction op )
    PUFF(result);
 }
 
+/* NV_vertex_program1_1: reciprocal clamped away from zero and infinity.
+ */
+static void do_RCC( struct arb_vp_machine *m, union instruction op )
+{
+   GLfloat *result = m->File[0][op.alu.dst];
+   const GLfloat *arg0 = m->File[op.alu.file0][op.alu.idx0];
+   GLfloat u = 1.0F / arg0[0];
+
+   if (u > 0.0F) {
+      if (u > 1.884467e+019F)
+	 u = 1.884467e+019F;	/* 0x5F800000 */
+      else if (u < 5.42101e-020F)
+	 u = 5.42101e-020F;	/* 0x1F800000 */
+   }
+   else {
+      if (u < -1.884467e+019F)
+	 u = -1.884467e+019F;	/* 0xDF800000 */
+      else if (u > -5.42101e-020F)
+	 u = -5.42101e-020F;	/* 0x9F800000 */
+   }
+
+   result[0] = u;
+   PUFF(result);
+}
+
 static void do_RSQ( struct arb_vp_machine *m, union instruction op )
 {
    GLfloat *result = m->File[0][op.alu.dst];
@@ -557,6 +608,8 @@ static void print_reg( GLuint file, GLuint reg )
 	 _mesa_printf("ADDR");
       else if (reg == REG_ID)
 	 _mesa_printf("ID");
+      else if (reg >= REG_INVAR0 && reg <= REG_INVAR55)
+	 _mesa_printf("INVAR%d", reg - REG_INVAR0);
       else
 	 _mesa_printf("REG%d", reg);
    }
@@ -635,14 +688,14 @@ static const struct opcode_info opcode_info[] =
    { 1, "LG2", print_ALU },
    { 1, "LIT", print_ALU },
    { 1, "LOG", print_ALU },
-   { 3, "MAD", print_NOP },
+   { 2, "MAD", print_ALU },
    { 2, "MAX", print_ALU },
    { 2, "MIN", print_ALU },
    { 1, "MOV", print_ALU },
    { 2, "MUL", print_ALU },
    { 2, "POW", print_ALU },
    { 1, "PRT", print_ALU }, /* PRINT */
-   { 1, "RCC", print_NOP },
+   { 1, "RCC", print_ALU },
    { 1, "RCP", print_ALU },
    { 1, "RSQ", print_ALU },
    { 2, "SGE", print_ALU },
@@ -679,14 +732,14 @@ static void (* const opcode_func[])(struct arb_vp_machine *, union instruction)
    do_LG2,
    do_LIT,
    do_LOG,
-   do_NOP,
+   do_MAD,
    do_MAX,
    do_MIN,
    do_MOV,
    do_MUL,
    do_POW,
    do_PRT,
-   do_NOP,
+   do_RCC,
    do_RCP,
    do_RSQ,
    do_SGE,
@@ -1025,6 +1078,576 @@ static void cvp_emit_inst( struct compilation *cp,
    }
 }
 
+/* NV_vertex_program starts every vertex with the temporaries and the
+ * address register at zero and the results at (0,0,0,1).  Emit that
+ * as code; the optimizer removes whatever the program overwrites.
+ */
+static void cvp_emit_nv_init( struct compilation *cp,
+			      const struct vertex_program *program )
+{
+   struct reg id = cvp_make_reg(FILE_REG, REG_ID);
+   GLuint i;
+
+   for (i = REG_TMP0; i <= REG_TMP11; i++) {
+      cvp_emit_rsw(cp, i, id, 0, 0, GL_TRUE); /* ID.xxxx */
+      cp->reg_active |= 1 << i;
+   }
+
+   cvp_emit_rsw(cp, REG_ADDR, id, 0, 0, GL_TRUE);
+
+   for (i = 0; i <= REG_OUT14 - REG_OUT0; i++) {
+      if (program->OutputsWritten & (1 << i)) {
+	 cvp_emit_rsw(cp, REG_OUT0 + i, id, 0, RSW_NOOP, GL_TRUE);
+	 cp->reg_active |= 1 << (REG_OUT0 + i);
+      }
+   }
+}
+
+
+/* ----------------------------------------------------------------------
+ * Optimization
+ *
+ * cvp_emit_inst() translates one instruction at a time, so the stream
+ * it produces is full of moves through the ARG and RES registers,
+ * repeated swizzles of the same operand, MUL+ADD pairs for each MAD and
+ * writes nobody reads.  Vertex programs have no flow control, which
+ * keeps the passes below simple scans over straight-line code.
+ */
+
+#define DELETED VP_OPCODE_END	/* never emitted by the compiler */
+#define MAX_INVARIANTS (REG_INVAR55 - REG_INVAR0 + 1)
+
+static GLboolean is_output( GLuint reg )
+{
+   return reg >= REG_OUT0 && reg <= REG_OUT14;
+}
+
+static GLboolean is_invariant_reg( GLuint reg )
+{
+   return ((reg >= REG_ID && reg <= REG_LIT2) ||
+	   (reg >= REG_INVAR0 && reg <= REG_INVAR55));
+}
+
+/* Number of operands, which live in the file0/idx0 and file1/idx1
+ * fields of the alu layout (RSW and MSK use the first position only).
+ */
+static GLuint nr_operands( union instruction op )
+{
+   switch (op.alu.opcode) {
+   case RSW:
+   case MSK:
+   case REL:
+      return 1;
+   default:
+      return opcode_info[op.alu.opcode].nr_args;
+   }
+}
+
+/* MSK and MAD only update their destination:
+ */
+static GLboolean reads_dst( union instruction op )
+{
+   return op.alu.opcode == MSK || op.alu.opcode == VP_OPCODE_MAD;
+}
+
+static GLboolean writes_dst( union instruction op )
+{
+   switch (op.alu.opcode) {
+   case VP_OPCODE_ARL:
+   case VP_OPCODE_END:
+   case VP_OPCODE_PRINT:
+      return GL_FALSE;
+   default:
+      return GL_TRUE;
+   }
+}
+
+static GLboolean writes_reg( union instruction op, GLuint reg )
+{
+   return writes_dst(op) && op.alu.dst == reg;
+}
+
+/* Does one of the operands name temporary register 'reg'?  REL
+ * operands are parameters indexed by the address register.
+ */
+static GLboolean reads_operand( union instruction op, GLuint reg )
+{
+   GLuint n = nr_operands(op);
+
+   if (op.alu.opcode == REL)
+      return GL_FALSE;
+
+   return ((n > 0 && op.alu.file0 == FILE_REG && op.alu.idx0 == reg) ||
+	   (n > 1 && op.alu.file1 == FILE_REG && op.alu.idx1 == reg));
+}
+
+static GLboolean reads_reg( union instruction op, GLuint reg )
+{
+   return (reads_operand(op, reg) ||
+	   (reads_dst(op) && op.alu.dst == reg) ||
+	   (op.alu.opcode == REL && reg == REG_ADDR));
+}
+
+static void replace_operand( union instruction *op, GLuint reg,
+			     GLuint file, GLuint idx )
+{
+   GLuint n = nr_operands(*op);
+
+   if (op->alu.opcode == REL)
+      return;
+
+   if (n > 0 && op->alu.file0 == FILE_REG && op->alu.idx0 == reg) {
+      op->alu.file0 = file;
+      op->alu.idx0 = idx;
+   }
+   if (n > 1 && op->alu.file1 == FILE_REG && op->alu.idx1 == reg) {
+      op->alu.file1 = file;
+      op->alu.idx1 = idx;
+   }
+}
+
+/* The instruction with its destination and unused operand fields
+ * cleared, for comparing the values two instructions compute.
+ */
+static GLuint value_key( union instruction op )
+{
+   op.alu.dst = 0;
+   if (op.alu.opcode != RSW && op.alu.opcode != MSK && nr_operands(op) < 2) {
+      op.alu.file1 = 0;
+      op.alu.idx1 = 0;
+   }
+   return op.dword;
+}
+
+/* Is the value 'reg' holds after instruction j used later on?  Outputs
+ * are read once the program has finished.
+ */
+static GLboolean live_after( const struct tnl_compiled_program *p,
+			     GLint j, GLuint reg )
+{
+   GLint i;
+
+   for (i = j + 1; i < p->nr_instructions; i++) {
+      if (reads_reg(p->instructions[i], reg))
+	 return GL_TRUE;
+      if (writes_reg(p->instructions[i], reg))
+	 return GL_FALSE;
+   }
+
+   return is_output(reg);
+}
+
+static void remove_deleted( struct tnl_compiled_program *p )
+{
+   GLint i, n = 0;
+
+   for (i = 0; i < p->nr_instructions; i++)
+      if (p->instructions[i].alu.opcode != DELETED)
+	 p->instructions[n++] = p->instructions[i];
+
+   p->nr_instructions = n;
+}
+
+/* Find the instruction that starts computing the value 'reg' holds at
+ * instruction j.  Partial writes (MSK, MAD) belong to the value started
+ * by an earlier full write.  Returns -1 if the value comes from a
+ * previous vertex or nowhere at all.
+ */
+static GLint value_start( const struct tnl_compiled_program *p,
+			  GLint j, GLuint reg )
+{
+   GLint i;
+
+   for (i = j - 1; i >= 0; i--) {
+      union instruction op = p->instructions[i];
+      if (writes_reg(op, reg) && !reads_dst(op))
+	 break;
+   }
+
+   return i;
+}
+
+/* Can the value computed from instruction 'start' up to its use at
+ * instruction j live in register 'to' instead?  Only if nothing else
+ * touches 'to' meanwhile.
+ */
+static GLboolean can_rename( const struct tnl_compiled_program *p,
+			     GLint start, GLint j, GLuint from, GLuint to )
+{
+   GLint i;
+
+   if (start < 0 || from == REG_ADDR || to == REG_ADDR)
+      return GL_FALSE;
+
+   for (i = start; i < j; i++)
+      if (reads_reg(p->instructions[i], to) ||
+	  writes_reg(p->instructions[i], to))
+	 return GL_FALSE;
+
+   return GL_TRUE;
+}
+
+static void rename_value( struct tnl_compiled_program *p,
+			  GLint start, GLint j, GLuint from, GLuint to )
+{
+   GLint i;
+
+   for (i = start; i <= j; i++) {
+      union instruction *op = &p->instructions[i];
+
+      if (i > start)
+	 replace_operand(op, from, FILE_REG, to);
+      if (i < j && writes_reg(*op, from))
+	 op->alu.dst = to;
+   }
+}
+
+
+/* MOV dst, src:  Read src directly in the following instructions, until
+ * either register changes.
+ */
+static GLboolean propagate_copies( struct tnl_compiled_program *p )
+{
+   GLboolean progress = GL_FALSE;
+   GLint i, j;
+
+   for (i = 0; i < p->nr_instructions; i++) {
+      union instruction mov = p->instructions[i];
+      GLuint dst = mov.alu.dst;
+
+      if (mov.alu.opcode != VP_OPCODE_MOV)
+	 continue;
+
+      if (mov.alu.file0 == FILE_REG && mov.alu.idx0 == dst) {
+	 p->instructions[i].alu.opcode = DELETED;
+	 progress = GL_TRUE;
+	 continue;
+      }
+
+      for (j = i + 1; j < p->nr_instructions; j++) {
+	 union instruction *op = &p->instructions[j];
+
+	 /* Implicit reads can't be redirected.  Don't let an
+	  * instruction overwrite its own operand either.
+	  */
+	 if (reads_reg(*op, dst) && !reads_operand(*op, dst))
+	    break;
+	 if (mov.alu.file0 == FILE_REG && writes_reg(*op, mov.alu.idx0))
+	    break;
+
+	 if (reads_operand(*op, dst)) {
+	    replace_operand(op, dst, mov.alu.file0, mov.alu.idx0);
+	    progress = GL_TRUE;
+	 }
+
+	 if (writes_reg(*op, dst))
+	    break;
+      }
+   }
+
+   return progress;
+}
+
+
+/* OP tmp, ...; MOV dst, tmp  ->  OP dst, ...
+ */
+static GLboolean coalesce_moves( struct tnl_compiled_program *p )
+{
+   GLboolean progress = GL_FALSE;
+   GLint j;
+
+   for (j = 0; j < p->nr_instructions; j++) {
+      union instruction mov = p->instructions[j];
+      GLuint src = mov.alu.idx0, dst = mov.alu.dst;
+      GLint start;
+
+      if (mov.alu.opcode != VP_OPCODE_MOV ||
+	  mov.alu.file0 != FILE_REG ||
+	  src == dst ||
+	  live_after(p, j, src))
+	 continue;
+
+      start = value_start(p, j, src);
+      if (can_rename(p, start, j, src, dst)) {
+	 rename_value(p, start, j, src, dst);
+	 p->instructions[j].alu.opcode = DELETED;
+	 progress = GL_TRUE;
+      }
+   }
+
+   return progress;
+}
+
+
+/* An instruction recomputing a value that is still in a register
+ * becomes a MOV from that register.  This catches the same operand
+ * being swizzled the same way more than once.
+ */
+static GLboolean reuse_values( struct tnl_compiled_program *p )
+{
+   GLboolean progress = GL_FALSE;
+   GLint i, j, k;
+
+   for (j = 0; j < p->nr_instructions; j++) {
+      union instruction *op = &p->instructions[j];
+      GLuint key = value_key(*op);
+
+      if (!writes_dst(*op) || reads_dst(*op) ||
+	  op->alu.opcode == REL || op->alu.opcode == VP_OPCODE_MOV)
+	 continue;
+
+      for (i = j - 1; i >= 0; i--) {
+	 union instruction prev = p->instructions[i];
+
+	 if (writes_dst(prev) &&
+	     value_key(prev) == key &&
+	     !reads_operand(prev, prev.alu.dst)) {
+	    for (k = i + 1; k < j; k++)
+	       if (writes_reg(p->instructions[k], prev.alu.dst))
+		  break;
+
+	    if (k == j) {
+	       if (prev.alu.dst == op->alu.dst) {
+		  op->alu.opcode = DELETED;
+	       }
+	       else {
+		  GLuint dst = op->alu.dst;
+		  op->dword = 0;
+		  op->alu.opcode = VP_OPCODE_MOV;
+		  op->alu.dst = dst;
+		  op->alu.file0 = FILE_REG;
+		  op->alu.idx0 = prev.alu.dst;
+	       }
+	       progress = GL_TRUE;
+	    }
+	    break;
+	 }
+
+	 /* Earlier instructions saw different operand values:
+	  */
+	 if (writes_dst(prev) && reads_operand(*op, prev.alu.dst))
+	    break;
+      }
+   }
+
+   return progress;
+}
+
+
+static GLboolean remove_dead_code( struct tnl_compiled_program *p )
+{
+   GLboolean progress = GL_FALSE;
+   GLboolean live[REG_MAX];
+   GLint i;
+
+   for (i = 0; i < REG_MAX; i++)
+      live[i] = is_output(i);
+
+   for (i = p->nr_instructions - 1; i >= 0; i--) {
+      union instruction *op = &p->instructions[i];
+      GLuint n = nr_operands(*op);
+
+      if (op->alu.opcode == DELETED)
+	 continue;
+
+      if (op->alu.opcode != VP_OPCODE_PRINT &&
+	  (!writes_dst(*op) || !live[op->alu.dst])) {
+	 op->alu.opcode = DELETED;
+	 progress = GL_TRUE;
+	 continue;
+      }
+
+      if (writes_dst(*op) && !reads_dst(*op))
+	 live[op->alu.dst] = GL_FALSE;
+
+      if (op->alu.opcode == REL) {
+	 live[REG_ADDR] = GL_TRUE;
+	 continue;
+      }
+      if (reads_dst(*op))
+	 live[op->alu.dst] = GL_TRUE;
+      if (n > 0 && op->alu.file0 == FILE_REG)
+	 live[op->alu.idx0] = GL_TRUE;
+      if (n > 1 && op->alu.file1 == FILE_REG)
+	 live[op->alu.idx1] = GL_TRUE;
+   }
+
+   return progress;
+}
+
+
+/* Instructions whose operands are all parameters, constant registers
+ * or other invariants compute the same value for every vertex (STATE_*
+ * matrices and products, swizzled constants...).  Move them into the
+ * prologue and read the results from the REG_INVAR registers instead.
+ */
+static void hoist_invariants( struct tnl_compiled_program *p )
+{
+   GLubyte invariant[REG_MAX];	/* invariant register holding the value */
+   GLint j;
+
+   _mesa_memset(invariant, 0, sizeof(invariant));
+   p->nr_prologue = 0;
+
+   for (j = 0; j < p->nr_instructions; j++) {
+      union instruction *op = &p->instructions[j];
+      GLuint n = nr_operands(*op);
+      GLboolean hoist;
+
+      if (n > 0 && op->alu.file0 == FILE_REG && invariant[op->alu.idx0])
+	 replace_operand(op, op->alu.idx0, FILE_REG, invariant[op->alu.idx0]);
+      if (n > 1 && op->alu.file1 == FILE_REG && invariant[op->alu.idx1])
+	 replace_operand(op, op->alu.idx1, FILE_REG, invariant[op->alu.idx1]);
+
+      if (!writes_dst(*op))
+	 continue;
+
+      hoist = !reads_dst(*op) && op->alu.opcode != REL;
+      if (n > 0 && op->alu.file0 == FILE_REG && !is_invariant_reg(op->alu.idx0))
+	 hoist = GL_FALSE;
+      if (n > 1 && op->alu.file1 == FILE_REG && !is_invariant_reg(op->alu.idx1))
+	 hoist = GL_FALSE;
+
+      if (hoist && op->alu.opcode == VP_OPCODE_MOV) {
+	 /* Nothing to compute, just remember where the value is:
+	  */
+	 invariant[op->alu.dst] = (op->alu.file0 == FILE_REG) ? op->alu.idx0 : 0;
+      }
+      else if (hoist && p->nr_prologue < MAX_INVARIANTS) {
+	 GLuint reg = REG_INVAR0 + p->nr_prologue;
+	 GLuint dst = op->alu.dst;
+
+	 p->prologue[p->nr_prologue] = *op;
+	 p->prologue[p->nr_prologue].alu.dst = REG_RES;
+	 p->prologue_reg[p->nr_prologue] = reg;
+	 p->nr_prologue++;
+
+	 op->dword = 0;
+	 op->alu.opcode = VP_OPCODE_MOV;
+	 op->alu.dst = dst;
+	 op->alu.file0 = FILE_REG;
+	 op->alu.idx0 = reg;
+	 invariant[dst] = reg;
+      }
+      else {
+	 invariant[op->alu.dst] = 0;
+      }
+   }
+}
+
+
+/* MUL tmp, a, b; ADD dst, tmp, c  ->  MAD dst, a, b
+ *
+ * MAD accumulates into its destination, so c must already be in dst:
+ * either it is dst, or the instructions computing c can write it
+ * there directly.
+ */
+static GLboolean fuse_mul_add( struct tnl_compiled_program *p )
+{
+   GLboolean progress = GL_FALSE;
+   GLint i, j;
+
+   for (i = 0; i < p->nr_instructions; i++) {
+      union instruction mul = p->instructions[i], add;
+      GLuint tmp = mul.alu.dst, dst, c_file, c_idx;
+      GLint start = -1, k;
+
+      if (mul.alu.opcode != VP_OPCODE_MUL)
+	 continue;
+
+      for (j = i + 1; j < p->nr_instructions; j++)
+	 if (reads_reg(p->instructions[j], tmp) ||
+	     writes_reg(p->instructions[j], tmp))
+	    break;
+
+      if (j == p->nr_instructions)
+	 continue;
+
+      add = p->instructions[j];
+      dst = add.alu.dst;
+      if (add.alu.opcode != VP_OPCODE_ADD || live_after(p, j, tmp))
+	 continue;
+
+      if (add.alu.file0 == FILE_REG && add.alu.idx0 == tmp) {
+	 c_file = add.alu.file1;
+	 c_idx = add.alu.idx1;
+      }
+      else {
+	 c_file = add.alu.file0;
+	 c_idx = add.alu.idx0;
+      }
+      if (c_file != FILE_REG || c_idx == tmp)
+	 continue;
+
+      /* The MUL operands must still be intact at the ADD.  That
+       * includes tmp itself, if the MUL reads it - nothing else writes
+       * it in between.
+       */
+      for (k = i + 1; k < j; k++)
+	 if ((mul.alu.file0 == FILE_REG && writes_reg(p->instructions[k], mul.alu.idx0)) ||
+	     (mul.alu.file1 == FILE_REG && writes_reg(p->instructions[k], mul.alu.idx1)))
+	    break;
+      if (k < j)
+	 continue;
+
+      if (c_idx != dst) {
+	 if (dst == tmp || live_after(p, j, c_idx))
+	    continue;
+
+	 start = value_start(p, j, c_idx);
+	 if (!can_rename(p, start, j, c_idx, dst))
+	    continue;
+
+	 /* Renaming adds writes of dst, which the MUL may read:
+	  */
+	 if (i < start &&
+	     ((mul.alu.file0 == FILE_REG && mul.alu.idx0 == dst) ||
+	      (mul.alu.file1 == FILE_REG && mul.alu.idx1 == dst)))
+	    continue;
+
+	 rename_value(p, start, j, c_idx, dst);
+	 mul = p->instructions[i];
+      }
+
+      mul.alu.opcode = VP_OPCODE_MAD;
+      mul.alu.dst = dst;
+      p->instructions[j] = mul;
+      p->instructions[i].alu.opcode = DELETED;
+      progress = GL_TRUE;
+   }
+
+   return progress;
+}
+
+
+static void cleanup_program( struct tnl_compiled_program *p )
+{
+   GLuint i;
+
+   for (i = 0; i < 16; i++) {
+      GLboolean progress = propagate_copies(p);
+      progress |= coalesce_moves(p);
+      progress |= reuse_values(p);
+      progress |= remove_dead_code(p);
+      remove_deleted(p);
+      if (!progress)
+	 break;
+   }
+}
+
+static void optimize_vertex_program( struct tnl_compiled_program *p )
+{
+   cleanup_program(p);
+
+   hoist_invariants(p);
+   cleanup_program(p);
+
+   while (fuse_mul_add(p))
+      remove_deleted(p);
+   cleanup_program(p);
+}
+
+
 static void free_tnl_data( struct vertex_program *program  )
 {
    struct tnl_compiled_program *p = program->TnlData;
@@ -1040,6 +1663,7 @@ static void compile_vertex_program( struct vertex_program *program,
    struct compilation cp;
    struct tnl_compiled_program *p = CALLOC_STRUCT(tnl_compiled_program);
    GLuint i;
+   GLint nr_emitted;
 
    if (program->TnlData) 
       free_tnl_data( program );
@@ -1054,6 +1678,9 @@ static void compile_vertex_program( struct vertex_program *program,
 
    /* Compile instructions:
     */
+   if (program->IsNVProgram)
+      cvp_emit_nv_init(&cp, program);
+
    for (i = 0; i < program->Base.NumInstructions; i++) {
       cvp_emit_inst(&cp, &program->Instructions[i]);
    }
@@ -1061,14 +1688,24 @@ static void compile_vertex_program( struct vertex_program *program,
    /* Finish up:
     */
    p->nr_instructions = cp.csr - p->instructions;
+   nr_emitted = p->nr_instructions;
+
+   optimize_vertex_program(p);
 
    /* Print/disassemble:
     */
    if (DISASSEM) {
+      for (i = 0; i < p->nr_prologue; i++) {
+	 _mesa_printf("INVAR%d <- ", p->prologue_reg[i] - REG_INVAR0);
+	 _tnl_disassem_vba_insn(p->prologue[i]);
+      }
+      _mesa_printf("\n");
       for (i = 0; i < p->nr_instructions; i++) {
 	 _tnl_disassem_vba_insn(p->instructions[i]);
       }
-      _mesa_printf("\n\n");
+      _mesa_printf("\n%d instructions, %d after optimization "
+		   "(+%d per vertex buffer)\n\n",
+		   nr_emitted, p->nr_instructions, p->nr_prologue);
    }
    
 #ifdef USE_SSE_ASM
@@ -1177,6 +1814,18 @@ static GLboolean do_ndc_cliptest( struct arb_vp_machine *m )
       }
    }
 
+   if (ctx->Viewport._TilePlanesEnabled) {
+      _tnl_tile_cliptest( ctx,
+			  VB->ClipPtr,
+			  m->clipmask,
+			  &m->ormask,
+			  &m->andmask );
+
+      if (m->andmask) {
+	 return GL_FALSE;
+      }
+   }
+
    VB->ClipAndMask = m->andmask;
    VB->ClipOrMask = m->ormask;
    VB->ClipMask = m->clipmask;
@@ -1200,6 +1849,47 @@ static INLINE void call_func( struct tnl_compiled_program *p,
  * TODO: Eliminate the VB struct entirely and just use
  * struct arb_vertex_machine.
  */
+/**
+ * Allocate the machine's per-vertex arrays.  This is done the first time
+ * a program actually runs, rather than in init_vertex_program(), so
+ * contexts that only use fixed function don't pay for them.
+ */
+static GLboolean alloc_vertex_arrays( struct arb_vp_machine *m )
+{
+   const GLuint size = m->VB->Size;
+   GLuint i;
+
+   for (i = 0; i < VERT_RESULT_MAX; i++) {
+      _mesa_vector4f_alloc( &m->attribs[i], 0, size, 32 );
+      m->attribs[i].size = 4;
+   }
+   _mesa_vector4f_alloc( &m->ndcCoords, 0, size, 32 );
+   m->clipmask = (GLubyte *) ALIGN_MALLOC(sizeof(GLubyte)*size, 32 );
+
+   for (i = 0; i < VERT_RESULT_MAX; i++) {
+      if (!m->attribs[i].storage)
+         break;
+   }
+   if (i < VERT_RESULT_MAX || !m->ndcCoords.storage || !m->clipmask)
+      return GL_FALSE;
+   return GL_TRUE;
+}
+
+
+static void free_vertex_arrays( struct arb_vp_machine *m )
+{
+   GLuint i;
+
+   for (i = 0; i < VERT_RESULT_MAX; i++)
+      _mesa_vector4f_free( &m->attribs[i] );
+   _mesa_vector4f_free( &m->ndcCoords );
+   if (m->clipmask) {
+      ALIGN_FREE( m->clipmask );
+      m->clipmask = NULL;
+   }
+}
+
+
 static GLboolean
 run_arb_vertex_program(GLcontext *ctx, struct tnl_pipeline_stage *stage)
 {
@@ -1209,23 +1899,43 @@ run_arb_vertex_program(GLcontext *ctx, struct tnl_pipeline_stage *stage)
    struct vertex_buffer *VB = &TNL_CONTEXT(ctx)->vb;
    struct arb_vp_machine *m = ARB_VP_MACHINE(stage);
    struct tnl_compiled_program *p;
-   GLuint i, j, outputs;
+   GLvector4f *results[VERT_RESULT_MAX];
+   GLuint i, j, inputs, outputs;
 
-   if (!program || program->IsNVProgram)
+   /* NV programs are left to _tnl_vertex_program_stage when they have
+    * to be stepped through for GL_MESA_program_debug.
+    */
+   if (!program ||
+       (program->IsNVProgram && ctx->VertexProgram.CallbackEnabled))
       return GL_TRUE;   
 
-   if (program->Parameters) {
+   if (!m->clipmask && !alloc_vertex_arrays(m)) {
+      free_vertex_arrays(m);
+      _mesa_error(ctx, GL_OUT_OF_MEMORY, "vertex program");
+      return GL_FALSE;
+   }
+
+   if (program->IsNVProgram) {
+      _mesa_init_vp_per_primitive_registers(ctx); /* tracked matrices */
+   }
+   else if (program->Parameters) {
       _mesa_load_state_parameters(ctx, program->Parameters);
    }   
    
    p = (struct tnl_compiled_program *)program->TnlData;
    assert(p);
 
+   inputs = program->InputsRead;
+   outputs = program->OutputsWritten;
+   if (program->IsPositionInvariant) {
+      inputs |= 1 << VERT_ATTRIB_POS;
+      outputs |= 1 << VERT_RESULT_HPOS;
+   }
 
    m->nr_inputs = m->nr_outputs = 0;
 
    for (i = 0; i < _TNL_ATTRIB_MAX; i++) {
-      if (program->InputsRead & (1<<i)) {
+      if (inputs & (1<<i)) {
 	 GLuint j = m->nr_inputs++;
 	 m->input[j].idx = i;
 	 m->input[j].data = (GLfloat *)m->VB->AttribPtr[i]->data;
@@ -1236,7 +1946,7 @@ run_arb_vertex_program(GLcontext *ctx, struct tnl_pipeline_stage *stage)
    }     
 
    for (i = 0; i < 15; i++) {
-      if (program->OutputsWritten & (1<<i)) {
+      if (outputs & (1<<i)) {
 	 GLuint j = m->nr_outputs++;
 	 m->output[j].idx = i;
 	 m->output[j].data = (GLfloat *)m->attribs[i].data;
@@ -1244,6 +1954,14 @@ run_arb_vertex_program(GLcontext *ctx, struct tnl_pipeline_stage *stage)
    }     
 
 
+   /* Compute the values which are the same for every vertex:
+    */
+   for (j = 0; j < p->nr_prologue; j++) {
+      union instruction inst = p->prologue[j];
+      opcode_func[inst.alu.opcode]( m, inst );
+      COPY_4V(m->File[0][p->prologue_reg[j]], m->File[0][REG_RES]);
+   }
+
    /* Run the actual program:
     */
    for (m->vtx_nr = 0; m->vtx_nr < VB->Count; m->vtx_nr++) {
@@ -1259,6 +1977,12 @@ run_arb_vertex_program(GLcontext *ctx, struct tnl_pipeline_stage *stage)
 	 STRIDE_F(m->input[j].data, m->input[j].stride);
       }
 
+      if (program->IsPositionInvariant) {
+	 TRANSFORM_POINT(m->File[0][REG_OUT0 + VERT_RESULT_HPOS],
+			 ctx->_ModelProjectMatrix.m,
+			 m->File[0][REG_IN0 + VERT_ATTRIB_POS]);
+      }
+
       if (p->compiled_func) {
 	 call_func( p, m );
       }
@@ -1289,42 +2013,62 @@ run_arb_vertex_program(GLcontext *ctx, struct tnl_pipeline_stage *stage)
     * TODO: 2) Integrate t_vertex.c so that we just go straight ahead
     * and build machine vertices here.
     */
-   VB->ClipPtr = &m->attribs[VERT_RESULT_HPOS];
-   VB->ClipPtr->count = VB->Count;
+   for (i = 0; i < VERT_RESULT_MAX; i++)
+      results[i] = &m->attribs[i];
 
-   outputs = program->OutputsWritten;
+   /* NV_vertex_program results which the program doesn't write keep
+    * their initial value for every vertex, so hand those on as
+    * constant vectors.
+    */
+   if (program->IsNVProgram) {
+      for (i = 0; i < VERT_RESULT_MAX; i++) {
+	 if (!(outputs & (1<<i))) {
+	    GLfloat *value = m->nv_result_values[i];
+	    ASSIGN_4V(value, 0, 0, 0, 1);
+	    if (i == VERT_RESULT_FOGC && ctx->Fog.Enabled)
+	       value[0] = 1.0F;
+	    else if (i == VERT_RESULT_PSIZ && ctx->VertexProgram.PointSizeEnabled)
+	       value[0] = ctx->Point.Size;
+	    results[i] = &m->nv_results[i];
+	 }
+      }
+      outputs = ~0;
+   }
+
+   VB->ClipPtr = results[VERT_RESULT_HPOS];
+   VB->ClipPtr->count = VB->Count;
 
    if (outputs & (1<<VERT_RESULT_COL0)) {
-      VB->ColorPtr[0] = &m->attribs[VERT_RESULT_COL0];
+      VB->ColorPtr[0] = results[VERT_RESULT_COL0];
       VB->AttribPtr[VERT_ATTRIB_COLOR0] = VB->ColorPtr[0];
    }
 
    if (outputs & (1<<VERT_RESULT_BFC0)) {
-      VB->ColorPtr[1] = &m->attribs[VERT_RESULT_BFC0];
+      VB->ColorPtr[1] = results[VERT_RESULT_BFC0];
    }
 
    if (outputs & (1<<VERT_RESULT_COL1)) {
-      VB->SecondaryColorPtr[0] = &m->attribs[VERT_RESULT_COL1];
+      VB->SecondaryColorPtr[0] = results[VERT_RESULT_COL1];
       VB->AttribPtr[VERT_ATTRIB_COLOR1] = VB->SecondaryColorPtr[0];
    }
 
    if (outputs & (1<<VERT_RESULT_BFC1)) {
-      VB->SecondaryColorPtr[1] = &m->attribs[VERT_RESULT_BFC1];
+      VB->SecondaryColorPtr[1] = results[VERT_RESULT_BFC1];
    }
 
    if (outputs & (1<<VERT_RESULT_FOGC)) {
-      VB->FogCoordPtr = &m->attribs[VERT_RESULT_FOGC];
+      VB->FogCoordPtr = results[VERT_RESULT_FOGC];
       VB->AttribPtr[VERT_ATTRIB_FOG] = VB->FogCoordPtr;
    }
 
    if (outputs & (1<<VERT_RESULT_PSIZ)) {
-      VB->PointSizePtr = &m->attribs[VERT_RESULT_PSIZ];
-      VB->AttribPtr[_TNL_ATTRIB_POINTSIZE] = &m->attribs[VERT_RESULT_PSIZ];
+      VB->PointSizePtr = results[VERT_RESULT_PSIZ];
+      VB->AttribPtr[_TNL_ATTRIB_POINTSIZE] = results[VERT_RESULT_PSIZ];
    }
 
    for (i = 0; i < ctx->Const.MaxTextureUnits; i++) {
       if (outputs & (1<<(VERT_RESULT_TEX0+i))) {
-	 VB->TexCoordPtr[i] = &m->attribs[VERT_RESULT_TEX0 + i];
+	 VB->TexCoordPtr[i] = results[VERT_RESULT_TEX0 + i];
 	 VB->AttribPtr[VERT_ATTRIB_TEX0+i] = VB->TexCoordPtr[i];
       }
    }
@@ -1383,8 +2127,8 @@ validate_vertex_program( GLcontext *ctx, struct tnl_pipeline_stage *stage )
 
 
 /**
- * Called the first time stage->run is called.  In effect, don't
- * allocate data until the first time the stage is run.
+ * Called the first time the pipeline runs.  The per-vertex arrays are
+ * allocated later still, by alloc_vertex_arrays().
  */
 static GLboolean init_vertex_program( GLcontext *ctx,
 				      struct tnl_pipeline_stage *stage )
@@ -1392,7 +2136,6 @@ static GLboolean init_vertex_program( GLcontext *ctx,
    TNLcontext *tnl = TNL_CONTEXT(ctx);
    struct vertex_buffer *VB = &(tnl->vb);
    struct arb_vp_machine *m;
-   const GLuint size = VB->Size;
    GLuint i;
 
    stage->privatePtr = _mesa_calloc(sizeof(*m));
@@ -1419,19 +2162,18 @@ static GLboolean init_vertex_program( GLcontext *ctx,
    if (_mesa_getenv("MESA_EXPERIMENTAL"))
       m->try_codegen = GL_TRUE;
 
-   /* Allocate arrays of vertex output values */
+   /* The arrays of vertex output values are allocated by
+    * alloc_vertex_arrays() when a program first runs.
+    */
+
+   /* Constant results for NV programs (stride zero) */
    for (i = 0; i < VERT_RESULT_MAX; i++) {
-      _mesa_vector4f_alloc( &m->attribs[i], 0, size, 32 );
-      m->attribs[i].size = 4;
+      _mesa_vector4f_init( &m->nv_results[i], 0, &m->nv_result_values[i] );
+      m->nv_results[i].stride = 0;
+      m->nv_results[i].size = 4;
+      m->nv_results[i].count = 1;
    }
 
-   /* a few other misc allocations */
-   _mesa_vector4f_alloc( &m->ndcCoords, 0, size, 32 );
-   m->clipmask = (GLubyte *) ALIGN_MALLOC(sizeof(GLubyte)*size, 32 );
-
-   if (ctx->_MaintainTnlProgram)
-      _mesa_allow_light_in_model( ctx, GL_FALSE );
-
    m->fpucntl_rnd_neg = RND_NEG_FPU; /* const value */
    m->fpucntl_restore = RESTORE_FPU; /* const value */
 
@@ -1449,15 +2191,7 @@ static void dtr( struct tnl_pipeline_stage *stage )
    struct arb_vp_machine *m = ARB_VP_MACHINE(stage);
 
    if (m) {
-      GLuint i;
-
-      /* free the vertex program result arrays */
-      for (i = 0; i < VERT_RESULT_MAX; i++)
-         _mesa_vector4f_free( &m->attribs[i] );
-
-      /* free misc arrays */
-      _mesa_vector4f_free( &m->ndcCoords );
-      ALIGN_FREE( m->clipmask );
+      free_vertex_arrays( m );
       ALIGN_FREE( m->File[0] );
 
       _mesa_free( m );
@@ -1465,6 +2199,25 @@ static void dtr( struct tnl_pipeline_stage *stage )
    }
 }
 
+
+/**
+ * Bytes of private data held by this pipeline stage.
+ */
+static GLuint memory( GLcontext *ctx, const struct tnl_pipeline_stage *stage )
+{
+   const struct arb_vp_machine *m = ARB_VP_MACHINE(stage);
+   const GLuint size = TNL_CONTEXT(ctx)->vb.Size;
+
+   if (!m)
+      return 0;
+   if (!m->clipmask)
+      return sizeof(struct arb_vp_machine) + REG_MAX * 4 * sizeof(GLfloat);
+   return sizeof(struct arb_vp_machine)
+      + REG_MAX * 4 * sizeof(GLfloat)
+      + (VERT_RESULT_MAX + 1) * size * 4 * sizeof(GLfloat)
+      + size * sizeof(GLubyte);
+}
+
 /**
  * Public description of this pipeline stage.
  */
@@ -1475,7 +2228,8 @@ const struct tnl_pipeline_stage _tnl_arb_vertex_program_stage =
    init_vertex_program,		/* create */
    dtr,				/* destroy */
    validate_vertex_program,	/* validate */
-   run_arb_vertex_program	/* run */
+   run_arb_vertex_program,	/* run */
+   memory			/* memory */
 };
 
 
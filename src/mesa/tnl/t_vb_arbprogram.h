@@ -66,6 +66,8 @@
 #define REG_LIT    68           /* 1,0,0,1 */
 #define REG_LIT2    69           /* 1,0,0,1 */
 #define REG_SCRATCH 70		/* internal temporary */
+#define REG_INVAR0  71		/* vertex-invariant values */
+#define REG_INVAR55 126
 #define REG_UNDEF  127		/* special case - never used */
 #define REG_MAX    128
 #define REG_INVALID ~0
@@ -158,6 +160,8 @@ struct arb_vp_machine {
    GLuint nr_outputs;
 
    GLvector4f attribs[VERT_RESULT_MAX]; /**< result vectors. */
+   GLvector4f nv_results[VERT_RESULT_MAX]; /**< constant NV results */
+   GLfloat nv_result_values[VERT_RESULT_MAX][4];
    GLvector4f ndcCoords;              /**< normalized device coords */
    GLubyte *clipmask;                 /**< clip flags */
    GLubyte ormask, andmask;           /**< for clipping */
@@ -176,6 +180,15 @@ struct arb_vp_machine {
 struct tnl_compiled_program {
    union instruction instructions[1024];
    GLint nr_instructions;
+
+   /* Instructions whose operands don't vary between vertices, hoisted
+    * out by the optimizer and run once per vertex buffer.  Each one
+    * leaves its result in REG_RES, which is copied to prologue_reg[i].
+    */
+   union instruction prologue[REG_INVAR55 - REG_INVAR0 + 1];
+   GLubyte prologue_reg[REG_INVAR55 - REG_INVAR0 + 1];
+   GLint nr_prologue;
+
    void (*compiled_func)( struct arb_vp_machine * ); /**< codegen'd program */   
 };
 
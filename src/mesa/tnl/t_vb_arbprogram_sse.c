@@ -915,6 +915,21 @@ static GLboolean emit_MOV( struct compilation *cp, union instruction op )
    return GL_TRUE;
 }
 
+/* dst = arg0 * arg1 + dst, produced by the optimizer:
+ */
+static GLboolean emit_MAD( struct compilation *cp, union instruction op )
+{
+   struct x86_reg arg0 = get_arg(cp, op.alu.file0, op.alu.idx0);
+   struct x86_reg arg1 = get_arg(cp, op.alu.file1, op.alu.idx1);
+   struct x86_reg dst0 = get_arg(cp, FILE_REG, op.alu.dst); /* NOTE! */
+   struct x86_reg dst = get_dst_xmm_reg(cp, FILE_REG, op.alu.dst);
+
+   sse_movups(&cp->func, dst, arg0);
+   sse_mulps(&cp->func, dst, arg1);
+   sse_addps(&cp->func, dst, dst0);
+   return GL_TRUE;
+}
+
 static GLboolean emit_MUL( struct compilation *cp, union instruction op )
 {
    struct x86_reg arg0 = get_arg(cp, op.alu.file0, op.alu.idx0);
@@ -962,6 +977,11 @@ static GLboolean emit_REL( struct compilation *cp, union instruction op )
    FAIL;
 }
 
+static GLboolean emit_RCC( struct compilation *cp, union instruction op )
+{
+   FAIL;
+}
+
 static GLboolean emit_RCP( struct compilation *cp, union instruction op )
 {
    struct x86_reg arg0 = get_arg(cp, op.alu.file0, op.alu.idx0);
@@ -1089,14 +1109,14 @@ static GLboolean (* const emit_func[])(struct compilation *, union instruction)
    emit_LG2,
    emit_LIT,
    emit_LOG,
-   emit_NOP,
+   emit_MAD,
    emit_MAX,
    emit_MIN,
    emit_MOV,
    emit_MUL,
    emit_POW,
    emit_PRT,
-   emit_NOP,
+   emit_RCC,
    emit_RCP,
    emit_RSQ,
    emit_SGE,
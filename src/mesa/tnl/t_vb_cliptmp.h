@@ -137,7 +137,7 @@ TAG(clip_line)( GLcontext *ctx, GLuint i, GLuint j, GLubyte mask )
       LINE_CLIP( CLIP_NEAR_BIT,    0,  0,  1, 1 );
    }
 
-   if (mask & CLIP_USER_BIT) {
+   if ((mask & CLIP_USER_BIT) && !ctx->VertexProgram._Enabled) {
       for (p=0;p<MAX_CLIP_PLANES;p++) {
 	 if (ctx->Transform.ClipPlanesEnabled & (1 << p)) {
             const GLfloat a = ctx->Transform._ClipUserPlane[p][0];
@@ -149,6 +149,16 @@ TAG(clip_line)( GLcontext *ctx, GLuint i, GLuint j, GLubyte mask )
       }
    }
 
+   /* planes around a tile's guard band, see _tnl_tile_cliptest */
+   if (mask & CLIP_USER_BIT) {
+      for (p=0;p<4;p++) {
+         if (ctx->Viewport._TilePlanesEnabled & (1 << p)) {
+            const GLfloat *plane = ctx->Viewport._TilePlane[p];
+            LINE_CLIP( CLIP_USER_BIT, plane[0], plane[1], plane[2], plane[3] );
+         }
+      }
+   }
+
    if ((ctx->_TriangleCaps & DD_FLATSHADE) && j != jj)
       tnl->Driver.Render.CopyPV( ctx, jj, j );
 
@@ -185,7 +195,7 @@ TAG(clip_tri)( GLcontext *ctx, GLuint v0, GLuint v1, GLuint v2, GLubyte mask )
       POLY_CLIP( CLIP_NEAR_BIT,    0,  0,  1, 1 );
    }
 
-   if (mask & CLIP_USER_BIT) {
+   if ((mask & CLIP_USER_BIT) && !ctx->VertexProgram._Enabled) {
       for (p=0;p<MAX_CLIP_PLANES;p++) {
          if (ctx->Transform.ClipPlanesEnabled & (1 << p)) {
             const GLfloat a = ctx->Transform._ClipUserPlane[p][0];
@@ -197,6 +207,16 @@ TAG(clip_tri)( GLcontext *ctx, GLuint v0, GLuint v1, GLuint v2, GLubyte mask )
       }
    }
 
+   /* planes around a tile's guard band, see _tnl_tile_cliptest */
+   if (mask & CLIP_USER_BIT) {
+      for (p=0;p<4;p++) {
+         if (ctx->Viewport._TilePlanesEnabled & (1 << p)) {
+            const GLfloat *plane = ctx->Viewport._TilePlane[p];
+            POLY_CLIP( CLIP_USER_BIT, plane[0], plane[1], plane[2], plane[3] );
+         }
+      }
+   }
+
    if (ctx->_TriangleCaps & DD_FLATSHADE) {
       if (pv != inlist[0]) {
 	 ASSERT( inlist[0] >= VB->Count );
@@ -238,7 +258,7 @@ TAG(clip_quad)( GLcontext *ctx, GLuint v0, GLuint v1, GLuint v2, GLuint v3,
       POLY_CLIP( CLIP_NEAR_BIT,    0,  0,  1, 1 );
    }
 
-   if (mask & CLIP_USER_BIT) {
+   if ((mask & CLIP_USER_BIT) && !ctx->VertexProgram._Enabled) {
       for (p=0;p<MAX_CLIP_PLANES;p++) {
 	 if (ctx->Transform.ClipPlanesEnabled & (1 << p)) {
             const GLfloat a = ctx->Transform._ClipUserPlane[p][0];
@@ -250,6 +270,16 @@ TAG(clip_quad)( GLcontext *ctx, GLuint v0, GLuint v1, GLuint v2, GLuint v3,
       }
    }
 
+   /* planes around a tile's guard band, see _tnl_tile_cliptest */
+   if (mask & CLIP_USER_BIT) {
+      for (p=0;p<4;p++) {
+         if (ctx->Viewport._TilePlanesEnabled & (1 << p)) {
+            const GLfloat *plane = ctx->Viewport._TilePlane[p];
+            POLY_CLIP( CLIP_USER_BIT, plane[0], plane[1], plane[2], plane[3] );
+         }
+      }
+   }
+
    if (ctx->_TriangleCaps & DD_FLATSHADE) {
       if (pv != inlist[0]) {
 	 ASSERT( inlist[0] >= VB->Count );
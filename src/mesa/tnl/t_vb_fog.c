@@ -255,6 +255,16 @@ free_fog_data(struct tnl_pipeline_stage *stage)
 }
 
 
+static GLuint
+fog_data_memory(GLcontext *ctx, const struct tnl_pipeline_stage *stage)
+{
+   if (!stage->privatePtr)
+      return 0;
+   return sizeof(struct fog_stage_data)
+      + TNL_CONTEXT(ctx)->vb.Size * 4 * sizeof(GLfloat);
+}
+
+
 const struct tnl_pipeline_stage _tnl_fog_coordinate_stage =
 {
    "build fog coordinates",	/* name */
@@ -262,5 +272,6 @@ const struct tnl_pipeline_stage _tnl_fog_coordinate_stage =
    alloc_fog_data,		/* dtr */
    free_fog_data,		/* dtr */
    NULL,		/* check */
-   run_fog_stage		/* run -- initially set to init. */
+   run_fog_stage,		/* run -- initially set to init. */
+   fog_data_memory		/* memory */
 };
@@ -351,6 +351,14 @@ static void dtr( struct tnl_pipeline_stage *stage )
    }
 }
 
+static GLuint memory( GLcontext *ctx, const struct tnl_pipeline_stage *stage )
+{
+   if (!stage->privatePtr)
+      return 0;
+   return sizeof(struct light_stage_data) +
+      7 * TNL_CONTEXT(ctx)->vb.Size * 4 * sizeof(GLfloat);
+}
+
 const struct tnl_pipeline_stage _tnl_lighting_stage =
 {
    "lighting",			/* name */
@@ -358,5 +366,6 @@ const struct tnl_pipeline_stage _tnl_lighting_stage =
    init_lighting,
    dtr,				/* destroy */
    validate_lighting,
-   run_lighting
+   run_lighting,
+   memory
 };
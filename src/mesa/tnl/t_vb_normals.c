@@ -178,6 +178,16 @@ free_normal_data(struct tnl_pipeline_stage *stage)
 }
 
 
+static GLuint
+normal_data_memory(GLcontext *ctx, const struct tnl_pipeline_stage *stage)
+{
+   if (!stage->privatePtr)
+      return 0;
+   return sizeof(struct normal_stage_data)
+      + TNL_CONTEXT(ctx)->vb.Size * 4 * sizeof(GLfloat);
+}
+
+
 const struct tnl_pipeline_stage _tnl_normal_transform_stage =
 {
    "normal transform",		/* name */
@@ -185,5 +195,6 @@ const struct tnl_pipeline_stage _tnl_normal_transform_stage =
    alloc_normal_data,		/* create */
    free_normal_data,		/* destroy */
    validate_normal_stage,	/* validate */
-   run_normal_stage             /* run */
+   run_normal_stage,            /* run */
+   normal_data_memory		/* memory */
 };
@@ -100,6 +100,16 @@ free_point_data(struct tnl_pipeline_stage *stage)
 }
 
 
+static GLuint
+point_data_memory(GLcontext *ctx, const struct tnl_pipeline_stage *stage)
+{
+   if (!stage->privatePtr)
+      return 0;
+   return sizeof(struct point_stage_data)
+      + TNL_CONTEXT(ctx)->vb.Size * 4 * sizeof(GLfloat);
+}
+
+
 const struct tnl_pipeline_stage _tnl_point_attenuation_stage =
 {
    "point size attenuation",	/* name */
@@ -107,5 +117,6 @@ const struct tnl_pipeline_stage _tnl_point_attenuation_stage =
    alloc_point_data,		/* alloc data */
    free_point_data,		/* destructor */
    NULL,
-   run_point_stage		/* run */
+   run_point_stage,		/* run */
+   point_data_memory		/* memory */
 };
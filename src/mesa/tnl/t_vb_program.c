@@ -68,6 +68,48 @@ struct vp_stage_data {
 #define VP_STAGE_DATA(stage) ((struct vp_stage_data *)(stage->privatePtr))
 
 
+/**
+ * Allocate the stage's per-vertex arrays.  This is done the first time a
+ * program actually runs on this stage, rather than in init_vp(), since
+ * most contexts never need it.
+ */
+static GLboolean alloc_vertex_arrays( GLcontext *ctx,
+                                      struct vp_stage_data *store )
+{
+   const GLuint size = TNL_CONTEXT(ctx)->vb.Size;
+   GLuint i;
+
+   for (i = 0; i < VERT_RESULT_MAX; i++) {
+      _mesa_vector4f_alloc( &store->attribs[i], 0, size, 32 );
+      store->attribs[i].size = 4;
+   }
+   _mesa_vector4f_alloc( &store->ndcCoords, 0, size, 32 );
+   store->clipmask = (GLubyte *) ALIGN_MALLOC(sizeof(GLubyte)*size, 32 );
+
+   for (i = 0; i < VERT_RESULT_MAX; i++) {
+      if (!store->attribs[i].storage)
+         break;
+   }
+   if (i < VERT_RESULT_MAX || !store->ndcCoords.storage || !store->clipmask)
+      return GL_FALSE;
+   return GL_TRUE;
+}
+
+
+static void free_vertex_arrays( struct vp_stage_data *store )
+{
+   GLuint i;
+
+   for (i = 0; i < VERT_RESULT_MAX; i++)
+      _mesa_vector4f_free( &store->attribs[i] );
+   _mesa_vector4f_free( &store->ndcCoords );
+   if (store->clipmask) {
+      ALIGN_FREE( store->clipmask );
+      store->clipmask = NULL;
+   }
+}
+
+
 /**
  * This function executes vertex programs
  */
@@ -80,10 +122,21 @@ run_vp( GLcontext *ctx, struct tnl_pipeline_stage *stage )
    struct vertex_program *program = ctx->VertexProgram.Current;
    GLuint i;
 
+   /* NV programs normally run on _tnl_arb_vertex_program_stage; this
+    * interpreter is only needed to step through them for
+    * GL_MESA_program_debug.
+    */
    if (!ctx->VertexProgram._Enabled ||
-       !program->IsNVProgram)
+       !program->IsNVProgram ||
+       !ctx->VertexProgram.CallbackEnabled)
       return GL_TRUE;
 
+   if (!store->clipmask && !alloc_vertex_arrays(ctx, store)) {
+      free_vertex_arrays(store);
+      _mesa_error(ctx, GL_OUT_OF_MEMORY, "vertex program");
+      return GL_FALSE;
+   }
+
    /* load program parameter registers (they're read-only) */
    _mesa_init_vp_per_primitive_registers(ctx);
 
@@ -200,6 +253,17 @@ run_vp( GLcontext *ctx, struct tnl_pipeline_stage *stage )
     * clipping planes, but they're not supported by vertex programs.
     */
 
+   if (ctx->Viewport._TilePlanesEnabled) {
+      _tnl_tile_cliptest( ctx,
+			  VB->ClipPtr,
+			  store->clipmask,
+			  &store->ormask,
+			  &store->andmask );
+
+      if (store->andmask)
+	 return GL_FALSE;
+   }
+
    VB->ClipOrMask = store->ormask;
    VB->ClipMask = store->clipmask;
 
@@ -210,34 +274,15 @@ run_vp( GLcontext *ctx, struct tnl_pipeline_stage *stage )
 
 
 /**
- * Called the first time stage->run is called.  In effect, don't
- * allocate data until the first time the stage is run.
+ * Called the first time the pipeline runs.  The per-vertex arrays are
+ * allocated later still, by run_vp().
  */
 static GLboolean init_vp( GLcontext *ctx,
 			  struct tnl_pipeline_stage *stage )
 {
-   TNLcontext *tnl = TNL_CONTEXT(ctx);
-   struct vertex_buffer *VB = &(tnl->vb);
-   struct vp_stage_data *store;
-   const GLuint size = VB->Size;
-   GLuint i;
-
-   stage->privatePtr = MALLOC(sizeof(*store));
-   store = VP_STAGE_DATA(stage);
-   if (!store)
-      return GL_FALSE;
-
-   /* Allocate arrays of vertex output values */
-   for (i = 0; i < 15; i++) {
-      _mesa_vector4f_alloc( &store->attribs[i], 0, size, 32 );
-      store->attribs[i].size = 4;
-   }
-
-   /* a few other misc allocations */
-   _mesa_vector4f_alloc( &store->ndcCoords, 0, size, 32 );
-   store->clipmask = (GLubyte *) ALIGN_MALLOC(sizeof(GLubyte)*size, 32 );
-
-   return GL_TRUE;
+   (void) ctx;
+   stage->privatePtr = CALLOC(sizeof(struct vp_stage_data));
+   return stage->privatePtr != NULL;
 }
 
 
@@ -252,21 +297,30 @@ static void dtr( struct tnl_pipeline_stage *stage )
    struct vp_stage_data *store = VP_STAGE_DATA(stage);
 
    if (store) {
-      GLuint i;
-
-      /* free the vertex program result arrays */
-      for (i = 0; i < VERT_RESULT_MAX; i++)
-         _mesa_vector4f_free( &store->attribs[i] );
-
-      /* free misc arrays */
-      _mesa_vector4f_free( &store->ndcCoords );
-      ALIGN_FREE( store->clipmask );
-
+      free_vertex_arrays( store );
       FREE( store );
       stage->privatePtr = NULL;
    }
 }
 
+
+/**
+ * Bytes of private data held by this pipeline stage.
+ */
+static GLuint memory( GLcontext *ctx, const struct tnl_pipeline_stage *stage )
+{
+   const struct vp_stage_data *store = VP_STAGE_DATA(stage);
+   const GLuint size = TNL_CONTEXT(ctx)->vb.Size;
+
+   if (!store)
+      return 0;
+   if (!store->clipmask)
+      return sizeof(struct vp_stage_data);
+   return sizeof(struct vp_stage_data)
+      + (VERT_RESULT_MAX + 1) * size * 4 * sizeof(GLfloat)
+      + size * sizeof(GLubyte);
+}
+
 /**
  * Public description of this pipeline stage.
  */
@@ -277,5 +331,6 @@ const struct tnl_pipeline_stage _tnl_vertex_program_stage =
    init_vp,			/* create */
    dtr,				/* destroy */
    NULL, 			/* validate */
-   run_vp			/* run -- initially set to ctr */
+   run_vp,			/* run -- initially set to ctr */
+   memory			/* memory */
 };
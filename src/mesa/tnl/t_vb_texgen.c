@@ -599,6 +599,19 @@ static void free_texgen_data( struct tnl_pipeline_stage *stage )
 }
 
 
+static GLuint texgen_data_memory( GLcontext *ctx,
+				  const struct tnl_pipeline_stage *stage )
+{
+   const GLuint size = TNL_CONTEXT(ctx)->vb.Size;
+
+   if (!stage->privatePtr)
+      return 0;
+   return sizeof(struct texgen_stage_data) +
+      ctx->Const.MaxTextureCoordUnits * size * 4 * sizeof(GLfloat) +
+      size * 4 * sizeof(GLfloat);	/* tmp_f and tmp_m */
+}
+
+
 
 const struct tnl_pipeline_stage _tnl_texgen_stage =
 {
@@ -607,5 +620,6 @@ const struct tnl_pipeline_stage _tnl_texgen_stage =
    alloc_texgen_data,		/* destructor */
    free_texgen_data,		/* destructor */
    validate_texgen_stage,		/* check */
-   run_texgen_stage		/* run -- initially set to alloc data */
+   run_texgen_stage,		/* run -- initially set to alloc data */
+   texgen_data_memory		/* memory */
 };
@@ -118,6 +118,17 @@ static void free_texmat_data( struct tnl_pipeline_stage *stage )
 }
 
 
+static GLuint texmat_data_memory( GLcontext *ctx,
+				  const struct tnl_pipeline_stage *stage )
+{
+   if (!stage->privatePtr)
+      return 0;
+   return sizeof(struct texmat_stage_data) +
+      ctx->Const.MaxTextureCoordUnits *
+      TNL_CONTEXT(ctx)->vb.Size * 4 * sizeof(GLfloat);
+}
+
+
 
 const struct tnl_pipeline_stage _tnl_texture_transform_stage =
 {
@@ -127,4 +138,5 @@ const struct tnl_pipeline_stage _tnl_texture_transform_stage =
    free_texmat_data,			/* destructor */
    NULL,
    run_texmat_stage,
+   texmat_data_memory
 };
@@ -119,6 +119,53 @@ static void (*(usercliptab[5]))( GLcontext *,
 
 
 
+/**
+ * Cliptest against the planes bounding a tile's guard band (see
+ * _mesa_update_viewport_tile).  They are clipped to along with the user
+ * clip planes, so vertices outside get CLIP_USER_BIT.  The vector must be
+ * clean to element 4.
+ */
+void _tnl_tile_cliptest( GLcontext *ctx,
+			 GLvector4f *clip,
+			 GLubyte *clipmask,
+			 GLubyte *clipormask,
+			 GLubyte *clipandmask )
+{
+   GLuint p;
+
+   for (p = 0; p < 4; p++) {
+      if (ctx->Viewport._TilePlanesEnabled & (1 << p)) {
+	 GLuint nr, i;
+	 const GLfloat a = ctx->Viewport._TilePlane[p][0];
+	 const GLfloat b = ctx->Viewport._TilePlane[p][1];
+	 const GLfloat d = ctx->Viewport._TilePlane[p][3];
+	 GLfloat *coord = (GLfloat *)clip->data;
+	 GLuint stride = clip->stride;
+	 GLuint count = clip->count;
+
+	 for (nr = 0, i = 0 ; i < count ; i++) {
+	    GLfloat dp = coord[0] * a + coord[1] * b + coord[3] * d;
+
+	    if (dp < 0) {
+	       nr++;
+	       clipmask[i] |= CLIP_USER_BIT;
+	    }
+
+	    STRIDE_F(coord, stride);
+	 }
+
+	 if (nr > 0) {
+	    *clipormask |= CLIP_USER_BIT;
+	    if (nr == count) {
+	       *clipandmask |= CLIP_USER_BIT;
+	       return;
+	    }
+	 }
+      }
+   }
+}
+
+
 static GLboolean run_vertex_stage( GLcontext *ctx,
 				   struct tnl_pipeline_stage *stage )
 {
@@ -160,7 +207,6 @@ static GLboolean run_vertex_stage( GLcontext *ctx,
       break;
    }
 
-
    /* Cliptest and perspective divide.  Clip functions must clear
     * the clipmask.
     */
@@ -202,6 +248,17 @@ static GLboolean run_vertex_stage( GLcontext *ctx,
 	 return GL_FALSE;
    }
 
+   if (ctx->Viewport._TilePlanesEnabled) {
+      _tnl_tile_cliptest( ctx,
+			  VB->ClipPtr,
+			  store->clipmask,
+			  &store->ormask,
+			  &store->andmask );
+
+      if (store->andmask)
+	 return GL_FALSE;
+   }
+
    VB->ClipAndMask = store->andmask;
    VB->ClipOrMask = store->ormask;
    VB->ClipMask = store->clipmask;
@@ -248,10 +305,20 @@ static void dtr( struct tnl_pipeline_stage *stage )
       ALIGN_FREE( store->clipmask );
       FREE(store);
       stage->privatePtr = NULL;
-      stage->run = init_vertex_stage;
    }
 }
 
+static GLuint memory( GLcontext *ctx, const struct tnl_pipeline_stage *stage )
+{
+   const GLuint size = TNL_CONTEXT(ctx)->vb.Size;
+
+   if (!stage->privatePtr)
+      return 0;
+
+   return sizeof(struct vertex_stage_data) + 3 * size * 4 * sizeof(GLfloat)
+      + size * sizeof(GLubyte);
+}
+
 
 const struct tnl_pipeline_stage _tnl_vertex_transform_stage =
 {
@@ -260,5 +327,6 @@ const struct tnl_pipeline_stage _tnl_vertex_transform_stage =
    init_vertex_stage,
    dtr,				/* destructor */
    NULL,
-   run_vertex_stage		/* run -- initially set to init */
+   run_vertex_stage,		/* run -- initially set to init */
+   memory			/* memory */
 };
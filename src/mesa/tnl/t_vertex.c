@@ -489,6 +489,7 @@ void _tnl_free_vertices( GLcontext *ctx )
    if (vtx->vertex_buf) {
       ALIGN_FREE(vtx->vertex_buf);
       vtx->vertex_buf = NULL;
+      vtx->max_vertex_size = 0;
    }
    
    for (fp = vtx->fastpath ; fp ; fp = tmp) {
@@ -35,10 +35,12 @@
 #include "enums.h"
 #include "t_context.h"
 #include "t_vp_build.h"
+#include "tnl.h"
 
 #include "shader/program.h"
 #include "shader/nvvertprog.h"
 #include "shader/arbvertparse.h"
+#include "shader/progcache.h"
 
 struct state_key {
    unsigned light_global_enabled:1;
@@ -1398,65 +1400,41 @@ create_new_program( const struct state_key *key,
    build_tnl_program( &p );
 }
 
-static void *search_cache( struct tnl_cache *cache,
-			   GLuint hash,
-			   const void *key,
-			   GLuint keysize)
-{
-   struct tnl_cache *c;
-
-   for (c = cache; c; c = c->next) {
-      if (c->hash == hash && memcmp(c->key, key, keysize) == 0)
-	 return c->data;
-   }
-
-   return NULL;
-}
-
-static void cache_item( struct tnl_cache **cache,
-			GLuint hash,
-			void *key,
-			void *data )
+/**
+ * Evict callback for the program cache: drop the compiled form hanging
+ * off the program before deleting it.
+ */
+static void delete_program( GLcontext *ctx, struct program *prog )
 {
-   struct tnl_cache *c = MALLOC(sizeof(*c));
-   c->hash = hash;
-   c->key = key;
-   c->data = data;
-   c->next = *cache;
-   *cache = c;
-}
-
-static GLuint hash_key( struct state_key *key )
-{
-   GLuint *ikey = (GLuint *)key;
-   GLuint hash = 0, i;
-
-   /* I'm sure this can be improved on, but speed is important:
-    */
-   for (i = 0; i < sizeof(*key)/sizeof(GLuint); i++)
-      hash ^= ikey[i];
-
-   return hash;
+   _tnl_program_string(ctx, GL_VERTEX_PROGRAM_ARB, prog);
+   ctx->Driver.DeleteProgram(ctx, prog);
 }
 
 void _tnl_UpdateFixedFunctionProgram( GLcontext *ctx )
 {
    TNLcontext *tnl = TNL_CONTEXT(ctx);
    struct state_key *key;
-   GLuint hash;
 
    if (ctx->VertexProgram._Enabled)
       return;
 
+   if (!tnl->vp_cache) {
+      tnl->vp_cache = _mesa_new_program_cache(ctx->Const.MaxProgramCacheItems,
+                                              delete_program);
+      if (!tnl->vp_cache) {
+	 _mesa_error(ctx, GL_OUT_OF_MEMORY, "TNL program cache");
+	 return;
+      }
+   }
+
    /* Grab all the relevent state and put it in a single structure:
     */
    key = make_state_key(ctx);
-   hash = hash_key(key);
 
    /* Look for an already-prepared program for this state:
     */
    ctx->_TnlProgram = (struct vertex_program *)
-      search_cache( tnl->vp_cache, hash, key, sizeof(*key) );
+      _mesa_search_program_cache( tnl->vp_cache, key, sizeof(*key) );
    
    /* OK, we'll have to build a new one:
     */
@@ -1467,17 +1445,25 @@ void _tnl_UpdateFixedFunctionProgram( GLcontext *ctx )
       ctx->_TnlProgram = (struct vertex_program *)
 	 ctx->Driver.NewProgram(ctx, GL_VERTEX_PROGRAM_ARB, 0); 
 
-      create_new_program( key, ctx->_TnlProgram, 
-			  ctx->Const.MaxVertexProgramTemps );
+      if (!_mesa_program_cache_load(ctx, GL_VERTEX_PROGRAM_ARB,
+                                    PROGRAM_CACHE_STATE,
+                                    key, sizeof(*key),
+                                    &ctx->_TnlProgram->Base)) {
+	 create_new_program( key, ctx->_TnlProgram, 
+			     ctx->Const.MaxVertexProgramTemps );
+
+	 _mesa_program_cache_store(ctx, GL_VERTEX_PROGRAM_ARB,
+				   PROGRAM_CACHE_STATE,
+				   key, sizeof(*key),
+				   &ctx->_TnlProgram->Base);
+      }
 
-      cache_item(&tnl->vp_cache, hash, key, ctx->_TnlProgram );
-   }
-   else {
-      FREE(key);
-      if (0) 
-	 _mesa_printf("Found existing TNL program for key %x\n", hash);
+      _mesa_insert_program_cache(ctx, tnl->vp_cache, key, sizeof(*key),
+                                 &ctx->_TnlProgram->Base);
    }
 
+   FREE(key);
+
    /* Need a BindProgram callback for the driver?
     */
 }
@@ -1486,12 +1472,10 @@ void _tnl_UpdateFixedFunctionProgram( GLcontext *ctx )
 void _tnl_ProgramCacheDestroy( GLcontext *ctx )
 {
    TNLcontext *tnl = TNL_CONTEXT(ctx);
-   struct tnl_cache *a, *tmp;
 
-   for (a = tnl->vp_cache ; a; a = tmp) {
-      tmp = a->next;
-      FREE(a->key);
-      FREE(a->data);
-      FREE(a);
+   if (tnl->vp_cache) {
+      _mesa_delete_program_cache(ctx, tnl->vp_cache, "TNL");
+      tnl->vp_cache = NULL;
+      ctx->_TnlProgram = NULL;
    }
 }
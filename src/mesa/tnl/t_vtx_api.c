@@ -38,6 +38,7 @@ USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "dlist.h"
 #include "state.h"
 #include "light.h"
+#include "program.h"
 #include "api_arrayelt.h"
 #include "api_noop.h"
 #include "t_vtx_api.h"
@@ -177,6 +178,7 @@ static void _tnl_copy_to_current( GLcontext *ctx )
    }
 
    if (tnl->vtx.have_materials) {
+      _mesa_program_state_changed( ctx, _NEW_LIGHT );
       tnl->Driver.NotifyMaterialChange( ctx );
    }
          
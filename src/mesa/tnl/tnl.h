@@ -46,6 +46,15 @@ _tnl_DestroyContext( GLcontext *ctx );
 extern void
 _tnl_InvalidateState( GLcontext *ctx, GLuint new_state );
 
+/* Free the pipeline stage storage, which is recreated when the pipeline
+ * next runs, and report the module's memory use:
+ */
+extern void
+_tnl_TrimContext( GLcontext *ctx );
+
+extern GLuint
+_tnl_ContextMemory( GLcontext *ctx );
+
 /* Functions to revive the tnl module after being unhooked from
  * dispatch and/or driver callbacks.
  */
@@ -105,10 +105,18 @@ SOURCE=..\..\..\..\src\mesa\main\api_loopback.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\main\api_marshal.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\main\api_noop.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\main\api_trace.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\main\api_validate.c
 # End Source File
 # Begin Source File
@@ -346,6 +354,10 @@ SOURCE=..\..\..\..\src\mesa\main\polygon.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\shader\progcache.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\shader\program.c
 # End Source File
 # Begin Source File
@@ -398,6 +410,10 @@ SOURCE=..\..\..\..\src\mesa\swrast\s_copypix.c
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\swrast\s_damage.c
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\swrast\s_depth.c
 # End Source File
 # Begin Source File
@@ -715,10 +731,26 @@ SOURCE=..\..\..\..\src\mesa\main\api_loopback.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\main\api_marshal.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\..\..\src\mesa\main\api_marshal_tmp.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\main\api_noop.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\main\api_trace.h
+# End Source File
+# Begin Source File
+
+SOURCE=..\..\..\..\src\mesa\main\api_trace_tmp.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\main\api_validate.h
 # End Source File
 # Begin Source File
@@ -867,6 +899,10 @@ SOURCE=..\..\..\..\src\mesa\glapi\glprocs.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\glapi\glprocs_hash.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\glapi\glthread.h
 # End Source File
 # Begin Source File
@@ -1023,6 +1059,10 @@ SOURCE=..\..\..\..\src\mesa\main\polygon.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\shader\progcache.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\shader\program.h
 # End Source File
 # Begin Source File
@@ -1071,6 +1111,10 @@ SOURCE=..\..\..\..\src\mesa\swrast\s_context.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\swrast\s_damage.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\swrast\s_depth.h
 # End Source File
 # Begin Source File
@@ -1131,6 +1175,10 @@ SOURCE=..\..\..\..\src\mesa\swrast\s_stencil.h
 # End Source File
 # Begin Source File
 
+SOURCE=..\..\..\..\src\mesa\swrast\s_texenvtmp.h
+# End Source File
+# Begin Source File
+
 SOURCE=..\..\..\..\src\mesa\swrast\s_texture.h
 # End Source File
 # Begin Source File